@@ -517,7 +517,8 @@ STATUS Ethernet_Tgt_Receive_Packet(DV_DEVICE_ENTRY *device)
                     bufCount = trackingIdx + (NUM_RX_DESC - RXBufDesIdx) + 1;
                 }
 
-                if ((MAX_BUFFERS - MEM_Buffers_Used) >= bufCount)
+                if (((MAX_BUFFERS - MEM_Buffers_Used) +
+                     MEM_RX_RING_CACHED(device->dev_rx_ring)) >= bufCount)
                 {
                     currP = headP;
 
@@ -549,7 +550,7 @@ STATUS Ethernet_Tgt_Receive_Packet(DV_DEVICE_ENTRY *device)
                         /***************************************/
 
                         /* Replace RX descriptor with new net buffer. */
-                        RXDescP[RXBufDesIdx].rdes2 = (UINT32)MEM_Buffer_Dequeue(&MEM_Buffer_Freelist);
+                        RXDescP[RXBufDesIdx].rdes2 = (UINT32)MEM_Rx_Buffer_Alloc(device);
 
                         /* Return descriptor to DMA control. */
                         RXDescP[RXBufDesIdx].rdes0 |= STM32_EMAC_RX_DESC_OWN_BIT;
@@ -562,8 +563,8 @@ STATUS Ethernet_Tgt_Receive_Packet(DV_DEVICE_ENTRY *device)
                     /* Push the received packet to NET stack for further processing */
                     /****************************************************************/
 
-                    /* Put head of the chain onto NET stack. */
-                    MEM_Buffer_Enqueue(&MEM_Buffer_List, headP);
+                    /* Put head of the chain onto the receive ring. */
+                    MEM_Rx_Ring_Put(device, headP);
 
                     /* Set flag so NET stack gets notified of buffers being received. */
                     notify_net = NU_TRUE;
@@ -677,11 +678,37 @@ STATUS Ethernet_Tgt_Xmit_Packet(DV_DEVICE_ENTRY *device, NET_BUFFER *buf_ptr)
     INT               bytes_copied = 0;
     UINT32            firstFrmIdx, lastFrmIdx;
     STM32_EMAC_XDATA  *xdata = (STM32_EMAC_XDATA *)device->user_defined_1;
+#if (defined(CFG_NU_OS_SVCS_PWR_ENABLE) && (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_GOVERNOR == NU_TRUE))
+    INT               old_level;
+#endif
 
     /* If pointer to NET_BUFFER is NULL or current TX descriptor is unavailable, bail */
     if ((buf_ptr == NULL) || ((TXDescP[TXBufDesIdx].tdes0 & STM32_EMAC_TX_DESC_OWN_BIT) != 0))
         return 0;
 
+#if (defined(CFG_NU_OS_SVCS_PWR_ENABLE) && (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_GOVERNOR == NU_TRUE))
+    /* Hold the highest OP until the TX HISR finds the transqueue empty.
+       The hold is placed with interrupts enabled as it may wake the
+       governor, so a hold placed at the same time by the TX HISR is
+       given back. */
+    if ((xdata->emac_pm_hold == NU_FALSE) &&
+        (NU_PM_Governor_Hold_OP (PM_GOVERNOR_HIGHEST_OP) == NU_SUCCESS))
+    {
+        old_level = NU_Local_Control_Interrupts (NU_DISABLE_INTERRUPTS);
+
+        if (xdata->emac_pm_hold == NU_FALSE)
+        {
+            xdata->emac_pm_hold = NU_TRUE;
+        }
+        else
+        {
+            (VOID)NU_PM_Governor_Release_OP (PM_GOVERNOR_HIGHEST_OP);
+        }
+
+        NU_Local_Control_Interrupts (old_level);
+    }
+#endif
+
     /* This is first frame for this pay load set first segment bit */
     TXDescP[TXBufDesIdx].tdes0 |= STM32_EMAC_TX_DESC_FS_BIT;
 
@@ -915,6 +942,9 @@ VOID Ethernet_Tgt_TX_HISR (VOID)
     DV_DEVICE_ENTRY *device; 
     INT             old_level;
     NU_HISR         *hcb;
+#if (defined(CFG_NU_OS_SVCS_PWR_ENABLE) && (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_GOVERNOR == NU_TRUE))
+    STM32_EMAC_XDATA *xdata;
+#endif
 
     /* Get the device associated with this HISR from the HISR's control block */
 
@@ -953,6 +983,21 @@ VOID Ethernet_Tgt_TX_HISR (VOID)
         /* Restore interrupts. */
         NU_Local_Control_Interrupts(old_level);
     }
+
+#if (defined(CFG_NU_OS_SVCS_PWR_ENABLE) && (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_GOVERNOR == NU_TRUE))
+    xdata = (STM32_EMAC_XDATA *)device->user_defined_1;
+
+    /* Let the DVFS governor lower the OP once nothing is left to send */
+    old_level = NU_Local_Control_Interrupts (NU_DISABLE_INTERRUPTS);
+
+    if ((device->dev_transq.head == NU_NULL) && (xdata->emac_pm_hold == NU_TRUE))
+    {
+        xdata->emac_pm_hold = NU_FALSE;
+        (VOID)NU_PM_Governor_Release_OP (PM_GOVERNOR_HIGHEST_OP);
+    }
+
+    NU_Local_Control_Interrupts (old_level);
+#endif
 }   /* Ethernet_Tgt_TX_HISR */
 
 /**************************************************************************
@@ -1085,6 +1130,10 @@ static STATUS  Ethernet_Tgt_Allocate_Descriptor (DV_DEVICE_ENTRY *device)
     /* Set up RX descriptor chain */
     /******************************/
 
+    /* Create the receive ring and buffer cache.  If this fails, received
+       packets are passed to the stack through MEM_Rx_Driver_List. */
+    (VOID)MEM_Rx_Ring_Create(device);
+
     /* Allocate memory for RX descriptors */
     status = NU_Allocate_Memory(&System_Memory, (VOID**)&pointer,
                                 (NUM_RX_DESC * sizeof(STM32EMAC_RXDESC)), NU_NO_SUSPEND);
@@ -1108,7 +1157,7 @@ static STATUS  Ethernet_Tgt_Allocate_Descriptor (DV_DEVICE_ENTRY *device)
             RXDescP[i].rdes1 |= (STM32_EMAC_RX_DESC_RCH_BIT | STM32_EMAC_RX_BUF_SIZE);
 
             /* Dequeue a NET buffer and assign it to this descriptor */
-            RXDescP[i].rdes2 = (UINT32) MEM_Buffer_Dequeue(&MEM_Buffer_Freelist);
+            RXDescP[i].rdes2 = (UINT32) MEM_Rx_Buffer_Alloc(device);
 
             /* Set next descriptor address */
             if (i == (NUM_RX_DESC-1))
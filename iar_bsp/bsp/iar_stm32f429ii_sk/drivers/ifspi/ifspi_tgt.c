@@ -721,6 +721,15 @@ STATUS IF_SPI_Tgt_Controller_Init (ETHERNET_INSTANCE_HANDLE *inst_handle,
                                    sizeof(ETHERNET_SESSION_HANDLE), NU_NO_SUSPEND);
     }
 
+    /* Create the receive ring and buffer cache before the task starts
+     * receiving.  If this fails, received packets are passed to the
+     * stack through MEM_Rx_Driver_List.
+     */
+    if (status == NU_SUCCESS)
+    {
+        (VOID)MEM_Rx_Ring_Create(device);
+    }
+
     if (status == NU_SUCCESS)
     {
         sess->device = device;
@@ -898,6 +907,11 @@ static VOID IFSPI_Task_Entry(UNSIGNED argc, VOID *argv)
     NET_BUFFER*               headP = NULL;
     NET_BUFFER*               prevP = NULL;
     NET_BUFFER*               currP = NULL;
+
+#if (defined(CFG_NU_OS_SVCS_PWR_ENABLE) && (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_GOVERNOR == NU_TRUE))
+    /* Set while the DVFS governor is held at the highest OP */
+    BOOLEAN                   pm_hold = NU_FALSE;
+#endif
     
 
   tgt_ptr->tx_frame.sof = IFSPI_FRAME_SOF;
@@ -916,6 +930,25 @@ static VOID IFSPI_Task_Entry(UNSIGNED argc, VOID *argv)
   /* Begin tx/rx loop */
   while(1)
   {
+#if (defined(CFG_NU_OS_SVCS_PWR_ENABLE) && (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_GOVERNOR == NU_TRUE))
+    /* Keep the CPU at the highest OP while frames are moving in either
+     * direction, a lower OP would stretch every SPI frame.
+     */
+    if ((device->dev_transq.head != NULL) || (buf_ptr != NU_NULL) || (headP != NULL))
+    {
+      if ((pm_hold == NU_FALSE) && 
+          (NU_PM_Governor_Hold_OP(PM_GOVERNOR_HIGHEST_OP) == NU_SUCCESS))
+      {
+        pm_hold = NU_TRUE;
+      }
+    }
+    else if (pm_hold == NU_TRUE)
+    {
+      (VOID)NU_PM_Governor_Release_OP(PM_GOVERNOR_HIGHEST_OP);
+      pm_hold = NU_FALSE;
+    }
+#endif
+
     /*--------------------- Prepare Data to TX ------------------------------*/
 
     tgt_ptr->tx_frame.sof = IFSPI_FRAME_SOF;
@@ -1008,8 +1041,8 @@ static VOID IFSPI_Task_Entry(UNSIGNED argc, VOID *argv)
       {
         headP->mem_total_data_len = pktSize;
 
-        /* Put head of the chain onto NET stack. */
-        MEM_Buffer_Enqueue(&MEM_Buffer_List, headP);
+        /* Put head of the chain onto the receive ring. */
+        MEM_Rx_Ring_Put(device, headP);
 
         /* Set NET notification event to show at least 1 frame was successfully received */
         NU_Set_Events (&Buffers_Available, (UNSIGNED)2, NU_OR);
@@ -1022,7 +1055,7 @@ static VOID IFSPI_Task_Entry(UNSIGNED argc, VOID *argv)
       /* Mask out the First Segment (FS) value and get data length */            
       tgt_ptr->rx_frame.len &= IFSPI_DATA_LEN_MASK;
 
-      currP = (NET_BUFFER*)MEM_Buffer_Dequeue(&MEM_Buffer_Freelist);
+      currP = MEM_Rx_Buffer_Alloc(device);
 
       if ((currP != NULL) && 
           (tgt_ptr->rx_frame.len <= IF_SPI_BUF_SIZE))
@@ -1052,8 +1085,8 @@ static VOID IFSPI_Task_Entry(UNSIGNED argc, VOID *argv)
       {
         headP->mem_total_data_len = pktSize;
 
-        /* Put head of the chain onto NET stack. */
-        MEM_Buffer_Enqueue(&MEM_Buffer_List, headP);
+        /* Put head of the chain onto the receive ring. */
+        MEM_Rx_Ring_Put(device, headP);
 
         /* Set NET notification event to show at least 1 frame was successfully received */
         NU_Set_Events (&Buffers_Available, (UNSIGNED)2, NU_OR);
@@ -1066,7 +1099,7 @@ static VOID IFSPI_Task_Entry(UNSIGNED argc, VOID *argv)
       /* Otherwise link buffers */
       else
       {
-        currP = (NET_BUFFER*)MEM_Buffer_Dequeue(&MEM_Buffer_Freelist);
+        currP = MEM_Rx_Buffer_Alloc(device);
 
         if ((currP != NULL) && 
             (tgt_ptr->rx_frame.len <= IF_SPI_BUF_SIZE))
@@ -127,6 +127,11 @@ typedef struct EMAC_XDATA_STRUCT
     UINT32    emac_tx_desc_access_error;
     UINT32    emac_tx_data_buffer_access_error; 
 
+#if (defined(CFG_NU_OS_SVCS_PWR_ENABLE) && (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_GOVERNOR == NU_TRUE))
+    /* Set while the DVFS governor is held for queued transmissions */
+    BOOLEAN   emac_pm_hold;
+#endif
+
 } STM32_EMAC_XDATA;
 
 #define	BIT_FLD_SET(bit_pos,value)	(value << bit_pos)
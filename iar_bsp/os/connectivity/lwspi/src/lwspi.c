@@ -194,6 +194,16 @@ static STATUS LWSPI_Bus_Register(DV_DEV_ID spi_dev_id, VOID *context)
         status = DVC_Dev_Ioctl(spi_bus->dev_handle, DV_IOCTL0, &ioctl0, sizeof(ioctl0));
     }
 
+#ifdef  CFG_NU_OS_DRVR_DMA_ENABLE
+    if(status == NU_SUCCESS)
+    {
+        /* Bind the bus session once for the per transfer DMA
+         * preparation IOCTL. Closing the session unbinds it.
+         */
+        status = DVC_Dev_Fast_IO_Bind(spi_bus->dev_handle, &spi_bus->dma_fast_io);
+    }
+#endif
+
     if(status == NU_SUCCESS)
     {
         /* Save SPI ioctl base in the SPI bus control block. */
@@ -936,10 +946,10 @@ STATUS NU_SPI_DMA_Transfer(NU_SPI_HANDLE handle,
 
 
             /* Perform IOCTL call to enable the target device dma */
-            status = DVC_Dev_Ioctl(spi_bus->dev_handle,
-                                   (spi_bus->ioctl_base + LWSPI_IOCTL_PREP_DMA),
-                                    spi_device,
-                                    0);
+            status = DVC_Dev_Fast_IO_Ioctl(&(spi_bus->dma_fast_io),
+                                           (spi_bus->ioctl_base + LWSPI_IOCTL_PREP_DMA),
+                                           spi_device,
+                                           0);
 
             /* Initiate DMA transfers.  
              * Initiate the rx in non-block and then tx in block to allow
@@ -509,7 +509,7 @@ static VOID Hibernate_Dv_Save_Dyn_Mem(NU_MEMORY_POOL *pool_ptr,
     /* Initialize the loop */
     last_memory = NU_NULL;
     memory_ptr = pool_ptr -> dm_memory_list;
-    end_ptr = (DM_HEADER*)pool_ptr -> dm_start_address;
+    end_ptr = DM_FIRST_BLOCK(pool_ptr);
     end_ptr = end_ptr -> dm_previous_memory;
     do
     {
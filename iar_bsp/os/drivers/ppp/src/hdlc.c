@@ -1461,9 +1461,9 @@ VOID HDLC_RX_HISR_Entry(VOID)
             /* Remove the temporary buffer entry. */
             _ppp_rx_queue[_ppp_rx_queue_read] = NU_NULL;
 
-            /* Move the packet onto the buffer list, where the upper
+            /* Pass the packet to the stack, where the upper
             layer protocols can find it. */
-            MEM_Buffer_Enqueue (&MEM_Buffer_List, buf_ptr);
+            MEM_Rx_Ring_Put(buf_ptr->mem_buf_device, buf_ptr);
 
             /* If using SNMP, this will update the MIB */
             MIB2_ifInNUcastPkts_Inci(buf_ptr->mem_buf_device->dev_index);
@@ -256,7 +256,7 @@ STATUS NU_Terminal_Data_Ready(CHAR *link_name)
 
     NU_SUPERVISOR_MODE();    /* switch to supervisor mode */
 
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -270,7 +270,7 @@ STATUS NU_Terminal_Data_Ready(CHAR *link_name)
         status = MDM_Data_Ready(dev_ptr);
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -365,7 +365,7 @@ STATUS NU_Get_Terminal_Char(CHAR *c, CHAR *link_name)
     }
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -379,7 +379,7 @@ STATUS NU_Get_Terminal_Char(CHAR *c, CHAR *link_name)
         status = MDM_Get_Char(c, dev_ptr);
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -496,7 +496,7 @@ STATUS NU_Modem_Control_String(CHAR *string, CHAR *link_name)
     }
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -512,7 +512,7 @@ STATUS NU_Modem_Control_String(CHAR *string, CHAR *link_name)
     }
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -566,7 +566,7 @@ STATUS MDM_Control_String(CHAR *string, DV_DEVICE_ENTRY *dev_ptr)
                 index_save = dev_ptr->dev_index;
 
                 /* Release the semaphore. */
-                if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if(NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release a semaphore",
                                    NERR_SEVERE, __FILE__, __LINE__);
@@ -575,7 +575,7 @@ STATUS MDM_Control_String(CHAR *string, DV_DEVICE_ENTRY *dev_ptr)
                 MDM_Delay(500);
 
                 /* Grab the semaphore again. */
-                if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+                if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to obtain a semaphore",
                                    NERR_SEVERE, __FILE__, __LINE__);
@@ -618,7 +618,7 @@ STATUS MDM_Control_String(CHAR *string, DV_DEVICE_ENTRY *dev_ptr)
                 index_save = dev_ptr->dev_index;
 
                 /* Release the semaphore. */
-                if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if(NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release a semaphore",
                                    NERR_SEVERE, __FILE__, __LINE__);
@@ -627,7 +627,7 @@ STATUS MDM_Control_String(CHAR *string, DV_DEVICE_ENTRY *dev_ptr)
                 MDM_Delay(100);              /* wait 100 ms. for slow modems */
 
                 /* Grab the semaphore again. */
-                if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+                if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to obtain a semaphore",
                                    NERR_SEVERE, __FILE__, __LINE__);
@@ -733,7 +733,7 @@ STATUS MDM_Dial(CHAR *number, DV_DEVICE_ENTRY *dev_ptr)
         return(NU_INVALID_POINTER);
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
            __FILE__, __LINE__);
@@ -802,7 +802,7 @@ STATUS MDM_Dial(CHAR *number, DV_DEVICE_ENTRY *dev_ptr)
             index_save = dev_ptr->dev_index;
 
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -812,7 +812,7 @@ STATUS MDM_Dial(CHAR *number, DV_DEVICE_ENTRY *dev_ptr)
             NU_Sleep(TICKS_PER_SECOND * 2);
 
             /* Grab the semaphore again. */
-            if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+            if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                    __FILE__, __LINE__);
@@ -847,7 +847,7 @@ STATUS MDM_Dial(CHAR *number, DV_DEVICE_ENTRY *dev_ptr)
     }
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                    __FILE__, __LINE__);
@@ -950,7 +950,7 @@ CHAR *MDM_Get_Modem_String(CHAR *response, CHAR *dial_string,
             index_save = dev_ptr->dev_index;
 
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -959,7 +959,7 @@ CHAR *MDM_Get_Modem_String(CHAR *response, CHAR *dial_string,
             NU_Sleep(10);
 
             /* Grab the semaphore again. */
-            if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+            if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                    __FILE__, __LINE__);
@@ -1073,7 +1073,7 @@ STATUS MDM_Hangup(LINK_LAYER *link_ptr, UINT8 wait_for_modem)
                 index_save = link_ptr->hwi.dev_ptr->dev_index;
 
                 /* Release the semaphore. */
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
@@ -1083,7 +1083,7 @@ STATUS MDM_Hangup(LINK_LAYER *link_ptr, UINT8 wait_for_modem)
                 NU_Sleep (TICKS_PER_SECOND);
 
                 /* Grab the semaphore again. */
-                if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+                if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1191,7 +1191,7 @@ STATUS NU_Purge_Terminal_Buffer(CHAR *link_name)
     NU_SUPERVISOR_MODE();    /* switch to supervisor mode */
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1207,7 +1207,7 @@ STATUS NU_Purge_Terminal_Buffer(CHAR *link_name)
     }
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1307,7 +1307,7 @@ STATUS NU_Change_Communication_Mode(INT mode, CHAR *link_name)
     }
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1320,7 +1320,7 @@ STATUS NU_Change_Communication_Mode(INT mode, CHAR *link_name)
         status = MDM_Change_Communication_Mode(mode, dev_ptr);
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1412,7 +1412,7 @@ STATUS MDM_Wait_For_Client (DV_DEVICE_ENTRY *dev_ptr)
 #endif
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
            __FILE__, __LINE__);
@@ -1434,7 +1434,7 @@ STATUS MDM_Wait_For_Client (DV_DEVICE_ENTRY *dev_ptr)
     index_save = dev_ptr->dev_index;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                    __FILE__, __LINE__);
@@ -1444,7 +1444,7 @@ STATUS MDM_Wait_For_Client (DV_DEVICE_ENTRY *dev_ptr)
     NU_Sleep (TICKS_PER_SECOND);
 
     /* Grab the semaphore again. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
            __FILE__, __LINE__);
@@ -1454,7 +1454,7 @@ STATUS MDM_Wait_For_Client (DV_DEVICE_ENTRY *dev_ptr)
     if(DEV_Get_Dev_By_Index(index_save) == NU_NULL)
     {
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1489,7 +1489,7 @@ STATUS MDM_Wait_For_Client (DV_DEVICE_ENTRY *dev_ptr)
         index_save = dev_ptr->dev_index;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1499,7 +1499,7 @@ STATUS MDM_Wait_For_Client (DV_DEVICE_ENTRY *dev_ptr)
         NU_Sleep (TICKS_PER_SECOND);
 
         /* Grab the semaphore again. */
-        if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+        if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                __FILE__, __LINE__);
@@ -1607,7 +1607,7 @@ STATUS MDM_Wait_For_Client (DV_DEVICE_ENTRY *dev_ptr)
     }
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                    __FILE__, __LINE__);
@@ -1647,7 +1647,7 @@ STATUS NU_Put_Terminal_Char (CHAR c, CHAR *link_name)
     NU_SUPERVISOR_MODE();    /* switch to supervisor mode */
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1661,7 +1661,7 @@ STATUS NU_Put_Terminal_Char (CHAR c, CHAR *link_name)
         status = MDM_Put_Char (c, dev_ptr);
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1739,7 +1739,7 @@ STATUS NU_Carrier (CHAR *link_name)
     NU_SUPERVISOR_MODE();    /* switch to supervisor mode */
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1753,7 +1753,7 @@ STATUS NU_Carrier (CHAR *link_name)
         status = MDM_Carrier(dev_ptr);
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1890,7 +1890,7 @@ STATUS MDM_Modem_Connected (DV_DEVICE_ENTRY *dev_ptr)
         index_save = dev_ptr->dev_index;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1900,7 +1900,7 @@ STATUS MDM_Modem_Connected (DV_DEVICE_ENTRY *dev_ptr)
         NU_Sleep (SCK_Ticks_Per_Second);
 
         /* Grab the semaphore again. */
-        if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+        if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                __FILE__, __LINE__);
@@ -1982,7 +1982,7 @@ STATUS MDM_Rings_To_Answer(CHAR *link_name, UINT8 num_rings)
     NU_SUPERVISOR_MODE();    /* switch to supervisor mode */
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2005,7 +2005,7 @@ STATUS MDM_Rings_To_Answer(CHAR *link_name, UINT8 num_rings)
         status = NU_INVALID_LINK;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2047,7 +2047,7 @@ STATUS NU_Modem_Set_Local_Num(CHAR *link_name, CHAR *local_num)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2061,7 +2061,7 @@ STATUS NU_Modem_Set_Local_Num(CHAR *link_name, CHAR *local_num)
         status = MDM_Set_Local_Num(dev_ptr, local_num);
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2142,7 +2142,7 @@ STATUS NU_Modem_Get_Remote_Num(CHAR *link_name, CHAR *remote_num)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2156,7 +2156,7 @@ STATUS NU_Modem_Get_Remote_Num(CHAR *link_name, CHAR *remote_num)
         status = MDM_Get_Remote_Num(dev_ptr, remote_num);
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
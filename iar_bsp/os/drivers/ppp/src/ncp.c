@@ -293,7 +293,7 @@ STATUS NCP_Set_Client_IP_Address(PPP_OPTIONS *ppp_options)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -347,7 +347,7 @@ STATUS NCP_Set_Client_IP_Address(PPP_OPTIONS *ppp_options)
         ret_status = NU_INVALID_LINK;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
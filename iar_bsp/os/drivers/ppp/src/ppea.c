@@ -603,7 +603,7 @@ STATUS PPEA_Wait_For_Client(DV_DEVICE_ENTRY *vdevice)
     
     /* Reserve the TCP_Resource semaphore for exclusive access to the
        list of PPPoE devices. */
-    NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    NET_Obtain_Stack_Lock(NU_SUSPEND);
     
     /* Make sure that the device is available and set up for use
        by this process. */
@@ -619,7 +619,7 @@ STATUS PPEA_Wait_For_Client(DV_DEVICE_ENTRY *vdevice)
     }
 
     /* Done with access to the virtual devices. Release the semaphore. */
-    NU_Release_Semaphore(&TCP_Resource);
+    NET_Release_Stack_Lock();
 
     if (vdevice != NU_NULL)
     {
@@ -628,14 +628,14 @@ STATUS PPEA_Wait_For_Client(DV_DEVICE_ENTRY *vdevice)
         if (!session)
         {
             /* Get the network resource. */
-            NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+            NET_Obtain_Stack_Lock(NU_SUSPEND);
             
             /* Return the device to the pool so it can be used by
                another process. */
             PPE_Return_Device(vdevice);
 
             /* Done with access to the virtual devices. Release the semaphore. */
-            NU_Release_Semaphore(&TCP_Resource);
+            NET_Release_Stack_Lock();
             
 #if (NU_DEBUG_PPE == NU_TRUE)        
             PPE_Printf("DEMOI_Wait_For_Client() - Error in PPPoE link negotiation.\r\n");
@@ -586,7 +586,7 @@ STATUS PPEH_Discovery(CHAR *service, DV_DEVICE_ENTRY *vdevice)
 
     /* Reserve the TCP_Resource semaphore for exclusive access to the
        list of PPPoE devices. */
-    NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    NET_Obtain_Stack_Lock(NU_SUSPEND);
     
     /* Make sure the device is available, or if any device is available. */
     if (vdevice == NU_NULL)
@@ -611,7 +611,7 @@ STATUS PPEH_Discovery(CHAR *service, DV_DEVICE_ENTRY *vdevice)
     ppe_layer = (PPE_LAYER*)link_layer->link;	
 
     /* Done with access to the virtual devices. Release the semaphore. */
-    NU_Release_Semaphore(&TCP_Resource);
+    NET_Release_Stack_Lock();
     
     /* Save the service requested into the ppe_layer structure. */
     ppe_layer->ppe_service.name = (UINT8*)service;
@@ -643,14 +643,14 @@ STATUS PPEH_Discovery(CHAR *service, DV_DEVICE_ENTRY *vdevice)
         {
             /* Reserve the TCP_Resource semaphore for exclusive access to the
                list of PPPoE devices. */
-            NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+            NET_Obtain_Stack_Lock(NU_SUSPEND);
             
             /* Discovery was not successful, so return the device to its
                initial unused state. */
             PPE_Return_Device(vdevice);
 
             /* Done with access to the virtual devices. Release the semaphore. */
-            NU_Release_Semaphore(&TCP_Resource);
+            NET_Release_Stack_Lock();
             
 #if (NU_DEBUG_PPE == NU_TRUE)
             PPE_Printf("Received a timeout... Failed to connect...\r\n");
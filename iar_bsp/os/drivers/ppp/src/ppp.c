@@ -437,7 +437,7 @@ VOID PPP_Task_Entry(UNSIGNED argc, VOID *argv)
             event = event_msg[PPP_MSG_EVENT_INDEX];
 
             /* Grab the semaphore. */
-            if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+            if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to obtain TCP semaphore",
                                NERR_SEVERE, __FILE__, __LINE__);
@@ -488,7 +488,7 @@ VOID PPP_Task_Entry(UNSIGNED argc, VOID *argv)
             }
 
             /* Release the semaphore. */
-            if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if(NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release TCP semaphore",
                                NERR_SEVERE, __FILE__, __LINE__);
@@ -645,7 +645,7 @@ STATUS PPP_Lower_Layer_Up(UINT8 *ip_address4, UINT8 *ip_address6,
     index_save = dev_ptr->dev_index;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                    __FILE__, __LINE__);
@@ -664,7 +664,7 @@ STATUS PPP_Lower_Layer_Up(UINT8 *ip_address4, UINT8 *ip_address6,
     }
 
     /* Grab the semaphore again. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
            __FILE__, __LINE__);
@@ -772,7 +772,7 @@ STATUS NU_Set_PPP_Login(CHAR id[PPP_MAX_ID_LENGTH],
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -786,7 +786,7 @@ STATUS NU_Set_PPP_Login(CHAR id[PPP_MAX_ID_LENGTH],
         status = PPP_Set_Login(id, pw, dev_ptr);
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -888,7 +888,7 @@ STATUS PPP_Hangup(UINT8 mode, CHAR *link_name)
     PrintInfo("PPP_Hangup\n");
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -921,7 +921,7 @@ STATUS PPP_Hangup(UINT8 mode, CHAR *link_name)
         if (link_layer->hwi.state == INITIAL)
         {
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
@@ -993,7 +993,7 @@ STATUS PPP_Hangup(UINT8 mode, CHAR *link_name)
                 index_save = dev_ptr->dev_index;
 
                 /* Release the semaphore. */
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
@@ -1003,7 +1003,7 @@ STATUS PPP_Hangup(UINT8 mode, CHAR *link_name)
                 NU_Sleep(TICKS_PER_SECOND >> 2);
 
                 /* Grab the semaphore again. */
-                if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+                if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1013,7 +1013,7 @@ STATUS PPP_Hangup(UINT8 mode, CHAR *link_name)
                 if(DEV_Get_Dev_By_Index(index_save) == NU_NULL)
                 {
                     /* Release the semaphore. */
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
@@ -1034,7 +1034,7 @@ STATUS PPP_Hangup(UINT8 mode, CHAR *link_name)
         status = NU_INVALID_LINK;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1078,7 +1078,7 @@ STATUS PPP_Still_Connected(CHAR *link_name)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1102,7 +1102,7 @@ STATUS PPP_Still_Connected(CHAR *link_name)
         status = NU_INVALID_LINK;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1663,7 +1663,7 @@ STATUS PPP_Dial(PPP_OPTIONS *ppp_options)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1708,7 +1708,7 @@ STATUS PPP_Dial(PPP_OPTIONS *ppp_options)
         index_save = ppp_dev->dev_index;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -1721,7 +1721,7 @@ STATUS PPP_Dial(PPP_OPTIONS *ppp_options)
         {
 
             /* Link was successfully connected grab the semaphore. */
-            if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+            if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
@@ -1799,7 +1799,7 @@ STATUS PPP_Dial(PPP_OPTIONS *ppp_options)
 #endif
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1851,7 +1851,7 @@ STATUS PPP_Wait_For_Client(PPP_OPTIONS *ppp_options)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1883,7 +1883,7 @@ STATUS PPP_Wait_For_Client(PPP_OPTIONS *ppp_options)
             index_save = dev_ptr->dev_index;
 
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
@@ -1893,7 +1893,7 @@ STATUS PPP_Wait_For_Client(PPP_OPTIONS *ppp_options)
             status = link_layer->hwi.passive(dev_ptr);
 
             /* Grab the semaphore. */
-            if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+            if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
@@ -1946,7 +1946,7 @@ STATUS PPP_Wait_For_Client(PPP_OPTIONS *ppp_options)
         status = NU_INVALID_LINK;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1992,7 +1992,7 @@ STATUS PPP_Abort_Wait_For_Client(CHAR *link_name)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2019,7 +2019,7 @@ STATUS PPP_Abort_Wait_For_Client(CHAR *link_name)
         status = NU_INVALID_LINK;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2067,7 +2067,7 @@ STATUS PPP_Abort(CHAR *link_name)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore",
                        NERR_SEVERE, __FILE__, __LINE__);
@@ -2147,7 +2147,7 @@ STATUS PPP_Abort(CHAR *link_name)
     }
 
     /* Release the semaphore. */
-    if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if(NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore",
                        NERR_SEVERE, __FILE__, __LINE__);
@@ -2202,7 +2202,7 @@ STATUS PPP_Abort_Connection(CHAR *link_name)
     PrintInfo("PPP_Abort_Connection\n");
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore",
                        NERR_SEVERE, __FILE__, __LINE__);
@@ -2296,7 +2296,7 @@ STATUS PPP_Abort_Connection(CHAR *link_name)
     }
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore",
                        NERR_SEVERE, __FILE__, __LINE__);
@@ -2364,7 +2364,7 @@ STATUS PPP_Set_Link_Options(CHAR *link_name, NU_PPP_CFG *ppp_cfg)
     }
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2502,7 +2502,7 @@ STATUS PPP_Set_Link_Options(CHAR *link_name, NU_PPP_CFG *ppp_cfg)
     }
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2559,7 +2559,7 @@ STATUS PPP_Get_Link_Options(CHAR *link_name, NU_PPP_CFG *ppp_cfg)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2675,7 +2675,7 @@ STATUS PPP_Get_Link_Options(CHAR *link_name, NU_PPP_CFG *ppp_cfg)
         status = NU_INVALID_LINK;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3163,7 +3163,7 @@ STATUS PPP_Obtain_Connection_Status(CHAR *link_name)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3182,7 +3182,7 @@ STATUS PPP_Obtain_Connection_Status(CHAR *link_name)
         status = NU_INVALID_LINK;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3237,7 +3237,7 @@ STATUS PPP_Negotiation_Timeout(CHAR *link_name, INT set,
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3267,7 +3267,7 @@ STATUS PPP_Negotiation_Timeout(CHAR *link_name, INT set,
         status = NU_INVALID_LINK;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3312,7 +3312,7 @@ INT32 PPP_Last_Activity_Time(CHAR *link_name)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3348,7 +3348,7 @@ INT32 PPP_Last_Activity_Time(CHAR *link_name)
         return_value = NU_INVALID_LINK;
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -241,7 +241,7 @@ STATUS PPP_DC_Wait(DV_DEVICE_ENTRY *dev_ptr)
     CHAR            dstring[PPP_DC_CMD_MAX_SIZE];
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -283,7 +283,7 @@ STATUS PPP_DC_Wait(DV_DEVICE_ENTRY *dev_ptr)
     MDM_Change_Communication_Mode(MDM_NETWORK_COMMUNICATION, dev_ptr);
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -325,7 +325,7 @@ STATUS PPP_DC_Connect(CHAR *unused, DV_DEVICE_ENTRY *dev_ptr)
     UNUSED_PARAMETER(unused);
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -385,7 +385,7 @@ STATUS PPP_DC_Connect(CHAR *unused, DV_DEVICE_ENTRY *dev_ptr)
     }
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -467,7 +467,7 @@ STATUS PPP_DC_Get_String(CHAR *response, DV_DEVICE_ENTRY *dev_ptr,
             index_save = dev_ptr->dev_index;
 
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
@@ -495,7 +495,7 @@ STATUS PPP_DC_Get_String(CHAR *response, DV_DEVICE_ENTRY *dev_ptr,
             }
 
             /* Grab the semaphore again. */
-            if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+            if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
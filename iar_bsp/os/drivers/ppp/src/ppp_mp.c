@@ -330,7 +330,7 @@ STATUS PPP_MP_Add_Link(DV_DEVICE_ENTRY *ppp_dev, DV_DEVICE_ENTRY *mp_dev)
     if ( (bundle == NU_NULL) && (status == NU_NOT_PRESENT) )
     {
         /* Release the semaphore acquired by the calling function. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -353,7 +353,7 @@ STATUS PPP_MP_Add_Link(DV_DEVICE_ENTRY *ppp_dev, DV_DEVICE_ENTRY *mp_dev)
         }
 
         /* Obtain the semaphore again. */
-        if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+        if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -695,7 +695,7 @@ STATUS PPP_MP_Get_Virt_If_By_Device (UINT32 *mp_ifindex, CHAR *link_name)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -723,7 +723,7 @@ STATUS PPP_MP_Get_Virt_If_By_Device (UINT32 *mp_ifindex, CHAR *link_name)
     }
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -771,7 +771,7 @@ STATUS PPP_MP_Get_Virt_If_By_User (UINT32 *mp_ifindex, CHAR *user_name)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -816,7 +816,7 @@ STATUS PPP_MP_Get_Virt_If_By_User (UINT32 *mp_ifindex, CHAR *user_name)
     }
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -879,7 +879,7 @@ STATUS PPP_MP_Get_Opt(UINT32 mp_ifindex, INT optname, VOID *optval,
     }
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1089,7 +1089,7 @@ STATUS PPP_MP_Get_Opt(UINT32 mp_ifindex, INT optname, VOID *optval,
     }
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1302,7 +1302,7 @@ STATUS PPP_MP_Terminate_Links(UINT32 mp_ifindex)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1325,7 +1325,7 @@ STATUS PPP_MP_Terminate_Links(UINT32 mp_ifindex)
     }
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
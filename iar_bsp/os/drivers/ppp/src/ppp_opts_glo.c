@@ -95,7 +95,7 @@ STATUS PPP_Get_Link_Option(CHAR *link_name, INT optname, VOID *optval,
     if (status == NU_SUCCESS)
     {
         /* Grab the semaphore. */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     }
 
@@ -402,7 +402,7 @@ STATUS PPP_Get_Link_Option(CHAR *link_name, INT optname, VOID *optval,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                 __FILE__, __LINE__);
@@ -93,7 +93,7 @@ STATUS PPP_Set_Link_Option(CHAR *link_name, INT optname, VOID *optval,
     else
     {
         /* Grab the semaphore. */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
         if (status != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to obtain a semaphore", NERR_SEVERE,
@@ -537,7 +537,7 @@ STATUS PPP_Set_Link_Option(CHAR *link_name, INT optname, VOID *optval,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release a semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
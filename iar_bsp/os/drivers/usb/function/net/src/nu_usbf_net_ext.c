@@ -736,9 +736,8 @@ VOID NU_USBF_NET_Rcvd_Cb(UINT8 * data_buffer,
 
             } /* while (bytes_left) */
 
-            /* Put head of the chain onto incoming packet buffer
-               list. */
-            MEM_Buffer_Enqueue(&MEM_Buffer_List, rcvd_buffer);
+            /* Pass head of the chain to the stack. */
+            MEM_Rx_Ring_Put(rcvd_buffer->mem_buf_device, rcvd_buffer);
 
             NU_Set_Events(&Buffers_Available, (UNSIGNED)2, NU_OR);
         }
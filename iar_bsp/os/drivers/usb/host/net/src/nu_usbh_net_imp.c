@@ -330,7 +330,7 @@ VOID NU_USBH_NET_Receive_Handler (
         /* Pointing NET to act on the incomming packet. Only to submit the
          * head of buffer cahin.
          */
-        MEM_Buffer_Enqueue (&MEM_Buffer_List, hdr_buffer);
+        MEM_Rx_Ring_Put(hdr_buffer->mem_buf_device, hdr_buffer);
         NU_Set_Events(&Buffers_Available, (UNSIGNED)2, NU_OR);
     }
 }
@@ -390,5 +390,30 @@ NOTE:  The priority should always be greater than 0 */
 
 #endif  /* ESAL_AR_OS_TIMER_USED == NU_TRUE */
 
+/* Data Watchpoint and Trace (DWT) unit register address defines.  The DWT
+   cycle counter counts processor clock cycles and is used to time short
+   code paths. */
+#define ESAL_AR_DWT_CTRL                        0xE0001000
+#define ESAL_AR_DWT_CYCCNT                      0xE0001004
+#define ESAL_AR_DBG_DEMCR                       0xE000EDFC
+
+/* DWT register bit defines */
+#define ESAL_AR_DWT_CTRL_CYCCNTENA_BIT          ESAL_GE_MEM_32BIT_SET(0)
+#define ESAL_AR_DBG_DEMCR_TRCENA_BIT            ESAL_GE_MEM_32BIT_SET(24)
+
+/* Enable the DWT cycle counter */
+#define ESAL_AR_CYCLE_COUNT_ENABLE()                                            \
+{                                                                               \
+    ESAL_GE_MEM_WRITE32(ESAL_AR_DBG_DEMCR,                                      \
+                        ESAL_GE_MEM_READ32(ESAL_AR_DBG_DEMCR) |                 \
+                        ESAL_AR_DBG_DEMCR_TRCENA_BIT);                          \
+    ESAL_GE_MEM_WRITE32(ESAL_AR_DWT_CTRL,                                       \
+                        ESAL_GE_MEM_READ32(ESAL_AR_DWT_CTRL) |                  \
+                        ESAL_AR_DWT_CTRL_CYCCNTENA_BIT);                        \
+}
+
+/* Read the DWT cycle counter */
+#define ESAL_AR_CYCLE_COUNT_READ()              ESAL_GE_MEM_READ32(ESAL_AR_DWT_CYCCNT)
+
 
 #endif  /* ARM_DEFS_H */
@@ -194,6 +194,7 @@ struct _nu_spi_bus
     DMA_CHAN_HANDLE         chan_tx_handle;
     DMA_DEVICE_HANDLE       dma_rx_handle;
     DMA_CHAN_HANDLE         chan_rx_handle;
+    DV_DEV_FAST_IO          dma_fast_io;
 #endif
 
     UINT8               pad[2];
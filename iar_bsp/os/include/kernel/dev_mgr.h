@@ -178,6 +178,24 @@ typedef struct _dv_dev_listener_struct
 
 } DV_DEV_LISTENER;
 
+/* Fast I/O descriptor bound to an open session by DVC_Dev_Fast_IO_Bind().
+   DVC_Dev_Fast_IO_Read, DVC_Dev_Fast_IO_Write and DVC_Dev_Fast_IO_Ioctl
+   call the driver through the descriptor without decoding and validating
+   the device handle on every call.  A descriptor must be zeroed or bound
+   before it is used.  When the session is closed or the device is
+   unregistered, the driver functions are cleared and calls through the
+   descriptor return DV_SESSION_NOT_OPEN. */
+typedef struct _dv_dev_fast_io_struct
+{
+    VOID                            *session_handle;
+    DV_DRV_READ_FUNCTION             read_ptr;
+    DV_DRV_WRITE_FUNCTION            write_ptr;
+    DV_DRV_IOCTL_FUNCTION            ioctl_ptr;
+    DV_DEV_HANDLE                    dev_handle;
+    struct _dv_dev_fast_io_struct   *next;
+
+} DV_DEV_FAST_IO;
+
 
 /* Core processing functions.  */
 
@@ -215,6 +233,28 @@ STATUS  DVC_Dev_Ioctl (DV_DEV_HANDLE dev_handle,
                        VOID* ioctl_data,
                        INT ioctl_data_len);
 
+STATUS  DVC_Dev_Fast_IO_Bind (DV_DEV_HANDLE dev_handle,
+                              DV_DEV_FAST_IO *fast_io_ptr);
+
+STATUS  DVC_Dev_Fast_IO_Unbind (DV_DEV_FAST_IO *fast_io_ptr);
+
+STATUS  DVC_Dev_Fast_IO_Read (DV_DEV_FAST_IO *fast_io_ptr,
+                              VOID *buffer_ptr,
+                              UINT32 numbyte,
+                              OFFSET_T byte_offset,
+                              UINT32 *bytes_read_ptr);
+
+STATUS  DVC_Dev_Fast_IO_Write (DV_DEV_FAST_IO *fast_io_ptr,
+                               VOID *buffer_ptr,
+                               UINT32 numbyte,
+                               OFFSET_T byte_offset,
+                               UINT32 *bytes_written_ptr);
+
+STATUS  DVC_Dev_Fast_IO_Ioctl (DV_DEV_FAST_IO *fast_io_ptr,
+                               INT ioctl_num,
+                               VOID* ioctl_data,
+                               INT ioctl_data_len);
+
 STATUS DVC_Reg_Change_Notify(DV_DEV_LABEL             dev_label_list[],
                              INT                      dev_label_cnt,
                              DEV_REGISTER_CALLBACK    register_cb,
@@ -37,6 +37,8 @@
 *                                       with data
 *       EQM_EVENT_QUEUE                 Structure to hold the event queue
 *                                       attributes.
+*       EQM_EVENT_BLOCK                 Event types present in a block of
+*                                       the event queue
 *
 *************************************************************************/
 #ifndef EQM_H
@@ -47,6 +49,13 @@
 extern  "C" {                               /* C declarations in C++   */
 #endif /* _cplusplus */
 
+/* Number of bits in an event type. */
+#define     EQM_EVENT_TYPE_BITS     32
+
+/* Number of consecutive event queue entries summarized by one
+   EQM_EVENT_BLOCK.  Must be a power of two. */
+#define     EQM_EVENT_BLOCK_SIZE    8
+
 /* Datatypes */
 typedef     UINT32                  EQM_EVENT_ID;
 typedef     UINT32                  EQM_EVENT_HANDLE;
@@ -71,6 +80,18 @@ typedef struct  EQM_EVENT_NODE_STRUCT
 
 } EQM_EVENT_NODE;
 
+typedef struct  EQM_EVENT_BLOCK_STRUCT
+{
+    /* OR of the types of the events posted to the block in the current
+       pass of the posting index over the queue. */
+    UINT32        eqm_current_types;
+
+    /* OR of the types posted in the previous pass. Entries of the block
+       not yet overwritten in the current pass are covered by it. */
+    UINT32        eqm_previous_types;
+
+} EQM_EVENT_BLOCK;
+
 typedef struct  EQM_EVENT_QUEUE_STRUCT
 {
     /* Maximum number of events stored in event queue */
@@ -95,6 +116,15 @@ typedef struct  EQM_EVENT_QUEUE_STRUCT
        components. */
     NU_EVENT_GROUP      eqm_event_group;
 
+    /* ID of the latest event posted with each bit of the event type set,
+       or '0' if there was none. Lets a waiter tell that no event of its
+       types follows the last one it processed without searching. */
+    EQM_EVENT_ID        eqm_latest_event_id[EQM_EVENT_TYPE_BITS];
+
+    /* Types present in each block of EQM_EVENT_BLOCK_SIZE entries, so the
+       search can skip blocks without an event of the requested types. */
+    EQM_EVENT_BLOCK     *eqm_event_blocks;
+
 } EQM_EVENT_QUEUE;
 
 
@@ -50,6 +50,17 @@ extern          "C" {
 #define         NU_VARIABLE_SIZE                    13
 #define         NU_PRIORITY_INHERIT                 14
 
+/* OR'd with the suspension type passed to NU_Create_Memory_Pool to create
+   a Two-Level Segregated Fit pool (see NU_TLSF_POOLS).  */
+#define         NU_TLSF_POOL                        0x80
+
+/* Define the wake-up types of NU_Create_Ring.  The wake-up object is
+   activated, set or released when the ring becomes non-empty.  */
+#define         NU_RING_WAKE_NONE                   0
+#define         NU_RING_WAKE_HISR                   1
+#define         NU_RING_WAKE_EVENTS                 2
+#define         NU_RING_WAKE_SEMAPHORE              3
+
 /* Define service completion status constants.  */
 #define         NU_SUCCESS                          0
 #define         NU_END_OF_LOG                       -1
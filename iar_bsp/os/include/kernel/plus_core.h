@@ -132,6 +132,68 @@ extern          "C" {
 #define         NU_MIN_RAM_ENABLED                  CFG_NU_OS_KERN_PLUS_CORE_MIN_RAM
 #endif
 
+/* DEFINE:      NU_TLSF_POOLS
+   DEFAULT:     NU_FALSE
+   DESCRIPTION: Dynamic memory pools created with NU_TLSF_POOL OR'd into the
+                suspension type keep their free blocks on Two-Level Segregated
+                Fit lists when this define is set to NU_TRUE, so allocation and
+                deallocation do not walk a free list.  Pools created without
+                NU_TLSF_POOL are searched first-fit.
+   NOTE:        The Nucleus PLUS library and application must be rebuilt after changing
+                this define.            */
+#ifndef         NU_TLSF_POOLS
+#define         NU_TLSF_POOLS                       CFG_NU_OS_KERN_PLUS_CORE_TLSF_POOLS
+#endif
+
+/* DEFINE:      NU_POINTER_QUEUES
+   DEFAULT:     NU_FALSE
+   DESCRIPTION: Pointer queues (see NU_Create_Pointer_Queue) pass a single pointer
+                per message without copying it through a message area when this
+                define is set to NU_TRUE.  Setting this define to NU_FALSE removes
+                the pointer queue services.
+   NOTE:        The Nucleus PLUS library and application must be rebuilt after changing
+                this define.            */
+#ifndef         NU_POINTER_QUEUES
+#define         NU_POINTER_QUEUES                   CFG_NU_OS_KERN_PLUS_CORE_POINTER_QUEUES
+#endif
+
+/* DEFINE:      NU_SPSC_RINGS
+   DEFAULT:     NU_FALSE
+   DESCRIPTION: Single-producer, single-consumer rings (see NU_Create_Ring) move
+                pointers from a LISR to a HISR or task without disabling
+                interrupts when this define is set to NU_TRUE.  Setting this define
+                to NU_FALSE removes the ring services.
+   NOTE:        The Nucleus PLUS library and application must be rebuilt after changing
+                this define.            */
+#ifndef         NU_SPSC_RINGS
+#define         NU_SPSC_RINGS                       CFG_NU_OS_KERN_PLUS_CORE_SPSC_RINGS
+#endif
+
+/* DEFINE:      NU_CEILING_MUTEXES
+   DEFAULT:     NU_FALSE
+   DESCRIPTION: Priority ceiling mutexes (see NU_Create_Mutex) raise their owner to
+                the ceiling priority of the mutex for as long as it is owned, and
+                are obtained and released without the schedule lock when there is
+                no contention, when this define is set to NU_TRUE.  Setting this
+                define to NU_FALSE removes the mutex services.
+   NOTE:        The Nucleus PLUS library and application must be rebuilt after changing
+                this define.            */
+#ifndef         NU_CEILING_MUTEXES
+#define         NU_CEILING_MUTEXES                  CFG_NU_OS_KERN_PLUS_CORE_CEILING_MUTEXES
+#endif
+
+/* DEFINE:      NU_CPU_ACCOUNTING
+   DEFAULT:     NU_FALSE
+   DESCRIPTION: The scheduler and the LISR dispatcher count the processor cycles
+                spent in each task and HISR, in LISRs and idle when this define
+                is set to NU_TRUE (see NU_Thread_CPU_Usage).  Setting this define
+                to NU_FALSE removes the accounting code.
+   NOTE:        The Nucleus PLUS library and application must be rebuilt after changing
+                this define.            */
+#ifndef         NU_CPU_ACCOUNTING
+#define         NU_CPU_ACCOUNTING                   CFG_NU_OS_KERN_PLUS_CORE_CPU_ACCOUNTING
+#endif
+
 #ifndef         NU_TICK_SUPPRESSION
 #define         NU_TICK_SUPPRESSION                 CFG_NU_OS_KERN_PLUS_CORE_TICK_SUPPRESSION
 #endif
@@ -471,6 +533,20 @@ VOID            TMCT_Timer_Interrupt(INT vector);
 /*                  TASK CONTROL Definitions                          */
 /**********************************************************************/
 
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+
+/* Define the CPU usage of a thread since the usage was last reset.  Times
+   are in cycles of the processor cycle counter.  */
+
+typedef struct TC_CPU_USAGE_STRUCT
+{
+    UINT64              tc_cpu_cycles;         /* Cycles spent running   */
+    UNSIGNED            tc_cpu_switches;       /* Times scheduled        */
+    UINT32              tc_cpu_max_slice;      /* Longest single run     */
+} TC_CPU_USAGE;
+
+#endif  /* NU_CPU_ACCOUNTING == NU_TRUE */
+
 /* Define the Task Control Block data type.  */
 typedef struct TC_TCB_STRUCT
 {
@@ -570,6 +646,16 @@ typedef struct TC_TCB_STRUCT
                         
     DATA_ELEMENT        tc_debug_suspend;      /* Debug suspension       */
 
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+    TC_CPU_USAGE        tc_cpu_usage;          /* CPU usage of the task  */
+#endif
+
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+    struct MX_MCB_STRUCT
+                        *tc_mutex_list;        /* Last ceiling mutex     */
+                                               /* obtained by the task   */
+#endif
+
 } TC_TCB;
 
 
@@ -618,6 +704,10 @@ typedef struct TC_HCB_STRUCT
     UNSIGNED            tc_system_reserved_3;  /* System reserved word   */
     UNSIGNED            tc_app_reserved_1;     /* Application reserved   */
 
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+    TC_CPU_USAGE        tc_cpu_usage;          /* CPU usage of the HISR  */
+#endif
+
 } TC_HCB;
 
 
@@ -654,6 +744,11 @@ typedef struct DM_PCB_STRUCT
     UNSIGNED            dm_tasks_waiting;      /* Number of waiting tasks*/
     struct DM_SUSPEND_STRUCT
                        *dm_suspension_list;    /* Suspension list        */
+#if (NU_TLSF_POOLS == NU_TRUE)
+    struct DM_TLSF_STRUCT
+                       *dm_tlsf;               /* TLSF free lists, or    */
+                                               /* NU_NULL for first-fit  */
+#endif
 } DM_PCB;
 
 
@@ -706,6 +801,83 @@ typedef struct QU_QCB_STRUCT
                        *qu_suspension_list;    /* Suspension list        */
 } QU_QCB;
 
+#if (NU_POINTER_QUEUES == NU_TRUE)
+
+/* Define the Pointer Queue Control Block data type.  */
+typedef struct PQ_PQCB_STRUCT
+{
+    UNSIGNED            pq_id;                 /* Internal PQCB ID       */
+    CHAR                pq_name[NU_MAX_NAME];  /* Pointer queue name     */
+    BOOLEAN             pq_fifo_suspend;       /* Suspension type flag   */
+#if     PAD_1
+    DATA_ELEMENT        pq_padding[PAD_1];
+#endif
+    VOID              **pq_start;              /* Start of pointer area  */
+    UNSIGNED            pq_queue_size;         /* Pointers in the area   */
+    UNSIGNED            pq_messages;           /* Pointers in queue      */
+    UNSIGNED            pq_read;               /* Read index             */
+    UNSIGNED            pq_write;              /* Write index            */
+    UNSIGNED            pq_tasks_waiting;      /* Number of waiting tasks*/
+    struct PQ_SUSPEND_STRUCT
+                       *pq_suspension_list;    /* Suspension list        */
+} PQ_PQCB;
+
+#endif  /* NU_POINTER_QUEUES == NU_TRUE */
+
+#if (NU_SPSC_RINGS == NU_TRUE)
+
+/* Define the Ring Control Block data type.  The head index is only
+   written by the consumer and the tail index only by the producer.  Both
+   run freely and are masked to index the ring area.  */
+typedef struct RG_RCB_STRUCT
+{
+    UNSIGNED            rg_id;                 /* Internal RCB ID        */
+    CHAR                rg_name[NU_MAX_NAME];  /* Ring name              */
+    OPTION              rg_wake_type;          /* Wake-up object type    */
+#if     PAD_1
+    DATA_ELEMENT        rg_padding[PAD_1];
+#endif
+    VOID               *rg_wake_object;        /* HISR, event group or   */
+                                               /*   semaphore to wake    */
+    UNSIGNED            rg_wake_events;        /* Events to set on wake  */
+    VOID * volatile    *rg_start;              /* Start of ring area     */
+    UNSIGNED            rg_mask;               /* Ring size - 1          */
+    volatile UNSIGNED   rg_head;               /* Next slot to receive   */
+    volatile UNSIGNED   rg_tail;               /* Next slot to send      */
+    UNSIGNED            rg_peak;               /* Highest fill level     */
+    UNSIGNED            rg_overflows;          /* Sends to a full ring   */
+} RG_RCB;
+
+#endif  /* NU_SPSC_RINGS == NU_TRUE */
+
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+
+/* Define the Mutex Control Block data type.  The owner runs at the
+   ceiling priority.  The mutexes owned by a task are stacked through
+   mx_previous in the order they were obtained.  */
+typedef struct MX_MCB_STRUCT
+{
+    UNSIGNED            mx_id;                 /* Internal MCB ID        */
+    CHAR                mx_name[NU_MAX_NAME];  /* Mutex name             */
+    DATA_ELEMENT        mx_ceiling;            /* Ceiling priority       */
+    DATA_ELEMENT        mx_saved_priority;     /* Owner priority before  */
+                                               /*   the mutex was owned  */
+    BOOLEAN             mx_owner_killed;       /* Flag if owner killed   */
+#if     PAD_3
+    DATA_ELEMENT        mx_padding[PAD_3];
+#endif
+    TC_TCB             *mx_owner;              /* Task that owns the     */
+                                               /*   mutex                */
+    struct MX_MCB_STRUCT
+                       *mx_previous;           /* Mutex owned before     */
+    UNSIGNED            mx_tasks_waiting;      /* Number of waiting      */
+                                               /*   tasks                */
+    struct MX_SUSPEND_STRUCT
+                       *mx_suspension_list;    /* Suspension list        */
+} MX_MCB;
+
+#endif  /* NU_CEILING_MUTEXES == NU_TRUE */
+
 
 /**********************************************************************/
 /*                  SEMAPHORE Definitions                             */
@@ -746,6 +918,15 @@ typedef         DM_PCB                              NU_MEMORY_POOL;
 typedef         TM_APP_TCB                          NU_TIMER;
 typedef         UINT8                               NU_PROTECT;
 typedef         QU_QCB                              NU_QUEUE;
+#if (NU_POINTER_QUEUES == NU_TRUE)
+typedef         PQ_PQCB                             NU_POINTER_QUEUE;
+#endif
+#if (NU_SPSC_RINGS == NU_TRUE)
+typedef         RG_RCB                              NU_RING;
+#endif
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+typedef         MX_MCB                              NU_MUTEX;
+#endif
 typedef         SM_SCB                              NU_SEMAPHORE;
 typedef         EV_GCB                              NU_EVENT_GROUP;
 
@@ -879,6 +1060,52 @@ STATUS          NU_Queue_Information(NU_QUEUE *queue, CHAR *name,
 UNSIGNED        NU_Queue_Pointers(NU_QUEUE **pointer_list,
                                   UNSIGNED maximum_pointers);
 
+#if (NU_POINTER_QUEUES == NU_TRUE)
+
+/* Define Pointer Queue management functions.  */
+STATUS          NU_Create_Pointer_Queue(NU_POINTER_QUEUE *queue, CHAR *name,
+                                        VOID **start_address, UNSIGNED queue_size,
+                                        OPTION suspend_type);
+STATUS          NU_Delete_Pointer_Queue(NU_POINTER_QUEUE *queue);
+STATUS          NU_Send_To_Pointer_Queue(NU_POINTER_QUEUE *queue, VOID *message,
+                                         UNSIGNED suspend);
+STATUS          NU_Receive_From_Pointer_Queue(NU_POINTER_QUEUE *queue, VOID **message,
+                                              UNSIGNED suspend);
+
+#endif  /* NU_POINTER_QUEUES == NU_TRUE */
+
+#if (NU_SPSC_RINGS == NU_TRUE)
+
+/* Define Ring management functions.  */
+STATUS          NU_Create_Ring(NU_RING *ring, CHAR *name,
+                               VOID **start_address, UNSIGNED ring_size,
+                               OPTION wake_type, VOID *wake_object,
+                               UNSIGNED wake_events);
+STATUS          NU_Delete_Ring(NU_RING *ring);
+STATUS          NU_Send_To_Ring(NU_RING *ring, VOID *item);
+STATUS          NU_Receive_From_Ring(NU_RING *ring, VOID **items,
+                                     UNSIGNED maximum_items, UNSIGNED *received);
+STATUS          NU_Ring_Information(NU_RING *ring, CHAR *name,
+                                    UNSIGNED *ring_size, UNSIGNED *count,
+                                    UNSIGNED *peak_count, UNSIGNED *overflows);
+
+#endif  /* NU_SPSC_RINGS == NU_TRUE */
+
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+
+/* Define Mutex management functions.  */
+STATUS          NU_Create_Mutex(NU_MUTEX *mutex, CHAR *name,
+                                OPTION ceiling_priority);
+STATUS          NU_Delete_Mutex(NU_MUTEX *mutex);
+STATUS          NU_Obtain_Mutex(NU_MUTEX *mutex, UNSIGNED suspend);
+STATUS          NU_Release_Mutex(NU_MUTEX *mutex);
+STATUS          NU_Mutex_Information(NU_MUTEX *mutex, CHAR *name,
+                                     OPTION *ceiling_priority,
+                                     NU_TASK **owner,
+                                     UNSIGNED *tasks_waiting);
+
+#endif  /* NU_CEILING_MUTEXES == NU_TRUE */
+
 /* Define Semaphore management functions.  */
 STATUS          NU_Create_Semaphore(NU_SEMAPHORE *semaphore, CHAR *name,
                                     UNSIGNED initial_count, OPTION suspend_type);
@@ -984,6 +1211,14 @@ UNSIGNED        NU_Timer_Pointers(NU_TIMER **pointer_list,
 
 UINT64          NU_Get_Time_Stamp(VOID);
 
+/* CPU usage functions.  */
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+STATUS          NU_Thread_CPU_Usage(VOID *thread, UINT64 *cycles,
+                                    UNSIGNED *switches, UINT32 *max_slice);
+VOID            NU_CPU_Usage_System(UINT64 *idle_cycles, UINT64 *lisr_cycles);
+VOID            NU_CPU_Usage_Reset(VOID);
+#endif
+
 /* Determine if pointers / 32-bit values are accessible with a single instruction.
    If so, just reference the pointer / 32-bit value directly.  Otherwise, call
    the target dependent service.  */
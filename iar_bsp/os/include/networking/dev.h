@@ -276,6 +276,9 @@ struct  _DV_DEVICE_ENTRY {
     NET_BUFFER_HEADER       dev_transq;
     UINT32                  dev_transq_length;
 
+    /* Receive ring, if the driver uses one. */
+    MEM_RX_RING             *dev_rx_ring;
+
 #if (INCLUDE_IPV4 == NU_TRUE)
     DEV_IF_ADDRESS          dev_addr;           /* IPV4 Address information */
 
@@ -251,6 +251,9 @@ typedef struct _dev6_ip6_struct
 
     IP6_NEIGHBOR_CACHE_ENTRY *dev6_ip6_neighbor_cache;
 
+    /* Index + 1 of the first Neighbor Cache entry in each hash bucket */
+    UINT16                   dev6_ip6_nc_hash[NC_HASH_SIZE];
+
     INT     (*dev6_ip6_neighcache_entry_equal) (const UINT8 *, const IP6_NEIGHBOR_CACHE_ENTRY *);
     VOID    (*dev6_ip6_update_neighcache_link_addr) (const IP6_NEIGHBOR_CACHE_ENTRY *, const UINT8 *);
 
@@ -311,6 +314,7 @@ typedef struct _dev6_ip6_struct
 #endif
 
 #define dev6_neighbor_cache             dev6_ipv6_data->dev6_ip6_neighbor_cache
+#define dev6_nc_hash                    dev6_ipv6_data->dev6_ip6_nc_hash
 
 #define dev6_neighcache_entry_equal         dev6_ipv6_data->dev6_ip6_neighcache_entry_equal
 #define dev6_update_neighcache_link_addr    dev6_ipv6_data->dev6_ip6_update_neighcache_link_addr
@@ -46,6 +46,7 @@
 #include "networking/tcpdefs.h"
 #include "networking/target.h"
 #include "networking/mem_defs.h"
+#include "networking/net_lat.h"
 #include "networking/bootp.h"
 #include "networking/dns.h"
 #include "networking/dns_sd.h"
@@ -75,6 +76,7 @@ VOID    statcheck (VOID);
 STATUS  ETH_Add_Multi(DV_DEVICE_ENTRY *dev, const DV_REQ *d_req);
 STATUS  ETH_Del_Multi(const DV_DEVICE_ENTRY *dev, const DV_REQ *d_req);
 extern  NET_BUFFER_HEADER MEM_Buffer_List;
+extern  NET_BUFFER_HEADER MEM_Rx_Driver_List;
 extern  NET_BUFFER_HEADER MEM_Buffer_Freelist;
 extern  UINT8 IP_Time_To_Live;
 
@@ -204,6 +206,29 @@ INT32   MEM_Copy_Data(NET_BUFFER *buf_ptr, const CHAR HUGE *buffer,
 INT32   MEM_Copy_Buffer(CHAR HUGE *buffer,
                        const struct sock_struct *sockptr, INT32 numbytes);
 VOID    MEM_Multiple_Buffer_Chain_Free(NET_BUFFER *source);
+INT     MEM_Buffer_Dequeue_Batch(NET_BUFFER **bufs, INT count);
+
+/***/
+
+/***** MEM_RXR.C *****/
+
+STATUS      MEM_Rx_Ring_Create(DV_DEVICE_ENTRY *device);
+VOID        MEM_Rx_Ring_Delete(DV_DEVICE_ENTRY *device);
+STATUS      MEM_Rx_Ring_Put(DV_DEVICE_ENTRY *device, NET_BUFFER *buf_ptr);
+INT         MEM_Rx_Ring_Service(INT budget);
+NET_BUFFER  *MEM_Rx_Buffer_Alloc(DV_DEVICE_ENTRY *device);
+
+/***/
+
+/***** NET_LAT.C *****/
+
+#if (INCLUDE_NET_LATENCY_TRACE == NU_TRUE)
+VOID    NET_Lat_Init(VOID);
+VOID    NET_Lat_Stamp(NET_BUFFER *buf_ptr, UINT8 stage, UINT8 next_stage);
+STATUS  NET_Lat_Get_Stage(INT stage, NET_LAT_STAGE *stage_ptr);
+VOID    NET_Lat_Reset(VOID);
+VOID    NET_Lat_Trace(VOID);
+#endif
 
 /***/
 
@@ -238,17 +263,24 @@ STATUS  NU_Connect (INT, struct addr_struct *, INT16);
 STATUS  NU_Listen (INT, UINT16);
 STATUS  NU_Accept (INT, struct addr_struct *, INT16 *);
 INT32   NU_Send (INT, CHAR *, UINT16, INT16);
+#ifdef CFG_NU_OS_STOR_FILE_VFS_ENABLE
+INT32   NU_Send_File(INT socketd, INT fd, UINT32 offset, UINT32 count);
+#endif
 INT32   NU_Send_To (INT, CHAR *, UINT16, INT16, const struct addr_struct *,
                     INT16);
 INT32   NU_Send_To_Raw(INT socketd, CHAR *buff, UINT16 nbytes, INT16 flags,
                        const struct addr_struct *to, INT16 addrlen);
 INT32   NU_Sendmsg(INT socketd, const msghdr *msg, INT16 flags);
+INT32   NU_Send_To_Multiple(INT socketd, NU_MMSG *msgs, UINT16 count,
+                            INT16 flags);
 INT32   NU_Recv (INT, CHAR *, UINT16, INT16);
 INT32   NU_Recv_From (INT, CHAR *, UINT16, INT16, struct addr_struct *,
                       INT16 *);
 INT32   NU_Recv_From_Raw (INT, CHAR *, UINT16, INT16,
                           struct addr_struct *, INT16 *);
 INT32   NU_Recvmsg(INT, msghdr *, INT16);
+INT32   NU_Recv_From_Multiple(INT socketd, NU_MMSG *msgs, UINT16 count,
+                              INT16 flags);
 STATUS  NU_Push (INT);
 STATUS  NU_Is_Connected (INT);
 INT16   UDP_Get_Pnum (const struct sock_struct *);
@@ -281,6 +313,11 @@ STATUS  NU_Add_Route(const UINT8 *dest, const UINT8* mask,
 STATUS  NU_Delete_Route2(const UINT8 *ip_dest, const UINT8 *next_hop, INT16 family);
 VOID    SCK_Kill_All_Open_Sockets(const DV_DEVICE_ENTRY *dev_ptr);
 VOID    SCK_Resume_All (struct SCK_TASK_ENT *, INT);
+VOID    SCK_Notify_Events(INT socketd, UINT16 events);
+VOID    SCK_Resume_Receiver(INT socketd);
+VOID    SCK_Start_Wake_Batch(VOID);
+VOID    SCK_Flush_Wake_Batch(VOID);
+VOID    SCK_Cancel_Wake(INT socketd);
 INT     SCK_Get_Host_Name (CHAR *name, INT name_length);
 INT     NU_Find_Socket (INT protocol, const struct addr_struct *local_addr,
                         const struct addr_struct *foreign_addr);
@@ -319,6 +356,25 @@ INT     NU_FD_Check(INT, const FD_SET *);
 VOID    NU_FD_Set(INT, FD_SET *);
 VOID    NU_FD_Init(FD_SET *fd);
 VOID    NU_FD_Reset(INT, FD_SET *);
+INT     NU_Event_Set_Create(VOID);
+STATUS  NU_Event_Set_Delete(INT setd);
+STATUS  NU_Event_Set_Control(INT setd, INT op, INT socketd, UINT16 events,
+                             VOID *data);
+INT     NU_Event_Set_Wait(INT setd, NU_EVS_EVENT *events, INT max_events,
+                          UNSIGNED timeout);
+VOID    EVS_Notify(struct sock_struct *sockptr, UINT16 events);
+VOID    EVS_Remove_Socket(struct sock_struct *sockptr);
+
+/***/
+
+/***** SCK_RXS.C *****/
+
+STATUS  NU_Recv_Ring_Register(INT socketd);
+STATUS  NU_Recv_Ring_Unregister(INT socketd);
+VOID    SCK_Rx_Ring_Delete(struct sock_struct *sockptr);
+VOID    SCK_Rx_Ring_Put(SCK_RX_RING *ring_ptr, NET_BUFFER *buf_ptr);
+INT32   SCK_Rx_Ring_Recv(INT socketd, SCK_RX_RING *ring_ptr,
+                         NET_BUFFER **buff);
 
 /***/
 
@@ -103,17 +103,32 @@ typedef struct IP_FRAG_STRUCT {
 typedef struct _IP_QUEUE_ELEMENT {
     struct _IP_QUEUE_ELEMENT    *ipq_next;
     struct _IP_QUEUE_ELEMENT    *ipq_prev;
+    struct _IP_QUEUE_ELEMENT    *ipq_hash_next; /* Next element in the
+                                                 * same hash bucket. */
     IP_FRAG                     *ipq_first_frag;
+    IP_FRAG                     *ipq_last_frag;
     UINT32                      ipq_source;
     UINT32                      ipq_dest;
+    UINT32                      ipq_recvd;      /* Bytes of data held. */
+    UINT32                      ipq_total_len;  /* Length of the datagram,
+                                                 * 0 until the last
+                                                 * fragment is received. */
     UINT16                      ipq_id;
+    UINT16                      ipq_buffers;    /* NET buffers held. */
     UINT8                       ipq_protocol;
-    UINT8                       ipq_pad;  /* The pad is added to make this
-                                           * structure an even number of
-                                           * long words.
-                                           */
+    UINT8                       ipq_pad[3];  /* The pad is added to make this
+                                              * structure an even number of
+                                              * long words.
+                                              */
 } IP_QUEUE_ELEMENT;
 
+/* Selects the hash bucket of the reassembly queue of a datagram from
+ * the fields that identify its fragments.
+ */
+#define IP_REASM_HASH(src, dest, id, proto)                             \
+    ((UINT16)(((src) ^ ((src) >> 16) ^ (dest) ^ ((dest) >> 16) ^        \
+               (UINT32)(id) ^ (UINT32)(proto)) & (IP_REASM_HASH_SIZE - 1)))
+
 typedef struct _IP_QUEUE
 {
      IP_QUEUE_ELEMENT       *ipq_head;
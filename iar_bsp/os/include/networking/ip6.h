@@ -208,13 +208,29 @@ typedef struct _IP6_QUEUE_ELEMENT
 {
     struct _IP6_QUEUE_ELEMENT   *ipq_next;      
     struct _IP6_QUEUE_ELEMENT   *ipq_prev;      
+    struct _IP6_QUEUE_ELEMENT   *ipq_hash_next; /* Next element in the
+                                                 * same hash bucket. */
     IP6_REASM    HUGE           *ipq_first_frag;    
+    IP6_REASM    HUGE           *ipq_last_frag;
     UINT8                       ipq_source[IP6_ADDR_LEN];
     UINT8                       ipq_dest[IP6_ADDR_LEN];
     UINT32                      ipq_id;
+    UINT32                      ipq_recvd;      /* Bytes of data held. */
+    UINT32                      ipq_total_len;  /* Length of the packet,
+                                                 * 0 until the last
+                                                 * fragment is received. */
+    UINT16                      ipq_buffers;    /* NET buffers held. */
+    UINT8                       ipq_pad[2];
     
 } IP6_QUEUE_ELEMENT;
 
+/* Selects the hash bucket of the reassembly queue of a packet from the
+ * fields that identify its fragments.
+ */
+#define IP6_REASM_HASH(src, dest, id)                                   \
+    ((UINT16)((GET32((src), 12) ^ GET32((dest), 12) ^ (id) ^            \
+               ((id) >> 16)) & (IP_REASM_HASH_SIZE - 1)))
+
 typedef struct _IP6_QUEUE
 {
      IP6_QUEUE_ELEMENT  *ipq_head;
@@ -111,6 +111,16 @@ struct _me_bufhdr
     /* The TCP or UDP port that is being used for this packet. */
     VOID                        *higher_port;
 
+#endif
+
+#if (INCLUDE_NET_LATENCY_TRACE == NU_TRUE)
+
+    /* The cycle count when the packet entered its current stage of the
+       packet path, and that stage (see net_lat.h). */
+    UINT32                      lat_stamp;
+    UINT8                       lat_stage;
+    UINT8                       padL[3];
+
 #endif
 };
 
@@ -172,6 +182,11 @@ struct packet_queue_element
 #define mem_port                me_data.me_pkthdr.me_buf_hdr.higher_port
 #endif
 
+#if (INCLUDE_NET_LATENCY_TRACE == NU_TRUE)
+#define mem_lat_stamp           me_data.me_pkthdr.me_buf_hdr.lat_stamp
+#define mem_lat_stage           me_data.me_pkthdr.me_buf_hdr.lat_stage
+#endif
+
 #define NU_NET_BUFFER_POOL_SIZE     ((UINT32)(MAX_BUFFERS * (sizeof(NET_BUFFER) + \
                                     (REQ_ALIGNMENT - sizeof(UNSIGNED)) + DM_OVERHEAD) + \
                                     (2 * DM_OVERHEAD)))
@@ -198,6 +213,25 @@ struct queue_element
 };
 typedef struct queue_element NET_QUEUE_ELEMENT;
 
+/* Define the receive ring of a device.  The driver is the only producer
+   and NET_Demux the only consumer, so neither side locks out interrupts;
+   each index is only written by its own side.  The buffer cache is only
+   accessed by the driver. */
+typedef struct _mem_rx_ring
+{
+    NET_BUFFER * volatile   mrr_slots[NET_RX_RING_SIZE];
+    volatile UINT32         mrr_head;       /* Next slot read by NET_Demux. */
+    volatile UINT32         mrr_tail;       /* Next slot written by the driver. */
+    UINT32                  mrr_drops;      /* Packets dropped on a full ring. */
+    NET_BUFFER              *mrr_cache[NET_RX_BUFFER_CACHE_BATCH];
+    INT                     mrr_cache_count;
+} MEM_RX_RING;
+
+#define MEM_RX_RING_MASK            (NET_RX_RING_SIZE - 1)
+
+/* The number of buffers held in the receive buffer cache of a ring. */
+#define MEM_RX_RING_CACHED(ring)    ((ring) ? (ring)->mrr_cache_count : 0)
+
 /* Define the buffer suspension list structure. This list will
    hold tasks that are waiting to transmit because of lack of
    memory buffers. */
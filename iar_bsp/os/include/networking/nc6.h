@@ -57,6 +57,16 @@ extern  "C" {                               /* C declarations in C++     */
 #define NC_UP                   0x1    /* Is this entry valid. */
 #define NC_PERMANENT            0x2    /* Is this entry permanent. */
 #define NC_ISROUTER             0x4
+#define NC_HASHED               0x8    /* Entry is in a hash bucket. */
+
+#if (NC_HASH_SIZE & (NC_HASH_SIZE - 1))
+#error NC_HASH_SIZE must be a power of two
+#endif
+
+/* Fold the interface identifier of an address into a hash bucket */
+#define NC6_HASH_INDEX(addr)                                            \
+    (((addr)[15] ^ (addr)[14] ^ (addr)[13] ^ (addr)[12] ^ (addr)[11]) & \
+     (NC_HASH_SIZE - 1))
 
 /* Implement the Neighbor Cache as an array on a per-interface basis */
 struct _ip6_neighbor_cache_entry
@@ -66,6 +76,10 @@ struct _ip6_neighbor_cache_entry
     UINT8                       ip6_neigh_cache_unans_probes;
     UINT8                       ip6_neigh_cache_qpkts_count;
     UINT8                       ip6_neigh_cache_rsend_count;
+    UINT16                      ip6_neigh_cache_hash_next;  /* Index + 1 of the
+                                                             * next entry in the
+                                                             * hash bucket. */
+    UINT8                       ip6_neigh_cache_pad[2];
     UINT32                      ip6_neigh_cache_nud_time;
     UINT32                      ip6_neigh_cache_timestamp;
     UINT32                      ip6_neigh_cache_resolve_id;
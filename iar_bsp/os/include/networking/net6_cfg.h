@@ -455,6 +455,23 @@ extern  "C" {                               /* C declarations in C++     */
 /* The number of ethernet Neighbor Cache entries */
 #define IP6_ETH_NEIGHBOR_CACHE_ENTRIES  10
 
+/* The number of hash buckets used to look up the Neighbor Cache entries
+ * of a device by IP address.  This must be a power of two.
+ */
+#define NC_HASH_SIZE                    8
+
+
+/************************** Routing *************************************
+ *
+ */
+
+/* The number of entries in the IPv6 route lookup cache.  Each entry holds
+ * the result of the last lookup for a destination and is discarded when
+ * the routing table changes.  This must be a power of two; set it to 0
+ * to disable the cache.
+ */
+#define RTAB6_ROUTE_CACHE_SIZE          8
+
 
 /************************** RIPng ***************************************
  *
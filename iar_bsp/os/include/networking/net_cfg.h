@@ -331,6 +331,12 @@ extern  "C" {                               /* C declarations in C++     */
 /* Include the NAT module in the library */
 #define INCLUDE_NAT                     NU_FALSE
 
+/* Timestamp packets with the processor cycle counter as they pass through
+ * the stack, and keep a latency histogram for each stage of the packet
+ * path (see NET_Lat_Get_Stage).
+ */
+#define INCLUDE_NET_LATENCY_TRACE       NU_FALSE
+
 #else
 
 #define INCLUDE_UDP                     CFG_NU_OS_NET_STACK_INCLUDE_UDP
@@ -366,6 +372,7 @@ extern  "C" {                               /* C declarations in C++     */
 #define INCLUDE_TCP_OOO                 CFG_NU_OS_NET_STACK_INCLUDE_TCP_OOO
 #define INCLUDE_SO_REUSEADDR            CFG_NU_OS_NET_STACK_INCLUDE_SO_REUSEADDR
 #define INCLUDE_MDNS                    CFG_NU_OS_NET_STACK_INCLUDE_MDNS
+#define INCLUDE_NET_LATENCY_TRACE       CFG_NU_OS_NET_STACK_INCLUDE_NET_LATENCY_TRACE
 
 #ifdef CFG_NU_OS_NET_IPV6_ENABLE
 #define INCLUDE_IPV6                    NU_TRUE
@@ -661,6 +668,57 @@ extern  "C" {                               /* C declarations in C++     */
 #endif
 
 #define NET_FREE_BUFFER_THRESHOLD   10
+
+/* The number of received packets that can be held on the receive ring of
+ * a device driver that uses one (see MEM_Rx_Ring_Create).  This value must
+ * be a power of two.
+ */
+#define NET_RX_RING_SIZE            32
+
+/* The number of buffers moved from the buffer freelist to the receive
+ * buffer cache of a device driver at a time.
+ */
+#define NET_RX_BUFFER_CACHE_BATCH   4
+
+#if ((NET_RX_RING_SIZE & (NET_RX_RING_SIZE - 1)) != 0)
+#error NET_RX_RING_SIZE must be a power of two
+#endif
+
+/* The maximum number of packets NET_Demux takes from the receive ring of
+ * one device, or from MEM_Rx_Driver_List for the drivers without a
+ * receive ring, before moving on to the next one.
+ */
+#define NET_DEMUX_DEVICE_BUDGET     8
+
+/* The number of sockets whose receive wake-ups NET_Demux can defer until
+ * it has finished processing a batch of packets.  Consecutive packets for
+ * the same socket then resume the receiving task once.  0 disables the
+ * deferral.
+ */
+#define NET_DEMUX_WAKE_BATCH_SIZE   8
+
+/* The maximum number of event sets that can exist at one time
+ * (see NU_Event_Set_Create).
+ */
+#define NET_MAX_EVENT_SETS          4
+
+/* The number of datagrams the receive ring of a connected zero copy UDP
+ * socket can hold (see NU_Recv_Ring_Register).  Datagrams that arrive
+ * while the ring is full are dropped.  The value must be a power of two.
+ */
+#define SCK_RX_RING_SIZE            16
+
+#if (SCK_RX_RING_SIZE & (SCK_RX_RING_SIZE - 1))
+#error SCK_RX_RING_SIZE must be a power of two
+#endif
+
+/* The maximum number of bytes of a file that NU_Send_File reads into NET
+ * buffers before passing them to TCP.  The buffers are held until the
+ * data is passed, so this bounds the buffers one call takes at a time.
+ * The value must not exceed 65535.
+ */
+#define NET_SEND_FILE_CHUNK_SIZE    4096
+
 /* This is the minimum size that a NET buffer may be.  This minimum
  * value is to insure that the IP and transport layer headers will
  * fit into a single buffer.
@@ -773,6 +831,22 @@ extern  "C" {                               /* C declarations in C++     */
 /* Initial setting for TCP congestion slow start threshold */
 #define TCP_SLOW_START_THRESHOLD    65535UL
 
+/* The congestion control module used by new TCP ports: TCP_CC_NEWRENO
+ * (RFC 2581/RFC 3782, the behavior of previous releases), TCP_CC_CUBIC
+ * or TCP_CC_BBR_LITE.  Individual sockets can select a different module
+ * with the TCP_CONGESTION_CTRL socket option.  Default : TCP_CC_NEWRENO.
+ */
+#define TCP_CC_DEFAULT              TCP_CC_NEWRENO
+
+/* The maximum number of disjoint ranges of data held on the out of
+ * order list of a connection.  Out of order segments that overlap or
+ * abut are coalesced into one range as they arrive, so this bounds the
+ * number of holes in the receive window, not the number of segments.
+ * A segment that would open a new range when all are in use is
+ * discarded and left for the peer to retransmit.  Default : 8.
+ */
+#define TCP_MAX_OOO_RANGES          8
+
 /* The number of full-sized segments to delay before transmitting
  * an ACK for the data.  RFC 1122 - section 4.2.3.2 - A TCP SHOULD
  * implement a delayed ACK, but an ACK should not be excessively
@@ -872,6 +946,17 @@ extern  "C" {                               /* C declarations in C++     */
 #define ARP_CACHE_LENGTH    CFG_NU_OS_NET_STACK_ARP_CACHE_LENGTH
 #endif
 
+/************************** Routing *****************************************
+ *
+ */
+
+/* The number of entries in the IPv4 route lookup cache.  Each entry holds
+ * the result of the last lookup for a destination and is discarded when
+ * the routing table changes.  This must be a power of two; set it to 0
+ * to disable the cache.
+ */
+#define RTAB4_ROUTE_CACHE_SIZE      8
+
 /************************** Logging *****************************************
  *
  */
@@ -1121,6 +1206,20 @@ extern  "C" {                               /* C declarations in C++     */
 /* RFC 1122 recommends a default TTL for fragments of 60 to 120 seconds. */
 #define IP_FRAG_TTL                     ((UINT32)(SCK_Ticks_Per_Second * 60))
 
+/* The number of buckets in the hash tables used to find the reassembly
+ * queue of an incoming IPv4 or IPv6 fragment.  Must be a power of 2.
+ */
+#define IP_REASM_HASH_SIZE              16
+
+/* The maximum number of NET buffers that may be held at once by the
+ * fragments of incomplete IPv4 and IPv6 datagrams.  When a fragment
+ * would exceed this, the oldest incomplete datagrams of the same
+ * family are discarded to make room, and if that is not enough the
+ * fragment is dropped.  This keeps a flood of fragments from consuming
+ * the buffers needed by other traffic.
+ */
+#define IP_REASM_MAX_BUFFERS            (MAX_BUFFERS / 2)
+
 
 
 /************************** RIP-II ***************************************
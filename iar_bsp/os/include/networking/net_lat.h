@@ -0,0 +1,98 @@
+/*************************************************************************
+*
+*              Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+
+/***************************************************************************
+*
+*   FILENAME
+*
+*       net_lat.h
+*
+*   DESCRIPTION
+*
+*       This include file defines the stages of the packet path that are
+*       timed when INCLUDE_NET_LATENCY_TRACE is enabled, and the macros
+*       that timestamp a packet as it moves from one stage to the next.
+*
+*   DATA STRUCTURES
+*
+*       NET_LAT_STAGE
+*
+*   DEPENDENCIES
+*
+*       None
+*
+***************************************************************************/
+
+#ifndef NET_LAT_H
+#define NET_LAT_H
+
+#ifdef          __cplusplus
+extern  "C" {                               /* C declarations in C++     */
+#endif /* _cplusplus */
+
+/* The stages of the packet path.  A packet is timed from the point it
+   enters a stage until the point it enters the next one. */
+#define NET_LAT_RX_QUEUE    0   /* Driver receive until NET_Demux. */
+#define NET_LAT_DEMUX       1   /* NET_Demux until socket enqueue. */
+#define NET_LAT_SOCKET      2   /* Socket enqueue until application dequeue. */
+#define NET_LAT_TX_QUEUE    3   /* dev_transq enqueue until driver transmit. */
+#define NET_LAT_STAGES      4
+#define NET_LAT_NONE        0xFF
+
+/* A latency is counted in the bucket of its most significant bit, so the
+   histogram of a stage covers the full range of the cycle counter. */
+#define NET_LAT_BUCKETS     32
+
+/* The latency statistics of one stage. */
+typedef struct _net_lat_stage
+{
+    UINT64  nls_total;                      /* Sum of all latencies. */
+    UINT32  nls_count;                      /* Number of packets timed. */
+    UINT32  nls_min;
+    UINT32  nls_max;
+    UINT32  nls_buckets[NET_LAT_BUCKETS];
+} NET_LAT_STAGE;
+
+#if (INCLUDE_NET_LATENCY_TRACE == NU_TRUE)
+
+/* Packets are timed with the processor cycle counter where the
+   architecture provides one. */
+#ifdef ESAL_AR_CYCLE_COUNT_READ
+#define NET_LAT_TIMESTAMP()             ESAL_AR_CYCLE_COUNT_READ()
+#else
+#define NET_LAT_TIMESTAMP()             ((UINT32)NU_Get_Time_Stamp())
+#endif
+
+/* Mark a packet as entering a stage. */
+#define NET_LAT_START(buf_ptr, stage)                       \
+{                                                           \
+    (buf_ptr)->mem_lat_stamp = NET_LAT_TIMESTAMP();         \
+    (buf_ptr)->mem_lat_stage = (stage);                     \
+}
+
+/* Record the time a packet spent in a stage, and mark it as entering
+   the next one.  Nothing is recorded for a packet that was not marked as
+   entering the stage. */
+#define NET_LAT_STAMP(buf_ptr, stage, next_stage)           \
+    NET_Lat_Stamp((buf_ptr), (stage), (next_stage))
+
+#else
+
+#define NET_LAT_START(buf_ptr, stage)
+#define NET_LAT_STAMP(buf_ptr, stage, next_stage)
+
+#endif /* INCLUDE_NET_LATENCY_TRACE == NU_TRUE */
+
+#ifdef          __cplusplus
+}
+#endif /* _cplusplus */
+
+#endif /* NET_LAT_H */
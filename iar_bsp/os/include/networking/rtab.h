@@ -234,6 +234,13 @@ typedef struct rtab_route_parms RTAB_ROUTE_PARMS;
 #define RT_HOST_MATCH           0x8     /* Return only a host route match */
 #define RT_BEST_METRIC          0x10    /* Return the route with the best metric */
 
+/* Incremented on every change to a routing table so that any cached
+ * lookup results can be discarded.
+ */
+extern UINT32   RTAB_Route_Generation;
+
+#define RTAB_Invalidate_Route_Cache()   (RTAB_Route_Generation ++)
+
 /* The function prototypes known to the outside world. */
 STATUS      RTAB_Delete_Node(ROUTE_NODE *, const RTAB_ROUTE_PARMS *);
 ROUTE_ENTRY *RTAB_Find_Route_Entry(const UINT8 *, const RTAB_ROUTE_PARMS *, INT32);
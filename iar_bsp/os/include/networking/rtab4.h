@@ -52,6 +52,27 @@ struct rtab4_route_entry
     SCK_SOCKADDR_IP             rt_gateway_v4;  /* gateway for route, if any */
 };
 
+#if (RTAB4_ROUTE_CACHE_SIZE > 0)
+
+#if (RTAB4_ROUTE_CACHE_SIZE & (RTAB4_ROUTE_CACHE_SIZE - 1))
+#error RTAB4_ROUTE_CACHE_SIZE must be a power of two
+#endif
+
+typedef struct rtab4_route_cache_entry
+{
+    UINT32                      rc_dest;        /* destination looked up */
+    INT32                       rc_flags;       /* flags used for the lookup */
+    UINT32                      rc_generation;  /* RTAB_Route_Generation when cached */
+    struct rtab4_route_entry    *rc_route;      /* result of the lookup */
+} RTAB4_ROUTE_CACHE_ENTRY;
+
+/* Fold all four octets of the destination into the cache index */
+#define RTAB4_ROUTE_CACHE_INDEX(dest)                               \
+    ((((dest) >> 24) ^ ((dest) >> 16) ^ ((dest) >> 8) ^ (dest)) &  \
+     (RTAB4_ROUTE_CACHE_SIZE - 1))
+
+#endif
+
 RTAB4_ROUTE_ENTRY   *RTAB4_Find_Route(const SCK_SOCKADDR_IP *, INT32);
 STATUS              RTAB4_Add_Route(DV_DEVICE_ENTRY *, UINT32, UINT32,
                                     UINT32, UINT32);
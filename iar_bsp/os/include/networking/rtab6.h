@@ -56,6 +56,27 @@ struct rtab6_route_entry
 
 typedef struct rtab6_route_entry    RTAB6_ROUTE_ENTRY;
 
+#if (RTAB6_ROUTE_CACHE_SIZE > 0)
+
+#if (RTAB6_ROUTE_CACHE_SIZE & (RTAB6_ROUTE_CACHE_SIZE - 1))
+#error RTAB6_ROUTE_CACHE_SIZE must be a power of two
+#endif
+
+typedef struct rtab6_route_cache_entry
+{
+    UINT8                       rc_dest[16];    /* destination looked up */
+    INT32                       rc_flags;       /* flags used for the lookup */
+    UINT32                      rc_generation;  /* RTAB_Route_Generation when cached */
+    struct rtab6_route_entry    *rc_route;      /* result of the lookup */
+} RTAB6_ROUTE_CACHE_ENTRY;
+
+/* Fold the low-order octets of the destination into the cache index */
+#define RTAB6_ROUTE_CACHE_INDEX(dest)                               \
+    (((dest)[15] ^ (dest)[14] ^ (dest)[13] ^ (dest)[12] ^ (dest)[7]) & \
+     (RTAB6_ROUTE_CACHE_SIZE - 1))
+
+#endif
+
 struct _ip6_dest_list_entry
 {
     IP6_DEST_LIST_ENTRY         *ip6_dest_list_entry_next;
@@ -100,6 +121,7 @@ STATUS                  RTAB6_Delete_Route(const UINT8 *, const UINT8 *);
 STATUS                  RTAB6_Delete_Node(ROUTE_NODE *);
 VOID                    RTAB6_Unlink_Next_Hop(const RTAB6_ROUTE_ENTRY *);
 RTAB6_ROUTE_ENTRY       *RTAB6_Find_Route(const UINT8 *, INT32);
+RTAB6_ROUTE_ENTRY       *RTAB6_Find_Route_Entry(const UINT8 *, INT32);
 ROUTE_ENTRY             *RTAB6_Find_Next_Route_Entry(ROUTE_ENTRY *current_route);
 STATUS                  RTAB6_Delete_Route_From_Node(ROUTE_NODE *, const UINT8 *);
 UINT8                   RTAB6_Determine_Matching_Prefix(const UINT8 *, const UINT8 *, 
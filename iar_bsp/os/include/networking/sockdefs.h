@@ -87,6 +87,18 @@ extern  "C" {                               /* C declarations in C++     */
 #define SEL_WRITABLE_IDX    1
 #define SEL_MAX_FDSET       2
 
+/* Event set events.  NU_EVS_EDGE may be added to the events of a socket
+   to report it once each time it becomes ready instead of for as long as
+   it is ready. */
+#define NU_EVS_READABLE     0x0001
+#define NU_EVS_WRITABLE     0x0002
+#define NU_EVS_EDGE         0x8000
+
+/* Event set control operations */
+#define NU_EVS_ADD          1
+#define NU_EVS_MODIFY       2
+#define NU_EVS_DELETE       3
+
 /* Socket multitask flags */
 #define SCK_RES_BUFF        2
 
@@ -110,6 +110,15 @@ struct SCK_TASK_ENT
     NET_BUFFER_SUSPENSION_ELEMENT   *buff_elmt;
 };
 
+/* An event set notification and receive wake-ups deferred by NET_Demux
+   until the end of a batch of packets. */
+typedef struct _sck_wake_entry
+{
+    INT             swe_socketd;
+    UINT16          swe_count;      /* Number of packets appended. */
+    UINT16          swe_events;     /* Events to report to the event set. */
+} SCK_WAKE_ENTRY;
+
 struct _tx_ancillary_data
 {
     UINT16              tx_buff_length;
@@ -126,6 +135,76 @@ struct _tx_ancillary_data
     UINT8               *tx_buff;                   /* Pointer to the data */
 };
 
+/* A ready socket returned by NU_Event_Set_Wait. */
+typedef struct _nu_evs_event
+{
+    INT             evs_socketd;
+    VOID            *evs_data;      /* Data given when the socket was added. */
+    UINT16          evs_events;     /* NU_EVS_READABLE and/or NU_EVS_WRITABLE */
+    UINT8           padN[2];
+} NU_EVS_EVENT;
+
+/* One datagram of a NU_Send_To_Multiple or NU_Recv_From_Multiple call. */
+typedef struct _nu_mmsg
+{
+    CHAR                *mm_buff;       /* Data to send, or receive buffer */
+    struct addr_struct  *mm_addr;       /* Destination, or source on return */
+    INT32               mm_status;      /* Bytes transferred, or an error */
+    UINT16              mm_len;         /* Bytes to send, or buffer size */
+    UINT8               padN[2];
+} NU_MMSG;
+
+/* The registration of a socket in an event set.  The first two members
+   link the entry into the ready list of the set, so they must stay
+   first for the DLL routines. */
+typedef struct _evs_entry
+{
+    struct _evs_entry   *ee_flink;
+    struct _evs_entry   *ee_blink;
+    struct _evs_entry   *ee_next;       /* Next socket in the set. */
+    struct _evs_set     *ee_set;
+    VOID                *ee_data;
+    INT                 ee_socketd;
+    UINT16              ee_events;      /* Events of interest. */
+    UINT8               ee_ready;       /* On the ready list. */
+    UINT8               padN[1];
+} EVS_ENTRY;
+
+typedef struct _evs_ready_list
+{
+    EVS_ENTRY           *head;
+    EVS_ENTRY           *tail;
+} EVS_READY_LIST;
+
+/* An event set.  Sockets are only placed on the ready list when the stack
+   has notified a change of their state, so waiting on the set does not
+   depend on how many sockets are in it. */
+typedef struct _evs_set
+{
+    EVS_READY_LIST      es_ready;
+    EVS_ENTRY           *es_entries;
+    NU_TASK             *es_waiter;     /* Task suspended in NU_Event_Set_Wait */
+    INT                 es_setd;
+    UINT32              es_struct_id;
+} EVS_SET;
+
+/* The receive ring of a socket.  The stack places datagrams at the tail
+   and the owning task takes them from the head without obtaining the
+   stack semaphore, so each index is only written by one side. */
+typedef struct _sck_rx_ring
+{
+    volatile UINT32     srr_head;       /* Next slot the task reads. */
+    volatile UINT32     srr_tail;       /* Next slot the stack writes. */
+    NET_BUFFER * volatile srr_slots[SCK_RX_RING_SIZE];
+    NU_EVENT_GROUP      srr_event;      /* Signals the ring is not empty. */
+    UINT32              srr_drops;      /* Datagrams dropped on a full ring. */
+    INT                 srr_users;      /* Tasks in SCK_Rx_Ring_Recv. */
+    INT                 srr_closed;     /* Removed from its socket. */
+} SCK_RX_RING;
+
+#define SCK_RX_RING_MASK    (SCK_RX_RING_SIZE - 1)
+#define SCK_RX_RING_READY   0x1
+
 /* this is the socket 5-tuple */
 struct sock_struct
 {
@@ -164,6 +243,8 @@ struct sock_struct
   INT32                     s_error;
   UINT32                    s_struct_id;
   NET_BUFFER                *s_rx_ancillary_data;   /* Incoming ancillary data */
+  EVS_ENTRY                 *s_evs_entry;   /* Event set registration */
+  SCK_RX_RING               *s_rx_ring;     /* Receive ring of the owning task */
 };
 
 struct _msghdr
@@ -27,6 +27,7 @@
 *
 *       TCPLAYER
 *       TCP_WINDOW
+*       TCP_OOO_RANGE
 *       TCP_PORT
 *
 *   DEPENDENCIES
@@ -158,6 +159,78 @@ struct _TCP_Window
 
 typedef struct _TCP_Window TCP_WINDOW;
 
+#if (INCLUDE_TCP_OOO == NU_TRUE)
+
+/* A range of contiguous data on the out of order list.  The buffers of
+ * a range are consecutive on the list, from otr_first to otr_last, and
+ * together cover the sequence numbers from otr_left up to otr_right.
+ */
+typedef struct _TCP_OOO_RANGE
+{
+    NET_BUFFER  *otr_first;
+    NET_BUFFER  *otr_last;
+    UINT32      otr_left;
+    UINT32      otr_right;
+} TCP_OOO_RANGE;
+
+#endif
+
+#if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
+
+struct _TCP_Port;
+
+/* The operations of a congestion control module.  The module owns the
+ * congestion window and slow start threshold outside of Fast Recovery;
+ * the loss recovery itself (Fast Retransmit, NewReno partial ACKs) is
+ * common to all modules.  tcc_on_rtt_sample may be NU_NULL.
+ */
+typedef struct _TCP_CC_OPS
+{
+    /* Set the initial cwnd and ssthresh of a new connection. */
+    VOID    (*tcc_init)(struct _TCP_Port *prt);
+
+    /* New data was ACKed outside of Fast Recovery. */
+    VOID    (*tcc_on_ack)(struct _TCP_Port *prt, UINT32 bytes_acked);
+
+    /* Fast Retransmit was entered; set ssthresh. */
+    VOID    (*tcc_on_loss)(struct _TCP_Port *prt);
+
+    /* The retransmission timer expired; set ssthresh and cwnd. */
+    VOID    (*tcc_on_rto)(struct _TCP_Port *prt);
+
+    /* A new round trip time sample, in clock ticks, was taken. */
+    VOID    (*tcc_on_rtt_sample)(struct _TCP_Port *prt, UINT32 rtt);
+
+    UINT8   tcc_id;             /* The TCP_CONGESTION_CTRL option value */
+    UINT8   tcc_pad[3];
+} TCP_CC_OPS;
+
+/* Per-connection state of the CUBIC module. */
+typedef struct _TCP_CC_CUBIC
+{
+    UINT32  tcu_w_max;          /* cwnd before the last reduction */
+    UINT32  tcu_origin;         /* The plateau of the cubic function */
+    UINT32  tcu_w_est;          /* Window standard TCP would have */
+    UINT32  tcu_epoch_start;    /* Clock tick the growth epoch began */
+    UINT32  tcu_k;              /* Milliseconds to reach the plateau */
+} TCP_CC_CUBIC_STATE;
+
+/* Per-connection state of the BBR-lite module. */
+typedef struct _TCP_CC_BBR
+{
+    UINT32  tbb_max_bw;         /* Windowed max delivery rate, scaled */
+    UINT32  tbb_full_bw;        /* max_bw when Startup last grew */
+    UINT32  tbb_min_rtt;        /* Windowed min RTT, in ticks */
+    UINT32  tbb_min_rtt_stamp;  /* Clock tick min_rtt was taken */
+    UINT32  tbb_delivered;      /* Bytes ACKed since the last sample */
+    UINT8   tbb_bw_age;         /* Samples since max_bw was taken */
+    UINT8   tbb_full_bw_cnt;    /* Samples Startup has not grown */
+    UINT8   tbb_startup;        /* NU_TRUE while in Startup */
+    UINT8   tbb_pad[1];
+} TCP_CC_BBR_STATE;
+
+#endif
+
 struct _TCP_Port
 {
     TCP_WINDOW      in, out;
@@ -239,6 +312,12 @@ struct _TCP_Port
 #if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
     UINT32  p_cwnd;             /* Congestion window */
     UINT32  p_ssthresh;         /* Slow Start Threshold */
+    const TCP_CC_OPS *p_cc_ops; /* Congestion control module */
+    union
+    {
+        TCP_CC_CUBIC_STATE  p_cc_cubic;
+        TCP_CC_BBR_STATE    p_cc_bbr;
+    } p_cc;                     /* State of the congestion control module */
 #endif
     UINT32  p_rtseq;            /* Sequence # of packet being timed. */
     UINT32  p_msl;              /* MSL for the connection */
@@ -252,6 +331,12 @@ struct _TCP_Port
 #if (NET_INCLUDE_SACK == NU_TRUE)
     UINT32  left_edge;
     UINT32  right_edge;
+#endif
+#if (INCLUDE_TCP_OOO == NU_TRUE)
+    TCP_OOO_RANGE p_ooo_ranges[TCP_MAX_OOO_RANGES]; /* Disjoint ranges of the out
+                                                       of order list, in order */
+    UINT16  p_ooo_range_count;  /* Number of ranges in use */
+    UINT16  p_ooo_pad[1];
 #endif
     INT32   p_rto;              /* retrans timeout */
     INT32   p_srtt;
@@ -451,6 +536,30 @@ typedef struct _TCP_Port TCP_PORT;
 #define TCP_TIMESTAMP               20
 #define TCP_KEEPINTVL               21
 
+/* The congestion control modules that can be selected with the
+ * TCP_CONGESTION_CTRL option.  A value of 0 disables Congestion Control.
+ */
+#define TCP_CC_NEWRENO              1
+#define TCP_CC_CUBIC                2
+#define TCP_CC_BBR_LITE             3
+
+/* CUBIC multiplicative decrease factor (0.7) and fast convergence
+ * factor ((1 + 0.7) / 2), in units of 1/1024.
+ */
+#define TCP_CC_CUBIC_BETA           717
+#define TCP_CC_CUBIC_FAST_CONV      870
+
+/* BBR-lite: the delivery rate is kept in bytes per tick scaled by
+ * 2^TCP_CC_BBR_BW_SHIFT; the max rate is kept for TCP_CC_BBR_BW_SAMPLES
+ * RTT samples and the min RTT for TCP_CC_BBR_MIN_RTT_WIN ticks.  Startup
+ * ends once the rate has not grown by 25% for TCP_CC_BBR_FULL_BW_CNT
+ * samples.
+ */
+#define TCP_CC_BBR_BW_SHIFT         4
+#define TCP_CC_BBR_BW_SAMPLES       10
+#define TCP_CC_BBR_MIN_RTT_WIN      (10 * SCK_Ticks_Per_Second)
+#define TCP_CC_BBR_FULL_BW_CNT      3
+
 #define FOREIGN_MAX_SEGMENT_LEN  536
 
 /* Make sure the sequence number is within the window space. The first pair
@@ -491,7 +600,7 @@ UINT8   *TCP_Find_Option(UINT8 *, UINT8, UINT8);
 /***** TCPSS.C *****/
 
 INT32   TCPSS_Recv_Data(INT, CHAR *, UINT16);
-INT32   TCPSS_Send_Data(INT socketd, CHAR *buff, UINT16 nbytes);
+INT32   TCPSS_Send_Data(INT socketd, CHAR *buff, UINT16 nbytes, UINT16 flags);
 STATUS  TCPSS_Net_Listen(UINT16 serv, const VOID *, INT16);
 STATUS  TCPSS_Net_Xopen (const UINT8 *machine, INT16 family, UINT16 service,
                          INT socketd);
@@ -596,6 +705,11 @@ STATUS TCP_Getsockopt_TCP_CONGESTION_CTRL(INT socketd, UINT8 *optval);
 /***** TCP_SCC.C *****/
 STATUS TCP_Setsockopt_TCP_CONGESTION_CTRL(INT socketd, UINT8 opt_val);
 
+#if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
+/***** TCP_CC.C *****/
+const TCP_CC_OPS *TCP_CC_Get_Ops(UINT8 id);
+#endif
+
 /***** TCP_GCSACK.C *****/
 STATUS TCP_Getsockopt_TCP_CFG_SACK(INT socketd, UINT8 *optval);
 
@@ -604,7 +718,6 @@ STATUS TCP_Setsockopt_TCP_CFG_SACK(INT socketd, UINT8 opt_val);
 
 /***** TCP_SACK.C *****/
 UINT8 TCP_SACK_Flag_Packets(UINT8 *buffer, TCP_PORT *prt);
-NET_BUFFER *TCP_Find_Continuous_SACK_Block(NET_BUFFER *, UINT32 *);
 VOID TCP_Build_SACK_Block(UINT8 *, TCP_PORT *, UINT8 *, UINT8, UINT32, UINT32);
 
 /***** TCP_GCDSACK.C *****/
@@ -48,8 +48,62 @@ extern  "C" {                               /* C declarations in C++     */
 
 
 /************ RESOURCES ************/
+
+/* Lock ordering within the networking stack.
+ *
+ *  TCP_Resource        The stack semaphore.  Protects the socket list,
+ *                      the transport port lists, the routing table, the
+ *                      ARP and neighbor caches and all protocol state.
+ *                      It is always obtained through NET_Obtain_Stack_Lock
+ *                      and released through NET_Release_Stack_Lock, so
+ *                      contention is counted in NET_Stack_Lock_Stats.
+ *
+ *  MDNS_Resource,      Protocol semaphores.  These may be obtained before
+ *  DNS_Resource        TCP_Resource, and MDNS_Resource before
+ *                      DNS_Resource.  While TCP_Resource is held they may
+ *                      only be obtained with NU_NO_SUSPEND.
+ *
+ *  Interrupt lockout   MEM_Rx_Driver_List, MEM_Buffer_Freelist and the
+ *                      driver transmit queues are protected by disabling
+ *                      interrupts.  Never suspend with interrupts
+ *                      disabled.
+ *
+ *  Receive rings       Each device receive ring has one producer, the
+ *                      driver, and one consumer, NET_Demux, so it needs
+ *                      no lock.  Only the driver touches the ring's
+ *                      buffer cache, which is refilled from
+ *                      MEM_Buffer_Freelist under the interrupt lockout.
+ *
+ *  MEM_Buffer_List     The packets being processed by the stack.  It is
+ *                      protected by TCP_Resource alone.  NET_Demux moves
+ *                      ring packets onto it directly, and moves
+ *                      MEM_Rx_Driver_List onto it under one interrupt
+ *                      lockout per batch.  Drivers must pass packets
+ *                      through MEM_Rx_Ring_Put and never touch it.
+ *
+ * NET_Demux hands TCP_Resource to any task waiting for it between
+ * packets, so receive processing delays a waiting task by at most one
+ * packet.  Other holders, such as the timer task and the protocol
+ * daemons, release it only when they are done.
+ */
 extern NU_SEMAPHORE             TCP_Resource;
 
+/* Contention statistics for TCP_Resource. */
+typedef struct _net_lock_stats
+{
+    UINT32      nls_obtains;        /* Times the semaphore was obtained */
+    UINT32      nls_contended;      /* Obtains that found it owned */
+    UINT32      nls_demux_yields;   /* Times NET_Demux handed it over */
+    UINT32      nls_max_waiters;    /* Most tasks waiting at one time */
+} NET_LOCK_STATS;
+
+extern NET_LOCK_STATS           NET_Stack_Lock_Stats;
+extern UNSIGNED                 NET_Stack_Lock_Waiters;
+
+STATUS  NET_Obtain_Stack_Lock(UNSIGNED suspend);
+STATUS  NET_Release_Stack_Lock(VOID);
+STATUS  NU_Get_Stack_Lock_Stats(NET_LOCK_STATS *stats, INT reset);
+
 /************* EVENTS **************/
 extern NU_QUEUE        eQueue;
 extern NU_EVENT_GROUP  Buffers_Available;
@@ -89,8 +89,18 @@ typedef         signed char                         INT8;
 typedef         unsigned char                       UINT8;
 typedef         signed short                        INT16;
 typedef         unsigned short                      UINT16;
+#if             defined(__LP64__)
+
+/* long is 64 bits wide on LP64 hosts. */
+typedef         signed int                          INT32;
+typedef         unsigned int                        UINT32;
+
+#else
+
 typedef         signed long                         INT32;
 typedef         unsigned long                       UINT32;
+
+#endif          /* __LP64__ */
 #define         VOID                                void
 typedef         unsigned long long                  UINT64;
 typedef         signed long long                    INT64;
@@ -220,6 +220,7 @@ extern unsigned int    idle_flag;
 #define NET_DEV_RX_ACT_EID              (KRN_EID_BASE + 146)
 #define NET_DEV_TRANSQ_LEN_EID          (KRN_EID_BASE + 147)
 #define NET_DEV_REMOVE_IP6_EID          (KRN_EID_BASE + 148)
+#define NET_LAT_HIST_EID                (KRN_EID_BASE + 149)
 
 /* Trace status definitions */
 #define OBJ_ACTION_SUCCESS              0
@@ -980,6 +981,8 @@ extern void                                 *Trace_PC_Sample;
                                             Log_pCU32I(NET_DEV_RX_ACT_EID, dev_name, data_len, status))
 #define T_DEV_TRANSQ_LEN(dev_name, q_len)   APPLY_MASK(NU_TRACE_NET_INFO, NET_DEV_TRANSQ_LEN_EID,      \
                                             Log_pCU32(NET_DEV_TRANSQ_LEN_EID, dev_name, q_len))
+#define T_NET_LAT_HIST(stage, bucket, count) APPLY_MASK(NU_TRACE_NET_INFO, NET_LAT_HIST_EID,          \
+                                            Log_U32U32I(NET_LAT_HIST_EID, bucket, count, stage))
 
 #else
 
@@ -1208,6 +1211,7 @@ extern void                                 *Trace_PC_Sample;
 #define T_DEV_TX_LAT_STOP(dev_name, data_len, bytes_written, status)
 #define T_DEV_RX_ACT(dev_name, data_len, status)
 #define T_DEV_TRANSQ_LEN(dev_name, q_len)
+#define T_NET_LAT_HIST(stage, bucket, count)
 
 #endif /* (CFG_NU_OS_SVCS_TRACE_CORE_TRACE_SUPPORT == NU_TRUE) */
 
@@ -289,6 +289,30 @@ STATUS NU_PM_DVFS_Unregister(PM_DVFS_HANDLE dvfs_handle);
 STATUS NU_PM_DVFS_Update_MPL(PM_DVFS_HANDLE dvfs_handle, PM_MPL *mpl, PM_DVFS_NOTIFY dvfs_notify);
 STATUS NU_PM_DVFS_Control_Transition(BOOLEAN new_value, BOOLEAN *previous_value);
 
+/* Hold the highest available OP, see NU_PM_Governor_Hold_OP */
+#define PM_GOVERNOR_HIGHEST_OP          0xFF
+
+/* Structure used to retrieve the state and transition costs of the
+   DVFS governor.  Times are in microseconds. */
+typedef struct PM_GOVERNOR_INFO_CB
+{
+    UINT32   pm_transitions;                /* OP changes made by the governor */
+    UINT32   pm_failed_transitions;         /* OP changes refused by DVFS */
+    UINT32   pm_last_transition_time;       /* Duration of the last OP change */
+    UINT32   pm_max_transition_time;        /* Longest OP change */
+    UINT32   pm_total_transition_time;      /* Time spent in OP changes, wraps */
+    UINT8    pm_load;                       /* CPU load of the last sample in percent */
+    UINT8    pm_held_op;                    /* Highest OP held by drivers, 0 if none */
+    UINT8    pm_up_threshold;               /* Load at which the OP is raised */
+    UINT8    pm_down_threshold;             /* Load at which the OP is lowered */
+} PM_GOVERNOR_INFO;
+
+STATUS NU_PM_Governor_Hold_OP(UINT8 op_id);
+STATUS NU_PM_Governor_Release_OP(UINT8 op_id);
+STATUS NU_PM_Governor_Set_Thresholds(UINT8 up_threshold, UINT8 down_threshold);
+STATUS NU_PM_Governor_Control(BOOLEAN new_value, BOOLEAN *previous_value);
+STATUS NU_PM_Governor_Get_Info(PM_GOVERNOR_INFO *info_ptr);
+
 
 /*********************************************
 	Watchdog Services Sub-component
@@ -31,6 +31,7 @@
 *	DEPENDENCIES
 *
 *       nucleus.h
+*       nu_kernel.h
 *       reg_status.h
 *
 *************************************************************************/
@@ -39,6 +40,7 @@
 #define REG_API_H
 
 #include "nucleus.h"
+#include "kernel/nu_kernel.h"
 #include "services/reg_status.h"
 
 #ifdef __cplusplus
@@ -53,6 +55,10 @@ extern "C" {
    generated header file based on the longest key length in the configuration) */
 #define REG_MAX_KEY_LENGTH    CFG_NU_OS_SVCS_REGISTRY_MAX_KEY_LEN
 
+/* Handle of an opened key.  A handle stays valid as long as the key
+   exists and saves looking up the key string on every access. */
+typedef const VOID *    REG_HANDLE;
+
 /* Queries */
 BOOLEAN REG_Has_Key(const CHAR *key);
 BOOLEAN REG_Key_Is_Writable(const CHAR *key);
@@ -93,6 +99,27 @@ STATUS REG_Get_Bytes_Value(const CHAR *key, const CHAR *sub_key, UNSIGNED_CHAR *
 STATUS REG_Set_Writable_Value(const CHAR *key, const CHAR *sub_key, BOOLEAN is_writable);
 #define REG_Set_Writable(key, is_writable) REG_Set_Writable_Value(key, NU_NULL, is_writable)
 
+/* Handles */
+STATUS REG_Open_Key_Value(const CHAR *key, const CHAR *sub_key, REG_HANDLE *handle);
+#define REG_Open_Key(key, handle) REG_Open_Key_Value(key, NU_NULL, handle)
+
+STATUS REG_Set_Boolean_Handle(REG_HANDLE handle, BOOLEAN value);
+STATUS REG_Get_Boolean_Handle(REG_HANDLE handle, BOOLEAN *value);
+STATUS REG_Set_UINT8_Handle(REG_HANDLE handle, UINT8 value);
+STATUS REG_Get_UINT8_Handle(REG_HANDLE handle, UINT8 *value);
+STATUS REG_Set_UINT16_Handle(REG_HANDLE handle, UINT16 value);
+STATUS REG_Get_UINT16_Handle(REG_HANDLE handle, UINT16 *value);
+STATUS REG_Set_UINT32_Handle(REG_HANDLE handle, UINT32 value);
+STATUS REG_Get_UINT32_Handle(REG_HANDLE handle, UINT32 *value);
+STATUS REG_Set_String_Handle(REG_HANDLE handle, const CHAR *value, UINT length);
+STATUS REG_Get_String_Handle(REG_HANDLE handle, CHAR *value, UINT length);
+STATUS REG_Set_Bytes_Handle(REG_HANDLE handle, const UNSIGNED_CHAR *value, UINT length);
+STATUS REG_Get_Bytes_Handle(REG_HANDLE handle, UNSIGNED_CHAR *value, UINT length);
+
+/* Key index and lookup statistics of the memory based registry */
+STATUS REG_Index_Initialize(NU_MEMORY_POOL *mem_pool);
+VOID   REG_Get_Lookup_Counts(UINT32 *lookups, UINT32 *compares);
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,12 +42,18 @@
 *       REG_Set_Bytes_Func
 *       REG_Get_Bytes_Func
 *       REG_Set_Writable_Func
+*       REG_Open_Key_Func
+*       REG_Get_Handle_Value_Func
+*       REG_Set_Handle_Value_Func
+*       REG_Get_Handle_Bytes_Func
+*       REG_Set_Handle_Bytes_Func
 *       REG_IMPL
 *
 *	DEPENDENCIES
 *
 *       nucleus.h
 *       reg_status.h
+*       reg_api.h
 *
 *************************************************************************/
 
@@ -56,6 +62,7 @@
 
 #include "nucleus.h"
 #include "services/reg_status.h"
+#include "services/reg_api.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -83,6 +90,19 @@ typedef STATUS (*REG_Get_Bytes_Func)(const CHAR *key, UNSIGNED_CHAR *value,
                                          UINT length);
 typedef STATUS (*REG_Set_Writable_Func)(const CHAR *key, 
                                             BOOLEAN is_writable);
+typedef STATUS (*REG_Open_Key_Func)(const CHAR *key, REG_HANDLE *handle);
+typedef STATUS (*REG_Get_Handle_Value_Func)(REG_HANDLE handle,
+                                            UNSIGNED_CHAR *value,
+                                            UINT length);
+typedef STATUS (*REG_Set_Handle_Value_Func)(REG_HANDLE handle,
+                                            const UNSIGNED_CHAR *value,
+                                            UINT length);
+typedef STATUS (*REG_Get_Handle_Bytes_Func)(REG_HANDLE handle,
+                                            UNSIGNED_CHAR *value,
+                                            UINT length);
+typedef STATUS (*REG_Set_Handle_Bytes_Func)(REG_HANDLE handle,
+                                            const UNSIGNED_CHAR *value,
+                                            UINT length);
 
 typedef struct
 {
@@ -102,6 +122,11 @@ typedef struct
     REG_Set_Bytes_Func       REG_Set_Bytes_Value;
     REG_Get_Bytes_Func       REG_Get_Bytes_Value;
     REG_Set_Writable_Func    REG_Set_Writable_Value;
+    REG_Open_Key_Func        REG_Open_Key_Value;
+    REG_Get_Handle_Value_Func REG_Get_Handle_Value;
+    REG_Set_Handle_Value_Func REG_Set_Handle_Value;
+    REG_Get_Handle_Bytes_Func REG_Get_Handle_Bytes;
+    REG_Set_Handle_Bytes_Func REG_Set_Handle_Bytes;
 } REG_IMPL;
 
 extern REG_IMPL *impl;
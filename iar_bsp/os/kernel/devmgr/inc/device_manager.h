@@ -115,6 +115,7 @@ typedef struct _dv_dev_registry_struct
         INT     state_flag;
         VOID*   handle;
         INT     active_cmds_cnt;
+        DV_DEV_FAST_IO  *fast_io_list;
     } session[DV_MAX_DEV_SESSION_CNT];
 
     NU_EVENT_GROUP         active_cmds_event;
@@ -43,6 +43,24 @@
 *       DVC_Dev_Read                        Sends a read command to a device
 *       DVC_Dev_Write                       Sends a write command to a device
 *       DVC_Dev_Ioctl                       Sends an IOCTL command to a device
+*       DVC_Dev_Fast_IO_Bind                Binds a fast I/O descriptor
+*       DVC_Dev_Fast_IO_Unbind              Unbinds a fast I/O descriptor
+*       DVC_Dev_Fast_IO_Read                Sends a read command through
+*                                           a fast I/O descriptor
+*       DVC_Dev_Fast_IO_Write               Sends a write command through
+*                                           a fast I/O descriptor
+*       DVC_Dev_Fast_IO_Ioctl               Sends an IOCTL command through
+*                                           a fast I/O descriptor
+*       DVC_Fast_IO_Find                    Finds the link to a bound fast
+*                                           I/O descriptor
+*       DVC_Fast_IO_Enter                   Starts a fast I/O call
+*       DVC_Fast_IO_Exit                    Ends a fast I/O call
+*       DVC_Fast_IO_Invalidate              Invalidates the fast I/O
+*                                           descriptors of a session
+*       DVC_Fast_IO_No_Read                 Fast read without a driver
+*                                           read function
+*       DVC_Fast_IO_No_Write                Fast write without a driver
+*                                           write function
 *
 *   DEPENDENCIES
 *
@@ -78,6 +96,16 @@ extern DV_DEV_LISTENER *DVD_Dev_Reg_Listener_Array[DV_MAX_DEVICE_LISTENERS];
 extern NU_SEMAPHORE     DVD_Dev_Reg_Listener_Semaphore;
 #endif
 
+/* Local function prototypes */
+static DV_DEV_FAST_IO **DVC_Fast_IO_Find (DV_DEV_FAST_IO *fast_io_ptr);
+static STATUS DVC_Fast_IO_Enter (DV_DEV_FAST_IO *fast_io_ptr, DV_DEV_FAST_IO *call_ptr);
+static VOID   DVC_Fast_IO_Exit (DV_DEV_HANDLE dev_handle);
+static VOID   DVC_Fast_IO_Invalidate (INT32 reg_index, INT32 session_index);
+static STATUS DVC_Fast_IO_No_Read (VOID* session_handle, VOID *buffer, UINT32 numbyte,
+                                   OFFSET_T byte_offset, UINT32 *bytes_read_ptr);
+static STATUS DVC_Fast_IO_No_Write (VOID* session_handle, const VOID *buffer, UINT32 numbyte,
+                                    OFFSET_T byte_offset, UINT32 *bytes_written_ptr);
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -280,6 +308,7 @@ STATUS DVC_Dev_Register (VOID* instance_handle,
 *
 *       TCCT_Schedule_Lock
 *       TCCT_Schedule_Unlock
+*       NU_Retrieve_Events
 *       NU_Set_Events
 *
 *   INPUTS
@@ -302,6 +331,7 @@ STATUS DVC_Dev_Register (VOID* instance_handle,
 STATUS DVC_Dev_Unregister (DV_DEV_ID dev_id, VOID* *instance_handle_ptr)
 {
     VOID*          session_handle;
+    UNSIGNED       event_group;
     INT            i;
     INT32          reg_index;
     STATUS         status = NU_SUCCESS;
@@ -350,12 +380,25 @@ STATUS DVC_Dev_Unregister (DV_DEV_ID dev_id, VOID* *instance_handle_ptr)
                     /* Mark that this slot in the session registry is locked */
                     DVD_Dev_Registry[reg_index].session[session_index].state_flag = DV_SES_LOCKED;
 
+                    /* Stop fast I/O to the session */
+                    DVC_Fast_IO_Invalidate(reg_index, session_index);
+
                     /* Get the session handle to pass to the driver */
                     session_handle = DVD_Dev_Registry[reg_index].session[session_index].handle;
 
                     /* Release protection against access to the registry.  */
                     TCCT_Schedule_Unlock();
 
+                    /* If we have ongoing activity in this session */
+                    if (DVD_Dev_Registry[reg_index].session[session_index].active_cmds_cnt != 0)
+                    {
+                        /* Wait for all ongoing activity to complete */
+                        (VOID)NU_Retrieve_Events(
+                                    &DVD_Dev_Registry[reg_index].active_cmds_event,
+                                    (1 << session_index), (OPTION)NU_AND_CONSUME, &event_group,
+                                    (UNSIGNED)NU_SUSPEND);
+                    }
+
                     /* Call the driver's close function */
                     status = (*DVD_Dev_Registry[reg_index].drv_close_ptr)(session_handle);
 
@@ -1534,6 +1577,7 @@ STATUS DVC_Dev_Open (DV_DEV_LABEL *dev_name_ptr, DV_DEV_HANDLE *dev_handle_ptr)
 *
 *       TCCT_Schedule_Lock
 *       TCCT_Schedule_Unlock
+*       NU_Retrieve_Events
 *       Low Level Driver Close
 *
 *   INPUTS
@@ -1605,12 +1649,22 @@ STATUS DVC_Dev_Close (DV_DEV_HANDLE dev_handle)
         /* If everything is OK */
         if (status == NU_SUCCESS)
         {
+            /* Clear a completion flag left set by a command that ended
+               while an earlier close of this session did not wait */
+            (VOID)NU_Retrieve_Events(
+                        &DVD_Dev_Registry[reg_index].active_cmds_event,
+                        (1 << session_index), (OPTION)NU_AND_CONSUME, &event_group,
+                        (UNSIGNED)NU_NO_SUSPEND);
+
             /* Protect against access to the registry.  */
             TCCT_Schedule_Lock();
 
             /* Mark that this slot in the session registry is locked */
             DVD_Dev_Registry[reg_index].session[session_index].state_flag = DV_SES_LOCKED;
 
+            /* Stop fast I/O to the session */
+            DVC_Fast_IO_Invalidate(reg_index, session_index);
+
             /* Get the session handle to pass to the driver */
             session_handle = DVD_Dev_Registry[reg_index].session[session_index].handle;
 
@@ -2078,3 +2132,761 @@ STATUS DVC_Dev_Ioctl (DV_DEV_HANDLE dev_handle, INT ioctl_num,
     return (status);
 }
 
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       DVC_Dev_Fast_IO_Bind
+*
+*   DESCRIPTION
+*
+*       This function validates an open session once and fills in a fast
+*       I/O descriptor for it.  DVC_Dev_Fast_IO_Read, DVC_Dev_Fast_IO_Write
+*       and DVC_Dev_Fast_IO_Ioctl then call the driver through the
+*       descriptor.  The descriptor stays bound until it is unbound, the
+*       session is closed or the device is unregistered.  A descriptor
+*       that is still bound must be unbound before it is bound again.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       TCCT_Schedule_Lock
+*       TCCT_Schedule_Unlock
+*
+*   INPUTS
+*
+*       dev_handle                          Device handle
+*       *fast_io_ptr                        Descriptor to bind
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS
+*           DV_INVALID_INPUT_PARAMS         Invalid parameters or the
+*                                           descriptor is already bound
+*           DV_DEV_NOT_REGISTERED
+*           DV_SESSION_NOT_OPEN
+*
+*************************************************************************/
+STATUS DVC_Dev_Fast_IO_Bind (DV_DEV_HANDLE dev_handle, DV_DEV_FAST_IO *fast_io_ptr)
+{
+    DV_DEV_ID               dev_id;
+    INT32                   reg_index, session_index;
+    STATUS                  status = NU_SUCCESS;
+    INT32                   reuse_cnt;
+
+    NU_SUPERV_USER_VARIABLES
+
+    /* Get the device ID */
+    dev_id = DV_GET_DEV_ID(dev_handle);
+
+    /* Get the session that we are binding */
+    session_index = DV_GET_SES_INDEX(dev_handle);
+
+    /* Get device registry index */
+    reg_index = DV_GET_REG_INDEX(dev_id);
+
+    /* Check the input parameters */
+    if (((reg_index < (DV_DEV_ID)0) || (reg_index >= DVD_Max_Dev_Id_Cnt)) ||
+        ((session_index < 0) || (session_index >= DV_MAX_DEV_SESSION_CNT)) ||
+        (fast_io_ptr == NU_NULL))
+    {
+        /* Invalid input parameters */
+        status = DV_INVALID_INPUT_PARAMS;
+    }
+    else
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Get device id reuse count */
+        reuse_cnt = DV_GET_REUSE_CNT(dev_id);
+
+        /* Protect against access to the registry.  */
+        TCCT_Schedule_Lock();
+
+        /* If the descriptor is still linked to a session */
+        if (DVC_Fast_IO_Find(fast_io_ptr) != NU_NULL)
+        {
+            /* Relinking it would corrupt the session's descriptor list */
+            status = DV_INVALID_INPUT_PARAMS;
+        }
+
+        /* If the device was not registered */
+        else if ((DVD_Dev_Registry[reg_index].entry_active_flag != NU_TRUE) ||
+                 (reuse_cnt != DVD_Dev_Registry[reg_index].reuse_cnt))
+        {
+            /* Can't bind to a device that is not registered */
+            status = DV_DEV_NOT_REGISTERED;
+        }
+        else
+        {
+            /* If the session is not open */
+            if (DVD_Dev_Registry[reg_index].session[session_index].state_flag != DV_SES_OPEN)
+            {
+                /* Can't bind to a session that is not open */
+                status = DV_SESSION_NOT_OPEN;
+            }
+        }
+
+        /* If everything is OK */
+        if (status == NU_SUCCESS)
+        {
+            /* Save the session handle to pass to the driver */
+            fast_io_ptr->session_handle = DVD_Dev_Registry[reg_index].session[session_index].handle;
+            fast_io_ptr->dev_handle = dev_handle;
+
+            /* Save the driver functions.  A missing read or write function
+               does nothing, as in DVC_Dev_Read and DVC_Dev_Write. */
+            fast_io_ptr->read_ptr = (DVD_Dev_Registry[reg_index].drv_read_ptr != NU_NULL) ?
+                                    DVD_Dev_Registry[reg_index].drv_read_ptr : DVC_Fast_IO_No_Read;
+            fast_io_ptr->write_ptr = (DVD_Dev_Registry[reg_index].drv_write_ptr != NU_NULL) ?
+                                     DVD_Dev_Registry[reg_index].drv_write_ptr : DVC_Fast_IO_No_Write;
+            fast_io_ptr->ioctl_ptr = DVD_Dev_Registry[reg_index].drv_ioctl_ptr;
+
+            /* Link the descriptor to the session */
+            fast_io_ptr->next = DVD_Dev_Registry[reg_index].session[session_index].fast_io_list;
+            DVD_Dev_Registry[reg_index].session[session_index].fast_io_list = fast_io_ptr;
+        }
+
+        /* Release protection against access to the registry.  */
+        TCCT_Schedule_Unlock();
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    return (status);
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       DVC_Dev_Fast_IO_Unbind
+*
+*   DESCRIPTION
+*
+*       This function unbinds a fast I/O descriptor from its session.
+*       Calls through the descriptor return DV_SESSION_NOT_OPEN
+*       afterwards.  A descriptor already invalidated by a close or
+*       unregister may be unbound as well.  Calls already in progress
+*       through the descriptor are not waited for.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       TCCT_Schedule_Lock
+*       TCCT_Schedule_Unlock
+*
+*   INPUTS
+*
+*       *fast_io_ptr                        Descriptor to unbind
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS
+*           DV_INVALID_INPUT_PARAMS
+*
+*************************************************************************/
+STATUS DVC_Dev_Fast_IO_Unbind (DV_DEV_FAST_IO *fast_io_ptr)
+{
+    DV_DEV_FAST_IO          **link_ptr;
+    STATUS                  status = NU_SUCCESS;
+
+    NU_SUPERV_USER_VARIABLES
+
+    if (fast_io_ptr == NU_NULL)
+    {
+        /* Invalid input parameters */
+        status = DV_INVALID_INPUT_PARAMS;
+    }
+    else
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Protect against access to the registry.  */
+        TCCT_Schedule_Lock();
+
+        /* Unlink the descriptor if it is still linked to its session */
+        link_ptr = DVC_Fast_IO_Find(fast_io_ptr);
+        if (link_ptr != NU_NULL)
+        {
+            *link_ptr = fast_io_ptr->next;
+        }
+
+        /* Make further calls through the descriptor fail */
+        fast_io_ptr->session_handle = NU_NULL;
+        fast_io_ptr->read_ptr = NU_NULL;
+        fast_io_ptr->write_ptr = NU_NULL;
+        fast_io_ptr->ioctl_ptr = NU_NULL;
+        fast_io_ptr->next = NU_NULL;
+
+        /* Release protection against access to the registry.  */
+        TCCT_Schedule_Unlock();
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    return (status);
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       DVC_Dev_Fast_IO_Read
+*
+*   DESCRIPTION
+*
+*       This function calls the driver's read function through a fast
+*       I/O descriptor.  The call is counted as an active session command,
+*       so DVC_Dev_Close waits for it to complete.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       DVC_Fast_IO_Enter
+*       DVC_Fast_IO_Exit
+*       Low Level Driver Read
+*
+*   INPUTS
+*
+*       *fast_io_ptr                        Bound fast I/O descriptor
+*       *buffer_ptr                         Memory address to start writing from
+*       numbyte                             The size in bytes of the buffer
+*       byte_offset                         Number of bytes to offset from 0
+*       *bytes_read_ptr                     Pointer to where we return the number of
+*                                           bytes read
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS
+*           DV_INVALID_INPUT_PARAMS
+*           DV_SESSION_NOT_OPEN
+*           Driver's READ function returned error status
+*
+*************************************************************************/
+STATUS DVC_Dev_Fast_IO_Read (DV_DEV_FAST_IO *fast_io_ptr, VOID *buffer_ptr, UINT32 numbyte,
+                             OFFSET_T byte_offset, UINT32 *bytes_read_ptr)
+{
+    DV_DEV_FAST_IO          call;
+    UINT32                  bytes_r = 0;
+    STATUS                  status;
+
+    NU_SUPERV_USER_VARIABLES
+
+    /* Switch to Supervisor mode */
+    NU_SUPERVISOR_MODE();
+
+    /* Count the call as an active command of the session */
+    status = DVC_Fast_IO_Enter(fast_io_ptr, &call);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Call the driver's read function code */
+        status = (*call.read_ptr)(call.session_handle, buffer_ptr,
+                                  numbyte, byte_offset, &bytes_r);
+
+        /* If we have a place to return the number of bytes read */
+        if (bytes_read_ptr != NU_NULL)
+        {
+            /* Return the number of bytes read */
+            *bytes_read_ptr = bytes_r;
+        }
+
+        /* End the session command */
+        DVC_Fast_IO_Exit(call.dev_handle);
+    }
+
+    /* Return to user mode */
+    NU_USER_MODE();
+
+    return (status);
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       DVC_Dev_Fast_IO_Write
+*
+*   DESCRIPTION
+*
+*       This function calls the driver's write function through a fast
+*       I/O descriptor.  The call is counted as an active session command,
+*       so DVC_Dev_Close waits for it to complete.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       DVC_Fast_IO_Enter
+*       DVC_Fast_IO_Exit
+*       Low Level Driver Write
+*
+*   INPUTS
+*
+*       *fast_io_ptr                        Bound fast I/O descriptor
+*       *buffer_ptr                         Memory address to start reading from
+*       numbyte                             The size in bytes of the buffer
+*       byte_offset                         Number of bytes to offset from 0
+*       *bytes_written_ptr                  Pointer to where we return the number of
+*                                           bytes written
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS
+*           DV_INVALID_INPUT_PARAMS
+*           DV_SESSION_NOT_OPEN
+*           Driver's WRITE function returned error status
+*
+*************************************************************************/
+STATUS DVC_Dev_Fast_IO_Write (DV_DEV_FAST_IO *fast_io_ptr, VOID *buffer_ptr, UINT32 numbyte,
+                              OFFSET_T byte_offset, UINT32 *bytes_written_ptr)
+{
+    DV_DEV_FAST_IO          call;
+    UINT32                  bytes_w = 0;
+    STATUS                  status;
+
+    NU_SUPERV_USER_VARIABLES
+
+    /* Switch to Supervisor mode */
+    NU_SUPERVISOR_MODE();
+
+    /* Count the call as an active command of the session */
+    status = DVC_Fast_IO_Enter(fast_io_ptr, &call);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Call the driver's write function code */
+        status = (*call.write_ptr)(call.session_handle, buffer_ptr,
+                                   numbyte, byte_offset, &bytes_w);
+
+        /* If we have a place to return the number of bytes written */
+        if (bytes_written_ptr != NU_NULL)
+        {
+            /* Return the number of bytes written */
+            *bytes_written_ptr = bytes_w;
+        }
+
+        /* End the session command */
+        DVC_Fast_IO_Exit(call.dev_handle);
+    }
+
+    /* Return to user mode */
+    NU_USER_MODE();
+
+    return (status);
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       DVC_Dev_Fast_IO_Ioctl
+*
+*   DESCRIPTION
+*
+*       This function calls the driver's IOCTL function through a fast
+*       I/O descriptor.  The call is counted as an active session command,
+*       so DVC_Dev_Close waits for it to complete.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       DVC_Fast_IO_Enter
+*       DVC_Fast_IO_Exit
+*       Low Level Driver IOCTL
+*
+*   INPUTS
+*
+*       *fast_io_ptr                        Bound fast I/O descriptor
+*       ioctl_num                           IOCTL number
+*       *ioctl_data                         IOCTL data pointer
+*       ioctl_data_len                      IOCTL data length
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS
+*           DV_INVALID_INPUT_PARAMS
+*           DV_SESSION_NOT_OPEN
+*           Driver's IOCTL function returned error status
+*
+*************************************************************************/
+STATUS DVC_Dev_Fast_IO_Ioctl (DV_DEV_FAST_IO *fast_io_ptr, INT ioctl_num,
+                              VOID* ioctl_data, INT ioctl_data_len)
+{
+    DV_DEV_FAST_IO          call;
+    STATUS                  status;
+
+    NU_SUPERV_USER_VARIABLES
+
+    /* Switch to Supervisor mode */
+    NU_SUPERVISOR_MODE();
+
+    /* Count the call as an active command of the session */
+    status = DVC_Fast_IO_Enter(fast_io_ptr, &call);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Call the driver's IOCTL function code */
+        status = (*call.ioctl_ptr)(call.session_handle,
+                                   ioctl_num, ioctl_data, ioctl_data_len);
+
+        /* End the session command */
+        DVC_Fast_IO_Exit(call.dev_handle);
+    }
+
+    /* Return to user mode */
+    NU_USER_MODE();
+
+    return (status);
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       DVC_Fast_IO_Find
+*
+*   DESCRIPTION
+*
+*       This function returns the link that points to a fast I/O
+*       descriptor in the descriptor list of the session it was last
+*       bound to, or NU_NULL if the descriptor is not on that list.  The
+*       caller must hold the schedule lock.
+*
+*   CALLED BY
+*
+*       DVC_Dev_Fast_IO_Bind
+*       DVC_Dev_Fast_IO_Unbind
+*
+*   CALLS
+*
+*       None
+*
+*   INPUTS
+*
+*       *fast_io_ptr                        Descriptor to find
+*
+*   OUTPUTS
+*
+*       Link to the descriptor or NU_NULL
+*
+*************************************************************************/
+static DV_DEV_FAST_IO **DVC_Fast_IO_Find (DV_DEV_FAST_IO *fast_io_ptr)
+{
+    DV_DEV_FAST_IO          **link_ptr = NU_NULL;
+    INT32                   reg_index, session_index;
+
+    /* Get the session and device registry index of the descriptor */
+    session_index = DV_GET_SES_INDEX(fast_io_ptr->dev_handle);
+    reg_index = DV_GET_REG_INDEX(DV_GET_DEV_ID(fast_io_ptr->dev_handle));
+
+    /* If the descriptor may be linked to a session */
+    if (((reg_index >= (DV_DEV_ID)0) && (reg_index < DVD_Max_Dev_Id_Cnt)) &&
+        ((session_index >= 0) && (session_index < DV_MAX_DEV_SESSION_CNT)))
+    {
+        /* Search the session's list for the descriptor */
+        link_ptr = &DVD_Dev_Registry[reg_index].session[session_index].fast_io_list;
+        while ((*link_ptr != NU_NULL) && (*link_ptr != fast_io_ptr))
+        {
+            link_ptr = &(*link_ptr)->next;
+        }
+
+        /* If the descriptor was not found */
+        if (*link_ptr == NU_NULL)
+        {
+            link_ptr = NU_NULL;
+        }
+    }
+
+    return (link_ptr);
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       DVC_Fast_IO_Enter
+*
+*   DESCRIPTION
+*
+*       This function copies a bound fast I/O descriptor and counts the
+*       call as an active command of its session.  Both are done under
+*       the schedule lock, so a close either invalidates the descriptor
+*       before the call starts or waits for the call to complete.
+*
+*   CALLED BY
+*
+*       DVC_Dev_Fast_IO_Read
+*       DVC_Dev_Fast_IO_Write
+*       DVC_Dev_Fast_IO_Ioctl
+*
+*   CALLS
+*
+*       TCCT_Schedule_Lock
+*       TCCT_Schedule_Unlock
+*
+*   INPUTS
+*
+*       *fast_io_ptr                        Descriptor used for the call
+*       *call_ptr                           Where to copy the descriptor
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS
+*           DV_INVALID_INPUT_PARAMS
+*           DV_SESSION_NOT_OPEN             Descriptor was never bound,
+*                                           was unbound or its session
+*                                           was closed
+*
+*************************************************************************/
+static STATUS DVC_Fast_IO_Enter (DV_DEV_FAST_IO *fast_io_ptr, DV_DEV_FAST_IO *call_ptr)
+{
+    INT32                   reg_index, session_index;
+    STATUS                  status = NU_SUCCESS;
+
+#if (DV_ERR_CHECK_ENABLE == NU_TRUE)
+    /* Check the input parameters */
+    if (fast_io_ptr == NU_NULL)
+    {
+        /* Invalid input parameters */
+        status = DV_INVALID_INPUT_PARAMS;
+    }
+    else
+#endif
+    {
+        /* Protect against access to the registry.  */
+        TCCT_Schedule_Lock();
+
+        /* If the descriptor is not bound to an open session */
+        if (fast_io_ptr->ioctl_ptr == NU_NULL)
+        {
+            /* Can't send a command to a session that is not open */
+            status = DV_SESSION_NOT_OPEN;
+        }
+        else
+        {
+            /* Copy the session handle and driver functions for the call */
+            *call_ptr = *fast_io_ptr;
+
+            /* Get the session and device registry index of the descriptor */
+            session_index = DV_GET_SES_INDEX(fast_io_ptr->dev_handle);
+            reg_index = DV_GET_REG_INDEX(DV_GET_DEV_ID(fast_io_ptr->dev_handle));
+
+            /* Increment the session's command count */
+            DVD_Dev_Registry[reg_index].session[session_index].active_cmds_cnt++;
+        }
+
+        /* Release protection against access to the registry.  */
+        TCCT_Schedule_Unlock();
+    }
+
+    return (status);
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       DVC_Fast_IO_Exit
+*
+*   DESCRIPTION
+*
+*       This function ends a session command started by
+*       DVC_Fast_IO_Enter and wakes a pending close when it was the last
+*       command of the session.
+*
+*   CALLED BY
+*
+*       DVC_Dev_Fast_IO_Read
+*       DVC_Dev_Fast_IO_Write
+*       DVC_Dev_Fast_IO_Ioctl
+*
+*   CALLS
+*
+*       TCCT_Schedule_Lock
+*       TCCT_Schedule_Unlock
+*       NU_Set_Events
+*
+*   INPUTS
+*
+*       dev_handle                          Device handle of the session
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+static VOID DVC_Fast_IO_Exit (DV_DEV_HANDLE dev_handle)
+{
+    INT32                   reg_index, session_index;
+    BOOLEAN                 close_pending;
+
+    /* Get the session and device registry index */
+    session_index = DV_GET_SES_INDEX(dev_handle);
+    reg_index = DV_GET_REG_INDEX(DV_GET_DEV_ID(dev_handle));
+
+    /* Protect against access to the registry.  */
+    TCCT_Schedule_Lock();
+
+    /* Decrement the session's command count */
+    DVD_Dev_Registry[reg_index].session[session_index].active_cmds_cnt--;
+
+    /* Determine if there is a close session command pending */
+    close_pending = ((DVD_Dev_Registry[reg_index].session[session_index].state_flag == DV_SES_LOCKED) &&
+                     (DVD_Dev_Registry[reg_index].session[session_index].active_cmds_cnt == 0));
+
+    /* Release protection against access to the registry.  */
+    TCCT_Schedule_Unlock();
+
+    if (close_pending == NU_TRUE)
+    {
+        /* Set the event flag bit signifying no active session commands */
+        (VOID)NU_Set_Events(
+                &DVD_Dev_Registry[reg_index].active_cmds_event,
+                (1 << session_index), (OPTION)NU_OR);
+    }
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       DVC_Fast_IO_Invalidate
+*
+*   DESCRIPTION
+*
+*       This function clears the driver functions of all fast I/O
+*       descriptors bound to a session and unlinks them, so later calls
+*       through them return DV_SESSION_NOT_OPEN.  The caller must hold
+*       the schedule lock.
+*
+*   CALLED BY
+*
+*       DVC_Dev_Unregister
+*       DVC_Dev_Close
+*
+*   CALLS
+*
+*       None
+*
+*   INPUTS
+*
+*       reg_index                           Device registry index
+*       session_index                       Session index
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+static VOID DVC_Fast_IO_Invalidate (INT32 reg_index, INT32 session_index)
+{
+    DV_DEV_FAST_IO          *fast_io_ptr;
+    DV_DEV_FAST_IO          *next_ptr;
+
+    fast_io_ptr = DVD_Dev_Registry[reg_index].session[session_index].fast_io_list;
+    DVD_Dev_Registry[reg_index].session[session_index].fast_io_list = NU_NULL;
+
+    while (fast_io_ptr != NU_NULL)
+    {
+        next_ptr = fast_io_ptr->next;
+
+        fast_io_ptr->session_handle = NU_NULL;
+        fast_io_ptr->read_ptr = NU_NULL;
+        fast_io_ptr->write_ptr = NU_NULL;
+        fast_io_ptr->ioctl_ptr = NU_NULL;
+        fast_io_ptr->next = NU_NULL;
+
+        fast_io_ptr = next_ptr;
+    }
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       DVC_Fast_IO_No_Read
+*       DVC_Fast_IO_No_Write
+*
+*   DESCRIPTION
+*
+*       These functions are called through a fast I/O descriptor of a
+*       device without a read or write function.  They do nothing.
+*
+*   CALLED BY
+*
+*       DVC_Dev_Fast_IO_Read
+*       DVC_Dev_Fast_IO_Write
+*
+*   CALLS
+*
+*       None
+*
+*   INPUTS
+*
+*       Same as the driver read and write functions
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS
+*
+*************************************************************************/
+static STATUS DVC_Fast_IO_No_Read (VOID* session_handle, VOID *buffer, UINT32 numbyte,
+                                   OFFSET_T byte_offset, UINT32 *bytes_read_ptr)
+{
+    NU_UNUSED_PARAM(session_handle);
+    NU_UNUSED_PARAM(buffer);
+    NU_UNUSED_PARAM(numbyte);
+    NU_UNUSED_PARAM(byte_offset);
+    NU_UNUSED_PARAM(bytes_read_ptr);
+
+    return (NU_SUCCESS);
+}
+
+static STATUS DVC_Fast_IO_No_Write (VOID* session_handle, const VOID *buffer, UINT32 numbyte,
+                                    OFFSET_T byte_offset, UINT32 *bytes_written_ptr)
+{
+    NU_UNUSED_PARAM(session_handle);
+    NU_UNUSED_PARAM(buffer);
+    NU_UNUSED_PARAM(numbyte);
+    NU_UNUSED_PARAM(byte_offset);
+    NU_UNUSED_PARAM(bytes_written_ptr);
+
+    return (NU_SUCCESS);
+}
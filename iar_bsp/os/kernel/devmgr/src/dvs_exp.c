@@ -46,5 +46,10 @@ NU_EXPORT_SYMBOL (DVC_Dev_Close);
 NU_EXPORT_SYMBOL (DVC_Dev_ID_Open);
 NU_EXPORT_SYMBOL (DVC_Dev_ID_Get);
 NU_EXPORT_SYMBOL (DVC_Dev_Ioctl);
+NU_EXPORT_SYMBOL (DVC_Dev_Fast_IO_Bind);
+NU_EXPORT_SYMBOL (DVC_Dev_Fast_IO_Unbind);
+NU_EXPORT_SYMBOL (DVC_Dev_Fast_IO_Read);
+NU_EXPORT_SYMBOL (DVC_Dev_Fast_IO_Write);
+NU_EXPORT_SYMBOL (DVC_Dev_Fast_IO_Ioctl);
 
 #endif /* CFG_NU_OS_KERN_DEVMGR_EXPORT_SYMBOLS == NU_TRUE */
@@ -110,6 +110,8 @@ STATUS  NU_EQM_Create(EQM_EVENT_QUEUE *event_queue_ptr,
 {
     STATUS              status = NU_SUCCESS;
     int                 i;
+    UINT32              block_count;
+    UINT32              buffer_size;
 
     /* Check the input parameters. */
     if (event_queue_ptr == NU_NULL || memory_pool_ptr == NU_NULL ||
@@ -119,21 +121,33 @@ STATUS  NU_EQM_Create(EQM_EVENT_QUEUE *event_queue_ptr,
     }
     else
     {
-        /* Do a single allocation for for eqm event nodes and the data buffers. */
+        /* Number of blocks summarizing the event types in the queue. */
+        block_count = (queue_size + EQM_EVENT_BLOCK_SIZE - 1) / EQM_EVENT_BLOCK_SIZE;
+
+        /* Size of the eqm event nodes, the event type blocks and the data
+           buffers. */
+        buffer_size = (sizeof(EQM_EVENT_NODE) * queue_size) +
+                      (sizeof(EQM_EVENT_BLOCK) * block_count) +
+                      (max_event_data_size * queue_size);
+
+        /* Do a single allocation for for eqm event nodes, the event type
+           blocks and the data buffers. */
         status = NU_Allocate_Memory(memory_pool_ptr,
                     (VOID**)&(event_queue_ptr->eqm_event_data_buffer),
-                    ((sizeof(EQM_EVENT_NODE) + max_event_data_size) * queue_size),
-                    NU_NO_SUSPEND);
+                    buffer_size, NU_NO_SUSPEND);
 
         if (status == NU_SUCCESS)
         {                        
             /* Initialize the event data buffer with '0'. */
-            (VOID)memset(event_queue_ptr->eqm_event_data_buffer,
-                         0, ((sizeof(EQM_EVENT_NODE) + max_event_data_size) * queue_size));
+            (VOID)memset(event_queue_ptr->eqm_event_data_buffer, 0, buffer_size);
+
+            /* The event type blocks follow the eqm event nodes. */
+            event_queue_ptr->eqm_event_blocks =
+                    (EQM_EVENT_BLOCK*)&(event_queue_ptr->eqm_event_data_buffer[queue_size]);
 
             /* Setup the pointer for eqm event data. */
             event_queue_ptr->eqm_event_data_buffer[0].eqm_event_data = 
-                    (UINT8*)(((UINT32)event_queue_ptr->eqm_event_data_buffer) + (queue_size * sizeof(EQM_EVENT_NODE)));
+                    (UINT8*)&(event_queue_ptr->eqm_event_blocks[block_count]);
                     
 
             /* Assign the memory allocated for event queue data
@@ -173,6 +187,10 @@ STATUS  NU_EQM_Create(EQM_EVENT_QUEUE *event_queue_ptr,
             /* Save the maximum data size that may be send with an event
                in the queue */  
             event_queue_ptr->eqm_max_event_data_size = max_event_data_size;
+
+            /* No event of any type has been posted yet. */
+            (VOID)memset(event_queue_ptr->eqm_latest_event_id, 0,
+                         sizeof(event_queue_ptr->eqm_latest_event_id));
         }
     }
 
@@ -290,7 +308,10 @@ STATUS  NU_EQM_Post_Event(EQM_EVENT_QUEUE *event_queue_ptr,
                           EQM_EVENT *event_ptr, UINT16 event_data_size,
                           EQM_EVENT_ID *posted_event_id_ptr)
 {
-    STATUS status = NU_SUCCESS;
+    STATUS              status = NU_SUCCESS;
+    EQM_EVENT_BLOCK     *block_ptr;
+    UINT32              event_type;
+    UINT32              bit;
 
     /* Check the input parameters. */
     if (event_queue_ptr == NU_NULL || event_ptr == NU_NULL)
@@ -327,6 +348,31 @@ STATUS  NU_EQM_Post_Event(EQM_EVENT_QUEUE *event_queue_ptr,
             event_queue_ptr->eqm_event_data_buffer[event_queue_ptr->eqm_buffer_index].eqm_event_data,
             event_ptr, (size_t)event_data_size);
 
+        /* Add the event type to the summary of its block. The first entry
+           of a block starts a new pass of the buffer index over it. */
+        block_ptr = &(event_queue_ptr->eqm_event_blocks[event_queue_ptr->eqm_buffer_index /
+                                                        EQM_EVENT_BLOCK_SIZE]);
+        if ((event_queue_ptr->eqm_buffer_index & (EQM_EVENT_BLOCK_SIZE - 1)) == 0)
+        {
+            block_ptr->eqm_previous_types = block_ptr->eqm_current_types;
+            block_ptr->eqm_current_types = event_ptr->eqm_event_type;
+        }
+        else
+        {
+            block_ptr->eqm_current_types |= event_ptr->eqm_event_type;
+        }
+
+        /* This is now the latest event for each bit of its type. */
+        event_type = event_ptr->eqm_event_type;
+        for (bit = 0; event_type != 0; bit++, event_type >>= 1)
+        {
+            if (event_type & 1)
+            {
+                event_queue_ptr->eqm_latest_event_id[bit] =
+                                        event_queue_ptr->eqm_current_event_id;
+            }
+        }
+
         /* Increment the event queue buffer index. */
         event_queue_ptr->eqm_buffer_index++;
         /* Check for array wraparound */
@@ -721,7 +767,9 @@ static STATUS   eqm_wait_event(EQM_EVENT_QUEUE *event_queue_ptr,
 *
 *       This function searches the buffer for event of relevant type.It
 *       returns the event type, ID and handle of the first relevant event
-*       after the specified index.
+*       after the specified index. The search returns at once if no event
+*       of the requested types was posted after the event at the index,
+*       and skips blocks of the buffer without an event of those types.
 *
 * CALLED BY
 *
@@ -775,9 +823,15 @@ static STATUS   eqm_search_buffer(EQM_EVENT_QUEUE *event_queue_ptr,
                                 EQM_EVENT_ID *recvd_event_id_ptr,
                                 EQM_EVENT_HANDLE *recvd_event_handle_ptr)
 {
-    STATUS  status = NU_NOT_PRESENT;
-    UINT32  iterator = 0;
-    UINT8   search_all_buffer_flag = 0;
+    STATUS              status = NU_NOT_PRESENT;
+    UINT32              iterator = 0;
+    UINT8               search_all_buffer_flag = 0;
+    UINT8               posted_flag = 0;
+    EQM_EVENT_ID        from_id;
+    EQM_EVENT_BLOCK     *block_ptr;
+    UINT32              block_end;
+    UINT32              event_type;
+    UINT32              bit;
 
     /* If the start index for the searching is a reserved value of
        max events we will perform the complete search in the queue. */
@@ -787,6 +841,8 @@ static STATUS   eqm_search_buffer(EQM_EVENT_QUEUE *event_queue_ptr,
         iterator = event_queue_ptr->eqm_buffer_index;
         /* Set the flag to search the oldest element in this case. */
         search_all_buffer_flag = 1;
+        /* Search even if no event was posted after an ID. */
+        posted_flag = 1;
     }
 
     else
@@ -798,13 +854,59 @@ static STATUS   eqm_search_buffer(EQM_EVENT_QUEUE *event_queue_ptr,
         {
             iterator = 0;
         }
+
+        /* Determine if an event of the requested types was posted after
+           the event at the specified index. */
+        from_id = event_queue_ptr->eqm_event_data_buffer[from_handle].eqm_event_id;
+        event_type = requested_events;
+        for (bit = 0; event_type != 0 && posted_flag == 0; bit++, event_type >>= 1)
+        {
+            if ((event_type & 1) &&
+                (event_queue_ptr->eqm_latest_event_id[bit] != 0) &&
+                ((INT32)(event_queue_ptr->eqm_latest_event_id[bit] - from_id) > 0))
+            {
+                posted_flag = 1;
+            }
+        }
     }
 
     /* Search while match is not found. */
-    while (iterator != event_queue_ptr->eqm_buffer_index || search_all_buffer_flag == 1)
+    while (posted_flag == 1 &&
+           (iterator != event_queue_ptr->eqm_buffer_index || search_all_buffer_flag == 1))
     {
+        /* At the start of a block check whether any entry of the block may
+           match the requested event mask. */
+        block_ptr = &(event_queue_ptr->eqm_event_blocks[iterator / EQM_EVENT_BLOCK_SIZE]);
+        if (((iterator & (EQM_EVENT_BLOCK_SIZE - 1)) == 0) &&
+            ((requested_events & (block_ptr->eqm_current_types |
+                                  block_ptr->eqm_previous_types)) == 0))
+        {
+            block_end = iterator + EQM_EVENT_BLOCK_SIZE;
+            if (block_end > event_queue_ptr->eqm_max_events)
+            {
+                block_end = event_queue_ptr->eqm_max_events;
+            }
+
+            /* Stop if the search ends inside the block. */
+            if (event_queue_ptr->eqm_buffer_index > iterator &&
+                event_queue_ptr->eqm_buffer_index < block_end)
+            {
+                break;
+            }
+
+            /* Clear the search flag. */
+            search_all_buffer_flag = 0;
+            /* Move the iterator to the next block in event queue. */
+            iterator = block_end;
+            /* Check for iterator wraparound. */
+            if (iterator == event_queue_ptr->eqm_max_events)
+            {
+                iterator = 0;
+            }
+        }
+
         /* Check if the event at the index matches the requested event mask. */
-        if ((requested_events &
+        else if ((requested_events &
         (*((EQM_EVENT*)(event_queue_ptr->eqm_event_data_buffer[iterator].eqm_event_data))).eqm_event_type) != 0)
         {
             /* Copy the event type to the parameter. */
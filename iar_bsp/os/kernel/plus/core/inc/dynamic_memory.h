@@ -93,11 +93,57 @@ typedef struct DM_SUSPEND_STRUCT
                                                   used by NU_Allocate_Aligned_Memory */
 } DM_SUSPEND;
 
+#if (NU_TLSF_POOLS == NU_TRUE)
+
+/* Define the Two-Level Segregated Fit free lists.  A free block is kept
+   on the list of its first level (the power of two below its size) and
+   second level (one of DM_TLSF_SL_COUNT linear subdivisions of the first
+   level).  Blocks smaller than DM_TLSF_SMALL_SIZE share the first level
+   list 0.  A bit is set in the bitmaps for each non-empty list so a
+   suitable list is found without searching.  */
+
+#define         DM_TLSF_SL_LOG2        3
+#define         DM_TLSF_SL_COUNT       (1 << DM_TLSF_SL_LOG2)
+#define         DM_TLSF_FL_SHIFT       (DM_TLSF_SL_LOG2 + 2)
+#define         DM_TLSF_SMALL_SIZE     (1UL << DM_TLSF_FL_SHIFT)
+#define         DM_TLSF_FL_COUNT       ((sizeof(UNSIGNED) * 8) - DM_TLSF_FL_SHIFT + 1)
+
+typedef struct DM_TLSF_STRUCT
+{
+    UNSIGNED            dm_fl_bitmap;          /* Non-empty first levels */
+    UNSIGNED            dm_sl_bitmap[DM_TLSF_FL_COUNT];
+                                               /* Non-empty second levels*/
+    DM_HEADER          *dm_free_lists[DM_TLSF_FL_COUNT][DM_TLSF_SL_COUNT];
+                                               /* Free block lists       */
+} DM_TLSF;
+
+/* The free lists are placed at the start of the pool memory.  */
+
+#define         DM_TLSF_OVERHEAD       (DM_ADJUSTED_SIZE(sizeof(DM_TLSF)))
+
+/* Pointer to the first block of the initial memory of a pool.  */
+
+#define         DM_FIRST_BLOCK(pool)                                        \
+    ((DM_HEADER *)(((BYTE_PTR)((pool) -> dm_start_address)) +               \
+                   (((pool) -> dm_tlsf != NU_NULL) ? DM_TLSF_OVERHEAD : 0)))
+
+#else
+
+#define         DM_FIRST_BLOCK(pool)   ((DM_HEADER *)((pool) -> dm_start_address))
+
+#endif  /* NU_TLSF_POOLS == NU_TRUE */
+
 /* Internal functions */
 DM_HEADER *DMC_Allocate(NU_MEMORY_POOL *pool_ptr, UNSIGNED size, UNSIGNED alignment);
-DM_HEADER *DMC_Split_Block(NU_MEMORY_POOL *pool_ptr, DM_HEADER *memory_ptr, 
+DM_HEADER *DMC_Split_Block(NU_MEMORY_POOL *pool_ptr, DM_HEADER *memory_ptr,
                            UNSIGNED size, BOOLEAN overhead_calculate);
 
+#if (NU_TLSF_POOLS == NU_TRUE)
+DM_HEADER *DMC_TLSF_Add_Block(DM_PCB *pool, VOID *start_address, UNSIGNED size);
+DM_HEADER *DMC_TLSF_Allocate(DM_PCB *pool, UNSIGNED size, UNSIGNED alignment);
+VOID       DMC_TLSF_Deallocate(DM_PCB *pool, DM_HEADER *header_ptr);
+#endif
+
 #ifdef          __cplusplus
 
 /* End of C declarations */
@@ -0,0 +1,64 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   DESCRIPTION
+*
+*       This file contains data structure definitions and constants for
+*       the Mutex component.
+*
+***********************************************************************/
+
+/* Check to see if the file has been included already.  */
+
+#ifndef MUTEX_H
+#define MUTEX_H
+
+#ifdef          __cplusplus
+
+/* C declarations in C++     */
+extern          "C" {
+
+#endif
+
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+
+/* Define constants local to this component.  */
+
+#define         MX_MUTEX_ID             0x4d555458UL
+
+/* Define the mutex suspension structure.  This structure is allocated
+   off of the caller's stack.  Waiting tasks are kept in priority
+   order.  */
+
+typedef struct MX_SUSPEND_STRUCT
+{
+    CS_NODE             mx_suspend_link;       /* Link to suspend blocks */
+    MX_MCB             *mx_mutex;              /* Pointer to the mutex   */
+    TC_TCB             *mx_suspended_task;     /* Task suspended         */
+    STATUS              mx_return_status;      /* Return status          */
+} MX_SUSPEND;
+
+/* Internal functions */
+VOID    MXC_Cleanup(VOID *information);
+VOID    MXC_Kill_Mutex_Owner(NU_MUTEX *mutex_ptr, NU_TASK *owning_task);
+
+#endif  /* NU_CEILING_MUTEXES == NU_TRUE */
+
+#ifdef          __cplusplus
+
+/* End of C declarations */
+}
+
+#endif  /* __cplusplus */
+
+#endif
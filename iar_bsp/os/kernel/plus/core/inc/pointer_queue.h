@@ -0,0 +1,65 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   DESCRIPTION
+*
+*       This file contains data structure definitions and constants for
+*       the Pointer Queue component.
+*
+***********************************************************************/
+
+/* Check to see if the file has been included already.  */
+
+#ifndef POINTER_QUEUE_H
+#define POINTER_QUEUE_H
+
+#ifdef          __cplusplus
+
+/* C declarations in C++     */
+extern          "C" {
+
+#endif
+
+#if (NU_POINTER_QUEUES == NU_TRUE)
+
+/* Define constants local to this component.  */
+
+#define         PQ_POINTER_QUEUE_ID     0x50545251UL
+
+/* Define the pointer queue suspension structure.  This structure is
+   allocated off of the caller's stack.  A suspended sender holds the
+   pointer it is sending and a suspended receiver is handed the pointer
+   directly by the sender.  */
+
+typedef struct PQ_SUSPEND_STRUCT
+{
+    CS_NODE             pq_suspend_link;       /* Link to suspend blocks */
+    PQ_PQCB            *pq_queue;              /* Pointer to the queue   */
+    TC_TCB             *pq_suspended_task;     /* Task suspended         */
+    VOID               *pq_message;            /* Pointer sent/received  */
+    STATUS              pq_return_status;      /* Return status          */
+} PQ_SUSPEND;
+
+/* Internal functions */
+VOID    PQC_Cleanup(VOID *information);
+
+#endif  /* NU_POINTER_QUEUES == NU_TRUE */
+
+#ifdef          __cplusplus
+
+/* End of C declarations */
+}
+
+#endif  /* __cplusplus */
+
+#endif
@@ -0,0 +1,48 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   DESCRIPTION
+*
+*       This file contains data structure definitions and constants for
+*       the Ring component.
+*
+***********************************************************************/
+
+/* Check to see if the file has been included already.  */
+
+#ifndef RING_H
+#define RING_H
+
+#ifdef          __cplusplus
+
+/* C declarations in C++     */
+extern          "C" {
+
+#endif
+
+#if (NU_SPSC_RINGS == NU_TRUE)
+
+/* Define constants local to this component.  */
+
+#define         RG_RING_ID              0x52494e47UL
+
+#endif  /* NU_SPSC_RINGS == NU_TRUE */
+
+#ifdef          __cplusplus
+
+/* End of C declarations */
+}
+
+#endif  /* __cplusplus */
+
+#endif
@@ -170,6 +170,102 @@ VOID            TCCT_Set_Execute_Task(TC_TCB *task);
 #define         TCC_CURRENT_HISR_PTR                                            \
                     ((TC_HCB *)TCD_Current_Thread)
 
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+
+/* CPU usage accounting.  Cycles are charged at each accounting point to
+   whatever ran since the previous one: the current thread, a LISR or, if
+   no thread was executing, idle.  All accounting points run with
+   interrupts disabled. */
+
+extern UINT32           TCD_CPU_Stamp;
+extern UINT32           TCD_CPU_Slice_Start;
+extern UINT64           TCD_CPU_Idle_Cycles;
+extern UINT64           TCD_CPU_LISR_Cycles;
+
+/* Threads are timed with the processor cycle counter where the
+   architecture provides one. */
+#ifdef ESAL_AR_CYCLE_COUNT_READ
+#define         TCC_CPU_CYCLES()            ESAL_AR_CYCLE_COUNT_READ()
+#else
+#define         TCC_CPU_CYCLES()            ((UINT32)NU_Get_Time_Stamp())
+#endif
+
+/* Get the CPU usage of a task or HISR */
+#define         TCC_CPU_USAGE(thread)                                           \
+                    ((((TC_TCB *)(thread)) -> tc_id == TC_TASK_ID) ?            \
+                     &(((TC_TCB *)(thread)) -> tc_cpu_usage) :                  \
+                     &(((TC_HCB *)(thread)) -> tc_cpu_usage))
+
+/* Charge the cycles since the last accounting point to a thread, or to
+   idle if the thread is NU_NULL */
+#define         TCC_CPU_USAGE_CHARGE(thread, now)                               \
+                {                                                               \
+                    if (thread)                                                 \
+                    {                                                           \
+                        TCC_CPU_USAGE(thread) -> tc_cpu_cycles +=               \
+                                                    (now) - TCD_CPU_Stamp;      \
+                    }                                                           \
+                    else                                                        \
+                    {                                                           \
+                        TCD_CPU_Idle_Cycles += (now) - TCD_CPU_Stamp;           \
+                    }                                                           \
+                    TCD_CPU_Stamp = (now);                                      \
+                }
+
+/* A thread gives up the processor - charge it and record its run slice */
+#define         TCC_CPU_USAGE_SWITCH_OUT(thread)                                \
+                {                                                               \
+                    UINT32  tcc_now = TCC_CPU_CYCLES();                         \
+                                                                                \
+                    TCC_CPU_USAGE_CHARGE(thread, tcc_now);                      \
+                                                                                \
+                    if ((thread) &&                                             \
+                        ((tcc_now - TCD_CPU_Slice_Start) >                      \
+                         TCC_CPU_USAGE(thread) -> tc_cpu_max_slice))            \
+                    {                                                           \
+                        TCC_CPU_USAGE(thread) -> tc_cpu_max_slice =             \
+                                            tcc_now - TCD_CPU_Slice_Start;      \
+                    }                                                           \
+                }
+
+/* A thread is given the processor - the scheduler ran as idle time */
+#define         TCC_CPU_USAGE_SWITCH_IN(thread)                                 \
+                {                                                               \
+                    UINT32  tcc_now = TCC_CPU_CYCLES();                         \
+                                                                                \
+                    TCC_CPU_USAGE_CHARGE(NU_NULL, tcc_now);                     \
+                    TCD_CPU_Slice_Start = tcc_now;                              \
+                    TCC_CPU_USAGE(thread) -> tc_cpu_switches++;                 \
+                }
+
+/* A non-nested LISR starts - charge the interrupted thread or idle */
+#define         TCC_CPU_USAGE_LISR_ENTRY()                                      \
+                if (ESAL_GE_ISR_Executing == 1)                                 \
+                {                                                               \
+                    UINT32  tcc_now = TCC_CPU_CYCLES();                         \
+                                                                                \
+                    TCC_CPU_USAGE_CHARGE(TCD_Current_Thread, tcc_now);          \
+                }
+
+/* A non-nested LISR ends - charge the LISR, including nested LISRs */
+#define         TCC_CPU_USAGE_LISR_EXIT()                                       \
+                if (ESAL_GE_ISR_Executing == 1)                                 \
+                {                                                               \
+                    UINT32  tcc_now = TCC_CPU_CYCLES();                         \
+                                                                                \
+                    TCD_CPU_LISR_Cycles += tcc_now - TCD_CPU_Stamp;             \
+                    TCD_CPU_Stamp = tcc_now;                                    \
+                }
+
+#else
+
+#define         TCC_CPU_USAGE_SWITCH_OUT(thread)
+#define         TCC_CPU_USAGE_SWITCH_IN(thread)
+#define         TCC_CPU_USAGE_LISR_ENTRY()
+#define         TCC_CPU_USAGE_LISR_EXIT()
+
+#endif  /* NU_CPU_ACCOUNTING == NU_TRUE */
+
 /* Define interrupt locking / unlocking macros based on the interrupt locking
    method used */
 #if (NU_GLOBAL_INT_LOCKING == NU_TRUE)
@@ -65,6 +65,8 @@
 *
 *       [NU_Check_Stack]                    Stack checking function
 *                                           (conditionally compiled)
+*       [DMC_TLSF_Add_Block]                Add memory to a TLSF pool
+*                                           (conditionally compiled)
 *       TCCT_Schedule_Lock                  Data structure protect
 *       TCCT_Schedule_Unlock                Un-protect data structure
 *
@@ -129,41 +131,51 @@ STATUS NU_Add_Memory(NU_MEMORY_POOL *pool_ptr, VOID *memory_start_address, UNSIG
            control block.  */
         pool_ptr -> dm_pool_size += memory_size;
 
-        /* Initialize the memory parameters.  */
-        pool_ptr -> dm_available += (memory_size - (2 * DM_OVERHEAD));
-
-        /* Build the block header.  */
-        new_header_ptr -> dm_memory_pool = pool_ptr;
-        new_header_ptr -> dm_next_memory = (DM_HEADER *)
-               (((BYTE_PTR) new_header_ptr) + memory_size - DM_OVERHEAD);
-        new_header_ptr -> dm_previous_memory = new_header_ptr -> dm_next_memory;
-        new_header_ptr -> dm_memory_free = NU_TRUE;
-
-        /* Link this free block into the original free block list */
-        if (pool_ptr -> dm_memory_list == NU_NULL)
+#if (NU_TLSF_POOLS == NU_TRUE)
+        if (pool_ptr -> dm_tlsf != NU_NULL)
         {
-            new_header_ptr -> dm_next_free = new_header_ptr;
-            new_header_ptr -> dm_previous_free = new_header_ptr;
-            pool_ptr -> dm_memory_list = new_header_ptr;
+            /* Place the new memory on the free lists of the TLSF pool */
+            (VOID)DMC_TLSF_Add_Block(pool_ptr, memory_start_address, memory_size);
         }
         else
+#endif
         {
-            old_header_ptr = (DM_HEADER *) pool_ptr -> dm_memory_list;
-            new_header_ptr -> dm_next_free = old_header_ptr;
-            new_header_ptr -> dm_previous_free = old_header_ptr -> dm_previous_free;
-            old_header_ptr -> dm_previous_free -> dm_next_free = new_header_ptr;
-            old_header_ptr -> dm_previous_free = new_header_ptr;
+            /* Initialize the memory parameters.  */
+            pool_ptr -> dm_available += (memory_size - (2 * DM_OVERHEAD));
+
+            /* Build the block header.  */
+            new_header_ptr -> dm_memory_pool = pool_ptr;
+            new_header_ptr -> dm_next_memory = (DM_HEADER *)
+                   (((BYTE_PTR) new_header_ptr) + memory_size - DM_OVERHEAD);
+            new_header_ptr -> dm_previous_memory = new_header_ptr -> dm_next_memory;
+            new_header_ptr -> dm_memory_free = NU_TRUE;
+
+            /* Link this free block into the original free block list */
+            if (pool_ptr -> dm_memory_list == NU_NULL)
+            {
+                new_header_ptr -> dm_next_free = new_header_ptr;
+                new_header_ptr -> dm_previous_free = new_header_ptr;
+                pool_ptr -> dm_memory_list = new_header_ptr;
+            }
+            else
+            {
+                old_header_ptr = (DM_HEADER *) pool_ptr -> dm_memory_list;
+                new_header_ptr -> dm_next_free = old_header_ptr;
+                new_header_ptr -> dm_previous_free = old_header_ptr -> dm_previous_free;
+                old_header_ptr -> dm_previous_free -> dm_next_free = new_header_ptr;
+                old_header_ptr -> dm_previous_free = new_header_ptr;
+            }
+
+            /* Build the small trailer block that prevents block merging when the
+               pool wraps around.  Note that the list is circular so searching can
+               wrap across the physical end of the memory pool.  */
+            new_header_ptr =  new_header_ptr -> dm_next_memory;
+            new_header_ptr -> dm_next_memory = (DM_HEADER *) memory_start_address;
+            new_header_ptr -> dm_previous_memory = (DM_HEADER *) memory_start_address;
+            new_header_ptr -> dm_memory_free = NU_FALSE;
+            new_header_ptr -> dm_memory_pool = pool_ptr;
         }
 
-        /* Build the small trailer block that prevents block merging when the
-           pool wraps around.  Note that the list is circular so searching can
-           wrap across the physical end of the memory pool.  */
-        new_header_ptr =  new_header_ptr -> dm_next_memory;
-        new_header_ptr -> dm_next_memory = (DM_HEADER *) memory_start_address;
-        new_header_ptr -> dm_previous_memory = (DM_HEADER *) memory_start_address;
-        new_header_ptr -> dm_memory_free = NU_FALSE;
-        new_header_ptr -> dm_memory_pool = pool_ptr;
-
         /* Trace log */
         T_MEM_ADD((VOID*)pool_ptr, memory_start_address, ESAL_GET_RETURN_ADDRESS(0),
                   (pool_ptr->dm_pool_size), (pool_ptr->dm_available), memory_size, OBJ_ACTION_SUCCESS);
@@ -81,6 +81,8 @@ VOID    DMC_Cleanup(VOID *information);
 *       NU_Place_On_List                    Add node to linked-list
 *       [NU_Check_Stack]                    Stack checking function
 *                                           (conditionally compiled)
+*       [DMC_TLSF_Add_Block]                Build TLSF pool free block
+*                                           (conditionally compiled)
 *       TCCT_Schedule_Lock                  Data structure protect
 *       TCCT_Schedule_Unlock                Un-protect data structure
 *
@@ -92,7 +94,9 @@ VOID    DMC_Cleanup(VOID *information);
 *       start_address                       Starting address of the pool
 *       pool_size                           Number of bytes in the pool
 *       min_allocation                      Minimum allocation size
-*       suspend_type                        Suspension type
+*       suspend_type                        Suspension type, with
+*                                           NU_TLSF_POOL OR'd in for a
+*                                           TLSF pool
 *
 *   OUTPUTS
 *
@@ -117,11 +121,27 @@ STATUS NU_Create_Memory_Pool(NU_MEMORY_POOL *pool_ptr, CHAR *name,
     R1 DM_PCB       *pool;                  /* Pool control block ptr    */
     DM_HEADER       *header_ptr;            /* Dynamic mem block header ptr */
     STATUS           status = NU_SUCCESS;   /* Completion status         */
+    UNSIGNED         pool_overhead = 0;     /* Bytes used by free lists  */
+#if (NU_TLSF_POOLS == NU_TRUE)
+    BOOLEAN          tlsf_pool;             /* TLSF pool requested       */
+#endif
     NU_SUPERV_USER_VARIABLES
 
     /* Move input pool pointer into internal pointer.  */
     pool =  (DM_PCB *) pool_ptr;
 
+#if (NU_TLSF_POOLS == NU_TRUE)
+    /* Separate the pool type from the suspension type.  A TLSF pool keeps
+       its free lists at the start of the pool memory.  */
+    tlsf_pool = ((suspend_type & NU_TLSF_POOL) != 0);
+    suspend_type &= ~NU_TLSF_POOL;
+
+    if (tlsf_pool == NU_TRUE)
+    {
+        pool_overhead = DM_TLSF_OVERHEAD;
+    }
+#endif
+
     /* Adjust the minimum allocation size to something that is evenly
        divisible by the number of bytes in an UNSIGNED data type.  */
     min_allocation = DM_ADJUSTED_SIZE(min_allocation);
@@ -149,7 +169,7 @@ STATUS NU_Create_Memory_Pool(NU_MEMORY_POOL *pool_ptr, CHAR *name,
     NU_ERROR_CHECK((ESAL_GE_MEM_ALIGNED_CHECK(start_address, sizeof(UNSIGNED)) == NU_FALSE), status, NU_NOT_ALIGNED);
 
     /* Ensure the pool could accommodate at least one allocation. */
-    NU_ERROR_CHECK(((min_allocation == 0) || ((min_allocation + (2 * DM_OVERHEAD)) > pool_size)), status, NU_INVALID_SIZE);
+    NU_ERROR_CHECK(((min_allocation == 0) || ((min_allocation + (2 * DM_OVERHEAD) + pool_overhead) > pool_size)), status, NU_INVALID_SIZE);
 
     /* Check for invalid suspension type.  */
     NU_ERROR_CHECK(((suspend_type != NU_FIFO) && (suspend_type != NU_PRIORITY)), status, NU_INVALID_SUSPEND);
@@ -184,30 +204,50 @@ STATUS NU_Create_Memory_Pool(NU_MEMORY_POOL *pool_ptr, CHAR *name,
             pool -> dm_fifo_suspend =  NU_TRUE;
         }
 
-        /* Build a single block that has all of the memory.  */
-        header_ptr =  (DM_HEADER *) start_address;
-
-        /* Initialize the memory parameters.  */
-        pool -> dm_available =       pool_size - (2 * DM_OVERHEAD);
-        pool -> dm_memory_list =     header_ptr;
-
-        /* Build the block header.  */
-        header_ptr -> dm_memory_pool =  pool;
-        header_ptr -> dm_next_memory =  (DM_HEADER *)
-               (((BYTE_PTR) header_ptr) + pool -> dm_available + DM_OVERHEAD);
-        header_ptr -> dm_previous_memory =  header_ptr -> dm_next_memory;
-        header_ptr -> dm_memory_free =  NU_TRUE;
-        header_ptr -> dm_next_free = header_ptr;
-        header_ptr -> dm_previous_free = header_ptr;
-
-        /* Build the small trailer block that prevents block merging when the
-           pool wraps around.  Note that the list is circular so searching can
-           wrap across the physical end of the memory pool.  */
-        header_ptr =  header_ptr -> dm_next_memory;
-        header_ptr -> dm_next_memory =  (DM_HEADER *) start_address;
-        header_ptr -> dm_previous_memory =  (DM_HEADER *) start_address;
-        header_ptr -> dm_memory_free =  NU_FALSE;
-        header_ptr -> dm_memory_pool =  pool;
+#if (NU_TLSF_POOLS == NU_TRUE)
+        pool -> dm_tlsf = NU_NULL;
+
+        if (tlsf_pool == NU_TRUE)
+        {
+            /* Place the empty free lists at the start of the pool.  */
+            pool -> dm_tlsf = (DM_TLSF *) start_address;
+            memset(pool -> dm_tlsf, 0, sizeof(DM_TLSF));
+
+            /* Build a single free block that has the rest of the memory.  The
+               memory list of a TLSF pool is not searched, it only points to
+               the first block.  */
+            pool -> dm_memory_list = DMC_TLSF_Add_Block(pool,
+                                        ((BYTE_PTR) start_address) + pool_overhead,
+                                        pool_size - pool_overhead);
+        }
+        else
+#endif
+        {
+            /* Build a single block that has all of the memory.  */
+            header_ptr =  (DM_HEADER *) start_address;
+
+            /* Initialize the memory parameters.  */
+            pool -> dm_available =       pool_size - (2 * DM_OVERHEAD);
+            pool -> dm_memory_list =     header_ptr;
+
+            /* Build the block header.  */
+            header_ptr -> dm_memory_pool =  pool;
+            header_ptr -> dm_next_memory =  (DM_HEADER *)
+                   (((BYTE_PTR) header_ptr) + pool -> dm_available + DM_OVERHEAD);
+            header_ptr -> dm_previous_memory =  header_ptr -> dm_next_memory;
+            header_ptr -> dm_memory_free =  NU_TRUE;
+            header_ptr -> dm_next_free = header_ptr;
+            header_ptr -> dm_previous_free = header_ptr;
+
+            /* Build the small trailer block that prevents block merging when the
+               pool wraps around.  Note that the list is circular so searching can
+               wrap across the physical end of the memory pool.  */
+            header_ptr =  header_ptr -> dm_next_memory;
+            header_ptr -> dm_next_memory =  (DM_HEADER *) start_address;
+            header_ptr -> dm_previous_memory =  (DM_HEADER *) start_address;
+            header_ptr -> dm_memory_free =  NU_FALSE;
+            header_ptr -> dm_memory_pool =  pool;
+        }
 
         /* Protect against access to the list of created memory pools.  */
         TCCT_Schedule_Lock();
@@ -491,6 +531,8 @@ STATUS NU_Allocate_Aligned_Memory(NU_MEMORY_POOL *pool_ptr,
 *   CALLS
 *
 *       DMC_Split_Block
+*       [DMC_TLSF_Allocate]                 Allocate from a TLSF pool
+*                                           (conditionally compiled)
 *
 *   INPUTS
 *
@@ -513,6 +555,14 @@ DM_HEADER *DMC_Allocate(NU_MEMORY_POOL *pool_ptr, UNSIGNED size, UNSIGNED alignm
     UNSIGNED    next_aligned;               /* Next aligned block addr   */
     UNSIGNED    block_size = 0;
 
+#if (NU_TLSF_POOLS == NU_TRUE)
+    /* TLSF pools find a block on their segregated free lists */
+    if (pool_ptr -> dm_tlsf != NU_NULL)
+    {
+        return (DMC_TLSF_Allocate(pool_ptr, size, alignment));
+    }
+#endif
+
     /* Search the memory list for the first available block of memory that
        satisfies the request.  Note that blocks are merged and sorted during the
        deallocation function. */
@@ -239,7 +239,8 @@ STATUS NU_Deallocate_Memory(VOID *memory)
 *
 *   CALLS
 *
-*       None
+*       [DMC_TLSF_Deallocate]               Free TLSF pool memory
+*                                           (conditionally compiled)
 *
 *   INPUTS
 *
@@ -253,6 +254,15 @@ static VOID DMC_Deallocate(DM_PCB *pool, DM_HEADER *header_ptr)
     DM_HEADER *new_ptr;                     /* New memory block pointer  */
     BOOLEAN    in_free_list = NU_FALSE;
 
+#if (NU_TLSF_POOLS == NU_TRUE)
+    /* TLSF pools return the block to their segregated free lists */
+    if (pool -> dm_tlsf != NU_NULL)
+    {
+        DMC_TLSF_Deallocate(pool, header_ptr);
+        return;
+    }
+#endif
+
     /* Mark the memory as available.  */
     header_ptr -> dm_memory_free =  NU_TRUE;
 
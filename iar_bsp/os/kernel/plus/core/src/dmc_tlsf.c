@@ -0,0 +1,617 @@
+/***********************************************************************
+*
+*            Copyright 2011 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       dmc_tlsf.c
+*
+*   COMPONENT
+*
+*       DM - Dynamic Memory Management
+*
+*   DESCRIPTION
+*
+*       This file contains the Two-Level Segregated Fit routines for the
+*       Dynamic Memory Management component.  TLSF pools use the same
+*       block headers as first-fit pools, so blocks are split, merged
+*       and sized the same way, but their free blocks are kept on the
+*       segregated lists of the pool instead of a single list.  A free
+*       block that satisfies a request is found with two bitmap scans,
+*       and a freed block is merged with its free neighbors immediately,
+*       so neither operation walks a free list.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       DMC_TLSF_Msb                        Find most significant bit
+*       DMC_TLSF_Mapping                    Find list of a block size
+*       DMC_TLSF_Insert                     Place block on free list
+*       DMC_TLSF_Remove                     Remove block from free list
+*       DMC_TLSF_Split                      Split a block in two
+*       DMC_TLSF_Add_Block                  Add memory to a pool
+*       DMC_TLSF_Allocate                   Allocate a block
+*       DMC_TLSF_Deallocate                 Free a block
+*
+*   DEPENDENCIES
+*
+*       nucleus.h                           Nucleus System constants
+*       nu_kernel.h                         Kernel constants
+*       dynamic_memory.h                    Dynamic memory functions
+*
+***********************************************************************/
+#include        "nucleus.h"
+#include        "kernel/nu_kernel.h"
+#include        "os/kernel/plus/core/inc/dynamic_memory.h"
+
+#if (NU_TLSF_POOLS == NU_TRUE)
+
+/* Size of the data area of a block.  */
+#define DMC_TLSF_BLOCK_SIZE(block)                                      \
+    ((UNSIGNED)(((BYTE_PTR) ((block) -> dm_next_memory)) -              \
+                ((BYTE_PTR) (block))) - DM_OVERHEAD)
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       DMC_TLSF_Msb
+*
+*   DESCRIPTION
+*
+*       This function returns the index of the most significant bit
+*       that is set in a value.
+*
+*   CALLED BY
+*
+*       DMC_TLSF_Mapping
+*       DMC_TLSF_Allocate
+*
+*   CALLS
+*
+*       None
+*
+*   INPUTS
+*
+*       value                               Non-zero value
+*
+*   OUTPUTS
+*
+*       index                               Bit index
+*
+***********************************************************************/
+static UNSIGNED DMC_TLSF_Msb(UNSIGNED value)
+{
+    UNSIGNED    index = 0;
+    UNSIGNED    shift;
+
+    /* Halve the range that holds the bit until it is found */
+    for (shift = (sizeof(UNSIGNED) * 4); shift != 0; shift >>= 1)
+    {
+        if (value >> shift)
+        {
+            value >>= shift;
+            index += shift;
+        }
+    }
+
+    return (index);
+}
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       DMC_TLSF_Mapping
+*
+*   DESCRIPTION
+*
+*       This function returns the first and second level of the free
+*       list that holds blocks of a size.
+*
+*   CALLED BY
+*
+*       DMC_TLSF_Insert
+*       DMC_TLSF_Remove
+*       DMC_TLSF_Allocate
+*
+*   CALLS
+*
+*       DMC_TLSF_Msb
+*
+*   INPUTS
+*
+*       size                                Block size
+*       fl                                  First level return
+*       sl                                  Second level return
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+static VOID DMC_TLSF_Mapping(UNSIGNED size, UNSIGNED *fl, UNSIGNED *sl)
+{
+    UNSIGNED    msb;
+
+    if (size < DM_TLSF_SMALL_SIZE)
+    {
+        /* Small blocks are spread linearly over the first list */
+        *fl = 0;
+        *sl = size / (DM_TLSF_SMALL_SIZE / DM_TLSF_SL_COUNT);
+    }
+    else
+    {
+        msb = DMC_TLSF_Msb(size);
+
+        /* The bits below the most significant bit select the second
+           level */
+        *sl = (size >> (msb - DM_TLSF_SL_LOG2)) ^ DM_TLSF_SL_COUNT;
+        *fl = msb - (DM_TLSF_FL_SHIFT - 1);
+    }
+}
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       DMC_TLSF_Insert
+*
+*   DESCRIPTION
+*
+*       This function places a free block at the head of the free list
+*       for its size.
+*
+*   CALLED BY
+*
+*       DMC_TLSF_Add_Block
+*       DMC_TLSF_Allocate
+*       DMC_TLSF_Deallocate
+*
+*   CALLS
+*
+*       DMC_TLSF_Mapping
+*
+*   INPUTS
+*
+*       tlsf                                Pool free lists
+*       block                               Free block
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+static VOID DMC_TLSF_Insert(DM_TLSF *tlsf, DM_HEADER *block)
+{
+    DM_HEADER  *head;
+    UNSIGNED    fl;
+    UNSIGNED    sl;
+
+    DMC_TLSF_Mapping(DMC_TLSF_BLOCK_SIZE(block), &fl, &sl);
+
+    head = tlsf -> dm_free_lists[fl][sl];
+
+    /* The lists are circular, like the first-fit free list */
+    if (head == NU_NULL)
+    {
+        block -> dm_next_free = block;
+        block -> dm_previous_free = block;
+
+        /* Mark the list as non-empty */
+        tlsf -> dm_fl_bitmap |= (1UL << fl);
+        tlsf -> dm_sl_bitmap[fl] |= (1UL << sl);
+    }
+    else
+    {
+        block -> dm_next_free = head;
+        block -> dm_previous_free = head -> dm_previous_free;
+        (head -> dm_previous_free) -> dm_next_free = block;
+        head -> dm_previous_free = block;
+    }
+
+    tlsf -> dm_free_lists[fl][sl] = block;
+}
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       DMC_TLSF_Remove
+*
+*   DESCRIPTION
+*
+*       This function removes a free block from the free list for its
+*       size.
+*
+*   CALLED BY
+*
+*       DMC_TLSF_Allocate
+*       DMC_TLSF_Deallocate
+*
+*   CALLS
+*
+*       DMC_TLSF_Mapping
+*
+*   INPUTS
+*
+*       tlsf                                Pool free lists
+*       block                               Free block
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+static VOID DMC_TLSF_Remove(DM_TLSF *tlsf, DM_HEADER *block)
+{
+    UNSIGNED    fl;
+    UNSIGNED    sl;
+
+    DMC_TLSF_Mapping(DMC_TLSF_BLOCK_SIZE(block), &fl, &sl);
+
+    if (block -> dm_next_free == block)
+    {
+        /* The list is now empty, clear its bits */
+        tlsf -> dm_free_lists[fl][sl] = NU_NULL;
+
+        tlsf -> dm_sl_bitmap[fl] &= ~(1UL << sl);
+
+        if (tlsf -> dm_sl_bitmap[fl] == 0)
+        {
+            tlsf -> dm_fl_bitmap &= ~(1UL << fl);
+        }
+    }
+    else
+    {
+        (block -> dm_previous_free) -> dm_next_free = block -> dm_next_free;
+        (block -> dm_next_free) -> dm_previous_free = block -> dm_previous_free;
+
+        if (tlsf -> dm_free_lists[fl][sl] == block)
+        {
+            tlsf -> dm_free_lists[fl][sl] = block -> dm_next_free;
+        }
+    }
+}
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       DMC_TLSF_Split
+*
+*   DESCRIPTION
+*
+*       This function splits a block in two and returns the header of
+*       the second block.  Neither block is placed on a free list.
+*
+*   CALLED BY
+*
+*       DMC_TLSF_Allocate
+*
+*   CALLS
+*
+*       None
+*
+*   INPUTS
+*
+*       pool                                Memory pool pointer
+*       block                               Block to split
+*       offset                              Offset of the second block
+*                                           header from the first
+*
+*   OUTPUTS
+*
+*       new_ptr                             Pointer to second block
+*
+***********************************************************************/
+static DM_HEADER *DMC_TLSF_Split(DM_PCB *pool, DM_HEADER *block,
+                                 UNSIGNED offset)
+{
+    DM_HEADER *new_ptr;
+
+    new_ptr =  (DM_HEADER *) (((BYTE_PTR) block) + offset);
+
+    new_ptr -> dm_memory_pool = pool;
+
+    /* Build the necessary pointers.  */
+    new_ptr -> dm_previous_memory = block;
+    new_ptr -> dm_next_memory = block -> dm_next_memory;
+    (new_ptr -> dm_next_memory) -> dm_previous_memory = new_ptr;
+    block -> dm_next_memory = new_ptr;
+
+    return (new_ptr);
+}
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       DMC_TLSF_Add_Block
+*
+*   DESCRIPTION
+*
+*       This function builds a single free block and a trailer block
+*       in a section of memory and places the free block on the free
+*       lists of a TLSF pool.  Protection must be in place before using
+*       this internal function.
+*
+*   CALLED BY
+*
+*       NU_Create_Memory_Pool
+*       NU_Add_Memory
+*
+*   CALLS
+*
+*       DMC_TLSF_Insert
+*
+*   INPUTS
+*
+*       pool                                Memory pool pointer
+*       start_address                       Starting address of memory
+*       size                                Number of bytes of memory
+*
+*   OUTPUTS
+*
+*       header_ptr                          Pointer to the free block
+*
+***********************************************************************/
+DM_HEADER *DMC_TLSF_Add_Block(DM_PCB *pool, VOID *start_address, UNSIGNED size)
+{
+    DM_HEADER  *header_ptr;
+    DM_HEADER  *trailer_ptr;
+
+    header_ptr =  (DM_HEADER *) start_address;
+    trailer_ptr = (DM_HEADER *) (((BYTE_PTR) start_address) + size - DM_OVERHEAD);
+
+    /* Build the block header.  */
+    header_ptr -> dm_memory_pool =  pool;
+    header_ptr -> dm_next_memory =  trailer_ptr;
+    header_ptr -> dm_previous_memory =  trailer_ptr;
+    header_ptr -> dm_memory_free =  NU_TRUE;
+
+    /* Build the small trailer block that prevents block merging when the
+       memory wraps around.  */
+    trailer_ptr -> dm_next_memory =  header_ptr;
+    trailer_ptr -> dm_previous_memory =  header_ptr;
+    trailer_ptr -> dm_memory_free =  NU_FALSE;
+    trailer_ptr -> dm_memory_pool =  pool;
+
+    pool -> dm_available += (size - (2 * DM_OVERHEAD));
+
+    DMC_TLSF_Insert(pool -> dm_tlsf, header_ptr);
+
+    return (header_ptr);
+}
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       DMC_TLSF_Allocate
+*
+*   DESCRIPTION
+*
+*       This function allocates memory from a TLSF pool.  The request
+*       is rounded up to the next list boundary so the head of any
+*       non-empty list at or above it satisfies the request.  Aligned
+*       requests also reserve room for a front split.  The remainder of
+*       the block is returned to the free lists if it is large enough
+*       for another allocation.  Protection must be in place before
+*       using this internal function.
+*
+*   CALLED BY
+*
+*       DMC_Allocate
+*
+*   CALLS
+*
+*       DMC_TLSF_Msb
+*       DMC_TLSF_Mapping
+*       DMC_TLSF_Insert
+*       DMC_TLSF_Remove
+*       DMC_TLSF_Split
+*
+*   INPUTS
+*
+*       pool                                Memory pool pointer
+*       size                                Number of bytes requested
+*       alignment                           The alignment the start of
+*                                           allocated memory should use
+*
+*  OUTPUTS
+*
+*       memory_ptr                          Pointer to allocated block
+*                                           or NU_NULL if no memory found
+*
+***********************************************************************/
+DM_HEADER *DMC_TLSF_Allocate(DM_PCB *pool, UNSIGNED size, UNSIGNED alignment)
+{
+    DM_TLSF    *tlsf = pool -> dm_tlsf;
+    DM_HEADER  *memory_ptr;
+    UNSIGNED    search_size = size;
+    UNSIGNED    block_size;
+    UNSIGNED    address;
+    UNSIGNED    next_aligned;
+    UNSIGNED    split_size;
+    UNSIGNED    fl;
+    UNSIGNED    sl;
+    UNSIGNED    map;
+
+    /* An aligned block may need a front split big enough to be a free
+       block of its own */
+    if (alignment)
+    {
+        search_size += alignment + (2 * DM_OVERHEAD) + pool -> dm_min_allocation;
+    }
+
+    /* Round the request up to the next list boundary */
+    if (search_size >= DM_TLSF_SMALL_SIZE)
+    {
+        search_size += (1UL << (DMC_TLSF_Msb(search_size) - DM_TLSF_SL_LOG2)) - 1;
+    }
+
+    /* Check the request did not overflow */
+    if (search_size < size)
+    {
+        return (NU_NULL);
+    }
+
+    DMC_TLSF_Mapping(search_size, &fl, &sl);
+
+    /* Find a non-empty list at or above the request */
+    map = tlsf -> dm_sl_bitmap[fl] & (~0UL << sl);
+
+    if (map == 0)
+    {
+        map = ((fl + 1) < DM_TLSF_FL_COUNT) ?
+              (tlsf -> dm_fl_bitmap & (~0UL << (fl + 1))) : 0;
+
+        if (map == 0)
+        {
+            return (NU_NULL);
+        }
+
+        fl = DMC_TLSF_Msb(map & (~map + 1));
+        map = tlsf -> dm_sl_bitmap[fl];
+    }
+
+    sl = DMC_TLSF_Msb(map & (~map + 1));
+
+    /* Take the block at the head of the list */
+    memory_ptr = tlsf -> dm_free_lists[fl][sl];
+
+    DMC_TLSF_Remove(tlsf, memory_ptr);
+
+    block_size = DMC_TLSF_BLOCK_SIZE(memory_ptr);
+    pool -> dm_available -= block_size;
+
+    if (alignment)
+    {
+        address = ((UNSIGNED)(memory_ptr)) + DM_OVERHEAD;
+
+        if (address % alignment != 0)
+        {
+            /* Split off the front of the block, making room for the
+               front block to hold a minimum allocation */
+            next_aligned = address + (2 * DM_OVERHEAD) +
+                           (pool -> dm_min_allocation) + (alignment - 1);
+            next_aligned /= alignment;
+            next_aligned *= alignment;
+            split_size = next_aligned - address;
+
+            /* Return the front block to the free lists */
+            memory_ptr -> dm_memory_free = NU_TRUE;
+            memory_ptr = DMC_TLSF_Split(pool, memory_ptr, split_size);
+            DMC_TLSF_Insert(tlsf, memory_ptr -> dm_previous_memory);
+
+            pool -> dm_available += split_size - DM_OVERHEAD;
+            block_size -= split_size;
+        }
+    }
+
+    /* Return the rear of the block to the free lists if it is large
+       enough for another allocation */
+    if (block_size >= (size + DM_OVERHEAD + pool -> dm_min_allocation))
+    {
+        DMC_TLSF_Split(pool, memory_ptr, size + DM_OVERHEAD) -> dm_memory_free = NU_TRUE;
+        DMC_TLSF_Insert(tlsf, memory_ptr -> dm_next_memory);
+
+        pool -> dm_available += block_size - size - DM_OVERHEAD;
+    }
+
+    /* Mark this memory as now allocated */
+    memory_ptr -> dm_memory_free = NU_FALSE;
+
+    return (memory_ptr);
+}
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       DMC_TLSF_Deallocate
+*
+*   DESCRIPTION
+*
+*       This function frees memory in a TLSF pool, merges it with its
+*       free neighbors and places the result on the free lists.
+*       Protection must be in place before using this internal function.
+*
+*   CALLED BY
+*
+*       DMC_Deallocate
+*
+*   CALLS
+*
+*       DMC_TLSF_Insert
+*       DMC_TLSF_Remove
+*
+*   INPUTS
+*
+*       pool                                Memory pool pointer
+*       header_ptr                          Header to memory being
+*                                           deallocated
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID DMC_TLSF_Deallocate(DM_PCB *pool, DM_HEADER *header_ptr)
+{
+    DM_TLSF    *tlsf = pool -> dm_tlsf;
+    DM_HEADER  *new_ptr;
+
+    /* Mark the memory as available.  */
+    header_ptr -> dm_memory_free =  NU_TRUE;
+
+    /* Adjust the available number of bytes.  */
+    pool -> dm_available += DMC_TLSF_BLOCK_SIZE(header_ptr);
+
+    /* Determine if the block can be merged with the previous neighbor.  */
+    new_ptr = header_ptr -> dm_previous_memory;
+
+    if (new_ptr -> dm_memory_free)
+    {
+        DMC_TLSF_Remove(tlsf, new_ptr);
+
+        /* Merge block with previous neighbor.  */
+        new_ptr -> dm_next_memory = header_ptr -> dm_next_memory;
+        (header_ptr -> dm_next_memory) -> dm_previous_memory = new_ptr;
+
+        header_ptr = new_ptr;
+
+        pool -> dm_available += DM_OVERHEAD;
+    }
+
+    /* Determine if the block can be merged with the next neighbor.  */
+    new_ptr = header_ptr -> dm_next_memory;
+
+    if (new_ptr -> dm_memory_free)
+    {
+        DMC_TLSF_Remove(tlsf, new_ptr);
+
+        /* Merge block with next neighbor.  */
+        header_ptr -> dm_next_memory = new_ptr -> dm_next_memory;
+        (new_ptr -> dm_next_memory) -> dm_previous_memory = header_ptr;
+
+        pool -> dm_available += DM_OVERHEAD;
+    }
+
+    DMC_TLSF_Insert(tlsf, header_ptr);
+}
+
+#endif  /* NU_TLSF_POOLS == NU_TRUE */
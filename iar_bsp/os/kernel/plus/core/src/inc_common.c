@@ -250,6 +250,13 @@ VOID  INC_Initialize(VOID *first_available_memory)
     Pre_Kernel_Init_Hook(&System_Memory, &System_Memory);
 #endif /* ((ESAL_PR_CACHE_AVAILABLE == NU_TRUE) || (ESAL_CO_CACHE_AVAILABLE == NU_TRUE)) */
 
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+
+    /* Start the cycle counter and begin counting CPU usage from here. */
+    NU_CPU_Usage_Reset();
+
+#endif  /* NU_CPU_ACCOUNTING == NU_TRUE */
+
     /* Indicate that initialization is finished. */
     INC_Initialize_State =  INC_END_INITIALIZE;
 
@@ -0,0 +1,739 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       mxc_common.c
+*
+*   COMPONENT
+*
+*       MX - Mutex Management
+*
+*   DESCRIPTION
+*
+*       This file contains the core common routines for the Mutex
+*       management component.  A mutex uses the immediate priority
+*       ceiling protocol.  Its owner is raised to the ceiling priority
+*       as soon as the mutex is obtained, so a task that may obtain the
+*       mutex cannot preempt the owner and the owner never needs to
+*       inherit a priority.
+*
+*       When the mutex is free on obtain, or nobody waits for it on
+*       release, the mutex is handed over and the owner priority is
+*       changed with interrupts disabled for a few instructions instead
+*       of under the schedule lock.  Only tasks whose priority is at or
+*       below the ceiling may obtain a mutex, and the mutexes owned by a
+*       task must be released in the reverse order they were obtained.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       NU_Create_Mutex                     Create a mutex
+*       NU_Obtain_Mutex                     Obtain a mutex
+*       NU_Release_Mutex                    Release a mutex
+*       MXC_Cleanup                         Cleanup on timeout or a
+*                                           terminate condition
+*       MXC_Kill_Mutex_Owner                Release mutex of a
+*                                           terminated task
+*       mxc_own_mutex                       Make a task the owner
+*       mxc_release_mutex                   Release and hand over
+*
+*   DEPENDENCIES
+*
+*       nucleus.h                           Nucleus System constants
+*       nu_kernel.h                         Kernel constants
+*       thread_control.h                    Thread Control functions
+*       common_services.h                   Common service constants
+*       mutex.h                             Mutex functions
+*
+***********************************************************************/
+#include        "nucleus.h"
+#include        "kernel/nu_kernel.h"
+#include        "os/kernel/plus/core/inc/thread_control.h"
+#include        "os/kernel/plus/core/inc/common_services.h"
+#include        "os/kernel/plus/core/inc/mutex.h"
+#include        <string.h>
+
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+
+/* Internal function prototypes */
+static VOID     mxc_own_mutex(MX_MCB *mutex, TC_TCB *task);
+static VOID     mxc_release_mutex(MX_MCB *mutex, TC_TCB *task);
+
+/* External functions */
+extern STATUS TCS_Change_Priority (TC_TCB *task, OPTION new_priority, BOOLEAN app_call);
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Create_Mutex
+*
+*   DESCRIPTION
+*
+*       This function creates a mutex.  The ceiling priority must be at
+*       least as high as the priority of every task that obtains the
+*       mutex.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*
+*   INPUTS
+*
+*       mutex_ptr                           Mutex control block pointer
+*       name                                Mutex name
+*       ceiling_priority                    Priority of the owner
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*       NU_INVALID_SEMAPHORE                Mutex control block pointer
+*                                           is NULL or already created
+*
+***********************************************************************/
+STATUS NU_Create_Mutex(NU_MUTEX *mutex_ptr, CHAR *name,
+                       OPTION ceiling_priority)
+{
+    R1 MX_MCB       *mutex;                 /* Mutex control block ptr   */
+    STATUS          status = NU_SUCCESS;
+    NU_SUPERV_USER_VARIABLES
+
+    /* Move input mutex pointer into internal pointer. */
+    mutex =  (MX_MCB *) mutex_ptr;
+
+    /* Check for a NULL mutex pointer or an already created mutex */
+    NU_ERROR_CHECK(((mutex == NU_NULL) || (mutex -> mx_id == MX_MUTEX_ID)), status, NU_INVALID_SEMAPHORE);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Call stack checking function to check for an overflow condition.  */
+        (VOID)NU_Check_Stack();
+
+        /* Clear the control block */
+        CSC_Clear_CB(mutex, MX_MCB);
+
+        /* Fill in the mutex name. */
+        strncpy(mutex -> mx_name, name, (NU_MAX_NAME - 1));
+
+        /* Setup the ceiling priority.  */
+        mutex -> mx_ceiling =  (DATA_ELEMENT) ceiling_priority;
+
+        /* At this point the mutex is completely built.  The ID can now be
+           set.  */
+        mutex -> mx_id =  MX_MUTEX_ID;
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    /* Return the completion status.  */
+    return(status);
+}
+
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Obtain_Mutex
+*
+*   DESCRIPTION
+*
+*       This function obtains a mutex and raises the calling task to
+*       the ceiling priority.  If the mutex is free it is taken with
+*       interrupts disabled.  Otherwise, suspension is possible.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       mxc_own_mutex                       Make a task the owner
+*       NU_Priority_Place_On_List           Place on priority list
+*       TCC_Suspend_Task                    Suspend calling task
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*       TCCT_Control_To_System              Transfer control to system
+*       TCCT_Current_Thread                 Pickup current thread
+*                                           pointer
+*       TCCT_Schedule_Lock                  Protect mutex
+*       TCCT_Schedule_Unlock                Release protection
+*
+*   INPUTS
+*
+*       mutex_ptr                           Mutex control block pointer
+*       suspend                             Suspension option if owned
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS                      If service is successful
+*           NU_UNAVAILABLE                  If the mutex is owned
+*           NU_TIMEOUT                      If timeout on service
+*           NU_SEMAPHORE_DELETED            If mutex deleted during
+*                                           suspension
+*           NU_SEMAPHORE_ALREADY_OWNED      If task owning mutex tries
+*                                           to obtain it
+*           NU_SEMAPHORE_OWNER_DEAD         If the previous owner was
+*                                           terminated while owning
+*                                           the mutex
+*           NU_INVALID_SEMAPHORE            Invalid mutex pointer
+*           NU_INVALID_SUSPEND              Not called from a task
+*           NU_INVALID_PRIORITY             Task priority is above the
+*                                           ceiling priority
+*
+***********************************************************************/
+STATUS NU_Obtain_Mutex(NU_MUTEX *mutex_ptr, UNSIGNED suspend)
+{
+    R1 MX_MCB       *mutex;                 /* Mutex control block ptr   */
+    R2 MX_SUSPEND   *suspend_ptr;           /* Suspend block pointer     */
+    MX_SUSPEND      suspend_block;          /* Allocate suspension block */
+    TC_TCB          *task;                  /* Task pointer              */
+    STATUS          status = NU_SUCCESS;    /* Completion status         */
+    ESAL_GE_INT_CONTROL_VARS
+    NU_SUPERV_USER_VARIABLES
+
+    /* Move input mutex pointer into internal pointer.  */
+    mutex =  (MX_MCB *) mutex_ptr;
+
+    /* Get a pointer the currently executing task */
+    task =  (TC_TCB *) TCCT_Current_Thread();
+
+    /* Determine if the mutex pointer is valid */
+    NU_ERROR_CHECK(((mutex == NU_NULL) || (mutex -> mx_id != MX_MUTEX_ID)), status, NU_INVALID_SEMAPHORE);
+
+    /* Only a task may own a mutex */
+    NU_ERROR_CHECK((TCCE_Suspend_Error()), status, NU_INVALID_SUSPEND);
+
+    /* Determine if the task priority is above the ceiling */
+    NU_ERROR_CHECK((task -> tc_base_priority < mutex -> mx_ceiling), status, NU_INVALID_PRIORITY);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Call stack checking function to check for an overflow condition.  */
+        (VOID)NU_Check_Stack();
+
+        /* Disable interrupts.  No other task can run until they are
+           restored.  */
+        ESAL_GE_INT_ALL_DISABLE();
+
+        /* Determine if the mutex is free.  */
+        if (mutex -> mx_owner == NU_NULL)
+        {
+            /* Take the mutex and raise the task to the ceiling.  */
+            mxc_own_mutex(mutex, task);
+
+            /* Check to see if previous owner died while owning the mutex */
+            if (mutex -> mx_owner_killed == NU_TRUE)
+            {
+                status =  NU_SEMAPHORE_OWNER_DEAD;
+                mutex -> mx_owner_killed =  NU_FALSE;
+            }
+
+            /* Determine if a task already ready at the ceiling priority
+               must run first.  */
+            if (TCD_Execute_Task != task)
+            {
+                TCCT_Schedule_Lock();
+
+                ESAL_GE_INT_ALL_RESTORE();
+
+                /* Transfer control to system to facilitate preemption.  */
+                TCCT_Control_To_System();
+
+                TCCT_Schedule_Unlock();
+            }
+            else
+            {
+                ESAL_GE_INT_ALL_RESTORE();
+            }
+        }
+        else
+        {
+            ESAL_GE_INT_ALL_RESTORE();
+
+            /* Protect against simultaneous access to the mutex.  */
+            TCCT_Schedule_Lock();
+
+            /* The owner may have released the mutex before the lock was
+               taken.  */
+            if (mutex -> mx_owner == NU_NULL)
+            {
+                mxc_own_mutex(mutex, task);
+
+                if (mutex -> mx_owner_killed == NU_TRUE)
+                {
+                    status =  NU_SEMAPHORE_OWNER_DEAD;
+                    mutex -> mx_owner_killed =  NU_FALSE;
+                }
+
+                if (TCD_Execute_Task != task)
+                {
+                    TCCT_Control_To_System();
+                }
+            }
+            else if (mutex -> mx_owner == task)
+            {
+                status =  NU_SEMAPHORE_ALREADY_OWNED;
+            }
+            else if (suspend)
+            {
+                /* Suspension is selected.  */
+                /* Increment the number of tasks waiting.  */
+                mutex -> mx_tasks_waiting++;
+
+                /* Setup the suspend block and suspend the calling task.  */
+                suspend_ptr =  &suspend_block;
+                suspend_ptr -> mx_mutex =                    mutex;
+                suspend_ptr -> mx_suspend_link.cs_next =     NU_NULL;
+                suspend_ptr -> mx_suspend_link.cs_previous = NU_NULL;
+                suspend_ptr -> mx_suspend_link.cs_priority = TCC_Task_Priority(task);
+                suspend_ptr -> mx_suspended_task =           task;
+
+                /* The owner already runs at the ceiling, so no priority
+                   has to be passed on.  Just queue in priority order.  */
+                NU_Priority_Place_On_List((CS_NODE **)
+                                          &(mutex -> mx_suspension_list),
+                                          &(suspend_ptr -> mx_suspend_link));
+
+                /* Finally, suspend the calling task. Note that the suspension call
+                   automatically clears the protection on the mutex.  The
+                   releasing task makes this task the owner.  */
+                TCC_Suspend_Task((NU_TASK *) task, NU_SEMAPHORE_SUSPEND,
+                                 MXC_Cleanup, suspend_ptr, suspend);
+
+                /* Pickup the return status.  */
+                status =  suspend_ptr -> mx_return_status;
+            }
+            else
+            {
+                /* No suspension requested.  Simply return an error status.  */
+                status =  NU_UNAVAILABLE;
+            }
+
+            /* Release protection against access to the mutex.  */
+            TCCT_Schedule_Unlock();
+        }
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    /* Return the completion status.  */
+    return(status);
+}
+
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Release_Mutex
+*
+*   DESCRIPTION
+*
+*       This function releases a mutex and returns the calling task to
+*       the priority it had before the mutex was obtained.  If no task
+*       is waiting this is done with interrupts disabled.  Otherwise,
+*       the highest priority waiting task is made the owner.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       mxc_release_mutex                   Release and hand over
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*       TCCT_Control_To_System              Transfer control to system
+*       TCCT_Current_Thread                 Pickup current thread
+*                                           pointer
+*       TCCT_Schedule_Lock                  Protect mutex
+*       TCCT_Schedule_Unlock                Release protection
+*
+*   INPUTS
+*
+*       mutex_ptr                           Mutex control block pointer
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS                      Success
+*           NU_SEMAPHORE_INVALID_OWNER      Mutex is not owned by the
+*                                           calling task
+*           NU_INVALID_OPERATION            Mutex is not the last one
+*                                           obtained by the task
+*           NU_INVALID_SEMAPHORE            Invalid mutex pointer
+*
+***********************************************************************/
+STATUS NU_Release_Mutex(NU_MUTEX *mutex_ptr)
+{
+    R1 MX_MCB       *mutex;                 /* Mutex control block ptr   */
+    TC_TCB          *task;                  /* Task pointer              */
+    STATUS          status = NU_SUCCESS;    /* Completion status         */
+    ESAL_GE_INT_CONTROL_VARS
+    NU_SUPERV_USER_VARIABLES
+
+    /* Move input mutex pointer into internal pointer.  */
+    mutex =  (MX_MCB *) mutex_ptr;
+
+    /* Get a pointer the currently executing task */
+    task =  (TC_TCB *) TCCT_Current_Thread();
+
+    /* Determine if the mutex pointer is valid */
+    NU_ERROR_CHECK(((mutex == NU_NULL) || (mutex -> mx_id != MX_MUTEX_ID)), status, NU_INVALID_SEMAPHORE);
+
+    /* Ensure calling task is the owner */
+    NU_ERROR_CHECK(((mutex -> mx_owner == NU_NULL) || (mutex -> mx_owner != task)), status, NU_SEMAPHORE_INVALID_OWNER);
+
+    /* Mutexes must be released in the reverse order they were obtained */
+    NU_ERROR_CHECK((task -> tc_mutex_list != mutex), status, NU_INVALID_OPERATION);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Call stack checking function to check for an overflow condition.  */
+        (VOID)NU_Check_Stack();
+
+        /* Disable interrupts.  No other task can start waiting for the
+           mutex until they are restored.  */
+        ESAL_GE_INT_ALL_DISABLE();
+
+        /* Determine if another task is waiting for the mutex.  */
+        if (mutex -> mx_tasks_waiting == 0)
+        {
+            /* Free the mutex and drop the task back to its priority.  */
+            mxc_release_mutex(mutex, task);
+
+            /* Determine if a task between the two priorities is ready.  */
+            if (TCD_Execute_Task != task)
+            {
+                TCCT_Schedule_Lock();
+
+                ESAL_GE_INT_ALL_RESTORE();
+
+                /* Transfer control to system to facilitate preemption.  */
+                TCCT_Control_To_System();
+
+                TCCT_Schedule_Unlock();
+            }
+            else
+            {
+                ESAL_GE_INT_ALL_RESTORE();
+            }
+        }
+        else
+        {
+            ESAL_GE_INT_ALL_RESTORE();
+
+            /* Protect against simultaneous access to the mutex.  */
+            TCCT_Schedule_Lock();
+
+            /* Free the mutex and hand it over to a waiting task.  */
+            mxc_release_mutex(mutex, task);
+
+            /* Determine if a preempt condition is present.  */
+            if (TCD_Execute_Task != task)
+            {
+                /* Transfer control to system to facilitate preemption.  */
+                TCCT_Control_To_System();
+            }
+
+            /* Release protection against access to the mutex.  */
+            TCCT_Schedule_Unlock();
+        }
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    /* Return the completion status.  */
+    return(status);
+}
+
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       mxc_own_mutex
+*
+*   DESCRIPTION
+*
+*       This internal function makes a task the owner of a mutex and
+*       raises it to the ceiling priority.  If the task is running,
+*       TCD_Execute_Task no longer points to it when another task must
+*       run first.
+*
+*       NOTE:  Interrupts must be disabled or the kernel lock must be
+*              owned by the caller of this function.
+*
+*   CALLED BY
+*
+*       NU_Obtain_Mutex                     Obtain a mutex
+*       mxc_release_mutex                   Release and hand over
+*
+*   CALLS
+*
+*       TCS_Change_Priority                 Changes priority of task
+*
+*   INPUTS
+*
+*       mutex                               Mutex control block ptr
+*       task                                New owner
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+static VOID mxc_own_mutex(MX_MCB *mutex, TC_TCB *task)
+{
+    /* Make this task the owner and push the mutex on its mutex stack */
+    mutex -> mx_owner =             task;
+    mutex -> mx_saved_priority =    task -> tc_priority;
+    mutex -> mx_previous =          task -> tc_mutex_list;
+    task -> tc_mutex_list =         mutex;
+
+    /* Raise the task to the ceiling.  A task already at or above the
+       ceiling keeps its priority.  */
+    if (task -> tc_priority > mutex -> mx_ceiling)
+    {
+        (VOID)TCS_Change_Priority(task, mutex -> mx_ceiling, NU_FALSE);
+    }
+}
+
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       mxc_release_mutex
+*
+*   DESCRIPTION
+*
+*       This internal function frees a mutex and returns the owner to
+*       the priority it had before the mutex was obtained, unless the
+*       priority has been changed since.  The highest priority waiting
+*       task, if any, is made the new owner and resumed.  The caller
+*       must transfer control to the system if TCD_Execute_Task no
+*       longer points to the running task.
+*
+*       NOTE:  The kernel lock must be owned by the caller of this
+*              function if a task is waiting for the mutex.  Otherwise,
+*              disabling interrupts is enough.
+*
+*   CALLED BY
+*
+*       NU_Release_Mutex                    Release a mutex
+*       MXC_Kill_Mutex_Owner                Release mutex of a
+*                                           terminated task
+*
+*   CALLS
+*
+*       mxc_own_mutex                       Make a task the owner
+*       NU_Remove_From_List                 Remove from suspend list
+*       TCC_Resume_Task                     Resume a suspended task
+*       TCS_Change_Priority                 Changes priority of task
+*
+*   INPUTS
+*
+*       mutex                               Mutex control block ptr
+*       task                                Owner of the mutex
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+static VOID mxc_release_mutex(MX_MCB *mutex, TC_TCB *task)
+{
+    R2 MX_SUSPEND   *suspend_ptr;           /* Pointer to suspend block  */
+
+    /* Pop the mutex off the mutex stack of the owner */
+    task -> tc_mutex_list =  mutex -> mx_previous;
+    mutex -> mx_owner =      NU_NULL;
+    mutex -> mx_previous =   NU_NULL;
+
+    /* Drop back to the priority before the mutex was obtained */
+    if ((task -> tc_priority == mutex -> mx_ceiling) &&
+        (mutex -> mx_saved_priority != mutex -> mx_ceiling))
+    {
+        (VOID)TCS_Change_Priority(task, mutex -> mx_saved_priority, NU_FALSE);
+    }
+
+    /* Determine if another task is waiting on the mutex.  */
+    if (mutex -> mx_tasks_waiting)
+    {
+        /* Decrement the number of tasks waiting counter.  */
+        mutex -> mx_tasks_waiting--;
+
+        /* Remove the first suspended block from the list.  */
+        suspend_ptr =  mutex -> mx_suspension_list;
+        NU_Remove_From_List((CS_NODE **) &(mutex -> mx_suspension_list),
+                            &(suspend_ptr -> mx_suspend_link));
+
+        /* Setup the appropriate return value.  */
+        suspend_ptr -> mx_return_status =  NU_SUCCESS;
+
+        /* Check to see if previous owner is dead */
+        if (mutex -> mx_owner_killed == NU_TRUE)
+        {
+            suspend_ptr -> mx_return_status =  NU_SEMAPHORE_OWNER_DEAD;
+            mutex -> mx_owner_killed =  NU_FALSE;
+        }
+
+        /* Hand the mutex over before the task is resumed, so it is
+           resumed at the ceiling priority.  */
+        mxc_own_mutex(mutex, suspend_ptr -> mx_suspended_task);
+
+        /* Resume the suspended task.  */
+        (VOID)TCC_Resume_Task((NU_TASK *) suspend_ptr -> mx_suspended_task,
+                              NU_SEMAPHORE_SUSPEND);
+    }
+}
+
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       MXC_Cleanup
+*
+*   DESCRIPTION
+*
+*       This function is responsible for removing a suspension block
+*       from a mutex.  It is not called unless a timeout or a task
+*       terminate is in progress.  Note that protection is already in
+*       effect - the same protection at suspension time.  This routine
+*       must be called from Supervisor mode in Supervisor/User mode
+*       switching kernels.
+*
+*   CALLED BY
+*
+*       TCC_Task_Timeout                    Task timeout
+*       NU_Terminate_Task                   Task terminate
+*
+*   CALLS
+*
+*       NU_Remove_From_List                 Remove suspend block from
+*                                           the suspension list
+*
+*   INPUTS
+*
+*       information                         Pointer to suspend block
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID  MXC_Cleanup(VOID *information)
+{
+    MX_SUSPEND      *suspend_ptr;           /* Suspension block pointer  */
+
+    NU_SUPERV_USER_VARIABLES
+
+
+    /* Switch to supervisor mode */
+    NU_SUPERVISOR_MODE();
+
+    /* Use the information pointer as a suspend pointer.  */
+    suspend_ptr =  (MX_SUSPEND *) information;
+
+    /* By default, indicate that the service timed-out.  It really does not
+       matter if this function is called from a terminate request since
+       the task does not resume.  */
+    suspend_ptr -> mx_return_status =  NU_TIMEOUT;
+
+    /* Decrement the number of tasks waiting counter.  */
+    (suspend_ptr -> mx_mutex) -> mx_tasks_waiting--;
+
+    /* Unlink the suspend block from the suspension list.  */
+    NU_Remove_From_List((CS_NODE **)
+                        &((suspend_ptr -> mx_mutex) -> mx_suspension_list),
+                        &(suspend_ptr -> mx_suspend_link));
+
+    /* Return to user mode */
+    NU_USER_MODE();
+}
+
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       MXC_Kill_Mutex_Owner
+*
+*   DESCRIPTION
+*
+*       This function forcibly releases a mutex owned by a task that is
+*       being terminated.  The next task to obtain the mutex gets an
+*       error returned that the previous owner was killed while owning
+*       the mutex.
+*
+*       NOTE:  The kernel lock must be owned by the caller of this
+*              function.
+*
+*   CALLED BY
+*
+*       NU_Terminate_Task
+*
+*   CALLS
+*
+*       mxc_release_mutex                   Release and hand over
+*
+*   INPUTS
+*
+*       mutex_ptr                           Pointer to mutex to release
+*       owning_task                         Pointer to task owning the
+*                                           mutex
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID    MXC_Kill_Mutex_Owner(NU_MUTEX *mutex_ptr, NU_TASK *owning_task)
+{
+    /* Ensure owning task passed-in actually still owns the mutex */
+    if (mutex_ptr -> mx_owner == (TC_TCB *) owning_task)
+    {
+        /* Set flags showing that owner is dead */
+        mutex_ptr -> mx_owner_killed =  NU_TRUE;
+
+        /* Call internal function to release the mutex */
+        mxc_release_mutex(mutex_ptr, (TC_TCB *) owning_task);
+    }
+}
+
+#endif  /* NU_CEILING_MUTEXES == NU_TRUE */
@@ -0,0 +1,130 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       mxc_delete.c
+*
+*   COMPONENT
+*
+*       MX - Mutex Management
+*
+*   DESCRIPTION
+*
+*       This file contains the core Delete routine for the Mutex
+*       management component.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       NU_Delete_Mutex                     Delete a mutex
+*
+*   DEPENDENCIES
+*
+*       nucleus.h                           Nucleus System constants
+*       nu_kernel.h                         Kernel constants
+*       thread_control.h                    Thread Control functions
+*       mutex.h                             Mutex functions
+*
+***********************************************************************/
+#include        "nucleus.h"
+#include        "kernel/nu_kernel.h"
+#include        "os/kernel/plus/core/inc/thread_control.h"
+#include        "os/kernel/plus/core/inc/mutex.h"
+
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Delete_Mutex
+*
+*   DESCRIPTION
+*
+*       This function deletes a mutex.  An owned mutex cannot be
+*       deleted, so no task can be waiting for a deleted mutex.  Note
+*       that this function does not free the memory associated with the
+*       mutex control block.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*       TCCT_Schedule_Lock                  Protect mutex
+*       TCCT_Schedule_Unlock                Release protection
+*
+*   INPUTS
+*
+*       mutex_ptr                           Mutex control block pointer
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*       NU_INVALID_SEMAPHORE                Invalid mutex pointer
+*       NU_UNAVAILABLE                      Mutex is owned by a task
+*
+***********************************************************************/
+STATUS NU_Delete_Mutex(NU_MUTEX *mutex_ptr)
+{
+    R1 MX_MCB       *mutex;                 /* Mutex control block ptr   */
+    STATUS          status = NU_SUCCESS;
+    NU_SUPERV_USER_VARIABLES
+
+    /* Move input mutex pointer into internal pointer. */
+    mutex =  (MX_MCB *) mutex_ptr;
+
+    /* Determine if there is an error with the mutex pointer. */
+    NU_ERROR_CHECK(((mutex == NU_NULL) || (mutex -> mx_id != MX_MUTEX_ID)), status, NU_INVALID_SEMAPHORE);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Call stack checking function to check for an overflow condition.  */
+        (VOID)NU_Check_Stack();
+
+        /* Protect against simultaneous access to the mutex.  */
+        TCCT_Schedule_Lock();
+
+        /* Determine if the mutex is owned.  */
+        if (mutex -> mx_owner != NU_NULL)
+        {
+            status =  NU_UNAVAILABLE;
+        }
+        else
+        {
+            /* Clear the mutex ID.  */
+            mutex -> mx_id =  0;
+        }
+
+        /* Release protection against access to the mutex.  */
+        TCCT_Schedule_Unlock();
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    /* Return the completion status.  */
+    return(status);
+}
+
+#endif  /* NU_CEILING_MUTEXES == NU_TRUE */
@@ -0,0 +1,142 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       mxf_info.c
+*
+*   COMPONENT
+*
+*       MX - Mutex Management
+*
+*   DESCRIPTION
+*
+*       This file contains the Information routine to obtain facts about
+*       a mutex.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       NU_Mutex_Information                Retrieve mutex information
+*
+*   DEPENDENCIES
+*
+*       nucleus.h                           Nucleus System constants
+*       nu_kernel.h                         Kernel constants
+*       thread_control.h                    Thread Control functions
+*       mutex.h                             Mutex functions
+*
+***********************************************************************/
+#include        "nucleus.h"
+#include        "kernel/nu_kernel.h"
+#include        "os/kernel/plus/core/inc/thread_control.h"
+#include        "os/kernel/plus/core/inc/mutex.h"
+#include        <string.h>
+
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Mutex_Information
+*
+*   DESCRIPTION
+*
+*       This function returns information about the specified mutex.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*       TCCT_Schedule_Lock                  Protect mutex
+*       TCCT_Schedule_Unlock                Release protection
+*
+*   INPUTS
+*
+*       mutex_ptr                           Pointer to the mutex
+*       name                                Destination for the name
+*       ceiling_priority                    Destination for the ceiling
+*                                           priority
+*       owner                               Destination for the owning
+*                                           task, NU_NULL if free
+*       tasks_waiting                       Destination for the tasks
+*                                           waiting count
+*
+*   OUTPUTS
+*
+*       completion
+*           NU_SUCCESS                      If a valid mutex pointer
+*                                           is supplied
+*           NU_INVALID_SEMAPHORE            If mutex pointer invalid
+*
+***********************************************************************/
+STATUS NU_Mutex_Information(NU_MUTEX *mutex_ptr, CHAR *name,
+                            OPTION *ceiling_priority, NU_TASK **owner,
+                            UNSIGNED *tasks_waiting)
+{
+    MX_MCB          *mutex;                 /* Mutex control block ptr   */
+    STATUS          completion;             /* Completion status         */
+    NU_SUPERV_USER_VARIABLES
+
+    /* Switch to supervisor mode */
+    NU_SUPERVISOR_MODE();
+
+    /* Move input mutex pointer into internal pointer.  */
+    mutex =  (MX_MCB *) mutex_ptr;
+
+    /* Call stack checking function to check for an overflow condition.  */
+    (VOID)NU_Check_Stack();
+
+    /* Protect against simultaneous access to the mutex.  */
+    TCCT_Schedule_Lock();
+
+    /* Determine if this mutex id is valid.  */
+    if ((mutex != NU_NULL) && (mutex -> mx_id == MX_MUTEX_ID))
+    {
+        /* The mutex pointer is valid.  Reflect this in the completion
+           status and fill in the actual information.  */
+        completion =  NU_SUCCESS;
+
+        /* Copy the mutex's name.  */
+        strncpy(name, mutex -> mx_name, NU_MAX_NAME);
+
+        /* Get various information about the mutex.  */
+        *ceiling_priority =  (OPTION) mutex -> mx_ceiling;
+        *owner =             (NU_TASK *) mutex -> mx_owner;
+        *tasks_waiting =     mutex -> mx_tasks_waiting;
+    }
+    else
+    {
+        /* Indicate that the mutex pointer is invalid.   */
+        completion =  NU_INVALID_SEMAPHORE;
+    }
+
+    /* Release protection against access to the mutex.  */
+    TCCT_Schedule_Unlock();
+
+    /* Return to user mode */
+    NU_USER_MODE();
+
+    /* Return the appropriate completion status.  */
+    return(completion);
+}
+
+#endif  /* NU_CEILING_MUTEXES == NU_TRUE */
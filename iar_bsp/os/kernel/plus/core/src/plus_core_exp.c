@@ -69,6 +69,11 @@ NU_EXPORT_SYMBOL (NU_Check_Stack);
 NU_EXPORT_KSYMBOL (NU_Change_Preemption);
 NU_EXPORT_KSYMBOL (NU_Established_Tasks);
 NU_EXPORT_KSYMBOL (NU_Task_Pointers);
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+NU_EXPORT_KSYMBOL (NU_Thread_CPU_Usage);
+NU_EXPORT_KSYMBOL (NU_CPU_Usage_System);
+NU_EXPORT_KSYMBOL (NU_CPU_Usage_Reset);
+#endif /* NU_CPU_ACCOUNTING == NU_TRUE */
 
 /**************************************/
 /* Export Queue management functions. */
@@ -88,6 +93,50 @@ NU_EXPORT_SYMBOL (NU_Queue_Information);
 NU_EXPORT_KSYMBOL (NU_Established_Queues);
 NU_EXPORT_KSYMBOL (NU_Queue_Pointers);
 
+#if (NU_POINTER_QUEUES == NU_TRUE)
+
+/**********************************************/
+/* Export Pointer Queue management functions. */
+/**********************************************/
+
+/* User exported symbols */
+NU_EXPORT_SYMBOL (NU_Create_Pointer_Queue);
+NU_EXPORT_SYMBOL (NU_Delete_Pointer_Queue);
+NU_EXPORT_SYMBOL (NU_Send_To_Pointer_Queue);
+NU_EXPORT_SYMBOL (NU_Receive_From_Pointer_Queue);
+
+#endif /* NU_POINTER_QUEUES == NU_TRUE */
+
+#if (NU_SPSC_RINGS == NU_TRUE)
+
+/**************************************/
+/* Export Ring management functions.  */
+/**************************************/
+
+/* User exported symbols */
+NU_EXPORT_SYMBOL (NU_Create_Ring);
+NU_EXPORT_SYMBOL (NU_Delete_Ring);
+NU_EXPORT_SYMBOL (NU_Send_To_Ring);
+NU_EXPORT_SYMBOL (NU_Receive_From_Ring);
+NU_EXPORT_SYMBOL (NU_Ring_Information);
+
+#endif /* NU_SPSC_RINGS == NU_TRUE */
+
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+
+/***************************************/
+/* Export Mutex management functions.  */
+/***************************************/
+
+/* User exported symbols */
+NU_EXPORT_SYMBOL (NU_Create_Mutex);
+NU_EXPORT_SYMBOL (NU_Delete_Mutex);
+NU_EXPORT_SYMBOL (NU_Obtain_Mutex);
+NU_EXPORT_SYMBOL (NU_Release_Mutex);
+NU_EXPORT_SYMBOL (NU_Mutex_Information);
+
+#endif /* NU_CEILING_MUTEXES == NU_TRUE */
+
 /******************************************/
 /* Export Semaphore management functions. */
 /******************************************/
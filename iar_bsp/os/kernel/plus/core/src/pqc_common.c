@@ -0,0 +1,642 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       pqc_common.c
+*
+*   COMPONENT
+*
+*       PQ - Pointer Queue Management
+*
+*   DESCRIPTION
+*
+*       This file contains the core common routines for the
+*       Pointer Queue management component.  A pointer queue passes a
+*       single pointer per message.  The pointer is stored in one word
+*       of the queue area, or handed directly to a suspended receiver,
+*       so the data it points to is never copied.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       NU_Create_Pointer_Queue             Create a pointer queue
+*       NU_Send_To_Pointer_Queue            Send pointer to a queue
+*       NU_Receive_From_Pointer_Queue       Receive pointer from queue
+*       PQC_Cleanup                         Cleanup on timeout or a
+*                                           terminate condition
+*
+*   DEPENDENCIES
+*
+*       nucleus.h                           Nucleus System constants
+*       nu_kernel.h                         Kernel constants
+*       thread_control.h                    Thread Control functions
+*       common_services.h                   Common service constants
+*       pointer_queue.h                     Pointer Queue functions
+*
+***********************************************************************/
+#include        "nucleus.h"
+#include        "kernel/nu_kernel.h"
+#include        "os/kernel/plus/core/inc/thread_control.h"
+#include        "os/kernel/plus/core/inc/common_services.h"
+#include        "os/kernel/plus/core/inc/pointer_queue.h"
+#include        <string.h>
+
+#if (NU_POINTER_QUEUES == NU_TRUE)
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Create_Pointer_Queue
+*
+*   DESCRIPTION
+*
+*       This function creates a pointer queue.  The queue area holds
+*       queue_size pointers.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*
+*   INPUTS
+*
+*       queue_ptr                           Pointer queue control block
+*                                           pointer
+*       name                                Pointer queue name
+*       start_address                       Starting address of actual
+*                                           queue area
+*       queue_size                          Number of pointers the queue
+*                                           area holds
+*       suspend_type                        Suspension type
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*       NU_INVALID_QUEUE                    Invalid queue pointer
+*       NU_INVALID_MEMORY                   Invalid queue starting addr
+*       NU_INVALID_SIZE                     Invalid queue size
+*       NU_INVALID_SUSPEND                  Invalid suspend type
+*       NU_NOT_ALIGNED                      Start address is not aligned
+*
+***********************************************************************/
+STATUS NU_Create_Pointer_Queue(NU_POINTER_QUEUE *queue_ptr, CHAR *name,
+                               VOID **start_address, UNSIGNED queue_size,
+                               OPTION suspend_type)
+{
+    R1 PQ_PQCB      *queue;                 /* Queue control block ptr   */
+    STATUS          status = NU_SUCCESS;
+    NU_SUPERV_USER_VARIABLES
+
+    /* Move input queue pointer into internal pointer. */
+    queue =  (PQ_PQCB *) queue_ptr;
+
+    /* Determine if there is an error with the queue pointer. */
+    NU_ERROR_CHECK(((queue == NU_NULL) || (queue -> pq_id == PQ_POINTER_QUEUE_ID)), status, NU_INVALID_QUEUE);
+
+    /* Determine if the starting address of the queue is valid. */
+    NU_ERROR_CHECK((start_address == NU_NULL), status, NU_INVALID_MEMORY);
+
+    /* Verify the start address is aligned */
+    NU_ERROR_CHECK((ESAL_GE_MEM_ALIGNED_CHECK(start_address, sizeof(VOID *)) == NU_FALSE), status, NU_NOT_ALIGNED);
+
+    /* Verify that the size parameter is valid. */
+    NU_ERROR_CHECK((queue_size == 0), status, NU_INVALID_SIZE);
+
+    /* Determine if the suspend type is valid. */
+    NU_ERROR_CHECK(((suspend_type != NU_FIFO) && (suspend_type != NU_PRIORITY)), status, NU_INVALID_SUSPEND);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Call stack checking function to check for an overflow condition.  */
+        (VOID)NU_Check_Stack();
+
+        /* Clear the control block */
+        CSC_Clear_CB(queue, PQ_PQCB);
+
+        /* Fill in the queue name. */
+        strncpy(queue -> pq_name, name, (NU_MAX_NAME - 1));
+
+        /* Setup the queue suspension type.  */
+        if (suspend_type == NU_FIFO)
+        {
+            /* FIFO suspension is selected, setup the flag accordingly.  */
+            queue -> pq_fifo_suspend =  NU_TRUE;
+        }
+
+        /* Setup the actual queue parameters.  */
+        queue -> pq_start =         start_address;
+        queue -> pq_queue_size =    queue_size;
+
+        /* At this point the queue is completely built.  The ID can now be
+           set.  */
+        queue -> pq_id =            PQ_POINTER_QUEUE_ID;
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    /* Return the completion status.  */
+    return(status);
+}
+
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Send_To_Pointer_Queue
+*
+*   DESCRIPTION
+*
+*       This function sends a pointer to the specified pointer queue.
+*       If a task is suspended on the empty queue, the pointer is handed
+*       to the first waiting task and the task is resumed.  Otherwise,
+*       the pointer is placed in the queue or, if the queue is full,
+*       suspension of the calling task is an option of the caller.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       NU_Place_On_List                    Place on suspend list
+*       NU_Priority_Place_On_List           Place on priority list
+*       NU_Remove_From_List                 Remove from suspend list
+*       TCC_Resume_Task                     Resume a suspended task
+*       TCC_Suspend_Task                    Suspend calling task
+*       TCC_Task_Priority                   Pickup task's priority
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*       TCCT_Control_To_System              Transfer control to system
+*       TCCT_Current_Thread                 Pickup current thread
+*                                           pointer
+*       TCCT_Schedule_Lock                  Protect queue
+*       TCCT_Schedule_Unlock                Release protection
+*
+*   INPUTS
+*
+*       queue_ptr                           Pointer queue control block
+*                                           pointer
+*       message                             Pointer to send
+*       suspend                             Suspension option if full
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS                      If service is successful
+*           NU_QUEUE_FULL                   If queue is currently full
+*           NU_TIMEOUT                      If timeout on service
+*                                           expires
+*           NU_QUEUE_DELETED                If queue was deleted during
+*                                           suspension
+*           NU_INVALID_QUEUE                Invalid queue pointer
+*           NU_INVALID_POINTER              Invalid message pointer
+*           NU_INVALID_SUSPEND              Invalid suspend request
+*
+***********************************************************************/
+STATUS NU_Send_To_Pointer_Queue(NU_POINTER_QUEUE *queue_ptr, VOID *message,
+                                UNSIGNED suspend)
+{
+    R1 PQ_PQCB      *queue;                 /* Queue control block ptr   */
+    PQ_SUSPEND      suspend_block;          /* Allocate suspension block */
+    PQ_SUSPEND      *suspend_ptr;           /* Pointer to suspend block  */
+    TC_TCB          *task;                  /* Task pointer              */
+    STATUS          preempt;                /* Preempt flag              */
+    STATUS          status = NU_SUCCESS;    /* Completion status         */
+    NU_SUPERV_USER_VARIABLES
+
+    /* Move input queue pointer into internal pointer. */
+    queue =  (PQ_PQCB *) queue_ptr;
+
+    /* Determine if there is an error with the queue pointer. */
+    NU_ERROR_CHECK((queue == NU_NULL), status, NU_INVALID_QUEUE);
+
+    /* Determine if the queue pointer is valid. */
+    NU_ERROR_CHECK((queue -> pq_id != PQ_POINTER_QUEUE_ID), status, NU_INVALID_QUEUE);
+
+    /* Determine if the message pointer is valid. */
+    NU_ERROR_CHECK((message == NU_NULL), status, NU_INVALID_POINTER);
+
+    /* Verify that suspension is only allowed. */
+    NU_ERROR_CHECK(((suspend) && (TCCE_Suspend_Error())), status, NU_INVALID_SUSPEND);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Call stack checking function to check for an overflow condition.  */
+        (VOID)NU_Check_Stack();
+
+        /* Protect against simultaneous access to the queue.  */
+        TCCT_Schedule_Lock();
+
+        /* Determine if a task is waiting on an empty queue.  */
+        if ((queue -> pq_suspension_list) && (queue -> pq_messages == 0))
+        {
+            /* Decrement the number of tasks waiting on queue.  */
+            queue -> pq_tasks_waiting--;
+
+            /* Remove the first suspended block from the list.  */
+            suspend_ptr =  queue -> pq_suspension_list;
+            NU_Remove_From_List((CS_NODE **) &(queue -> pq_suspension_list),
+                                &(suspend_ptr -> pq_suspend_link));
+
+            /* Hand the pointer directly to the waiting task.  */
+            suspend_ptr -> pq_message =        message;
+            suspend_ptr -> pq_return_status =  NU_SUCCESS;
+
+            /* Wakeup the waiting task and check for preemption.  */
+            preempt =
+                TCC_Resume_Task((NU_TASK *) suspend_ptr -> pq_suspended_task,
+                                NU_QUEUE_SUSPEND);
+
+            /* Determine if preemption needs to take place. */
+            if (preempt)
+            {
+                /* Transfer control to the system if the resumed task function
+                   detects a preemption condition.  */
+                TCCT_Control_To_System();
+            }
+        }
+        else if (queue -> pq_messages < queue -> pq_queue_size)
+        {
+            /* There is room in the queue and no task is waiting.  */
+            queue -> pq_start[queue -> pq_write] =  message;
+
+            /* Advance the write index, wrapping at the end of the area.  */
+            if (++(queue -> pq_write) == queue -> pq_queue_size)
+            {
+                queue -> pq_write =  0;
+            }
+
+            /* Increment the number of messages in the queue.  */
+            queue -> pq_messages++;
+        }
+        else if (suspend)
+        {
+            /* Queue is full and suspension is requested.  */
+
+            /* Increment the number of tasks waiting.  */
+            queue -> pq_tasks_waiting++;
+
+            /* Setup the suspend block and suspend the calling task.  */
+            suspend_ptr =  &suspend_block;
+            suspend_ptr -> pq_queue =                    queue;
+            suspend_ptr -> pq_suspend_link.cs_next =     NU_NULL;
+            suspend_ptr -> pq_suspend_link.cs_previous = NU_NULL;
+            suspend_ptr -> pq_message =                  message;
+            task =                            (TC_TCB *) TCCT_Current_Thread();
+            suspend_ptr -> pq_suspended_task =           task;
+
+            /* Determine if priority or FIFO suspension is associated with the
+               queue.  */
+            if (queue -> pq_fifo_suspend)
+            {
+                /* FIFO suspension is required.  Link the suspend block into
+                   the list of suspended tasks on this queue.  */
+                NU_Place_On_List((CS_NODE **) &(queue -> pq_suspension_list),
+                                 &(suspend_ptr -> pq_suspend_link));
+            }
+            else
+            {
+                /* Get the priority of the current thread so the suspend block
+                   can be placed in the appropriate place.  */
+                suspend_ptr -> pq_suspend_link.cs_priority =
+                                                 TCC_Task_Priority(task);
+
+                NU_Priority_Place_On_List((CS_NODE **)
+                                          &(queue -> pq_suspension_list),
+                                          &(suspend_ptr -> pq_suspend_link));
+            }
+
+            /* Finally, suspend the calling task. Note that the suspension call
+               automatically clears the protection on the queue.  */
+            TCC_Suspend_Task((NU_TASK *) task, NU_QUEUE_SUSPEND,
+                             PQC_Cleanup, suspend_ptr, suspend);
+
+            /* Pickup the return status.  */
+            status =  suspend_ptr -> pq_return_status;
+        }
+        else
+        {
+            /* Return a status of NU_QUEUE_FULL because there is no
+               room in the queue for the message.  */
+            status =  NU_QUEUE_FULL;
+        }
+
+        /* Release protection against access to the queue.  */
+        TCCT_Schedule_Unlock();
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    /* Return the completion status.  */
+    return(status);
+}
+
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Receive_From_Pointer_Queue
+*
+*   DESCRIPTION
+*
+*       This function receives a pointer from the specified pointer
+*       queue.  If the queue is full and a sender is suspended, the
+*       pointer of the first waiting sender is placed in the queue and
+*       the sender is resumed.  If the queue is empty, suspension of the
+*       calling task is an option of the caller.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       NU_Place_On_List                    Place on suspend list
+*       NU_Priority_Place_On_List           Place on priority list
+*       NU_Remove_From_List                 Remove from suspend list
+*       TCC_Resume_Task                     Resume a suspended task
+*       TCC_Suspend_Task                    Suspend calling task
+*       TCC_Task_Priority                   Pickup task's priority
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*       TCCT_Control_To_System              Transfer control to system
+*       TCCT_Current_Thread                 Pickup current thread
+*                                           pointer
+*       TCCT_Schedule_Lock                  Protect queue
+*       TCCT_Schedule_Unlock                Release protection
+*
+*   INPUTS
+*
+*       queue_ptr                           Pointer queue control block
+*                                           pointer
+*       message                             Destination for the pointer
+*       suspend                             Suspension option if empty
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS                      If service is successful
+*           NU_QUEUE_EMPTY                  If queue is currently empty
+*           NU_TIMEOUT                      If timeout on service
+*                                           expires
+*           NU_QUEUE_DELETED                If queue was deleted during
+*                                           suspension
+*           NU_INVALID_QUEUE                Invalid queue pointer
+*           NU_INVALID_POINTER              Invalid message pointer
+*           NU_INVALID_SUSPEND              Invalid suspend request
+*
+***********************************************************************/
+STATUS NU_Receive_From_Pointer_Queue(NU_POINTER_QUEUE *queue_ptr, VOID **message,
+                                     UNSIGNED suspend)
+{
+    R1 PQ_PQCB      *queue;                 /* Queue control block ptr   */
+    PQ_SUSPEND      suspend_block;          /* Allocate suspension block */
+    PQ_SUSPEND      *suspend_ptr;           /* Pointer to suspend block  */
+    TC_TCB          *task;                  /* Task pointer              */
+    STATUS          preempt;                /* Preemption flag           */
+    STATUS          status = NU_SUCCESS;    /* Completion status         */
+    NU_SUPERV_USER_VARIABLES
+
+    /* Move input queue pointer into internal pointer.  */
+    queue =  (PQ_PQCB *) queue_ptr;
+
+    /* Determine if there is an error with the queue pointer.  */
+    NU_ERROR_CHECK((queue == NU_NULL), status, NU_INVALID_QUEUE);
+
+    /* Determine if the queue pointer is valid. */
+    NU_ERROR_CHECK((queue -> pq_id != PQ_POINTER_QUEUE_ID), status, NU_INVALID_QUEUE);
+
+    /* Determine if the pointer to the destination is valid. */
+    NU_ERROR_CHECK((message == NU_NULL), status, NU_INVALID_POINTER);
+
+    /* Verify that suspension is only allowed. */
+    NU_ERROR_CHECK(((suspend) && (TCCE_Suspend_Error())), status, NU_INVALID_SUSPEND);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Call stack checking function to check for an overflow condition.  */
+        (VOID)NU_Check_Stack();
+
+        /* Protect against simultaneous access to the queue.  */
+        TCCT_Schedule_Lock();
+
+        /* Determine if there are messages in the queue.  */
+        if (queue -> pq_messages)
+        {
+            /* Return the oldest pointer in the queue.  */
+            *message =  queue -> pq_start[queue -> pq_read];
+
+            /* Advance the read index, wrapping at the end of the area.  */
+            if (++(queue -> pq_read) == queue -> pq_queue_size)
+            {
+                queue -> pq_read =  0;
+            }
+
+            /* Determine if a task is suspended on the full queue.  */
+            if (queue -> pq_suspension_list)
+            {
+                /* Decrement the number of tasks waiting counter.  */
+                queue -> pq_tasks_waiting--;
+
+                /* Remove the first suspended block from the list.  */
+                suspend_ptr =  queue -> pq_suspension_list;
+                NU_Remove_From_List((CS_NODE **) &(queue -> pq_suspension_list),
+                                    &(suspend_ptr -> pq_suspend_link));
+
+                /* Place the suspended task's pointer in the slot just freed.
+                   The number of messages in the queue is unchanged.  */
+                queue -> pq_start[queue -> pq_write] =  suspend_ptr -> pq_message;
+
+                if (++(queue -> pq_write) == queue -> pq_queue_size)
+                {
+                    queue -> pq_write =  0;
+                }
+
+                /* Return a successful status.  */
+                suspend_ptr -> pq_return_status =  NU_SUCCESS;
+
+                /* Resume the suspended task and check for preemption.  */
+                preempt =
+                    TCC_Resume_Task((NU_TASK *) suspend_ptr -> pq_suspended_task,
+                                    NU_QUEUE_SUSPEND);
+
+                /* Determine if a preempt condition is present.  */
+                if (preempt)
+                {
+                    /* Transfer control to the system if the resumed task
+                       function detects a preemption condition.  */
+                    TCCT_Control_To_System();
+                }
+            }
+            else
+            {
+                /* Decrement the number of messages in the queue.  */
+                queue -> pq_messages--;
+            }
+        }
+        else if (suspend)
+        {
+            /* Queue is empty and suspension is requested.  */
+
+            /* Increment the number of tasks waiting on the queue counter. */
+            queue -> pq_tasks_waiting++;
+
+            /* Setup the suspend block and suspend the calling task.  */
+            suspend_ptr =  &suspend_block;
+            suspend_ptr -> pq_queue =                    queue;
+            suspend_ptr -> pq_suspend_link.cs_next =     NU_NULL;
+            suspend_ptr -> pq_suspend_link.cs_previous = NU_NULL;
+            suspend_ptr -> pq_message =                  NU_NULL;
+            task =                            (TC_TCB *) TCCT_Current_Thread();
+            suspend_ptr -> pq_suspended_task =           task;
+
+            /* Determine if priority or FIFO suspension is associated with the
+               queue.  */
+            if (queue -> pq_fifo_suspend)
+            {
+                /* FIFO suspension is required.  Link the suspend block into
+                   the list of suspended tasks on this queue.  */
+                NU_Place_On_List((CS_NODE **) &(queue -> pq_suspension_list),
+                                 &(suspend_ptr -> pq_suspend_link));
+            }
+            else
+            {
+                /* Get the priority of the current thread so the suspend block
+                   can be placed in the appropriate place.  */
+                suspend_ptr -> pq_suspend_link.cs_priority =
+                                                    TCC_Task_Priority(task);
+
+                NU_Priority_Place_On_List((CS_NODE **)
+                                          &(queue -> pq_suspension_list),
+                                          &(suspend_ptr -> pq_suspend_link));
+            }
+
+            /* Finally, suspend the calling task. Note that the suspension call
+               automatically clears the protection on the queue.  */
+            TCC_Suspend_Task((NU_TASK *) task, NU_QUEUE_SUSPEND,
+                             PQC_Cleanup, suspend_ptr, suspend);
+
+            /* Pickup the status of the request and the pointer handed over
+               by the sender.  */
+            status =  suspend_ptr -> pq_return_status;
+
+            if (status == NU_SUCCESS)
+            {
+                *message =  suspend_ptr -> pq_message;
+            }
+        }
+        else
+        {
+            /* Return a status of NU_QUEUE_EMPTY because there are no
+               messages in the queue.  */
+            status =  NU_QUEUE_EMPTY;
+        }
+
+        /* Release protection against access to the queue.  */
+        TCCT_Schedule_Unlock();
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    /* Return the completion status.  */
+    return(status);
+}
+
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       PQC_Cleanup
+*
+*   DESCRIPTION
+*
+*       This function is responsible for removing a suspension block
+*       from a pointer queue.  It is not called unless a timeout or a
+*       task terminate is in progress.  Note that protection is already
+*       in effect - the same protection at suspension time.  This
+*       routine must be called from Supervisor mode in Supervisor/User
+*       mode switching kernels.
+*
+*   CALLED BY
+*
+*       TCC_Task_Timeout                    Task timeout
+*       NU_Terminate_Task                   Task terminate
+*
+*   CALLS
+*
+*       NU_Remove_From_List                 Remove suspend block from
+*                                           the suspension list
+*
+*   INPUTS
+*
+*       information                         Pointer to suspend block
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID  PQC_Cleanup(VOID *information)
+{
+    PQ_SUSPEND      *suspend_ptr;           /* Suspension block pointer  */
+    NU_SUPERV_USER_VARIABLES
+
+
+    /* Switch to supervisor mode */
+    NU_SUPERVISOR_MODE();
+
+    /* Use the information pointer as a suspend pointer.  */
+    suspend_ptr =  (PQ_SUSPEND *) information;
+
+    /* By default, indicate that the service timed-out.  It really does not
+       matter if this function is called from a terminate request since
+       the task does not resume.  */
+    suspend_ptr -> pq_return_status =  NU_TIMEOUT;
+
+    /* Decrement the number of tasks waiting counter.  */
+    (suspend_ptr -> pq_queue) -> pq_tasks_waiting--;
+
+    /* Unlink the suspend block from the suspension list.  */
+    NU_Remove_From_List((CS_NODE **)
+                        &((suspend_ptr -> pq_queue) -> pq_suspension_list),
+                        &(suspend_ptr -> pq_suspend_link));
+
+    /* Return to user mode */
+    NU_USER_MODE();
+}
+
+#endif  /* NU_POINTER_QUEUES == NU_TRUE */
@@ -0,0 +1,169 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       pqc_delete.c
+*
+*   COMPONENT
+*
+*       PQ - Pointer Queue Management
+*
+*   DESCRIPTION
+*
+*       This file contains the core Delete routine for the
+*       Pointer Queue management component.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       NU_Delete_Pointer_Queue             Delete a pointer queue
+*
+*   DEPENDENCIES
+*
+*       nucleus.h                           Nucleus System constants
+*       nu_kernel.h                         Kernel constants
+*       thread_control.h                    Thread Control functions
+*       pointer_queue.h                     Pointer Queue functions
+*
+***********************************************************************/
+#include        "nucleus.h"
+#include        "kernel/nu_kernel.h"
+#include        "os/kernel/plus/core/inc/thread_control.h"
+#include        "os/kernel/plus/core/inc/pointer_queue.h"
+
+#if (NU_POINTER_QUEUES == NU_TRUE)
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Delete_Pointer_Queue
+*
+*   DESCRIPTION
+*
+*       This function deletes a pointer queue.  All tasks suspended on
+*       the queue are resumed.  Note that this function does not free
+*       the memory associated with the queue or the pointers left in it.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       TCC_Resume_Task                     Resume a suspended task
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*       TCCT_Control_To_System              Transfer control to system
+*       TCCT_Schedule_Lock                  Protect queue
+*       TCCT_Schedule_Unlock                Release protection
+*
+*   INPUTS
+*
+*       queue_ptr                           Pointer queue control block
+*                                           pointer
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*       NU_INVALID_QUEUE                    Invalid queue pointer
+*
+***********************************************************************/
+STATUS NU_Delete_Pointer_Queue(NU_POINTER_QUEUE *queue_ptr)
+{
+    R1 PQ_PQCB      *queue;                 /* Queue control block ptr   */
+    PQ_SUSPEND      *suspend_ptr;           /* Suspend block pointer     */
+    PQ_SUSPEND      *next_ptr;              /* Next suspend block pointer*/
+    STATUS          preempt;                /* Status for resume call    */
+    STATUS          status = NU_SUCCESS;
+    NU_SUPERV_USER_VARIABLES
+
+    /* Move input queue pointer into internal pointer. */
+    queue =  (PQ_PQCB *) queue_ptr;
+
+    /* Determine if there is an error with the queue pointer. */
+    NU_ERROR_CHECK((queue == NU_NULL), status, NU_INVALID_QUEUE);
+
+    /* Determine if the queue pointer is valid. */
+    NU_ERROR_CHECK((queue -> pq_id != PQ_POINTER_QUEUE_ID), status, NU_INVALID_QUEUE);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Call stack checking function to check for an overflow condition.  */
+        (VOID)NU_Check_Stack();
+
+        /* Protect against access to the queue.  */
+        TCCT_Schedule_Lock();
+
+        /* Clear the queue ID.  */
+        queue -> pq_id =  0;
+
+        /* Pickup the suspended task pointer list.  */
+        suspend_ptr =  queue -> pq_suspension_list;
+
+        /* Walk the chain task(s) currently suspended on the queue.  */
+        preempt =  0;
+        while (suspend_ptr)
+        {
+            /* Resume the suspended task.  Insure that the status returned is
+               NU_QUEUE_DELETED.  */
+            suspend_ptr -> pq_return_status =  NU_QUEUE_DELETED;
+
+            /* Point to the next suspend structure in the link.  */
+            next_ptr =  (PQ_SUSPEND *) (suspend_ptr -> pq_suspend_link.cs_next);
+
+            /* Resume the specified task.  */
+            preempt =  preempt |
+                TCC_Resume_Task((NU_TASK *) suspend_ptr -> pq_suspended_task,
+                                NU_QUEUE_SUSPEND);
+
+            /* Determine if the next is the same as the head pointer.  */
+            if (next_ptr == queue -> pq_suspension_list)
+            {
+                /* Clear the suspension pointer to signal the end of the list
+                   traversal.  */
+                suspend_ptr =  NU_NULL;
+            }
+            else
+            {
+                /* Position suspend pointer to the next pointer.  */
+                suspend_ptr =  next_ptr;
+            }
+        }
+
+        /* Determine if preemption needs to occur.  */
+        if (preempt)
+        {
+            /* Transfer control to system to facilitate preemption.  */
+            TCCT_Control_To_System();
+        }
+
+        /* Release protection against access to the queue.  */
+        TCCT_Schedule_Unlock();
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    /* Return a successful completion.  */
+    return(status);
+}
+
+#endif  /* NU_POINTER_QUEUES == NU_TRUE */
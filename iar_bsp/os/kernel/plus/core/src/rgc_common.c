@@ -0,0 +1,368 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       rgc_common.c
+*
+*   COMPONENT
+*
+*       RG - Ring Management
+*
+*   DESCRIPTION
+*
+*       This file contains the core common routines for the Ring
+*       management component.  A ring passes pointers from a single
+*       producer, typically a LISR, to a single consumer, a HISR or
+*       task, without disabling interrupts.  The producer only writes
+*       the tail index and the consumer only writes the head index, so
+*       neither side ever waits for the other.
+*
+*       The optional wake-up object is signalled only when the ring
+*       goes from empty to non-empty.  The consumer waits on it after
+*       NU_Receive_From_Ring has returned fewer items than requested.
+*       Only a HISR may be woken from a LISR - event groups and
+*       semaphores may only be used when the producer is a HISR or task.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       NU_Create_Ring                      Create a ring
+*       NU_Send_To_Ring                     Send an item to a ring
+*       NU_Receive_From_Ring                Receive items from a ring
+*
+*   DEPENDENCIES
+*
+*       nucleus.h                           Nucleus System constants
+*       nu_kernel.h                         Kernel constants
+*       common_services.h                   Common service constants
+*       ring.h                              Ring functions
+*
+***********************************************************************/
+#include        "nucleus.h"
+#include        "kernel/nu_kernel.h"
+#include        "os/kernel/plus/core/inc/common_services.h"
+#include        "os/kernel/plus/core/inc/ring.h"
+#include        <string.h>
+
+#if (NU_SPSC_RINGS == NU_TRUE)
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Create_Ring
+*
+*   DESCRIPTION
+*
+*       This function creates a ring.  The ring area holds ring_size
+*       pointers, which must be a power of two.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*
+*   INPUTS
+*
+*       ring_ptr                            Ring control block pointer
+*       name                                Ring name
+*       start_address                       Starting address of actual
+*                                           ring area
+*       ring_size                           Number of pointers the ring
+*                                           area holds
+*       wake_type                           NU_RING_WAKE_NONE,
+*                                           NU_RING_WAKE_HISR,
+*                                           NU_RING_WAKE_EVENTS or
+*                                           NU_RING_WAKE_SEMAPHORE
+*       wake_object                         HISR, event group or
+*                                           semaphore to wake
+*       wake_events                         Events set for
+*                                           NU_RING_WAKE_EVENTS
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*       NU_INVALID_QUEUE                    Invalid ring pointer
+*       NU_INVALID_MEMORY                   Invalid ring starting addr
+*       NU_INVALID_SIZE                     Ring size is not a power of
+*                                           two
+*       NU_INVALID_OPERATION                Invalid wake-up type
+*       NU_INVALID_POINTER                  Missing wake-up object
+*       NU_NOT_ALIGNED                      Start address is not aligned
+*
+***********************************************************************/
+STATUS NU_Create_Ring(NU_RING *ring_ptr, CHAR *name,
+                      VOID **start_address, UNSIGNED ring_size,
+                      OPTION wake_type, VOID *wake_object,
+                      UNSIGNED wake_events)
+{
+    R1 RG_RCB       *ring;                  /* Ring control block ptr    */
+    STATUS          status = NU_SUCCESS;
+    NU_SUPERV_USER_VARIABLES
+
+    /* Move input ring pointer into internal pointer. */
+    ring =  (RG_RCB *) ring_ptr;
+
+    /* Determine if there is an error with the ring pointer. */
+    NU_ERROR_CHECK(((ring == NU_NULL) || (ring -> rg_id == RG_RING_ID)), status, NU_INVALID_QUEUE);
+
+    /* Determine if the starting address of the ring is valid. */
+    NU_ERROR_CHECK((start_address == NU_NULL), status, NU_INVALID_MEMORY);
+
+    /* Verify the start address is aligned */
+    NU_ERROR_CHECK((ESAL_GE_MEM_ALIGNED_CHECK(start_address, sizeof(VOID *)) == NU_FALSE), status, NU_NOT_ALIGNED);
+
+    /* Verify that the size is a non-zero power of two. */
+    NU_ERROR_CHECK(((ring_size == 0) || ((ring_size & (ring_size - 1)) != 0)), status, NU_INVALID_SIZE);
+
+    /* Determine if the wake-up type is valid. */
+    NU_ERROR_CHECK((wake_type > NU_RING_WAKE_SEMAPHORE), status, NU_INVALID_OPERATION);
+
+    /* Determine if a wake-up object is supplied when required. */
+    NU_ERROR_CHECK(((wake_type != NU_RING_WAKE_NONE) && (wake_object == NU_NULL)), status, NU_INVALID_POINTER);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Call stack checking function to check for an overflow condition.  */
+        (VOID)NU_Check_Stack();
+
+        /* Clear the control block */
+        CSC_Clear_CB(ring, RG_RCB);
+
+        /* Fill in the ring name. */
+        strncpy(ring -> rg_name, name, (NU_MAX_NAME - 1));
+
+        /* Setup the ring parameters.  */
+        ring -> rg_start =          (VOID * volatile *) start_address;
+        ring -> rg_mask =           ring_size - 1;
+        ring -> rg_wake_type =      wake_type;
+        ring -> rg_wake_object =    wake_object;
+        ring -> rg_wake_events =    wake_events;
+
+        /* At this point the ring is completely built.  The ID can now be
+           set.  */
+        ring -> rg_id =             RG_RING_ID;
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    /* Return the completion status.  */
+    return(status);
+}
+
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Send_To_Ring
+*
+*   DESCRIPTION
+*
+*       This function places an item at the tail of the ring.  It never
+*       suspends or disables interrupts and may be called from a LISR.
+*       The wake-up object of the ring is signalled if the ring was
+*       empty.  Only the single producer of the ring may call this
+*       function.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       NU_Activate_HISR                    Wake a HISR
+*       NU_Set_Events                       Wake an event group
+*       NU_Release_Semaphore                Wake a semaphore
+*
+*   INPUTS
+*
+*       ring_ptr                            Ring control block pointer
+*       item                                Pointer to send
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS                      If service is successful
+*           NU_QUEUE_FULL                   If ring is currently full
+*           NU_INVALID_QUEUE                Invalid ring pointer
+*
+***********************************************************************/
+STATUS NU_Send_To_Ring(NU_RING *ring_ptr, VOID *item)
+{
+    R1 RG_RCB       *ring;                  /* Ring control block ptr    */
+    R2 UNSIGNED     tail;                   /* Producer index            */
+    UNSIGNED        count;                  /* Items in the ring         */
+    STATUS          status = NU_SUCCESS;    /* Completion status         */
+
+    /* Move input ring pointer into internal pointer. */
+    ring =  (RG_RCB *) ring_ptr;
+
+    /* Determine if there is an error with the ring pointer. */
+    NU_ERROR_CHECK(((ring == NU_NULL) || (ring -> rg_id != RG_RING_ID)), status, NU_INVALID_QUEUE);
+
+    if (status == NU_SUCCESS)
+    {
+        tail =   ring -> rg_tail;
+        count =  tail - ring -> rg_head;
+
+        /* Determine if the ring is full.  */
+        if (count > ring -> rg_mask)
+        {
+            ring -> rg_overflows++;
+            status =  NU_QUEUE_FULL;
+        }
+        else
+        {
+            /* Store the item before the tail is moved past it.  */
+            ring -> rg_start[tail & ring -> rg_mask] =  item;
+            ESAL_GE_RTE_COMPILE_MEM_BARRIER();
+            ring -> rg_tail =  tail + 1;
+
+            /* Track the highest fill level.  */
+            if (++count > ring -> rg_peak)
+            {
+                ring -> rg_peak =  count;
+            }
+
+            /* The head is read again after the item is published.  If the
+               consumer had already taken everything before it, the ring
+               was empty and the consumer must be woken.  */
+            if (ring -> rg_head == tail)
+            {
+                if (ring -> rg_wake_type == NU_RING_WAKE_HISR)
+                {
+                    (VOID)NU_Activate_HISR((NU_HISR *) ring -> rg_wake_object);
+                }
+                else if (ring -> rg_wake_type == NU_RING_WAKE_EVENTS)
+                {
+                    (VOID)NU_Set_Events((NU_EVENT_GROUP *) ring -> rg_wake_object,
+                                        ring -> rg_wake_events, NU_OR);
+                }
+                else if (ring -> rg_wake_type == NU_RING_WAKE_SEMAPHORE)
+                {
+                    (VOID)NU_Release_Semaphore((NU_SEMAPHORE *) ring -> rg_wake_object);
+                }
+            }
+        }
+    }
+
+    /* Return the completion status.  */
+    return(status);
+}
+
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Receive_From_Ring
+*
+*   DESCRIPTION
+*
+*       This function removes up to maximum_items items from the head
+*       of the ring.  It never suspends or disables interrupts.  Only
+*       the single consumer of the ring may call this function.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       None
+*
+*   INPUTS
+*
+*       ring_ptr                            Ring control block pointer
+*       items                               Destination for the items
+*       maximum_items                       Size of the destination
+*       received                            Destination for the number
+*                                           of items received
+*
+*   OUTPUTS
+*
+*       status
+*           NU_SUCCESS                      If one or more items were
+*                                           received
+*           NU_QUEUE_EMPTY                  If ring is currently empty
+*           NU_INVALID_QUEUE                Invalid ring pointer
+*           NU_INVALID_POINTER              Invalid destination pointer
+*           NU_INVALID_SIZE                 Invalid maximum items
+*
+***********************************************************************/
+STATUS NU_Receive_From_Ring(NU_RING *ring_ptr, VOID **items,
+                            UNSIGNED maximum_items, UNSIGNED *received)
+{
+    R1 RG_RCB       *ring;                  /* Ring control block ptr    */
+    R2 UNSIGNED     head;                   /* Consumer index            */
+    UNSIGNED        count;                  /* Items to receive          */
+    UNSIGNED        index;                  /* Working index             */
+    STATUS          status = NU_SUCCESS;    /* Completion status         */
+
+    /* Move input ring pointer into internal pointer. */
+    ring =  (RG_RCB *) ring_ptr;
+
+    /* Determine if there is an error with the ring pointer. */
+    NU_ERROR_CHECK(((ring == NU_NULL) || (ring -> rg_id != RG_RING_ID)), status, NU_INVALID_QUEUE);
+
+    /* Determine if the destination pointers are valid. */
+    NU_ERROR_CHECK(((items == NU_NULL) || (received == NU_NULL)), status, NU_INVALID_POINTER);
+
+    /* Determine if the number of items is valid. */
+    NU_ERROR_CHECK((maximum_items == 0), status, NU_INVALID_SIZE);
+
+    if (status == NU_SUCCESS)
+    {
+        head =   ring -> rg_head;
+        count =  ring -> rg_tail - head;
+
+        if (count > maximum_items)
+        {
+            count =  maximum_items;
+        }
+
+        /* Copy the items out before the head is moved past them.  */
+        for (index = 0; index < count; index++)
+        {
+            items[index] =  ring -> rg_start[(head + index) & ring -> rg_mask];
+        }
+
+        ESAL_GE_RTE_COMPILE_MEM_BARRIER();
+        ring -> rg_head =  head + count;
+
+        *received =  count;
+
+        if (count == 0)
+        {
+            status =  NU_QUEUE_EMPTY;
+        }
+    }
+
+    /* Return the completion status.  */
+    return(status);
+}
+
+#endif  /* NU_SPSC_RINGS == NU_TRUE */
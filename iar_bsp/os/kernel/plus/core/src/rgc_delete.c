@@ -0,0 +1,110 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       rgc_delete.c
+*
+*   COMPONENT
+*
+*       RG - Ring Management
+*
+*   DESCRIPTION
+*
+*       This file contains the core Delete routine for the Ring
+*       management component.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       NU_Delete_Ring                      Delete a ring
+*
+*   DEPENDENCIES
+*
+*       nucleus.h                           Nucleus System constants
+*       nu_kernel.h                         Kernel constants
+*       ring.h                              Ring functions
+*
+***********************************************************************/
+#include        "nucleus.h"
+#include        "kernel/nu_kernel.h"
+#include        "os/kernel/plus/core/inc/ring.h"
+
+#if (NU_SPSC_RINGS == NU_TRUE)
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Delete_Ring
+*
+*   DESCRIPTION
+*
+*       This function deletes a ring.  The producer must no longer send
+*       to the ring.  Note that this function does not free the memory
+*       associated with the ring or the items left in it.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*
+*   INPUTS
+*
+*       ring_ptr                            Ring control block pointer
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*       NU_INVALID_QUEUE                    Invalid ring pointer
+*
+***********************************************************************/
+STATUS NU_Delete_Ring(NU_RING *ring_ptr)
+{
+    R1 RG_RCB       *ring;                  /* Ring control block ptr    */
+    STATUS          status = NU_SUCCESS;
+    NU_SUPERV_USER_VARIABLES
+
+    /* Move input ring pointer into internal pointer. */
+    ring =  (RG_RCB *) ring_ptr;
+
+    /* Determine if there is an error with the ring pointer. */
+    NU_ERROR_CHECK(((ring == NU_NULL) || (ring -> rg_id != RG_RING_ID)), status, NU_INVALID_QUEUE);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Call stack checking function to check for an overflow condition.  */
+        (VOID)NU_Check_Stack();
+
+        /* Clear the ring ID.  */
+        ring -> rg_id =  0;
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    /* Return a successful completion.  */
+    return(status);
+}
+
+#endif  /* NU_SPSC_RINGS == NU_TRUE */
@@ -0,0 +1,140 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       rgf_info.c
+*
+*   COMPONENT
+*
+*       RG - Ring Management
+*
+*   DESCRIPTION
+*
+*       This file contains the Information routine to obtain facts about
+*       a ring.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       NU_Ring_Information                 Retrieve ring information
+*
+*   DEPENDENCIES
+*
+*       nucleus.h                           Nucleus System constants
+*       nu_kernel.h                         Kernel constants
+*       ring.h                              Ring functions
+*
+***********************************************************************/
+#include        "nucleus.h"
+#include        "kernel/nu_kernel.h"
+#include        "os/kernel/plus/core/inc/ring.h"
+#include        <string.h>
+
+#if (NU_SPSC_RINGS == NU_TRUE)
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Ring_Information
+*
+*   DESCRIPTION
+*
+*       This function returns information about the specified ring,
+*       including its fill-level statistics.  The count is a snapshot
+*       and may change while the producer and consumer run.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       [NU_Check_Stack]                    Stack checking function
+*                                           (conditionally compiled)
+*
+*   INPUTS
+*
+*       ring_ptr                            Pointer to the ring
+*       name                                Destination for the name
+*       ring_size                           Destination for ring size
+*       count                               Destination for number of
+*                                           items in the ring
+*       peak_count                          Destination for highest
+*                                           number of items in the ring
+*       overflows                           Destination for number of
+*                                           sends to a full ring
+*
+*   OUTPUTS
+*
+*       completion
+*           NU_SUCCESS                      If a valid ring pointer
+*                                           is supplied
+*           NU_INVALID_QUEUE                If ring pointer invalid
+*
+***********************************************************************/
+STATUS NU_Ring_Information(NU_RING *ring_ptr, CHAR *name,
+                           UNSIGNED *ring_size, UNSIGNED *count,
+                           UNSIGNED *peak_count, UNSIGNED *overflows)
+{
+    RG_RCB          *ring;                  /* Ring control block ptr    */
+    UNSIGNED        head;                   /* Consumer index            */
+    STATUS          completion;             /* Completion status         */
+    NU_SUPERV_USER_VARIABLES
+
+    /* Switch to supervisor mode */
+    NU_SUPERVISOR_MODE();
+
+    /* Move input ring pointer into internal pointer.  */
+    ring =  (RG_RCB *) ring_ptr;
+
+    /* Call stack checking function to check for an overflow condition.  */
+    (VOID)NU_Check_Stack();
+
+    /* Determine if this ring id is valid.  */
+    if ((ring != NU_NULL) && (ring -> rg_id == RG_RING_ID))
+    {
+        /* The ring pointer is valid.  Reflect this in the completion
+           status and fill in the actual information.  */
+        completion =  NU_SUCCESS;
+
+        /* Copy the ring's name.  */
+        strncpy(name, ring -> rg_name, NU_MAX_NAME);
+
+        /* Get various information about the ring.  The head is read
+           first, so the count cannot appear negative if the producer
+           and consumer run in between.  */
+        head =          ring -> rg_head;
+        *ring_size =    ring -> rg_mask + 1;
+        *count =        ring -> rg_tail - head;
+        *peak_count =   ring -> rg_peak;
+        *overflows =    ring -> rg_overflows;
+    }
+    else
+    {
+        /* Indicate that the ring pointer is invalid.   */
+        completion =  NU_INVALID_QUEUE;
+    }
+
+    /* Return to user mode */
+    NU_USER_MODE();
+
+    /* Return the appropriate completion status.  */
+    return(completion);
+}
+
+#endif  /* NU_SPSC_RINGS == NU_TRUE */
@@ -38,6 +38,7 @@
 *       nu_kernel.h                         Kernel constants
 *       thread_control.h                           Thread Control functions
 *       timer.h                           Timer Control function
+*       mutex.h                             Mutex functions
 *
 ***********************************************************************/
 #include        "nucleus.h"
@@ -46,6 +47,7 @@
 #include        "os/kernel/plus/core/inc/timer.h"
 #include        "services/nu_trace_os_mark.h"
 #include        "os/kernel/plus/core/inc/semaphore.h"
+#include        "os/kernel/plus/core/inc/mutex.h"
 
 /***********************************************************************
 *
@@ -108,6 +110,17 @@ STATUS NU_Terminate_Task(NU_TASK *task_ptr)
         /* Protect system  data structures.  */
         TCCT_Schedule_Lock();
 
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+
+        /* Release all ceiling mutexes owned by the task being terminated,
+           most recently obtained first */
+        while (task -> tc_mutex_list != NU_NULL)
+        {
+            MXC_Kill_Mutex_Owner(task -> tc_mutex_list, (NU_TASK *) task);
+        }
+
+#endif  /* NU_CEILING_MUTEXES == NU_TRUE */
+
         /* Release all priority mutexes owned by the task being terminated */
         while (task -> tc_semaphore_count != 0)
         {
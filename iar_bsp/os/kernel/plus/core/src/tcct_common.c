@@ -124,6 +124,9 @@ VOID  TCCT_Schedule(VOID)
 
     TCD_Return_To_Scheduler = NU_FALSE;
 
+    /* Charge the thread that gave up the processor */
+    TCC_CPU_USAGE_SWITCH_OUT(TCD_Current_Thread);
+
     /* Clear the current thread pointer variable */
     TCD_Current_Thread = NU_NULL;
 
@@ -179,6 +182,9 @@ VOID  TCCT_Schedule(VOID)
     /* Increment this thread's scheduled count */
     current_thread -> tc_scheduled++;
 
+    /* Start the run slice of this thread */
+    TCC_CPU_USAGE_SWITCH_IN(current_thread);
+
 #if (NU_STACK_CHECKING == NU_TRUE) && (NU_STACK_FILL == NU_TRUE)
 
     /* Check if last byte in stack has correct pattern */
@@ -648,12 +654,19 @@ VOID    **TCCT_Dispatch_LISR(INT vector, VOID *stack_pointer)
 {
     /* Indicate that ISR is started */
     ESAL_GE_ISR_START();
+
+    /* Charge the interrupted thread */
+    TCC_CPU_USAGE_LISR_ENTRY();
+
 #if (defined(CFG_NU_OS_SVCS_PWR_ENABLE) && (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_IDLE == NU_TRUE))
     PMS_CPU_Wakeup(vector);
 #endif
     /* Execute ISR Handler for this vector */
     ESAL_GE_ISR_HANDLER_EXECUTE(vector);
 
+    /* Charge the LISR */
+    TCC_CPU_USAGE_LISR_EXIT();
+
     /* Indicate that ISR is ended */
     ESAL_GE_ISR_END();
 
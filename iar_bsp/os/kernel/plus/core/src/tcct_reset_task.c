@@ -128,6 +128,13 @@ STATUS NU_Reset_Task(NU_TASK *task_ptr, UNSIGNED argc, VOID *argv)
             task -> tc_delayed_suspend =        NU_FALSE;
             task -> tc_scheduled =              0;
 
+    #if (NU_CPU_ACCOUNTING == NU_TRUE)
+
+            /* Clear the CPU usage of the task */
+            ESAL_GE_MEM_Set(&task -> tc_cpu_usage, 0, sizeof(TC_CPU_USAGE));
+
+    #endif  /* NU_CPU_ACCOUNTING == NU_TRUE */
+
 
     #if (NU_STACK_FILL == NU_TRUE)
 
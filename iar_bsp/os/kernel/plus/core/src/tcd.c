@@ -62,6 +62,13 @@
 *                                           unhandled interrupt in
 *                                           system error conditions
 *       TCD_Protect_Save                    Saved state of NU_Protect
+*       [TCD_CPU_Stamp]                     Cycle count at the last CPU
+*                                           usage accounting point
+*       [TCD_CPU_Slice_Start]               Cycle count when the current
+*                                           thread was scheduled
+*       [TCD_CPU_Idle_Cycles]               Cycles spent idle
+*       [TCD_CPU_LISR_Cycles]               Cycles spent in LISRs
+*                                           (conditionally compiled)
 *
 *   FUNCTIONS
 *
@@ -259,3 +266,27 @@ VOID                *TCD_Unhandled_Exception_SP;
 /* Used to save the state of interrupts when NU_Protect is called, and restore
    the saved state in NU_Unprotect */
 INT                 TCD_Protect_Save;
+
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+
+/* TCD_CPU_Stamp contains the cycle count at the last CPU usage accounting
+   point.  The cycles since then are charged to the current thread, a LISR
+   or idle at the next accounting point.  */
+
+UINT32              TCD_CPU_Stamp;
+
+/* TCD_CPU_Slice_Start contains the cycle count when the current thread was
+   scheduled.  */
+
+UINT32              TCD_CPU_Slice_Start;
+
+/* TCD_CPU_Idle_Cycles contains the cycles spent with no thread executing,
+   including the time spent in the scheduler.  */
+
+UINT64              TCD_CPU_Idle_Cycles;
+
+/* TCD_CPU_LISR_Cycles contains the cycles spent in LISRs.  */
+
+UINT64              TCD_CPU_LISR_Cycles;
+
+#endif  /* NU_CPU_ACCOUNTING == NU_TRUE */
@@ -0,0 +1,291 @@
+/***********************************************************************
+*
+*            Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       tcf_cpu_usage.c
+*
+*   COMPONENT
+*
+*       TC - Thread Control
+*
+*   DESCRIPTION
+*
+*       This file contains the CPU usage information routines for the
+*       Thread Control component.  The usage is counted by the scheduler
+*       and the LISR dispatcher when NU_CPU_ACCOUNTING is enabled.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       NU_Thread_CPU_Usage                 Retrieve thread CPU usage
+*       NU_CPU_Usage_System                 Retrieve idle and LISR CPU
+*                                           usage
+*       NU_CPU_Usage_Reset                  Restart CPU usage counting
+*
+*   DEPENDENCIES
+*
+*       nucleus.h                           Nucleus System constants
+*       nu_kernel.h                         Kernel constants
+*       thread_control.h                    Thread Control functions
+*
+***********************************************************************/
+#include        "nucleus.h"
+#include        "kernel/nu_kernel.h"
+#include        "os/kernel/plus/core/inc/thread_control.h"
+
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+
+/* Define external inner-component global data references.  */
+
+extern CS_NODE              *TCD_Created_Tasks_List;
+extern CS_NODE              *TCD_Created_HISRs_List;
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Thread_CPU_Usage
+*
+*   DESCRIPTION
+*
+*       This function returns the CPU usage of the specified task or
+*       HISR since the usage was last reset.  Times are in cycles of the
+*       processor cycle counter.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       None
+*
+*   INPUTS
+*
+*       thread                              Pointer to the task or HISR
+*       cycles                              Destination for the cycles
+*                                           the thread ran
+*       switches                            Destination for the number
+*                                           of times it was scheduled
+*       max_slice                           Destination for its longest
+*                                           single run in cycles
+*
+*   OUTPUTS
+*
+*       completion
+*           NU_SUCCESS                      If a valid thread pointer is
+*                                           supplied
+*           NU_INVALID_TASK                 If thread pointer is invalid
+*           NU_INVALID_POINTER              If a destination is NU_NULL
+*
+***********************************************************************/
+STATUS NU_Thread_CPU_Usage(VOID *thread, UINT64 *cycles,
+                           UNSIGNED *switches, UINT32 *max_slice)
+{
+    TC_CPU_USAGE    *usage;                 /* Thread CPU usage          */
+    STATUS          completion = NU_SUCCESS;/* Completion status         */
+    NU_SUPERV_USER_VARIABLES
+
+    /* Verify the return pointers are valid */
+    NU_ERROR_CHECK(((cycles == NU_NULL) || (switches == NU_NULL) ||
+                    (max_slice == NU_NULL)), completion, NU_INVALID_POINTER);
+
+    if (completion == NU_SUCCESS)
+    {
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        /* Determine if this thread is valid.  */
+        if ((thread != NU_NULL) &&
+            ((((TC_TCB *) thread) -> tc_id == TC_TASK_ID) ||
+             (((TC_TCB *) thread) -> tc_id == TC_HISR_ID)))
+        {
+            usage = TCC_CPU_USAGE(thread);
+
+            {
+                /* The usage of the thread is updated by LISRs */
+                TCC_INTERRUPTS_DISABLE();
+
+                *cycles =       usage -> tc_cpu_cycles;
+                *switches =     usage -> tc_cpu_switches;
+                *max_slice =    usage -> tc_cpu_max_slice;
+
+                TCC_INTERRUPTS_RESTORE();
+            }
+        }
+        else
+        {
+            /* Indicate that the thread pointer is invalid.  */
+            completion =  NU_INVALID_TASK;
+        }
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    /* Return the appropriate completion status.  */
+    return(completion);
+}
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_CPU_Usage_System
+*
+*   DESCRIPTION
+*
+*       This function returns the cycles spent idle, including the time
+*       spent in the scheduler, and in LISRs since the usage was last
+*       reset.
+*
+*   CALLED BY
+*
+*       Application
+*
+*   CALLS
+*
+*       None
+*
+*   INPUTS
+*
+*       idle_cycles                         Destination for idle cycles
+*       lisr_cycles                         Destination for LISR cycles
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID NU_CPU_Usage_System(UINT64 *idle_cycles, UINT64 *lisr_cycles)
+{
+    NU_SUPERV_USER_VARIABLES
+
+    /* Switch to supervisor mode */
+    NU_SUPERVISOR_MODE();
+
+    {
+        /* The counters are updated by LISRs */
+        TCC_INTERRUPTS_DISABLE();
+
+        if (idle_cycles != NU_NULL)
+        {
+            *idle_cycles = TCD_CPU_Idle_Cycles;
+        }
+
+        if (lisr_cycles != NU_NULL)
+        {
+            *lisr_cycles = TCD_CPU_LISR_Cycles;
+        }
+
+        TCC_INTERRUPTS_RESTORE();
+    }
+
+    /* Return to user mode */
+    NU_USER_MODE();
+}
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_CPU_Usage_Reset
+*
+*   DESCRIPTION
+*
+*       This function starts the processor cycle counter and clears the
+*       CPU usage of all tasks and HISRs, idle and LISRs.  It is called
+*       during initialization and may be called by the application to
+*       measure the usage over an interval.
+*
+*   CALLED BY
+*
+*       Application
+*       INC_Initialize                      Main initialization routine
+*
+*   CALLS
+*
+*       None
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID NU_CPU_Usage_Reset(VOID)
+{
+    CS_NODE         *node_ptr;              /* Pointer to each thread    */
+    NU_SUPERV_USER_VARIABLES
+
+    /* Switch to supervisor mode */
+    NU_SUPERVISOR_MODE();
+
+#ifdef ESAL_AR_CYCLE_COUNT_ENABLE
+    /* Start the cycle counter */
+    ESAL_AR_CYCLE_COUNT_ENABLE();
+#endif
+
+    {
+        /* No thread can be created, deleted or scheduled while interrupts
+           are disabled */
+        TCC_INTERRUPTS_DISABLE();
+
+        node_ptr =  TCD_Created_Tasks_List;
+        while (node_ptr)
+        {
+            ESAL_GE_MEM_Set(&((TC_TCB *) node_ptr) -> tc_cpu_usage, 0, sizeof(TC_CPU_USAGE));
+
+            node_ptr =  node_ptr -> cs_next;
+
+            /* Determine if the pointer is at the head of the list.  */
+            if (node_ptr == TCD_Created_Tasks_List)
+            {
+                node_ptr =  NU_NULL;
+            }
+        }
+
+        node_ptr =  TCD_Created_HISRs_List;
+        while (node_ptr)
+        {
+            ESAL_GE_MEM_Set(&((TC_HCB *) node_ptr) -> tc_cpu_usage, 0, sizeof(TC_CPU_USAGE));
+
+            node_ptr =  node_ptr -> cs_next;
+
+            /* Determine if the pointer is at the head of the list.  */
+            if (node_ptr == TCD_Created_HISRs_List)
+            {
+                node_ptr =  NU_NULL;
+            }
+        }
+
+        TCD_CPU_Idle_Cycles =   0;
+        TCD_CPU_LISR_Cycles =   0;
+        TCD_CPU_Stamp =         TCC_CPU_CYCLES();
+        TCD_CPU_Slice_Start =   TCD_CPU_Stamp;
+
+        TCC_INTERRUPTS_RESTORE();
+    }
+
+    /* Return to user mode */
+    NU_USER_MODE();
+}
+
+#endif  /* NU_CPU_ACCOUNTING == NU_TRUE */
@@ -99,6 +99,23 @@ typedef enum
 /* Data structures and type definitions for Process Support */
 typedef VOID (*NU_PROC_ENTRY)(INT, VOID *);
 
+/* Hash index of an exported symbol table, laid out like a GNU hash
+   section.  The entries are sorted by bucket, each bucket being a run of
+   consecutive entries.  A bloom filter rejects most absent symbols
+   without touching the buckets. */
+typedef struct PROC_SYMBOL_HASH_STRUCT
+{
+    UINT32          bucket_mask;            /* Number of buckets - 1 */
+    UINT32          bloom_mask;             /* Number of bloom words - 1 */
+    UINT32         *bloom;                  /* Bloom filter words */
+    UINT32         *buckets;                /* First entry of each bucket */
+    UINT32         *chain;                  /* Hash of each entry, bit 0 set on the last entry of a bucket */
+    UINT32         *order;                  /* Symbol table index of each entry */
+} PROC_SYMBOL_HASH;
+
+/* Bucket with no entries */
+#define PROC_SYMBOL_HASH_EMPTY      0xFFFFFFFFUL
+
 struct PROC_CB_STRUCT
 {
     CS_NODE         created;                /* List of processes */
@@ -117,6 +134,10 @@ struct PROC_CB_STRUCT
     NU_SYMBOL_ENTRY*symbols;                /* Pointer to process linker symbol table */
     NU_SYMBOL_ENTRY*ksymbols;               /* Pointer to process kernel mode linker symbol table
                                                Used only when mode switching or MMU support is enabled */
+#if (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE)
+    PROC_SYMBOL_HASH *symbols_hash;         /* Hash index of the linker symbol table */
+    PROC_SYMBOL_HASH *ksymbols_hash;        /* Hash index of the kernel mode linker symbol table */
+#endif
     VOID           *load_addr;              /* Load address of process */
     NU_PROC_ENTRY   entry_addr;             /* Process entry address */
     NU_TASK         root_task;              /* Root thread used for entry/exit calls in process context */
@@ -184,6 +205,10 @@ STATUS PROC_Symbols_Use(PROC_CB * sym_owner, PROC_CB * sym_user);
 STATUS PROC_Symbols_Unuse(PROC_CB * sym_owner, PROC_CB * sym_user);
 STATUS PROC_Symbols_Unuse_All(PROC_CB * sym_user);
 BOOLEAN PROC_Symbols_In_Use(PROC_CB * sym_owner);
+#if (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE)
+STATUS  PROC_Symbols_Hash_Create(NU_SYMBOL_ENTRY * sym_table, PROC_SYMBOL_HASH ** sym_hash);
+VOID    PROC_Symbols_Hash_Delete(PROC_SYMBOL_HASH * sym_hash);
+#endif
 VOID    PROC_AR_Exception(INT exception_num, VOID *stack_frame);
 UNSIGNED PROC_Exception(VOID *exception_address, UNSIGNED exception_type, VOID *return_address, VOID *exception_information);
 
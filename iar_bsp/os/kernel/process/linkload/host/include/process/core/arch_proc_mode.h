@@ -0,0 +1,38 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       arch_proc_mode.h
+*
+*   DESCRIPTION
+*
+*       This file takes the place of the process mode switching header
+*       of the architecture for the host (Linux) build of the process
+*       symbol benchmark.  The benchmark runs in a single mode, so there
+*       is nothing to define.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   DEPENDENCIES
+*
+*       None
+*
+***********************************************************************/
+
+#ifndef ARCH_PROC_MODE_H
+#define ARCH_PROC_MODE_H
+
+#endif  /* ARCH_PROC_MODE_H */
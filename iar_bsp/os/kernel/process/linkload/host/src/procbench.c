@@ -0,0 +1,902 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       procbench.c
+*
+*   COMPONENT
+*
+*       PROCBENCH - Host Process Symbol Benchmark
+*
+*   DESCRIPTION
+*
+*       This file contains the process symbol benchmark of the host
+*       build.  It times the symbol work of loading a process with the
+*       symbols of proc_symbols.c:
+*
+*           procbench <kernel ELF> <module ELF> [loads]
+*
+*       The symbols defined in the dynamic symbol table of the kernel ELF
+*       are the exported symbols of the kernel process.  The symbols
+*       defined by the module ELF are the symbols it exports, and each
+*       relocation of the module against an undefined symbol is one
+*       lookup of PROC_Get_Exported_Symbol_Address, as made by the
+*       relocation handler of the architecture.  Each timed load checks
+*       the module symbols for duplicates with PROC_Validate_Symbols,
+*       resolves the relocations and, with the symbol hash, indexes the
+*       module symbols as PROC_Load does.
+*
+*       The time of each step of one load, the name comparisons of one
+*       load and the time taken to index the kernel symbols are output,
+*       with a checksum of the results.  The makefile builds the
+*       benchmark with the symbol hash and without it, and both must
+*       output the same checksum.
+*
+*   DATA STRUCTURES
+*
+*       PROCBENCH_ELF
+*       PROCBENCH_STEPS
+*       ProcBench_Kernel
+*       ProcBench_Module
+*       ProcBench_Compares
+*       PROC_Created_List
+*       TCD_Schedule_Lock
+*
+*   FUNCTIONS
+*
+*       main
+*       ProcBench_Strcmp
+*       PROC_Alloc
+*       PROC_Free
+*       PROC_Symbols_Use
+*       PROC_Symbols_Unuse
+*       PROC_Symbols_In_Use
+*       PROC_Get_Pointer
+*       NU_Getpid
+*       NU_Obtain_Semaphore
+*       NU_Release_Semaphore
+*       NU_Stop
+*       TCCT_Schedule_Unlock
+*       ProcBench_Time
+*       ProcBench_Read_ELF
+*       ProcBench_Symbols
+*       ProcBench_Undefined
+*       ProcBench_Load
+*
+*   DEPENDENCIES
+*
+*       elf.h
+*       stdio.h
+*       stdlib.h
+*       string.h
+*       time.h
+*       nucleus.h
+*       kernel/nu_kernel.h
+*       os/kernel/process/core/proc_core.h
+*       proc_linkload.h
+*
+***********************************************************************/
+
+#include <elf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nucleus.h"
+#include "kernel/nu_kernel.h"
+#include "os/kernel/process/core/proc_core.h"
+#include "proc_linkload.h"
+
+/* Number of loads timed by default */
+#define PROCBENCH_LOADS         10
+
+/* An ELF file read into memory, with its dynamic symbols */
+typedef struct _PROCBENCH_ELF
+{
+    UINT8          *image;
+    Elf64_Shdr     *sections;
+    UINT32          section_count;
+    UINT32          dynsym_index;
+    Elf64_Sym      *dynsym;
+    UINT32          dynsym_count;
+    const CHAR     *dynstr;
+} PROCBENCH_ELF;
+
+/* Time of each step of one load, in nanoseconds */
+typedef struct _PROCBENCH_STEPS
+{
+    UINT64          validate_ns;
+    UINT64          resolve_ns;
+    UINT64          index_ns;
+} PROCBENCH_STEPS;
+
+/* The kernel process and the process being loaded */
+STATIC PROC_CB          ProcBench_Kernel;
+STATIC PROC_CB          ProcBench_Module;
+
+/* Name comparisons made by proc_symbols.c */
+STATIC UINT32           ProcBench_Compares;
+
+/* The process list and scheduling lock of the kernel */
+CS_NODE                 *PROC_Created_List;
+BOOLEAN                 TCD_Schedule_Lock;
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       ProcBench_Strcmp
+*
+*   DESCRIPTION
+*
+*       This function compares two symbol names for proc_symbols.c,
+*       which the makefile builds to call it in place of strcmp, and
+*       counts the comparison.
+*
+*   INPUTS
+*
+*       name1                   The first name.
+*       name2                   The second name.
+*
+*   OUTPUTS
+*
+*       As for strcmp.
+*
+***********************************************************************/
+int ProcBench_Strcmp(const char *name1, const char *name2)
+{
+    ProcBench_Compares++;
+
+    return (strcmp(name1, name2));
+
+} /* ProcBench_Strcmp */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       PROC_Alloc
+*
+*   DESCRIPTION
+*
+*       This function allocates memory from the C library for the
+*       symbol hash indexes.
+*
+*   INPUTS
+*
+*       pointer                 Where the memory is returned.
+*       size                    Size of the memory in bytes.
+*       alignment               Not used.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The memory was allocated.
+*       NU_NO_MEMORY            The memory was not available.
+*
+***********************************************************************/
+STATUS PROC_Alloc(VOID **pointer, UINT32 size, UINT32 alignment)
+{
+    NU_UNUSED_PARAM(alignment);
+
+    *pointer = malloc(size);
+
+    return ((*pointer != NU_NULL) ? NU_SUCCESS : NU_NO_MEMORY);
+
+} /* PROC_Alloc */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       PROC_Free
+*
+*   DESCRIPTION
+*
+*       This function frees memory allocated by PROC_Alloc.
+*
+*   INPUTS
+*
+*       pointer                 The memory.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+***********************************************************************/
+STATUS PROC_Free(VOID *pointer)
+{
+    free(pointer);
+
+    return (NU_SUCCESS);
+
+} /* PROC_Free */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       PROC_Symbols_Use
+*
+*   DESCRIPTION
+*
+*       This function records the use of the symbols of one process by
+*       another.  The benchmark has nothing to record.
+*
+*   INPUTS
+*
+*       sym_owner               Process that owns the symbols.
+*       sym_user                Process that uses them.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+***********************************************************************/
+STATUS PROC_Symbols_Use(PROC_CB *sym_owner, PROC_CB *sym_user)
+{
+    NU_UNUSED_PARAM(sym_owner);
+    NU_UNUSED_PARAM(sym_user);
+
+    return (NU_SUCCESS);
+
+} /* PROC_Symbols_Use */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       PROC_Symbols_Unuse
+*
+*   DESCRIPTION
+*
+*       This function is required by NU_Symbol_Close, which the
+*       benchmark does not call.
+*
+*   INPUTS
+*
+*       sym_owner               Process that owns the symbols.
+*       sym_user                Process that uses them.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+***********************************************************************/
+STATUS PROC_Symbols_Unuse(PROC_CB *sym_owner, PROC_CB *sym_user)
+{
+    NU_UNUSED_PARAM(sym_owner);
+    NU_UNUSED_PARAM(sym_user);
+
+    return (NU_SUCCESS);
+
+} /* PROC_Symbols_Unuse */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       PROC_Symbols_In_Use
+*
+*   DESCRIPTION
+*
+*       This function is required by NU_Symbol_Close, which the
+*       benchmark does not call.
+*
+*   INPUTS
+*
+*       sym_owner               Process that owns the symbols.
+*
+*   OUTPUTS
+*
+*       NU_FALSE
+*
+***********************************************************************/
+BOOLEAN PROC_Symbols_In_Use(PROC_CB *sym_owner)
+{
+    NU_UNUSED_PARAM(sym_owner);
+
+    return (NU_FALSE);
+
+} /* PROC_Symbols_In_Use */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       PROC_Get_Pointer
+*
+*   DESCRIPTION
+*
+*       This function is required by NU_Symbol, which the benchmark does
+*       not call.
+*
+*   INPUTS
+*
+*       id                      Process ID.
+*
+*   OUTPUTS
+*
+*       NU_NULL
+*
+***********************************************************************/
+PROC_CB *PROC_Get_Pointer(INT id)
+{
+    NU_UNUSED_PARAM(id);
+
+    return (NU_NULL);
+
+} /* PROC_Get_Pointer */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Getpid
+*
+*   DESCRIPTION
+*
+*       This function is required by NU_Symbol, which the benchmark does
+*       not call.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       0
+*
+***********************************************************************/
+INT NU_Getpid(VOID)
+{
+    return (0);
+
+} /* NU_Getpid */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Obtain_Semaphore
+*
+*   DESCRIPTION
+*
+*       This function is required by NU_Symbol, which the benchmark does
+*       not call.
+*
+*   INPUTS
+*
+*       semaphore               The semaphore.
+*       suspend                 Not used.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+***********************************************************************/
+STATUS NU_Obtain_Semaphore(NU_SEMAPHORE *semaphore, UNSIGNED suspend)
+{
+    NU_UNUSED_PARAM(semaphore);
+    NU_UNUSED_PARAM(suspend);
+
+    return (NU_SUCCESS);
+
+} /* NU_Obtain_Semaphore */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Release_Semaphore
+*
+*   DESCRIPTION
+*
+*       This function is required by NU_Symbol, which the benchmark does
+*       not call.
+*
+*   INPUTS
+*
+*       semaphore               The semaphore.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+***********************************************************************/
+STATUS NU_Release_Semaphore(NU_SEMAPHORE *semaphore)
+{
+    NU_UNUSED_PARAM(semaphore);
+
+    return (NU_SUCCESS);
+
+} /* NU_Release_Semaphore */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Stop
+*
+*   DESCRIPTION
+*
+*       This function is required by NU_Symbol_Close, which the
+*       benchmark does not call.
+*
+*   INPUTS
+*
+*       pid                     Process ID.
+*       exit_code               Exit code.
+*       suspend                 Not used.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+***********************************************************************/
+STATUS NU_Stop(INT pid, INT exit_code, UNSIGNED suspend)
+{
+    NU_UNUSED_PARAM(pid);
+    NU_UNUSED_PARAM(exit_code);
+    NU_UNUSED_PARAM(suspend);
+
+    return (NU_SUCCESS);
+
+} /* NU_Stop */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       TCCT_Schedule_Unlock
+*
+*   DESCRIPTION
+*
+*       This function releases the scheduling lock.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID TCCT_Schedule_Unlock(VOID)
+{
+    TCD_Schedule_Lock = NU_FALSE;
+
+} /* TCCT_Schedule_Unlock */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       ProcBench_Time
+*
+*   DESCRIPTION
+*
+*       This function returns a free running time stamp.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       The monotonic time in nanoseconds.
+*
+***********************************************************************/
+STATIC UINT64 ProcBench_Time(VOID)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((UINT64)now.tv_sec * 1000000000ULL + (UINT64)now.tv_nsec);
+
+} /* ProcBench_Time */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       ProcBench_Read_ELF
+*
+*   DESCRIPTION
+*
+*       This function reads a 64-bit ELF file and finds its dynamic
+*       symbol table.
+*
+*   INPUTS
+*
+*       path                    Path of the file.
+*       elf                     The file read.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The file was read.
+*       NU_NOT_PRESENT          The file could not be read, or has no
+*                               dynamic symbol table.
+*
+***********************************************************************/
+STATIC STATUS ProcBench_Read_ELF(const CHAR *path, PROCBENCH_ELF *elf)
+{
+    FILE        *file;
+    Elf64_Ehdr  *header;
+    long        size;
+    UINT32      index;
+    STATUS      status = NU_NOT_PRESENT;
+
+    memset(elf, 0, sizeof(PROCBENCH_ELF));
+
+    file = fopen(path, "rb");
+
+    if (file != NU_NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        elf->image = malloc(size);
+
+        if ((elf->image != NU_NULL) && (size > (long)sizeof(Elf64_Ehdr)) &&
+            (fread(elf->image, 1, size, file) == (size_t)size))
+        {
+            header = (Elf64_Ehdr *)elf->image;
+
+            if ((memcmp(header->e_ident, ELFMAG, SELFMAG) == 0) &&
+                (header->e_ident[EI_CLASS] == ELFCLASS64))
+            {
+                elf->sections = (Elf64_Shdr *)(elf->image + header->e_shoff);
+                elf->section_count = header->e_shnum;
+
+                for (index = 0; index < elf->section_count; index ++)
+                {
+                    if (elf->sections[index].sh_type == SHT_DYNSYM)
+                    {
+                        elf->dynsym_index = index;
+                        elf->dynsym = (Elf64_Sym *)(elf->image + elf->sections[index].sh_offset);
+                        elf->dynsym_count = elf->sections[index].sh_size / sizeof(Elf64_Sym);
+                        elf->dynstr = (const CHAR *)(elf->image +
+                                      elf->sections[elf->sections[index].sh_link].sh_offset);
+                        status = NU_SUCCESS;
+                    }
+                }
+            }
+        }
+
+        fclose(file);
+    }
+
+    return (status);
+
+} /* ProcBench_Read_ELF */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       ProcBench_Symbols
+*
+*   DESCRIPTION
+*
+*       This function makes a Nucleus symbol table of the symbols an ELF
+*       file defines, in dynamic symbol table order.  The table is ended
+*       by an entry with no address, as the linker ends it.
+*
+*   INPUTS
+*
+*       elf                     The ELF file.
+*       count                   Where the number of symbols is returned.
+*
+*   OUTPUTS
+*
+*       The symbol table.
+*
+***********************************************************************/
+STATIC NU_SYMBOL_ENTRY *ProcBench_Symbols(PROCBENCH_ELF *elf, UINT32 *count)
+{
+    NU_SYMBOL_ENTRY     *table;
+    Elf64_Sym           *sym;
+    UINT32              index;
+
+    table = calloc(elf->dynsym_count + 1, sizeof(NU_SYMBOL_ENTRY));
+    *count = 0;
+
+    for (index = 1; index < elf->dynsym_count; index ++)
+    {
+        sym = &elf->dynsym[index];
+
+        if ((sym->st_shndx != SHN_UNDEF) && (sym->st_value != 0) &&
+            (sym->st_name != 0) &&
+            ((ELF64_ST_BIND(sym->st_info) == STB_GLOBAL) ||
+             (ELF64_ST_BIND(sym->st_info) == STB_WEAK)))
+        {
+            table[*count].symbol_address = (VOID *)(UNSIGNED)sym->st_value;
+            table[*count].symbol_name = elf->dynstr + sym->st_name;
+            (*count)++;
+        }
+    }
+
+    return (table);
+
+} /* ProcBench_Symbols */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       ProcBench_Undefined
+*
+*   DESCRIPTION
+*
+*       This function lists the symbol name of each relocation of an ELF
+*       file against an undefined dynamic symbol, in relocation order.
+*       These are the names the relocation handler looks up.
+*
+*   INPUTS
+*
+*       elf                     The ELF file.
+*       count                   Where the number of names is returned.
+*       distinct                Where the number of different names is
+*                               returned.
+*
+*   OUTPUTS
+*
+*       The names.
+*
+***********************************************************************/
+STATIC CHAR **ProcBench_Undefined(PROCBENCH_ELF *elf, UINT32 *count, UINT32 *distinct)
+{
+    CHAR        **names;
+    Elf64_Shdr  *section;
+    Elf64_Sym   *sym;
+    UINT64      info;
+    UINT32      total = 0;
+    UINT32      index;
+    UINT32      entry;
+    UINT32      entries;
+    UINT32      other;
+
+    for (index = 0; index < elf->section_count; index ++)
+    {
+        section = &elf->sections[index];
+
+        if (((section->sh_type == SHT_RELA) || (section->sh_type == SHT_REL)) &&
+            (section->sh_link == elf->dynsym_index))
+        {
+            total += section->sh_size / section->sh_entsize;
+        }
+    }
+
+    names = malloc((total + 1) * sizeof(CHAR *));
+    *count = 0;
+    *distinct = 0;
+
+    for (index = 0; index < elf->section_count; index ++)
+    {
+        section = &elf->sections[index];
+
+        if (((section->sh_type == SHT_RELA) || (section->sh_type == SHT_REL)) &&
+            (section->sh_link == elf->dynsym_index))
+        {
+            entries = section->sh_size / section->sh_entsize;
+
+            for (entry = 0; entry < entries; entry ++)
+            {
+                if (section->sh_type == SHT_RELA)
+                    info = ((Elf64_Rela *)(elf->image + section->sh_offset))[entry].r_info;
+                else
+                    info = ((Elf64_Rel *)(elf->image + section->sh_offset))[entry].r_info;
+
+                sym = &elf->dynsym[ELF64_R_SYM(info)];
+
+                if ((ELF64_R_SYM(info) != 0) && (sym->st_shndx == SHN_UNDEF))
+                {
+                    names[*count] = (CHAR *)(elf->dynstr + sym->st_name);
+
+                    for (other = 0;
+                         (other < *count) && (strcmp(names[other], names[*count]) != 0);
+                         other ++)
+                        ;
+
+                    if (other == *count)
+                        (*distinct)++;
+
+                    (*count)++;
+                }
+            }
+        }
+    }
+
+    return (names);
+
+} /* ProcBench_Undefined */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       ProcBench_Load
+*
+*   DESCRIPTION
+*
+*       This function makes the symbol work of one load of the module:
+*       the duplicate symbol check of PROC_ELF_File_Load, one lookup for
+*       each relocation against an undefined symbol and, with the symbol
+*       hash, the index of the module symbols built by PROC_Load.  The
+*       index is then freed, as PROC_Unload does.
+*
+*   INPUTS
+*
+*       names                   Names looked up by the relocations.
+*       count                   Number of names.
+*       steps                   Time of each step, added to.
+*
+*   OUTPUTS
+*
+*       A checksum of the results.
+*
+***********************************************************************/
+STATIC UINT32 ProcBench_Load(CHAR **names, UINT32 count, PROCBENCH_STEPS *steps)
+{
+    VOID        *address;
+    UINT32      checksum;
+    UINT32      index;
+    UINT64      start;
+
+    start = ProcBench_Time();
+    checksum = (UINT32)PROC_Validate_Symbols(ProcBench_Module.symbols);
+    steps->validate_ns += ProcBench_Time() - start;
+
+    start = ProcBench_Time();
+
+    for (index = 0; index < count; index ++)
+    {
+        (VOID)PROC_Get_Exported_Symbol_Address(&ProcBench_Module, names[index], &address);
+        checksum = (checksum * 31) + (UINT32)(UNSIGNED)address;
+    }
+
+    steps->resolve_ns += ProcBench_Time() - start;
+
+#if (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE)
+
+    start = ProcBench_Time();
+    (VOID)PROC_Symbols_Hash_Create(ProcBench_Module.symbols, &ProcBench_Module.symbols_hash);
+    steps->index_ns += ProcBench_Time() - start;
+
+    PROC_Symbols_Hash_Delete(ProcBench_Module.symbols_hash);
+    ProcBench_Module.symbols_hash = NU_NULL;
+
+#endif /* CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH */
+
+    return (checksum);
+
+} /* ProcBench_Load */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       main
+*
+*   DESCRIPTION
+*
+*       This function reads the ELF files, indexes the kernel symbols
+*       and times the loads.
+*
+*   INPUTS
+*
+*       argc                    Number of arguments.
+*       argv                    The arguments.
+*
+*   OUTPUTS
+*
+*       0                       The loads were timed.
+*       1                       An ELF file could not be read.
+*
+***********************************************************************/
+int main(int argc, char *argv[])
+{
+    PROCBENCH_ELF   kernel_elf;
+    PROCBENCH_ELF   module_elf;
+    PROCBENCH_STEPS steps;
+    CHAR            **names;
+    UINT32          kernel_count;
+    UINT32          module_count;
+    UINT32          count;
+    UINT32          distinct;
+    UINT32          loads = PROCBENCH_LOADS;
+    UINT32          load;
+    UINT32          checksum;
+    UINT32          compares;
+    UINT64          start;
+    UINT64          kernel_index_ns = 0;
+
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <kernel ELF> <module ELF> [loads]\n", argv[0]);
+        return (1);
+    }
+
+    if ((ProcBench_Read_ELF(argv[1], &kernel_elf) != NU_SUCCESS) ||
+        (ProcBench_Read_ELF(argv[2], &module_elf) != NU_SUCCESS))
+    {
+        fprintf(stderr, "%s: cannot read the dynamic symbols of %s or %s\n",
+                argv[0], argv[1], argv[2]);
+        return (1);
+    }
+
+    if (argc > 3)
+        loads = (UINT32)strtoul(argv[3], NU_NULL, 10);
+
+    if (loads == 0)
+        loads = 1;
+
+    /* The kernel process is started and exports the kernel symbols.  The
+       module is in the process list, but not started. */
+    ProcBench_Kernel.state = PROC_STARTED_STATE;
+    ProcBench_Kernel.kernel_mode = NU_TRUE;
+    ProcBench_Kernel.symbols = ProcBench_Symbols(&kernel_elf, &kernel_count);
+
+    ProcBench_Module.state = PROC_LOADING_STATE;
+    ProcBench_Module.kernel_mode = NU_TRUE;
+    ProcBench_Module.symbols = ProcBench_Symbols(&module_elf, &module_count);
+
+    ProcBench_Kernel.created.cs_next = &ProcBench_Module.created;
+    ProcBench_Kernel.created.cs_previous = &ProcBench_Module.created;
+    ProcBench_Module.created.cs_next = &ProcBench_Kernel.created;
+    ProcBench_Module.created.cs_previous = &ProcBench_Kernel.created;
+    PROC_Created_List = &ProcBench_Kernel.created;
+
+    names = ProcBench_Undefined(&module_elf, &count, &distinct);
+
+#if (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE)
+
+    /* The kernel symbols are indexed once, by the first load */
+    start = ProcBench_Time();
+    (VOID)PROC_Symbols_Hash_Create(ProcBench_Kernel.symbols, &ProcBench_Kernel.symbols_hash);
+    kernel_index_ns = ProcBench_Time() - start;
+
+#endif /* CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH */
+
+    /* Count the name comparisons of one load */
+    memset(&steps, 0, sizeof(steps));
+    ProcBench_Compares = 0;
+    checksum = ProcBench_Load(names, count, &steps);
+    compares = ProcBench_Compares;
+
+    memset(&steps, 0, sizeof(steps));
+
+    for (load = 0; load < loads; load ++)
+        (VOID)ProcBench_Load(names, count, &steps);
+
+    printf("kernel symbols %lu  module symbols %lu  relocation lookups %lu (%lu names)\n",
+           (unsigned long)kernel_count, (unsigned long)module_count,
+           (unsigned long)count, (unsigned long)distinct);
+
+    printf("%-6s  compares %9lu  validate %9lu ns  resolve %9lu ns  index %7lu ns  kernel index %7lu ns  checksum %08lx\n",
+           (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE) ? "hash" : "linear",
+           (unsigned long)compares,
+           (unsigned long)(steps.validate_ns / loads),
+           (unsigned long)(steps.resolve_ns / loads),
+           (unsigned long)(steps.index_ns / loads),
+           (unsigned long)kernel_index_ns,
+           (unsigned long)checksum);
+
+    return (0);
+
+} /* main */
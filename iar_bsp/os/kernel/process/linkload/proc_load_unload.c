@@ -25,6 +25,7 @@
 *   FUNCTIONS
 *
 *       proc_load
+*       proc_symbols_hash
 *       NU_Load
 *       NU_Unload
 *       PROC_Load
@@ -42,6 +43,43 @@
 #include "os/kernel/process/mem_mgmt/proc_mem_mgmt.h"
 #include "proc_elf.h"
 
+#if (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE)
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       proc_symbols_hash
+*
+*   DESCRIPTION
+*
+*       Builds the hash index of the exported symbol tables of a process
+*       if they are not indexed yet.  The symbol lookups search the tables
+*       themselves if an index cannot be allocated.
+*
+*   INPUTS
+*
+*       process             Process with the symbol tables to index
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+static VOID proc_symbols_hash(PROC_CB *process)
+{
+    if ((process -> symbols != NU_NULL) && (process -> symbols_hash == NU_NULL))
+    {
+        (VOID)PROC_Symbols_Hash_Create(process -> symbols, &(process -> symbols_hash));
+    }
+
+    if ((process -> ksymbols != NU_NULL) && (process -> ksymbols_hash == NU_NULL))
+    {
+        (VOID)PROC_Symbols_Hash_Create(process -> ksymbols, &(process -> ksymbols_hash));
+    }
+}
+
+#endif /* CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH */
 
 /*************************************************************************
 *
@@ -262,6 +300,14 @@ STATUS PROC_Load(PROC_CB *process)
     NU_SYMBOL_ENTRY    *ksymbol_table;
     VOID               *root_stack;
 
+#if (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE)
+
+    /* System memory is not available when the kernel process is
+       initialized, so the kernel symbols are indexed by the first load. */
+    proc_symbols_hash(PROC_Kernel_CB);
+
+#endif /* CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH */
+
     /* Try to open the specified file */
     fd = NU_Open(process -> name, PO_RDONLY, PS_IREAD);
 
@@ -285,6 +331,13 @@ STATUS PROC_Load(PROC_CB *process)
             process -> symbols = symbol_table;
             process -> ksymbols = ksymbol_table;
 
+#if (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE)
+
+            /* Index the symbols exported by the process */
+            proc_symbols_hash(process);
+
+#endif /* CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH */
+
             /* Set module entry and exit points */
             process -> entry_addr = (NU_PROC_ENTRY)entry_addr;
 
@@ -364,6 +417,16 @@ STATUS PROC_Unload(PROC_CB *process)
     (VOID)NU_Release_Semaphore(&(process -> semaphore));
     (VOID)NU_Delete_Semaphore(&(process -> semaphore));
 
+#if (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE)
+
+    /* Release the symbol hash index */
+    PROC_Symbols_Hash_Delete(process -> symbols_hash);
+    PROC_Symbols_Hash_Delete(process -> ksymbols_hash);
+    process -> symbols_hash = NU_NULL;
+    process -> ksymbols_hash = NU_NULL;
+
+#endif /* CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH */
+
     /* Deallocate memory for process, ignore errors */
     (VOID)PROC_Free(process -> load_addr);
 
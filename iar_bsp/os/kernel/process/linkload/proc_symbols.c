@@ -28,7 +28,11 @@
 *
 *   FUNCTIONS
 *
+*       proc_sym_hash_name
+*       proc_sym_hash_find
 *       proc_use_exp_sym
+*       PROC_Symbols_Hash_Create
+*       PROC_Symbols_Hash_Delete
 *       PROC_Validate_Symbols
 *       PROC_Get_Exported_Symbol_Address
 *       NU_Symbol
@@ -54,6 +58,132 @@ extern  STATUS      PROC_Shell_Tryload_Status;
 extern  NU_SHELL *  PROC_Shell_Tryload_Session;
 #endif
 
+#if (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE)
+
+/* Shift of the second bloom filter bit, as used by GNU hash sections */
+#define PROC_SYMBOL_BLOOM_SHIFT     6
+
+/* Average number of symbols per hash bucket and per bloom filter word */
+#define PROC_SYMBOL_BUCKET_LOAD     2
+#define PROC_SYMBOL_BLOOM_LOAD      8
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       proc_sym_hash_name
+*
+*   DESCRIPTION
+*
+*       Compute the hash of a symbol name.  This is the hash function of
+*       GNU hash sections.
+*
+*   INPUTS
+*
+*       sym_name - The symbol name (NULL-terminated string).
+*
+*   OUTPUTS
+*
+*       Hash of the symbol name.
+*
+*************************************************************************/
+static UINT32 proc_sym_hash_name(const CHAR * sym_name)
+{
+    UINT32              hash = 5381;
+
+    while (*sym_name != '\0')
+    {
+        hash = (hash << 5) + hash + (UINT8)*sym_name++;
+    }
+
+    return (hash);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       proc_sym_hash_find
+*
+*   DESCRIPTION
+*
+*       Search the hash index of a symbol table for a symbol.  Where a
+*       table exports a name more than once, the first entry of the table
+*       is found, as with a search of the table itself.
+*
+*   INPUTS
+*
+*       sym_hash - The hash index of the symbol table.
+*
+*       sym_table - The exported symbol table.
+*
+*       sym_name - The name of the symbol to search for (NULL-terminated
+*                  string).
+*
+*       name_hash - Hash of sym_name.
+*
+*   OUTPUTS
+*
+*       The symbol table entry of the symbol, or NU_NULL if the symbol
+*       is not in the table.
+*
+*************************************************************************/
+static NU_SYMBOL_ENTRY * proc_sym_hash_find(PROC_SYMBOL_HASH * sym_hash,
+                                            NU_SYMBOL_ENTRY * sym_table,
+                                            const CHAR *      sym_name,
+                                            UINT32            name_hash)
+{
+    NU_SYMBOL_ENTRY *   symbol = NU_NULL;
+    UINT32              bloom_word;
+    UINT32              entry;
+    UINT32              chain;
+
+    bloom_word = sym_hash -> bloom[(name_hash >> 5) & sym_hash -> bloom_mask];
+
+    /* Both bloom filter bits are set for every symbol in the table. */
+    if (((bloom_word >> (name_hash & 31)) &
+         (bloom_word >> ((name_hash >> PROC_SYMBOL_BLOOM_SHIFT) & 31)) & 1) != 0)
+    {
+        entry = sym_hash -> buckets[name_hash & sym_hash -> bucket_mask];
+
+        if (entry != PROC_SYMBOL_HASH_EMPTY)
+        {
+            /* Walk the run of entries of the bucket. */
+            do
+            {
+                chain = sym_hash -> chain[entry];
+
+                /* Only compare names of entries with the same hash. */
+                if (((chain ^ name_hash) >> 1) == 0)
+                {
+                    if (strcmp(sym_table[sym_hash -> order[entry]].symbol_name, sym_name) == 0)
+                    {
+                        symbol = &sym_table[sym_hash -> order[entry]];
+                    }
+                }
+
+                entry++;
+
+            } while ((symbol == NU_NULL) && ((chain & 1) == 0));
+        }
+    }
+
+    return (symbol);
+}
+
+/* Hash index of the symbol tables of a process */
+#define PROC_SYMBOLS_HASH(process)      ((process) -> symbols_hash)
+#define PROC_KSYMBOLS_HASH(process)     ((process) -> ksymbols_hash)
+#define PROC_SYMBOL_NAME_HASH(name)     proc_sym_hash_name(name)
+
+#else
+
+#define PROC_SYMBOLS_HASH(process)      NU_NULL
+#define PROC_KSYMBOLS_HASH(process)     NU_NULL
+#define PROC_SYMBOL_NAME_HASH(name)     0
+
+#endif /* CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH */
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -77,9 +207,14 @@ extern  NU_SHELL *  PROC_Shell_Tryload_Session;
 *
 *       sym_table - The exported symbol table.
 *
+*       sym_hash - The hash index of the symbol table.  May be NULL to
+*                  search the table itself.
+*
 *       sym_name - The name of the symbol to search for (NULL-terminated
 *                  string).
 *
+*       name_hash - Hash of sym_name.  Unused if sym_hash is NULL.
+*
 *       sym_addr - Returned parameter that will contain the address of the
 *                  symbol in the loaded module if the operation is
 *                  successful.  May be NULL to indicate no return of
@@ -95,46 +230,232 @@ extern  NU_SHELL *  PROC_Shell_Tryload_Session;
 static STATUS proc_use_exp_sym(PROC_CB *        process_owner,
                                PROC_CB *        process_user,
                                NU_SYMBOL_ENTRY *sym_table,
+                               PROC_SYMBOL_HASH *sym_hash,
                                CHAR *           sym_name,
+                               UINT32           name_hash,
                                VOID **          sym_addr)
 {
     STATUS              status = NU_NOT_PRESENT;
+    NU_SYMBOL_ENTRY *   symbol = NU_NULL;
     UINT                i;
 
-    /* Search for matching symbol in table and return address if found. */
-    i = 0;
-    while ((status == NU_NOT_PRESENT) &&
-           (sym_table[i].symbol_address != NU_NULL))
+#if (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE)
+
+    if (sym_hash != NU_NULL)
     {
-        if (strcmp(sym_table[i].symbol_name, sym_name) == 0)
-        {
-            /* Indicate symbol found. */
-            status = NU_SUCCESS;
+        /* Look the symbol up in the hash index of the table. */
+        symbol = proc_sym_hash_find(sym_hash, sym_table, sym_name, name_hash);
+    }
+    else
 
-            /* Conditionally return the symbol address */
-            if (sym_addr != NU_NULL)
+#endif /* CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH */
+
+    {
+        /* Search for matching symbol in table. */
+        i = 0;
+        while ((symbol == NU_NULL) &&
+               (sym_table[i].symbol_address != NU_NULL))
+        {
+            if (strcmp(sym_table[i].symbol_name, sym_name) == 0)
             {
-                *sym_addr = sym_table[i].symbol_address;
+                symbol = &sym_table[i];
             }
-
-            /* Conditionally update symbol use. */
-            if ((process_owner != NU_NULL) &&
-                (process_user != NU_NULL))
+            else
             {
-                /* Update process which owns the symbols to indicate use by
-                   the requesting process. */
-                (VOID)PROC_Symbols_Use(process_owner, process_user);
+                i++;
             }
         }
-        else
+    }
+
+    /* Return address if found. */
+    if (symbol != NU_NULL)
+    {
+        /* Indicate symbol found. */
+        status = NU_SUCCESS;
+
+        /* Conditionally return the symbol address */
+        if (sym_addr != NU_NULL)
         {
-            i++;
+            *sym_addr = symbol -> symbol_address;
         }
+
+        /* Conditionally update symbol use. */
+        if ((process_owner != NU_NULL) &&
+            (process_user != NU_NULL))
+        {
+            /* Update process which owns the symbols to indicate use by
+               the requesting process. */
+            (VOID)PROC_Symbols_Use(process_owner, process_user);
+        }
+    }
+
+    return (status);
+}
+
+#if (CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH == NU_TRUE)
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       PROC_Symbols_Hash_Create
+*
+*   DESCRIPTION
+*
+*       Build the hash index of an exported symbol table.  The index is
+*       allocated as a single block from system memory.
+*
+*   INPUTS
+*
+*       sym_table - The exported symbol table.
+*
+*       sym_hash - Returned parameter that will contain the hash index
+*                  if the operation is successful and NULL otherwise.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              Indicates successful operation
+*       <other>                 Indicates the index could not be allocated
+*
+*************************************************************************/
+STATUS PROC_Symbols_Hash_Create(NU_SYMBOL_ENTRY * sym_table, PROC_SYMBOL_HASH ** sym_hash)
+{
+    STATUS              status;
+    PROC_SYMBOL_HASH *  hash;
+    UINT32              count;
+    UINT32              buckets;
+    UINT32              bloom_words;
+    UINT32              name_hash;
+    UINT32              bucket;
+    UINT32              entry;
+    UINT32              i;
+
+    *sym_hash = NU_NULL;
+
+    /* Count the symbols in the table. */
+    count = 0;
+    while (sym_table[count].symbol_address != NU_NULL)
+    {
+        count++;
+    }
+
+    /* Size the buckets and the bloom filter as powers of two. */
+    buckets = 1;
+    while ((buckets * PROC_SYMBOL_BUCKET_LOAD) < count)
+    {
+        buckets <<= 1;
+    }
+
+    bloom_words = 1;
+    while ((bloom_words * PROC_SYMBOL_BLOOM_LOAD) < count)
+    {
+        bloom_words <<= 1;
+    }
+
+    /* Allocate the control structure, the bloom filter, the buckets and
+       the chain and order arrays as one block. */
+    status = PROC_Alloc((VOID **)&hash, sizeof(PROC_SYMBOL_HASH) +
+                        ((bloom_words + buckets + (2 * count)) * sizeof(UINT32)), 0);
+
+    if (status == NU_SUCCESS)
+    {
+        hash -> bucket_mask = buckets - 1;
+        hash -> bloom_mask = bloom_words - 1;
+        hash -> bloom = (UINT32 *)(hash + 1);
+        hash -> buckets = hash -> bloom + bloom_words;
+        hash -> chain = hash -> buckets + buckets;
+        hash -> order = hash -> chain + count;
+
+        memset(hash -> bloom, 0, (bloom_words + buckets) * sizeof(UINT32));
+
+        /* Set the bloom filter bits of each symbol and count the symbols
+           of each bucket, temporarily kept in the buckets array. */
+        for (i = 0; i < count; i++)
+        {
+            name_hash = proc_sym_hash_name(sym_table[i].symbol_name);
+            hash -> chain[i] = name_hash;
+
+            hash -> bloom[(name_hash >> 5) & hash -> bloom_mask] |=
+                ((UINT32)1 << (name_hash & 31)) |
+                ((UINT32)1 << ((name_hash >> PROC_SYMBOL_BLOOM_SHIFT) & 31));
+
+            hash -> buckets[name_hash & hash -> bucket_mask]++;
+        }
+
+        /* Turn the counts into the end of the run of each bucket. */
+        entry = 0;
+        for (bucket = 0; bucket < buckets; bucket++)
+        {
+            entry += hash -> buckets[bucket];
+            hash -> buckets[bucket] = entry;
+        }
+
+        /* Place the symbols in their buckets.  Walking the table backwards
+           keeps each run in table order, so a name exported twice is found
+           at its first entry. */
+        for (i = count; i > 0; i--)
+        {
+            bucket = hash -> chain[i - 1] & hash -> bucket_mask;
+            hash -> order[--hash -> buckets[bucket]] = i - 1;
+        }
+
+        /* Store the hash of each entry in run order and mark the last
+           entry of each run.  The buckets array now holds the start of
+           each run. */
+        for (entry = 0; entry < count; entry++)
+        {
+            hash -> chain[entry] = proc_sym_hash_name(sym_table[hash -> order[entry]].symbol_name) & ~1UL;
+        }
+
+        for (bucket = 0; bucket < buckets; bucket++)
+        {
+            entry = (bucket + 1 < buckets) ? hash -> buckets[bucket + 1] : count;
+
+            if (entry == hash -> buckets[bucket])
+            {
+                hash -> buckets[bucket] = PROC_SYMBOL_HASH_EMPTY;
+            }
+            else
+            {
+                hash -> chain[entry - 1] |= 1;
+            }
+        }
+
+        *sym_hash = hash;
     }
 
     return (status);
 }
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       PROC_Symbols_Hash_Delete
+*
+*   DESCRIPTION
+*
+*       Release the hash index of an exported symbol table.
+*
+*   INPUTS
+*
+*       sym_hash - The hash index.  May be NULL.
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+VOID PROC_Symbols_Hash_Delete(PROC_SYMBOL_HASH * sym_hash)
+{
+    if (sym_hash != NU_NULL)
+    {
+        (VOID)PROC_Free(sym_hash);
+    }
+}
+
+#endif /* CFG_NU_OS_KERN_PROCESS_LINKLOAD_SYMBOL_HASH */
+
 
 /*************************************************************************
 *
@@ -166,6 +487,7 @@ STATUS PROC_Validate_Symbols(NU_SYMBOL_ENTRY * sym_table)
 {
     STATUS              status;
     UINT                i;
+    UINT32              name_hash;
     PROC_CB *           current_process;
 
     i = 0;
@@ -173,6 +495,9 @@ STATUS PROC_Validate_Symbols(NU_SYMBOL_ENTRY * sym_table)
     while ((status == NU_NOT_PRESENT) &&
            (sym_table[i].symbol_address != NU_NULL))
     {
+        /* Hash the name once for the searches of all processes. */
+        name_hash = PROC_SYMBOL_NAME_HASH(sym_table[i].symbol_name);
+
         /* Protect access to process list.  */
         TCCT_Schedule_Lock();
 
@@ -190,7 +515,9 @@ STATUS PROC_Validate_Symbols(NU_SYMBOL_ENTRY * sym_table)
                     status = proc_use_exp_sym(NU_NULL,
                                               NU_NULL,
                                               current_process -> symbols,
+                                              PROC_SYMBOLS_HASH(current_process),
                                               (CHAR *)sym_table[i].symbol_name,
+                                              name_hash,
                                               NU_NULL);
                 }
 
@@ -203,7 +530,9 @@ STATUS PROC_Validate_Symbols(NU_SYMBOL_ENTRY * sym_table)
                         status = proc_use_exp_sym(NU_NULL,
                                                   NU_NULL,
                                                   current_process -> ksymbols,
+                                                  PROC_KSYMBOLS_HASH(current_process),
                                                   (CHAR *)sym_table[i].symbol_name,
+                                                  name_hash,
                                                   NU_NULL);
                     }
                 }
@@ -297,11 +626,16 @@ STATUS PROC_Get_Exported_Symbol_Address(PROC_CB *process, CHAR *sym_name, VOID *
 {
     STATUS              status = NU_UNAVAILABLE;
     NU_SYMBOL_ENTRY *   symbols;
+    PROC_SYMBOL_HASH *  sym_hash;
+    UINT32              name_hash;
     PROC_CB *           current_process;
 
     /* Initialize the returned parameter value to indicate failure. */
     *sym_addr = NU_NULL;
 
+    /* Hash the name once for the searches of all processes. */
+    name_hash = PROC_SYMBOL_NAME_HASH(sym_name);
+
     /* Protect access to process list.  */
     TCCT_Schedule_Lock();
 
@@ -322,6 +656,7 @@ STATUS PROC_Get_Exported_Symbol_Address(PROC_CB *process, CHAR *sym_name, VOID *
             if (process->kernel_mode && current_process->kernel_mode)
             {
                 symbols = current_process->ksymbols;
+                sym_hash = PROC_KSYMBOLS_HASH(current_process);
             }
             else
 
@@ -332,6 +667,7 @@ STATUS PROC_Get_Exported_Symbol_Address(PROC_CB *process, CHAR *sym_name, VOID *
 
             {
                 symbols = current_process->symbols;
+                sym_hash = PROC_SYMBOLS_HASH(current_process);
             }
 
             /* Ensure the process has a symbol table. */
@@ -340,7 +676,7 @@ STATUS PROC_Get_Exported_Symbol_Address(PROC_CB *process, CHAR *sym_name, VOID *
                 /* Attempt to find the symbol in the exported symbols for the
                    current module. */
                 status = proc_use_exp_sym(current_process, process, symbols,
-                                          sym_name, sym_addr);
+                                          sym_hash, sym_name, name_hash, sym_addr);
             }
         }
 
@@ -429,7 +765,8 @@ STATUS NU_Symbol (INT pid, CHAR * sym_name, VOID ** sym_addr)
                         /* Attempt to find the symbol in the exported symbols for the
                            specified process. */
                         status = proc_use_exp_sym(process, process_user, symbols,
-                                                  sym_name, sym_addr);
+                                                  PROC_SYMBOLS_HASH(process), sym_name,
+                                                  PROC_SYMBOL_NAME_HASH(sym_name), sym_addr);
 
                         /* Unlock critical section */
                         TCCT_Schedule_Unlock();
@@ -905,7 +905,7 @@ STATIC VOID DHCPS_Server_Entry(UNSIGNED argc, VOID *argv)
                             }
 
                             /* We must grab the NET semaphore */
-                            status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                            status = NET_Obtain_Stack_Lock(NU_SUSPEND);
                             if (status == NU_SUCCESS)
                             {
                                 /* Get the device structure for the network interface that the
@@ -951,7 +951,7 @@ STATIC VOID DHCPS_Server_Entry(UNSIGNED argc, VOID *argv)
                                     }
 
                                     /* Release the NET semaphore */
-                                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                                     {
                                         /* Log the error */
                                         NERRS_Log_Error(NERR_SEVERE, __FILE__, __LINE__);
@@ -1038,7 +1038,7 @@ STATIC VOID DHCPS_Server_Entry(UNSIGNED argc, VOID *argv)
                                     NERRS_Log_Error(NERR_RECOVERABLE, __FILE__, __LINE__);
 
                                     /* Release the NET semaphore */
-                                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                                     {
                                         /* Log the error */
                                         NERRS_Log_Error(NERR_SEVERE, __FILE__, __LINE__);
@@ -5017,7 +5017,7 @@ STATUS DHCPS_Create_Config_Entry (DHCPS_CONFIG_CB **config_cb, const CHAR *confi
                 NU_Release_Semaphore(&DHCPS_Semaphore);
 
                 /* We must grab the NET semaphore */
-                status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                status = NET_Obtain_Stack_Lock(NU_SUSPEND);
                 if (status == NU_SUCCESS)
                 {
                     /* Get a pointer to the device using the device name. */
@@ -5029,7 +5029,7 @@ STATUS DHCPS_Create_Config_Entry (DHCPS_CONFIG_CB **config_cb, const CHAR *confi
                         /* Store the device's IP address in the control block. */
                         PUT32(temp_config->server_ip_addr, 0, device->dev_addr.dev_ip_addr);                    
 
-                        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                        if(NET_Release_Stack_Lock() != NU_SUCCESS)
                         {
                             /* Log the error */
                             NERRS_Log_Error(NERR_SEVERE, __FILE__, __LINE__);
@@ -5075,7 +5075,7 @@ STATUS DHCPS_Create_Config_Entry (DHCPS_CONFIG_CB **config_cb, const CHAR *confi
                     else
                     {
                         /* Device does not exist. Release the NET semaphore */
-                        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                        if(NET_Release_Stack_Lock() != NU_SUCCESS)
                         {
                             /* Log the error */
                             NERRS_Log_Error(NERR_SEVERE, __FILE__, __LINE__);
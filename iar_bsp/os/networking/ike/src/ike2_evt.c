@@ -202,7 +202,7 @@ VOID IKE2_SA_Timeout_Handler(TQ_EVENT event, IKE2_SA *sa, IKE2_SADB *sadb)
     else
     {
         /* Grab the NET semaphore. */
-        if(NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT) != NU_SUCCESS)
+        if(NET_Obtain_Stack_Lock(IKE_TIMEOUT) != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to obtain the semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
@@ -225,7 +225,7 @@ VOID IKE2_SA_Timeout_Handler(TQ_EVENT event, IKE2_SA *sa, IKE2_SADB *sadb)
                                       TQ_CLEAR_ALL_EXTRA);
 
             /* Release the NET semaphore. */
-            if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if(NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release the semaphore",
                                NERR_SEVERE, __FILE__, __LINE__);
@@ -306,7 +306,7 @@ VOID IKE2_SA_Remove_Event(TQ_EVENT event, IKE2_EXCHANGE_HANDLE *handle,
     }
 
     /* Grab the NET semaphore. */
-    if(NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT) != NU_SUCCESS)
+    if(NET_Obtain_Stack_Lock(IKE_TIMEOUT) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain the semaphore",
             NERR_RECOVERABLE, __FILE__, __LINE__);
@@ -336,7 +336,7 @@ VOID IKE2_SA_Remove_Event(TQ_EVENT event, IKE2_EXCHANGE_HANDLE *handle,
         }
 
         /* Release the NET semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the semaphore",
                 NERR_SEVERE, __FILE__, __LINE__);
@@ -392,7 +392,7 @@ VOID IKE2_Exchange_Timeout_Event(TQ_EVENT event, IKE2_SA *sa,
         if(sa->ike_state != IKE2_SA_ESTABLISHED)
         {
             /* Grab the NET semaphore. */
-            if(NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT) !=
+            if(NET_Obtain_Stack_Lock(IKE_TIMEOUT) !=
                 NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to obtain the semaphore",
@@ -420,7 +420,7 @@ VOID IKE2_Exchange_Timeout_Event(TQ_EVENT event, IKE2_SA *sa,
                 status = IKE2_Find_SADB_By_SA(sa, &sadb);
 
                 /* Release the NET semaphore now. */
-                if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if(NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     /* Failed to release semaphore. */
                     NLOG_Error_Log("Failed to release semaphore",
@@ -875,7 +875,7 @@ STATIC VOID IKE_SA_Timeout_Handler(TQ_EVENT event, IKE_SA *sa,
     else
     {
         /* Grab the NET semaphore. */
-        if(NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT) != NU_SUCCESS)
+        if(NET_Obtain_Stack_Lock(IKE_TIMEOUT) != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to obtain the semaphore",
                            NERR_RECOVERABLE, __FILE__, __LINE__);
@@ -899,7 +899,7 @@ STATIC VOID IKE_SA_Timeout_Handler(TQ_EVENT event, IKE_SA *sa,
             IKE_Unset_Matching_Events((UNSIGNED)sa, 0, TQ_CLEAR_ALL_EXTRA);
 
             /* Release the NET semaphore. */
-            if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if(NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release the semaphore",
                                NERR_SEVERE, __FILE__, __LINE__);
@@ -987,7 +987,7 @@ STATIC VOID IKE_Phase1_Timeout_Handler(TQ_EVENT event, IKE_SA *sa,
             else
             {
                 /* Grab the NET semaphore. */
-                if(NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT) !=
+                if(NET_Obtain_Stack_Lock(IKE_TIMEOUT) !=
                    NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to obtain the semaphore",
@@ -1015,7 +1015,7 @@ STATIC VOID IKE_Phase1_Timeout_Handler(TQ_EVENT event, IKE_SA *sa,
                                               TQ_CLEAR_ALL_EXTRA);
 
                     /* Release the NET semaphore. */
-                    if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if(NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         /* Failed to release semaphore. */
                         NLOG_Error_Log("Failed to release semaphore",
@@ -1049,7 +1049,7 @@ STATIC VOID IKE_Phase1_Timeout_Handler(TQ_EVENT event, IKE_SA *sa,
             }
 
             /* Grab the NET semaphore. */
-            if(NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT) !=
+            if(NET_Obtain_Stack_Lock(IKE_TIMEOUT) !=
                NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to obtain the semaphore",
@@ -1077,7 +1077,7 @@ STATIC VOID IKE_Phase1_Timeout_Handler(TQ_EVENT event, IKE_SA *sa,
                                        TQ_CLEAR_EXACT);
 
                 /* Release the NET semaphore. */
-                if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if(NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     /* Failed to release semaphore. */
                     NLOG_Error_Log("Failed to release semaphore",
@@ -1165,7 +1165,7 @@ STATIC VOID IKE_Phase2_Timeout_Handler(TQ_EVENT event, IKE_SA *sa,
     else
     {
         /* Grab the NET semaphore. */
-        if(NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT) != NU_SUCCESS)
+        if(NET_Obtain_Stack_Lock(IKE_TIMEOUT) != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to obtain the semaphore",
                            NERR_RECOVERABLE, __FILE__, __LINE__);
@@ -1188,7 +1188,7 @@ STATIC VOID IKE_Phase2_Timeout_Handler(TQ_EVENT event, IKE_SA *sa,
                                       TQ_CLEAR_EXACT);
 
             /* Release the NET semaphore. */
-            if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if(NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release the semaphore",
                                NERR_SEVERE, __FILE__, __LINE__);
@@ -1403,7 +1403,7 @@ STATUS IKE_Set_Timer(TQ_EVENT event, UNSIGNED dat, UNSIGNED ext_dat,
     STATUS          status;
 
     /* Grab the NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
     if(status == NU_SUCCESS)
     {
@@ -1413,7 +1413,7 @@ STATUS IKE_Set_Timer(TQ_EVENT event, UNSIGNED dat, UNSIGNED ext_dat,
                              ext_dat);
 
         /* Release the NET semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
@@ -1459,7 +1459,7 @@ STATUS IKE_Unset_Timer(TQ_EVENT event, UNSIGNED dat, UNSIGNED ext_dat)
     STATUS          status;
 
     /* Grab the NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
     if(status == NU_SUCCESS)
     {
@@ -1467,7 +1467,7 @@ STATUS IKE_Unset_Timer(TQ_EVENT event, UNSIGNED dat, UNSIGNED ext_dat)
         status = TQ_Timerunset(event, TQ_CLEAR_EXACT, dat, ext_dat);
 
         /* Release the NET semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
@@ -85,7 +85,7 @@ STATUS IKE_Deinitialize_Events(VOID)
     IKE_DEBUG_LOG("De-initializing IKE events");
 
     /* Grab the NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
     if(status == NU_SUCCESS)
     {
@@ -138,7 +138,7 @@ STATUS IKE_Deinitialize_Events(VOID)
         }
 
         /* Release the NET semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
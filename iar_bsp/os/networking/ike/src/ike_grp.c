@@ -332,7 +332,7 @@ STATUS IKE_Add_To_Group(CHAR *group_name, CHAR *interface_name)
             if(status == NU_SUCCESS)
             {
                 /* Grab the NET semaphore. */
-                status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+                status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
                 if(status == NU_SUCCESS)
                 {
@@ -370,7 +370,7 @@ STATUS IKE_Add_To_Group(CHAR *group_name, CHAR *interface_name)
                     }
 
                     /* Release the NET semaphore. */
-                    if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if(NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release the semaphore",
                                        NERR_SEVERE, __FILE__, __LINE__);
@@ -510,7 +510,7 @@ STATUS IKE_Get_Group_Entry_By_Device(UINT32 dev_index,
 #endif
 
     /* Grab the NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
     if(status == NU_SUCCESS)
     {
@@ -543,7 +543,7 @@ STATUS IKE_Get_Group_Entry_By_Device(UINT32 dev_index,
         }
 
         /* Release the NET semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
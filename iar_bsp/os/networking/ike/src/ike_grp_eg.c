@@ -75,7 +75,7 @@ STATUS IKE_Empty_Group(IKE_POLICY_GROUP *group)
     DV_DEVICE_ENTRY     *dev_entry;
 
     /* Grab the NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
     if(status == NU_SUCCESS)
     {
@@ -104,7 +104,7 @@ STATUS IKE_Empty_Group(IKE_POLICY_GROUP *group)
         }
 
         /* Release the NET semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
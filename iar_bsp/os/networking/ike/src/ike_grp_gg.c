@@ -103,7 +103,7 @@ STATUS IKE_Get_Group(CHAR *interface_name, CHAR *return_group,
         if(status == NU_SUCCESS)
         {
             /* Grab the NET semaphore. */
-            status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+            status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
             if(status == NU_SUCCESS)
             {
@@ -159,7 +159,7 @@ STATUS IKE_Get_Group(CHAR *interface_name, CHAR *return_group,
                 }
 
                 /* Release the NET semaphore. */
-                if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if(NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release the semaphore",
                                    NERR_SEVERE, __FILE__, __LINE__);
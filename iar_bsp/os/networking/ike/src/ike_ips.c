@@ -926,7 +926,7 @@ STATUS IKE_IPS_Group_Name_By_Packet(IKE_PACKET *pkt, CHAR *group_name,
 #endif
 
     /* Grab the NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
     if(status == NU_SUCCESS)
     {
@@ -992,7 +992,7 @@ STATUS IKE_IPS_Group_Name_By_Packet(IKE_PACKET *pkt, CHAR *group_name,
         }
 
         /* Release the NET semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
@@ -1065,7 +1065,7 @@ STATUS IKE_IPS_Group_Name_By_Device(UINT32 dev_index, CHAR *group_name,
 #endif
 
     /* Grab the NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
     if(status == NU_SUCCESS)
     {
@@ -1130,7 +1130,7 @@ STATUS IKE_IPS_Group_Name_By_Device(UINT32 dev_index, CHAR *group_name,
         }
 
         /* Release the NET semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
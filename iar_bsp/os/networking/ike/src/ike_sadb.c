@@ -618,8 +618,7 @@ STATUS IKE_Sync_Remove_SAs(IKE_SADB *sadb, VOID *search_data,
 #endif
 
                     /* Grab the TCP semaphore. */
-                    status = NU_Obtain_Semaphore(&TCP_Resource,
-                                                 IKE_TIMEOUT);
+                    status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
                     if(status == NU_SUCCESS)
                     {
@@ -641,7 +640,7 @@ STATUS IKE_Sync_Remove_SAs(IKE_SADB *sadb, VOID *search_data,
                                                   TQ_CLEAR_ALL_EXTRA);
 
                         /* Release the TCP semaphore. */
-                        if(NU_Release_Semaphore(&TCP_Resource) !=
+                        if(NET_Release_Stack_Lock() !=
                            NU_SUCCESS)
                         {
                             NLOG_Error_Log(
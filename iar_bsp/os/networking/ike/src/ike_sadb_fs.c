@@ -91,7 +91,7 @@ STATUS IKE_Flush_SAs(IKE_SADB *sadb)
     if(IKE_Daemon_State != IKE_DAEMON_STOPPING_MISC)
     {
         /* Grab the TCP semaphore. */
-        status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+        status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
     }
 
     if(status == NU_SUCCESS)
@@ -165,7 +165,7 @@ STATUS IKE_Flush_SAs(IKE_SADB *sadb)
                 if(IKE_Daemon_State != IKE_DAEMON_STOPPING_MISC)
                 {
                     /* Release the TCP semaphore. */
-                    if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if(NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release semaphore",
                                        NERR_SEVERE, __FILE__, __LINE__);
@@ -180,7 +180,7 @@ STATUS IKE_Flush_SAs(IKE_SADB *sadb)
 
                 if(IKE_Daemon_State != IKE_DAEMON_STOPPING_MISC)
                 {
-                    if(NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT)
+                    if(NET_Obtain_Stack_Lock(IKE_TIMEOUT)
                         != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to obtain semaphore",
@@ -208,7 +208,7 @@ STATUS IKE_Flush_SAs(IKE_SADB *sadb)
         if(IKE_Daemon_State != IKE_DAEMON_STOPPING_MISC)
         {
             /* Release the TCP semaphore. */
-            if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if(NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release semaphore",
                                NERR_SEVERE, __FILE__, __LINE__);
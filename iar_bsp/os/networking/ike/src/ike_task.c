@@ -294,7 +294,7 @@ STATIC STATUS IKE_Get_Datagram_Group(UINT8 *if_addr,
     DV_DEVICE_ENTRY *dev_entry;
 
     /* Grab the NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
     if(status == NU_SUCCESS)
     {
@@ -321,7 +321,7 @@ STATIC STATUS IKE_Get_Datagram_Group(UINT8 *if_addr,
         }
 
         /* Release the NET semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
@@ -376,7 +376,7 @@ STATIC STATUS IKE_Get_Datagram_Group6(UINT32 if_index,
     DV_DEVICE_ENTRY *dev_entry;
 
     /* Grab the NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IKE_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IKE_TIMEOUT);
 
     if(status == NU_SUCCESS)
     {
@@ -400,7 +400,7 @@ STATIC STATUS IKE_Get_Datagram_Group6(UINT32 if_index,
         }
 
         /* Release the NET semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
@@ -269,7 +269,7 @@ STATUS IPSEC_Apply_To_Interface(CHAR *if_name, UINT8 state_flag)
 #endif
 
     /* Obtain TCP Semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IPSEC_SEM_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IPSEC_SEM_TIMEOUT);
 
     if (status == NU_SUCCESS)
     {
@@ -316,7 +316,7 @@ STATUS IPSEC_Apply_To_Interface(CHAR *if_name, UINT8 state_flag)
         }
 
         /* Now everything is done, release the semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the semaphore",
                            NERR_SEVERE,__FILE__, __LINE__);
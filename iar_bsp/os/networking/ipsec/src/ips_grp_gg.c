@@ -96,7 +96,7 @@ STATUS IPSEC_Get_Group(CHAR *interface_name, CHAR *return_group,
 #endif
 
     /* First grab the TCP semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IPSEC_SEM_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IPSEC_SEM_TIMEOUT);
 
     /* Check the status. */
     if(status == NU_SUCCESS)
@@ -164,7 +164,7 @@ STATUS IPSEC_Get_Group(CHAR *interface_name, CHAR *return_group,
         }
 
         /* Release the semaphore now. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release TCP semaphore",
                             NERR_SEVERE, __FILE__, __LINE__);
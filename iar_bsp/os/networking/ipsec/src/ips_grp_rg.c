@@ -88,7 +88,7 @@ STATUS IPSEC_Remove_Group(CHAR *group_name)
     else
     {
         /* First grab the TCP semaphore. */
-        status = NU_Obtain_Semaphore(&TCP_Resource, IPSEC_SEM_TIMEOUT);
+        status = NET_Obtain_Stack_Lock(IPSEC_SEM_TIMEOUT);
 
         /* Check the status value. */
         if(status != NU_SUCCESS)
@@ -233,7 +233,7 @@ STATUS IPSEC_Remove_Group(CHAR *group_name)
             }
 
             /* Release the TCP semaphore. */
-            if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if(NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release the TCP semaphore",
                                NERR_SEVERE, __FILE__, __LINE__);
@@ -1344,7 +1344,7 @@ STATUS IPSEC_Add_SA_Pair(UINT32 if_index, IPSEC_OUTBOUND_SA *out_sa,
 #endif
 
     /* First grab the TCP semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, IPSEC_SEM_TIMEOUT);
+    status = NET_Obtain_Stack_Lock(IPSEC_SEM_TIMEOUT);
 
     if(status != NU_SUCCESS)
     {
@@ -1476,7 +1476,7 @@ STATUS IPSEC_Add_SA_Pair(UINT32 if_index, IPSEC_OUTBOUND_SA *out_sa,
         }
 
         /* Release TCP semaphore. */
-        if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if(NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release the TCP semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
@@ -1624,7 +1624,7 @@ STATUS IPSEC_Remove_SA_Pair(IPSEC_OUTBOUND_INDEX_REAL *index)
         if(status == NU_SUCCESS)
         {
             /* Grab the TCP semaphore. */
-            status = NU_Obtain_Semaphore(&TCP_Resource, IPSEC_SEM_TIMEOUT);
+            status = NET_Obtain_Stack_Lock(IPSEC_SEM_TIMEOUT);
 
             if(status != NU_SUCCESS)
             {
@@ -1645,7 +1645,7 @@ STATUS IPSEC_Remove_SA_Pair(IPSEC_OUTBOUND_INDEX_REAL *index)
                               0);
 
                 /* Release the TCP semaphore. */
-                if(NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if(NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release the semaphore",
                                    NERR_SEVERE, __FILE__, __LINE__);
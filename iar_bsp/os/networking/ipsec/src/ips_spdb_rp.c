@@ -116,8 +116,7 @@ STATUS IPSEC_Remove_Policy(CHAR *group_name, UINT32 index)
                 if(status == NU_SUCCESS)
                 {
                     /* First grab the TCP semaphore. */
-                    status = NU_Obtain_Semaphore(&TCP_Resource,
-                                                 IPSEC_SEM_TIMEOUT);
+                    status = NET_Obtain_Stack_Lock(IPSEC_SEM_TIMEOUT);
 
                     /* Check the status. */
                     if(status != NU_SUCCESS)
@@ -133,7 +132,7 @@ STATUS IPSEC_Remove_Policy(CHAR *group_name, UINT32 index)
                                                           policy_ptr);
 
                         /* Release TCP semaphore also. */
-                        if(NU_Release_Semaphore(&TCP_Resource) !=
+                        if(NET_Release_Stack_Lock() !=
                                                              NU_SUCCESS)
                         {
                             NLOG_Error_Log("Failed to release the TCP \
@@ -81,14 +81,14 @@ STATUS NAT_Shutdown(VOID)
     /* Obtain the TCP semaphore since the IP layer could be in the NAT
      * module right now.
      */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
         /* Shutdown Nucleus NAT. */
         NAT_Cleanup();
 
-        status = NU_Release_Semaphore(&TCP_Resource);
+        status = NET_Release_Stack_Lock();
     }
 
     NU_USER_MODE();
@@ -0,0 +1,84 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       arch.h
+*
+*   DESCRIPTION
+*
+*       This file contains the architecture definitions of the host
+*       (Linux) build of Nucleus NET.  The host build runs the stack as
+*       a POSIX process, so there are no registers, stacks or interrupt
+*       vectors to describe, only the sizes the common headers need.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   DEPENDENCIES
+*
+*       None
+*
+***********************************************************************/
+
+#ifndef ARCH_H
+#define ARCH_H
+
+/* Include configuration header file */
+#include    "nucleus_gen_cfg.h"
+
+/* The host timer is a POSIX clock, not an architecture timer. */
+#define         ESAL_AR_OS_TIMER_USED                   NU_FALSE
+
+/* Define if architecture supports unaligned accesses to memory. */
+#define         ESAL_AR_UNALIGNED_16BIT_SPT             NU_TRUE
+#define         ESAL_AR_UNALIGNED_32BIT_SPT             NU_TRUE
+
+/* Define number of accesses required to read or write a pointer */
+#define         ESAL_AR_PTR_ACCESS                      1
+
+/* Define number of accesses required to read or write a 32-bit value */
+#define         ESAL_AR_32BIT_ACCESS                    1
+
+/* Interrupt lockout is emulated by the host kernel layer. */
+#define         ESAL_AR_INTERRUPTS_DISABLE_BITS         0x00000001
+#define         ESAL_AR_INTERRUPTS_ENABLE_BITS          0x00000000
+
+#define         ESAL_AR_ISR_INIT_REQUIRED               NU_FALSE
+#define         ESAL_AR_ISR_RTI_MANDATORY               NU_FALSE
+#define         ESAL_AR_ISR_INCREMENT_IN_C              NU_TRUE
+
+/* There are no architecture exceptions or interrupt vectors. */
+#define         ESAL_AR_EXCEPT_VECTOR_ID_DELIMITER      0
+#define         ESAL_AR_INT_VECTOR_ID_DELIMITER         0
+
+/* Each task runs on its own POSIX thread, so no register frame is kept
+   on the task stack. */
+typedef struct  ESAL_AR_STK_STRUCT
+{
+    UINT32              stack_type;
+
+} ESAL_AR_STK;
+
+typedef struct  ESAL_TS_STK_STRUCT
+{
+    UINT32              stack_type;
+
+} ESAL_TS_STK;
+
+/* Debug types used by the common headers. */
+typedef         UINT32                                  ESAL_AR_DBG_OPCODE;
+typedef         UINT32                                  ESAL_AR_DBG_REG;
+
+#endif  /* ARCH_H */
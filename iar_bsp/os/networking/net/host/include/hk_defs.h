@@ -0,0 +1,182 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       hk_defs.h
+*
+*   COMPONENT
+*
+*       HK - Host Kernel
+*
+*   DESCRIPTION
+*
+*       This file contains the data structures and internal function
+*       prototypes of the host kernel, the POSIX emulation of the
+*       Nucleus PLUS services used by the host build of Nucleus NET.
+*
+*       Every task and HISR is a POSIX thread, but only one of them,
+*       HK_Current, executes at a time.  The others wait on their own
+*       condition variable until they are dispatched, so the stack runs
+*       with the same single-processor, priority-preemptive scheduling
+*       it has on a target.  Dispatching is done by the kernel services
+*       and when interrupts are enabled; threads outside the kernel (the
+*       timer and the device receive threads) only make HISRs and tasks
+*       ready, the way an interrupt would.
+*
+*   DATA STRUCTURES
+*
+*       HK_THREAD
+*       HK_SEMAPHORE
+*       HK_EVENT_GROUP
+*       HK_QUEUE
+*
+*   DEPENDENCIES
+*
+*       pthread.h
+*       nucleus.h
+*       nu_kernel.h
+*
+***********************************************************************/
+
+#ifndef HK_DEFS_H
+#define HK_DEFS_H
+
+#include <pthread.h>
+
+#include "nucleus.h"
+#include "kernel/nu_kernel.h"
+
+#ifdef          __cplusplus
+extern  "C" {                               /* C declarations in C++     */
+#endif /* _cplusplus */
+
+/* Thread states in addition to NU_READY, NU_PURE_SUSPEND and
+   NU_FINISHED. */
+#define HK_RUNNING          100
+#define HK_WAITING          101
+#define HK_HISR_IDLE        102
+
+/* HISR priorities 0 to 2 are mapped below the task priorities, so every
+   HISR runs before any task. */
+#define HK_HISR_PRIORITY(p) ((INT)(p) - 3)
+
+/* The size of the stack of each thread, which is carved from the
+   memory arena. */
+#define HK_THREAD_STACK_SIZE    (256 * 1024)
+
+/* The identifiers stored in the emulated kernel objects. */
+#define HK_SEMAPHORE_ID     0x53454D41UL
+#define HK_EVENT_ID         0x45564E54UL
+#define HK_QUEUE_ID         0x51554555UL
+
+typedef struct _HK_THREAD HK_THREAD;
+
+struct _HK_THREAD
+{
+    HK_THREAD       *hk_next;           /* Ready or wait list link.     */
+    HK_THREAD       **hk_wait_list;     /* The wait list it is on.      */
+    HK_THREAD       *hk_timed_next;     /* Timed wait list link.        */
+    VOID            *hk_object;         /* The NU_TASK or NU_HISR.      */
+    pthread_t       hk_pthread;
+    pthread_cond_t  hk_cond;
+    INT             hk_priority;
+    INT             hk_is_hisr;
+    INT             hk_state;
+    INT             hk_int_level;
+    OPTION          hk_preempt;
+    UINT8           hk_timed;
+    UINT8           padN[2];
+    UNSIGNED        hk_timeout;         /* Tick the wait times out at.  */
+    STATUS          hk_status;          /* Completion status of a wait. */
+
+    /* The request of a thread waiting on an event group or queue. */
+    UNSIGNED        hk_events;
+    OPTION          hk_operation;
+    UNSIGNED        *hk_message;
+    UNSIGNED        hk_size;
+
+    UNSIGNED        hk_activations;     /* Pending HISR activations.    */
+    UNSIGNED        hk_scheduled;
+    VOID            (*hk_task_entry)(UNSIGNED, VOID *);
+    VOID            (*hk_hisr_entry)(VOID);
+    UNSIGNED        hk_argc;
+    VOID            *hk_argv;
+    CHAR            hk_name[NU_MAX_NAME];
+};
+
+/* The NU_TASK and NU_HISR control blocks hold a pointer to the thread
+   in their first word. */
+#define HK_THREAD_OF(obj)   (*(HK_THREAD **)(VOID *)(obj))
+
+/* The emulated semaphore, event group and queue are kept in the
+   control block of the kernel object. */
+typedef struct _HK_SEMAPHORE
+{
+    UNSIGNED        hk_id;
+    UNSIGNED        hk_count;
+    OPTION          hk_suspend_type;
+    UINT8           padN[3];
+    HK_THREAD       *hk_waiters;
+} HK_SEMAPHORE;
+
+typedef struct _HK_EVENT_GROUP
+{
+    UNSIGNED        hk_id;
+    UNSIGNED        hk_flags;
+    HK_THREAD       *hk_waiters;
+} HK_EVENT_GROUP;
+
+typedef struct _HK_QUEUE
+{
+    UNSIGNED        hk_id;
+    UNSIGNED        *hk_start;
+    UNSIGNED        hk_size;            /* In UNSIGNED words.           */
+    UNSIGNED        hk_available;
+    UNSIGNED        hk_messages;
+    UNSIGNED        hk_read;
+    UNSIGNED        hk_write;
+    UNSIGNED        hk_msg_size;
+    OPTION          hk_msg_type;
+    OPTION          hk_suspend_type;
+    UINT8           padN[2];
+    HK_THREAD       *hk_receivers;
+    HK_THREAD       *hk_senders;
+} HK_QUEUE;
+
+/* The lock held by the thread executing a kernel service, and the
+   thread that owns the processor. */
+extern pthread_mutex_t      HK_Lock;
+extern HK_THREAD            *HK_Current;
+extern __thread HK_THREAD   *HK_Self;
+
+/* HK_SCHED.C Function Prototypes. */
+VOID        HK_Initialize(VOID);
+VOID        HK_Start(VOID);
+UNSIGNED    HK_Clock(VOID);
+VOID        HK_Ready(HK_THREAD *thread, INT front);
+VOID        HK_Preempt(VOID);
+STATUS      HK_Wait(HK_THREAD **list, OPTION suspend_type, UNSIGNED suspend);
+VOID        HK_Wake(HK_THREAD *thread, STATUS status);
+
+/* HK_MEM.C Function Prototypes. */
+VOID        *HK_Arena_Allocate(UNSIGNED size);
+
+/* HK_IO.C Function Prototypes. */
+INT         HK_Socket_Pair(INT sockets[2], INT buffer_size);
+
+#ifdef          __cplusplus
+}
+#endif /* _cplusplus */
+
+#endif  /* HK_DEFS_H */
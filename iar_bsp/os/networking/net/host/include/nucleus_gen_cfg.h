@@ -0,0 +1,173 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       nucleus_gen_cfg.h
+*
+*   DESCRIPTION
+*
+*       This file contains the configuration of the host (Linux) build
+*       of Nucleus NET.  It takes the place of the file generated by the
+*       build system for a target.  The kernel options are those of the
+*       eth_spi_bridge configuration.  The networking options are the
+*       component defaults, except that DHCP is left out and there are
+*       more buffers, ports and event queue entries for the benchmarks.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   DEPENDENCIES
+*
+*       None
+*
+***********************************************************************/
+
+#ifndef NUCLEUS_GEN_CFG_H
+#define NUCLEUS_GEN_CFG_H
+
+/* The host build of Nucleus NET */
+#define CFG_NU_OS_NET_HOST_ENABLE
+
+/* Kernel and services */
+#define CFG_NU_OS_KERN_DEVMGR_ENABLE
+#define CFG_NU_OS_KERN_EQM_ENABLE
+#define CFG_NU_OS_KERN_PLUS_CORE_ENABLE
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_ENABLE
+#define CFG_NU_OS_KERN_RTL_ENABLE
+#define CFG_NU_OS_KERN_DEVMGR_DISCOVERY_TASK_ENABLE 1
+#define CFG_NU_OS_KERN_DEVMGR_DISCOVERY_TASK_MAX_ID_CNT 30
+#define CFG_NU_OS_KERN_DEVMGR_DISCOVERY_TASK_STACK_SIZE 10240
+#define CFG_NU_OS_KERN_DEVMGR_ERR_CHECK_ENABLE 1
+#define CFG_NU_OS_KERN_DEVMGR_EXPORT_SYMBOLS 1
+#define CFG_NU_OS_KERN_DEVMGR_HIBERNATE_DEV 1
+#define CFG_NU_OS_KERN_DEVMGR_MAX_DEV_ID_CNT 30
+#define CFG_NU_OS_KERN_DEVMGR_MAX_DEV_LABEL_CNT 5
+#define CFG_NU_OS_KERN_DEVMGR_MAX_DEV_SESSION_CNT 3
+#define CFG_NU_OS_KERN_DEVMGR_MAX_DEVICE_LISTENERS 15
+#define CFG_NU_OS_KERN_PLUS_CORE_ASSERT 0
+#define CFG_NU_OS_KERN_PLUS_CORE_AUTO_CLEAR_CB 1
+#define CFG_NU_OS_KERN_PLUS_CORE_DEBUG_SCHED_LOCK 0
+#define CFG_NU_OS_KERN_PLUS_CORE_ERROR_CHECKING 1
+#define CFG_NU_OS_KERN_PLUS_CORE_ERROR_STRING 0
+#define CFG_NU_OS_KERN_PLUS_CORE_EXPORT_SYMBOLS 1
+#define CFG_NU_OS_KERN_PLUS_CORE_GLOBAL_INT_LOCKING 0
+#define CFG_NU_OS_KERN_PLUS_CORE_INLINING 0
+#define CFG_NU_OS_KERN_PLUS_CORE_LV_TIMEOUT 0
+#define CFG_NU_OS_KERN_PLUS_CORE_MIN_RAM 0
+#define CFG_NU_OS_KERN_PLUS_CORE_MIN_STACK_SIZE 250
+#define CFG_NU_OS_KERN_PLUS_CORE_NUM_TASK_PRIORITIES 256
+#define CFG_NU_OS_KERN_PLUS_CORE_ROM_SUPPORT 0
+#define CFG_NU_OS_KERN_PLUS_CORE_ROM_TO_RAM_COPY 0
+#define CFG_NU_OS_KERN_PLUS_CORE_STACK_CHECKING 0
+#define CFG_NU_OS_KERN_PLUS_CORE_STACK_FILL 0
+#define CFG_NU_OS_KERN_PLUS_CORE_TICK_SUPPRESSION 0
+#define CFG_NU_OS_KERN_PLUS_CORE_TICKS_PER_SEC 100
+#define CFG_NU_OS_KERN_PLUS_CORE_TIMER_HISR_STACK_SIZE 2048
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_EVT_NOTIFY 1
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_EXPORT_SYMBOLS 1
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_PLUS_OBJECT_LISTS 0
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_STATIC_TEST 0
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_TIME_TEST1MAX 0
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_TIME_TEST1MIN 0
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_TIME_TEST2 0
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_TIME_TEST3 0
+#define CFG_NU_OS_KERN_RTL_EXPORT_SYMBOLS 1
+#define CFG_NU_OS_KERN_RTL_FP_OVERRIDE 0
+#define CFG_NU_OS_KERN_RTL_HEAP_SIZE 512
+#define CFG_NU_OS_KERN_RTL_MALLOC_POOL 0
+#define CFG_NU_OS_KERN_PLUS_CORE_TLSF_POOLS 1
+#define CFG_NU_OS_KERN_PLUS_CORE_CPU_ACCOUNTING 1
+#define CFG_NU_OS_KERN_PLUS_CORE_POINTER_QUEUES 1
+#define CFG_NU_OS_KERN_PLUS_CORE_SPSC_RINGS 1
+
+/* Networking stack */
+#define CFG_NU_OS_NET_STACK_ENABLE
+#define CFG_NU_OS_NET_STACK_EXPORT_SYMBOLS 1
+#define CFG_NU_OS_NET_STACK_CFG_H 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_IP_FWD 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_UDP 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_TCP 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_CONGESTION_CTRL 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_PMTU_DISCVRY 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_SACK 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_DSACK 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_WINDOWSCALE 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_TIMESTAMP 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_LMTD_TX 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_IP_RAW 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_LL_CONFIG 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_HW_OFFLOAD 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_NET_DEBUG 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_NOTIFICATIONS 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_IP_RASM 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_IP_FRAG 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_IP_MULT 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_LOOPBACK 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_ARP 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_RARP 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_DNS 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_DHCP 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_BOOTP 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_IPV4 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_TCP_KEEPALIVE 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_NEWRENO 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_NET_ERROR_LOGGING 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_NET_API_ERR_CHECK 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_LITE_ICMP 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_TCP_OOO 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_SO_REUSEADDR 1
+#define CFG_NU_OS_NET_STACK_INCLUDE_MDNS 0
+#define CFG_NU_OS_NET_STACK_INCLUDE_NET_LATENCY_TRACE 0
+#define CFG_NU_OS_NET_STACK_NUM_MDNS_Q_ELEMENTS 8
+#define CFG_NU_OS_NET_STACK_MDNS_TSK_PRIO 25
+#define CFG_NU_OS_NET_STACK_MDNS_WAKE_TSK_PRIO 25
+#define CFG_NU_OS_NET_STACK_MDNS_MASTER_TSK_SIZE 2000
+#define CFG_NU_OS_NET_STACK_MDNS_WAKE_TSK_SIZE 250
+#define CFG_NU_OS_NET_STACK_MDNS_SIGNAL 31
+#define CFG_NU_OS_NET_STACK_DNS_SD_DEFAULT_TTL 120
+#define CFG_NU_OS_NET_STACK_DNS_SD_DEFAULT_PRIO 0
+#define CFG_NU_OS_NET_STACK_DNS_SD_DEFAULT_WEIGHT 0
+#define CFG_NU_OS_NET_STACK_BUFS_IN_UNCACHED_MEM 1
+#define CFG_NU_OS_NET_STACK_MAX_BUFS 4096
+#define CFG_NU_OS_NET_STACK_BUF_SIZE 512
+#define CFG_NU_OS_NET_STACK_REASM_SIZE 65535
+#define CFG_NU_OS_NET_STACK_TCP_MAX_PORTS 256
+#define CFG_NU_OS_NET_STACK_UDP_MAX_PORTS 64
+#define CFG_NU_OS_NET_STACK_IPR_MAX_PORTS 30
+#define CFG_NU_OS_NET_STACK_ARP_CACHE_LENGTH 10
+#define CFG_NU_OS_NET_STACK_IP_MAX_MEMBERSHIPS 10
+#define CFG_NU_OS_NET_STACK_MAX_MCAST_SRCADDR 10
+#define CFG_NU_OS_NET_STACK_REQ_ALIGNMENT 16
+#define CFG_NU_OS_NET_STACK_MAX_DEVS_SUPPORTED 8
+#define CFG_NU_OS_NET_STACK_EQM_SUPPORT_ENABLED 1
+#define CFG_NU_OS_NET_STACK_HIBERNATE_DEV 1
+#define CFG_NU_OS_NET_STACK_HOSTNAME "localhost"
+#define CFG_NU_OS_NET_STACK_DNS_MAX_DNS_SERVERS 5
+#define CFG_NU_OS_NET_STACK_DNS_MAX_IP_ADDRS 5
+#define CFG_NU_OS_NET_STACK_DNS_MAX_MESSAGE_SIZE 512
+#define CFG_NU_OS_NET_STACK_DNS_MAX_ATTEMPTS 5
+#define CFG_NU_OS_NET_STACK_DNS_MAX_MX_RECORDS 10
+#define CFG_NU_OS_NET_STACK_DNS_MAX_MX_NAME_SIZE 128
+#define CFG_NU_OS_NET_STACK_MDNS_LOCAL_TTL 120
+#define CFG_NU_OS_NET_STACK_DNS_DEFAULT_NAME "Nucleus Device"
+#define CFG_NU_OS_NET_STACK_DOMAINNAME "localdomain.com"
+#define CFG_NU_OS_NET_STACK_NUM_EVT_Q_ELEMENTS 256
+#define CFG_NU_OS_NET_STACK_EV_STACK_SIZE 4000
+#define CFG_NU_OS_NET_STACK_TM_STACK_SIZE 5000
+#define CFG_NU_OS_NET_STACK_DHCP_STACK_SIZE 2000
+#define CFG_NU_OS_NET_STACK_BUF_HISR_STACK_SIZE 512
+#define CFG_NU_OS_NET_STACK_LINK_TASK_STACK_SIZE 2500
+
+#endif  /* NUCLEUS_GEN_CFG_H */
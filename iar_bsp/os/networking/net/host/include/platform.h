@@ -0,0 +1,51 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       platform.h
+*
+*   DESCRIPTION
+*
+*       This file contains the platform definitions of the host (Linux)
+*       build of Nucleus NET.  The host has no memory regions, caches or
+*       interrupt controller for the stack to manage.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   DEPENDENCIES
+*
+*       None
+*
+***********************************************************************/
+
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+/* Include configuration header file */
+#include    "nucleus_gen_cfg.h"
+
+/* No processor or development platform interrupts. */
+#define         ESAL_PR_INT_VECTOR_ID_DELIMITER         0
+#define         ESAL_DP_INT_VECTOR_ID_DELIMITER         0
+#define         ESAL_DP_INTERRUPTS_AVAILABLE            NU_FALSE
+
+/* No cache to maintain. */
+#define         ESAL_PR_CACHE_AVAILABLE                 NU_FALSE
+
+/* A single region of host memory. */
+#define         ESAL_DP_MEM_NUM_REGIONS                 1
+
+#endif  /* PLATFORM_H */
@@ -0,0 +1,87 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       toolset.h
+*
+*   DESCRIPTION
+*
+*       This file contains the toolset definitions of the host (Linux)
+*       build of Nucleus NET, which is compiled by the native GCC.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   DEPENDENCIES
+*
+*       None
+*
+***********************************************************************/
+
+#ifndef TOOLSET_H
+#define TOOLSET_H
+
+/* Define if the toolset supports the run-time library */
+#define         ESAL_TS_RTL_SUPPORT                     NU_TRUE
+
+/* Define required stack pointer alignment for the given toolset.*/
+#define         ESAL_TS_REQ_STK_ALIGNMENT               16
+
+/* Define if toolset supports 64-bit data types (long long) */
+#define         ESAL_TS_64BIT_SUPPORT                   NU_TRUE
+
+/* Define, in bytes, toolset minimum required alignment for structures */
+#define         ESAL_TS_STRUCT_ALIGNMENT                8
+
+/* Size, in bits, of integers for the given toolset / architecture */
+#define         ESAL_TS_INTEGER_SIZE                    32
+
+/* Size, in bits, of code pointer for the given toolset / architecture */
+#define         ESAL_TS_CODE_PTR_SIZE                   64
+
+/* Size, in bits, of data pointer for the given toolset / architecture */
+#define         ESAL_TS_DATA_PTR_SIZE                   64
+
+/* Define the maximum alignment of any data type */
+#define         ESAL_TS_MAX_TYPE_ALIGNMENT              ESAL_TS_REQ_STK_ALIGNMENT
+
+/* Define tool specific type for HUGE and FAR data pointers */
+#define         ESAL_TS_HUGE_PTR_TYPE
+#define         ESAL_TS_FAR_PTR_TYPE
+
+/* Position independent code is not used. */
+#define         ESAL_TS_PIC_PID_SUPPORT                 NU_FALSE
+
+#define         ESAL_TS_ROM_TO_RAM_COPY_SUPPORT         NU_FALSE
+
+/* This macro returns the caller's return address */
+#define         ESAL_GET_RETURN_ADDRESS(level)          __builtin_return_address(level)
+
+/* This macro marks a symbol declaration as weakly linked */
+#define         ESAL_TS_WEAK_REF(decl)                  decl __attribute((weak))
+
+/* This macro marks a symbol definition as weakly linked */
+#define         ESAL_TS_WEAK_DEF(decl)                  __attribute((weak)) decl
+
+/* This macro returns the value of a function that does not return */
+#define         ESAL_TS_NO_RETURN(return_val)           return(return_val)
+
+/* This macro marks a function as deprecated */
+#define         ESAL_TS_RTE_DEPRECATED                  __attribute__((deprecated))
+
+/* This macro keeps the compiler from moving memory accesses across it */
+#define         ESAL_TS_RTE_COMPILE_MEM_BARRIER()       asm volatile("" ::: "memory")
+
+#endif  /* TOOLSET_H */
@@ -0,0 +1,76 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       wire.h
+*
+*   COMPONENT
+*
+*       WIRE - In-Memory Wire Device
+*
+*   DESCRIPTION
+*
+*       This file contains the definitions of the wire device of the
+*       host build, an Ethernet device whose frames are carried over a
+*       socket to the wire device of a second stack instance.  The
+*       socket descriptor is passed in the dv_driver_options field of
+*       the DEV_DEVICE entry.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   DEPENDENCIES
+*
+*       None
+*
+***********************************************************************/
+
+#ifndef WIRE_H
+#define WIRE_H
+
+#ifdef          __cplusplus
+extern  "C" {                               /* C declarations in C++     */
+#endif /* _cplusplus */
+
+#define WIRE_ADDRESS_LENGTH     6
+#define WIRE_HEADER_LENGTH      14
+#define WIRE_MTU                1500
+#define WIRE_MAX_FRAME          (WIRE_MTU + WIRE_HEADER_LENGTH)
+#define WIRE_INVALID_VECTOR     65001UL
+
+/* The number of frames received per activation of the receive HISR. */
+#define WIRE_RX_BUDGET          32
+
+/* The time the receive thread waits before it interrupts again when
+   the receive ring of the device is full, in microseconds.  Frames are
+   left in the socket meanwhile, as a device out of receive descriptors
+   leaves them in its FIFO, so a flood cannot starve the stack tasks. */
+#define WIRE_RX_BACKOFF         100
+
+/* The time to wait for room in the socket before a frame is dropped,
+   in milliseconds. */
+#define WIRE_TX_WAIT            10
+
+/* The number of frames dropped by the wire device. */
+extern UINT32   WIRE_Tx_Drops;
+extern UINT32   WIRE_Rx_Drops;
+
+STATUS  WIRE_Init(DV_DEVICE_ENTRY *dev_ptr);
+
+#ifdef          __cplusplus
+}
+#endif /* _cplusplus */
+
+#endif  /* WIRE_H */
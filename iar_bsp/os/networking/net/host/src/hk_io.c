@@ -0,0 +1,87 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       hk_io.c
+*
+*   COMPONENT
+*
+*       HK - Host Kernel
+*
+*   DESCRIPTION
+*
+*       This file contains the host socket services used to join stack
+*       instances.  It does not include the Nucleus NET headers, whose
+*       socket definitions collide with those of the host.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       HK_Socket_Pair
+*
+*   DEPENDENCIES
+*
+*       sys/socket.h
+*       hk_defs.h
+*
+***********************************************************************/
+
+#include <sys/socket.h>
+
+#include "hk_defs.h"
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Socket_Pair
+*
+*   DESCRIPTION
+*
+*       This function creates a pair of connected sockets that preserve
+*       message boundaries, for a wire device at each end.
+*
+*   INPUTS
+*
+*       sockets                 The two sockets created.
+*       buffer_size             The send and receive buffer size of each
+*                               socket, in bytes.
+*
+*   OUTPUTS
+*
+*       0                       The sockets were created.
+*       -1                      The sockets could not be created.
+*
+***********************************************************************/
+INT HK_Socket_Pair(INT sockets[2], INT buffer_size)
+{
+    INT     i;
+
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets) != 0)
+        return (-1);
+
+    for (i = 0; i < 2; i++)
+    {
+        (VOID)setsockopt(sockets[i], SOL_SOCKET, SO_SNDBUF, &buffer_size,
+                         sizeof(buffer_size));
+        (VOID)setsockopt(sockets[i], SOL_SOCKET, SO_RCVBUF, &buffer_size,
+                         sizeof(buffer_size));
+    }
+
+    return (0);
+
+} /* HK_Socket_Pair */
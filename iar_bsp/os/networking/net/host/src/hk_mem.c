@@ -0,0 +1,358 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       hk_mem.c
+*
+*   COMPONENT
+*
+*       HK - Host Kernel
+*
+*   DESCRIPTION
+*
+*       This file contains the memory services of the host kernel.  All
+*       memory comes from a static arena, which keeps every address the
+*       stack stores in a 32-bit field below 4 GB when the program is
+*       linked at a fixed address.  Blocks are allocated in power of two
+*       size classes, each with its own free list, and both system
+*       memory pools share them.
+*
+*   DATA STRUCTURES
+*
+*       HK_Arena
+*       HK_Free_Lists
+*       HK_System_Memory
+*       HK_Uncached_System_Memory
+*
+*   FUNCTIONS
+*
+*       HK_Arena_Allocate
+*       NU_Allocate_Aligned_Memory
+*       NU_Deallocate_Memory
+*       NU_System_Memory_Get
+*       NU_Get_Time_Stamp
+*       NU_RTL_Rand_Seed
+*
+*   DEPENDENCIES
+*
+*       stdlib.h
+*       time.h
+*       unistd.h
+*       hk_defs.h
+*
+***********************************************************************/
+
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hk_defs.h"
+
+/* The size of the arena, and the smallest and largest size classes. */
+#define HK_ARENA_SIZE       (512UL * 1024UL * 1024UL)
+#define HK_MIN_CLASS        5
+#define HK_MAX_CLASS        28
+
+/* The header in front of each allocated block. */
+#define HK_HEADER_SIZE      16
+
+typedef struct _HK_BLOCK_HEADER
+{
+    UINT32      hk_class;           /* Size class of the block.         */
+    UINT32      hk_offset;          /* Offset of the memory returned.   */
+} HK_BLOCK_HEADER;
+
+typedef struct _HK_FREE_BLOCK
+{
+    struct _HK_FREE_BLOCK   *hk_next;
+} HK_FREE_BLOCK;
+
+STATIC UINT64           HK_Arena[HK_ARENA_SIZE / sizeof(UINT64)];
+STATIC UNSIGNED         HK_Arena_Used;
+STATIC HK_FREE_BLOCK    *HK_Free_Lists[HK_MAX_CLASS + 1];
+STATIC pthread_mutex_t  HK_Mem_Lock = PTHREAD_MUTEX_INITIALIZER;
+
+STATIC NU_MEMORY_POOL   HK_System_Memory;
+STATIC NU_MEMORY_POOL   HK_Uncached_System_Memory;
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Arena_Allocate
+*
+*   DESCRIPTION
+*
+*       This function carves memory that is never freed from the arena.
+*
+*   INPUTS
+*
+*       size                    The number of bytes.
+*
+*   OUTPUTS
+*
+*       A pointer to the memory, aligned on 64 bytes, or NU_NULL if the
+*       arena is exhausted.
+*
+***********************************************************************/
+VOID *HK_Arena_Allocate(UNSIGNED size)
+{
+    VOID    *memory = NU_NULL;
+
+    size = (size + 63) & ~63UL;
+
+    pthread_mutex_lock(&HK_Mem_Lock);
+
+    if (size <= sizeof(HK_Arena) - HK_Arena_Used)
+    {
+        memory = (UINT8 *)HK_Arena + HK_Arena_Used;
+
+        HK_Arena_Used += size;
+    }
+
+    pthread_mutex_unlock(&HK_Mem_Lock);
+
+    return (memory);
+
+} /* HK_Arena_Allocate */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Allocate_Aligned_Memory
+*
+*   DESCRIPTION
+*
+*       This function allocates memory from the size class that fits
+*       the request, taking a free block of that class or carving a new
+*       one from the arena.  The pool is not used; the host kernel never
+*       suspends for memory.
+*
+*   INPUTS
+*
+*       *pool_ptr               The memory pool.
+*       **return_pointer        The memory allocated.
+*       size                    The number of bytes.
+*       alignment               The alignment, a power of two, or 0.
+*       suspend                 Not used.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The memory was allocated.
+*       NU_INVALID_POOL         pool_ptr is NU_NULL.
+*       NU_INVALID_POINTER      return_pointer is NU_NULL.
+*       NU_INVALID_SIZE         size is 0 or too large.
+*       NU_NO_MEMORY            The arena is exhausted.
+*
+***********************************************************************/
+STATUS NU_Allocate_Aligned_Memory(NU_MEMORY_POOL *pool_ptr,
+                                  VOID **return_pointer, UNSIGNED size,
+                                  UNSIGNED alignment, UNSIGNED suspend)
+{
+    UNSIGNED        needed;
+    UINT32          class_index = HK_MIN_CLASS;
+    UINT8           *block = NU_NULL;
+    UINT8           *memory;
+    HK_BLOCK_HEADER *header;
+
+    NU_UNUSED_PARAM(suspend);
+
+    if (pool_ptr == NU_NULL)
+        return (NU_INVALID_POOL);
+
+    if (return_pointer == NU_NULL)
+        return (NU_INVALID_POINTER);
+
+    /* A block is aligned on the header size; a larger alignment needs
+       room to move the memory forward. */
+    needed = size + HK_HEADER_SIZE;
+
+    if (alignment > HK_HEADER_SIZE)
+        needed += alignment;
+    else
+        alignment = HK_HEADER_SIZE;
+
+    while ( (class_index <= HK_MAX_CLASS) &&
+            ((1UL << class_index) < needed) )
+        class_index ++;
+
+    if ( (size == 0) || (class_index > HK_MAX_CLASS) )
+        return (NU_INVALID_SIZE);
+
+    pthread_mutex_lock(&HK_Mem_Lock);
+
+    if (HK_Free_Lists[class_index])
+    {
+        block = (UINT8 *)HK_Free_Lists[class_index];
+
+        HK_Free_Lists[class_index] = HK_Free_Lists[class_index]->hk_next;
+    }
+
+    else if ((1UL << class_index) <= sizeof(HK_Arena) - HK_Arena_Used)
+    {
+        block = (UINT8 *)HK_Arena + HK_Arena_Used;
+
+        HK_Arena_Used += (1UL << class_index);
+    }
+
+    pthread_mutex_unlock(&HK_Mem_Lock);
+
+    if (block == NU_NULL)
+        return (NU_NO_MEMORY);
+
+    memory = block + HK_HEADER_SIZE;
+    memory += (alignment - ((UINT64)memory & (alignment - 1))) &
+              (alignment - 1);
+
+    header = (HK_BLOCK_HEADER *)(memory - HK_HEADER_SIZE);
+
+    header->hk_class = class_index;
+    header->hk_offset = (UINT32)(memory - block);
+
+    *return_pointer = memory;
+
+    return (NU_SUCCESS);
+
+} /* NU_Allocate_Aligned_Memory */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Deallocate_Memory
+*
+*   DESCRIPTION
+*
+*       This function returns memory to the free list of its size
+*       class.
+*
+*   INPUTS
+*
+*       *memory                 The memory to free.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The memory was freed.
+*       NU_INVALID_POINTER      memory is NU_NULL.
+*
+***********************************************************************/
+STATUS NU_Deallocate_Memory(VOID *memory)
+{
+    HK_BLOCK_HEADER *header;
+    HK_FREE_BLOCK   *block;
+
+    if (memory == NU_NULL)
+        return (NU_INVALID_POINTER);
+
+    header = (HK_BLOCK_HEADER *)((UINT8 *)memory - HK_HEADER_SIZE);
+    block = (HK_FREE_BLOCK *)((UINT8 *)memory - header->hk_offset);
+
+    pthread_mutex_lock(&HK_Mem_Lock);
+
+    block->hk_next = HK_Free_Lists[header->hk_class];
+    HK_Free_Lists[header->hk_class] = block;
+
+    pthread_mutex_unlock(&HK_Mem_Lock);
+
+    return (NU_SUCCESS);
+
+} /* NU_Deallocate_Memory */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_System_Memory_Get
+*
+*   DESCRIPTION
+*
+*       This function returns the system memory pools.
+*
+*   INPUTS
+*
+*       **sys_pool_ptr          The cached system memory pool.
+*       **usys_pool_ptr         The uncached system memory pool.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+***********************************************************************/
+STATUS NU_System_Memory_Get(NU_MEMORY_POOL **sys_pool_ptr,
+                            NU_MEMORY_POOL **usys_pool_ptr)
+{
+    if (sys_pool_ptr)
+        *sys_pool_ptr = &HK_System_Memory;
+
+    if (usys_pool_ptr)
+        *usys_pool_ptr = &HK_Uncached_System_Memory;
+
+    return (NU_SUCCESS);
+
+} /* NU_System_Memory_Get */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Get_Time_Stamp
+*
+*   DESCRIPTION
+*
+*       This function returns a free running time stamp.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       The monotonic time in nanoseconds.
+*
+***********************************************************************/
+UINT64 NU_Get_Time_Stamp(VOID)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((UINT64)now.tv_sec * 1000000000ULL + (UINT64)now.tv_nsec);
+
+} /* NU_Get_Time_Stamp */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_RTL_Rand_Seed
+*
+*   DESCRIPTION
+*
+*       This function seeds the random number generator.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID NU_RTL_Rand_Seed(VOID)
+{
+    srand((unsigned int)time(NU_NULL) ^ (unsigned int)getpid());
+
+} /* NU_RTL_Rand_Seed */
@@ -0,0 +1,1236 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       hk_sched.c
+*
+*   COMPONENT
+*
+*       HK - Host Kernel
+*
+*   DESCRIPTION
+*
+*       This file contains the scheduler of the host kernel and the
+*       task, HISR, clock and interrupt services built on it.  Time
+*       slicing is not emulated; tasks of equal priority only give up
+*       the processor by suspending or relinquishing, which is all the
+*       stack relies on.
+*
+*   DATA STRUCTURES
+*
+*       HK_Lock
+*       HK_Current
+*       HK_Self
+*       HK_Ready_List
+*       HK_Timed_List
+*       HK_Interrupted
+*       TCD_Protect_Save
+*
+*   FUNCTIONS
+*
+*       HK_Initialize
+*       HK_Start
+*       HK_Clock
+*       HK_Ready
+*       HK_Dispatch
+*       HK_Switch
+*       HK_Preempt
+*       HK_Wait
+*       HK_Wake
+*       HK_Thread_Entry
+*       HK_Create_Thread
+*       NU_Create_Task
+*       NU_Create_HISR
+*       NU_Activate_HISR
+*       NU_Current_Task_Pointer
+*       NU_Suspend_Task
+*       NU_Resume_Task
+*       NU_Relinquish
+*       NU_Sleep
+*       NU_Change_Preemption
+*       NU_Task_Information
+*       NU_Retrieve_Clock
+*       ESAL_GE_INT_Global_Set
+*
+*   DEPENDENCIES
+*
+*       time.h
+*       string.h
+*       hk_defs.h
+*
+***********************************************************************/
+
+#include <time.h>
+#include <string.h>
+
+#include "hk_defs.h"
+
+pthread_mutex_t     HK_Lock = PTHREAD_MUTEX_INITIALIZER;
+HK_THREAD           *HK_Current;
+__thread HK_THREAD  *HK_Self;
+
+/* The threads that are ready to run, highest priority first, and the
+   threads waiting with a timeout. */
+STATIC HK_THREAD    *HK_Ready_List;
+STATIC HK_THREAD    *HK_Timed_List;
+
+/* Set when a thread with a higher priority than HK_Current is made
+   ready, so that enabling interrupts only takes the lock if a
+   preemption may be due. */
+STATIC volatile INT HK_Preempt_Pending;
+
+/* The task without preemption that was interrupted by a HISR. */
+STATIC HK_THREAD    *HK_Interrupted;
+
+STATIC INT              HK_Started;
+STATIC struct timespec  HK_Start_Time;
+
+INT TCD_Protect_Save;
+
+STATIC VOID HK_Dispatch(VOID);
+STATIC VOID HK_Switch(VOID);
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Initialize
+*
+*   DESCRIPTION
+*
+*       This function initializes the host kernel.  It must be called
+*       before any other kernel service.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID HK_Initialize(VOID)
+{
+    clock_gettime(CLOCK_MONOTONIC, &HK_Start_Time);
+
+} /* HK_Initialize */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Start
+*
+*   DESCRIPTION
+*
+*       This function dispatches the highest priority task created so
+*       far and then becomes the system timer, which times out the
+*       threads waiting with a timeout once a tick.  It never returns.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID HK_Start(VOID)
+{
+    struct timespec tick;
+    UNSIGNED        now;
+    HK_THREAD       *thread;
+
+    tick.tv_sec = 0;
+    tick.tv_nsec = 1000000000L / NU_PLUS_TICKS_PER_SEC;
+
+    pthread_mutex_lock(&HK_Lock);
+
+    HK_Started = NU_TRUE;
+
+    if (HK_Current == NU_NULL)
+        HK_Dispatch();
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    for (;;)
+    {
+        nanosleep(&tick, NU_NULL);
+
+        pthread_mutex_lock(&HK_Lock);
+
+        now = HK_Clock();
+
+        /* Wake each thread whose wait has timed out.  The list changes
+           with each wake, so start over from the head. */
+        thread = HK_Timed_List;
+
+        while (thread)
+        {
+            if ((INT32)(now - thread->hk_timeout) >= 0)
+            {
+                HK_Wake(thread, NU_TIMEOUT);
+
+                thread = HK_Timed_List;
+            }
+
+            else
+                thread = thread->hk_timed_next;
+        }
+
+        pthread_mutex_unlock(&HK_Lock);
+    }
+
+} /* HK_Start */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Clock
+*
+*   DESCRIPTION
+*
+*       This function returns the number of ticks since the kernel was
+*       initialized.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       The system clock.
+*
+***********************************************************************/
+UNSIGNED HK_Clock(VOID)
+{
+    struct timespec now;
+    UINT64          ns;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    ns = (UINT64)(now.tv_sec - HK_Start_Time.tv_sec) * 1000000000ULL +
+         (UINT64)(now.tv_nsec - HK_Start_Time.tv_nsec);
+
+    return ((UNSIGNED)(ns / (1000000000ULL / NU_PLUS_TICKS_PER_SEC)));
+
+} /* HK_Clock */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Ready
+*
+*   DESCRIPTION
+*
+*       This function places a thread on the ready list, behind the
+*       threads of the same priority or, if front is NU_TRUE, ahead of
+*       them.  If the processor is idle, the highest priority thread is
+*       dispatched.  The caller must hold HK_Lock.
+*
+*   INPUTS
+*
+*       *thread                 The thread to make ready.
+*       front                   NU_TRUE to place the thread ahead of
+*                               the threads of its priority.
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID HK_Ready(HK_THREAD *thread, INT front)
+{
+    HK_THREAD   **link = &HK_Ready_List;
+
+    while ( (*link) &&
+            ( ((*link)->hk_priority < thread->hk_priority) ||
+              ((!front) && ((*link)->hk_priority == thread->hk_priority)) ) )
+        link = &(*link)->hk_next;
+
+    thread->hk_next = *link;
+    *link = thread;
+
+    thread->hk_state = NU_READY;
+
+    if (HK_Current == NU_NULL)
+    {
+        if (HK_Started)
+            HK_Dispatch();
+    }
+
+    else if (thread->hk_priority < HK_Current->hk_priority)
+        HK_Preempt_Pending = NU_TRUE;
+
+} /* HK_Ready */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Dispatch
+*
+*   DESCRIPTION
+*
+*       This function gives the processor to the thread at the head of
+*       the ready list, or leaves it idle if there is none.  A task
+*       without preemption that was interrupted by a HISR is dispatched
+*       as soon as no HISR is ready, whatever its priority.  The caller
+*       must hold HK_Lock and must not be HK_Current.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID HK_Dispatch(VOID)
+{
+    HK_THREAD   **link = &HK_Ready_List;
+    HK_THREAD   *next = HK_Ready_List;
+
+    /* A task that cannot be preempted gets the processor back from
+       the HISRs that interrupted it before any other task runs. */
+    if ( (HK_Interrupted) && ((next == NU_NULL) || (!next->hk_is_hisr)) )
+    {
+        while ( (*link) && (*link != HK_Interrupted) )
+            link = &(*link)->hk_next;
+
+        if (*link)
+            next = *link;
+        else
+            link = &HK_Ready_List;
+
+        HK_Interrupted = NU_NULL;
+    }
+
+    HK_Current = next;
+
+    if (next)
+    {
+        *link = next->hk_next;
+
+        next->hk_next = NU_NULL;
+        next->hk_state = HK_RUNNING;
+        next->hk_scheduled ++;
+
+        pthread_cond_signal(&next->hk_cond);
+    }
+
+} /* HK_Dispatch */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Switch
+*
+*   DESCRIPTION
+*
+*       This function gives up the processor of the calling thread,
+*       which has already been made ready or suspended, and waits until
+*       the thread is dispatched again.  The caller must hold HK_Lock.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID HK_Switch(VOID)
+{
+    HK_THREAD   *self = HK_Self;
+
+    HK_Dispatch();
+
+    while (HK_Current != self)
+        pthread_cond_wait(&self->hk_cond, &HK_Lock);
+
+} /* HK_Switch */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Preempt
+*
+*   DESCRIPTION
+*
+*       This function switches to the thread at the head of the ready
+*       list if it has a higher priority than the calling thread, and
+*       the calling thread is a task with interrupts enabled that is
+*       either preemptable or being preempted by a HISR.  It does
+*       nothing if the caller is not a kernel thread.  The caller must
+*       hold HK_Lock.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID HK_Preempt(VOID)
+{
+    HK_THREAD   *self = HK_Self;
+    HK_THREAD   *next = HK_Ready_List;
+
+    if (self == NU_NULL)
+        return;
+
+    if ( (next == NU_NULL) || (next->hk_priority >= self->hk_priority) )
+    {
+        HK_Preempt_Pending = NU_FALSE;
+        return;
+    }
+
+    if ( (self->hk_is_hisr) ||
+         (self->hk_int_level != NU_ENABLE_INTERRUPTS) ||
+         ((self->hk_preempt != NU_PREEMPT) && (!next->hk_is_hisr)) )
+        return;
+
+    HK_Preempt_Pending = NU_FALSE;
+
+    if (self->hk_preempt != NU_PREEMPT)
+        HK_Interrupted = self;
+
+    /* A preempted task resumes ahead of the tasks of its priority. */
+    HK_Ready(self, NU_TRUE);
+
+    HK_Switch();
+
+} /* HK_Preempt */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Wait
+*
+*   DESCRIPTION
+*
+*       This function suspends the calling thread on a wait list until
+*       it is woken by HK_Wake or the suspend time expires.  The caller
+*       must hold HK_Lock.
+*
+*   INPUTS
+*
+*       **list                  The wait list, or NU_NULL to wait for
+*                               the timeout only.
+*       suspend_type            NU_FIFO or NU_PRIORITY.
+*       suspend                 NU_SUSPEND or the number of ticks to
+*                               wait.
+*
+*   OUTPUTS
+*
+*       The status passed to HK_Wake, or NU_TIMEOUT.
+*
+***********************************************************************/
+STATUS HK_Wait(HK_THREAD **list, OPTION suspend_type, UNSIGNED suspend)
+{
+    HK_THREAD   *self = HK_Self;
+    HK_THREAD   **link = list;
+
+    if (list)
+    {
+        while ( (*link) &&
+                ((suspend_type == NU_FIFO) ||
+                 ((*link)->hk_priority <= self->hk_priority)) )
+            link = &(*link)->hk_next;
+
+        self->hk_next = *link;
+        *link = self;
+    }
+
+    self->hk_wait_list = list;
+    self->hk_state = HK_WAITING;
+    self->hk_status = NU_TIMEOUT;
+
+    if (suspend != NU_SUSPEND)
+    {
+        self->hk_timeout = HK_Clock() + suspend;
+        self->hk_timed = NU_TRUE;
+        self->hk_timed_next = HK_Timed_List;
+
+        HK_Timed_List = self;
+    }
+
+    HK_Switch();
+
+    return (self->hk_status);
+
+} /* HK_Wait */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Wake
+*
+*   DESCRIPTION
+*
+*       This function removes a waiting thread from its wait list and
+*       makes it ready.  The caller must hold HK_Lock.
+*
+*   INPUTS
+*
+*       *thread                 The waiting thread.
+*       status                  The status its wait completes with.
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID HK_Wake(HK_THREAD *thread, STATUS status)
+{
+    HK_THREAD   **link;
+
+    if (thread->hk_wait_list)
+    {
+        for (link = thread->hk_wait_list; *link != thread;
+             link = &(*link)->hk_next)
+            ;
+
+        *link = thread->hk_next;
+
+        thread->hk_wait_list = NU_NULL;
+    }
+
+    if (thread->hk_timed)
+    {
+        for (link = &HK_Timed_List; *link != thread;
+             link = &(*link)->hk_timed_next)
+            ;
+
+        *link = thread->hk_timed_next;
+
+        thread->hk_timed = NU_FALSE;
+    }
+
+    thread->hk_status = status;
+
+    HK_Ready(thread, NU_FALSE);
+
+} /* HK_Wake */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Thread_Entry
+*
+*   DESCRIPTION
+*
+*       This function is the entry of the POSIX thread of every task and
+*       HISR.  It waits to be dispatched, then runs the task or, for a
+*       HISR, runs it once per activation each time it is dispatched.
+*
+*   INPUTS
+*
+*       *arg                    The thread.
+*
+*   OUTPUTS
+*
+*       NU_NULL
+*
+***********************************************************************/
+STATIC VOID *HK_Thread_Entry(VOID *arg)
+{
+    HK_THREAD   *self = (HK_THREAD *)arg;
+
+    HK_Self = self;
+
+    pthread_mutex_lock(&HK_Lock);
+
+    while (HK_Current != self)
+        pthread_cond_wait(&self->hk_cond, &HK_Lock);
+
+    if (self->hk_is_hisr)
+    {
+        for (;;)
+        {
+            while (self->hk_activations)
+            {
+                self->hk_activations --;
+
+                pthread_mutex_unlock(&HK_Lock);
+
+                self->hk_hisr_entry();
+
+                pthread_mutex_lock(&HK_Lock);
+            }
+
+            self->hk_state = HK_HISR_IDLE;
+
+            HK_Switch();
+        }
+    }
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    self->hk_task_entry(self->hk_argc, self->hk_argv);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    self->hk_state = NU_FINISHED;
+
+    HK_Dispatch();
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (NU_NULL);
+
+} /* HK_Thread_Entry */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Create_Thread
+*
+*   DESCRIPTION
+*
+*       This function creates the thread of a task or HISR and links it
+*       to the control block.  The stack given by the caller is not
+*       used; the thread runs on a stack carved from the memory arena.
+*
+*   INPUTS
+*
+*       *object                 The NU_TASK or NU_HISR.
+*       *name                   Name of the task or HISR.
+*       priority                The priority of the thread.
+*       is_hisr                 NU_TRUE if the thread is a HISR.
+*
+*   OUTPUTS
+*
+*       The thread, or NU_NULL if it could not be created.
+*
+***********************************************************************/
+STATIC HK_THREAD *HK_Create_Thread(VOID *object, const CHAR *name,
+                                   INT priority, INT is_hisr)
+{
+    HK_THREAD       *thread;
+    VOID            *stack;
+    pthread_attr_t  attr;
+
+    thread = (HK_THREAD *)HK_Arena_Allocate(sizeof(HK_THREAD));
+    stack = HK_Arena_Allocate(HK_THREAD_STACK_SIZE);
+
+    if ( (thread == NU_NULL) || (stack == NU_NULL) )
+        return (NU_NULL);
+
+    memset(thread, 0, sizeof(HK_THREAD));
+
+    strncpy(thread->hk_name, name, NU_MAX_NAME - 1);
+
+    thread->hk_object = object;
+    thread->hk_priority = priority;
+    thread->hk_is_hisr = is_hisr;
+    thread->hk_int_level = NU_ENABLE_INTERRUPTS;
+
+    pthread_cond_init(&thread->hk_cond, NU_NULL);
+
+    HK_THREAD_OF(object) = thread;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, stack, HK_THREAD_STACK_SIZE);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    if (pthread_create(&thread->hk_pthread, &attr, HK_Thread_Entry,
+                       thread) != 0)
+        thread = NU_NULL;
+
+    pthread_attr_destroy(&attr);
+
+    return (thread);
+
+} /* HK_Create_Thread */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Create_Task
+*
+*   DESCRIPTION
+*
+*       This function creates a task.
+*
+*   INPUTS
+*
+*       *task                   The task control block.
+*       *name                   Name of the task.
+*       task_entry              The entry function of the task.
+*       argc                    The first argument of the entry.
+*       *argv                   The second argument of the entry.
+*       *stack_address          Not used.
+*       stack_size              Not used.
+*       priority                The priority of the task.
+*       time_slice              Not used.
+*       preempt                 NU_PREEMPT or NU_NO_PREEMPT.
+*       auto_start              NU_START or NU_NO_START.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The task was created.
+*       NU_INVALID_TASK         task is NU_NULL.
+*       NU_INVALID_ENTRY        task_entry is NU_NULL.
+*       NU_NO_MEMORY            The thread could not be created.
+*
+***********************************************************************/
+STATUS NU_Create_Task(NU_TASK *task, CHAR *name,
+                      VOID (*task_entry)(UNSIGNED, VOID *), UNSIGNED argc,
+                      VOID *argv, VOID *stack_address, UNSIGNED stack_size,
+                      OPTION priority, UNSIGNED time_slice,
+                      OPTION preempt, OPTION auto_start)
+{
+    HK_THREAD   *thread;
+
+    NU_UNUSED_PARAM(stack_address);
+    NU_UNUSED_PARAM(stack_size);
+    NU_UNUSED_PARAM(time_slice);
+
+    if (task == NU_NULL)
+        return (NU_INVALID_TASK);
+
+    if (task_entry == NU_NULL)
+        return (NU_INVALID_ENTRY);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    thread = HK_Create_Thread(task, name, (INT)priority, NU_FALSE);
+
+    if (thread)
+    {
+        thread->hk_task_entry = task_entry;
+        thread->hk_argc = argc;
+        thread->hk_argv = argv;
+        thread->hk_preempt = preempt;
+        thread->hk_state = NU_PURE_SUSPEND;
+
+        if (auto_start == NU_START)
+        {
+            HK_Ready(thread, NU_FALSE);
+            HK_Preempt();
+        }
+    }
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (thread ? NU_SUCCESS : NU_NO_MEMORY);
+
+} /* NU_Create_Task */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Create_HISR
+*
+*   DESCRIPTION
+*
+*       This function creates a HISR.
+*
+*   INPUTS
+*
+*       *hisr                   The HISR control block.
+*       *name                   Name of the HISR.
+*       hisr_entry              The entry function of the HISR.
+*       priority                The priority of the HISR, 0 to 2.
+*       *stack_address          Not used.
+*       stack_size              Not used.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The HISR was created.
+*       NU_INVALID_HISR         hisr is NU_NULL.
+*       NU_INVALID_ENTRY        hisr_entry is NU_NULL.
+*       NU_INVALID_PRIORITY     priority is above 2.
+*       NU_NO_MEMORY            The thread could not be created.
+*
+***********************************************************************/
+STATUS NU_Create_HISR(NU_HISR *hisr, CHAR *name,
+                      VOID (*hisr_entry)(VOID), OPTION priority,
+                      VOID *stack_address, UNSIGNED stack_size)
+{
+    HK_THREAD   *thread;
+
+    NU_UNUSED_PARAM(stack_address);
+    NU_UNUSED_PARAM(stack_size);
+
+    if (hisr == NU_NULL)
+        return (NU_INVALID_HISR);
+
+    if (hisr_entry == NU_NULL)
+        return (NU_INVALID_ENTRY);
+
+    if (priority > 2)
+        return (NU_INVALID_PRIORITY);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    thread = HK_Create_Thread(hisr, name, HK_HISR_PRIORITY(priority),
+                              NU_TRUE);
+
+    if (thread)
+    {
+        thread->hk_hisr_entry = hisr_entry;
+        thread->hk_state = HK_HISR_IDLE;
+    }
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (thread ? NU_SUCCESS : NU_NO_MEMORY);
+
+} /* NU_Create_HISR */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Activate_HISR
+*
+*   DESCRIPTION
+*
+*       This function activates a HISR.  It may be called from a kernel
+*       thread or, in place of a LISR, from a thread outside the kernel.
+*
+*   INPUTS
+*
+*       *hisr                   The HISR to activate.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The HISR was activated.
+*       NU_INVALID_HISR         hisr is NU_NULL.
+*
+***********************************************************************/
+STATUS NU_Activate_HISR(NU_HISR *hisr)
+{
+    HK_THREAD   *thread;
+
+    if (hisr == NU_NULL)
+        return (NU_INVALID_HISR);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    thread = HK_THREAD_OF(hisr);
+
+    thread->hk_activations ++;
+
+    if (thread->hk_state == HK_HISR_IDLE)
+        HK_Ready(thread, NU_FALSE);
+
+    HK_Preempt();
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (NU_SUCCESS);
+
+} /* NU_Activate_HISR */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Current_Task_Pointer
+*
+*   DESCRIPTION
+*
+*       This function returns the task that is running.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       The running task, or NU_NULL if a HISR is running.
+*
+***********************************************************************/
+NU_TASK *NU_Current_Task_Pointer(VOID)
+{
+    HK_THREAD   *self = HK_Self;
+
+    if ( (self == NU_NULL) || (self->hk_is_hisr) )
+        return (NU_NULL);
+
+    return ((NU_TASK *)self->hk_object);
+
+} /* NU_Current_Task_Pointer */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Suspend_Task
+*
+*   DESCRIPTION
+*
+*       This function unconditionally suspends the calling task or a
+*       ready task.  Suspending a task that is waiting on a kernel
+*       object is not supported.
+*
+*   INPUTS
+*
+*       *task                   The task to suspend.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The task was suspended.
+*       NU_INVALID_TASK         task is NU_NULL.
+*       NU_INVALID_SUSPEND      The task is waiting on a kernel object.
+*
+***********************************************************************/
+STATUS NU_Suspend_Task(NU_TASK *task)
+{
+    HK_THREAD   *thread;
+    HK_THREAD   **link;
+    STATUS      status = NU_SUCCESS;
+
+    if (task == NU_NULL)
+        return (NU_INVALID_TASK);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    thread = HK_THREAD_OF(task);
+
+    if (thread == HK_Self)
+    {
+        thread->hk_state = NU_PURE_SUSPEND;
+
+        HK_Switch();
+    }
+
+    else if (thread->hk_state == NU_READY)
+    {
+        for (link = &HK_Ready_List; *link != thread;
+             link = &(*link)->hk_next)
+            ;
+
+        *link = thread->hk_next;
+
+        thread->hk_state = NU_PURE_SUSPEND;
+    }
+
+    else if (thread->hk_state != NU_PURE_SUSPEND)
+        status = NU_INVALID_SUSPEND;
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (status);
+
+} /* NU_Suspend_Task */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Resume_Task
+*
+*   DESCRIPTION
+*
+*       This function resumes a task that was unconditionally suspended
+*       or created without being started.
+*
+*   INPUTS
+*
+*       *task                   The task to resume.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The task was resumed.
+*       NU_INVALID_TASK         task is NU_NULL.
+*       NU_INVALID_RESUME       The task is not unconditionally
+*                               suspended.
+*
+***********************************************************************/
+STATUS NU_Resume_Task(NU_TASK *task)
+{
+    HK_THREAD   *thread;
+    STATUS      status = NU_SUCCESS;
+
+    if (task == NU_NULL)
+        return (NU_INVALID_TASK);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    thread = HK_THREAD_OF(task);
+
+    if (thread->hk_state == NU_PURE_SUSPEND)
+    {
+        HK_Ready(thread, NU_FALSE);
+        HK_Preempt();
+    }
+
+    else
+        status = NU_INVALID_RESUME;
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (status);
+
+} /* NU_Resume_Task */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Relinquish
+*
+*   DESCRIPTION
+*
+*       This function gives the processor to the next ready task of the
+*       same or higher priority, if there is one.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID NU_Relinquish(VOID)
+{
+    HK_THREAD   *self = HK_Self;
+
+    pthread_mutex_lock(&HK_Lock);
+
+    if ( (HK_Ready_List) &&
+         (HK_Ready_List->hk_priority <= self->hk_priority) )
+    {
+        HK_Ready(self, NU_FALSE);
+        HK_Switch();
+    }
+
+    pthread_mutex_unlock(&HK_Lock);
+
+} /* NU_Relinquish */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Sleep
+*
+*   DESCRIPTION
+*
+*       This function suspends the calling task for a number of ticks.
+*
+*   INPUTS
+*
+*       ticks                   The number of ticks to sleep.
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+VOID NU_Sleep(UNSIGNED ticks)
+{
+    if (ticks == 0)
+        NU_Relinquish();
+
+    else
+    {
+        pthread_mutex_lock(&HK_Lock);
+
+        (VOID)HK_Wait(NU_NULL, NU_FIFO, ticks);
+
+        pthread_mutex_unlock(&HK_Lock);
+    }
+
+} /* NU_Sleep */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Change_Preemption
+*
+*   DESCRIPTION
+*
+*       This function changes the preemption posture of the calling
+*       task.
+*
+*   INPUTS
+*
+*       preempt                 NU_PREEMPT or NU_NO_PREEMPT.
+*
+*   OUTPUTS
+*
+*       The previous preemption posture.
+*
+***********************************************************************/
+OPTION NU_Change_Preemption(OPTION preempt)
+{
+    HK_THREAD   *self = HK_Self;
+    OPTION      old_preempt;
+
+    pthread_mutex_lock(&HK_Lock);
+
+    old_preempt = self->hk_preempt;
+    self->hk_preempt = preempt;
+
+    HK_Preempt();
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (old_preempt);
+
+} /* NU_Change_Preemption */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Task_Information
+*
+*   DESCRIPTION
+*
+*       This function returns information about a task.  The stack of a
+*       host thread is not reported.
+*
+*   INPUTS
+*
+*       *task                   The task.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The information was returned.
+*       NU_INVALID_TASK         task is NU_NULL.
+*
+***********************************************************************/
+STATUS NU_Task_Information(NU_TASK *task, CHAR *name,
+                           DATA_ELEMENT *status, UNSIGNED *scheduled_count,
+                           OPTION *priority, OPTION *preempt,
+                           UNSIGNED *time_slice, VOID **stack_base,
+                           UNSIGNED *stack_size, UNSIGNED *minimum_stack)
+{
+    HK_THREAD   *thread;
+
+    if (task == NU_NULL)
+        return (NU_INVALID_TASK);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    thread = HK_THREAD_OF(task);
+
+    memcpy(name, thread->hk_name, NU_MAX_NAME);
+
+    if ( (thread->hk_state == NU_PURE_SUSPEND) ||
+         (thread->hk_state == NU_FINISHED) )
+        *status = (DATA_ELEMENT)thread->hk_state;
+    else
+        *status = NU_READY;
+
+    *scheduled_count = thread->hk_scheduled;
+    *priority = (OPTION)thread->hk_priority;
+    *preempt = thread->hk_preempt;
+    *time_slice = 0;
+    *stack_base = NU_NULL;
+    *stack_size = HK_THREAD_STACK_SIZE;
+    *minimum_stack = HK_THREAD_STACK_SIZE;
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (NU_SUCCESS);
+
+} /* NU_Task_Information */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Retrieve_Clock
+*
+*   DESCRIPTION
+*
+*       This function returns the system clock.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       The number of ticks since the kernel was initialized.
+*
+***********************************************************************/
+UNSIGNED NU_Retrieve_Clock(VOID)
+{
+    return (HK_Clock());
+
+} /* NU_Retrieve_Clock */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       ESAL_GE_INT_Global_Set
+*
+*   DESCRIPTION
+*
+*       This function sets the interrupt level of the calling thread.
+*       While interrupts are disabled, no HISR can run in its place;
+*       when they are enabled again, a HISR or task made ready in the
+*       meantime preempts it.
+*
+*   INPUTS
+*
+*       new_value               The new interrupt level.
+*
+*   OUTPUTS
+*
+*       The previous interrupt level.
+*
+***********************************************************************/
+INT ESAL_GE_INT_Global_Set(INT new_value)
+{
+    HK_THREAD   *self = HK_Self;
+    INT         old_value;
+
+    if (self == NU_NULL)
+        return (NU_ENABLE_INTERRUPTS);
+
+    old_value = self->hk_int_level;
+    self->hk_int_level = new_value;
+
+    if ( (new_value == NU_ENABLE_INTERRUPTS) && (HK_Preempt_Pending) )
+    {
+        pthread_mutex_lock(&HK_Lock);
+
+        HK_Preempt();
+
+        pthread_mutex_unlock(&HK_Lock);
+    }
+
+    return (old_value);
+
+} /* ESAL_GE_INT_Global_Set */
@@ -0,0 +1,870 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       hk_sync.c
+*
+*   COMPONENT
+*
+*       HK - Host Kernel
+*
+*   DESCRIPTION
+*
+*       This file contains the semaphore, event group and queue services
+*       of the host kernel.  Each object is kept in the control block
+*       passed by the caller.  A resource released to a waiting thread
+*       is handed to it directly, as the Nucleus PLUS services do.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       NU_Create_Semaphore
+*       NU_Delete_Semaphore
+*       NU_Obtain_Semaphore
+*       NU_Release_Semaphore
+*       NU_Create_Event_Group
+*       NU_Delete_Event_Group
+*       NU_Set_Events
+*       NU_Retrieve_Events
+*       HK_Queue_Write
+*       HK_Queue_Read
+*       NU_Create_Queue
+*       NU_Delete_Queue
+*       NU_Send_To_Queue
+*       NU_Receive_From_Queue
+*
+*   DEPENDENCIES
+*
+*       hk_defs.h
+*
+***********************************************************************/
+
+#include "hk_defs.h"
+
+/* The emulated objects must fit in the control blocks. */
+typedef CHAR HK_SEMAPHORE_FITS[(sizeof(HK_SEMAPHORE) <=
+                                sizeof(NU_SEMAPHORE)) ? 1 : -1];
+typedef CHAR HK_EVENT_GROUP_FITS[(sizeof(HK_EVENT_GROUP) <=
+                                  sizeof(NU_EVENT_GROUP)) ? 1 : -1];
+typedef CHAR HK_QUEUE_FITS[(sizeof(HK_QUEUE) <= sizeof(NU_QUEUE)) ? 1 : -1];
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Create_Semaphore
+*
+*   DESCRIPTION
+*
+*       This function creates a counting semaphore.
+*
+*   INPUTS
+*
+*       *semaphore              The semaphore control block.
+*       *name                   Name of the semaphore.
+*       initial_count           The initial count.
+*       suspend_type            NU_FIFO, NU_PRIORITY or
+*                               NU_PRIORITY_INHERIT, which is treated
+*                               as NU_PRIORITY.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The semaphore was created.
+*       NU_INVALID_SEMAPHORE    semaphore is NU_NULL.
+*
+***********************************************************************/
+STATUS NU_Create_Semaphore(NU_SEMAPHORE *semaphore, CHAR *name,
+                           UNSIGNED initial_count, OPTION suspend_type)
+{
+    HK_SEMAPHORE    *sem = (HK_SEMAPHORE *)semaphore;
+
+    NU_UNUSED_PARAM(name);
+
+    if (sem == NU_NULL)
+        return (NU_INVALID_SEMAPHORE);
+
+    sem->hk_count = initial_count;
+    sem->hk_suspend_type = (suspend_type == NU_FIFO) ? NU_FIFO : NU_PRIORITY;
+    sem->hk_waiters = NU_NULL;
+    sem->hk_id = HK_SEMAPHORE_ID;
+
+    return (NU_SUCCESS);
+
+} /* NU_Create_Semaphore */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Delete_Semaphore
+*
+*   DESCRIPTION
+*
+*       This function deletes a semaphore.  Threads waiting on it are
+*       resumed with NU_SEMAPHORE_DELETED.
+*
+*   INPUTS
+*
+*       *semaphore              The semaphore.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The semaphore was deleted.
+*       NU_INVALID_SEMAPHORE    semaphore is not a semaphore.
+*
+***********************************************************************/
+STATUS NU_Delete_Semaphore(NU_SEMAPHORE *semaphore)
+{
+    HK_SEMAPHORE    *sem = (HK_SEMAPHORE *)semaphore;
+
+    if ( (sem == NU_NULL) || (sem->hk_id != HK_SEMAPHORE_ID) )
+        return (NU_INVALID_SEMAPHORE);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    sem->hk_id = 0;
+
+    while (sem->hk_waiters)
+        HK_Wake(sem->hk_waiters, NU_SEMAPHORE_DELETED);
+
+    HK_Preempt();
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (NU_SUCCESS);
+
+} /* NU_Delete_Semaphore */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Obtain_Semaphore
+*
+*   DESCRIPTION
+*
+*       This function obtains an instance of a semaphore.
+*
+*   INPUTS
+*
+*       *semaphore              The semaphore.
+*       suspend                 NU_NO_SUSPEND, NU_SUSPEND or the number
+*                               of ticks to wait.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The semaphore was obtained.
+*       NU_INVALID_SEMAPHORE    semaphore is not a semaphore.
+*       NU_UNAVAILABLE          The semaphore is not available.
+*       NU_TIMEOUT              The wait timed out.
+*       NU_SEMAPHORE_DELETED    The semaphore was deleted.
+*
+***********************************************************************/
+STATUS NU_Obtain_Semaphore(NU_SEMAPHORE *semaphore, UNSIGNED suspend)
+{
+    HK_SEMAPHORE    *sem = (HK_SEMAPHORE *)semaphore;
+    STATUS          status = NU_SUCCESS;
+
+    if ( (sem == NU_NULL) || (sem->hk_id != HK_SEMAPHORE_ID) )
+        return (NU_INVALID_SEMAPHORE);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    if (sem->hk_count > 0)
+    {
+        sem->hk_count --;
+
+        HK_Preempt();
+    }
+
+    else if (suspend == NU_NO_SUSPEND)
+        status = NU_UNAVAILABLE;
+
+    else
+        status = HK_Wait(&sem->hk_waiters, sem->hk_suspend_type, suspend);
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (status);
+
+} /* NU_Obtain_Semaphore */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Release_Semaphore
+*
+*   DESCRIPTION
+*
+*       This function releases an instance of a semaphore, to the first
+*       waiting thread if there is one.
+*
+*   INPUTS
+*
+*       *semaphore              The semaphore.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The semaphore was released.
+*       NU_INVALID_SEMAPHORE    semaphore is not a semaphore.
+*
+***********************************************************************/
+STATUS NU_Release_Semaphore(NU_SEMAPHORE *semaphore)
+{
+    HK_SEMAPHORE    *sem = (HK_SEMAPHORE *)semaphore;
+
+    if ( (sem == NU_NULL) || (sem->hk_id != HK_SEMAPHORE_ID) )
+        return (NU_INVALID_SEMAPHORE);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    if (sem->hk_waiters)
+        HK_Wake(sem->hk_waiters, NU_SUCCESS);
+    else
+        sem->hk_count ++;
+
+    HK_Preempt();
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (NU_SUCCESS);
+
+} /* NU_Release_Semaphore */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Create_Event_Group
+*
+*   DESCRIPTION
+*
+*       This function creates an event group with all flags clear.
+*
+*   INPUTS
+*
+*       *group                  The event group control block.
+*       *name                   Name of the event group.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The event group was created.
+*       NU_INVALID_GROUP        group is NU_NULL.
+*
+***********************************************************************/
+STATUS NU_Create_Event_Group(NU_EVENT_GROUP *group, CHAR *name)
+{
+    HK_EVENT_GROUP  *grp = (HK_EVENT_GROUP *)group;
+
+    NU_UNUSED_PARAM(name);
+
+    if (grp == NU_NULL)
+        return (NU_INVALID_GROUP);
+
+    grp->hk_flags = 0;
+    grp->hk_waiters = NU_NULL;
+    grp->hk_id = HK_EVENT_ID;
+
+    return (NU_SUCCESS);
+
+} /* NU_Create_Event_Group */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Delete_Event_Group
+*
+*   DESCRIPTION
+*
+*       This function deletes an event group.  Threads waiting on it are
+*       resumed with NU_GROUP_DELETED.
+*
+*   INPUTS
+*
+*       *group                  The event group.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The event group was deleted.
+*       NU_INVALID_GROUP        group is not an event group.
+*
+***********************************************************************/
+STATUS NU_Delete_Event_Group(NU_EVENT_GROUP *group)
+{
+    HK_EVENT_GROUP  *grp = (HK_EVENT_GROUP *)group;
+
+    if ( (grp == NU_NULL) || (grp->hk_id != HK_EVENT_ID) )
+        return (NU_INVALID_GROUP);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    grp->hk_id = 0;
+
+    while (grp->hk_waiters)
+        HK_Wake(grp->hk_waiters, NU_GROUP_DELETED);
+
+    HK_Preempt();
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (NU_SUCCESS);
+
+} /* NU_Delete_Event_Group */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Set_Events
+*
+*   DESCRIPTION
+*
+*       This function ORs or ANDs the flags of an event group and
+*       resumes each waiting thread whose request is now satisfied.
+*
+*   INPUTS
+*
+*       *group                  The event group.
+*       events                  The event flags.
+*       operation               NU_OR or NU_AND.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The flags were set.
+*       NU_INVALID_GROUP        group is not an event group.
+*       NU_INVALID_OPERATION    operation is not NU_OR or NU_AND.
+*
+***********************************************************************/
+STATUS NU_Set_Events(NU_EVENT_GROUP *group, UNSIGNED events,
+                     OPTION operation)
+{
+    HK_EVENT_GROUP  *grp = (HK_EVENT_GROUP *)group;
+    HK_THREAD       *thread, *next;
+    UNSIGNED        matched;
+
+    if ( (grp == NU_NULL) || (grp->hk_id != HK_EVENT_ID) )
+        return (NU_INVALID_GROUP);
+
+    if ( (operation != NU_OR) && (operation != NU_AND) )
+        return (NU_INVALID_OPERATION);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    if (operation == NU_OR)
+        grp->hk_flags |= events;
+    else
+        grp->hk_flags &= events;
+
+    for (thread = grp->hk_waiters; thread; thread = next)
+    {
+        next = thread->hk_next;
+
+        matched = grp->hk_flags & thread->hk_events;
+
+        if ( (thread->hk_operation == NU_AND) ||
+             (thread->hk_operation == NU_AND_CONSUME) )
+            matched = (matched == thread->hk_events) ? matched : 0;
+
+        if (matched)
+        {
+            thread->hk_events = grp->hk_flags;
+
+            if ( (thread->hk_operation == NU_OR_CONSUME) ||
+                 (thread->hk_operation == NU_AND_CONSUME) )
+                grp->hk_flags &= ~matched;
+
+            HK_Wake(thread, NU_SUCCESS);
+        }
+    }
+
+    HK_Preempt();
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (NU_SUCCESS);
+
+} /* NU_Set_Events */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Retrieve_Events
+*
+*   DESCRIPTION
+*
+*       This function retrieves a combination of event flags from an
+*       event group, waiting for them if requested.
+*
+*   INPUTS
+*
+*       *group                  The event group.
+*       requested_flags         The event flags requested.
+*       operation               NU_OR, NU_OR_CONSUME, NU_AND or
+*                               NU_AND_CONSUME.
+*       *retrieved_flags        The flags of the group when the request
+*                               was satisfied.
+*       suspend                 NU_NO_SUSPEND, NU_SUSPEND or the number
+*                               of ticks to wait.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The request was satisfied.
+*       NU_INVALID_GROUP        group is not an event group.
+*       NU_NOT_PRESENT          The flags are not present.
+*       NU_TIMEOUT              The wait timed out.
+*       NU_GROUP_DELETED        The event group was deleted.
+*
+***********************************************************************/
+STATUS NU_Retrieve_Events(NU_EVENT_GROUP *group, UNSIGNED requested_flags,
+                          OPTION operation, UNSIGNED *retrieved_flags,
+                          UNSIGNED suspend)
+{
+    HK_EVENT_GROUP  *grp = (HK_EVENT_GROUP *)group;
+    HK_THREAD       *self = HK_Self;
+    UNSIGNED        matched;
+    STATUS          status = NU_SUCCESS;
+
+    if ( (grp == NU_NULL) || (grp->hk_id != HK_EVENT_ID) )
+        return (NU_INVALID_GROUP);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    matched = grp->hk_flags & requested_flags;
+
+    if ( (operation == NU_AND) || (operation == NU_AND_CONSUME) )
+        matched = (matched == requested_flags) ? matched : 0;
+
+    if (matched)
+    {
+        *retrieved_flags = grp->hk_flags;
+
+        if ( (operation == NU_OR_CONSUME) || (operation == NU_AND_CONSUME) )
+            grp->hk_flags &= ~matched;
+
+        HK_Preempt();
+    }
+
+    else if (suspend == NU_NO_SUSPEND)
+    {
+        *retrieved_flags = 0;
+        status = NU_NOT_PRESENT;
+    }
+
+    else
+    {
+        self->hk_events = requested_flags;
+        self->hk_operation = operation;
+
+        status = HK_Wait(&grp->hk_waiters, NU_FIFO, suspend);
+
+        *retrieved_flags = (status == NU_SUCCESS) ? self->hk_events : 0;
+    }
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (status);
+
+} /* NU_Retrieve_Events */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Queue_Write
+*
+*   DESCRIPTION
+*
+*       This function appends a message to the circular buffer of a
+*       queue.  A variable length message is preceded by its size.
+*
+*   INPUTS
+*
+*       *q                      The queue.
+*       *message                The message.
+*       size                    The size of the message in UNSIGNED
+*                               words.
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID HK_Queue_Write(HK_QUEUE *q, const UNSIGNED *message,
+                           UNSIGNED size)
+{
+    UNSIGNED    i;
+
+    if (q->hk_msg_type == NU_VARIABLE_SIZE)
+    {
+        q->hk_start[q->hk_write] = size;
+
+        if (++q->hk_write == q->hk_size)
+            q->hk_write = 0;
+
+        q->hk_available --;
+    }
+
+    for (i = 0; i < size; i++)
+    {
+        q->hk_start[q->hk_write] = message[i];
+
+        if (++q->hk_write == q->hk_size)
+            q->hk_write = 0;
+    }
+
+    q->hk_available -= size;
+    q->hk_messages ++;
+
+} /* HK_Queue_Write */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       HK_Queue_Read
+*
+*   DESCRIPTION
+*
+*       This function removes the oldest message from the circular
+*       buffer of a queue.
+*
+*   INPUTS
+*
+*       *q                      The queue.
+*       *message                The buffer to copy the message to.
+*
+*   OUTPUTS
+*
+*       The size of the message in UNSIGNED words.
+*
+***********************************************************************/
+STATIC UNSIGNED HK_Queue_Read(HK_QUEUE *q, UNSIGNED *message)
+{
+    UNSIGNED    i, size = q->hk_msg_size;
+
+    if (q->hk_msg_type == NU_VARIABLE_SIZE)
+    {
+        size = q->hk_start[q->hk_read];
+
+        if (++q->hk_read == q->hk_size)
+            q->hk_read = 0;
+
+        q->hk_available ++;
+    }
+
+    for (i = 0; i < size; i++)
+    {
+        message[i] = q->hk_start[q->hk_read];
+
+        if (++q->hk_read == q->hk_size)
+            q->hk_read = 0;
+    }
+
+    q->hk_available += size;
+    q->hk_messages --;
+
+    return (size);
+
+} /* HK_Queue_Read */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Create_Queue
+*
+*   DESCRIPTION
+*
+*       This function creates a message queue.
+*
+*   INPUTS
+*
+*       *queue                  The queue control block.
+*       *name                   Name of the queue.
+*       *start_address          The memory of the queue.
+*       queue_size              The size of the memory in UNSIGNED
+*                               words.
+*       message_type            NU_FIXED_SIZE or NU_VARIABLE_SIZE.
+*       message_size            The size, or the maximum size, of a
+*                               message in UNSIGNED words.
+*       suspend_type            NU_FIFO or NU_PRIORITY.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The queue was created.
+*       NU_INVALID_QUEUE        queue is NU_NULL.
+*       NU_INVALID_MEMORY       start_address is NU_NULL.
+*       NU_INVALID_SIZE         A message does not fit in the queue.
+*
+***********************************************************************/
+STATUS NU_Create_Queue(NU_QUEUE *queue, CHAR *name, VOID *start_address,
+                       UNSIGNED queue_size, OPTION message_type,
+                       UNSIGNED message_size, OPTION suspend_type)
+{
+    HK_QUEUE    *q = (HK_QUEUE *)queue;
+
+    NU_UNUSED_PARAM(name);
+
+    if (q == NU_NULL)
+        return (NU_INVALID_QUEUE);
+
+    if (start_address == NU_NULL)
+        return (NU_INVALID_MEMORY);
+
+    if ( (message_size == 0) || (message_size > queue_size) ||
+         ((message_type == NU_VARIABLE_SIZE) &&
+          (message_size + 1 > queue_size)) )
+        return (NU_INVALID_SIZE);
+
+    q->hk_start = (UNSIGNED *)start_address;
+    q->hk_size = queue_size;
+    q->hk_available = queue_size;
+    q->hk_messages = 0;
+    q->hk_read = 0;
+    q->hk_write = 0;
+    q->hk_msg_size = message_size;
+    q->hk_msg_type = message_type;
+    q->hk_suspend_type = (suspend_type == NU_FIFO) ? NU_FIFO : NU_PRIORITY;
+    q->hk_receivers = NU_NULL;
+    q->hk_senders = NU_NULL;
+    q->hk_id = HK_QUEUE_ID;
+
+    return (NU_SUCCESS);
+
+} /* NU_Create_Queue */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Delete_Queue
+*
+*   DESCRIPTION
+*
+*       This function deletes a queue.  Threads waiting on it are
+*       resumed with NU_QUEUE_DELETED.
+*
+*   INPUTS
+*
+*       *queue                  The queue.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The queue was deleted.
+*       NU_INVALID_QUEUE        queue is not a queue.
+*
+***********************************************************************/
+STATUS NU_Delete_Queue(NU_QUEUE *queue)
+{
+    HK_QUEUE    *q = (HK_QUEUE *)queue;
+
+    if ( (q == NU_NULL) || (q->hk_id != HK_QUEUE_ID) )
+        return (NU_INVALID_QUEUE);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    q->hk_id = 0;
+
+    while (q->hk_receivers)
+        HK_Wake(q->hk_receivers, NU_QUEUE_DELETED);
+
+    while (q->hk_senders)
+        HK_Wake(q->hk_senders, NU_QUEUE_DELETED);
+
+    HK_Preempt();
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (NU_SUCCESS);
+
+} /* NU_Delete_Queue */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Send_To_Queue
+*
+*   DESCRIPTION
+*
+*       This function sends a message to the back of a queue.  If a
+*       thread is waiting to receive, the message is copied to it
+*       directly.
+*
+*   INPUTS
+*
+*       *queue                  The queue.
+*       *message                The message.
+*       size                    The size of the message in UNSIGNED
+*                               words.
+*       suspend                 NU_NO_SUSPEND, NU_SUSPEND or the number
+*                               of ticks to wait.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The message was sent.
+*       NU_INVALID_QUEUE        queue is not a queue.
+*       NU_INVALID_SIZE         size does not match the queue.
+*       NU_QUEUE_FULL           The queue is full.
+*       NU_TIMEOUT              The wait timed out.
+*       NU_QUEUE_DELETED        The queue was deleted.
+*
+***********************************************************************/
+STATUS NU_Send_To_Queue(NU_QUEUE *queue, VOID *message, UNSIGNED size,
+                        UNSIGNED suspend)
+{
+    HK_QUEUE    *q = (HK_QUEUE *)queue;
+    HK_THREAD   *self = HK_Self;
+    HK_THREAD   *receiver;
+    UNSIGNED    needed;
+    UNSIGNED    i;
+    STATUS      status = NU_SUCCESS;
+
+    if ( (q == NU_NULL) || (q->hk_id != HK_QUEUE_ID) )
+        return (NU_INVALID_QUEUE);
+
+    if ( (size == 0) || (size > q->hk_msg_size) ||
+         ((q->hk_msg_type == NU_FIXED_SIZE) && (size != q->hk_msg_size)) )
+        return (NU_INVALID_SIZE);
+
+    needed = (q->hk_msg_type == NU_VARIABLE_SIZE) ? size + 1 : size;
+
+    pthread_mutex_lock(&HK_Lock);
+
+    if (q->hk_receivers)
+    {
+        receiver = q->hk_receivers;
+
+        for (i = 0; i < size; i++)
+            receiver->hk_message[i] = ((UNSIGNED *)message)[i];
+
+        receiver->hk_size = size;
+
+        HK_Wake(receiver, NU_SUCCESS);
+        HK_Preempt();
+    }
+
+    else if (q->hk_available >= needed)
+    {
+        HK_Queue_Write(q, (UNSIGNED *)message, size);
+        HK_Preempt();
+    }
+
+    else if (suspend == NU_NO_SUSPEND)
+        status = NU_QUEUE_FULL;
+
+    else
+    {
+        self->hk_message = (UNSIGNED *)message;
+        self->hk_size = size;
+
+        status = HK_Wait(&q->hk_senders, q->hk_suspend_type, suspend);
+    }
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (status);
+
+} /* NU_Send_To_Queue */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Receive_From_Queue
+*
+*   DESCRIPTION
+*
+*       This function receives the oldest message of a queue.  If a
+*       thread is waiting to send, its message takes the freed space.
+*
+*   INPUTS
+*
+*       *queue                  The queue.
+*       *message                The buffer to copy the message to.
+*       size                    The size of the buffer in UNSIGNED
+*                               words.
+*       *actual_size            The size of the message received.
+*       suspend                 NU_NO_SUSPEND, NU_SUSPEND or the number
+*                               of ticks to wait.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              A message was received.
+*       NU_INVALID_QUEUE        queue is not a queue.
+*       NU_INVALID_SIZE         size does not match the queue.
+*       NU_QUEUE_EMPTY          The queue is empty.
+*       NU_TIMEOUT              The wait timed out.
+*       NU_QUEUE_DELETED        The queue was deleted.
+*
+***********************************************************************/
+STATUS NU_Receive_From_Queue(NU_QUEUE *queue, VOID *message, UNSIGNED size,
+                             UNSIGNED *actual_size, UNSIGNED suspend)
+{
+    HK_QUEUE    *q = (HK_QUEUE *)queue;
+    HK_THREAD   *self = HK_Self;
+    HK_THREAD   *sender;
+    STATUS      status = NU_SUCCESS;
+
+    if ( (q == NU_NULL) || (q->hk_id != HK_QUEUE_ID) )
+        return (NU_INVALID_QUEUE);
+
+    if ( ((q->hk_msg_type == NU_FIXED_SIZE) && (size != q->hk_msg_size)) ||
+         ((q->hk_msg_type == NU_VARIABLE_SIZE) && (size < q->hk_msg_size)) )
+        return (NU_INVALID_SIZE);
+
+    pthread_mutex_lock(&HK_Lock);
+
+    if (q->hk_messages)
+    {
+        *actual_size = HK_Queue_Read(q, (UNSIGNED *)message);
+
+        /* The oldest waiting sender can now queue its message. */
+        sender = q->hk_senders;
+
+        if ( (sender) &&
+             (q->hk_available >= ((q->hk_msg_type == NU_VARIABLE_SIZE) ?
+                                  sender->hk_size + 1 : sender->hk_size)) )
+        {
+            HK_Queue_Write(q, sender->hk_message, sender->hk_size);
+            HK_Wake(sender, NU_SUCCESS);
+        }
+
+        HK_Preempt();
+    }
+
+    else if (suspend == NU_NO_SUSPEND)
+        status = NU_QUEUE_EMPTY;
+
+    else
+    {
+        self->hk_message = (UNSIGNED *)message;
+
+        status = HK_Wait(&q->hk_receivers, q->hk_suspend_type, suspend);
+
+        if (status == NU_SUCCESS)
+            *actual_size = self->hk_size;
+    }
+
+    pthread_mutex_unlock(&HK_Lock);
+
+    return (status);
+
+} /* NU_Receive_From_Queue */
@@ -0,0 +1,980 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       netbench.c
+*
+*   COMPONENT
+*
+*       NETBENCH - Host Benchmarks
+*
+*   DESCRIPTION
+*
+*       This file contains the benchmarks of the host build.  By default
+*       two stack instances are run in two processes joined by a wire
+*       device: the parent is the client at 10.0.0.1 and the child the
+*       server at 10.0.0.2.  Given the argument "loopback", the client
+*       and server share one stack instance and talk over the loopback
+*       device, as the netbench shell command does on a target.
+*
+*           netbench [loopback] [tcp_kbytes] [udp_count] [conn_count]
+*
+*       The client measures TCP bulk throughput, UDP datagrams per
+*       second, the TCP connection setup rate and, over the wire, the
+*       cost of a route and ARP lookup.
+*
+*   DATA STRUCTURES
+*
+*       NetBench_Device
+*
+*   FUNCTIONS
+*
+*       main
+*       NetBench_Init
+*       NetBench_Addr
+*       NetBench_Recv_All
+*       NetBench_TCP_Server
+*       NetBench_UDP_Server
+*       NetBench_TCP_Connect
+*       NetBench_TCP
+*       NetBench_UDP
+*       NetBench_Conn
+*       NetBench_Lookup
+*       NetBench_Client
+*
+*   DEPENDENCIES
+*
+*       stdio.h
+*       stdlib.h
+*       string.h
+*       signal.h
+*       unistd.h
+*       sys/wait.h
+*       nu_net.h
+*       hk_defs.h
+*       wire.h
+*
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "networking/nu_net.h"
+#include "hk_defs.h"
+#include "wire.h"
+
+/* The ports of the TCP and UDP servers. */
+#define NETBENCH_TCP_PORT       5001
+#define NETBENCH_UDP_PORT       5002
+
+/* The size of the data sent with each call, and of a UDP datagram. */
+#define NETBENCH_TCP_CHUNK      16384
+#define NETBENCH_UDP_SIZE       64
+
+/* Default repetitions of each benchmark. */
+#define NETBENCH_TCP_KBYTES     65536
+#define NETBENCH_UDP_COUNT      200000
+#define NETBENCH_CONN_COUNT     2000
+#define NETBENCH_LOOKUP_COUNT   100000
+
+/* The commands a client sends to the servers. */
+#define NETBENCH_CMD_BULK       'B'
+#define NETBENCH_CMD_CONN       'C'
+#define NETBENCH_CMD_DATA       'D'
+#define NETBENCH_CMD_END        'E'
+
+/* The size of the command of a TCP connection: the command and the
+   number of bytes that follow it. */
+#define NETBENCH_HEADER_SIZE    5
+
+/* The time the client waits for the reply to the end of the UDP
+   benchmark, and the number of times it asks for it. */
+#define NETBENCH_UDP_WAIT       NU_PLUS_TICKS_PER_SEC
+#define NETBENCH_UDP_RETRIES    5
+
+/* The size of the socket buffers of the wire. */
+#define NETBENCH_WIRE_BUFFER    (4 * 1024 * 1024)
+
+/* The servers run at a higher priority than the client, so a server
+   sharing the stack with the client drains its socket as soon as data
+   arrives. */
+#define NETBENCH_SERVER_PRIORITY    19
+#define NETBENCH_CLIENT_PRIORITY    20
+
+/* The stacks of the host kernel threads are allocated by the kernel. */
+#define NETBENCH_STACK_SIZE     NU_MIN_STACK_SIZE
+
+/* The wire device of this process. */
+STATIC DEV_DEVICE       NetBench_Device;
+
+STATIC INT              NetBench_Loopback;
+STATIC INT              NetBench_Server;
+STATIC pid_t            NetBench_Child;
+STATIC UINT8            NetBench_Peer[IP_ADDR_LEN];
+
+STATIC UINT32           NetBench_TCP_Kbytes = NETBENCH_TCP_KBYTES;
+STATIC UINT32           NetBench_UDP_Count = NETBENCH_UDP_COUNT;
+STATIC UINT32           NetBench_Conn_Count = NETBENCH_CONN_COUNT;
+
+STATIC NU_TASK          NetBench_Init_Task;
+STATIC NU_TASK          NetBench_TCP_Task;
+STATIC NU_TASK          NetBench_UDP_Task;
+
+STATIC CHAR             NetBench_Tx_Buffer[NETBENCH_TCP_CHUNK];
+STATIC CHAR             NetBench_Rx_Buffer[NETBENCH_TCP_CHUNK];
+STATIC CHAR             NetBench_Server_Buffer[NETBENCH_TCP_CHUNK];
+
+STATIC VOID NetBench_Init(UNSIGNED argc, VOID *argv);
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       main
+*
+*   DESCRIPTION
+*
+*       This function parses the arguments, creates the wire and the
+*       server process if they are used, and starts the host kernel with
+*       the task that initializes the stack.
+*
+*   INPUTS
+*
+*       argc                    The number of arguments.
+*       **argv                  The arguments.
+*
+*   OUTPUTS
+*
+*       1                       The benchmarks could not be started.
+*
+***********************************************************************/
+int main(int argc, char **argv)
+{
+    INT     sockets[2];
+    INT     arg = 1;
+
+    setvbuf(stdout, NU_NULL, _IONBF, 0);
+
+    if ( (argc > arg) && (strcmp(argv[arg], "loopback") == 0) )
+    {
+        NetBench_Loopback = NU_TRUE;
+        arg ++;
+    }
+
+    if (argc > arg)
+        NetBench_TCP_Kbytes = (UINT32)strtoul(argv[arg++], NU_NULL, 0);
+
+    if (argc > arg)
+        NetBench_UDP_Count = (UINT32)strtoul(argv[arg++], NU_NULL, 0);
+
+    if (argc > arg)
+        NetBench_Conn_Count = (UINT32)strtoul(argv[arg++], NU_NULL, 0);
+
+    if (NetBench_Loopback)
+    {
+        NetBench_Peer[0] = 127;
+        NetBench_Peer[3] = 1;
+    }
+
+    else
+    {
+        if (HK_Socket_Pair(sockets, NETBENCH_WIRE_BUFFER) != 0)
+        {
+            perror("netbench: socketpair");
+            return (1);
+        }
+
+        NetBench_Child = fork();
+
+        if (NetBench_Child < 0)
+        {
+            perror("netbench: fork");
+            return (1);
+        }
+
+        NetBench_Server = (NetBench_Child == 0);
+
+        NetBench_Device.dv_name = "wire0";
+        NetBench_Device.dv_init = WIRE_Init;
+        NetBench_Device.dv_driver_options =
+            (UINT32)sockets[NetBench_Server ? 1 : 0];
+
+        (VOID)close(sockets[NetBench_Server ? 0 : 1]);
+
+        NetBench_Device.dv_ip_addr[0] = 10;
+        NetBench_Device.dv_ip_addr[3] = NetBench_Server ? 2 : 1;
+
+        NetBench_Device.dv_subnet_mask[0] = 255;
+        NetBench_Device.dv_subnet_mask[1] = 255;
+        NetBench_Device.dv_subnet_mask[2] = 255;
+
+        NetBench_Peer[0] = 10;
+        NetBench_Peer[3] = NetBench_Server ? 1 : 2;
+    }
+
+    HK_Initialize();
+
+    if (NU_Create_Task(&NetBench_Init_Task, "nbinit", NetBench_Init, 0,
+                       NU_NULL, NU_NULL, NETBENCH_STACK_SIZE,
+                       NETBENCH_CLIENT_PRIORITY, 0, NU_PREEMPT,
+                       NU_START) != NU_SUCCESS)
+        return (1);
+
+    HK_Start();
+
+    return (0);
+
+} /* main */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Addr
+*
+*   DESCRIPTION
+*
+*       This function fills in the address of a benchmark socket.
+*
+*   INPUTS
+*
+*       *addr                   The address structure to fill in.
+*       *ip_addr                The IP address, or NU_NULL for any.
+*       port                    The port number.
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID NetBench_Addr(struct addr_struct *addr, const UINT8 *ip_addr,
+                          UINT16 port)
+{
+    memset(addr, 0, sizeof(*addr));
+
+    addr->family = NU_FAMILY_IP;
+    addr->port = port;
+    addr->name = "nbench";
+
+    if (ip_addr)
+        memcpy(addr->id.is_ip_addrs, ip_addr, IP_ADDR_LEN);
+
+} /* NetBench_Addr */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Recv_All
+*
+*   DESCRIPTION
+*
+*       This function receives the given number of bytes from a TCP
+*       socket.
+*
+*   INPUTS
+*
+*       socketd                 The socket.
+*       *buffer                 Where to put the data.
+*       length                  The number of bytes to receive.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The data was received.
+*       < 0                     The error of NU_Recv.
+*
+***********************************************************************/
+STATIC STATUS NetBench_Recv_All(INT socketd, CHAR *buffer, UINT16 length)
+{
+    INT32   bytes;
+
+    while (length > 0)
+    {
+        bytes = NU_Recv(socketd, buffer, length, 0);
+
+        if (bytes <= 0)
+            return ((bytes < 0) ? (STATUS)bytes : NU_NOT_CONNECTED);
+
+        buffer += bytes;
+        length -= (UINT16)bytes;
+    }
+
+    return (NU_SUCCESS);
+
+} /* NetBench_Recv_All */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_TCP_Server
+*
+*   DESCRIPTION
+*
+*       This task accepts the connections of the client.  A bulk
+*       connection is drained of the number of bytes given in its
+*       header and then answered with one byte; a connection of the
+*       setup benchmark is answered with one byte at once and closed
+*       when the client aborts it.
+*
+*   INPUTS
+*
+*       argc                    Not used.
+*       *argv                   Not used.
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID NetBench_TCP_Server(UNSIGNED argc, VOID *argv)
+{
+    struct addr_struct  addr;
+    INT16               addr_len;
+    INT                 listen_sock, socketd;
+    UINT32              length;
+    INT32               bytes;
+    CHAR                header[NETBENCH_HEADER_SIZE];
+
+    NU_UNUSED_PARAM(argc);
+    NU_UNUSED_PARAM(argv);
+
+    listen_sock = NU_Socket(NU_FAMILY_IP, NU_TYPE_STREAM, 0);
+
+    NetBench_Addr(&addr, NU_NULL, NETBENCH_TCP_PORT);
+
+    if ( (listen_sock < 0) ||
+         (NU_Bind(listen_sock, &addr, 0) < 0) ||
+         (NU_Listen(listen_sock, 10) != NU_SUCCESS) )
+    {
+        printf("netbench: the TCP server could not be started\n");
+        return;
+    }
+
+    for (;;)
+    {
+        addr_len = sizeof(addr);
+
+        socketd = NU_Accept(listen_sock, &addr, &addr_len);
+
+        if (socketd < 0)
+            continue;
+
+        if (NetBench_Recv_All(socketd, header,
+                              NETBENCH_HEADER_SIZE) == NU_SUCCESS)
+        {
+            memcpy(&length, &header[1], sizeof(length));
+
+            if (header[0] == NETBENCH_CMD_BULK)
+            {
+                while (length > 0)
+                {
+                    bytes = NU_Recv(socketd, NetBench_Server_Buffer,
+                                    NETBENCH_TCP_CHUNK, 0);
+
+                    if (bytes <= 0)
+                        break;
+
+                    length -= (UINT32)bytes;
+                }
+
+                (VOID)NU_Send(socketd, header, 1, 0);
+            }
+
+            else if (header[0] == NETBENCH_CMD_CONN)
+            {
+                (VOID)NU_Send(socketd, header, 1, 0);
+
+                while (NU_Recv(socketd, NetBench_Server_Buffer,
+                               NETBENCH_TCP_CHUNK, 0) > 0)
+                    ;
+            }
+        }
+
+        (VOID)NU_Close_Socket(socketd);
+    }
+
+} /* NetBench_TCP_Server */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_UDP_Server
+*
+*   DESCRIPTION
+*
+*       This task counts the datagrams of the client and the time from
+*       the first to the last of them.  The end command is answered with
+*       the count, the time and the frames dropped by the wire device,
+*       and the count is then reset.
+*
+*   INPUTS
+*
+*       argc                    Not used.
+*       *argv                   Not used.
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID NetBench_UDP_Server(UNSIGNED argc, VOID *argv)
+{
+    struct addr_struct  addr;
+    INT16               addr_len;
+    INT                 socketd;
+    INT32               bytes;
+    UINT32              count = 0;
+    UINT64              first = 0, last = 0, reply[3];
+    CHAR                buffer[NETBENCH_UDP_SIZE];
+
+    NU_UNUSED_PARAM(argc);
+    NU_UNUSED_PARAM(argv);
+
+    socketd = NU_Socket(NU_FAMILY_IP, NU_TYPE_DGRAM, 0);
+
+    NetBench_Addr(&addr, NU_NULL, NETBENCH_UDP_PORT);
+
+    if ( (socketd < 0) || (NU_Bind(socketd, &addr, 0) < 0) )
+    {
+        printf("netbench: the UDP server could not be started\n");
+        return;
+    }
+
+    for (;;)
+    {
+        addr_len = sizeof(addr);
+
+        bytes = NU_Recv_From(socketd, buffer, sizeof(buffer), 0, &addr,
+                             &addr_len);
+
+        if (bytes <= 0)
+            continue;
+
+        if (buffer[0] == NETBENCH_CMD_DATA)
+        {
+            last = NU_Get_Time_Stamp();
+
+            if (count ++ == 0)
+                first = last;
+        }
+
+        else if (buffer[0] == NETBENCH_CMD_END)
+        {
+            reply[0] = count;
+            reply[1] = last - first;
+            reply[2] = WIRE_Rx_Drops;
+
+            (VOID)NU_Send_To(socketd, (CHAR *)reply, sizeof(reply), 0,
+                             &addr, 0);
+
+            count = 0;
+        }
+    }
+
+} /* NetBench_UDP_Server */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_TCP_Connect
+*
+*   DESCRIPTION
+*
+*       This function connects to the TCP server and puts a command in
+*       the buffer given.  The command is sent with the data that
+*       follows it, so that Nagle's algorithm does not hold the data
+*       back until the command is acknowledged.
+*
+*   INPUTS
+*
+*       *buffer                 The buffer to put the command in.
+*       command                 The command.
+*       length                  The number of bytes that follow it.
+*
+*   OUTPUTS
+*
+*       >= 0                    The connected socket.
+*       < 0                     The connection failed.
+*
+***********************************************************************/
+STATIC INT NetBench_TCP_Connect(CHAR *buffer, CHAR command, UINT32 length)
+{
+    struct addr_struct  addr;
+    INT                 socketd;
+
+    socketd = NU_Socket(NU_FAMILY_IP, NU_TYPE_STREAM, 0);
+
+    if (socketd < 0)
+        return (socketd);
+
+    NetBench_Addr(&addr, NetBench_Peer, NETBENCH_TCP_PORT);
+
+    if (NU_Connect(socketd, &addr, 0) < 0)
+    {
+        (VOID)NU_Abort(socketd);
+        return (-1);
+    }
+
+    buffer[0] = command;
+    memcpy(&buffer[1], &length, sizeof(length));
+
+    return (socketd);
+
+} /* NetBench_TCP_Connect */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_TCP
+*
+*   DESCRIPTION
+*
+*       This function measures the TCP bulk throughput, from the start
+*       of the transfer to the reply of the server.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID NetBench_TCP(VOID)
+{
+    INT     socketd;
+    UINT32  length = NetBench_TCP_Kbytes * 1024;
+    UINT32  remaining = length + NETBENCH_HEADER_SIZE;
+    INT32   bytes;
+    UINT64  start, elapsed;
+
+    memset(NetBench_Tx_Buffer, NETBENCH_CMD_DATA, NETBENCH_TCP_CHUNK);
+
+    start = NU_Get_Time_Stamp();
+
+    socketd = NetBench_TCP_Connect(NetBench_Tx_Buffer, NETBENCH_CMD_BULK,
+                                   length);
+
+    if (socketd < 0)
+    {
+        printf("TCP bulk:        connection failed\n");
+        return;
+    }
+
+    while (remaining > 0)
+    {
+        bytes = NU_Send(socketd, NetBench_Tx_Buffer,
+                        (UINT16)((remaining < NETBENCH_TCP_CHUNK) ?
+                                 remaining : NETBENCH_TCP_CHUNK), 0);
+
+        if (bytes <= 0)
+            break;
+
+        remaining -= (UINT32)bytes;
+    }
+
+    if ( (remaining != 0) ||
+         (NetBench_Recv_All(socketd, NetBench_Rx_Buffer, 1) != NU_SUCCESS) )
+        printf("TCP bulk:        failed after %lu bytes\n",
+               (unsigned long)(length + NETBENCH_HEADER_SIZE - remaining));
+
+    else
+    {
+        elapsed = NU_Get_Time_Stamp() - start;
+
+        printf("TCP bulk:        %lu KB in %lu ms, %.1f MB/s\n",
+               (unsigned long)NetBench_TCP_Kbytes,
+               (unsigned long)(elapsed / 1000000),
+               ((double)length / (1024.0 * 1024.0)) /
+               ((double)elapsed / 1e9));
+    }
+
+    (VOID)NU_Close_Socket(socketd);
+
+} /* NetBench_TCP */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_UDP
+*
+*   DESCRIPTION
+*
+*       This function measures the rate at which UDP datagrams are sent
+*       and the rate at which the server receives them, and the loss.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID NetBench_UDP(VOID)
+{
+    struct addr_struct  addr, from;
+    INT16               from_len;
+    FD_SET              readfs;
+    INT                 socketd, retry;
+    UINT32              i, sent = 0;
+    UINT64              start, elapsed, reply[3];
+    CHAR                buffer[NETBENCH_UDP_SIZE];
+
+    socketd = NU_Socket(NU_FAMILY_IP, NU_TYPE_DGRAM, 0);
+
+    if (socketd < 0)
+        return;
+
+    NetBench_Addr(&addr, NetBench_Peer, NETBENCH_UDP_PORT);
+
+    memset(buffer, NETBENCH_CMD_DATA, sizeof(buffer));
+
+    start = NU_Get_Time_Stamp();
+
+    for (i = 0; i < NetBench_UDP_Count; i++)
+    {
+        if (NU_Send_To(socketd, buffer, sizeof(buffer), 0, &addr,
+                       0) == sizeof(buffer))
+            sent ++;
+    }
+
+    elapsed = NU_Get_Time_Stamp() - start;
+
+    /* The end command may be lost like any datagram, so it is sent
+       again until the server replies. */
+    buffer[0] = NETBENCH_CMD_END;
+    memset(reply, 0, sizeof(reply));
+
+    for (retry = 0; retry < NETBENCH_UDP_RETRIES; retry++)
+    {
+        (VOID)NU_Send_To(socketd, buffer, 1, 0, &addr, 0);
+
+        NU_FD_Init(&readfs);
+        NU_FD_Set(socketd, &readfs);
+
+        if (NU_Select(socketd + 1, &readfs, NU_NULL, NU_NULL,
+                      NETBENCH_UDP_WAIT) == NU_SUCCESS)
+        {
+            from_len = sizeof(from);
+
+            if (NU_Recv_From(socketd, (CHAR *)reply, sizeof(reply), 0,
+                             &from, &from_len) == sizeof(reply))
+                break;
+        }
+    }
+
+    printf("UDP %3u bytes:   %lu sent at %.0f pps, %lu received",
+           NETBENCH_UDP_SIZE, (unsigned long)sent,
+           (double)sent / ((double)elapsed / 1e9),
+           (unsigned long)reply[0]);
+
+    if (reply[1] != 0)
+        printf(" at %.0f pps", (double)reply[0] / ((double)reply[1] / 1e9));
+
+    printf(", %.1f%% lost\n",
+           sent ? 100.0 * (double)(sent - reply[0]) / (double)sent : 0.0);
+
+    if (!NetBench_Loopback)
+        printf("                 %lu frames dropped by the server wire\n",
+               (unsigned long)reply[2]);
+
+    (VOID)NU_Close_Socket(socketd);
+
+} /* NetBench_UDP */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Conn
+*
+*   DESCRIPTION
+*
+*       This function measures the TCP connection setup rate.  Each
+*       connection is set up, exchanges one byte each way and is
+*       aborted, so no connection is left in TIME-WAIT.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID NetBench_Conn(VOID)
+{
+    INT     socketd;
+    UINT32  i, done = 0;
+    UINT64  start, elapsed;
+    CHAR    header[NETBENCH_HEADER_SIZE];
+
+    start = NU_Get_Time_Stamp();
+
+    for (i = 0; i < NetBench_Conn_Count; i++)
+    {
+        socketd = NetBench_TCP_Connect(header, NETBENCH_CMD_CONN, 0);
+
+        if (socketd < 0)
+            break;
+
+        if ( (NU_Send(socketd, header, NETBENCH_HEADER_SIZE, 0) ==
+              NETBENCH_HEADER_SIZE) &&
+             (NetBench_Recv_All(socketd, NetBench_Rx_Buffer,
+                                1) == NU_SUCCESS) )
+            done ++;
+
+        (VOID)NU_Abort(socketd);
+    }
+
+    elapsed = NU_Get_Time_Stamp() - start;
+
+    printf("TCP connections: %lu in %lu ms, %.0f per second\n",
+           (unsigned long)done, (unsigned long)(elapsed / 1000000),
+           (double)done / ((double)elapsed / 1e9));
+
+} /* NetBench_Conn */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Lookup
+*
+*   DESCRIPTION
+*
+*       This function measures the cost of an IPv4 route lookup as the
+*       route table grows, and of an ARP cache lookup that hits and one
+*       that misses.  The routes added are 20.x.y.0/24 through the
+*       server.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID NetBench_Lookup(VOID)
+{
+    STATIC const UINT32 sizes[] = {16, 256, 4096};
+    SCK_SOCKADDR_IP     dest;
+    RTAB4_ROUTE_ENTRY   *route;
+    UINT32              routes = 0, i, j, found;
+    UINT64              start, elapsed;
+    UINT8               network[IP_ADDR_LEN] = {20, 0, 0, 0};
+    UINT8               mask[IP_ADDR_LEN] = {255, 255, 255, 0};
+
+    memset(&dest, 0, sizeof(dest));
+
+    dest.sck_family = NU_FAMILY_IP;
+    dest.sck_len = sizeof(dest);
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        while (routes < sizes[i])
+        {
+            network[1] = (UINT8)(routes >> 8);
+            network[2] = (UINT8)routes;
+
+            if (NU_Add_Route(network, mask, NetBench_Peer) != NU_SUCCESS)
+                break;
+
+            routes ++;
+        }
+
+        /* Look up an address in the middle of the routes added. */
+        dest.sck_addr = IP_ADDR(network);
+        dest.sck_addr = (dest.sck_addr & 0xFF000000UL) |
+                        ((routes / 2) << 8) | 1;
+
+        found = 0;
+
+        (VOID)NET_Obtain_Stack_Lock(NU_SUSPEND);
+
+        start = NU_Get_Time_Stamp();
+
+        for (j = 0; j < NETBENCH_LOOKUP_COUNT; j++)
+        {
+            route = RTAB4_Find_Route(&dest, RT_BEST_METRIC);
+
+            if (route != NU_NULL)
+            {
+                found ++;
+
+                RTAB_Free((ROUTE_ENTRY *)route, NU_FAMILY_IP);
+            }
+        }
+
+        elapsed = NU_Get_Time_Stamp() - start;
+
+        (VOID)NET_Release_Stack_Lock();
+
+        printf("Route lookup:    %4lu routes, %.1f ns%s\n",
+               (unsigned long)routes,
+               (double)elapsed / NETBENCH_LOOKUP_COUNT,
+               (found == NETBENCH_LOOKUP_COUNT) ? "" : " (not found)");
+    }
+
+    for (i = 0; i < 2; i++)
+    {
+        /* The server is in the cache after the other benchmarks; the
+           address after it is not. */
+        dest.sck_addr = IP_ADDR(NetBench_Peer) + i;
+
+        (VOID)NET_Obtain_Stack_Lock(NU_SUSPEND);
+
+        start = NU_Get_Time_Stamp();
+
+        for (j = 0; j < NETBENCH_LOOKUP_COUNT; j++)
+            (VOID)ARP_Find_Entry(&dest);
+
+        elapsed = NU_Get_Time_Stamp() - start;
+
+        (VOID)NET_Release_Stack_Lock();
+
+        printf("ARP lookup %s:  %.1f ns\n", (i == 0) ? "hit " : "miss",
+               (double)elapsed / NETBENCH_LOOKUP_COUNT);
+    }
+
+} /* NetBench_Lookup */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Client
+*
+*   DESCRIPTION
+*
+*       This function runs the benchmarks and ends the benchmark
+*       processes.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID NetBench_Client(VOID)
+{
+    printf("netbench: %s\n", NetBench_Loopback ? "loopback device" :
+           "wire device between two stack instances");
+
+    NetBench_TCP();
+    NetBench_UDP();
+    NetBench_Conn();
+
+    if (!NetBench_Loopback)
+    {
+        NetBench_Lookup();
+
+        printf("Wire drops:      %lu transmit, %lu receive\n",
+               (unsigned long)WIRE_Tx_Drops, (unsigned long)WIRE_Rx_Drops);
+
+        (VOID)kill(NetBench_Child, SIGTERM);
+        (VOID)waitpid(NetBench_Child, NU_NULL, 0);
+    }
+
+    exit(0);
+
+} /* NetBench_Client */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Init
+*
+*   DESCRIPTION
+*
+*       This task initializes the stack and the wire device, then
+*       starts the servers, the client or both.
+*
+*   INPUTS
+*
+*       argc                    Not used.
+*       *argv                   Not used.
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID NetBench_Init(UNSIGNED argc, VOID *argv)
+{
+    NU_NET_INIT_DATA    init_data;
+    NU_MEMORY_POOL      *cached, *uncached;
+
+    NU_UNUSED_PARAM(argc);
+    NU_UNUSED_PARAM(argv);
+
+    (VOID)NU_System_Memory_Get(&cached, &uncached);
+
+    init_data.net_buffered_mem = uncached;
+    init_data.net_internal_mem = cached;
+
+    if (NU_Init_Net(&init_data) != NU_SUCCESS)
+    {
+        printf("netbench: NU_Init_Net failed\n");
+        exit(1);
+    }
+
+    if ( (!NetBench_Loopback) &&
+         (NU_Init_Devices(&NetBench_Device, 1) != NU_SUCCESS) )
+    {
+        printf("netbench: the wire device could not be initialized\n");
+        exit(1);
+    }
+
+    if ( (NetBench_Loopback) || (NetBench_Server) )
+    {
+        (VOID)NU_Create_Task(&NetBench_TCP_Task, "nbtcp",
+                             NetBench_TCP_Server, 0, NU_NULL, NU_NULL,
+                             NETBENCH_STACK_SIZE, NETBENCH_SERVER_PRIORITY,
+                             0, NU_PREEMPT, NU_START);
+
+        (VOID)NU_Create_Task(&NetBench_UDP_Task, "nbudp",
+                             NetBench_UDP_Server, 0, NU_NULL, NU_NULL,
+                             NETBENCH_STACK_SIZE, NETBENCH_SERVER_PRIORITY,
+                             0, NU_PREEMPT, NU_START);
+    }
+
+    /* Let the server of the other process come up before the client
+       starts. */
+    else
+        NU_Sleep(NU_PLUS_TICKS_PER_SEC / 2);
+
+    if (!NetBench_Server)
+        NetBench_Client();
+
+} /* NetBench_Init */
@@ -0,0 +1,518 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       wire.c
+*
+*   COMPONENT
+*
+*       WIRE - In-Memory Wire Device
+*
+*   DESCRIPTION
+*
+*       This module supplies an Ethernet device that joins two stack
+*       instances of the host build.  Each transmitted frame is written
+*       to one end of a SOCK_SEQPACKET socket pair and received from the
+*       other end by the wire device of the second instance.  The
+*       socket is used in non-blocking mode, and since it preserves
+*       message boundaries, each read or write carries one frame.
+*
+*       Reception follows the model of an interrupt driven NIC.  A
+*       receive thread outside the kernel stands in for the interrupt:
+*       it waits for frames on the socket and activates the receive
+*       HISR, which copies up to WIRE_RX_BUDGET frames into buffers from
+*       the receive ring of the device and places them on the ring.
+*
+*   DATA STRUCTURES
+*
+*       WIRE_Tx_Drops
+*       WIRE_Rx_Drops
+*
+*   FUNCTIONS
+*
+*       WIRE_Init
+*       WIRE_TX_Packet
+*       WIRE_Rx_Thread
+*       WIRE_RX_HISR
+*       WIRE_Ioctl
+*
+*   DEPENDENCIES
+*
+*       fcntl.h
+*       poll.h
+*       unistd.h
+*       time.h
+*       nu_net.h
+*       hk_defs.h
+*       wire.h
+*
+***********************************************************************/
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "networking/nu_net.h"
+#include "hk_defs.h"
+#include "wire.h"
+
+UINT32  WIRE_Tx_Drops;
+UINT32  WIRE_Rx_Drops;
+
+/* The wire device, the socket it is bound to and its receive HISR. */
+STATIC DV_DEVICE_ENTRY  *WIRE_Device;
+STATIC INT              WIRE_Socket;
+STATIC NU_HISR          WIRE_Rx_HISR_CB;
+
+/* Set by the receive thread when it activates the HISR and cleared by
+   the HISR once it has received what it can. */
+STATIC INT              WIRE_Rx_Pending;
+STATIC INT              WIRE_Rx_Full;
+STATIC pthread_mutex_t  WIRE_Rx_Lock = PTHREAD_MUTEX_INITIALIZER;
+STATIC pthread_cond_t   WIRE_Rx_Done = PTHREAD_COND_INITIALIZER;
+
+/* The frame being transmitted or received. */
+STATIC UINT8            WIRE_Tx_Frame[WIRE_MAX_FRAME];
+STATIC UINT8            WIRE_Rx_Frame[WIRE_MAX_FRAME];
+
+STATIC STATUS   WIRE_TX_Packet(DV_DEVICE_ENTRY *dev_ptr, NET_BUFFER *buf_ptr);
+STATIC VOID     *WIRE_Rx_Thread(VOID *arg);
+STATIC VOID     WIRE_RX_HISR(VOID);
+STATIC STATUS   WIRE_Ioctl(DV_DEVICE_ENTRY *dev, INT option, DV_REQ *d_req);
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       WIRE_Init
+*
+*   DESCRIPTION
+*
+*       This function initializes the wire device.  Its MAC address is
+*       made unique by the process ID.  Only one wire device is
+*       supported per stack instance.
+*
+*   INPUTS
+*
+*       *dev_ptr                Pointer to the device.  The socket is
+*                               passed in dev_driver_options.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The device was initialized.
+*       NU_INVALID_PARM         A wire device already exists.
+*       Otherwise, the status returned by MEM_Rx_Ring_Create,
+*       NU_Allocate_Memory or NU_Create_HISR.
+*
+***********************************************************************/
+STATUS WIRE_Init(DV_DEVICE_ENTRY *dev_ptr)
+{
+    STATUS      status;
+    VOID        *pointer;
+    pthread_t   rx_thread;
+    UINT32      pid = (UINT32)getpid();
+
+    if (WIRE_Device)
+        return (NU_INVALID_PARM);
+
+    /* Fill in device specific information. */
+    dev_ptr->dev_type       = DVT_ETHER;
+    dev_ptr->dev_addrlen    = WIRE_ADDRESS_LENGTH;
+    dev_ptr->dev_hdrlen     = WIRE_HEADER_LENGTH;
+    dev_ptr->dev_mtu        = WIRE_MTU;
+    dev_ptr->dev_vect       = (UINT16)WIRE_INVALID_VECTOR;
+
+    dev_ptr->dev_flags      |= (DV_SIMPLEX | DV_BROADCAST | DV_MULTICAST);
+
+    /* A locally administered unicast address. */
+    dev_ptr->dev_mac_addr[0] = 0x02;
+    dev_ptr->dev_mac_addr[1] = 0x57;
+    dev_ptr->dev_mac_addr[2] = (UINT8)(pid >> 24);
+    dev_ptr->dev_mac_addr[3] = (UINT8)(pid >> 16);
+    dev_ptr->dev_mac_addr[4] = (UINT8)(pid >> 8);
+    dev_ptr->dev_mac_addr[5] = (UINT8)pid;
+
+    dev_ptr->dev_start      = WIRE_TX_Packet;
+    dev_ptr->dev_ioctl      = WIRE_Ioctl;
+    dev_ptr->dev_output     = ETH_Ether_Send;
+    dev_ptr->dev_input      = ETH_Ether_Input;
+
+    status = MEM_Rx_Ring_Create(dev_ptr);
+
+    if (status == NU_SUCCESS)
+        status = NU_Allocate_Memory(MEM_Cached, &pointer,
+                                    (UNSIGNED)NU_MIN_STACK_SIZE,
+                                    NU_NO_SUSPEND);
+
+    if (status == NU_SUCCESS)
+        status = NU_Create_HISR(&WIRE_Rx_HISR_CB, "wire_rx", WIRE_RX_HISR,
+                                0, pointer, (UNSIGNED)NU_MIN_STACK_SIZE);
+
+    if (status != NU_SUCCESS)
+    {
+        NLOG_Error_Log("Failed to initialize the wire device", NERR_FATAL,
+                       __FILE__, __LINE__);
+
+        return (status);
+    }
+
+    WIRE_Device = dev_ptr;
+    WIRE_Socket = (INT)dev_ptr->dev_driver_options;
+
+    (VOID)fcntl(WIRE_Socket, F_SETFL,
+                fcntl(WIRE_Socket, F_GETFL) | O_NONBLOCK);
+
+    if (pthread_create(&rx_thread, NU_NULL, WIRE_Rx_Thread, NU_NULL) != 0)
+        return (NU_NO_MEMORY);
+
+    /* Init the basic interface information. */
+    MIB2_ifDescr_Set(dev_ptr, "Nucleus NET Host Wire Interface");
+    MIB2_ifType_Set(dev_ptr, 6);
+    MIB2_ifSpeed_Set(dev_ptr, 1000000000UL);
+
+    return (NU_SUCCESS);
+
+} /* WIRE_Init */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       WIRE_TX_Packet
+*
+*   DESCRIPTION
+*
+*       This function writes a frame to the socket.  If the socket stays
+*       full for WIRE_TX_WAIT milliseconds the frame is dropped, as a
+*       NIC drops a frame it cannot place on its transmit ring.
+*
+*   INPUTS
+*
+*       *dev_ptr                Pointer to the device.
+*       *buf_ptr                Pointer to the head of the buffer chain.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The frame was transmitted or dropped.
+*
+***********************************************************************/
+STATIC STATUS WIRE_TX_Packet(DV_DEVICE_ENTRY *dev_ptr, NET_BUFFER *buf_ptr)
+{
+    NET_BUFFER      *work_buf;
+    UINT32          length = 0;
+    struct pollfd   pfd;
+    ssize_t         sent;
+
+    /* Flatten the chain into one frame. */
+    for (work_buf = buf_ptr;
+         (work_buf) && (length + work_buf->data_len <= WIRE_MAX_FRAME);
+         work_buf = work_buf->next_buffer)
+    {
+        memcpy(&WIRE_Tx_Frame[length], work_buf->data_ptr,
+               work_buf->data_len);
+
+        length += work_buf->data_len;
+    }
+
+    sent = write(WIRE_Socket, WIRE_Tx_Frame, length);
+
+    if (sent < 0)
+    {
+        pfd.fd = WIRE_Socket;
+        pfd.events = POLLOUT;
+
+        if (poll(&pfd, 1, WIRE_TX_WAIT) == 1)
+            sent = write(WIRE_Socket, WIRE_Tx_Frame, length);
+    }
+
+    if (sent == (ssize_t)length)
+        MIB2_ifOutOctets_Add(dev_ptr, length);
+
+    else
+    {
+        WIRE_Tx_Drops ++;
+
+        MIB2_ifOutDiscards_Inc(dev_ptr);
+    }
+
+#ifndef PACKET
+
+    NET_LAT_STAMP(buf_ptr, NET_LAT_TX_QUEUE, NET_LAT_NONE);
+
+    /* Remove the packet from the devices transmit queue. */
+    MEM_Buffer_Dequeue(&dev_ptr->dev_transq);
+
+    /* Decrement the queue length counter. */
+    --dev_ptr->dev_transq_length;
+
+    /* Free the buffers onto the appropriate free lists */
+    MEM_Multiple_Buffer_Chain_Free(buf_ptr);
+
+#endif
+
+    return (NU_SUCCESS);
+
+} /* WIRE_TX_Packet */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       WIRE_Rx_Thread
+*
+*   DESCRIPTION
+*
+*       This function is the receive thread.  It stands in for the
+*       receive interrupt: each time frames are waiting on the socket it
+*       activates the receive HISR and waits for the HISR to finish.
+*       If the HISR found the receive ring full, the thread backs off
+*       for WIRE_RX_BACKOFF before it interrupts again.
+*
+*   INPUTS
+*
+*       *arg                    Not used.
+*
+*   OUTPUTS
+*
+*       NU_NULL once the other end of the socket is closed.
+*
+***********************************************************************/
+STATIC VOID *WIRE_Rx_Thread(VOID *arg)
+{
+    struct pollfd   pfd;
+    struct timespec backoff;
+    INT             full;
+
+    NU_UNUSED_PARAM(arg);
+
+    backoff.tv_sec = 0;
+    backoff.tv_nsec = WIRE_RX_BACKOFF * 1000L;
+
+    pfd.fd = WIRE_Socket;
+    pfd.events = POLLIN;
+
+    for (;;)
+    {
+        if (poll(&pfd, 1, -1) != 1)
+            continue;
+
+        if (!(pfd.revents & POLLIN))
+            break;
+
+        pthread_mutex_lock(&WIRE_Rx_Lock);
+
+        WIRE_Rx_Pending = NU_TRUE;
+
+        pthread_mutex_unlock(&WIRE_Rx_Lock);
+
+        NU_Activate_HISR(&WIRE_Rx_HISR_CB);
+
+        pthread_mutex_lock(&WIRE_Rx_Lock);
+
+        while (WIRE_Rx_Pending)
+            pthread_cond_wait(&WIRE_Rx_Done, &WIRE_Rx_Lock);
+
+        full = WIRE_Rx_Full;
+
+        pthread_mutex_unlock(&WIRE_Rx_Lock);
+
+        if (full)
+            nanosleep(&backoff, NU_NULL);
+    }
+
+    return (NU_NULL);
+
+} /* WIRE_Rx_Thread */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       WIRE_RX_HISR
+*
+*   DESCRIPTION
+*
+*       This function is the receive HISR.  It receives up to
+*       WIRE_RX_BUDGET frames, no more than the receive ring of the
+*       device has room for, copies each into a chain of buffers from
+*       the ring, passes them to the stack and notifies it.  A frame is
+*       dropped if no buffers are available.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID WIRE_RX_HISR(VOID)
+{
+    DV_DEVICE_ENTRY *dev_ptr = WIRE_Device;
+    NET_BUFFER      *buf_ptr, *work_buf, *last_buf;
+    ssize_t         length;
+    UINT32          offset, copy_count;
+    INT             frames = 0, received = 0, budget;
+
+    budget = NET_RX_RING_SIZE - (INT)(dev_ptr->dev_rx_ring->mrr_tail -
+                                      dev_ptr->dev_rx_ring->mrr_head);
+
+    if (budget > WIRE_RX_BUDGET)
+        budget = WIRE_RX_BUDGET;
+
+    while (frames < budget)
+    {
+        length = read(WIRE_Socket, WIRE_Rx_Frame, sizeof(WIRE_Rx_Frame));
+
+        if (length <= 0)
+            break;
+
+        frames ++;
+
+        buf_ptr = NU_NULL;
+        last_buf = NU_NULL;
+
+        /* Copy the frame into as many buffers as it needs. */
+        for (offset = 0; offset < (UINT32)length; offset += copy_count)
+        {
+            work_buf = MEM_Rx_Buffer_Alloc(dev_ptr);
+
+            if (work_buf == NU_NULL)
+                break;
+
+            copy_count = (UINT32)length - offset;
+
+            if (copy_count > NET_PARENT_BUFFER_SIZE)
+                copy_count = NET_PARENT_BUFFER_SIZE;
+
+            memcpy(work_buf->mem_parent_packet, &WIRE_Rx_Frame[offset],
+                   copy_count);
+
+            work_buf->data_ptr = work_buf->mem_parent_packet;
+            work_buf->data_len = copy_count;
+            work_buf->next_buffer = NU_NULL;
+
+            if (last_buf)
+                last_buf->next_buffer = work_buf;
+            else
+                buf_ptr = work_buf;
+
+            last_buf = work_buf;
+        }
+
+        if (offset < (UINT32)length)
+        {
+            if (buf_ptr)
+                MEM_One_Buffer_Chain_Free(buf_ptr, &MEM_Buffer_Freelist);
+
+            WIRE_Rx_Drops ++;
+
+            MIB2_ifInDiscards_Inc(dev_ptr);
+
+            continue;
+        }
+
+        buf_ptr->mem_total_data_len = (UINT32)length;
+        buf_ptr->mem_buf_device = dev_ptr;
+
+        MIB2_ifInOctets_Add(dev_ptr, length);
+
+        if (MEM_Rx_Ring_Put(dev_ptr, buf_ptr) == NU_SUCCESS)
+            received ++;
+        else
+            WIRE_Rx_Drops ++;
+    }
+
+    /* Set the event to tell the stack that packets have arrived. */
+    if (received)
+        NU_Set_Events(&Buffers_Available, 2, NU_OR);
+
+    pthread_mutex_lock(&WIRE_Rx_Lock);
+
+    WIRE_Rx_Pending = NU_FALSE;
+    WIRE_Rx_Full = (budget <= 0);
+
+    pthread_cond_signal(&WIRE_Rx_Done);
+
+    pthread_mutex_unlock(&WIRE_Rx_Lock);
+
+} /* WIRE_RX_HISR */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       WIRE_Ioctl
+*
+*   DESCRIPTION
+*
+*       This function processes the control requests of the stack.  The
+*       wire does not filter multicast frames, so joining and leaving a
+*       group only updates the group list of the device.
+*
+*   INPUTS
+*
+*       *dev                    Pointer to the device.
+*       option                  The request.
+*       *d_req                  Pointer to the request data.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The request was processed.
+*       NU_INVALID_PARM         The request is not supported.
+*
+***********************************************************************/
+STATIC STATUS WIRE_Ioctl(DV_DEVICE_ENTRY *dev, INT option, DV_REQ *d_req)
+{
+    STATUS  ret_status;
+
+#if (INCLUDE_IP_MULTICASTING != NU_TRUE)
+    UNUSED_PARAMETER(dev);
+    UNUSED_PARAMETER(d_req);
+#endif
+
+    switch (option)
+    {
+#if (INCLUDE_IP_MULTICASTING == NU_TRUE)
+        case DEV_ADDMULTI :
+
+            ret_status = ETH_Add_Multi(dev, d_req);
+
+            if (ret_status == NU_RESET)
+                ret_status = NU_SUCCESS;
+
+            break;
+
+        case DEV_DELMULTI :
+
+            ret_status = ETH_Del_Multi(dev, d_req);
+
+            if (ret_status == NU_RESET)
+                ret_status = NU_SUCCESS;
+
+            break;
+#endif
+
+        default :
+
+            ret_status = NU_INVALID_PARM;
+
+            break;
+    }
+
+    return (ret_status);
+
+} /* WIRE_Ioctl */
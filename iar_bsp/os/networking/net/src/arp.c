@@ -1173,6 +1173,9 @@ VOID ARP_Event(UINT16 id)
                    be sent. */
                 ar_entry->ar_device->dev_flags |= DV_UP;
 
+                /* Cached route lookups depend on the device and route state */
+                RTAB_Invalidate_Route_Cache();
+
                 /* Send the RARP request. */
                 if (ARP_Request(ar_entry->ar_device, (UINT32 *)IP_Null,
                                 ar_entry->ar_device->dev_mac_addr,
@@ -1183,6 +1186,9 @@ VOID ARP_Event(UINT16 id)
                 /* Clear the DV_UP flag. */
                 ar_entry->ar_device->dev_flags &= (~DV_UP);
 
+                /* Cached route lookups depend on the device and route state */
+                RTAB_Invalidate_Route_Cache();
+
                 /* Setup a timer event to send the next one in one second. */
                 if (TQ_Timerset(ARPRESOLVE, (UNSIGNED)id,
                                 SCK_Ticks_Per_Second, 0) != NU_SUCCESS)
@@ -1682,6 +1688,9 @@ STATUS ARP_Probe(DV_DEVICE_ENTRY *device, UINT32 sip)
         stat = (*device->dev_output)(buf_ptr, device, (VOID *)&mh, NU_NULL);
         device->dev_flags = flags;
 
+        /* Cached route lookups depend on the device and route state */
+        RTAB_Invalidate_Route_Cache();
+
         /* if the packet is not sent then free up the buffer space */
         if (stat != NU_SUCCESS)
         {
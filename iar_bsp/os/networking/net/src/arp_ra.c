@@ -92,7 +92,7 @@ STATUS ARP_Rarp(const CHAR *device_name)
     NU_SUPERVISOR_MODE();
 
     /*  Don't let any other users in until we are done.  */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -106,7 +106,7 @@ STATUS ARP_Rarp(const CHAR *device_name)
 
     if (device == NU_NULL)
     {
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -121,7 +121,7 @@ STATUS ARP_Rarp(const CHAR *device_name)
        initialized before Rarp is called. */
     if (!(device->dev_flags & DV_RUNNING))
     {
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -136,7 +136,7 @@ STATUS ARP_Rarp(const CHAR *device_name)
 
     if (dev_addr_entry == NU_NULL)
     {
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -159,7 +159,7 @@ STATUS ARP_Rarp(const CHAR *device_name)
     if (ARP_Request(device, (UINT32 *)IP_Null,  device->dev_mac_addr, ERARP,
                     RARPQ) != NU_SUCCESS)
     {
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -172,6 +172,9 @@ STATUS ARP_Rarp(const CHAR *device_name)
     /* Restore the flags */
     device->dev_flags = flags;
 
+    /* Cached route lookups depend on the device and route state */
+    RTAB_Invalidate_Route_Cache();
+
 #if (INCLUDE_STATIC_BUILD == NU_FALSE)
 
     /* Allocate memory for an ARP resolve entry.  This structure is used to keep
@@ -180,7 +183,7 @@ STATUS ARP_Rarp(const CHAR *device_name)
                            sizeof(*ar_entry),
                            (UNSIGNED)NU_NO_SUSPEND) != NU_SUCCESS)
     {
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -249,7 +252,7 @@ STATUS ARP_Rarp(const CHAR *device_name)
     if (!device->dev_addr.dev_addr_list.dv_head->dev_entry_ip_addr)
         status = NU_RARP_INIT_FAILED;
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
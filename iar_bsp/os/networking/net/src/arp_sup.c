@@ -86,7 +86,7 @@ ARP_ENTRY *ARP_Get_Next(const UINT8 *ip_addr, ARP_ENTRY *arp_entry)
 
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     /* If the semaphore could not be obtained, exit. */
     if (status != NU_SUCCESS)
@@ -138,7 +138,7 @@ ARP_ENTRY *ARP_Get_Next(const UINT8 *ip_addr, ARP_ENTRY *arp_entry)
     else
         ret_entry = NU_NULL;
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -195,7 +195,7 @@ ARP_ENTRY *ARP_Get_Next_If(UINT32 if_index, const UINT8 *ip_addr,
 
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -244,7 +244,7 @@ ARP_ENTRY *ARP_Get_Next_If(UINT32 if_index, const UINT8 *ip_addr,
     else
         ret_entry = NU_NULL;
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -351,7 +351,7 @@ ARP_ENTRY *ARP_Get_Index_If(UINT32 if_index, const UINT8 *ip_addr,
 
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -388,7 +388,7 @@ ARP_ENTRY *ARP_Get_Index_If(UINT32 if_index, const UINT8 *ip_addr,
     else
         ret_entry = NU_NULL;
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -70,7 +70,7 @@ STATUS NU_ARP_Update(ARP_ENTRY *arp_changes, const UINT8 *target_ip)
 
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -80,7 +80,7 @@ STATUS NU_ARP_Update(ARP_ENTRY *arp_changes, const UINT8 *target_ip)
 
     status = ARP_Update(arp_changes, target_ip);
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
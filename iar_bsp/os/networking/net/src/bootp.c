@@ -146,7 +146,7 @@ STATUS NU_Bootp(const CHAR *dv_name, BOOTP_STRUCT *bp_ptr)
                     UTL_Zero(bp_ptr->bp_file, sizeof(bp_ptr->bp_file));
 
                     /* Get the semaphore before accessing the device list */
-                    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+                    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
                     {
                         /* Get the device by name to be used on BOOTP for this
                          * iteration.
@@ -171,7 +171,7 @@ STATUS NU_Bootp(const CHAR *dv_name, BOOTP_STRUCT *bp_ptr)
                                 hdrlen = int_face->dev_hdrlen;
 
                                 /* Release the semaphore */
-                                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                                     NLOG_Error_Log("Failed to release semaphore",
                                                    NERR_SEVERE, __FILE__, __LINE__);
 
@@ -192,7 +192,7 @@ STATUS NU_Bootp(const CHAR *dv_name, BOOTP_STRUCT *bp_ptr)
                             else
                             {
                                 /* Release the semaphore */
-                                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                                     NLOG_Error_Log("Failed to release semaphore",
                                                    NERR_SEVERE, __FILE__, __LINE__);
 
@@ -203,7 +203,7 @@ STATUS NU_Bootp(const CHAR *dv_name, BOOTP_STRUCT *bp_ptr)
                         else
                         {
                             /* Release the semaphore */
-                            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                                 NLOG_Error_Log("Failed to release semaphore",
                                                NERR_SEVERE, __FILE__, __LINE__);
 
@@ -313,7 +313,7 @@ STATIC STATUS BOOTP_Process_Request(INT socketd, UINT8 HUGE *work_buffer,
     STATUS              retval = NU_SUCCESS;
 
     /* Get the semaphore before accessing the device list */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
         return (status);
@@ -323,7 +323,7 @@ STATIC STATUS BOOTP_Process_Request(INT socketd, UINT8 HUGE *work_buffer,
         MEM_Buffer_Chain_Dequeue(&MEM_Buffer_Freelist, pkt_size);
 
     /* Release the semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -363,7 +363,7 @@ STATIC STATUS BOOTP_Process_Request(INT socketd, UINT8 HUGE *work_buffer,
     else
     {
         /* Get the semaphore before returning the buffers. */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (status == NU_SUCCESS)
         {
@@ -379,7 +379,7 @@ STATIC STATUS BOOTP_Process_Request(INT socketd, UINT8 HUGE *work_buffer,
                            __FILE__, __LINE__);
 
             /* Release the semaphore */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
         }
@@ -540,7 +540,7 @@ STATIC STATUS BOOTP_Process_Request(INT socketd, UINT8 HUGE *work_buffer,
     sa.sck_len = sizeof(sa);
 
     /* Get the semaphore before accessing the device list */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -560,7 +560,7 @@ STATIC STATUS BOOTP_Process_Request(INT socketd, UINT8 HUGE *work_buffer,
         else
             status = NU_BOOTP_SEND_FAILED;
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -580,7 +580,7 @@ STATIC STATUS BOOTP_Process_Request(INT socketd, UINT8 HUGE *work_buffer,
     {
         /* Grab the semaphore because we are about to change the interface
            that the BOOTP request will be sent over. */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (status != NU_SUCCESS)
         {
@@ -607,7 +607,10 @@ STATIC STATUS BOOTP_Process_Request(INT socketd, UINT8 HUGE *work_buffer,
                                            (SCK_SOCKADDR_IP *)&sa, NU_NULL);
         int_face->dev_flags = flags;
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        /* Cached route lookups depend on the device and route state */
+        RTAB_Invalidate_Route_Cache();
+
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -639,7 +642,7 @@ STATIC STATUS BOOTP_Process_Request(INT socketd, UINT8 HUGE *work_buffer,
     }  /*  End For Loop */
 
     /* Get the semaphore before accessing the device list */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -699,7 +702,7 @@ STATIC STATUS BOOTP_Process_Request(INT socketd, UINT8 HUGE *work_buffer,
 
         } /* end if we errored out */
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
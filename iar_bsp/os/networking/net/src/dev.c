@@ -117,14 +117,14 @@ STATUS NU_Init_Devices(DEV_DEVICE *devices, INT dev_count)
     /* Switch to supervisor mode. */
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
         status = DEV_Init_Devices(devices, dev_count);
 
         /* Release the semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("NU_Init_Devices could not release semaphore",
                            NERR_SEVERE, __FILE__, __LINE__);
     }
@@ -742,6 +742,8 @@ VOID DEV_Recover_TX_Buffers(DV_DEVICE_ENTRY *device)
         /* Pull the transmitted packet from the transmit queue. */
         buf_ptr = MEM_Buffer_Dequeue(&device->dev_transq);
 
+        NET_LAT_STAMP(buf_ptr, NET_LAT_TX_QUEUE, NET_LAT_NONE);
+
         /* Free the buffers onto the appropriate free lists */
         MEM_Multiple_Buffer_Chain_Free(buf_ptr);
 
@@ -347,6 +347,9 @@ STATUS DEV_Initialize_IP(DV_DEVICE_ENTRY *device, const UINT8 *ip_addr,
     /* Indicate that the device is Running. */
     device->dev_flags |= DV_UP;
 
+    /* Routes through this device may now be preferred */
+    RTAB_Invalidate_Route_Cache();
+
     /* Trace log */
     T_DEV_UP_STATUS(device->dev_net_if_name, 0);
 
@@ -116,6 +116,9 @@ STATUS DEV4_Delete_IP_From_Device(DV_DEVICE_ENTRY *dev_ptr,
         {
             dev_ptr->dev_flags &= ~DV_UP;
 
+            /* Routes through this device can no longer be used */
+            RTAB_Invalidate_Route_Cache();
+
             /* Trace log */
             T_DEV_UP_STATUS(dev_ptr->dev_net_if_name, 1);
 
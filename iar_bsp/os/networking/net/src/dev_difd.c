@@ -65,7 +65,7 @@ STATUS NU_Detach_IP_From_Device(const CHAR *name)
     NU_SUPERVISOR_MODE();
 
     /* We must grab the NET semaphore */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -80,7 +80,7 @@ STATUS NU_Detach_IP_From_Device(const CHAR *name)
     NU_Ifconfig_Delete_Interface(name);
 
     /* Release the semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -131,6 +131,9 @@ STATUS DEV_Detach_IP_From_Device(const CHAR *name)
         /* Indicate that the device is not up and running. */
         dev->dev_flags &= ~DV_UP;
 
+        /* Routes through this device can no longer be used */
+        RTAB_Invalidate_Route_Cache();
+
         /* Trace log */
         T_DEV_UP_STATUS((char*)name, 1);
 
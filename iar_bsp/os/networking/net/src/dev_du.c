@@ -67,13 +67,13 @@ STATUS NU_Device_Up(const CHAR *if_name)
     /* Switch to supervisor mode. */
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_NO_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_NO_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
         status = DEV_Device_Up(if_name);
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
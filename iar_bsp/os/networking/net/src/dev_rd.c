@@ -87,7 +87,7 @@ STATUS NU_Remove_Device(const CHAR *name, UINT32 flags)
     NU_SUPERVISOR_MODE();
 
     /* We must grab the NET semaphore */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -110,7 +110,7 @@ STATUS NU_Remove_Device(const CHAR *name, UINT32 flags)
         status = NU_INVALID_PARM;
 
     /* Release the semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -238,9 +238,28 @@ VOID DEV_Remove_Device(DV_DEVICE_ENTRY *dev, UINT32 flags)
     while (dev->dev_transq.head)
         DEV_Recover_TX_Buffers(dev);
 
+    /* Free the packets on the receive ring of the device. */
+    MEM_Rx_Ring_Delete(dev);
+
     /* Remove all buffers from the Buffer List using this device */
     irq_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
 
+    /* Take over the packets queued by drivers without a receive ring so
+     * they are checked too.
+     */
+    if (MEM_Rx_Driver_List.head)
+    {
+        if (MEM_Buffer_List.head)
+            MEM_Buffer_List.tail->next = MEM_Rx_Driver_List.head;
+        else
+            MEM_Buffer_List.head = MEM_Rx_Driver_List.head;
+
+        MEM_Buffer_List.tail = MEM_Rx_Driver_List.tail;
+
+        MEM_Rx_Driver_List.head = NU_NULL;
+        MEM_Rx_Driver_List.tail = NU_NULL;
+    }
+
     current_buf = MEM_Buffer_Dequeue(&MEM_Buffer_List);
 
     /* While there are buffers on the list and we have not looped
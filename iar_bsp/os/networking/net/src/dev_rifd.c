@@ -87,7 +87,7 @@ STATUS NU_Remove_IP_From_Device(const CHAR *name, const UINT8 *ip_addr,
 #endif
 
     /* We must grab the NET semaphore */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -196,7 +196,7 @@ STATUS NU_Remove_IP_From_Device(const CHAR *name, const UINT8 *ip_addr,
     DEV_Resume_All_Open_Sockets();
 
     /* Release the semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
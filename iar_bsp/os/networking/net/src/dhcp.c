@@ -231,7 +231,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
     ds_ptr->dhcp_xid = UTL_Rand();
 
     /* Obtain the TCP semaphore to protect the stack global variables */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -245,7 +245,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
 
     if (device == NU_NULL)
     {
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_FATAL,
                            __FILE__, __LINE__);
 
@@ -274,7 +274,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
         /* If there is no blank entry, add one now */
         if (dev_addr_entry == NU_NULL)
         {
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_FATAL,
                                __FILE__, __LINE__);
 
@@ -315,7 +315,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
 
         if (status != NU_SUCCESS)
         {
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_FATAL,
                                __FILE__, __LINE__);
 
@@ -339,7 +339,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
      */
     device->dev_flags |= DV_ADDR_CFG;
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -415,7 +415,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
     }
 
     /* Obtain the TCP semaphore to protect the stack global variables */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -430,7 +430,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
 
     if (device == NU_NULL)
     {
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_FATAL,
                            __FILE__, __LINE__);
 
@@ -444,7 +444,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
     /* Set the DHCP state. */
     device->dev_addr.dev_dhcp_state = DHCP_REQUESTING_STATE;
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -455,7 +455,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
         if (retval == NU_SUCCESS)
         {
             /* Obtain the TCP semaphore to protect the stack global variables */
-            status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+            status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
             if (status != NU_SUCCESS)
             {
@@ -471,7 +471,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
 
             if (device == NU_NULL)
             {
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_FATAL,
                                    __FILE__, __LINE__);
 
@@ -485,7 +485,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
 
             if (dev_addr_entry == NU_NULL)
             {
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_FATAL,
                                    __FILE__, __LINE__);
 
@@ -527,7 +527,10 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
             /* put the flags back */
             device->dev_flags = flags;
 
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            /* Cached route lookups depend on the device and route state */
+            RTAB_Invalidate_Route_Cache();
+
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
 
@@ -536,7 +539,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
             NET_Sleep(SCK_Ticks_Per_Second / 4);
 
             /* Obtain the TCP semaphore to protect the stack global variables */
-            status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+            status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
             if (status != NU_SUCCESS)
             {
@@ -552,7 +555,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
 
             if (device == NU_NULL)
             {
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_FATAL,
                                    __FILE__, __LINE__);
 
@@ -566,7 +569,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
 
             if (dev_addr_entry == NU_NULL)
             {
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_FATAL,
                                    __FILE__, __LINE__);
 
@@ -600,7 +603,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
                     DHCP_Init_Timers(device);
                 }
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
             }
@@ -608,7 +611,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
             {
                 /* Someone else is using the IP address that we were provided.
                     Send a DECLINE message. */
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
 
@@ -635,7 +638,7 @@ STATUS NU_Dhcp(DHCP_STRUCT *ds_ptr, const CHAR *dv_name)
 DHCP_Exit:
 
     /* Obtain the TCP semaphore to protect the device structure. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -657,7 +660,7 @@ DHCP_Exit:
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_FATAL,
                            __FILE__, __LINE__);
@@ -887,7 +890,7 @@ STATUS DHCP_Release_Address(const DHCP_STRUCT *ds_ptr, const CHAR *dv_name,
         return (NU_INVALID_PARM);
 
     /* Obtain the TCP semaphore to protect the stack global variables */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -911,7 +914,7 @@ STATUS DHCP_Release_Address(const DHCP_STRUCT *ds_ptr, const CHAR *dv_name,
              */
             if (tx_release == NU_TRUE)
             {
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
 
@@ -926,7 +929,7 @@ STATUS DHCP_Release_Address(const DHCP_STRUCT *ds_ptr, const CHAR *dv_name,
                     NU_Ping(ds_ptr->dhcp_siaddr, SCK_Ticks_Per_Second);
 
                     /* Obtain the TCP semaphore to protect the stack global variables */
-                    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
                     if (status == NU_SUCCESS)
                     {
@@ -935,7 +938,7 @@ STATUS DHCP_Release_Address(const DHCP_STRUCT *ds_ptr, const CHAR *dv_name,
 
                         if (!device)
                         {
-                            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                                __FILE__, __LINE__);
 
@@ -962,7 +965,7 @@ STATUS DHCP_Release_Address(const DHCP_STRUCT *ds_ptr, const CHAR *dv_name,
                 /* Zero out the IP address being maintained by DHCP */
                 device->dev_addr.dev_dhcp_addr = 0;
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
 
@@ -974,7 +977,7 @@ STATUS DHCP_Release_Address(const DHCP_STRUCT *ds_ptr, const CHAR *dv_name,
             }
 
             /* Obtain the TCP semaphore to protect the stack global variables */
-            status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+            status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
             if (status == NU_SUCCESS)
             {
@@ -1001,7 +1004,7 @@ STATUS DHCP_Release_Address(const DHCP_STRUCT *ds_ptr, const CHAR *dv_name,
                     device->dev_addr.dev_dhcp_options = NU_NULL;
                 }
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
             }
@@ -1009,7 +1012,7 @@ STATUS DHCP_Release_Address(const DHCP_STRUCT *ds_ptr, const CHAR *dv_name,
 
         else
         {
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
 
@@ -1343,7 +1346,7 @@ STATIC STATUS DHCP_Process_ACK(INT socketd, DHCP_STRUCT *ds_ptr,
         opts_byte_count = 4;
 
         /* Obtain the TCP semaphore to protect the stack global variables */
-        if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+        if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
         {
             /* Get a pointer to the interface. */
             device = DEV_Get_Dev_By_Name(dv_name);
@@ -1363,7 +1366,7 @@ STATIC STATUS DHCP_Process_ACK(INT socketd, DHCP_STRUCT *ds_ptr,
 
                 if (dev_addr_entry)
                 {
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release semaphore",
                                        NERR_SEVERE, __FILE__, __LINE__);
@@ -1396,7 +1399,7 @@ STATIC STATUS DHCP_Process_ACK(INT socketd, DHCP_STRUCT *ds_ptr,
 
                 else
                 {
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release semaphore",
                                        NERR_SEVERE, __FILE__, __LINE__);
@@ -1408,7 +1411,7 @@ STATIC STATUS DHCP_Process_ACK(INT socketd, DHCP_STRUCT *ds_ptr,
 
             else
             {
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release semaphore",
                                    NERR_SEVERE, __FILE__, __LINE__);
@@ -2028,7 +2031,7 @@ STATIC STATUS DHCP_Send(const CHAR *dv_name, const DHCP_STRUCT *ds_ptr,
     NU_SUPERVISOR_MODE();
 
     /* Obtain the TCP semaphore to protect the stack global variables */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -2113,6 +2116,9 @@ STATIC STATUS DHCP_Send(const CHAR *dv_name, const DHCP_STRUCT *ds_ptr,
 
                     device->dev_flags = flags;
 
+                    /* Cached route lookups depend on the device and route state */
+                    RTAB_Invalidate_Route_Cache();
+
                     /* Free the route used to send the packet */
                     if (route_for_dhcp)
                         RTAB_Free((ROUTE_ENTRY*)route_for_dhcp->rt_route, NU_FAMILY_IP);
@@ -2129,7 +2135,7 @@ STATIC STATUS DHCP_Send(const CHAR *dv_name, const DHCP_STRUCT *ds_ptr,
                            NERR_INFORMATIONAL, __FILE__, __LINE__);
         }
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2392,7 +2398,7 @@ STATIC STATUS DHCP_Vendor_Options(const CHAR *dv_name, UINT8 opc, UINT16 len,
         case DHCP_ROUTE:
 
             /* Obtain the TCP semaphore to protect the stack global variables */
-            if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+            if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
             {
                 /* Get a pointer to the interface. */
                 device = DEV_Get_Dev_By_Name(dv_name);
@@ -2406,7 +2412,7 @@ STATIC STATUS DHCP_Vendor_Options(const CHAR *dv_name, UINT8 opc, UINT16 len,
                                        __FILE__, __LINE__);
                 }
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
             }
@@ -2556,7 +2562,7 @@ STATIC STATUS DHCP_Vendor_Options(const CHAR *dv_name, UINT8 opc, UINT16 len,
         case DHCP_IP_LEASE_TIME:
 
             /* Obtain the TCP semaphore to protect the stack global variables */
-            if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+            if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
             {
                 /* Get a pointer to the interface. */
                 device = DEV_Get_Dev_By_Name(dv_name);
@@ -2567,7 +2573,7 @@ STATIC STATUS DHCP_Vendor_Options(const CHAR *dv_name, UINT8 opc, UINT16 len,
                     device->dev_addr.dev_dhcp_lease = GET32(opt_data, 0);
                 }
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
             }
@@ -2585,7 +2591,7 @@ STATIC STATUS DHCP_Vendor_Options(const CHAR *dv_name, UINT8 opc, UINT16 len,
             IP_ADDR_COPY(ds_ptr->dhcp_siaddr, opt_data);
 
             /* Obtain the TCP semaphore to protect the stack global variables */
-            if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+            if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
             {
                 /* Get a pointer to the interface. */
                 device = DEV_Get_Dev_By_Name(dv_name);
@@ -2593,7 +2599,7 @@ STATIC STATUS DHCP_Vendor_Options(const CHAR *dv_name, UINT8 opc, UINT16 len,
                 if (device)
                     device->dev_addr.dev_dhcp_server_addr = GET32(opt_data, 0);
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
             }
@@ -2611,7 +2617,7 @@ STATIC STATUS DHCP_Vendor_Options(const CHAR *dv_name, UINT8 opc, UINT16 len,
         case DHCP_RENEWAL_T1:
 
             /* Obtain the TCP semaphore to protect the stack global variables */
-            if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+            if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
             {
                 /* Get a pointer to the interface. */
                 device = DEV_Get_Dev_By_Name(dv_name);
@@ -2619,7 +2625,7 @@ STATIC STATUS DHCP_Vendor_Options(const CHAR *dv_name, UINT8 opc, UINT16 len,
                 if (device)
                     device->dev_addr.dev_dhcp_renew = GET32(opt_data, 0);
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
             }
@@ -2632,7 +2638,7 @@ STATIC STATUS DHCP_Vendor_Options(const CHAR *dv_name, UINT8 opc, UINT16 len,
         case DHCP_REBINDING_T2:
 
             /* Obtain the TCP semaphore to protect the stack global variables */
-            if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+            if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
             {
                 /* Get a pointer to the interface. */
                 device = DEV_Get_Dev_By_Name(dv_name);
@@ -2640,7 +2646,7 @@ STATIC STATUS DHCP_Vendor_Options(const CHAR *dv_name, UINT8 opc, UINT16 len,
                 if (device)
                     device->dev_addr.dev_dhcp_rebind = GET32(opt_data, 0);
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
             }
@@ -2825,7 +2831,7 @@ STATIC STATUS DHCP_Update_Timers(const CHAR *dv_name, TQ_EVENT event,
     seconds = ticks / SCK_Ticks_Per_Second;
 
     /* Obtain the TCP semaphore to protect the stack global variables */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -2921,7 +2927,7 @@ STATIC STATUS DHCP_Update_Timers(const CHAR *dv_name, TQ_EVENT event,
         else
             status = -1;
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3029,7 +3035,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
         event = (TQ_EVENT)queue_message[0];
 
         /* Obtain the TCP semaphore to protect the stack global variables */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (status != NU_SUCCESS)
         {
@@ -3078,7 +3084,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                     /* Zero out the address so the application layer can recover */
                     device->dev_addr.dev_dhcp_addr = 0;
 
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release semaphore",
                                        NERR_SEVERE, __FILE__, __LINE__);
@@ -3119,7 +3125,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
             /* No need to create a new socket and bind if we are in New Lease state */
             if ((event == DHCP_Renew) || (event == DHCP_Rebind))
             {
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release semaphore",
                                    NERR_SEVERE, __FILE__, __LINE__);
@@ -3181,7 +3187,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
             if (event == DHCP_Renew)
             {
                 /* Obtain the TCP semaphore to protect the stack global variables */
-                status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
                 if (status != NU_SUCCESS)
                 {
@@ -3210,7 +3216,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                     continue;
                 }
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release semaphore",
                                    NERR_SEVERE, __FILE__, __LINE__);
@@ -3268,7 +3274,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                                            NU_Current_Task_Pointer(), NU_NULL);
                         }
 
-                        if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+                        if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
                         {
                             /* Get a pointer to the device */
                             device = DEV_Get_Dev_By_Name(dv_name);
@@ -3294,7 +3300,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                                     NLOG_Error_Log("Failed to delete route",
                                                    NERR_RECOVERABLE, __FILE__, __LINE__);
 
-                                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                                 {
                                     NLOG_Error_Log("Failed to release semaphore",
                                                    NERR_SEVERE, __FILE__, __LINE__);
@@ -3306,7 +3312,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
 
                             else
                             {
-                                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                                 {
                                     NLOG_Error_Log("Failed to release semaphore",
                                                    NERR_SEVERE, __FILE__, __LINE__);
@@ -3348,7 +3354,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                 else
                 {
                     /* Obtain the TCP semaphore to protect the stack global variables */
-                    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
                     if (status != NU_SUCCESS)
                     {
@@ -3383,7 +3389,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                                        __FILE__, __LINE__);
                     }
 
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release semaphore",
                                        NERR_SEVERE, __FILE__, __LINE__);
@@ -3397,7 +3403,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
             else if (event == DHCP_Rebind)
             {
                 /* Obtain the TCP semaphore to protect the stack global variables */
-                status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
                 if (status != NU_SUCCESS)
                 {
@@ -3418,7 +3424,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                     ds_ptr->dhcp_opts = (UINT8 *)device->dev_addr.dev_dhcp_options;
                     ds_ptr->dhcp_opts_len = (UINT8)device->dev_addr.dev_dhcp_opts_length;
 
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release semaphore",
                                        NERR_SEVERE, __FILE__, __LINE__);
@@ -3433,7 +3439,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                     NLOG_Error_Log("Cannot find matching device", NERR_SEVERE,
                                    __FILE__, __LINE__);
 
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release semaphore",
                                        NERR_SEVERE, __FILE__, __LINE__);
@@ -3460,7 +3466,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                     if (DHCP_Update_Timers(dv_name, event, time) != NU_SUCCESS)
                     {
                         /* Grab the NET semaphore. */
-                        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
                         if (status != NU_SUCCESS)
                         {
@@ -3509,7 +3515,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                                 NLOG_Error_Log("Cannot find matching device",
                                                NERR_SEVERE, __FILE__, __LINE__);
 
-                            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                             {
                                 NLOG_Error_Log("Failed to release semaphore",
                                                NERR_SEVERE, __FILE__, __LINE__);
@@ -3523,7 +3529,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                 else
                 {
                     /* Obtain the TCP semaphore to protect the stack global variables */
-                    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
                     if (status != NU_SUCCESS)
                     {
@@ -3555,7 +3561,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                                        __FILE__, __LINE__);
                     }
 
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release semaphore",
                                        NERR_SEVERE, __FILE__, __LINE__);
@@ -3575,7 +3581,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                 ds_ptr->dhcp_opts = (UINT8 *)device->dev_addr.dev_dhcp_options;
                 ds_ptr->dhcp_opts_len = (UINT8)device->dev_addr.dev_dhcp_opts_length;
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release semaphore",
                                    NERR_SEVERE, __FILE__, __LINE__);
@@ -3596,7 +3602,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                     rand_num = (UTL_Rand())%(SCK_Ticks_Per_Second/2);
 
                     /* Obtain the TCP semaphore to protect the stack global variables */
-                    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
                     if (status != NU_SUCCESS)
                     {
@@ -3624,7 +3630,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                         NLOG_Error_Log("Cannot find matching device", NERR_SEVERE,
                                        __FILE__, __LINE__);
 
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release semaphore",
                                        NERR_SEVERE, __FILE__, __LINE__);
@@ -3680,7 +3686,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
                                    NERR_SEVERE, __FILE__, __LINE__);
                 }
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release semaphore",
                                    NERR_SEVERE, __FILE__, __LINE__);
@@ -3709,7 +3715,7 @@ STATIC VOID DHCP_Event_Handler(UNSIGNED argc, VOID *argv)
 
         else
         {
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release semaphore",
                                NERR_SEVERE, __FILE__, __LINE__);
@@ -69,7 +69,7 @@ STATUS NU_Get_DHCP_DUID(DHCP_DUID_STRUCT *duid_ptr)
     NU_SUPERVISOR_MODE();
 
     /* Obtain the semaphore */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -104,7 +104,7 @@ STATUS NU_Get_DHCP_DUID(DHCP_DUID_STRUCT *duid_ptr)
         }
 
         /* Release the semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -75,7 +75,7 @@ STATUS NU_Get_DHCP_IAID(const UINT32 dev_index, UINT32 *iaid)
     NU_SUPERVISOR_MODE();
 
     /* Obtain the semaphore */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -90,7 +90,7 @@ STATUS NU_Get_DHCP_IAID(const UINT32 dev_index, UINT32 *iaid)
         }
 
         /* Release the semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -78,7 +78,7 @@ STATUS NU_Set_DHCP_DUID(const DHCP_DUID_STRUCT *duid_ptr)
     NU_SUPERVISOR_MODE();
 
     /* Obtain the semaphore */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -135,7 +135,7 @@ STATUS NU_Set_DHCP_DUID(const DHCP_DUID_STRUCT *duid_ptr)
         }
 
         /* Release the semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
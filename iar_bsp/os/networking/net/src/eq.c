@@ -163,7 +163,7 @@ VOID NU_EventsDispatcher(UNSIGNED argc, VOID *argv)
         /* Retrieve a message from the event queue.  Note that if the source
            queue is empty this task suspends until something becomes
            available. */
-        dbg_status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        dbg_status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (dbg_status != NU_SUCCESS)
         {
@@ -196,7 +196,7 @@ VOID NU_EventsDispatcher(UNSIGNED argc, VOID *argv)
         }
 
         /* Release the semaphore while control is relinquished */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -219,7 +219,7 @@ VOID NU_EventsDispatcher(UNSIGNED argc, VOID *argv)
         }
 
         /* Obtain the semaphore so that the following test can be made */
-        dbg_status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        dbg_status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (dbg_status != NU_SUCCESS)
         {
@@ -241,7 +241,7 @@ VOID NU_EventsDispatcher(UNSIGNED argc, VOID *argv)
             {
                 tqe_wait = NU_NULL;
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
@@ -315,7 +315,7 @@ VOID NU_EventsDispatcher(UNSIGNED argc, VOID *argv)
                         TCP_Retransmit(prt);
                         tqe_wait = NU_NULL;
 
-                        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                        if (NET_Release_Stack_Lock() != NU_SUCCESS)
                         {
                             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                            __FILE__, __LINE__);
@@ -341,7 +341,7 @@ VOID NU_EventsDispatcher(UNSIGNED argc, VOID *argv)
                 }
                 else
                 {
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                        __FILE__, __LINE__);
@@ -357,7 +357,7 @@ VOID NU_EventsDispatcher(UNSIGNED argc, VOID *argv)
             {
                 tqe_wait = NU_NULL;
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
@@ -735,7 +735,7 @@ VOID NU_EventsDispatcher(UNSIGNED argc, VOID *argv)
 
         } /* end if status is NU_SUCCESS */
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
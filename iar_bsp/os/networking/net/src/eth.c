@@ -238,6 +238,8 @@ STATUS ETH_Ether_Send(NET_BUFFER *buf_ptr, DV_DEVICE_ENTRY *device,
 
         old_int = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
 
+        NET_LAT_START(buf_ptr, NET_LAT_TX_QUEUE);
+
         /* Place the buffer on the device's transmit queue. */
         MEM_Buffer_Enqueue(&device->dev_transq, buf_ptr);
 
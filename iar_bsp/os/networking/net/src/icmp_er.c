@@ -91,7 +91,7 @@ STATUS ICMP_Send_Echo_Request(const UINT8 *dest_ip, UINT32 timeout)
     NU_SUPERVISOR_MODE();
 
     /* Grab the stack semaphore */
-    ret_status = NU_Obtain_Semaphore (&TCP_Resource, NU_SUSPEND);
+    ret_status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (ret_status != NU_SUCCESS)
     {
@@ -159,7 +159,7 @@ STATUS ICMP_Send_Echo_Request(const UINT8 *dest_ip, UINT32 timeout)
         if (ret_status != NU_SUCCESS)
         {
             /* Release the stack semaphore */
-            if (NU_Release_Semaphore (&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                 __FILE__, __LINE__);
 
@@ -207,7 +207,7 @@ STATUS ICMP_Send_Echo_Request(const UINT8 *dest_ip, UINT32 timeout)
             old_preempt = NU_Change_Preemption(NU_NO_PREEMPT);
 
             /* Release the stack semaphore */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                 __FILE__, __LINE__);
 
@@ -229,7 +229,7 @@ STATUS ICMP_Send_Echo_Request(const UINT8 *dest_ip, UINT32 timeout)
     else
     {
         /* Release the stack semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -25,7 +25,9 @@
 *       IP_Time_To_Live
 *       IP_Forwarding
 *       IP_Frag_Queue
+*       IP_Frag_Hash[]
 *       IP6_Frag_Queue
+*       IP_Reasm_Buffers_Used
 *       IP_NAT_Initialize
 *       IP_Brd_Cast[]
 *       IP_Null[]
@@ -69,6 +71,14 @@ UINT8         IP_Forwarding;
 
 #if ( (INCLUDE_IPV4 == NU_TRUE) && (INCLUDE_IP_REASSEMBLY == NU_TRUE) )
 IP_QUEUE      IP_Frag_Queue;
+
+/* The reassembly queues hashed by the fields that identify a datagram. */
+IP_QUEUE_ELEMENT    *IP_Frag_Hash[IP_REASM_HASH_SIZE];
+#endif
+
+#if (INCLUDE_IP_REASSEMBLY == NU_TRUE)
+/* The number of NET buffers held by IPv4 and IPv6 reassembly queues. */
+UINT16        IP_Reasm_Buffers_Used;
 #endif
 
 #if ( (INCLUDE_IPV4 == NU_TRUE) && (INCLUDE_NAT == NU_TRUE) )
@@ -115,6 +125,8 @@ VOID IP_Initialize(VOID)
     IP_Frag_Queue.ipq_head = NU_NULL;
     IP_Frag_Queue.ipq_tail = NU_NULL;
 
+    UTL_Zero(IP_Frag_Hash, sizeof(IP_Frag_Hash));
+
     /* Record the timeout value for ip reassembly. This is defined in
      * Nucleus PLUS clock ticks. So we divide by SCK_Ticks_Per_Second to
      * get the number of seconds.
@@ -122,6 +134,10 @@ VOID IP_Initialize(VOID)
     MIB2_ipReasmTimeout_Set((IP_FRAG_TTL / SCK_Ticks_Per_Second));
 #endif
 
+#if (INCLUDE_IP_REASSEMBLY == NU_TRUE)
+    IP_Reasm_Buffers_Used = 0;
+#endif
+
 #if ( (INCLUDE_IPV4 == NU_TRUE) && (INCLUDE_NAT == NU_TRUE) )
     IP_NAT_Initialize = 0;
 #endif
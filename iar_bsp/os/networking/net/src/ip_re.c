@@ -29,6 +29,7 @@
 *       IP_Reassembly
 *       IP_Reassembly_Event
 *       IP_Free_Queue_Element
+*       IP_Reasm_Unlink
 *
 * DEPENDENCIES
 *
@@ -44,7 +45,11 @@
 
 #if (INCLUDE_IPV4 == NU_TRUE)
 
-extern IP_QUEUE IP_Frag_Queue;
+extern IP_QUEUE           IP_Frag_Queue;
+extern IP_QUEUE_ELEMENT   *IP_Frag_Hash[];
+extern UINT16             IP_Reasm_Buffers_Used;
+
+STATIC VOID IP_Reasm_Unlink(IP_QUEUE_ELEMENT *);
 
 #if (INCLUDE_STATIC_BUILD == NU_TRUE)
 
@@ -95,10 +100,11 @@ STATUS IP_Reassemble_Packet(IPLAYER **packet, NET_BUFFER **buf_ptr,
     ip_dest = GET32(pkt, IP_DEST_OFFSET);
     ip_protocol = GET8(pkt, IP_PROTOCOL_OFFSET);
 
-    /* Search the list of fragmented packets to see if at least one
-     * fragment from the same packet was previously received.
+    /* Search the hash bucket of fragmented packets to see if at least
+     * one fragment from the same packet was previously received.
      */
-    for (fp = IP_Frag_Queue.ipq_head; fp != NU_NULL; fp = fp->ipq_next)
+    for (fp = IP_Frag_Hash[IP_REASM_HASH(ip_src, ip_dest, ip_ident, ip_protocol)];
+         fp != NU_NULL; fp = fp->ipq_hash_next)
     {
         /* Fragments are uniquely identified by IP id, source address,
          * destination address, and protocol.
@@ -233,13 +239,19 @@ NET_BUFFER *IP_Reassembly(IP_FRAG *ip_pkt, IP_QUEUE_ELEMENT *fp,
                           NET_BUFFER *buf_ptr)
 {
     INT         hlen;
-    IP_FRAG     *q, *temp_q, *p = NU_NULL, *prev;
+    IP_FRAG     *q, *temp_q, *p = NU_NULL;
+    IP_QUEUE_ELEMENT    *victim;
     INT         i;
     INT32       total_length;
     INT         next;
     NET_BUFFER  *r_buf, *m;
     INT         old_int_level;
     UINT16      ip_pkt_ipf_offset, ip_pkt_tlen_offset;
+    UINT16      buffers, hash;
+    UINT32      frag_end, last_end;
+#if (INCLUDE_STATIC_BUILD == NU_TRUE)
+    INT         j;
+#endif
 
     hlen = (GET8(ip_pkt, IPF_HL_OFFSET) & 0x0F) << 2;
 
@@ -250,6 +262,75 @@ NET_BUFFER *IP_Reassembly(IP_FRAG *ip_pkt, IP_QUEUE_ELEMENT *fp,
     buf_ptr->data_len           -= (UINT32)hlen;
     buf_ptr->mem_total_data_len -= (UINT32)hlen;
 
+    /* Save off these values to avoid a GET16 in the loops below. */
+    ip_pkt_ipf_offset = GET16(ip_pkt, IPF_OFF_OFFSET);
+    ip_pkt_tlen_offset = GET16(ip_pkt, IPF_TLEN_OFFSET);
+
+    frag_end = (UINT32)ip_pkt_ipf_offset + ip_pkt_tlen_offset;
+
+    if (fp != NU_NULL)
+    {
+        /* The end of the data received so far. */
+        last_end = (UINT32)GET16(fp->ipq_last_frag, IPF_OFF_OFFSET) +
+                   GET16(fp->ipq_last_frag, IPF_TLEN_OFFSET);
+
+        /* A fragment may not extend beyond the end of the datagram, and
+         * the last fragment may neither change the length of the
+         * datagram nor end before data that was already received.
+         */
+        if ( ((fp->ipq_total_len != 0) && (frag_end > fp->ipq_total_len)) ||
+             ((!(GET8(ip_pkt, IPF_MFF_OFFSET) & 1)) &&
+              ((frag_end < last_end) ||
+               ((fp->ipq_total_len != 0) && (frag_end != fp->ipq_total_len)))) )
+        {
+            NLOG_Error_Log("Fragment inconsistent with datagram length",
+                           NERR_INFORMATIONAL, __FILE__, __LINE__);
+
+            MEM_Buffer_Chain_Free(&MEM_Buffer_List, &MEM_Buffer_Freelist);
+
+            return (NU_NULL);
+        }
+    }
+
+    /* Count the buffers holding this fragment. */
+    for (m = buf_ptr, buffers = 0; m != NU_NULL; m = m->next_buffer)
+        buffers++;
+
+    /* Discard the oldest incomplete datagrams until this fragment fits
+     * within the buffers reserved for reassembly.
+     */
+    while ((UINT32)IP_Reasm_Buffers_Used + buffers > IP_REASM_MAX_BUFFERS)
+    {
+        victim = IP_Frag_Queue.ipq_head;
+
+        if (victim == fp)
+            victim = victim->ipq_next;
+
+        if (victim == NU_NULL)
+            break;
+
+        NLOG_Error_Log("Reassembly buffers exhausted, discarding oldest datagram",
+                       NERR_INFORMATIONAL, __FILE__, __LINE__);
+
+        /* Increment the number of IP fragmented packets that could not
+         * be reassembled.
+         */
+        MIB2_ipReasmFails_Inc;
+
+        IP_Free_Queue_Element(victim);
+    }
+
+    /* If the fragment still does not fit, drop it. */
+    if ((UINT32)IP_Reasm_Buffers_Used + buffers > IP_REASM_MAX_BUFFERS)
+    {
+        NLOG_Error_Log("Reassembly buffers exhausted, dropping fragment",
+                       NERR_INFORMATIONAL, __FILE__, __LINE__);
+
+        MEM_Buffer_Chain_Free(&MEM_Buffer_List, &MEM_Buffer_Freelist);
+
+        return (NU_NULL);
+    }
+
     /* If this is the first fragment to arrive, create a reassembly queue. */
     if (fp == NU_NULL)
     {
@@ -271,10 +352,10 @@ NET_BUFFER *IP_Reassembly(IP_FRAG *ip_pkt, IP_QUEUE_ELEMENT *fp,
         }
 #else
         /* Traverse the flag array to find free memory location */
-        for (i=0; (NET_Reassembly_Memory_Flags[i] != NU_FALSE) &&
-             (i !=NET_MAX_REASSEMBLY_QUEUES); i++)
+        for (j=0; (NET_Reassembly_Memory_Flags[j] != NU_FALSE) &&
+             (j !=NET_MAX_REASSEMBLY_QUEUES); j++)
             ;
-        if (i == NET_MAX_REASSEMBLY_QUEUES)
+        if (j == NET_MAX_REASSEMBLY_QUEUES)
         {
             /* Log an error and drop the packet. */
             NLOG_Error_Log("Unable to alloc memory for IP queue", NERR_SEVERE,
@@ -289,13 +370,16 @@ NET_BUFFER *IP_Reassembly(IP_FRAG *ip_pkt, IP_QUEUE_ELEMENT *fp,
         }
 
         /* Assign memory to the queue element */
-        fp = &NET_Reassembly_Memory[i];
+        fp = &NET_Reassembly_Memory[j];
 
         /* Turn the memory flag on */
-        NET_Reassembly_Memory_Flags[i] = NU_TRUE;
+        NET_Reassembly_Memory_Flags[j] = NU_TRUE;
 
 #endif
-        /* Insert this fragment reassembly header into the list. */
+        /* Insert this fragment reassembly header into the list.  The
+         * list is kept in order of arrival so the oldest datagram is
+         * always at the head.
+         */
         DLL_Enqueue(&IP_Frag_Queue, fp);
 
         /* Save off the protocol. */
@@ -310,11 +394,23 @@ NET_BUFFER *IP_Reassembly(IP_FRAG *ip_pkt, IP_QUEUE_ELEMENT *fp,
         fp->ipq_source = GET32(ip_pkt, IP_SRC_OFFSET);
         fp->ipq_dest = GET32(ip_pkt, IP_DEST_OFFSET);
 
+        /* Insert this fragment reassembly header into its hash bucket. */
+        hash = IP_REASM_HASH(fp->ipq_source, fp->ipq_dest, fp->ipq_id,
+                             fp->ipq_protocol);
+
+        fp->ipq_hash_next = IP_Frag_Hash[hash];
+        IP_Frag_Hash[hash] = fp;
+
         /* Insert this fragment into the list. */
         fp->ipq_first_frag = ip_pkt;
+        fp->ipq_last_frag = ip_pkt;
 
         PUT32(ip_pkt, IPF_NEXT_OFFSET, 0);
 
+        fp->ipq_recvd = 0;
+        fp->ipq_total_len = 0;
+        fp->ipq_buffers = 0;
+
         /* The protocol was saved off above. For a fragment this field is
          * temporarily used to store the offset of the IP header from the
          * start of the memory buffer.
@@ -346,37 +442,37 @@ NET_BUFFER *IP_Reassembly(IP_FRAG *ip_pkt, IP_QUEUE_ELEMENT *fp,
         PUT8(ip_pkt, IPF_BUF_OFFSET,
              (UINT8)((CHAR HUGE *)ip_pkt - (CHAR HUGE *)buf_ptr));
 
-        /* Save off this value to avoid a GET32 in the loop */
-        ip_pkt_ipf_offset = GET16(ip_pkt, IPF_OFF_OFFSET);
-        ip_pkt_tlen_offset = GET16(ip_pkt, IPF_TLEN_OFFSET);
+        /* Fragments usually arrive in order, so check whether this one
+         * belongs after the last fragment before searching the list.
+         */
+        if (GET16(fp->ipq_last_frag, IPF_OFF_OFFSET) <= ip_pkt_ipf_offset)
+        {
+            p = fp->ipq_last_frag;
+            q = NU_NULL;
+        }
 
-        /* Find a fragment which begins after this one. */
-        for (q = fp->ipq_first_frag; q != NU_NULL;
-             q = (IP_FRAG *)GET32(q, IPF_NEXT_OFFSET))
+        else
         {
-            if (GET16(q, IPF_OFF_OFFSET) > ip_pkt_ipf_offset)
-                break;
+            /* Find a fragment which begins after this one. */
+            for (q = fp->ipq_first_frag; q != NU_NULL;
+                 q = (IP_FRAG *)GET32(q, IPF_NEXT_OFFSET))
+            {
+                if (GET16(q, IPF_OFF_OFFSET) > ip_pkt_ipf_offset)
+                    break;
 
-            /* Keep a pointer to the fragment before q is set to next. */
-            p = q;
+                /* Keep a pointer to the fragment before q is set to next. */
+                p = q;
+            }
         }
 
-        /* If q is equal to NULL then the packet just RX does not belong
-         * before any of the ones already in the queue. Since it will be
-         * appended to the end of the queue, we need to check for overlapping
-         * of the last fragment in the queue. If q is not NULL, it means that
-         * there is a preceding fragment, and we need to check for overlapping
-         * of that fragment. Either case, if the fragment provides some of our
-         * data, drop that data from the incoming fragment. If it provides all
-         * of the data, drop the current fragment
+        /* If there is a preceding fragment, it may provide some of our
+         * data already.  If so, drop the data from the incoming fragment.
+         * If it provides all of the data, drop the current fragment.
          */
-
         if (p != NU_NULL)
         {
-            prev = p;
-
-            i = GET16(prev, IPF_OFF_OFFSET) +
-                GET16(prev, IPF_TLEN_OFFSET) - ip_pkt_ipf_offset;
+            i = GET16(p, IPF_OFF_OFFSET) +
+                GET16(p, IPF_TLEN_OFFSET) - ip_pkt_ipf_offset;
 
             if (i > 0)
             {
@@ -404,55 +500,76 @@ NET_BUFFER *IP_Reassembly(IP_FRAG *ip_pkt, IP_QUEUE_ELEMENT *fp,
                 ip_pkt_ipf_offset = GET16(ip_pkt, IPF_OFF_OFFSET);
                 ip_pkt_tlen_offset = GET16(ip_pkt, IPF_TLEN_OFFSET);
             }
+        }
 
-            /* While we overlap succeeding fragments trim them or, if they are
-             * completely covered, dequeue them.
-             */
-            while ( (q != NU_NULL) &&
-                    ((ip_pkt_ipf_offset + ip_pkt_tlen_offset) >
-                    GET16(q, IPF_OFF_OFFSET)) )
+        /* While we overlap succeeding fragments trim them or, if they are
+         * completely covered, dequeue them.
+         */
+        while ( (q != NU_NULL) &&
+                ((ip_pkt_ipf_offset + ip_pkt_tlen_offset) >
+                GET16(q, IPF_OFF_OFFSET)) )
+        {
+            i = (ip_pkt_ipf_offset + ip_pkt_tlen_offset) -
+                GET16(q, IPF_OFF_OFFSET);
+
+            if ((UINT16) i < GET16(q, IPF_TLEN_OFFSET))
             {
-                i = (ip_pkt_ipf_offset + ip_pkt_tlen_offset) -
-                    GET16(q, IPF_OFF_OFFSET);
+                /* Trim the duplicate data from the start of the previous
+                 * fragment. In this case q.
+                 */
 
-                if ((UINT16) i < GET16(q, IPF_TLEN_OFFSET))
-                {
-                    /* Trim the duplicate data from the start of the previous
-                     * fragment. In this case q.
-                     */
+                r_buf = (NET_BUFFER *)(((CHAR HUGE *)q) - GET8(q, IPF_BUF_OFFSET));
 
-                    r_buf = (NET_BUFFER *)(((CHAR HUGE *)q) - GET8(q, IPF_BUF_OFFSET));
+                MEM_Trim(r_buf, (INT32)i);
 
-                    MEM_Trim(r_buf, (INT32)i);
+                PUT16(q, IPF_TLEN_OFFSET, (UINT16)(GET16(q, IPF_TLEN_OFFSET) - i));
+                PUT16(q, IPF_OFF_OFFSET, (UINT16)(GET16(q, IPF_OFF_OFFSET) + i));
 
-                    PUT16(q, IPF_TLEN_OFFSET, (UINT16)(GET16(q, IPF_TLEN_OFFSET) - i));
-                    PUT16(q, IPF_OFF_OFFSET, (UINT16)(GET16(q, IPF_OFF_OFFSET) + i));
+                fp->ipq_recvd -= (UINT32)i;
 
-                    break;
-                }
+                break;
+            }
 
-                /* Move on to the next fragment so we can check to see if any/all of
-                 * it is overlapping.  Store this in a temp pointer before the
-                 * buffer is deallocated.
-                 */
-                temp_q = (IP_FRAG *)GET32(q, IPF_NEXT_OFFSET);
+            /* Move on to the next fragment so we can check to see if any/all of
+             * it is overlapping.  Store this in a temp pointer before the
+             * buffer is deallocated.
+             */
+            temp_q = (IP_FRAG *)GET32(q, IPF_NEXT_OFFSET);
 
-                /* The buffer was completely covered. Deallocate it. */
-                r_buf = (NET_BUFFER *)(((CHAR HUGE *)q) - GET8(q, IPF_BUF_OFFSET));
+            /* The buffer was completely covered. Deallocate it. */
+            r_buf = (NET_BUFFER *)(((CHAR HUGE *)q) - GET8(q, IPF_BUF_OFFSET));
 
-                IP_Remove_Frag(q, p, fp);
+            IP_Remove_Frag(q, p, fp);
 
-                MEM_One_Buffer_Chain_Free(r_buf, &MEM_Buffer_Freelist);
+            fp->ipq_recvd -= GET16(q, IPF_TLEN_OFFSET);
 
-                /* Set q to the next buffer in the chain */
-                q = temp_q;
+            /* Return the buffers of the fragment to the reassembly
+             * budget.
+             */
+            for (m = r_buf; m != NU_NULL; m = m->next_buffer)
+            {
+                fp->ipq_buffers--;
+                IP_Reasm_Buffers_Used--;
             }
+
+            MEM_One_Buffer_Chain_Free(r_buf, &MEM_Buffer_Freelist);
+
+            /* Set q to the next buffer in the chain */
+            q = temp_q;
         }
 
-        /* Insert the new fragment in its place. The new fragment should be
-         * inserted into the list of fragments immediately in front of q.
+        /* Insert the new fragment in its place, immediately in front
+         * of q.
          */
-        IP_Insert_Frag(ip_pkt, fp);
+        PUT32(ip_pkt, IPF_NEXT_OFFSET, (UINT32)q);
+
+        if (p != NU_NULL)
+            PUT32(p, IPF_NEXT_OFFSET, (UINT32)ip_pkt);
+        else
+            fp->ipq_first_frag = ip_pkt;
+
+        if (q == NU_NULL)
+            fp->ipq_last_frag = ip_pkt;
     }
 
     /* Remove this buffer from the buffer list. */
@@ -460,28 +577,24 @@ NET_BUFFER *IP_Reassembly(IP_FRAG *ip_pkt, IP_QUEUE_ELEMENT *fp,
 
     buf_ptr->next = NU_NULL;
 
-    /* Check for complete reassembly. */
-    next = 0;
+    /* Account for the data and buffers of this fragment. */
+    fp->ipq_recvd += ip_pkt_tlen_offset;
+    fp->ipq_buffers = (UINT16)(fp->ipq_buffers + buffers);
+    IP_Reasm_Buffers_Used = (UINT16)(IP_Reasm_Buffers_Used + buffers);
 
-    for (q = fp->ipq_first_frag; q != NU_NULL;
-         q = (IP_FRAG *)GET32(q, IPF_NEXT_OFFSET))
-    {
-        /* Does the fragment contain the next offset. */
-        if (GET16(q, IPF_OFF_OFFSET) != (UINT16) next)
-            return (NU_NULL);
-
-        /* Update next to the offset of the next fragment. */
-        next += GET16(q, IPF_TLEN_OFFSET);
-
-        /* Keep track of the last fragment checked. It is used below. */
-        p = q;
-    }
+    /* The last fragment gives the length of the datagram. */
+    if (!(GET8(ip_pkt, IPF_MFF_OFFSET) & 1))
+        fp->ipq_total_len = frag_end;
 
-    /* If the more fragments flag is set in the last fragment, then we
-       are expecting more. */
-    if ( (!p) || (GET8(p, IPF_MFF_OFFSET) & 1) )
+    /* Since overlapping data is trimmed as fragments arrive, the
+     * datagram is complete once the fragments hold as many bytes as the
+     * datagram is long.
+     */
+    if ( (fp->ipq_total_len == 0) || (fp->ipq_recvd != fp->ipq_total_len) )
         return (NU_NULL);
 
+    next = (INT)fp->ipq_total_len;
+
     /* Clear the fragment timeout event for this datagram. */
     TQ_Timerunset(EV_IP_REASSEMBLY, TQ_CLEAR_EXACT, (UNSIGNED)fp, 0);
 
@@ -547,8 +660,7 @@ NET_BUFFER *IP_Reassembly(IP_FRAG *ip_pkt, IP_QUEUE_ELEMENT *fp,
     PUT32(ip_pkt, IP_DEST_OFFSET, fp->ipq_dest);
 
     /* Remove this fragment reassembly header from the list. */
-    DLL_Remove(&IP_Frag_Queue, fp);
-
+    IP_Reasm_Unlink(fp);
 
 #if (INCLUDE_STATIC_BUILD == NU_FALSE)
     /* Deallocate this fragment reassembly header. */
@@ -704,8 +816,8 @@ VOID IP_Free_Queue_Element(IP_QUEUE_ELEMENT *fp)
     IP_FRAG     *q, *temp_q;
     NET_BUFFER  *buf_ptr;
 
-    /* Remove this fragment reassembly header from the list. */
-    DLL_Remove(&IP_Frag_Queue, fp);
+    /* Remove this fragment reassembly header from the lists. */
+    IP_Reasm_Unlink(fp);
 
     /* Stop the timer that is running to timeout reassembly of
      * this packet.
@@ -749,4 +861,47 @@ VOID IP_Free_Queue_Element(IP_QUEUE_ELEMENT *fp)
 
 } /* IP_Free_Queue_Element */
 
+/************************************************************************
+*
+*   FUNCTION
+*
+*       IP_Reasm_Unlink
+*
+*   DESCRIPTION
+*
+*       Remove a fragment reassembly header from the list of reassembly
+*       queues and from its hash bucket, and return the buffers held by
+*       its fragments to the reassembly budget.
+*
+*   INPUTS
+*
+*       *fp                     Pointer to the element to remove
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID IP_Reasm_Unlink(IP_QUEUE_ELEMENT *fp)
+{
+    IP_QUEUE_ELEMENT    **link_ptr;
+
+    DLL_Remove(&IP_Frag_Queue, fp);
+
+    /* Find the link to this element in its hash bucket. */
+    for (link_ptr = &IP_Frag_Hash[IP_REASM_HASH(fp->ipq_source, fp->ipq_dest,
+                                                fp->ipq_id, fp->ipq_protocol)];
+         *link_ptr != NU_NULL; link_ptr = &(*link_ptr)->ipq_hash_next)
+    {
+        if (*link_ptr == fp)
+        {
+            *link_ptr = fp->ipq_hash_next;
+            break;
+        }
+    }
+
+    IP_Reasm_Buffers_Used = (UINT16)(IP_Reasm_Buffers_Used - fp->ipq_buffers);
+
+} /* IP_Reasm_Unlink */
+
 #endif
@@ -60,7 +60,7 @@ STATUS NU_Set_Default_TTL(UINT8 default_ttl)
 
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -70,7 +70,7 @@ STATUS NU_Set_Default_TTL(UINT8 default_ttl)
 
     IP_Time_To_Live = default_ttl;
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
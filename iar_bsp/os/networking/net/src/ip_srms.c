@@ -79,7 +79,7 @@ STATUS NU_Set_Reasm_Max_Size(const CHAR *dev_name, UINT32 reasm_max_size)
     else
     {
         /* Grab the semaphore */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (status == NU_SUCCESS)
         {
@@ -95,7 +95,7 @@ STATUS NU_Set_Reasm_Max_Size(const CHAR *dev_name, UINT32 reasm_max_size)
                 status = NU_INVALID_PARM;
 
             /* Release the semaphore */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
         }
@@ -778,7 +778,7 @@ UINT16 IP_Commit_Tunnel_Config_Status(const UINT8 *local_addr,
     UINT8                       is_new;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* We have obtained the semaphore. */
         semaphore_flag = NU_TRUE;
@@ -843,6 +843,9 @@ UINT16 IP_Commit_Tunnel_Config_Status(const UINT8 *local_addr,
 
                         /* Activating corresponding device. */
                         dev->dev_flags |= DV_UP;
+
+                        /* Cached route lookups depend on the device and route state */
+                        RTAB_Invalidate_Route_Cache();
                     }
 
                     /* If we did not get the handle to the interface
@@ -900,6 +903,9 @@ UINT16 IP_Commit_Tunnel_Config_Status(const UINT8 *local_addr,
                         /* Activating the device. */
                         dev->dev_flags |= DV_UP;
 
+                        /* Cached route lookups depend on the device and route state */
+                        RTAB_Invalidate_Route_Cache();
+
                         /* Setting status to 'active'. */
                         tunnel_config->ip_row_status = SNMP_ROW_ACTIVE;
                     }
@@ -983,7 +989,7 @@ UINT16 IP_Commit_Tunnel_Config_Status(const UINT8 *local_addr,
                         strcpy(dev_name, dev->dev_net_if_name);
 
                         /* Release the semaphore. */
-                        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                        if (NET_Release_Stack_Lock() != NU_SUCCESS)
                             NLOG_Error_Log("Failed to release semaphore",
                                            NERR_SEVERE, __FILE__, __LINE__);
 
@@ -1005,7 +1011,7 @@ UINT16 IP_Commit_Tunnel_Config_Status(const UINT8 *local_addr,
         if (semaphore_flag == NU_TRUE)
         {
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
         }
@@ -299,7 +299,7 @@ STATIC STATUS IP_Make_Tunnel(IP_CFG_TUNNEL *ip_cfg_tunnel,
         */
 
     /* Grab the semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     /* If we successfully grab the semaphore then proceed, otherwise return
        error code. */
@@ -326,7 +326,7 @@ STATIC STATUS IP_Make_Tunnel(IP_CFG_TUNNEL *ip_cfg_tunnel,
         }
 
         /* Releasing semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
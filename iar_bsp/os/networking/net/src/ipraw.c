@@ -923,6 +923,8 @@ STATIC STATUS IPRaw_Append(INT port_index, NET_BUFFER *buf_ptr)
     struct iport        *iptr = IPR_Ports[port_index];
     struct sock_struct  *sockptr = SCK_Sockets[iptr->ip_socketd];
 
+    NET_LAT_STAMP(buf_ptr, NET_LAT_DEMUX, NET_LAT_SOCKET);
+
     /* Place the datagram onto this ports datagram list. */
     MEM_Buffer_Enqueue(&sockptr->s_recvlist, buf_ptr);
 
@@ -931,6 +933,9 @@ STATIC STATUS IPRaw_Append(INT port_index, NET_BUFFER *buf_ptr)
     /* Update the number of buffered datagrams. */
     sockptr->s_recvpackets++;
 
+    /* Report the data to an event set the socket is in. */
+    SCK_Notify_Events(iptr->ip_socketd, NU_EVS_READABLE);
+
     /* If there is a task pending data on the port, then set an event to
      * resume that task.
      */
@@ -175,6 +175,8 @@ STATUS LDC_TX_Packet(DV_DEVICE_ENTRY *dev_ptr, NET_BUFFER *buf_ptr)
 
 #ifndef PACKET
 
+    NET_LAT_STAMP(buf_ptr, NET_LAT_TX_QUEUE, NET_LAT_NONE);
+
     /* Remove the packet from the devices transmit queue. */
     MEM_Buffer_Dequeue(&dev_ptr->dev_transq);
 
@@ -201,6 +203,8 @@ STATUS LDC_TX_Packet(DV_DEVICE_ENTRY *dev_ptr, NET_BUFFER *buf_ptr)
         /* And the total data length. */
         dest_buf_ptr->mem_total_data_len = buf_ptr->mem_total_data_len;
 
+        NET_LAT_START(dest_buf_ptr, NET_LAT_RX_QUEUE);
+
         /* Put the "received" packet onto the receive buffer list. */
         MEM_Buffer_Enqueue(&MEM_Buffer_List, dest_buf_ptr);
 
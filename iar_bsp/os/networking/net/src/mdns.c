@@ -1100,7 +1100,7 @@ VOID MDNS_Wake_Task(UNSIGNED argc, VOID *argv)
              * internal socket structure.
              */
             if ( (MDNS_Socket >= 0) &&
-                 (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS) )
+                 (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS) )
             {
                 /* Get a pointer to the socket list entry. */
                 sockptr = SCK_Sockets[MDNS_Socket];
@@ -1108,7 +1108,7 @@ VOID MDNS_Wake_Task(UNSIGNED argc, VOID *argv)
                 /* Resume the thread that is suspend on select. */
                 SCK_Set_Socket_Error(sockptr, NU_NO_DATA_TRANSFER);
 
-                NU_Release_Semaphore(&TCP_Resource);
+                NET_Release_Stack_Lock();
             }
 
             NU_Release_Semaphore(&MDNS_Resource);
@@ -5178,7 +5178,7 @@ STATUS MDNS_Set_Device_Hostname(CHAR *name, UINT32 dev_index)
     STATUS              status;
 
     /* Obtain the TCP semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -5340,7 +5340,7 @@ STATUS MDNS_Set_Device_Hostname(CHAR *name, UINT32 dev_index)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release TCP semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
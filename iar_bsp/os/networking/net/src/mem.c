@@ -26,6 +26,7 @@
 *   DATA STRUCTURES
 *
 *       MEM_Buffer_List
+*       MEM_Rx_Driver_List
 *       MEM_Buffer_Freelist
 *       MEM_Buffer_Suspension_List
 *       MEM_Buffers_Used
@@ -35,7 +36,9 @@
 *   FUNCTIONS
 *
 *       MEM_Init
+*       MEM_Clear_Buffer_Header
 *       MEM_Buffer_Dequeue
+*       MEM_Buffer_Dequeue_Batch
 *       MEM_Buffer_Enqueue
 *       MEM_Buffer_Chain_Free
 *       MEM_One_Buffer_Chain_Free
@@ -53,8 +56,12 @@
 
 /* Declare the NET pointers for holding incoming, and empty packet buffers.
    Also declare the buffer suspension list to hold tasks waiting for
-   buffers.  */
+   buffers.  MEM_Buffer_List holds the packets being processed by the
+   stack and is only accessed by tasks holding the stack semaphore.
+   Drivers pass received packets through their receive ring, or through
+   MEM_Rx_Driver_List if they have none (see MEM_Rx_Ring_Put). */
 NET_BUFFER_HEADER           MEM_Buffer_List;
+NET_BUFFER_HEADER           MEM_Rx_Driver_List;
 NET_BUFFER_HEADER           MEM_Buffer_Freelist;
 NET_BUFFER_SUSPENSION_LIST  MEM_Buffer_Suspension_List;
 
@@ -66,6 +73,16 @@ NU_HISR NET_Buffer_Suspension_HISR;
  * Initialized in MEM_Init. */
 UINT16 MEM_Buffers_Used;
 
+/* MEM_Buffer_List is not touched from interrupt context, so it does not
+ * need an interrupt lockout.  The debug checks walk the freelist, so they
+ * always need one.
+ */
+#if (NU_DEBUG_NET == NU_TRUE)
+#define MEM_LIST_NEEDS_LOCKOUT(hdr)     NU_TRUE
+#else
+#define MEM_LIST_NEEDS_LOCKOUT(hdr)     ((hdr) != &MEM_Buffer_List)
+#endif
+
 /* Global used for debugging buffers */
 #ifdef NU_DEBUG_NET_BUFFERS
 NET_BUFFER           *MEM_Debug_Buffer_List;
@@ -123,6 +140,8 @@ STATUS MEM_Init(VOID)
     /* Initialize the global buffer pointers. */
     MEM_Buffer_List.head            = NU_NULL;
     MEM_Buffer_List.tail            = NU_NULL;
+    MEM_Rx_Driver_List.head         = NU_NULL;
+    MEM_Rx_Driver_List.tail         = NU_NULL;
     MEM_Buffer_Freelist.head        = NU_NULL;
     MEM_Buffer_Freelist.tail        = NU_NULL;
     MEM_Buffer_Suspension_List.head = NU_NULL;
@@ -224,6 +243,66 @@ STATUS MEM_Init(VOID)
 
 } /* MEM_Init */
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       MEM_Clear_Buffer_Header
+*
+*   DESCRIPTION
+*
+*       Clear the header fields of a buffer that is being removed from
+*       the buffer freelist.
+*
+*   INPUTS
+*
+*       *node                   Pointer to the net buffer
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+STATIC VOID MEM_Clear_Buffer_Header(NET_BUFFER *node)
+{
+    UNSIGNED zero = 0;           /* causes most compilers to place this */
+                                 /*   value in a register only once */
+
+    struct _me_bufhdr* headerP;
+
+    headerP = &(node->me_data.me_pkthdr.me_buf_hdr);
+
+    headerP->seqnum = zero;
+    headerP->dlist = &MEM_Buffer_Freelist;
+    headerP->buf_device = (struct _DV_DEVICE_ENTRY*)(zero);
+    headerP->option_len = (UINT16)zero;
+    headerP->retransmits = (INT16)zero;
+    headerP->tcp_data_len = (UINT16)zero;
+    headerP->total_data_len = zero;
+    headerP->port_index = -1;
+    node->chk_sum = (UINT32)(zero);
+
+    /* Zero the pointers. */
+    node->next = (NET_BUFFER*)(zero);
+    node->next_buffer = (NET_BUFFER*)(zero);
+    node->data_ptr = (UINT8 HUGE*)(zero);
+    node->data_len = zero;
+    node->pqe_flags = (UINT16)zero;
+    node->sum_data_ptr = (UINT8 HUGE*)(zero);
+
+#if (HARDWARE_OFFLOAD == NU_TRUE)
+    node->hw_options = (UINT32)zero;
+#endif
+
+#if (INCLUDE_NET_LATENCY_TRACE == NU_TRUE)
+    /* The buffer has not entered a stage of the packet path, so no
+       latency is recorded for it until it is marked as entering one. */
+    node->mem_lat_stamp = (UINT32)zero;
+    node->mem_lat_stage = NET_LAT_NONE;
+#endif
+
+} /* MEM_Clear_Buffer_Header */
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -250,12 +329,8 @@ NET_BUFFER *MEM_DB_Buffer_Dequeue(NET_BUFFER_HEADER *hdr, CHAR *the_file, INT th
 NET_BUFFER *MEM_Buffer_Dequeue(NET_BUFFER_HEADER *hdr)
 #endif
 {
-    UNSIGNED zero = 0;           /* causes most compilers to place this */
-                                 /*   value in a register only once */
-
-    struct _me_bufhdr* headerP;
     NET_BUFFER  *node;
-    INT         old_level;
+    INT         old_level = 0;
 
 #if (NU_DEBUG_NET == NU_TRUE)
     STATUS      status;
@@ -266,7 +341,8 @@ NET_BUFFER *MEM_Buffer_Dequeue(NET_BUFFER_HEADER *hdr)
         return (NU_NULL);
 
     /*  Temporarily lockout interrupts to protect global buffer variables. */
-    old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+    if (MEM_LIST_NEEDS_LOCKOUT(hdr))
+        old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
 
     /* If there is a node in the list we want to remove it. */
     if (hdr->head)
@@ -287,29 +363,7 @@ NET_BUFFER *MEM_Buffer_Dequeue(NET_BUFFER_HEADER *hdr)
         if (hdr == &MEM_Buffer_Freelist)
         {
             /* Zero the header info. */
-            headerP = &(node->me_data.me_pkthdr.me_buf_hdr);
-
-            headerP->seqnum = zero;
-            headerP->dlist = &MEM_Buffer_Freelist;
-            headerP->buf_device = (struct _DV_DEVICE_ENTRY*)(zero);
-            headerP->option_len = (UINT16)zero;
-            headerP->retransmits = (INT16)zero;
-            headerP->tcp_data_len = (UINT16)zero;
-            headerP->total_data_len = zero;
-            headerP->port_index = -1;
-            node->chk_sum = (UINT32)(zero);
-
-            /* Zero the pointers. */
-            node->next = (NET_BUFFER*)(zero);
-            node->next_buffer = (NET_BUFFER*)(zero);
-            node->data_ptr = (UINT8 HUGE*)(zero);
-            node->data_len = zero;
-            node->pqe_flags = (UINT16)zero;
-            node->sum_data_ptr = (UINT8 HUGE*)(zero);
-
-#if (HARDWARE_OFFLOAD == NU_TRUE)
-            node->hw_options = (UINT32)zero;
-#endif
+            MEM_Clear_Buffer_Header(node);
 
             /* Bump the number of buffers that have been pulled from the
                freelist. */
@@ -337,13 +391,97 @@ NET_BUFFER *MEM_Buffer_Dequeue(NET_BUFFER_HEADER *hdr)
 #endif
 
     /*  Restore the previous interrupt lockout level.  */
-    NU_Local_Control_Interrupts(old_level);
+    if (MEM_LIST_NEEDS_LOCKOUT(hdr))
+        NU_Local_Control_Interrupts(old_level);
 
     /* Return a pointer to the removed node */
     return (node);
 
 }  /* MEM_Buffer_Dequeue */
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       MEM_Buffer_Dequeue_Batch
+*
+*   DESCRIPTION
+*
+*       Remove up to count buffers from the buffer freelist.  The buffers
+*       are unlinked under a single interrupt lockout and their headers
+*       are cleared after interrupts have been restored.
+*
+*   INPUTS
+*
+*       **bufs                  Array to fill in with the buffers
+*       count                   The maximum number of buffers to remove
+*
+*   OUTPUTS
+*
+*       The number of buffers removed from the freelist.
+*
+*************************************************************************/
+INT MEM_Buffer_Dequeue_Batch(NET_BUFFER **bufs, INT count)
+{
+    INT         i = 0;
+    INT         old_level;
+
+#if (NU_DEBUG_NET == NU_TRUE)
+    STATUS      status;
+#endif
+
+    /*  Temporarily lockout interrupts to protect global buffer variables. */
+    old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+    while ( (i < count) && (MEM_Buffer_Freelist.head) )
+    {
+        bufs[i] = MEM_Buffer_Freelist.head;
+        MEM_Buffer_Freelist.head = bufs[i]->next;
+        i++;
+    }
+
+    if (!(MEM_Buffer_Freelist.head))
+        MEM_Buffer_Freelist.tail = NU_NULL;
+
+    if (i > 0)
+    {
+        /* Bump the number of buffers that have been pulled from the
+           freelist. */
+        MEM_Buffers_Used += (UINT16)i;
+
+        /* Trace log */
+        T_BUFF_USAGE(MEM_Buffers_Used);
+    }
+
+#if (NU_DEBUG_NET == NU_TRUE)
+
+    status = NET_DBG_Validate_MEM_Buffers_Used();
+
+    if (status != NU_SUCCESS)
+        NET_DBG_Notify(status, __FILE__, __LINE__,
+                       NU_Current_Task_Pointer(), NU_NULL);
+#endif
+
+    /*  Restore the previous interrupt lockout level.  */
+    NU_Local_Control_Interrupts(old_level);
+
+    /* The buffers are owned by the caller now, so their headers can be
+     * cleared with interrupts enabled.
+     */
+    for (count = 0; count < i; count++)
+    {
+        MEM_Clear_Buffer_Header(bufs[count]);
+
+#ifdef NU_DEBUG_NET_BUFFERS
+        bufs[count]->who_allocated_file = __FILE__;
+        bufs[count]->who_allocated_line = __LINE__;
+#endif
+    }
+
+    return (i);
+
+} /* MEM_Buffer_Dequeue_Batch */
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -368,7 +506,7 @@ NET_BUFFER *MEM_Buffer_Dequeue(NET_BUFFER_HEADER *hdr)
 *************************************************************************/
 NET_BUFFER *MEM_Buffer_Enqueue(NET_BUFFER_HEADER *hdr, NET_BUFFER *item)
 {
-    INT     old_level;
+    INT     old_level = 0;
 
 #if (NU_DEBUG_NET == NU_TRUE)
     STATUS  status;
@@ -380,7 +518,8 @@ NET_BUFFER *MEM_Buffer_Enqueue(NET_BUFFER_HEADER *hdr, NET_BUFFER *item)
     if (item != NU_NULL)
     {
         /* Temporarily lockout interrupts to protect global buffer variables. */
-        old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+        if (MEM_LIST_NEEDS_LOCKOUT(hdr))
+            old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
 
         /* Set node's next to point at NULL */
         item->next = NU_NULL;
@@ -427,7 +566,8 @@ NET_BUFFER *MEM_Buffer_Enqueue(NET_BUFFER_HEADER *hdr, NET_BUFFER *item)
 #endif
 
         /*  Restore the previous interrupt lockout level.  */
-        NU_Local_Control_Interrupts(old_level);
+        if (MEM_LIST_NEEDS_LOCKOUT(hdr))
+            NU_Local_Control_Interrupts(old_level);
     }
 
     return(item);
@@ -300,6 +300,8 @@ INT32 MEM_Copy_Buffer(CHAR HUGE *buffer, const struct sock_struct *sockptr,
     UINT32      *tp;
     INT32       bytes_to_copy;
 
+    NET_LAT_STAMP(sockptr->s_recvlist.head, NET_LAT_SOCKET, NET_LAT_NONE);
+
     /* In zerocopy mode just set the address to the incoming buffer */
     if (sockptr->s_flags & SF_ZC_MODE)
     {
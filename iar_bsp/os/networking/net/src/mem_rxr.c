@@ -0,0 +1,434 @@
+/*************************************************************************
+*
+*              Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+
+/*************************************************************************
+*
+*   FILE NAME
+*
+*       mem_rxr.c
+*
+*   COMPONENT
+*
+*       Net Stack Buffer Management
+*
+*   DESCRIPTION
+*
+*       This file contains the routines for the per-device receive rings.
+*       A driver that creates a receive ring passes received packets to
+*       NET_Demux through the ring, and takes its receive buffers from a
+*       small cache that is refilled from the buffer freelist in batches.
+*       The driver is the only producer and NET_Demux the only consumer
+*       of a ring, so no interrupt lockout is needed to pass a packet.
+*       Drivers without a ring pass packets through MEM_Rx_Driver_List,
+*       from which packets are moved to MEM_Buffer_List under one
+*       interrupt lockout per batch.  NET_Demux services the rings of all
+*       devices and MEM_Rx_Driver_List round-robin, a bounded batch at a
+*       time, so one receive source cannot starve another.
+*
+*   DATA STRUCTURES
+*
+*       MEM_Rx_Ring_Last_Pos
+*
+*   FUNCTIONS
+*
+*       MEM_Rx_Ring_Create
+*       MEM_Rx_Ring_Delete
+*       MEM_Rx_Ring_Put
+*       MEM_Rx_Ring_Service
+*       MEM_Rx_Buffer_Alloc
+*
+*   DEPENDENCIES
+*
+*       nu_net.h
+*
+*************************************************************************/
+
+#include "networking/nu_net.h"
+
+/* The round-robin positions of the receive sources serviced by
+ * MEM_Rx_Ring_Service.  Position 0 means no source.
+ */
+#define MEM_RX_DRIVER_LIST_POS      1
+#define MEM_RX_RING_POS(dev_ptr)    ((dev_ptr)->dev_index + 2)
+
+/* The position of the receive source serviced last by NET_Demux. */
+STATIC UINT32   MEM_Rx_Ring_Last_Pos;
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       MEM_Rx_Ring_Create
+*
+*   DESCRIPTION
+*
+*       This function creates a receive ring for a device.  It should be
+*       called by the driver's initialization routine before receive
+*       interrupts are enabled.
+*
+*   INPUTS
+*
+*       *device                 Pointer to the device.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The ring was created.
+*       NU_INVALID_PARM         device is NU_NULL.
+*       Otherwise, the status returned by NU_Allocate_Memory.
+*
+*************************************************************************/
+STATUS MEM_Rx_Ring_Create(DV_DEVICE_ENTRY *device)
+{
+    STATUS      status;
+    MEM_RX_RING *ring;
+
+    if (device == NU_NULL)
+        return (NU_INVALID_PARM);
+
+    /* The ring already exists. */
+    if (device->dev_rx_ring)
+        return (NU_SUCCESS);
+
+    status = NU_Allocate_Memory(MEM_Cached, (VOID**)&ring,
+                                sizeof(MEM_RX_RING), NU_NO_SUSPEND);
+
+    if (status == NU_SUCCESS)
+    {
+        UTL_Zero(ring, sizeof(MEM_RX_RING));
+
+        device->dev_rx_ring = ring;
+    }
+
+    else
+        NLOG_Error_Log("Failed to allocate memory for receive ring",
+                       NERR_SEVERE, __FILE__, __LINE__);
+
+    return (status);
+
+} /* MEM_Rx_Ring_Create */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       MEM_Rx_Ring_Delete
+*
+*   DESCRIPTION
+*
+*       This function frees all packets on the receive ring of a device
+*       and all buffers in its buffer cache, then deletes the ring.  The
+*       caller must hold the stack semaphore, and the driver must no
+*       longer be receiving packets.
+*
+*   INPUTS
+*
+*       *device                 Pointer to the device.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID MEM_Rx_Ring_Delete(DV_DEVICE_ENTRY *device)
+{
+    MEM_RX_RING *ring = device->dev_rx_ring;
+
+    if (ring)
+    {
+        device->dev_rx_ring = NU_NULL;
+
+        /* Free the packets that have not been processed. */
+        while (ring->mrr_head != ring->mrr_tail)
+        {
+            MEM_One_Buffer_Chain_Free(ring->mrr_slots[ring->mrr_head &
+                                                      MEM_RX_RING_MASK],
+                                      &MEM_Buffer_Freelist);
+
+            ring->mrr_head ++;
+        }
+
+        /* Return the cached buffers to the freelist. */
+        while (ring->mrr_cache_count > 0)
+        {
+            ring->mrr_cache_count --;
+
+            MEM_Buffer_Enqueue(&MEM_Buffer_Freelist,
+                               ring->mrr_cache[ring->mrr_cache_count]);
+        }
+
+        if (NU_Deallocate_Memory(ring) != NU_SUCCESS)
+            NLOG_Error_Log("Failed to deallocate memory for receive ring",
+                           NERR_SEVERE, __FILE__, __LINE__);
+    }
+
+} /* MEM_Rx_Ring_Delete */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       MEM_Rx_Ring_Put
+*
+*   DESCRIPTION
+*
+*       This function passes a received packet to the stack.  If the
+*       device has a receive ring, the packet is placed on the ring;
+*       otherwise, it is placed on MEM_Rx_Driver_List.  Drivers must not
+*       place received packets on MEM_Buffer_List directly, since it is
+*       only protected by the stack semaphore.  The caller is responsible
+*       for setting the Buffers_Available event.
+*
+*   INPUTS
+*
+*       *device                 Pointer to the device the packet was
+*                               received on.
+*       *buf_ptr                Pointer to the head of the buffer chain.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The packet was queued.
+*       NU_NO_BUFFERS           The ring is full and the packet was
+*                               dropped.
+*
+*************************************************************************/
+STATUS MEM_Rx_Ring_Put(DV_DEVICE_ENTRY *device, NET_BUFFER *buf_ptr)
+{
+    MEM_RX_RING *ring = device->dev_rx_ring;
+    UINT32      tail;
+
+    NET_LAT_START(buf_ptr, NET_LAT_RX_QUEUE);
+
+    if (ring == NU_NULL)
+    {
+        MEM_Buffer_Enqueue(&MEM_Rx_Driver_List, buf_ptr);
+
+        return (NU_SUCCESS);
+    }
+
+    tail = ring->mrr_tail;
+
+    /* If the ring is full, drop the packet. */
+    if ((tail - ring->mrr_head) >= NET_RX_RING_SIZE)
+    {
+        ring->mrr_drops ++;
+
+        MEM_One_Buffer_Chain_Free(buf_ptr, &MEM_Buffer_Freelist);
+
+        return (NU_NO_BUFFERS);
+    }
+
+    buf_ptr->next = NU_NULL;
+
+    /* The slot must be written before the tail is advanced, since the
+     * consumer only reads slots below the tail.
+     */
+    ring->mrr_slots[tail & MEM_RX_RING_MASK] = buf_ptr;
+    ring->mrr_tail = tail + 1;
+
+    return (NU_SUCCESS);
+
+} /* MEM_Rx_Ring_Put */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       MEM_Rx_Ring_Service
+*
+*   DESCRIPTION
+*
+*       This function moves up to budget received packets from the next
+*       non-empty receive source to MEM_Buffer_List, where the input
+*       routines of the stack expect them.  The receive sources are the
+*       receive ring of each device and MEM_Rx_Driver_List, which holds
+*       the packets queued by drivers without a receive ring.  They are
+*       serviced round-robin, MEM_Rx_Driver_List first and then the rings
+*       in order of device index, starting after the source that was
+*       serviced last, so no source can starve another.  Packets are
+*       moved from a ring without an interrupt lockout, since
+*       MEM_Buffer_List is only accessed by tasks holding the stack
+*       semaphore, and from MEM_Rx_Driver_List under a single interrupt
+*       lockout.  The caller must hold the stack semaphore and
+*       MEM_Buffer_List must be empty.
+*
+*   INPUTS
+*
+*       budget                  The maximum number of packets to move.
+*
+*   OUTPUTS
+*
+*       The number of packets moved, 0 if there are none.
+*
+*************************************************************************/
+INT MEM_Rx_Ring_Service(INT budget)
+{
+    DV_DEVICE_ENTRY *dev_ptr;
+    DV_DEVICE_ENTRY *next_dev = NU_NULL;
+    DV_DEVICE_ENTRY *first_dev = NU_NULL;
+    MEM_RX_RING     *ring;
+    NET_BUFFER      *buf_ptr;
+    UINT32          head;
+    UINT32          pos;
+    UINT32          next_pos = 0;
+    UINT32          first_pos = 0;
+    INT             count = 0;
+    INT             old_level;
+
+    /* Find the non-empty source with the lowest position after the last
+     * one serviced, and the non-empty source with the lowest position
+     * overall in case the search has to wrap.
+     */
+    if (MEM_Rx_Driver_List.head)
+    {
+        first_pos = MEM_RX_DRIVER_LIST_POS;
+
+        if (MEM_RX_DRIVER_LIST_POS > MEM_Rx_Ring_Last_Pos)
+            next_pos = MEM_RX_DRIVER_LIST_POS;
+    }
+
+    for (dev_ptr = DEV_Table.dv_head;
+         dev_ptr != NU_NULL;
+         dev_ptr = dev_ptr->dev_next)
+    {
+        ring = dev_ptr->dev_rx_ring;
+
+        if ( (ring == NU_NULL) || (ring->mrr_head == ring->mrr_tail) )
+            continue;
+
+        pos = MEM_RX_RING_POS(dev_ptr);
+
+        if ( (first_pos == 0) || (pos < first_pos) )
+        {
+            first_dev = dev_ptr;
+            first_pos = pos;
+        }
+
+        if ( (pos > MEM_Rx_Ring_Last_Pos) &&
+             ((next_pos == 0) || (pos < next_pos)) )
+        {
+            next_dev = dev_ptr;
+            next_pos = pos;
+        }
+    }
+
+    if (next_pos == 0)
+    {
+        next_dev = first_dev;
+        next_pos = first_pos;
+    }
+
+    if (next_pos == 0)
+        return (0);
+
+    MEM_Rx_Ring_Last_Pos = next_pos;
+
+    if (next_dev == NU_NULL)
+    {
+        /*  Temporarily lockout interrupts to protect MEM_Rx_Driver_List. */
+        old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+        MEM_Buffer_List.head = MEM_Rx_Driver_List.head;
+
+        /* Find the last packet of this batch. */
+        for (buf_ptr = MEM_Rx_Driver_List.head, count = 1;
+             (count < budget) && (buf_ptr->next != NU_NULL);
+             buf_ptr = buf_ptr->next)
+            count ++;
+
+        MEM_Buffer_List.tail = buf_ptr;
+
+        MEM_Rx_Driver_List.head = buf_ptr->next;
+
+        if (MEM_Rx_Driver_List.head == NU_NULL)
+            MEM_Rx_Driver_List.tail = NU_NULL;
+
+        /*  Restore the previous interrupt lockout level.  */
+        NU_Local_Control_Interrupts(old_level);
+
+        buf_ptr->next = NU_NULL;
+
+        return (count);
+    }
+
+    ring = next_dev->dev_rx_ring;
+    head = ring->mrr_head;
+
+    /* Link the packets directly onto MEM_Buffer_List. */
+    while ( (count < budget) && (head != ring->mrr_tail) )
+    {
+        buf_ptr = ring->mrr_slots[head & MEM_RX_RING_MASK];
+
+        if (MEM_Buffer_List.tail)
+            MEM_Buffer_List.tail->next = buf_ptr;
+        else
+            MEM_Buffer_List.head = buf_ptr;
+
+        MEM_Buffer_List.tail = buf_ptr;
+
+        head ++;
+        count ++;
+    }
+
+    MEM_Buffer_List.tail->next = NU_NULL;
+
+    /* The slots must be read before the head is advanced, since the
+     * producer may reuse a slot as soon as it has been released.
+     */
+    ring->mrr_head = head;
+
+    return (count);
+
+} /* MEM_Rx_Ring_Service */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       MEM_Rx_Buffer_Alloc
+*
+*   DESCRIPTION
+*
+*       This function returns a buffer for a driver to receive into.  If
+*       the device has a receive ring, the buffer is taken from the ring's
+*       buffer cache, which is refilled from the buffer freelist
+*       NET_RX_BUFFER_CACHE_BATCH buffers at a time.  Otherwise, the
+*       buffer is taken from the freelist directly.  Only the driver may
+*       call this function.
+*
+*   INPUTS
+*
+*       *device                 Pointer to the device.
+*
+*   OUTPUTS
+*
+*       A pointer to the buffer, or NU_NULL if no buffers are available.
+*
+*************************************************************************/
+NET_BUFFER *MEM_Rx_Buffer_Alloc(DV_DEVICE_ENTRY *device)
+{
+    MEM_RX_RING *ring = device->dev_rx_ring;
+
+    if (ring == NU_NULL)
+        return (MEM_Buffer_Dequeue(&MEM_Buffer_Freelist));
+
+    if (ring->mrr_cache_count == 0)
+        ring->mrr_cache_count =
+            MEM_Buffer_Dequeue_Batch(ring->mrr_cache,
+                                     NET_RX_BUFFER_CACHE_BATCH);
+
+    if (ring->mrr_cache_count == 0)
+        return (NU_NULL);
+
+    ring->mrr_cache_count --;
+
+    return (ring->mrr_cache[ring->mrr_cache_count]);
+
+} /* MEM_Rx_Buffer_Alloc */
@@ -275,7 +275,7 @@ INT16 MIB2_Get_Next_Device_By_Index(UINT32 *index)
     INT16                   status = NU_SUCCESS;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -323,7 +323,7 @@ INT16 MIB2_Get_Next_Device_By_Index(UINT32 *index)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -460,7 +460,7 @@ UINT16 MIB2_Interface_Count(VOID)
     UINT16                  count = 0;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -481,7 +481,7 @@ UINT16 MIB2_Interface_Count(VOID)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -651,7 +651,7 @@ INT16 MIB2_Get_IfOutQLen(UINT32 index, UINT32 *length)
     INT16               status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -678,7 +678,7 @@ INT16 MIB2_Get_IfOutQLen(UINT32 index, UINT32 *length)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -776,7 +776,7 @@ INT16 MIB2_Get_IfOutErrors(UINT32 index, UINT32 *errors)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -800,7 +800,7 @@ INT16 MIB2_Get_IfOutErrors(UINT32 index, UINT32 *errors)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -914,7 +914,7 @@ INT16 MIB2_Get_IfOutDiscards(UINT32 index, UINT32 *discards)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -938,7 +938,7 @@ INT16 MIB2_Get_IfOutDiscards(UINT32 index, UINT32 *discards)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1049,7 +1049,7 @@ INT16 MIB2_Get_IfOutNUcastPkts(UINT32 index, UINT32 *packets)
     INT16                   status;
 
         /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1085,7 +1085,7 @@ INT16 MIB2_Get_IfOutNUcastPkts(UINT32 index, UINT32 *packets)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1262,7 +1262,7 @@ INT16 MIB2_Get_IfOutUcastPkts(UINT32 index, UINT32 *packets,
     INT16                   status = NU_SUCCESS;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1315,7 +1315,7 @@ INT16 MIB2_Get_IfOutUcastPkts(UINT32 index, UINT32 *packets,
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1515,7 +1515,7 @@ INT16 MIB2_Get_IfOutOctets(UINT32 index, UINT32 *octets,
     INT16                   status = NU_SUCCESS;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1564,7 +1564,7 @@ INT16 MIB2_Get_IfOutOctets(UINT32 index, UINT32 *octets,
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1763,7 +1763,7 @@ INT16 MIB2_Get_IfInUcastPkts(UINT32 index, UINT32 *packets,
     INT16                   status = NU_SUCCESS;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1814,7 +1814,7 @@ INT16 MIB2_Get_IfInUcastPkts(UINT32 index, UINT32 *packets,
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2005,7 +2005,7 @@ INT16 MIB2_Get_IfInNUcastPkts(UINT32 index, UINT32 *packets)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2041,7 +2041,7 @@ INT16 MIB2_Get_IfInNUcastPkts(UINT32 index, UINT32 *packets)
             status = MIB2_UNSUCCESSFUL;
 
             /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2137,7 +2137,7 @@ INT16 MIB2_Get_IfInUnknownProtos(UINT32 index, UINT32 *packets)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2162,7 +2162,7 @@ INT16 MIB2_Get_IfInUnknownProtos(UINT32 index, UINT32 *packets)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2276,7 +2276,7 @@ INT16 MIB2_Get_IfInErrors(UINT32 index, UINT32 *errors)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2301,7 +2301,7 @@ INT16 MIB2_Get_IfInErrors(UINT32 index, UINT32 *errors)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2414,7 +2414,7 @@ INT16 MIB2_Get_IfInDiscards(UINT32 index, UINT32 *discards)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2439,7 +2439,7 @@ INT16 MIB2_Get_IfInDiscards(UINT32 index, UINT32 *discards)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2555,7 +2555,7 @@ INT16 MIB2_Get_IfInOctets(UINT32 index, UINT32 *octets,
     INT16                   status = NU_SUCCESS;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2606,7 +2606,7 @@ INT16 MIB2_Get_IfInOctets(UINT32 index, UINT32 *octets,
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2796,7 +2796,7 @@ INT16 MIB2_Get_IfDescr(UINT32 index, UINT8 *string, UINT32 *length)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2823,7 +2823,7 @@ INT16 MIB2_Get_IfDescr(UINT32 index, UINT8 *string, UINT32 *length)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2930,7 +2930,7 @@ INT16 MIB2_Get_IfType(UINT32 index, INT32 *type)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2954,7 +2954,7 @@ INT16 MIB2_Get_IfType(UINT32 index, INT32 *type)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3044,7 +3044,7 @@ INT16 MIB2_Get_IfIndex(UINT32 index)
     INT16               status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3066,7 +3066,7 @@ INT16 MIB2_Get_IfIndex(UINT32 index)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3105,7 +3105,7 @@ INT16 MIB2_Get_Next_IfIndex_Ext(UINT32 *index)
     INT16                   status = MIB2_UNSUCCESSFUL;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3168,7 +3168,7 @@ INT16 MIB2_Get_Next_IfIndex_Ext(UINT32 *index)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3265,7 +3265,7 @@ INT16 MIB2_Get_IfLinkTrapEnable(UINT32 index, UINT32 *if_link_trap_enable)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3298,7 +3298,7 @@ INT16 MIB2_Get_IfLinkTrapEnable(UINT32 index, UINT32 *if_link_trap_enable)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3340,7 +3340,7 @@ INT16 MIB2_Set_IfLinkTrapEnable(UINT32 index, UINT32 if_link_trap_enable)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3371,7 +3371,7 @@ INT16 MIB2_Set_IfLinkTrapEnable(UINT32 index, UINT32 if_link_trap_enable)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3413,7 +3413,7 @@ INT16 MIB2_Get_IfHighSpeed(UINT32 index, UINT32 *if_high_speed)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3441,7 +3441,7 @@ INT16 MIB2_Get_IfHighSpeed(UINT32 index, UINT32 *if_high_speed)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3483,7 +3483,7 @@ INT16 MIB2_Get_IfConnectorPresent(UINT32 index, UINT32 *if_connector_present)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3514,7 +3514,7 @@ INT16 MIB2_Get_IfConnectorPresent(UINT32 index, UINT32 *if_connector_present)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3555,7 +3555,7 @@ INT16 MIB2_Get_IfAlias(UINT32 index, CHAR *if_alias)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3583,7 +3583,7 @@ INT16 MIB2_Get_IfAlias(UINT32 index, CHAR *if_alias)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3624,7 +3624,7 @@ INT16 MIB2_Set_IfAlias(UINT32 index, const CHAR *if_alias)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3652,7 +3652,7 @@ INT16 MIB2_Set_IfAlias(UINT32 index, const CHAR *if_alias)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3696,7 +3696,7 @@ INT16 MIB2_Get_IfCounterDiscontinTime(UINT32 index,
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3725,7 +3725,7 @@ INT16 MIB2_Get_IfCounterDiscontinTime(UINT32 index,
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3768,7 +3768,7 @@ INT16 MIB2_Get_IfaceIndex(const CHAR *name)
     INT16               index;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3823,7 +3823,7 @@ INT16 MIB2_Get_IfMtu(UINT32 index, UINT32 *octets)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3848,7 +3848,7 @@ INT16 MIB2_Get_IfMtu(UINT32 index, UINT32 *octets)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -3939,7 +3939,7 @@ INT16 MIB2_Get_IfSpeed(UINT32 index, UINT32 *speed)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -3963,7 +3963,7 @@ INT16 MIB2_Get_IfSpeed(UINT32 index, UINT32 *speed)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -4054,7 +4054,7 @@ INT16 MIB2_Get_IfLastChange(UINT32 index, UINT32 *time)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -4079,7 +4079,7 @@ INT16 MIB2_Get_IfLastChange(UINT32 index, UINT32 *time)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -4169,7 +4169,7 @@ INT16 MIB2_Get_IfStatusAdmin(UINT32 index, INT32 *state)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -4197,7 +4197,7 @@ INT16 MIB2_Get_IfStatusAdmin(UINT32 index, INT32 *state)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -4235,7 +4235,7 @@ INT16 MIB2_Set_IfStatusAdmin(UINT32 index, INT32 value)
     STATUS              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -4260,6 +4260,9 @@ INT16 MIB2_Set_IfStatusAdmin(UINT32 index, INT32 value)
                 /* Set the device as UP */
                 dev->dev_flags |= DV_UP;
 
+                /* Cached route lookups depend on the device and route state */
+                RTAB_Invalidate_Route_Cache();
+
                 status = NU_SUCCESS;
             }
 
@@ -4273,6 +4276,9 @@ INT16 MIB2_Set_IfStatusAdmin(UINT32 index, INT32 value)
                 /* Set the device as not UP */
                 dev->dev_flags &= (~DV_UP);
 
+                /* Cached route lookups depend on the device and route state */
+                RTAB_Invalidate_Route_Cache();
+
                 status = NU_SUCCESS;
             }
 
@@ -4286,7 +4292,7 @@ INT16 MIB2_Set_IfStatusAdmin(UINT32 index, INT32 value)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -4328,7 +4334,7 @@ INT16 MIB2_Get_IfStatusOper(UINT32 index, INT32 *state)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -4352,7 +4358,7 @@ INT16 MIB2_Get_IfStatusOper(UINT32 index, INT32 *state)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -4539,7 +4545,7 @@ INT16 MIB2_Get_IfAddr(UINT32 index, UINT8 *address, UINT32 *length)
     INT16               status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -4566,7 +4572,7 @@ INT16 MIB2_Get_IfAddr(UINT32 index, UINT8 *address, UINT32 *length)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -4657,7 +4663,7 @@ INT16 MIB2_Get_IfChannel(UINT32 index, VOID **channel)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -4681,7 +4687,7 @@ INT16 MIB2_Get_IfChannel(UINT32 index, VOID **channel)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -4721,7 +4727,7 @@ INT16 MIB2_Set_IfChannel(UINT32 index, VOID *channel)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -4745,7 +4751,7 @@ INT16 MIB2_Set_IfChannel(UINT32 index, VOID *channel)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -4785,7 +4791,7 @@ INT16 MIB2_Get_IfHostControl(UINT32 index, VOID **hostcontrol)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -4809,7 +4815,7 @@ INT16 MIB2_Get_IfHostControl(UINT32 index, VOID **hostcontrol)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -4849,7 +4855,7 @@ INT16 MIB2_Set_IfHostControl(UINT32 index, VOID *hostcontrol)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -4873,7 +4879,7 @@ INT16 MIB2_Set_IfHostControl(UINT32 index, VOID *hostcontrol)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -4913,7 +4919,7 @@ INT16 MIB2_Get_IfMatrixControl(UINT32 index, VOID **matrixcontrol)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -4937,7 +4943,7 @@ INT16 MIB2_Get_IfMatrixControl(UINT32 index, VOID **matrixcontrol)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -4976,7 +4982,7 @@ INT16 MIB2_Set_IfMatrixControl(UINT32 index, VOID *matrixcontrol)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -5000,7 +5006,7 @@ INT16 MIB2_Set_IfMatrixControl(UINT32 index, VOID *matrixcontrol)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -5040,7 +5046,7 @@ INT16 MIB2_Get_IfFrameId(UINT32 index, UINT32 *frameid)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -5064,7 +5070,7 @@ INT16 MIB2_Get_IfFrameId(UINT32 index, UINT32 *frameid)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -5103,7 +5109,7 @@ INT16 MIB2_Inc_IfFrameId(UINT32 index)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -5131,7 +5137,7 @@ INT16 MIB2_Inc_IfFrameId(UINT32 index)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -5204,7 +5210,7 @@ INT16 MIB2_Get_IfInBrdcastPkts(UINT32 index, UINT32 *packets,
     INT16                   status = NU_SUCCESS;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -5245,7 +5251,7 @@ INT16 MIB2_Get_IfInBrdcastPkts(UINT32 index, UINT32 *packets,
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -5412,7 +5418,7 @@ INT16 MIB2_Get_IfOutBrdcastPkts(UINT32 index, UINT32 *packets,
     INT16                   status = NU_SUCCESS;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -5453,7 +5459,7 @@ INT16 MIB2_Get_IfOutBrdcastPkts(UINT32 index, UINT32 *packets,
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -5620,7 +5626,7 @@ INT16 MIB2_Get_IfInMulticastPkts(UINT32 index, UINT32 *packets,
     INT16                   status = NU_SUCCESS;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -5661,7 +5667,7 @@ INT16 MIB2_Get_IfInMulticastPkts(UINT32 index, UINT32 *packets,
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -5827,7 +5833,7 @@ INT16 MIB2_Get_IfOutMulticastPkts(UINT32 index, UINT32 *packets,
     INT16                   status = NU_SUCCESS;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -5868,7 +5874,7 @@ INT16 MIB2_Get_IfOutMulticastPkts(UINT32 index, UINT32 *packets,
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -6032,7 +6038,7 @@ INT16 MIB2_Get_IfPromiscMode(UINT32 index, UINT32 *mode)
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -6075,7 +6081,7 @@ INT16 MIB2_Get_IfPromiscMode(UINT32 index, UINT32 *mode)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
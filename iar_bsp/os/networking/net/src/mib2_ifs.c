@@ -1158,7 +1158,7 @@ INT16 MIB2_Get_IfStack(UINT32 higher_if_index, UINT32 lower_if_index)
     INT16                       status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1182,7 +1182,7 @@ INT16 MIB2_Get_IfStack(UINT32 higher_if_index, UINT32 lower_if_index)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1223,7 +1223,7 @@ INT16 MIB2_Get_Next_IfStack(UINT32 *higher_if_index, UINT32 *lower_if_index)
     INT16                       status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1266,7 +1266,7 @@ INT16 MIB2_Get_Next_IfStack(UINT32 *higher_if_index, UINT32 *lower_if_index)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1310,7 +1310,7 @@ INT16 MIB2_Get_IfStack_Row_Status(UINT32 higher_if_index,
     INT16                   status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1342,7 +1342,7 @@ INT16 MIB2_Get_IfStack_Row_Status(UINT32 higher_if_index,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
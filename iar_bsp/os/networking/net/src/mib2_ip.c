@@ -123,7 +123,7 @@ INT16 MIB2_Get_IpAdEntAddr(UINT8 *addr, UINT8 *dev_addr, UINT8 getflag)
     INT16               status = NU_SUCCESS;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -158,7 +158,7 @@ INT16 MIB2_Get_IpAdEntAddr(UINT8 *addr, UINT8 *dev_addr, UINT8 getflag)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -200,7 +200,7 @@ INT16 MIB2_Get_IpAdEntNetMask(UINT8 *addr, UINT8 *net_mask, UINT8 getflag)
     INT16               status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -238,7 +238,7 @@ INT16 MIB2_Get_IpAdEntNetMask(UINT8 *addr, UINT8 *net_mask, UINT8 getflag)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -282,7 +282,7 @@ INT16 MIB2_Get_IpAdEntIfIndex(UINT8 *addr, UINT32 *dev_index,
     UINT8               target_addr[IP_ADDR_LEN];
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -320,7 +320,7 @@ INT16 MIB2_Get_IpAdEntIfIndex(UINT8 *addr, UINT32 *dev_index,
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -458,7 +458,7 @@ INT16 MIB2_Get_IpRouteAge(UINT8 *addr, UINT32 *age, UINT8 getflag)
     INT16           status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -484,7 +484,7 @@ INT16 MIB2_Get_IpRouteAge(UINT8 *addr, UINT32 *age, UINT8 getflag)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -576,7 +576,7 @@ INT16 MIB2_Get_IpRouteDest(UINT8 *addr, UINT8 *dest, UINT8 getflag)
     INT16           status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -600,7 +600,7 @@ INT16 MIB2_Get_IpRouteDest(UINT8 *addr, UINT8 *dest, UINT8 getflag)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -691,7 +691,7 @@ INT16 MIB2_Get_IpRouteIfIndex(UINT8 *addr, UINT32 *dev_index,
     INT16           status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -715,7 +715,7 @@ INT16 MIB2_Get_IpRouteIfIndex(UINT8 *addr, UINT32 *dev_index,
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -810,7 +810,7 @@ INT16 MIB2_Get_IpRouteMetric1(UINT8 *addr, UINT32 *metric1, UINT8 getflag)
     INT16           status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -834,7 +834,7 @@ INT16 MIB2_Get_IpRouteMetric1(UINT8 *addr, UINT32 *metric1, UINT8 getflag)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -923,7 +923,7 @@ INT16 MIB2_Get_IpRouteNextHop(UINT8 *addr, UINT8 *nexthop, UINT8 getflag)
     INT16               status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -947,7 +947,7 @@ INT16 MIB2_Get_IpRouteNextHop(UINT8 *addr, UINT8 *nexthop, UINT8 getflag)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1036,7 +1036,7 @@ INT16 MIB2_Get_IpRouteType(UINT8 *addr, UINT32 *type, UINT8 getflag)
     INT16           status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1064,7 +1064,7 @@ INT16 MIB2_Get_IpRouteType(UINT8 *addr, UINT32 *type, UINT8 getflag)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1179,7 +1179,7 @@ INT16 MIB2_Get_IpRouteProto(UINT8 *addr, UINT32 *proto, UINT8 getflag)
     INT16           status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1211,7 +1211,7 @@ INT16 MIB2_Get_IpRouteProto(UINT8 *addr, UINT32 *proto, UINT8 getflag)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1251,7 +1251,7 @@ INT16 MIB2_Get_IpRouteMask(UINT8 *addr, UINT8 *mask, UINT8 getflag)
     INT16           status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1275,7 +1275,7 @@ INT16 MIB2_Get_IpRouteMask(UINT8 *addr, UINT8 *mask, UINT8 getflag)
             status = MIB2_UNSUCCESSFUL;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
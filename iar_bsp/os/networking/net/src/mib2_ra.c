@@ -95,7 +95,7 @@ INT16 MIB2_Get_If_Address(UINT32 if_index, const UINT8 *recv_addr)
     NET_MULTI               *recv_addr_entry;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -156,7 +156,7 @@ INT16 MIB2_Get_If_Address(UINT32 if_index, const UINT8 *recv_addr)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -205,7 +205,7 @@ INT16 MIB2_Get_Next_If_Address(UINT32 *if_index, UINT8 *recv_addr)
     UINT8                   temp_recv_addr[MIB2_MAX_PADDRSIZE];
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -339,7 +339,7 @@ INT16 MIB2_Get_Next_If_Address(UINT32 *if_index, UINT8 *recv_addr)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -122,7 +122,7 @@ UINT32 MIB2_Get_1757Octets(UINT32 index)
     UINT32                  octets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -141,7 +141,7 @@ UINT32 MIB2_Get_1757Octets(UINT32 index)
             octets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -229,7 +229,7 @@ UINT32 MIB2_Get_1757Pkts(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -251,7 +251,7 @@ UINT32 MIB2_Get_1757Pkts(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -339,7 +339,7 @@ UINT32 MIB2_Get_1757BroadcastPkts(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -358,7 +358,7 @@ UINT32 MIB2_Get_1757BroadcastPkts(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -447,7 +447,7 @@ UINT32 MIB2_Get_1757MulticastPkts(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -466,7 +466,7 @@ UINT32 MIB2_Get_1757MulticastPkts(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -555,7 +555,7 @@ UINT32 MIB2_Get_1757CRCAlignErrors(UINT32 index)
     UINT32                  errors;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -574,7 +574,7 @@ UINT32 MIB2_Get_1757CRCAlignErrors(UINT32 index)
             errors = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -663,7 +663,7 @@ UINT32 MIB2_Get_1757UndersizePkts(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -682,7 +682,7 @@ UINT32 MIB2_Get_1757UndersizePkts(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -771,7 +771,7 @@ UINT32 MIB2_Get_1757OversizePkts(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -790,7 +790,7 @@ UINT32 MIB2_Get_1757OversizePkts(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -878,7 +878,7 @@ UINT32 MIB2_Get_1757Fragments(UINT32 index)
     UINT32                  fragments;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -897,7 +897,7 @@ UINT32 MIB2_Get_1757Fragments(UINT32 index)
             fragments = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -985,7 +985,7 @@ UINT32 MIB2_Get_1757Jabbers(UINT32 index)
     UINT32                  jabbers;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1004,7 +1004,7 @@ UINT32 MIB2_Get_1757Jabbers(UINT32 index)
             jabbers = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1092,7 +1092,7 @@ UINT32 MIB2_Get_1757Collisions(UINT32 index)
     UINT32                  collisions;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1111,7 +1111,7 @@ UINT32 MIB2_Get_1757Collisions(UINT32 index)
             collisions = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1200,7 +1200,7 @@ UINT32 MIB2_Get_1757Pkts64Octets(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1219,7 +1219,7 @@ UINT32 MIB2_Get_1757Pkts64Octets(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1307,7 +1307,7 @@ UINT32 MIB2_Get_1757Pkts65to127Octets(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1326,7 +1326,7 @@ UINT32 MIB2_Get_1757Pkts65to127Octets(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1415,7 +1415,7 @@ UINT32 MIB2_Get_1757Pkts128to255Octets(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1434,7 +1434,7 @@ UINT32 MIB2_Get_1757Pkts128to255Octets(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1523,7 +1523,7 @@ UINT32 MIB2_Get_1757Pkts256to511Octets(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1542,7 +1542,7 @@ UINT32 MIB2_Get_1757Pkts256to511Octets(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1631,7 +1631,7 @@ UINT32 MIB2_Get_1757Pkts512to1023Octets(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1650,7 +1650,7 @@ UINT32 MIB2_Get_1757Pkts512to1023Octets(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1739,7 +1739,7 @@ UINT32 MIB2_Get_1757Pkts1024to1518Octets(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1758,7 +1758,7 @@ UINT32 MIB2_Get_1757Pkts1024to1518Octets(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1847,7 +1847,7 @@ UINT32 MIB2_Get_1757LostPkts(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1866,7 +1866,7 @@ UINT32 MIB2_Get_1757LostPkts(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1954,7 +1954,7 @@ UINT32 MIB2_Get_1757DiscardedPkts(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1973,7 +1973,7 @@ UINT32 MIB2_Get_1757DiscardedPkts(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2062,7 +2062,7 @@ UINT32 MIB2_Get_1757OutPkts(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2081,7 +2081,7 @@ UINT32 MIB2_Get_1757OutPkts(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2169,7 +2169,7 @@ UINT32 MIB2_Get_1757OutOctets(UINT32 index)
     UINT32                  octets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2188,7 +2188,7 @@ UINT32 MIB2_Get_1757OutOctets(UINT32 index)
             octets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2277,7 +2277,7 @@ UINT32 MIB2_Get_1757OutMulticastPkts(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2296,7 +2296,7 @@ UINT32 MIB2_Get_1757OutMulticastPkts(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2386,7 +2386,7 @@ UINT32 MIB2_Get_1757OutBroadcastPkts(UINT32 index)
     UINT32                  packets;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2405,7 +2405,7 @@ UINT32 MIB2_Get_1757OutBroadcastPkts(UINT32 index)
             packets = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -2494,7 +2494,7 @@ UINT32 MIB2_Get_1757OutErrors(UINT32 index)
     UINT32                  errors;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -2513,7 +2513,7 @@ UINT32 MIB2_Get_1757OutErrors(UINT32 index)
             errors = 0;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
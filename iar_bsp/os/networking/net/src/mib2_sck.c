@@ -108,7 +108,7 @@ STATUS MIB2_Socket_List_Information(INT protocol, UINT8 getflag,
     /* Obtain Semaphore, so that changes are not made while looking through
      * the table
      */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -252,7 +252,7 @@ STATUS MIB2_Socket_List_Information(INT protocol, UINT8 getflag,
     }
 
     /* release the semaphores because list traversing is over */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -291,7 +291,7 @@ UINT32 MIB2_SizeUdpTab(VOID)
     STATUS      status;
 
     /* Grab the semaphore and traverse the socket list */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -308,7 +308,7 @@ UINT32 MIB2_SizeUdpTab(VOID)
         }
 
         /* Release the semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -197,7 +197,7 @@ STATUS NU_Init_Net(const NU_NET_INIT_DATA *init_struct)
          * ensure that no task is kicked off before the corresponding globals
          * have been created and initialized.
          */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_NO_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_NO_SUSPEND);
 
         if (status == NU_SUCCESS)
         {
@@ -208,7 +208,7 @@ STATUS NU_Init_Net(const NU_NET_INIT_DATA *init_struct)
             status = NET_Init_Net(init_struct);
 
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
         }
@@ -384,6 +384,11 @@ STATIC STATUS NET_Init_Net(const NU_NET_INIT_DATA *init_struct)
         return (status);
     }
 
+#if (INCLUDE_NET_LATENCY_TRACE == NU_TRUE)
+    /* Start the counter used to time packets through the stack. */
+    NET_Lat_Init();
+#endif
+
 #if (INCLUDE_STATIC_BUILD == NU_FALSE)
     /* Create Event Queue Dispatcher task.  The Events Dispatcher handles
      * all events set internally by the stack.
@@ -659,14 +664,57 @@ VOID NET_Demux(UNSIGNED argc, VOID *argv)
     for (;;)
     {
         /* Grab the stack semaphore before processing packets. */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         /* Verify that resource was available */
         if (status == NU_SUCCESS)
         {
+            /* Defer the wake-ups of tasks receiving on sockets until the
+             * packets have been processed, so a task receiving a burst is
+             * resumed once instead of preempting NET_Demux per packet only
+             * to suspend on the stack semaphore.
+             */
+            SCK_Start_Wake_Batch();
+
             /* Process all of the packets which came in */
-            while (MEM_Buffer_List.head)
+            for (;;)
             {
+                /* If a task is waiting to use the stack, let it run before
+                 * processing the next packet instead of holding it off
+                 * until the whole list has been drained.
+                 */
+                if (NET_Stack_Lock_Waiters != 0)
+                {
+                    NET_Stack_Lock_Stats.nls_demux_yields ++;
+
+                    SCK_Flush_Wake_Batch();
+
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
+                    {
+                        NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
+                                       __FILE__, __LINE__);
+
+                        NET_DBG_Notify(NU_INVALID_SEMAPHORE, __FILE__, __LINE__,
+                                       NU_Current_Task_Pointer(), NU_NULL);
+                    }
+
+                    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
+
+                    if (status != NU_SUCCESS)
+                        break;
+
+                    SCK_Start_Wake_Batch();
+                }
+
+                /* Once the packets on MEM_Buffer_List have been processed,
+                 * move the next batch of packets from the receive rings
+                 * and MEM_Rx_Driver_List to MEM_Buffer_List, where the
+                 * input routines expect them.
+                 */
+                if ( (MEM_Buffer_List.head == NU_NULL) &&
+                     (MEM_Rx_Ring_Service(NET_DEMUX_DEVICE_BUDGET) == 0) )
+                    break;
+
 #if (INCLUDE_IPSEC == NU_TRUE)
                 /* Ensure the receive count is reset. This count indicates
                  * the number of SA's applied to the current packet being
@@ -678,22 +726,30 @@ VOID NET_Demux(UNSIGNED argc, VOID *argv)
                 /* Point to the device on which this packet was received. */
                 device = MEM_Buffer_List.head->mem_buf_device;
 
+                NET_LAT_STAMP(MEM_Buffer_List.head, NET_LAT_RX_QUEUE,
+                              NET_LAT_DEMUX);
+
                 /* Call the receive function for that device. */
                 (*(device->dev_input))();
             }
 
             /* Let other tasks use the stack. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (status == NU_SUCCESS)
             {
-                NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
-                               __FILE__, __LINE__);
+                SCK_Flush_Wake_Batch();
+
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
+                {
+                    NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
+                                   __FILE__, __LINE__);
 
-                NET_DBG_Notify(NU_INVALID_SEMAPHORE, __FILE__, __LINE__,
-                               NU_Current_Task_Pointer(), NU_NULL);
+                    NET_DBG_Notify(NU_INVALID_SEMAPHORE, __FILE__, __LINE__,
+                                   NU_Current_Task_Pointer(), NU_NULL);
+                }
             }
         }
 
-        else
+        if (status != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
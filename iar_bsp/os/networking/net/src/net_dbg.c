@@ -266,6 +266,18 @@ STATUS NET_DBG_Count_Buffers(NET_DEBUG_BUFFER_INFO_STRUCT *debug_struct)
             status = temp_status;
     }
 
+    /* Count the number of buffers queued by drivers without a receive
+     * ring.
+     */
+    if (MEM_Rx_Driver_List.head)
+    {
+        unp_count += NET_DBG_Validate_Buffs(&MEM_Rx_Driver_List, &temp_status,
+                                            NET_DBG_NO_ACTION, 0);
+
+        if ( (temp_status != NU_SUCCESS) && (status == NU_SUCCESS) )
+            status = temp_status;
+    }
+
 #if ( (INCLUDE_IP_REASSEMBLY == NU_TRUE) && (INCLUDE_IPV4 == NU_TRUE) )
 
     /* Count the number of buffers awaiting reassembly */
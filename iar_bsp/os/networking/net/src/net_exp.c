@@ -63,6 +63,10 @@ NU_EXPORT_SYMBOL(NU_DNS_Build_Key);
 NU_EXPORT_SYMBOL(NU_DNS_Parse_Key);
 NU_EXPORT_SYMBOL(NU_Ethernet_Link_Down);
 NU_EXPORT_SYMBOL(NU_Ethernet_Link_Up);
+NU_EXPORT_SYMBOL(NU_Event_Set_Create);
+NU_EXPORT_SYMBOL(NU_Event_Set_Delete);
+NU_EXPORT_SYMBOL(NU_Event_Set_Control);
+NU_EXPORT_SYMBOL(NU_Event_Set_Wait);
 NU_EXPORT_SYMBOL(NU_Fcntl);
 NU_EXPORT_SYMBOL(NU_FD_Check);
 NU_EXPORT_SYMBOL(NU_FD_Init);
@@ -87,6 +91,7 @@ NU_EXPORT_SYMBOL(NU_Get_Peer_Name);
 NU_EXPORT_SYMBOL(NU_Get_PMTU);
 NU_EXPORT_SYMBOL(NU_Get_Reasm_Max_Size);
 NU_EXPORT_SYMBOL(NU_Get_Sock_Name);
+NU_EXPORT_SYMBOL(NU_Get_Stack_Lock_Stats);
 NU_EXPORT_SYMBOL(NU_Getsockopt);
 NU_EXPORT_SYMBOL(NU_Getsockopt_IP_HDRINCL);
 NU_EXPORT_SYMBOL(NU_Getsockopt_IP_RECVIFADDR);
@@ -141,12 +146,19 @@ NU_EXPORT_SYMBOL(NU_Push);
 NU_EXPORT_SYMBOL(NU_Recv);
 NU_EXPORT_SYMBOL(NU_Recvmsg);
 NU_EXPORT_SYMBOL(NU_Recv_From);
+NU_EXPORT_SYMBOL(NU_Recv_From_Multiple);
 NU_EXPORT_SYMBOL(NU_Recv_From_Raw);
+NU_EXPORT_SYMBOL(NU_Recv_Ring_Register);
+NU_EXPORT_SYMBOL(NU_Recv_Ring_Unregister);
 NU_EXPORT_SYMBOL(NU_Remove_Device);
 NU_EXPORT_SYMBOL(NU_Remove_IP_From_Device);
 NU_EXPORT_SYMBOL(NU_Send);
 NU_EXPORT_SYMBOL(NU_Sendmsg);
+#ifdef CFG_NU_OS_STOR_FILE_VFS_ENABLE
+NU_EXPORT_SYMBOL(NU_Send_File);
+#endif
 NU_EXPORT_SYMBOL(NU_Send_To);
+NU_EXPORT_SYMBOL(NU_Send_To_Multiple);
 NU_EXPORT_SYMBOL(NU_Send_To_Raw);
 NU_EXPORT_SYMBOL(NU_Set_Device_Hostname);
 NU_EXPORT_SYMBOL(SCK_Set_Domain_Name);              /* NU_Set_Domain_Name maps to this. */
@@ -0,0 +1,277 @@
+/*************************************************************************
+*
+*              Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+
+/*************************************************************************
+*
+*   FILENAME
+*
+*       net_lat.c
+*
+*   DESCRIPTION
+*
+*       This file contains the packet path latency statistics.  When
+*       INCLUDE_NET_LATENCY_TRACE is enabled, each packet is timestamped
+*       with the cycle counter as it enters a stage of the packet path
+*       (see net_lat.h), and the time it spent in the previous stage is
+*       counted in the histogram of that stage.
+*
+*       Packets are timed in the driver receive routines and the transmit
+*       complete path as well as under the stack semaphore, so the
+*       statistics are updated with interrupts locked out.
+*
+*   DATA STRUCTURES
+*
+*       NET_Lat_Stages[]
+*
+*   FUNCTIONS
+*
+*       NET_Lat_Init
+*       NET_Lat_Stamp
+*       NET_Lat_Get_Stage
+*       NET_Lat_Reset
+*       NET_Lat_Trace
+*
+*   DEPENDENCIES
+*
+*       nu_net.h
+*
+*************************************************************************/
+
+#include "networking/nu_net.h"
+#include "services/nu_trace_os_mark.h"
+
+#if (INCLUDE_NET_LATENCY_TRACE == NU_TRUE)
+
+/* The latency statistics of each stage of the packet path. */
+STATIC NET_LAT_STAGE    NET_Lat_Stages[NET_LAT_STAGES];
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NET_Lat_Init
+*
+*   DESCRIPTION
+*
+*       This function starts the cycle counter and clears the latency
+*       statistics.
+*
+*   INPUTS
+*
+*       None.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID NET_Lat_Init(VOID)
+{
+#ifdef ESAL_AR_CYCLE_COUNT_ENABLE
+    ESAL_AR_CYCLE_COUNT_ENABLE();
+#endif
+
+    NET_Lat_Reset();
+
+} /* NET_Lat_Init */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NET_Lat_Stamp
+*
+*   DESCRIPTION
+*
+*       This function counts the time a packet spent in a stage of the
+*       packet path in the histogram of that stage, and marks the packet
+*       as entering the next stage.  If the packet was not marked as
+*       entering the stage, for instance because it was queued by a
+*       driver that does not timestamp packets, nothing is counted.
+*
+*   INPUTS
+*
+*       *buf_ptr                Pointer to the packet.
+*       stage                   The stage the packet is leaving.
+*       next_stage              The stage the packet is entering, or
+*                               NET_LAT_NONE if it is leaving the stack.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID NET_Lat_Stamp(NET_BUFFER *buf_ptr, UINT8 stage, UINT8 next_stage)
+{
+    NET_LAT_STAGE   *stage_ptr;
+    UINT32          now = NET_LAT_TIMESTAMP();
+    UINT32          cycles;
+    UINT32          value;
+    INT             bucket;
+    INT             shift;
+    INT             old_level;
+
+    if (buf_ptr->mem_lat_stage == stage)
+    {
+        stage_ptr = &NET_Lat_Stages[stage];
+
+        /* The counter is free-running, so the unsigned difference is the
+           elapsed time as long as the packet spent less than one period
+           of the counter in the stage. */
+        cycles = now - buf_ptr->mem_lat_stamp;
+
+        /* Find the most significant bit of the latency by halving the
+           range that holds it. */
+        value = cycles;
+        bucket = 0;
+
+        for (shift = NET_LAT_BUCKETS / 2; shift != 0; shift >>= 1)
+        {
+            if (value >> shift)
+            {
+                value >>= shift;
+                bucket += shift;
+            }
+        }
+
+        old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+        if ( (stage_ptr->nls_count == 0) || (cycles < stage_ptr->nls_min) )
+            stage_ptr->nls_min = cycles;
+
+        if (cycles > stage_ptr->nls_max)
+            stage_ptr->nls_max = cycles;
+
+        stage_ptr->nls_count++;
+        stage_ptr->nls_total += cycles;
+        stage_ptr->nls_buckets[bucket]++;
+
+        NU_Local_Control_Interrupts(old_level);
+    }
+
+    buf_ptr->mem_lat_stamp = now;
+    buf_ptr->mem_lat_stage = next_stage;
+
+} /* NET_Lat_Stamp */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NET_Lat_Get_Stage
+*
+*   DESCRIPTION
+*
+*       This function returns a copy of the latency statistics of a stage
+*       of the packet path.  Latencies are in cycles of the counter.
+*
+*   INPUTS
+*
+*       stage                   The stage (see net_lat.h).
+*       *stage_ptr              Set to the statistics of the stage.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The statistics were returned.
+*       NU_INVALID_PARM         stage is not a valid stage or stage_ptr
+*                               is NU_NULL.
+*
+*************************************************************************/
+STATUS NET_Lat_Get_Stage(INT stage, NET_LAT_STAGE *stage_ptr)
+{
+    INT     old_level;
+
+    if ( (stage < 0) || (stage >= NET_LAT_STAGES) || (stage_ptr == NU_NULL) )
+        return (NU_INVALID_PARM);
+
+    old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+    memcpy(stage_ptr, &NET_Lat_Stages[stage], sizeof(NET_LAT_STAGE));
+
+    NU_Local_Control_Interrupts(old_level);
+
+    return (NU_SUCCESS);
+
+} /* NET_Lat_Get_Stage */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NET_Lat_Reset
+*
+*   DESCRIPTION
+*
+*       This function clears the latency statistics of all stages.
+*
+*   INPUTS
+*
+*       None.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID NET_Lat_Reset(VOID)
+{
+    INT     old_level;
+
+    old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+    UTL_Zero(NET_Lat_Stages, sizeof(NET_Lat_Stages));
+
+    NU_Local_Control_Interrupts(old_level);
+
+} /* NET_Lat_Reset */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NET_Lat_Trace
+*
+*   DESCRIPTION
+*
+*       This function logs the histogram of each stage to the trace
+*       service.  One event is logged for each bucket that holds at
+*       least one packet.
+*
+*   INPUTS
+*
+*       None.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID NET_Lat_Trace(VOID)
+{
+    NET_LAT_STAGE   stats;
+    INT             stage;
+    INT             bucket;
+
+    for (stage = 0; stage < NET_LAT_STAGES; stage++)
+    {
+        if (NET_Lat_Get_Stage(stage, &stats) != NU_SUCCESS)
+            continue;
+
+        for (bucket = 0; bucket < NET_LAT_BUCKETS; bucket++)
+        {
+            if (stats.nls_buckets[bucket] != 0)
+                T_NET_LAT_HIST(stage, bucket, stats.nls_buckets[bucket]);
+        }
+    }
+
+} /* NET_Lat_Trace */
+
+#endif /* INCLUDE_NET_LATENCY_TRACE == NU_TRUE */
@@ -0,0 +1,209 @@
+/*************************************************************************
+*
+*              Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+
+/*************************************************************************
+*
+*   FILE NAME
+*
+*       net_lk.c
+*
+*   COMPONENT
+*
+*       Net - Stack Lock
+*
+*   DESCRIPTION
+*
+*       This file contains the routines used to obtain and release the
+*       stack semaphore, TCP_Resource, while accounting for contention
+*       on it.  See tcpdefs.h for the lock ordering rules of the stack.
+*
+*   DATA STRUCTURES
+*
+*       NET_Stack_Lock_Stats
+*       NET_Stack_Lock_Waiters
+*
+*   FUNCTIONS
+*
+*       NET_Obtain_Stack_Lock
+*       NET_Release_Stack_Lock
+*       NU_Get_Stack_Lock_Stats
+*
+*   DEPENDENCIES
+*
+*       nu_net.h
+*
+*************************************************************************/
+
+#include "networking/nu_net.h"
+
+/* Contention statistics for TCP_Resource. */
+NET_LOCK_STATS  NET_Stack_Lock_Stats;
+
+/* The number of tasks currently suspended in NET_Obtain_Stack_Lock.
+ * This is modified with interrupts disabled since it is updated by
+ * tasks that do not own the semaphore.
+ */
+UNSIGNED        NET_Stack_Lock_Waiters;
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NET_Obtain_Stack_Lock
+*
+*   DESCRIPTION
+*
+*       This function obtains the stack semaphore.  If the semaphore is
+*       owned by another task, the contention is counted and the caller
+*       is suspended according to the suspend parameter.
+*
+*   INPUTS
+*
+*       suspend                 NU_SUSPEND, NU_NO_SUSPEND or a timeout
+*                               value in ticks.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The semaphore was obtained.
+*       NU_UNAVAILABLE          The semaphore is not available.
+*       NU_TIMEOUT              The semaphore was not obtained before
+*                               the timeout expired.
+*       Otherwise, the status returned by NU_Obtain_Semaphore.
+*
+*************************************************************************/
+STATUS NET_Obtain_Stack_Lock(UNSIGNED suspend)
+{
+    STATUS      status;
+    INT         old_level;
+
+    /* Try to obtain the semaphore without suspending first so the
+     * uncontended case can be distinguished.
+     */
+    status = NU_Obtain_Semaphore(&TCP_Resource, NU_NO_SUSPEND);
+
+    if ( (status == NU_UNAVAILABLE) && (suspend != NU_NO_SUSPEND) )
+    {
+        old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+        NET_Stack_Lock_Stats.nls_contended ++;
+        NET_Stack_Lock_Waiters ++;
+
+        if (NET_Stack_Lock_Waiters > NET_Stack_Lock_Stats.nls_max_waiters)
+            NET_Stack_Lock_Stats.nls_max_waiters = NET_Stack_Lock_Waiters;
+
+        NU_Local_Control_Interrupts(old_level);
+
+        status = NU_Obtain_Semaphore(&TCP_Resource, suspend);
+
+        old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+        NET_Stack_Lock_Waiters --;
+
+        NU_Local_Control_Interrupts(old_level);
+    }
+
+    /* The semaphore protects the remaining statistics. */
+    if (status == NU_SUCCESS)
+        NET_Stack_Lock_Stats.nls_obtains ++;
+
+    return (status);
+
+} /* NET_Obtain_Stack_Lock */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NET_Release_Stack_Lock
+*
+*   DESCRIPTION
+*
+*       This function releases the stack semaphore.
+*
+*   INPUTS
+*
+*       None.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The semaphore was released.
+*       Otherwise, the status returned by NU_Release_Semaphore.
+*
+*************************************************************************/
+STATUS NET_Release_Stack_Lock(VOID)
+{
+    return (NU_Release_Semaphore(&TCP_Resource));
+
+} /* NET_Release_Stack_Lock */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_Get_Stack_Lock_Stats
+*
+*   DESCRIPTION
+*
+*       This function returns the contention statistics of the stack
+*       semaphore, and optionally clears them.
+*
+*   INPUTS
+*
+*       *stats                  Pointer to the structure to fill in.
+*       reset                   NU_TRUE to clear the statistics after
+*                               they have been copied.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The statistics were returned.
+*       NU_INVALID_PARM         stats is NU_NULL.
+*
+*************************************************************************/
+STATUS NU_Get_Stack_Lock_Stats(NET_LOCK_STATS *stats, INT reset)
+{
+    STATUS      status;
+
+    NU_SUPERV_USER_VARIABLES
+
+#if (INCLUDE_NET_API_ERR_CHECK == NU_TRUE)
+
+    if (stats == NU_NULL)
+        return (NU_INVALID_PARM);
+
+#endif
+
+    /* Switch to supervisor mode. */
+    NU_SUPERVISOR_MODE();
+
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
+
+    if (status == NU_SUCCESS)
+    {
+        memcpy(stats, &NET_Stack_Lock_Stats, sizeof(NET_LOCK_STATS));
+
+        if (reset == NU_TRUE)
+            UTL_Zero(&NET_Stack_Lock_Stats, sizeof(NET_LOCK_STATS));
+
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
+            NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
+                           __FILE__, __LINE__);
+    }
+
+    else
+        NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
+                       __FILE__, __LINE__);
+
+    /* Switch back to user mode. */
+    NU_USER_MODE();
+
+    return (status);
+
+} /* NU_Get_Stack_Lock_Stats */
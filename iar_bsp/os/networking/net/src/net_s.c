@@ -68,7 +68,7 @@ VOID NET_Sleep(UINT32 ticks)
     task_ptr = NU_Current_Task_Pointer();
 
     /* Obtain the TCP semaphore to protect the stack global variables */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -76,7 +76,7 @@ VOID NET_Sleep(UINT32 ticks)
 		status = TQ_Timerset(NET_Resume_Event, (UNSIGNED)task_ptr, ticks, 0);
 
 		/* Release the semaphore. */
-		if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+		if (NET_Release_Stack_Lock() != NU_SUCCESS)
 			NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
 						   __FILE__, __LINE__);
 
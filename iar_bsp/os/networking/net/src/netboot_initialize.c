@@ -1341,7 +1341,7 @@ STATUS NU_Ethernet_Link_Up(CHAR *dev_name)
             /* Clear the address information. */
             memset(ip_addr, 0, MAX_ADDRESS_SIZE);
 
-            local_status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+            local_status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
             if (local_status == NU_SUCCESS)
             {
@@ -1365,7 +1365,7 @@ STATUS NU_Ethernet_Link_Up(CHAR *dev_name)
                     local_status = -1;
                 }
 
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 {
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
@@ -1395,7 +1395,7 @@ STATUS NU_Ethernet_Link_Up(CHAR *dev_name)
             /* Is the interface configured to use DHCP? */
             if (NU_Ifconfig_Get_DHCP6_Enabled(dev_name) == NU_TRUE)
             {
-                local_status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                local_status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
                 if (local_status == NU_SUCCESS)
                 {
@@ -1411,7 +1411,7 @@ STATUS NU_Ethernet_Link_Up(CHAR *dev_name)
                                 NERR_SEVERE, __FILE__, __LINE__);
                     }
 
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     {
                         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                        __FILE__, __LINE__);
@@ -1524,7 +1524,7 @@ STATIC STATUS NETBOOT_Wait_For_LinkLocal_Addr(CHAR *dev_name, UINT8 *addr)
     DV_DEVICE_ENTRY     *dev_ptr = NU_NULL;
     DEV6_IF_ADDRESS     *dev_addr = NU_NULL;
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -1550,7 +1550,7 @@ STATIC STATUS NETBOOT_Wait_For_LinkLocal_Addr(CHAR *dev_name, UINT8 *addr)
                      */
                     while (dev_addr->dev6_addr_state & DV6_TENTATIVE)
                     {
-                        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                        if (NET_Release_Stack_Lock() != NU_SUCCESS)
                         {
                             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                            __FILE__, __LINE__);
@@ -1558,7 +1558,7 @@ STATIC STATUS NETBOOT_Wait_For_LinkLocal_Addr(CHAR *dev_name, UINT8 *addr)
 
                         NU_Sleep(1 * TICKS_PER_SECOND);
 
-                        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
                         if (status != NU_SUCCESS)
                         {
@@ -1590,7 +1590,7 @@ STATIC STATUS NETBOOT_Wait_For_LinkLocal_Addr(CHAR *dev_name, UINT8 *addr)
             status = -1;
         }
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -1654,7 +1654,7 @@ STATUS NU_Ethernet_Link_Down(CHAR *dev_name)
        This requires obtaining the semaphore. */
     if (status == NU_SUCCESS)
     {
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (status == NU_SUCCESS)
         {
@@ -1681,7 +1681,7 @@ STATUS NU_Ethernet_Link_Down(CHAR *dev_name)
                                __FILE__, __LINE__);
             }
 
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
         }
@@ -1706,7 +1706,7 @@ STATUS NU_Ethernet_Link_Down(CHAR *dev_name)
 #endif /* CFG_NU_OS_NET_STACK_INCLUDE_DHCP */
 
         /* We must grab the NET semaphore */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (status == NU_SUCCESS)
         {
@@ -1730,7 +1730,7 @@ STATUS NU_Ethernet_Link_Down(CHAR *dev_name)
 #endif /* CFG_NU_OS_NET_STACK_INCLUDE_DHCP6 */
 
             /* Release the semaphore */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                             __FILE__, __LINE__);
         }
@@ -1800,14 +1800,14 @@ STATUS NU_Test_Link_Up(CHAR *dev_name, UINT32 *state)
        This requires obtaining the semaphore. */
     if (status == NU_SUCCESS)
     {
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_NO_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_NO_SUSPEND);
 
         if (status == NU_SUCCESS)
         {
             /* Get the device by name */
             dev_ptr = DEV_Get_Dev_By_Name(dev_name);
 
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
 
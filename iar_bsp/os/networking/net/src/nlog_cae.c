@@ -75,7 +75,7 @@ STATUS NLOG_Clear_All_Errors(VOID)
     NU_SUPERVISOR_MODE();
 
     /* allocate the TCP/IP resource for blocking during this time */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -87,7 +87,7 @@ STATUS NLOG_Clear_All_Errors(VOID)
         NLOG_Internal_Error++;
 
         /* deallocate the TCP/IP resource */
-        status = NU_Release_Semaphore(&TCP_Resource);
+        status = NET_Release_Stack_Lock();
 
         NU_USER_MODE();
     }
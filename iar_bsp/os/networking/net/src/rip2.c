@@ -863,7 +863,7 @@ STATIC INT RIP2_Update_Table(RIP2_LIST_NODE *node, RIP2_PACKET *rpkt,
 #endif
 
     /* Grab the semaphore so we can get a pointer to the device */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Look up the device */
         dev_ptr = DEV_Get_Dev_By_Index(node->r2_device.rip2_dev_index);
@@ -887,7 +887,7 @@ STATIC INT RIP2_Update_Table(RIP2_LIST_NODE *node, RIP2_PACKET *rpkt,
         else
         {
             /* Release the TCP semaphore */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
 
@@ -905,7 +905,7 @@ STATIC INT RIP2_Update_Table(RIP2_LIST_NODE *node, RIP2_PACKET *rpkt,
         }
 
         /* Release the TCP semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1672,7 +1672,7 @@ STATIC INT16 RIP2_IsFromMe(UINT32 dev_index, const struct addr_struct *addr)
 #endif
 
     /* Grab the semaphore so we can get a pointer to the device */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Look up the device the user wishes to use RIP with. */
         dev_ptr = DEV_Get_Dev_By_Index(dev_index);
@@ -1688,7 +1688,7 @@ STATIC INT16 RIP2_IsFromMe(UINT32 dev_index, const struct addr_struct *addr)
             status = 0;
 
         /* Release the TCP semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1741,7 +1741,7 @@ STATIC RIP2_LIST_NODE *RIP2_Find_Entry(const UINT8 *addr)
 #endif
 
     /* Grab the semaphore so we can get a pointer to the device */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Unable to obtain TCP semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -1813,7 +1813,7 @@ STATIC RIP2_LIST_NODE *RIP2_Find_Entry(const UINT8 *addr)
     }
 
     /* Release the TCP semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -2399,7 +2399,7 @@ STATIC VOID RIP2_Broadcast(INT16 flags)
             continue;
 
         /* Grab the semaphore so we can get a pointer to the device */
-        if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+        if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
         {
             NLOG_Error_Log("Unable to obtain TCP semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -2424,7 +2424,7 @@ STATIC VOID RIP2_Broadcast(INT16 flags)
             else
             {
                 /* Release the TCP semaphore */
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
 
@@ -2435,7 +2435,7 @@ STATIC VOID RIP2_Broadcast(INT16 flags)
         else
         {
             /* Release the TCP semaphore */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
 
@@ -2483,7 +2483,7 @@ STATIC VOID RIP2_Broadcast(INT16 flags)
                       | (~dev_ptr->dev_addr.dev_netmask));
 
                 /* Release the TCP semaphore */
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
 
@@ -2503,7 +2503,7 @@ STATIC VOID RIP2_Broadcast(INT16 flags)
                       dev_ptr->dev_addr.dev_dst_ip_addr);
 
                 /* Release the TCP semaphore */
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
             }
@@ -2515,7 +2515,7 @@ STATIC VOID RIP2_Broadcast(INT16 flags)
         else
         {
             /* Release the TCP semaphore */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
 
@@ -2599,8 +2599,7 @@ STATIC VOID RIP2_Send_Routes(const RIP2_LIST_NODE *node, INT16 flags,
     }
 
     /* Grab the semaphore so we can get a pointer to the device */
-    if (NU_Obtain_Semaphore(&TCP_Resource,
-                            NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Unable to obtain TCP semaphore",
                        NERR_SEVERE, __FILE__, __LINE__);
@@ -2635,7 +2634,7 @@ STATIC VOID RIP2_Send_Routes(const RIP2_LIST_NODE *node, INT16 flags,
                        NERR_RECOVERABLE, __FILE__, __LINE__);
 
         /* Release the TCP semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -2643,7 +2642,7 @@ STATIC VOID RIP2_Send_Routes(const RIP2_LIST_NODE *node, INT16 flags,
     }
 
     /* Release the TCP semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -2887,7 +2886,7 @@ STATIC VOID RIP2_Request_Routing_Table(RIP2_LIST_NODE *node)
         rp->unused = 0;
 
         /* Grab the semaphore so we can get a pointer to the device */
-        if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+        if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
         {
             NLOG_Error_Log("Unable to obtain TCP semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -2912,7 +2911,7 @@ STATIC VOID RIP2_Request_Routing_Table(RIP2_LIST_NODE *node)
             else
             {
                 /* Release the TCP semaphore */
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
 
@@ -2923,7 +2922,7 @@ STATIC VOID RIP2_Request_Routing_Table(RIP2_LIST_NODE *node)
         else
         {
             /* Release the TCP semaphore */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
 
@@ -2963,7 +2962,7 @@ STATIC VOID RIP2_Request_Routing_Table(RIP2_LIST_NODE *node)
                       | (~dev_ptr->dev_addr.dev_netmask));
 
                 /* Release the TCP semaphore */
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
 
@@ -2983,7 +2982,7 @@ STATIC VOID RIP2_Request_Routing_Table(RIP2_LIST_NODE *node)
                       dev_ptr->dev_addr.dev_dst_ip_addr);
 
                 /* Release the TCP semaphore */
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                    __FILE__, __LINE__);
             }
@@ -2995,7 +2994,7 @@ STATIC VOID RIP2_Request_Routing_Table(RIP2_LIST_NODE *node)
         else
         {
             /* Release the TCP semaphore */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
 
@@ -404,6 +404,9 @@ INT RTAB4_Insert_Route_Entry(ROUTE_NODE *r, const ROUTE_NODE *n)
         {
             current_route->rt_entry_parms.rt_parm_flags |= RT_UP;
 
+            /* Cached route lookups depend on the device and route state */
+            RTAB_Invalidate_Route_Cache();
+
             /* Set the status to NU_SUCCESS since the application layer
              * expects that this route was previously deleted.
              */
@@ -76,6 +76,9 @@ STATUS RTAB4_Delete_Node(ROUTE_NODE *rt_node)
 {
     STATUS  status;
 
+    /* Do not return this route from the route cache */
+    RTAB_Invalidate_Route_Cache();
+
     /* If the node to delete is the Default Route */
     if (rt_node == RTAB4_Default_Route)
     {
@@ -26,12 +26,14 @@
 *
 *   DATA STRUCTURES
 *
-*       None
+*       RTAB4_Route_Cache
 *
 *   FUNCTIONS
 *
 *       RTAB4_Find_Route
 *       RTAB4_Determine_Matching_Prefix
+*       RTAB4_Find_Cached_Route
+*       RTAB4_Cache_Route
 *
 *   DEPENDENCIES
 *
@@ -47,6 +49,19 @@ extern ROUTE_NODE   *RTAB4_Default_Route;
 
 extern RTAB_ROUTE_PARMS RTAB4_Parms;
 
+#if (RTAB4_ROUTE_CACHE_SIZE > 0)
+
+/* Small direct-mapped cache of the most recent lookup results.  Each
+ * entry is only valid while its generation matches RTAB_Route_Generation,
+ * which is bumped on every change to the routing table.
+ */
+static RTAB4_ROUTE_CACHE_ENTRY  RTAB4_Route_Cache[RTAB4_ROUTE_CACHE_SIZE];
+
+STATIC RTAB4_ROUTE_ENTRY *RTAB4_Find_Cached_Route(UINT32, INT32);
+STATIC VOID RTAB4_Cache_Route(UINT32, INT32, RTAB4_ROUTE_ENTRY *);
+
+#endif
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -74,6 +89,19 @@ RTAB4_ROUTE_ENTRY *RTAB4_Find_Route(const SCK_SOCKADDR_IP *de, INT32 flags)
     UINT8               target_address[IP_ADDR_LEN];
     RTAB4_ROUTE_ENTRY   *rt_entry;
 
+#if (RTAB4_ROUTE_CACHE_SIZE > 0)
+    /* Check if the same lookup has been done since the last change to
+     * the routing table.
+     */
+    rt_entry = RTAB4_Find_Cached_Route(de->sck_addr, flags);
+
+    if (rt_entry)
+    {
+        rt_entry->rt_entry_parms.rt_parm_refcnt ++;
+        return (rt_entry);
+    }
+#endif
+
     PUT32(target_address, 0, de->sck_addr);
 
     rt_entry =
@@ -91,6 +119,11 @@ RTAB4_ROUTE_ENTRY *RTAB4_Find_Route(const SCK_SOCKADDR_IP *de, INT32 flags)
         rt_entry->rt_entry_parms.rt_parm_refcnt ++;
     }
 
+#if (RTAB4_ROUTE_CACHE_SIZE > 0)
+    if (rt_entry)
+        RTAB4_Cache_Route(de->sck_addr, flags, rt_entry);
+#endif
+
     return (rt_entry);
 
 } /* RTAB4_Find_Route */
@@ -134,4 +167,100 @@ UINT8 RTAB4_Determine_Matching_Prefix(const UINT8 *target_address,
 
 } /* RTAB4_Determine_Matching_Prefix */
 
+#if (RTAB4_ROUTE_CACHE_SIZE > 0)
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       RTAB4_Find_Cached_Route
+*
+*   DESCRIPTION
+*
+*       This function returns the route found by a previous lookup for
+*       the same destination and flags, provided the routing table has
+*       not changed since and the route is still usable.  The reference
+*       count of the route is not incremented.
+*
+*   INPUTS
+*
+*       dest                    The destination IP address.
+*       flags                   Flags passed to RTAB4_Find_Route.
+*
+*   OUTPUTS
+*
+*       *RTAB4_ROUTE_ENTRY      A pointer to the cached route
+*       NU_NULL                 No valid cached route exists
+*
+*************************************************************************/
+STATIC RTAB4_ROUTE_ENTRY *RTAB4_Find_Cached_Route(UINT32 dest, INT32 flags)
+{
+    RTAB4_ROUTE_CACHE_ENTRY *rc_entry;
+    RTAB4_ROUTE_ENTRY       *rt_entry;
+
+    rc_entry = &RTAB4_Route_Cache[RTAB4_ROUTE_CACHE_INDEX(dest)];
+
+    if ( (rc_entry->rc_route == NU_NULL) ||
+         (rc_entry->rc_generation != RTAB_Route_Generation) ||
+         (rc_entry->rc_dest != dest) || (rc_entry->rc_flags != flags) )
+        return (NU_NULL);
+
+    rt_entry = rc_entry->rc_route;
+
+    /* The state of the route or device may have changed without the
+     * table itself changing.  Apply the same checks as the full lookup.
+     */
+    if ( ((rt_entry->rt_entry_parms.rt_parm_metric != RT_INFINITY) ||
+          (flags & RT_OVERRIDE_METRIC)) &&
+         ((rt_entry->rt_entry_parms.rt_parm_flags & RT_UP) ||
+          (flags & RT_OVERRIDE_RT_STATE)) &&
+         ((rt_entry->rt_entry_parms.rt_parm_device->dev_flags & DV_UP) ||
+          (flags & RT_OVERRIDE_DV_STATE)) )
+        return (rt_entry);
+
+    /* Invalidate the entry so the next lookup repopulates it */
+    rc_entry->rc_route = NU_NULL;
+
+    return (NU_NULL);
+
+} /* RTAB4_Find_Cached_Route */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       RTAB4_Cache_Route
+*
+*   DESCRIPTION
+*
+*       This function saves the result of a route lookup in the route
+*       cache, replacing any entry previously stored in the same slot.
+*
+*   INPUTS
+*
+*       dest                    The destination IP address.
+*       flags                   Flags passed to RTAB4_Find_Route.
+*       *rt_entry               The route found for the destination.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID RTAB4_Cache_Route(UINT32 dest, INT32 flags,
+                              RTAB4_ROUTE_ENTRY *rt_entry)
+{
+    RTAB4_ROUTE_CACHE_ENTRY *rc_entry;
+
+    rc_entry = &RTAB4_Route_Cache[RTAB4_ROUTE_CACHE_INDEX(dest)];
+
+    rc_entry->rc_dest = dest;
+    rc_entry->rc_flags = flags;
+    rc_entry->rc_generation = RTAB_Route_Generation;
+    rc_entry->rc_route = rt_entry;
+
+} /* RTAB4_Cache_Route */
+
+#endif
+
 #endif
@@ -209,6 +209,8 @@ VOID RTAB4_Redirect(UINT32 dst, UINT32 gateway, INT32 flags, UINT32 src)
                             /* Modify the existing route. */
                             rt_entry->rt_entry_parms.rt_parm_flags |= RT_MODIFIED;
                             rt_entry->rt_gateway_v4.sck_addr = gateway;
+
+                            RTAB_Invalidate_Route_Cache();
                         }
                     }
 
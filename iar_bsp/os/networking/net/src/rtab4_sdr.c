@@ -154,6 +154,9 @@ STATUS RTAB4_Set_Default_Route(DV_DEVICE_ENTRY *device, UINT32 gw,
 
     rt_entry = RTAB4_Default_Route->rt_list_head;
 
+    /* The default route is changing; discard cached lookup results */
+    RTAB_Invalidate_Route_Cache();
+
     rt_entry->rt_entry_parms.rt_parm_flags    = (INT16)(flags | RT_UP | RT_GATEWAY);
     rt_entry->rt_entry_parms.rt_parm_refcnt   = 0;
     rt_entry->rt_entry_parms.rt_parm_metric   = 1;
@@ -421,6 +421,9 @@ STATUS RTAB4_Update_Route(const UINT8 *ip_address, const UINT8 *gateway,
     }
 #endif
 
+    /* The metric, gateway or state of the route may have changed */
+    RTAB_Invalidate_Route_Cache();
+
     return (status);
 
 } /* RTAB4_Update_Route */
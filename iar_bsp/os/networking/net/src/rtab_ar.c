@@ -80,6 +80,9 @@ STATUS RTAB_Insert_Node(const ROUTE_NODE *n, const RTAB_ROUTE_PARMS *rt_parms)
     ROUTE_NODE      *new_node, *compare_node, *closest_node;
     UINT8           direction;
 
+    /* Any cached lookup results may no longer be the best match */
+    RTAB_Invalidate_Route_Cache();
+
     /* Do not add route with an invalid metric. */
     if (((ROUTE_ENTRY*)(n->rt_list_head))->rt_entry_parms.rt_parm_metric >=
         RT_INFINITY)
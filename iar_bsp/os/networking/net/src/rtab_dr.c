@@ -153,6 +153,9 @@ STATUS RTAB_Delete_Route_Entry(ROUTE_NODE *route_node,
     UINT8           gateway[IP_ADDR_LEN];
 #endif
 
+    /* Do not return this route from the route cache */
+    RTAB_Invalidate_Route_Cache();
+
     /* If the reference count is still not zero, there is some other
      * process using the route.  Flag it as down so it is deleted
      * when that process frees the route.
@@ -26,7 +26,7 @@
 *
 *   DATA STRUCTURES
 *
-*       None
+*       RTAB_Route_Generation
 *
 *   FUNCTIONS
 *
@@ -41,6 +41,9 @@
 
 #include "networking/nu_net.h"
 
+/* Incremented each time a route is added, removed or modified. */
+UINT32  RTAB_Route_Generation = 1;
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -24,12 +24,19 @@
 *
 *       next_socket_no
 *       *SCK_Sockets[]
+*       SCK_Wake_Batch[]
 *
 *   FUNCTIONS
 *
 *       SCK_Create_Socket
 *       SCK_Suspend_Task
 *       SCK_Resume_All
+*       SCK_Defer_Wake
+*       SCK_Notify_Events
+*       SCK_Resume_Receiver
+*       SCK_Start_Wake_Batch
+*       SCK_Flush_Wake_Batch
+*       SCK_Cancel_Wake
 *       SCK_Clear_Socket_Error
 *
 *   DEPENDENCIES
@@ -51,6 +58,15 @@ INT next_socket_no;
    Nucleus NET. Sockets are required for all TCP/UDP/IPRaw connections. */
 struct sock_struct *SCK_Sockets[NSOCKETS];
 
+#if (NET_DEMUX_WAKE_BATCH_SIZE > 0)
+/* Event set notifications and receive wake-ups deferred while NET_Demux
+   processes a batch of packets.  These are only accessed while the stack
+   semaphore is held. */
+STATIC SCK_WAKE_ENTRY   SCK_Wake_Batch[NET_DEMUX_WAKE_BATCH_SIZE];
+STATIC INT              SCK_Wake_Batch_Count;
+STATIC INT              SCK_Wake_Batch_Active;
+#endif
+
 #if (INCLUDE_STATIC_BUILD == NU_TRUE)
 /* Declare memory for all sockets */
 SOCKET_STRUCT NET_Socket_Memory[NSOCKETS];
@@ -209,13 +225,13 @@ VOID SCK_Suspend_Task(NU_TASK *task_id)
 
     old_preempt = NU_Change_Preemption(NU_NO_PREEMPT);
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
     NU_Suspend_Task(task_id);
 
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
         NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -278,6 +294,306 @@ VOID SCK_Resume_All(struct SCK_TASK_ENT *list, INT flags)
 
 } /* SCK_Resume_All */
 
+/************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Defer_Wake
+*
+*   DESCRIPTION
+*
+*       This function defers the event set notification and receive
+*       wake-ups for a socket until the end of the batch of packets
+*       NET_Demux is processing.  Consecutive deferrals for the same
+*       socket are coalesced into one entry.
+*
+*   INPUTS
+*
+*       socketd                 The socket descriptor.
+*       events                  The events to report to an event set the
+*                               socket is in.
+*       count                   The number of receive wake-ups to defer.
+*
+*   OUTPUTS
+*
+*       NU_TRUE                 The wake-ups were deferred.
+*       NU_FALSE                No batch is active or the batch is full;
+*                               the caller must wake the socket now.
+*
+*************************************************************************/
+#if (NET_DEMUX_WAKE_BATCH_SIZE > 0)
+STATIC INT SCK_Defer_Wake(INT socketd, UINT16 events, UINT16 count)
+{
+    INT     i;
+
+    if (!SCK_Wake_Batch_Active)
+        return (NU_FALSE);
+
+    /* Look for a wake-up already deferred for this socket. */
+    for (i = 0; i < SCK_Wake_Batch_Count; i++)
+    {
+        if (SCK_Wake_Batch[i].swe_socketd == socketd)
+        {
+            SCK_Wake_Batch[i].swe_events |= events;
+            SCK_Wake_Batch[i].swe_count += count;
+            return (NU_TRUE);
+        }
+    }
+
+    if (SCK_Wake_Batch_Count < NET_DEMUX_WAKE_BATCH_SIZE)
+    {
+        SCK_Wake_Batch[i].swe_socketd = socketd;
+        SCK_Wake_Batch[i].swe_events = events;
+        SCK_Wake_Batch[i].swe_count = count;
+
+        SCK_Wake_Batch_Count ++;
+
+        return (NU_TRUE);
+    }
+
+    /* The batch is full. */
+    return (NU_FALSE);
+
+} /* SCK_Defer_Wake */
+#endif
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Notify_Events
+*
+*   DESCRIPTION
+*
+*       This function reports a possible change in the state of a socket
+*       to the event set the socket is in.  While NET_Demux is processing
+*       a batch of packets, the notification is deferred until the end of
+*       the batch along with the receive wake-ups.  The caller must hold
+*       the stack semaphore.
+*
+*   INPUTS
+*
+*       socketd                 The socket descriptor.
+*       events                  The events that may have occurred.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID SCK_Notify_Events(INT socketd, UINT16 events)
+{
+    struct sock_struct  *sockptr = SCK_Sockets[socketd];
+
+    /* Only a socket in an event set is notified. */
+    if (sockptr->s_evs_entry == NU_NULL)
+        return;
+
+#if (NET_DEMUX_WAKE_BATCH_SIZE > 0)
+    if (SCK_Defer_Wake(socketd, events, 0) == NU_TRUE)
+        return;
+#endif
+
+    EVS_Notify(sockptr, events);
+
+} /* SCK_Notify_Events */
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Resume_Receiver
+*
+*   DESCRIPTION
+*
+*       This function reports data appended to the receive list of a
+*       socket to the event set the socket is in, and resumes a task
+*       suspended on receive for the socket.  While NET_Demux is
+*       processing a batch of packets, both are deferred until the end
+*       of the batch, and the wake-ups for consecutive packets to the
+*       same socket are coalesced into one entry.
+*
+*   INPUTS
+*
+*       socketd                 The socket descriptor.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID SCK_Resume_Receiver(INT socketd)
+{
+    struct sock_struct  *sockptr = SCK_Sockets[socketd];
+    struct SCK_TASK_ENT *task_entry_ptr;
+
+    /* If nothing is waiting for data on the socket, there is nothing
+     * to do.
+     */
+    if ( (sockptr->s_evs_entry == NU_NULL) &&
+         (sockptr->s_RXTask_List.flink == NU_NULL) )
+        return;
+
+#if (NET_DEMUX_WAKE_BATCH_SIZE > 0)
+    if (SCK_Defer_Wake(socketd, NU_EVS_READABLE, 1) == NU_TRUE)
+        return;
+#endif
+
+    /* Report the data to an event set the socket is in. */
+    EVS_Notify(sockptr, NU_EVS_READABLE);
+
+    if (sockptr->s_RXTask_List.flink == NU_NULL)
+        return;
+
+    /* Get the task to resume off the list */
+    task_entry_ptr = DLL_Dequeue(&sockptr->s_RXTask_List);
+
+    /* Resume the task pending on a receive */
+    if (NU_Resume_Task(task_entry_ptr->task) != NU_SUCCESS)
+    {
+        NLOG_Error_Log("Failed to resume task", NERR_SEVERE,
+                       __FILE__, __LINE__);
+
+        NET_DBG_Notify(NU_INVALID_TASK, __FILE__, __LINE__,
+                       NU_Current_Task_Pointer(), NU_NULL);
+    }
+
+} /* SCK_Resume_Receiver */
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Start_Wake_Batch
+*
+*   DESCRIPTION
+*
+*       This function starts deferring the event set notifications and
+*       receive wake-ups issued through SCK_Notify_Events and
+*       SCK_Resume_Receiver.  The caller must hold the stack
+*       semaphore, and must call SCK_Flush_Wake_Batch before releasing
+*       it.
+*
+*   INPUTS
+*
+*       None.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID SCK_Start_Wake_Batch(VOID)
+{
+#if (NET_DEMUX_WAKE_BATCH_SIZE > 0)
+    SCK_Wake_Batch_Active = NU_TRUE;
+#endif
+
+} /* SCK_Start_Wake_Batch */
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Flush_Wake_Batch
+*
+*   DESCRIPTION
+*
+*       This function reports the deferred events to the event sets of
+*       the sockets, resumes the tasks whose receive wake-ups were
+*       deferred, one task per packet appended to the socket, and stops
+*       deferring wake-ups.  A socket that was closed or reused during
+*       the batch is skipped.
+*
+*   INPUTS
+*
+*       None.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID SCK_Flush_Wake_Batch(VOID)
+{
+#if (NET_DEMUX_WAKE_BATCH_SIZE > 0)
+    struct sock_struct  *sockptr;
+    struct SCK_TASK_ENT *task_entry_ptr;
+    INT                 i;
+
+    for (i = 0; i < SCK_Wake_Batch_Count; i++)
+    {
+        sockptr = SCK_Sockets[SCK_Wake_Batch[i].swe_socketd];
+
+        if (SCK_Wake_Batch[i].swe_events != 0)
+            EVS_Notify(sockptr, SCK_Wake_Batch[i].swe_events);
+
+        while ( (SCK_Wake_Batch[i].swe_count > 0) &&
+                (sockptr->s_RXTask_List.flink != NU_NULL) )
+        {
+            SCK_Wake_Batch[i].swe_count --;
+
+            task_entry_ptr = DLL_Dequeue(&sockptr->s_RXTask_List);
+
+            if (NU_Resume_Task(task_entry_ptr->task) != NU_SUCCESS)
+                NLOG_Error_Log("Failed to resume task", NERR_SEVERE,
+                               __FILE__, __LINE__);
+        }
+    }
+
+    SCK_Wake_Batch_Count = 0;
+    SCK_Wake_Batch_Active = NU_FALSE;
+#endif
+
+} /* SCK_Flush_Wake_Batch */
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Cancel_Wake
+*
+*   DESCRIPTION
+*
+*       This function removes the deferred wake-ups of a socket from the
+*       batch.  It must be called before the socket is deallocated, so
+*       the wake-ups are not delivered to a socket created later with
+*       the same descriptor.  The caller must hold the stack semaphore.
+*
+*   INPUTS
+*
+*       socketd                 The socket descriptor.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID SCK_Cancel_Wake(INT socketd)
+{
+#if (NET_DEMUX_WAKE_BATCH_SIZE > 0)
+    INT     i;
+
+    for (i = 0; i < SCK_Wake_Batch_Count; i++)
+    {
+        if (SCK_Wake_Batch[i].swe_socketd == socketd)
+        {
+            /* The order of the entries does not matter, so fill the
+             * hole with the last entry.
+             */
+            SCK_Wake_Batch_Count --;
+
+            SCK_Wake_Batch[i] = SCK_Wake_Batch[SCK_Wake_Batch_Count];
+
+            break;
+        }
+    }
+#else
+    UNUSED_PARAMETER(socketd);
+#endif
+
+} /* SCK_Cancel_Wake */
+
 /************************************************************************
 *
 *   FUNCTION
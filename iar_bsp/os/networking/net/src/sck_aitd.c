@@ -86,7 +86,7 @@ STATUS NU_Attach_IP_To_Device(const CHAR *name, UINT8 *ip_addr,
     NU_SUPERVISOR_MODE();
 
      /* Get the Nucleus NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -139,7 +139,7 @@ STATUS NU_Attach_IP_To_Device(const CHAR *name, UINT8 *ip_addr,
     }
 
     /* Release the TCP semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
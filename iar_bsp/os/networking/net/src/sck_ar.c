@@ -98,7 +98,7 @@ STATUS NU_Add_Route(const UINT8 *ip_dest, const UINT8 *mask,
     dest->sck_len = sizeof (*dest);
     dest->sck_addr = IP_ADDR (gw_addr);
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -118,7 +118,7 @@ STATUS NU_Add_Route(const UINT8 *ip_dest, const UINT8 *mask,
      */
     if (route.rt_route == NU_NULL)
     {
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -165,7 +165,7 @@ STATUS NU_Add_Route(const UINT8 *ip_dest, const UINT8 *mask,
                                  IP_ADDR(gw_addr), flags);
     }
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
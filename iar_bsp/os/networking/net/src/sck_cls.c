@@ -205,6 +205,15 @@ VOID SCK_Cleanup_Socket(INT socketd)
 #endif
 #endif
 
+    /* Remove the socket from its event set. */
+    EVS_Remove_Socket(sockptr);
+
+    /* Drop the wake-ups deferred for the socket. */
+    SCK_Cancel_Wake(socketd);
+
+    /* Release the receive ring of the socket. */
+    SCK_Rx_Ring_Delete(sockptr);
+
 #if (INCLUDE_STATIC_BUILD == NU_FALSE)
     /* release the memory used by this socket */
     if (NU_Deallocate_Memory(sockptr) != NU_SUCCESS)
@@ -216,7 +216,7 @@ STATUS NU_DNS_SD_Register_Service(INT action, CHAR *name, CHAR *type,
                  */
                 if ( (srv_ptr == NU_NULL) && (status == NU_SUCCESS) )
                 {
-                    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+                    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
                     if (status == NU_SUCCESS)
                     {
@@ -256,7 +256,7 @@ STATUS NU_DNS_SD_Register_Service(INT action, CHAR *name, CHAR *type,
                         }
 
                         /* Release the TCP semaphore */
-                        NU_Release_Semaphore(&TCP_Resource);
+                        NET_Release_Stack_Lock();
                     }
                 }
 
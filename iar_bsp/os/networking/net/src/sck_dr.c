@@ -78,7 +78,7 @@ STATUS NU_Delete_Route2(const UINT8 *ip_dest, const UINT8 *next_hop,
     UNUSED_PARAMETER(family);
 #endif
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -104,7 +104,7 @@ STATUS NU_Delete_Route2(const UINT8 *ip_dest, const UINT8 *next_hop,
 
 #endif
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -0,0 +1,811 @@
+/*************************************************************************
+*
+*              Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+
+/*************************************************************************
+*
+*   FILENAME
+*
+*       sck_evs.c
+*
+*   DESCRIPTION
+*
+*       This file contains the event set services.  An event set is a
+*       persistent set of sockets an application waits on for them to
+*       become readable or writable.  Unlike NU_Select, the sockets are
+*       registered once, and the stack places a socket on the ready list
+*       of its set when the state of the socket changes.  Waiting on the
+*       set only examines the sockets on the ready list.
+*
+*       By default a socket is reported for as long as it is ready
+*       (level-triggered).  If NU_EVS_EDGE is included in its events, it
+*       is reported once each time the stack notifies a change of its
+*       state (edge-triggered).
+*
+*   DATA STRUCTURES
+*
+*       EVS_Sets[]
+*       EVS_Next_Struct_Id
+*
+*   FUNCTIONS
+*
+*       NU_Event_Set_Create
+*       NU_Event_Set_Delete
+*       NU_Event_Set_Control
+*       NU_Event_Set_Wait
+*       EVS_Notify
+*       EVS_Remove_Socket
+*       EVS_Socket_Ready
+*       EVS_Get_Set
+*
+*   DEPENDENCIES
+*
+*       nu_net.h
+*
+*************************************************************************/
+
+#include "networking/nu_net.h"
+
+/* The event sets that have been created.  Access to these is protected
+   by the stack semaphore. */
+STATIC EVS_SET  *EVS_Sets[NET_MAX_EVENT_SETS];
+
+/* The identifier given to the next event set created.  Each set gets a
+   different identifier, so a task that was waiting on a set can tell
+   that it was deleted and its descriptor reused by a new set. */
+STATIC UINT32   EVS_Next_Struct_Id;
+
+STATIC UINT16   EVS_Socket_Ready(const struct sock_struct *, UINT16);
+STATIC EVS_SET  *EVS_Get_Set(INT);
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_Event_Set_Create
+*
+*   DESCRIPTION
+*
+*       This function creates an empty event set.
+*
+*   INPUTS
+*
+*       None.
+*
+*   OUTPUTS
+*
+*       The descriptor of the new event set, or one of the following
+*       negative values:
+*
+*       NU_NO_SOCKET_SPACE      NET_MAX_EVENT_SETS event sets already
+*                               exist.
+*       NU_NO_MEMORY            Memory for the event set could not be
+*                               allocated.
+*
+*************************************************************************/
+INT NU_Event_Set_Create(VOID)
+{
+    INT         setd;
+    INT         return_status;
+    EVS_SET     *set_ptr;
+
+    NU_SUPERV_USER_VARIABLES
+
+    /* Switch to supervisor mode. */
+    NU_SUPERVISOR_MODE();
+
+    return_status = NET_Obtain_Stack_Lock(NU_SUSPEND);
+
+    if (return_status == NU_SUCCESS)
+    {
+        for (setd = 0; setd < NET_MAX_EVENT_SETS; setd++)
+        {
+            if (EVS_Sets[setd] == NU_NULL)
+                break;
+        }
+
+        if (setd == NET_MAX_EVENT_SETS)
+            return_status = NU_NO_SOCKET_SPACE;
+
+        else if (NU_Allocate_Memory(MEM_Cached, (VOID**)&set_ptr,
+                                    sizeof(EVS_SET),
+                                    NU_NO_SUSPEND) != NU_SUCCESS)
+        {
+            NLOG_Error_Log("Failed to allocate memory for event set",
+                           NERR_SEVERE, __FILE__, __LINE__);
+
+            return_status = NU_NO_MEMORY;
+        }
+
+        else
+        {
+            UTL_Zero(set_ptr, sizeof(EVS_SET));
+
+            set_ptr->es_setd = setd;
+
+            /* Zero is never used as an identifier. */
+            if (++EVS_Next_Struct_Id == 0)
+                EVS_Next_Struct_Id = 1;
+
+            set_ptr->es_struct_id = EVS_Next_Struct_Id;
+
+            EVS_Sets[setd] = set_ptr;
+
+            return_status = setd;
+        }
+
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
+            NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
+                           __FILE__, __LINE__);
+    }
+
+    else
+        NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
+                       __FILE__, __LINE__);
+
+    /* Switch back to user mode. */
+    NU_USER_MODE();
+
+    return (return_status);
+
+} /* NU_Event_Set_Create */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_Event_Set_Delete
+*
+*   DESCRIPTION
+*
+*       This function removes all sockets from an event set and deletes
+*       it.  A task waiting on the set is resumed and returns
+*       NU_INVALID_PARM.
+*
+*   INPUTS
+*
+*       setd                    The event set descriptor.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The event set was deleted.
+*       NU_INVALID_PARM         setd is not a valid event set.
+*
+*************************************************************************/
+STATUS NU_Event_Set_Delete(INT setd)
+{
+    STATUS      status;
+    EVS_SET     *set_ptr;
+    EVS_ENTRY   *entry_ptr;
+
+    NU_SUPERV_USER_VARIABLES
+
+    /* Switch to supervisor mode. */
+    NU_SUPERVISOR_MODE();
+
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
+
+    if (status == NU_SUCCESS)
+    {
+        set_ptr = EVS_Get_Set(setd);
+
+        if (set_ptr != NU_NULL)
+        {
+            EVS_Sets[setd] = NU_NULL;
+
+            /* Remove each socket from the set. */
+            while (set_ptr->es_entries)
+            {
+                entry_ptr = set_ptr->es_entries;
+                set_ptr->es_entries = entry_ptr->ee_next;
+
+                SCK_Sockets[entry_ptr->ee_socketd]->s_evs_entry = NU_NULL;
+
+                if (NU_Deallocate_Memory(entry_ptr) != NU_SUCCESS)
+                    NLOG_Error_Log("Failed to deallocate memory for event set entry",
+                                   NERR_SEVERE, __FILE__, __LINE__);
+            }
+
+            /* The waiting task finds the set gone when it resumes. */
+            if (set_ptr->es_waiter != NU_NULL)
+            {
+                if (NU_Resume_Task(set_ptr->es_waiter) != NU_SUCCESS)
+                    NLOG_Error_Log("Failed to resume task", NERR_SEVERE,
+                                   __FILE__, __LINE__);
+            }
+
+            if (NU_Deallocate_Memory(set_ptr) != NU_SUCCESS)
+                NLOG_Error_Log("Failed to deallocate memory for event set",
+                               NERR_SEVERE, __FILE__, __LINE__);
+        }
+
+        else
+            status = NU_INVALID_PARM;
+
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
+            NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
+                           __FILE__, __LINE__);
+    }
+
+    else
+        NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
+                       __FILE__, __LINE__);
+
+    /* Switch back to user mode. */
+    NU_USER_MODE();
+
+    return (status);
+
+} /* NU_Event_Set_Delete */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_Event_Set_Control
+*
+*   DESCRIPTION
+*
+*       This function adds a socket to an event set, changes the events
+*       of a socket in an event set, or removes a socket from an event
+*       set.  A socket can be in one event set at a time.  A socket that
+*       is already ready when it is added or modified is placed on the
+*       ready list immediately.  Closing a socket removes it from its
+*       event set.
+*
+*   INPUTS
+*
+*       setd                    The event set descriptor.
+*       op                      NU_EVS_ADD, NU_EVS_MODIFY or
+*                               NU_EVS_DELETE.
+*       socketd                 The socket descriptor.
+*       events                  NU_EVS_READABLE and/or NU_EVS_WRITABLE,
+*                               optionally with NU_EVS_EDGE.  Ignored for
+*                               NU_EVS_DELETE.
+*       *data                   Returned in the evs_data member of the
+*                               events for this socket.  Ignored for
+*                               NU_EVS_DELETE.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The operation was performed.
+*       NU_INVALID_PARM         setd is not a valid event set, op or
+*                               events is invalid, the socket is already
+*                               in an event set (NU_EVS_ADD), or the
+*                               socket is not in this event set
+*                               (NU_EVS_MODIFY and NU_EVS_DELETE).
+*       NU_INVALID_SOCKET       socketd is not a valid socket.
+*       NU_NO_MEMORY            Memory for the entry could not be
+*                               allocated.
+*
+*************************************************************************/
+STATUS NU_Event_Set_Control(INT setd, INT op, INT socketd, UINT16 events,
+                            VOID *data)
+{
+    STATUS              status;
+    EVS_SET             *set_ptr;
+    EVS_ENTRY           *entry_ptr;
+    struct sock_struct  *sockptr;
+
+    NU_SUPERV_USER_VARIABLES
+
+#if (INCLUDE_NET_API_ERR_CHECK == NU_TRUE)
+
+    if ( (socketd < 0) || (socketd >= NSOCKETS) )
+        return (NU_INVALID_SOCKET);
+
+    if ( (op != NU_EVS_DELETE) &&
+         ((events & (NU_EVS_READABLE | NU_EVS_WRITABLE)) == 0) )
+        return (NU_INVALID_PARM);
+
+#endif
+
+    /* Switch to supervisor mode. */
+    NU_SUPERVISOR_MODE();
+
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
+
+    if (status != NU_SUCCESS)
+    {
+        NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
+                       __FILE__, __LINE__);
+
+        /* Switch back to user mode. */
+        NU_USER_MODE();
+
+        return (status);
+    }
+
+    set_ptr = EVS_Get_Set(setd);
+    sockptr = SCK_Sockets[socketd];
+
+    if (set_ptr == NU_NULL)
+        status = NU_INVALID_PARM;
+
+    else if (sockptr == NU_NULL)
+        status = NU_INVALID_SOCKET;
+
+    else if (op == NU_EVS_ADD)
+    {
+        if (sockptr->s_evs_entry != NU_NULL)
+            status = NU_INVALID_PARM;
+
+        else if (NU_Allocate_Memory(MEM_Cached, (VOID**)&entry_ptr,
+                                    sizeof(EVS_ENTRY),
+                                    NU_NO_SUSPEND) != NU_SUCCESS)
+        {
+            NLOG_Error_Log("Failed to allocate memory for event set entry",
+                           NERR_SEVERE, __FILE__, __LINE__);
+
+            status = NU_NO_MEMORY;
+        }
+
+        else
+        {
+            UTL_Zero(entry_ptr, sizeof(EVS_ENTRY));
+
+            entry_ptr->ee_set = set_ptr;
+            entry_ptr->ee_socketd = socketd;
+            entry_ptr->ee_events = events;
+            entry_ptr->ee_data = data;
+
+            entry_ptr->ee_next = set_ptr->es_entries;
+            set_ptr->es_entries = entry_ptr;
+
+            sockptr->s_evs_entry = entry_ptr;
+
+            /* The socket may already be ready. */
+            EVS_Notify(sockptr, events);
+        }
+    }
+
+    else if ( (sockptr->s_evs_entry == NU_NULL) ||
+              (sockptr->s_evs_entry->ee_set != set_ptr) )
+        status = NU_INVALID_PARM;
+
+    else if (op == NU_EVS_MODIFY)
+    {
+        sockptr->s_evs_entry->ee_events = events;
+        sockptr->s_evs_entry->ee_data = data;
+
+        EVS_Notify(sockptr, events);
+    }
+
+    else if (op == NU_EVS_DELETE)
+        EVS_Remove_Socket(sockptr);
+
+    else
+        status = NU_INVALID_PARM;
+
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
+        NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
+                       __FILE__, __LINE__);
+
+    /* Switch back to user mode. */
+    NU_USER_MODE();
+
+    return (status);
+
+} /* NU_Event_Set_Control */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_Event_Set_Wait
+*
+*   DESCRIPTION
+*
+*       This function returns the sockets of an event set that are
+*       ready.  If none are ready, the calling task can choose to return
+*       immediately, suspend, or specify a timeout.  Only one task may
+*       wait on an event set at a time.
+*
+*   INPUTS
+*
+*       setd                    The event set descriptor.
+*       *events                 Array to fill in with the ready sockets.
+*       max_events              The number of elements in events.
+*       timeout                 The timeout desired. Either NU_SUSPEND,
+*                               NU_NO_SUSPEND, or a timeout value.
+*
+*   OUTPUTS
+*
+*       The number of ready sockets returned in events, or one of the
+*       following negative values:
+*
+*       NU_NO_DATA              No socket became ready before the
+*                               timeout expired.
+*       NU_INVALID_PARM         setd is not a valid event set, the set
+*                               was deleted while waiting, events is
+*                               NU_NULL, max_events is less than 1, or
+*                               another task is waiting on the set.
+*
+*************************************************************************/
+INT NU_Event_Set_Wait(INT setd, NU_EVS_EVENT *events, INT max_events,
+                      UNSIGNED timeout)
+{
+    INT                 count = 0;
+    STATUS              status;
+    EVS_SET             *set_ptr;
+    EVS_ENTRY           *entry_ptr;
+    EVS_ENTRY           *next_ptr;
+    UINT16              ready;
+    UINT32              struct_id;
+    NU_TASK             *task_id;
+    INT                 timeout_used = NU_FALSE;
+    struct sock_struct  *sockptr;
+
+    NU_SUPERV_USER_VARIABLES
+
+#if (INCLUDE_NET_API_ERR_CHECK == NU_TRUE)
+
+    if ( (events == NU_NULL) || (max_events < 1) )
+        return (NU_INVALID_PARM);
+
+#endif
+
+    /* Switch to supervisor mode. */
+    NU_SUPERVISOR_MODE();
+
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
+
+    if (status != NU_SUCCESS)
+    {
+        NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
+                       __FILE__, __LINE__);
+
+        /* Switch back to user mode. */
+        NU_USER_MODE();
+
+        return (status);
+    }
+
+    set_ptr = EVS_Get_Set(setd);
+
+    if ( (set_ptr == NU_NULL) || (set_ptr->es_waiter != NU_NULL) )
+        count = NU_INVALID_PARM;
+
+    else
+    {
+        struct_id = set_ptr->es_struct_id;
+
+        for (;;)
+        {
+            /* Check each socket on the ready list. */
+            for (entry_ptr = set_ptr->es_ready.head;
+                 (entry_ptr != NU_NULL) && (count < max_events);
+                 entry_ptr = next_ptr)
+            {
+                next_ptr = entry_ptr->ee_flink;
+
+                sockptr = SCK_Sockets[entry_ptr->ee_socketd];
+
+                ready = EVS_Socket_Ready(sockptr, entry_ptr->ee_events);
+
+                if (ready)
+                {
+                    events[count].evs_socketd = entry_ptr->ee_socketd;
+                    events[count].evs_data = entry_ptr->ee_data;
+                    events[count].evs_events = ready;
+
+                    count ++;
+                }
+
+                /* A level-triggered socket stays on the ready list for as
+                 * long as it is ready.  An edge-triggered socket is only
+                 * reported again after the next notification.
+                 */
+                if ( (!ready) || (entry_ptr->ee_events & NU_EVS_EDGE) )
+                {
+                    DLL_Remove(&set_ptr->es_ready, entry_ptr);
+                    entry_ptr->ee_ready = NU_FALSE;
+                }
+            }
+
+            if ( (count > 0) || (timeout == NU_NO_SUSPEND) ||
+                 (timeout_used == NU_TRUE) )
+                break;
+
+            task_id = NU_Current_Task_Pointer();
+
+            set_ptr->es_waiter = task_id;
+
+            if (timeout != NU_SUSPEND)
+            {
+                /* Set up the timer to wake us up if the event never
+                 * occurs.
+                 */
+                if (TQ_Timerset(SELECT, (UNSIGNED)task_id, timeout,
+                                0) != NU_SUCCESS)
+                    NLOG_Error_Log("Failed to set timer to wake up task",
+                                   NERR_SEVERE, __FILE__, __LINE__);
+
+                timeout_used = NU_TRUE;
+            }
+
+            SCK_Suspend_Task(task_id);
+
+            if (timeout != NU_SUSPEND)
+                TQ_Timerunset(SELECT, TQ_CLEAR_EXACT, (UNSIGNED)task_id, 0);
+
+            /* The set may have been deleted while the task was
+             * suspended.
+             */
+            set_ptr = EVS_Get_Set(setd);
+
+            if ( (set_ptr == NU_NULL) || (set_ptr->es_struct_id != struct_id) )
+            {
+                count = NU_INVALID_PARM;
+                break;
+            }
+
+            set_ptr->es_waiter = NU_NULL;
+        }
+
+        if (count == 0)
+            count = NU_NO_DATA;
+    }
+
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
+        NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
+                       __FILE__, __LINE__);
+
+    /* Switch back to user mode. */
+    NU_USER_MODE();
+
+    return (count);
+
+} /* NU_Event_Set_Wait */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       EVS_Notify
+*
+*   DESCRIPTION
+*
+*       This function is called by the stack when the state of a socket
+*       may have changed.  If the socket is in an event set and is ready
+*       for one of the given events it is interested in, it is placed on
+*       the ready list of the set and the task waiting on the set is
+*       resumed.  The caller must hold the stack semaphore.
+*
+*   INPUTS
+*
+*       *sockptr                Pointer to the socket.
+*       events                  The events that may have occurred.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID EVS_Notify(struct sock_struct *sockptr, UINT16 events)
+{
+    EVS_ENTRY   *entry_ptr = sockptr->s_evs_entry;
+    EVS_SET     *set_ptr;
+
+    if (entry_ptr == NU_NULL)
+        return;
+
+    events &= entry_ptr->ee_events;
+
+    if ( (events == 0) || (EVS_Socket_Ready(sockptr, events) == 0) )
+        return;
+
+    set_ptr = entry_ptr->ee_set;
+
+    if (entry_ptr->ee_ready == NU_FALSE)
+    {
+        DLL_Enqueue(&set_ptr->es_ready, entry_ptr);
+        entry_ptr->ee_ready = NU_TRUE;
+    }
+
+    if (set_ptr->es_waiter != NU_NULL)
+    {
+        if (NU_Resume_Task(set_ptr->es_waiter) != NU_SUCCESS)
+            NLOG_Error_Log("Failed to resume task", NERR_SEVERE,
+                           __FILE__, __LINE__);
+
+        set_ptr->es_waiter = NU_NULL;
+    }
+
+} /* EVS_Notify */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       EVS_Remove_Socket
+*
+*   DESCRIPTION
+*
+*       This function removes a socket from its event set and frees its
+*       entry.  The caller must hold the stack semaphore.
+*
+*   INPUTS
+*
+*       *sockptr                Pointer to the socket.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID EVS_Remove_Socket(struct sock_struct *sockptr)
+{
+    EVS_ENTRY   *entry_ptr = sockptr->s_evs_entry;
+    EVS_ENTRY   **prev_ptr;
+
+    if (entry_ptr == NU_NULL)
+        return;
+
+    sockptr->s_evs_entry = NU_NULL;
+
+    if (entry_ptr->ee_ready)
+        DLL_Remove(&entry_ptr->ee_set->es_ready, entry_ptr);
+
+    for (prev_ptr = &entry_ptr->ee_set->es_entries;
+         *prev_ptr != NU_NULL;
+         prev_ptr = &(*prev_ptr)->ee_next)
+    {
+        if (*prev_ptr == entry_ptr)
+        {
+            *prev_ptr = entry_ptr->ee_next;
+            break;
+        }
+    }
+
+    if (NU_Deallocate_Memory(entry_ptr) != NU_SUCCESS)
+        NLOG_Error_Log("Failed to deallocate memory for event set entry",
+                       NERR_SEVERE, __FILE__, __LINE__);
+
+} /* EVS_Remove_Socket */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       EVS_Socket_Ready
+*
+*   DESCRIPTION
+*
+*       This function determines which of the given events a socket is
+*       ready for.  The conditions are the same as those used by
+*       NU_Select.
+*
+*   INPUTS
+*
+*       *sockptr                Pointer to the socket.
+*       events                  The events to check.
+*
+*   OUTPUTS
+*
+*       The events the socket is ready for.
+*
+*************************************************************************/
+STATIC UINT16 EVS_Socket_Ready(const struct sock_struct *sockptr,
+                               UINT16 events)
+{
+    UINT16      ready = 0;
+
+#if (INCLUDE_TCP == NU_TRUE)
+    TCP_PORT    *prt;
+#endif
+
+    if (events & NU_EVS_READABLE)
+    {
+        /* A socket with a pending error is readable. */
+        if (sockptr->s_error != 0)
+            ready |= NU_EVS_READABLE;
+
+#if (INCLUDE_TCP == NU_TRUE)
+        else if (sockptr->s_protocol == NU_PROTO_TCP)
+        {
+            /* A listening socket is readable when a connection has
+             * completed.
+             */
+            if (sockptr->s_flags & SF_LISTENER)
+            {
+                if (SCK_SearchTaskList(sockptr->s_accept_list, SEST, -1) >= 0)
+                    ready |= NU_EVS_READABLE;
+            }
+
+            /* A connection is readable when it is closing or has data
+             * that no other task is waiting for.
+             */
+            else if ( (sockptr->s_state & SS_ISDISCONNECTING) ||
+                      ((sockptr->s_RXTask_List.flink == NU_NULL) &&
+                       (sockptr->s_recvbytes > 0)) )
+                ready |= NU_EVS_READABLE;
+        }
+#endif
+
+        /* A UDP or IP Raw socket is readable when its device has gone
+         * down or it has datagrams that no other task is waiting for.
+         */
+        else if ( (sockptr->s_state & SS_DEVICEDOWN) ||
+                  ((sockptr->s_RXTask_List.flink == NU_NULL) &&
+                   (sockptr->s_recvpackets > 0)) )
+            ready |= NU_EVS_READABLE;
+    }
+
+    if (events & NU_EVS_WRITABLE)
+    {
+#if (INCLUDE_TCP == NU_TRUE)
+        if (sockptr->s_protocol == NU_PROTO_TCP)
+        {
+            if (sockptr->s_port_index >= 0)
+            {
+                prt = TCP_Ports[sockptr->s_port_index];
+
+                /* A write operation on a TCP socket will block if the
+                 * other side's receive window is full, we are probing
+                 * the other side of the connection, or the TCP buffer
+                 * threshold has been reached.
+                 */
+                if ( (prt != NU_NULL) &&
+                     ((prt->state == SCWAIT) || (prt->state == SEST)) &&
+                     (((prt->out.size > prt->out.contain) &&
+                       (prt->probeFlag == NU_CLEAR) &&
+                       ((MAX_BUFFERS - MEM_Buffers_Used) > NET_FREE_BUFFER_THRESHOLD))
+#if (NET_INCLUDE_LMTD_TX == NU_TRUE)
+                      || (prt->portFlags & TCP_TX_LMTD_DATA)
+#endif
+                     ) )
+                    ready |= NU_EVS_WRITABLE;
+            }
+        }
+
+        else
+#endif
+
+        /* A UDP or IP Raw socket is writable when there are buffers
+         * available.
+         */
+        if (MEM_Buffer_Freelist.head)
+            ready |= NU_EVS_WRITABLE;
+    }
+
+    return (ready);
+
+} /* EVS_Socket_Ready */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       EVS_Get_Set
+*
+*   DESCRIPTION
+*
+*       This function returns the event set for a descriptor.  The caller
+*       must hold the stack semaphore.
+*
+*   INPUTS
+*
+*       setd                    The event set descriptor.
+*
+*   OUTPUTS
+*
+*       A pointer to the event set, or NU_NULL if the descriptor is not
+*       valid.
+*
+*************************************************************************/
+STATIC EVS_SET *EVS_Get_Set(INT setd)
+{
+    if ( (setd < 0) || (setd >= NET_MAX_EVENT_SETS) )
+        return (NU_NULL);
+
+    return (EVS_Sets[setd]);
+
+} /* EVS_Get_Set */
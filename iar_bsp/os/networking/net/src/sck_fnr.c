@@ -76,7 +76,7 @@ ROUTE_ENTRY *NU_Find_Next_Route(const UINT8 *current_address, INT16 family)
 #endif
 
     /* Grab the TCP semaphore */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
 #if (INCLUDE_IPV6 == NU_TRUE)
         if (family == NU_FAMILY_IP6)
@@ -110,7 +110,7 @@ ROUTE_ENTRY *NU_Find_Next_Route(const UINT8 *current_address, INT16 family)
             } while (next_entry);
         }
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
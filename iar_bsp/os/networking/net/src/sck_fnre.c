@@ -79,7 +79,7 @@ ROUTE_ENTRY *NU_Find_Next_Route_Entry(ROUTE_ENTRY *current_route,
     NU_SUPERVISOR_MODE();
 
     /* Grab the TCP semaphore */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
 #if (INCLUDE_IPV6 == NU_TRUE)
         if (family == NU_FAMILY_IP6)
@@ -113,7 +113,7 @@ ROUTE_ENTRY *NU_Find_Next_Route_Entry(ROUTE_ENTRY *current_route,
         }
 #endif
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -91,7 +91,7 @@ ROUTE_ENTRY *NU_Find_Route_By_Gateway(const UINT8 *ip_dest,
     /* Switch to supervisor mode. */
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -114,7 +114,7 @@ ROUTE_ENTRY *NU_Find_Route_By_Gateway(const UINT8 *ip_dest,
         target_route = RTAB4_Find_Route_By_Gateway(ip_dest, gw_addr, flags);
 #endif
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -152,7 +152,7 @@ INT NU_Find_Socket(INT protocol, const struct addr_struct *local_addr,
 
 	case NU_PROTO_TCP:
 
-		status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+		status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
 		if (status != NU_SUCCESS)
 		{
@@ -214,7 +214,7 @@ INT NU_Find_Socket(INT protocol, const struct addr_struct *local_addr,
 			{
 				socket = tcp_port->p_socketd;
 
-				if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+				if (NET_Release_Stack_Lock() != NU_SUCCESS)
 					NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
 								   __FILE__, __LINE__);
 
@@ -225,7 +225,7 @@ INT NU_Find_Socket(INT protocol, const struct addr_struct *local_addr,
 		/* If we did not find a match, return an error */
 		if (i >= TCP_MAX_PORTS)
 		{
-			if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+			if (NET_Release_Stack_Lock() != NU_SUCCESS)
 				NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
 							   __FILE__, __LINE__);
 
@@ -239,7 +239,7 @@ INT NU_Find_Socket(INT protocol, const struct addr_struct *local_addr,
 
 	case NU_PROTO_UDP:
 
-		status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+		status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
 		if (status != NU_SUCCESS)
 		{
@@ -278,7 +278,7 @@ INT NU_Find_Socket(INT protocol, const struct addr_struct *local_addr,
 			{
 				socket = udp_port->up_socketd;
 
-				if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+				if (NET_Release_Stack_Lock() != NU_SUCCESS)
 					NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
 								   __FILE__, __LINE__);
 
@@ -289,7 +289,7 @@ INT NU_Find_Socket(INT protocol, const struct addr_struct *local_addr,
 		/* If we did not find a match, return an error */
 		if (i >= UDP_MAX_PORTS)
 		{
-			if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+			if (NET_Release_Stack_Lock() != NU_SUCCESS)
 				NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
 							   __FILE__, __LINE__);
 
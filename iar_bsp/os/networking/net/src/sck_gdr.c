@@ -75,7 +75,7 @@ ROUTE_NODE *NU_Get_Default_Route(INT16 family)
     /* Switch to supervisor mode. */
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -98,7 +98,7 @@ ROUTE_NODE *NU_Get_Default_Route(INT16 family)
     else
         default_route = NU_NULL;
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
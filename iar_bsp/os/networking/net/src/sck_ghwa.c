@@ -77,12 +77,12 @@ STATUS NU_Ioctl_SIOCGIFHWADDR(SCK_IOCTL_OPTION *option)
     /* Switch to supervisor mode. */
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
     if (status == NU_SUCCESS)
     {
         status = Ioctl_SIOCGIFHWADDR(option);
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -87,7 +87,7 @@ UINT32 NU_Get_PMTU(const UINT8 *src_addr, const UINT8 *dest_addr,
     NU_SUPERVISOR_MODE();
 
     /* We must grab the NET semaphore */
-    *status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    *status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (*status != NU_SUCCESS)
     {
@@ -133,7 +133,7 @@ UINT32 NU_Get_PMTU(const UINT8 *src_addr, const UINT8 *dest_addr,
     }
 
     /* Release the semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
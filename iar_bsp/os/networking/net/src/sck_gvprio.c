@@ -79,14 +79,14 @@ STATUS NU_Ioctl_SIOCGETVLANPRIO(SCK_IOCTL_OPTION *option)
 	NU_SUPERVISOR_MODE();
 
 	/* Obtain the TCP semaphore. */
-	status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+	status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
 	if (status == NU_SUCCESS)
 	{
 		/* Get the VLAN priority associated with the interface. */
 		status = Ioctl_SIOCGETVLANPRIO(option);
 
-		if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+		if (NET_Release_Stack_Lock() != NU_SUCCESS)
 		{
 			NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
 						   __FILE__, __LINE__);
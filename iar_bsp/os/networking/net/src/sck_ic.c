@@ -77,7 +77,7 @@ STATUS NU_Is_Connected(INT socketd)
     NU_SUPERVISOR_MODE();
 
     /* Get the Nucleus NET semaphore. */
-    return_status =  NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    return_status =  NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (return_status != NU_SUCCESS)
     {
@@ -95,7 +95,7 @@ STATUS NU_Is_Connected(INT socketd)
         return_status = NU_FALSE;
 
         /* Release the TCP semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -113,7 +113,7 @@ STATUS NU_Is_Connected(INT socketd)
         return_status = NU_FALSE;
 
         /* Release the TCP semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -131,7 +131,7 @@ STATUS NU_Is_Connected(INT socketd)
         return_status = NU_FALSE;
 
         /* Release the TCP semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -156,7 +156,7 @@ STATUS NU_Is_Connected(INT socketd)
         return_status = NU_FALSE;
 
     /* Release the TCP semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -78,7 +78,7 @@ CHAR *NU_IF_IndexToName(INT32 if_index, CHAR *if_name)
     NU_SUPERVISOR_MODE();
 
      /* Get the Nucleus NET semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         /* Return to user mode */
         NU_USER_MODE();
@@ -101,7 +101,7 @@ CHAR *NU_IF_IndexToName(INT32 if_index, CHAR *if_name)
         ret_name = NU_NULL;
 
     /* Release the TCP semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -86,7 +86,7 @@ struct if_nameindex *NU_IF_NameIndex(VOID)
     NU_SUPERVISOR_MODE();
 
      /* Get the Nucleus NET semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         /* Return to user mode */
         NU_USER_MODE();
@@ -163,7 +163,7 @@ struct if_nameindex *NU_IF_NameIndex(VOID)
 #endif
 
     /* Release the TCP semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
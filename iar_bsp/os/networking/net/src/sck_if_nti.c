@@ -76,7 +76,7 @@ INT32 NU_IF_NameToIndex(const CHAR *if_name)
     NU_SUPERVISOR_MODE();
 
      /* Get the Nucleus NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -98,7 +98,7 @@ INT32 NU_IF_NameToIndex(const CHAR *if_name)
         if_index = -1;
 
     /* Release the TCP semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
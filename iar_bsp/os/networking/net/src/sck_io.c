@@ -130,7 +130,7 @@ STATUS NU_Ioctl(INT optname, SCK_IOCTL_OPTION *option, INT optlen)
     /* Switch to supervisor mode. */
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -380,7 +380,7 @@ STATUS NU_Ioctl(INT optname, SCK_IOCTL_OPTION *option, INT optlen)
 
     } /* end switch */
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
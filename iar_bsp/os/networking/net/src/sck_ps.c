@@ -84,14 +84,14 @@ STATUS SCK_Protect_Socket_Block(INT socketd)
     NU_SUPERVISOR_MODE();
 
      /* Get the Nucleus NET semaphore. */
-    return_status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    return_status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (return_status == NU_SUCCESS)
     {
         /* If socketd does not reference a valid socket, return an error */
         if (SCK_Sockets[socketd] == NU_NULL)
         {
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
 
@@ -130,7 +130,7 @@ VOID SCK_Release_Socket(VOID)
     NU_SUPERV_USER_VARIABLES
 
     /* Release the TCP semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
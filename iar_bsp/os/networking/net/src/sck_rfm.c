@@ -0,0 +1,155 @@
+/*************************************************************************
+*
+*              Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+
+/*************************************************************************
+*
+*   FILE NAME
+*
+*       sck_rfm.c
+*
+*   DESCRIPTION
+*
+*       This file contains the implementation of NU_Recv_From_Multiple.
+*
+*   DATA STRUCTURES
+*
+*       None.
+*
+*   FUNCTIONS
+*
+*       NU_Recv_From_Multiple
+*
+*   DEPENDENCIES
+*
+*       nu_net.h
+*
+*************************************************************************/
+
+#include "networking/nu_net.h"
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_Recv_From_Multiple
+*
+*   DESCRIPTION
+*
+*       This function receives up to count datagrams from a UDP socket
+*       into a vector of buffers.  The stack semaphore is obtained and
+*       the socket validated once for the whole vector.  If the socket is
+*       blocking and no data is pending, the caller is suspended until
+*       the first datagram arrives; the remaining entries are only filled
+*       with datagrams that are already queued on the socket.
+*
+*       The size and source address of each datagram are returned in the
+*       mm_status and mm_addr members of its entry.  mm_addr must point
+*       to an address structure for every entry.  The mm_status of the
+*       entries that were not filled is set to NU_WOULD_BLOCK.
+*
+*   INPUTS
+*
+*       socketd                 Specifies a socket descriptor
+*       *msgs                   Pointer to the array of receive buffers
+*       count                   The number of entries in the array
+*       flags                   This parameter is used for socket
+*                               compatibility we are currently not making
+*                               any use of it
+*
+*   OUTPUTS
+*
+*       > 0                     The number of datagrams received.
+*       NU_INVALID_PARM         msgs is NU_NULL, count is zero, or an
+*                               entry has no address structure.
+*       NU_INVALID_SOCKET       The socket parameter was not a valid UDP
+*                               socket.
+*
+*       If no datagram was received, the status of the first entry is
+*       returned.  See NU_Recv_From for the values of mm_status.
+*
+*************************************************************************/
+INT32 NU_Recv_From_Multiple(INT socketd, NU_MMSG *msgs, UINT16 count,
+                            INT16 flags)
+{
+    INT32               return_status;
+    INT32               received = 0;
+    UINT16              i;
+
+#if (INCLUDE_NET_API_ERR_CHECK == NU_TRUE)
+
+    if ( (msgs == NU_NULL) || (count == 0) )
+        return (NU_INVALID_PARM);
+
+    for (i = 0; i < count; i++)
+    {
+        if (msgs[i].mm_addr == NU_NULL)
+            return (NU_INVALID_PARM);
+    }
+
+#endif
+
+    /* Obtain the semaphore and validate the socket */
+    return_status = SCK_Protect_Socket_Block(socketd);
+
+    if (return_status == NU_SUCCESS)
+    {
+        /*  Clean up warnings.  This parameter is used for socket compatibility
+            but we are currently not making any use of it.  */
+        UNUSED_PARAMETER(flags);
+
+        if (SCK_Sockets[socketd]->s_protocol != NU_PROTO_UDP)
+            return_status = NU_INVALID_SOCKET;
+
+        else
+        {
+            /* Receive the first datagram, suspending if necessary. */
+            return_status = UDP_Recv_Data(socketd, msgs[0].mm_buff,
+                                          msgs[0].mm_len, msgs[0].mm_addr);
+
+            msgs[0].mm_status = return_status;
+
+            if (return_status >= 0)
+            {
+                received ++;
+
+                /* Take the datagrams that are already pending without
+                 * suspending again.
+                 */
+                i = 1;
+
+                while ( (i < count) && (SCK_Sockets[socketd]->s_recvpackets) )
+                {
+                    msgs[i].mm_status =
+                        UDP_Recv_Data(socketd, msgs[i].mm_buff,
+                                      msgs[i].mm_len, msgs[i].mm_addr);
+
+                    if (msgs[i++].mm_status < 0)
+                        break;
+
+                    received ++;
+                }
+
+                /* Mark the entries that were not filled. */
+                for (; i < count; i++)
+                    msgs[i].mm_status = NU_WOULD_BLOCK;
+
+                return_status = received;
+            }
+        }
+
+        /* Release the semaphore */
+        SCK_Release_Socket();
+    }
+
+    /* return to caller */
+    return (return_status);
+
+} /* NU_Recv_From_Multiple */
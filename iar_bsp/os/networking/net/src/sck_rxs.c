@@ -0,0 +1,520 @@
+/*************************************************************************
+*
+*              Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+
+/*************************************************************************
+*
+*   FILENAME
+*
+*       sck_rxs.c
+*
+*   DESCRIPTION
+*
+*       This file contains the receive ring services.  A task that owns
+*       a connected zero copy UDP socket can register a receive ring on
+*       it.  The stack then places the datagrams of the socket on the
+*       ring once they have been validated, and the task takes them from
+*       the ring in NU_ZC_Recv without obtaining the stack semaphore.
+*
+*       The ring has one producer, the stack, and one consumer, the task
+*       that owns the socket.  Only that task may receive from the socket
+*       while the ring is registered.  The receiving task holds a
+*       reference on the ring, so if the socket is closed or the ring
+*       unregistered meanwhile, the ring is only freed when the task
+*       leaves NU_ZC_Recv.  A socket with a ring is not reported by
+*       NU_Select or event sets.
+*
+*   DATA STRUCTURES
+*
+*       None.
+*
+*   FUNCTIONS
+*
+*       NU_Recv_Ring_Register
+*       NU_Recv_Ring_Unregister
+*       SCK_Rx_Ring_Delete
+*       SCK_Rx_Ring_Put
+*       SCK_Rx_Ring_Recv
+*       SCK_Rx_Ring_Release
+*       SCK_Rx_Ring_Free
+*
+*   DEPENDENCIES
+*
+*       nu_net.h
+*
+*************************************************************************/
+
+#include "networking/nu_net.h"
+
+STATIC VOID SCK_Rx_Ring_Release(SCK_RX_RING *);
+STATIC VOID SCK_Rx_Ring_Free(SCK_RX_RING *);
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_Recv_Ring_Register
+*
+*   DESCRIPTION
+*
+*       This function registers a receive ring on a connected UDP socket
+*       in zero copy mode.  Datagrams that are already queued on the
+*       socket are returned by NU_ZC_Recv before those on the ring.
+*
+*   INPUTS
+*
+*       socketd                 The socket descriptor.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The ring is registered on the socket.
+*       NU_INVALID_SOCKET       The socket is not a valid UDP socket.
+*       NU_NOT_CONNECTED        The socket is not connected.
+*       NU_INVALID_PARM         The socket is not in zero copy mode.
+*       NU_NO_MEMORY            Memory for the ring could not be
+*                               allocated.
+*
+*************************************************************************/
+STATUS NU_Recv_Ring_Register(INT socketd)
+{
+    STATUS              status;
+    struct sock_struct  *sockptr;
+    SCK_RX_RING         *ring_ptr;
+
+    /* Obtain the semaphore and validate the socket */
+    status = SCK_Protect_Socket_Block(socketd);
+
+    if (status == NU_SUCCESS)
+    {
+        sockptr = SCK_Sockets[socketd];
+
+        if (sockptr->s_protocol != NU_PROTO_UDP)
+            status = NU_INVALID_SOCKET;
+
+        else if (!(sockptr->s_state & SS_ISCONNECTED))
+            status = NU_NOT_CONNECTED;
+
+        else if (!(sockptr->s_flags & SF_ZC_MODE))
+            status = NU_INVALID_PARM;
+
+        else if (sockptr->s_rx_ring == NU_NULL)
+        {
+            if (NU_Allocate_Memory(MEM_Cached, (VOID**)&ring_ptr,
+                                   sizeof(SCK_RX_RING),
+                                   NU_NO_SUSPEND) != NU_SUCCESS)
+            {
+                NLOG_Error_Log("Failed to allocate memory for receive ring",
+                               NERR_SEVERE, __FILE__, __LINE__);
+
+                status = NU_NO_MEMORY;
+            }
+
+            else
+            {
+                UTL_Zero(ring_ptr, sizeof(SCK_RX_RING));
+
+                status = NU_Create_Event_Group(&ring_ptr->srr_event, "SCKRXR");
+
+                if (status == NU_SUCCESS)
+                    sockptr->s_rx_ring = ring_ptr;
+
+                else
+                {
+                    NLOG_Error_Log("Failed to create receive ring event group",
+                                   NERR_SEVERE, __FILE__, __LINE__);
+
+                    if (NU_Deallocate_Memory(ring_ptr) != NU_SUCCESS)
+                        NLOG_Error_Log("Failed to deallocate memory for receive ring",
+                                       NERR_SEVERE, __FILE__, __LINE__);
+                }
+            }
+        }
+
+        /* Release the semaphore */
+        SCK_Release_Socket();
+    }
+
+    return (status);
+
+} /* NU_Recv_Ring_Register */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_Recv_Ring_Unregister
+*
+*   DESCRIPTION
+*
+*       This function removes the receive ring from a socket.  The
+*       datagrams on the ring are discarded.
+*
+*   INPUTS
+*
+*       socketd                 The socket descriptor.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The socket has no receive ring.
+*       NU_INVALID_SOCKET       The socket parameter was not a valid
+*                               socket value.
+*       NU_NOT_CONNECTED        The socket has been closed.
+*
+*************************************************************************/
+STATUS NU_Recv_Ring_Unregister(INT socketd)
+{
+    STATUS      status;
+
+    /* Obtain the semaphore and validate the socket */
+    status = SCK_Protect_Socket_Block(socketd);
+
+    if (status == NU_SUCCESS)
+    {
+        SCK_Rx_Ring_Delete(SCK_Sockets[socketd]);
+
+        /* Release the semaphore */
+        SCK_Release_Socket();
+    }
+
+    return (status);
+
+} /* NU_Recv_Ring_Unregister */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Rx_Ring_Delete
+*
+*   DESCRIPTION
+*
+*       This function removes the receive ring from a socket, frees the
+*       datagrams on it and deletes it.  If a task is receiving from the
+*       ring, it is resumed and returns NU_SOCKET_CLOSED, and the ring
+*       is freed when the task releases it.  The caller must hold the
+*       stack semaphore.
+*
+*   INPUTS
+*
+*       *sockptr                Pointer to the socket.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID SCK_Rx_Ring_Delete(struct sock_struct *sockptr)
+{
+    SCK_RX_RING *ring_ptr;
+    OPTION      old_preempt;
+    INT         users;
+
+    /* NU_ZC_Recv takes its reference with preemption disabled. */
+    old_preempt = NU_Change_Preemption(NU_NO_PREEMPT);
+
+    ring_ptr = sockptr->s_rx_ring;
+
+    if (ring_ptr != NU_NULL)
+    {
+        sockptr->s_rx_ring = NU_NULL;
+        ring_ptr->srr_closed = NU_TRUE;
+    }
+
+    users = (ring_ptr != NU_NULL) ? ring_ptr->srr_users : 0;
+
+    NU_Change_Preemption(old_preempt);
+
+    if (ring_ptr == NU_NULL)
+        return;
+
+    /* A task is receiving from the ring.  Resume it; the ring is freed
+       when it releases its reference. */
+    if (users != 0)
+    {
+        if (NU_Set_Events(&ring_ptr->srr_event, SCK_RX_RING_READY,
+                          NU_OR) != NU_SUCCESS)
+            NLOG_Error_Log("Failed to set receive ring event",
+                           NERR_SEVERE, __FILE__, __LINE__);
+    }
+
+    else
+        SCK_Rx_Ring_Free(ring_ptr);
+
+} /* SCK_Rx_Ring_Delete */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Rx_Ring_Put
+*
+*   DESCRIPTION
+*
+*       This function places a datagram on the receive ring of a socket.
+*       The data pointer of the buffer must point to the UDP data.  If
+*       the ring is full, the datagram is dropped.  The owning task is
+*       signalled when the ring becomes non-empty.  The caller must hold
+*       the stack semaphore.
+*
+*   INPUTS
+*
+*       *ring_ptr               Pointer to the receive ring.
+*       *buf_ptr                Pointer to the datagram.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+VOID SCK_Rx_Ring_Put(SCK_RX_RING *ring_ptr, NET_BUFFER *buf_ptr)
+{
+    UINT32  tail = ring_ptr->srr_tail;
+
+    if ((tail - ring_ptr->srr_head) >= SCK_RX_RING_SIZE)
+    {
+        ring_ptr->srr_drops++;
+
+        MEM_One_Buffer_Chain_Free(buf_ptr, &MEM_Buffer_Freelist);
+    }
+
+    else
+    {
+        /* Fill in the slot before the task can see it. */
+        ring_ptr->srr_slots[tail & SCK_RX_RING_MASK] = buf_ptr;
+
+        ring_ptr->srr_tail = tail + 1;
+
+        /* Only signal the task when the ring was empty; otherwise it is
+           still taking the datagrams that are already on the ring. */
+        if (tail == ring_ptr->srr_head)
+        {
+            if (NU_Set_Events(&ring_ptr->srr_event, SCK_RX_RING_READY,
+                              NU_OR) != NU_SUCCESS)
+                NLOG_Error_Log("Failed to set receive ring event",
+                               NERR_SEVERE, __FILE__, __LINE__);
+        }
+    }
+
+} /* SCK_Rx_Ring_Put */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Rx_Ring_Recv
+*
+*   DESCRIPTION
+*
+*       This function takes the next datagram from the receive ring of a
+*       socket without obtaining the stack semaphore.  If the ring is
+*       empty and the socket is blocking, the caller is suspended until
+*       a datagram is placed on the ring.  It must only be called by the
+*       task that owns the ring, which must have incremented srr_users
+*       with preemption disabled while the ring was registered on the
+*       socket.  That reference is released before returning.
+*
+*   INPUTS
+*
+*       socketd                 The socket descriptor.
+*       *ring_ptr               Pointer to the receive ring.
+*       **buff                  Set to the datagram that was received.
+*
+*   OUTPUTS
+*
+*       >= 0                    The number of bytes in the datagram.
+*       NU_WOULD_BLOCK          No datagram is available, and the socket
+*                               is non-blocking.
+*       NU_DEVICE_DOWN          The device the socket was communicating
+*                               over has gone down.
+*       NU_SOCKET_CLOSED        The socket was closed or the ring was
+*                               removed.
+*
+*       An ICMP Error code will be returned if an ICMP packet was
+*       received for the socket.
+*
+*************************************************************************/
+INT32 SCK_Rx_Ring_Recv(INT socketd, SCK_RX_RING *ring_ptr, NET_BUFFER **buff)
+{
+    struct sock_struct  *sockptr;
+    UINT32              head;
+    UNSIGNED            events;
+    INT32               status;
+    INT                 wait;
+    OPTION              old_preempt;
+
+    for (;;)
+    {
+        /* The socket may have been closed and freed. */
+        if (ring_ptr->srr_closed)
+        {
+            status = NU_SOCKET_CLOSED;
+            break;
+        }
+
+        head = ring_ptr->srr_head;
+
+        if (head != ring_ptr->srr_tail)
+        {
+            *buff = ring_ptr->srr_slots[head & SCK_RX_RING_MASK];
+
+            /* Hand the slot back to the stack. */
+            ring_ptr->srr_head = head + 1;
+
+            NET_LAT_STAMP(*buff, NET_LAT_SOCKET, NET_LAT_NONE);
+
+            status = (INT32)(*buff)->mem_total_data_len;
+            break;
+        }
+
+        wait = NU_FALSE;
+
+        /* The socket is only freed after the ring has been closed, which
+           is done with preemption disabled. */
+        old_preempt = NU_Change_Preemption(NU_NO_PREEMPT);
+
+        sockptr = SCK_Sockets[socketd];
+
+        if (ring_ptr->srr_closed)
+            status = NU_SOCKET_CLOSED;
+
+        /* Report an error that was received for the socket. */
+        else if (sockptr->s_error != 0)
+        {
+            status = sockptr->s_error;
+            sockptr->s_error = 0;
+        }
+
+        else if (sockptr->s_state & SS_DEVICEDOWN)
+            status = NU_DEVICE_DOWN;
+
+        else if (!(sockptr->s_flags & SF_BLOCK))
+            status = NU_WOULD_BLOCK;
+
+        else
+            wait = NU_TRUE;
+
+        NU_Change_Preemption(old_preempt);
+
+        if (wait == NU_FALSE)
+            break;
+
+        /* Wait for the stack to place a datagram on the ring.  An event
+           left over from datagrams that have already been taken only
+           causes the ring to be checked again. */
+        if (NU_Retrieve_Events(&ring_ptr->srr_event, SCK_RX_RING_READY,
+                               NU_OR_CONSUME, &events,
+                               NU_SUSPEND) != NU_SUCCESS)
+        {
+            status = NU_SOCKET_CLOSED;
+            break;
+        }
+    }
+
+    SCK_Rx_Ring_Release(ring_ptr);
+
+    return (status);
+
+} /* SCK_Rx_Ring_Recv */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Rx_Ring_Release
+*
+*   DESCRIPTION
+*
+*       This function releases the reference a receiving task holds on a
+*       receive ring.  If the ring was removed from its socket meanwhile
+*       and this was the last reference, the ring is freed.
+*
+*   INPUTS
+*
+*       *ring_ptr               Pointer to the receive ring.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID SCK_Rx_Ring_Release(SCK_RX_RING *ring_ptr)
+{
+    OPTION      old_preempt;
+    INT         free_ring;
+
+    old_preempt = NU_Change_Preemption(NU_NO_PREEMPT);
+
+    ring_ptr->srr_users--;
+
+    free_ring = ( (ring_ptr->srr_closed) && (ring_ptr->srr_users == 0) );
+
+    NU_Change_Preemption(old_preempt);
+
+    if (free_ring)
+    {
+        /* The datagrams on the ring are freed under the stack semaphore,
+           as SCK_Rx_Ring_Delete does. */
+        if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
+        {
+            SCK_Rx_Ring_Free(ring_ptr);
+
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
+                NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
+                               __FILE__, __LINE__);
+        }
+
+        else
+            NLOG_Error_Log("Failed to obtain semaphore", NERR_SEVERE,
+                           __FILE__, __LINE__);
+    }
+
+} /* SCK_Rx_Ring_Release */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Rx_Ring_Free
+*
+*   DESCRIPTION
+*
+*       This function frees the datagrams on a receive ring that has been
+*       removed from its socket and deletes the ring.  The caller must
+*       hold the stack semaphore.
+*
+*   INPUTS
+*
+*       *ring_ptr               Pointer to the receive ring.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID SCK_Rx_Ring_Free(SCK_RX_RING *ring_ptr)
+{
+    while (ring_ptr->srr_head != ring_ptr->srr_tail)
+    {
+        MEM_One_Buffer_Chain_Free(ring_ptr->srr_slots[ring_ptr->srr_head &
+                                                      SCK_RX_RING_MASK],
+                                  &MEM_Buffer_Freelist);
+
+        ring_ptr->srr_head++;
+    }
+
+    if (NU_Delete_Event_Group(&ring_ptr->srr_event) != NU_SUCCESS)
+        NLOG_Error_Log("Failed to delete receive ring event group",
+                       NERR_SEVERE, __FILE__, __LINE__);
+
+    if (NU_Deallocate_Memory(ring_ptr) != NU_SUCCESS)
+        NLOG_Error_Log("Failed to deallocate memory for receive ring",
+                       NERR_SEVERE, __FILE__, __LINE__);
+
+} /* SCK_Rx_Ring_Free */
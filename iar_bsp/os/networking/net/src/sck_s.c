@@ -123,7 +123,7 @@ INT32 NU_Send(INT socketd, CHAR *buff, UINT16 nbytes, INT16 flags)
 
         /* Send the TCP data */
         if (SCK_Sockets[socketd]->s_protocol == NU_PROTO_TCP)
-            return_status = TCPSS_Send_Data(socketd, buff, nbytes);
+            return_status = TCPSS_Send_Data(socketd, buff, nbytes, 0);
 
         /* Send the UDP data */
         else
@@ -145,6 +145,9 @@ STATUS NU_Shutdown(INT socketd, INT how)
                          (TCP_Ports[ac_sockptr->s_port_index]) )
                         TCP_Ports[ac_sockptr->s_port_index]->p_socketd = -1;
 
+                    /* Drop the wake-ups deferred for the socket. */
+                    SCK_Cancel_Wake(ac_socketd);
+
                     /* Clear the socket pointer for future use */
                     SCK_Sockets[ac_socketd] = NU_NULL;
 
@@ -235,7 +235,7 @@ STATUS NU_Select(INT max_sockets, FD_SET *readfs, FD_SET *writefs,
     }
 
     /* Don't let anyone else in until we are through.  */
-    return_status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    return_status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (return_status != NU_SUCCESS)
     {
@@ -329,7 +329,7 @@ STATUS NU_Select(INT max_sockets, FD_SET *readfs, FD_SET *writefs,
 #endif
 
     /* Release the semaphore. */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
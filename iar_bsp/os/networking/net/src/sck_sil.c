@@ -77,14 +77,14 @@ STATUS NU_Ioctl_SIOCICMPLIMIT(CHAR *dev_name, UINT8 max_errors,
     NU_SUPERVISOR_MODE();
 
     /* Obtain the TCP semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
         /* Set the value. */
         status = Ioctl_SIOCICMPLIMIT(dev_name, max_errors, interval);
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
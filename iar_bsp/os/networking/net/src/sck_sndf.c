@@ -0,0 +1,293 @@
+/*************************************************************************
+*
+*              Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+
+/*************************************************************************
+*
+*   FILE NAME
+*
+*       sck_sndf.c
+*
+*   DESCRIPTION
+*
+*       This file contains the implementation of NU_Send_File.
+*
+*   DATA STRUCTURES
+*
+*       None.
+*
+*   FUNCTIONS
+*
+*       NU_Send_File
+*       SCK_Send_File_Read
+*
+*   DEPENDENCIES
+*
+*       nu_net.h
+*       pcdisk.h
+*
+************************************************************************/
+
+#include "networking/nu_net.h"
+
+#if ( (INCLUDE_TCP == NU_TRUE) && defined(CFG_NU_OS_STOR_FILE_VFS_ENABLE) )
+
+#include "storage/pcdisk.h"
+
+STATIC INT32 SCK_Send_File_Read(INT, NET_BUFFER *, INT32, INT);
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_Send_File
+*
+*   DESCRIPTION
+*
+*       This function transmits part of a file over a TCP connection
+*       without an intermediate application buffer.  The file data is
+*       read directly into Zero Copy buffer chains, and the checksum of
+*       each buffer is computed as it is read so TCP does not have to
+*       make another pass over the data.  The chains are then passed to
+*       TCP as on a Zero Copy socket; the mode of the socket itself is
+*       not changed.  The file is read NET_SEND_FILE_CHUNK_SIZE bytes at
+*       a time, and the stack semaphore is not held during the reads.
+*
+*   INPUTS
+*
+*       socketd                 Specifies a socket descriptor.
+*       fd                      The file descriptor of a file open for
+*                               reading.
+*       offset                  The offset within the file of the first
+*                               byte to send.
+*       count                   The number of bytes to send.  If the file
+*                               ends first, the data up to the end of the
+*                               file is sent.
+*
+*   OUTPUTS
+*
+*       >= 0                    The number of bytes sent.  This is less
+*                               than count if the file ended or, for a
+*                               non-blocking socket, if the connection
+*                               could not accept all the data.  The file
+*                               position is undefined.
+*       NU_INVALID_SOCKET       The socket parameter was not a valid TCP
+*                               socket.
+*       NU_INVALID_PARM         The file could not be positioned at
+*                               offset or the connection is not
+*                               established.
+*       NU_NO_BUFFERS           There are no buffers available and the
+*                               socket is non-blocking.
+*
+*       Otherwise, an error code returned by NU_Send.
+*
+*************************************************************************/
+INT32 NU_Send_File(INT socketd, INT fd, UINT32 offset, UINT32 count)
+{
+    NET_BUFFER  *buf_ptr;
+    INT32       file_size;
+    INT32       chunk;
+    INT32       return_status;
+    UINT32      sent = 0;
+
+    /* Obtain the semaphore and validate the socket */
+    return_status = SCK_Protect_Socket_Block(socketd);
+
+    if (return_status != NU_SUCCESS)
+        return (return_status);
+
+    if (SCK_Sockets[socketd]->s_protocol != NU_PROTO_TCP)
+        return_status = NU_INVALID_SOCKET;
+
+    /* Release the semaphore */
+    SCK_Release_Socket();
+
+    if (return_status != NU_SUCCESS)
+        return (return_status);
+
+    /* Bound the number of bytes to send by the end of the file. */
+    file_size = NU_Seek(fd, 0, PSEEK_END);
+
+    if (file_size < 0)
+        return (NU_INVALID_PARM);
+
+    if (offset >= (UINT32)file_size)
+        return (0);
+
+    if (count > ((UINT32)file_size - offset))
+        count = (UINT32)file_size - offset;
+
+    if (NU_Seek(fd, (INT32)offset, PSEEK_SET) != (INT32)offset)
+        return (NU_INVALID_PARM);
+
+    while (sent < count)
+    {
+        chunk = ((count - sent) < NET_SEND_FILE_CHUNK_SIZE) ?
+                (INT32)(count - sent) : NET_SEND_FILE_CHUNK_SIZE;
+
+        /* Get a chain of buffer chains, each holding up to the MSS of
+         * the connection.  This suspends for buffers if the socket is
+         * blocking.
+         */
+        buf_ptr = NU_NULL;
+
+        chunk = NU_ZC_Allocate_Buffer(&buf_ptr, (UINT16)chunk, socketd);
+
+        if (chunk <= 0)
+        {
+            /* Some buffers may have been allocated before the error. */
+            if (buf_ptr)
+                NU_ZC_Deallocate_Buffer(buf_ptr);
+
+            return_status = (chunk < 0) ? chunk : NU_INVALID_PARM;
+            break;
+        }
+
+        /* Read the file directly into the buffers. */
+        if (SCK_Send_File_Read(fd, buf_ptr, chunk, socketd) != chunk)
+        {
+            NLOG_Error_Log("Failed to read file in NU_Send_File",
+                           NERR_RECOVERABLE, __FILE__, __LINE__);
+
+            NU_ZC_Deallocate_Buffer(buf_ptr);
+
+            return_status = NU_INVALID_PARM;
+            break;
+        }
+
+        /* Obtain the semaphore and validate the socket */
+        return_status = SCK_Protect_Socket_Block(socketd);
+
+        if (return_status == NU_SUCCESS)
+        {
+            /* The socket may have been closed and reused while the file
+             * was being read.
+             */
+            if (SCK_Sockets[socketd]->s_protocol == NU_PROTO_TCP)
+                return_status = TCPSS_Send_Data(socketd, (CHAR*)buf_ptr,
+                                                (UINT16)chunk, SF_ZC_MODE);
+            else
+                return_status = NU_INVALID_SOCKET;
+
+            /* Release the semaphore */
+            SCK_Release_Socket();
+        }
+
+        /* If no data was sent, the buffers still belong to the caller. */
+        if (return_status <= 0)
+        {
+            NU_ZC_Deallocate_Buffer(buf_ptr);
+            break;
+        }
+
+        sent += (UINT32)return_status;
+
+        /* If only part of the data was sent, TCP has freed the remaining
+         * buffers.  Return the number of bytes sent so the caller can
+         * resume from there.
+         */
+        if (return_status < chunk)
+            break;
+    }
+
+    if (sent != 0)
+        return_status = (INT32)sent;
+
+    return (return_status);
+
+} /* NU_Send_File */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       SCK_Send_File_Read
+*
+*   DESCRIPTION
+*
+*       This function reads data from a file into a chain of Zero Copy
+*       buffer chains, filling each buffer as NU_ZC_Bytes_Left specifies,
+*       and accumulates the checksum of the data of each buffer chain in
+*       its parent buffer.  Each buffer is summed right after it is read,
+*       while the data is still in the cache.
+*
+*   INPUTS
+*
+*       fd                      The file descriptor.
+*       *buf_ptr                Pointer to the chain of buffer chains.
+*       nbytes                  The number of bytes to read.
+*       socketd                 The socket the buffers were allocated
+*                               for.
+*
+*   OUTPUTS
+*
+*       The number of bytes read.
+*
+*************************************************************************/
+STATIC INT32 SCK_Send_File_Read(INT fd, NET_BUFFER *buf_ptr, INT32 nbytes,
+                                INT socketd)
+{
+    NET_BUFFER  *seg_ptr;
+    NET_BUFFER  *parent = buf_ptr;
+    UINT32      len, sum;
+    UINT32      chain_len = 0;
+    INT32       total = 0;
+
+    for (seg_ptr = buf_ptr;
+         (seg_ptr != NU_NULL) && (total < nbytes);
+         seg_ptr = seg_ptr->next_buffer)
+    {
+        /* The first buffer of each chain holds the sum of the chain.
+         * The sum starts at the data; the TCP header is added to it
+         * when the header is built.
+         */
+        if (seg_ptr->mem_flags & NET_PARENT)
+        {
+            parent = seg_ptr;
+            chain_len = 0;
+
+            parent->chk_sum = 0;
+            parent->sum_data_ptr = parent->data_ptr;
+            parent->mem_flags |= NET_BUF_SUM;
+        }
+
+        len = NU_ZC_Bytes_Left(buf_ptr, seg_ptr, socketd);
+
+        if (len > (UINT32)(nbytes - total))
+            len = (UINT32)(nbytes - total);
+
+        if ( (len == 0) ||
+             (NU_Read(fd, (CHAR*)seg_ptr->data_ptr, (INT32)len) != (INT32)len) )
+            break;
+
+        sum = TLS_Header_Memsum(seg_ptr->data_ptr, len);
+
+        /* If this buffer starts at an odd offset in the chain, its bytes
+         * fall in the opposite halves of the 16-bit words of the sum.
+         * Fold the sum and swap its bytes (RFC 1071).
+         */
+        if (chain_len & 1)
+        {
+            sum = (sum & 0xffff) + (sum >> 16);
+            sum = (sum & 0xffff) + (sum >> 16);
+            sum = ((sum & 0xff) << 8) | (sum >> 8);
+        }
+
+        parent->chk_sum += sum;
+
+        chain_len += len;
+        total += (INT32)len;
+    }
+
+    return (total);
+
+} /* SCK_Send_File_Read */
+
+#endif
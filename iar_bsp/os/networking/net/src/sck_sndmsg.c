@@ -223,7 +223,7 @@ INT32 NU_Sendmsg(INT socketd, const msghdr *msg, INT16 flags)
         if (sockptr->s_protocol == NU_PROTO_TCP)
         {
             return_status = TCPSS_Send_Data(socketd, msg->msg_iov,
-                                            msg->msg_iovlen);
+                                            msg->msg_iovlen, 0);
         }
 
 #if ( (INCLUDE_UDP == NU_TRUE) || (INCLUDE_IP_RAW == NU_TRUE) )
@@ -186,7 +186,7 @@ INT NU_Socket(INT16 family, INT16 type, INT16 protocol)
 #endif
 
     /* Don't let any other users in until we are done.  */
-    return_socket = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    return_socket = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (return_socket == NU_SUCCESS)
     {
@@ -291,7 +291,7 @@ INT NU_Socket(INT16 family, INT16 type, INT16 protocol)
             }
         }
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                             __FILE__, __LINE__);
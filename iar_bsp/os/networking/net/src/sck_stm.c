@@ -0,0 +1,163 @@
+/*************************************************************************
+*
+*              Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+
+/*************************************************************************
+* FILE NAME
+*
+*       sck_stm.c
+*
+* DESCRIPTION
+*
+*       This file contains the implementation of NU_Send_To_Multiple.
+*
+* DATA STRUCTURES
+*
+*       None.
+*
+* FUNCTIONS
+*
+*       NU_Send_To_Multiple
+*
+* DEPENDENCIES
+*
+*       nu_net.h
+*
+************************************************************************/
+
+#include "networking/nu_net.h"
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_Send_To_Multiple
+*
+*   DESCRIPTION
+*
+*       This function transmits a vector of datagrams over a UDP socket.
+*       The stack semaphore is obtained and the socket validated once for
+*       the whole vector.  Each datagram is sent through UDP_Send, which
+*       already keeps the route cached in the UDP port while the
+*       destination does not change, so no route lookup is added for the
+*       vector.  The result of each datagram is returned in its mm_status
+*       member, and a failed datagram does not prevent the remaining ones
+*       from being sent.
+*
+*       If the mm_addr member of a datagram is NU_NULL, the datagram is
+*       sent to the address the socket is connected to.
+*
+*   INPUTS
+*
+*       socketd                 Specifies a socket descriptor
+*       *msgs                   Pointer to the array of datagrams
+*       count                   The number of datagrams in the array
+*       flags                   This parameter is used for socket
+*                               compatibility we are currently not making
+*                               any use of it
+*
+*   OUTPUTS
+*
+*       >= 0                    The number of datagrams sent.
+*       NU_INVALID_PARM         msgs is NU_NULL or count is zero.
+*       NU_INVALID_SOCKET       The socket parameter was not a valid UDP
+*                               socket.
+*
+*       If no datagram could be sent, the status of the first datagram
+*       is returned.  See NU_Send_To for the values of mm_status.
+*
+*************************************************************************/
+INT32 NU_Send_To_Multiple(INT socketd, NU_MMSG *msgs, UINT16 count,
+                          INT16 flags)
+{
+    INT32               return_status;
+    INT32               sent = 0;
+    UINT16              i;
+
+#if (INCLUDE_NET_API_ERR_CHECK == NU_TRUE)
+
+    if ( (msgs == NU_NULL) || (count == 0) )
+        return (NU_INVALID_PARM);
+
+#endif
+
+    /* Obtain the semaphore and validate the socket */
+    return_status = SCK_Protect_Socket_Block(socketd);
+
+    if (return_status == NU_SUCCESS)
+    {
+        /*  Clean up warnings.  This parameter is used for socket compatibility
+         *  but we are currently not making any use of it.  */
+        UNUSED_PARAMETER(flags);
+
+        if (SCK_Sockets[socketd]->s_protocol != NU_PROTO_UDP)
+        {
+            /* Release the semaphore */
+            SCK_Release_Socket();
+
+            return (NU_INVALID_SOCKET);
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            /* The socket may have been closed while this task was
+             * suspended for buffers.
+             */
+            if (return_status == NU_SOCKET_CLOSED)
+            {
+                msgs[i].mm_status = NU_SOCKET_CLOSED;
+                continue;
+            }
+
+#if (INCLUDE_NET_API_ERR_CHECK == NU_TRUE)
+
+            if ( ((msgs[i].mm_buff == NU_NULL) && (msgs[i].mm_len != 0)) ||
+                 ((msgs[i].mm_addr) && (msgs[i].mm_addr->family != SK_FAM_IP)
+#if (INCLUDE_IPV6 == NU_TRUE)
+                  && (msgs[i].mm_addr->family != SK_FAM_IP6)
+#endif
+                 ) )
+            {
+                msgs[i].mm_status = NU_INVALID_PARM;
+                continue;
+            }
+
+#endif
+
+            if (msgs[i].mm_addr)
+                return_status = UDP_Send_Data(socketd, msgs[i].mm_buff,
+                                              msgs[i].mm_len, msgs[i].mm_addr);
+
+            else if (SCK_Sockets[socketd]->s_state & SS_ISCONNECTED)
+                return_status = UDP_Send_Datagram(socketd, msgs[i].mm_buff,
+                                                  (INT32)msgs[i].mm_len);
+
+            else
+                return_status = NU_NOT_CONNECTED;
+
+            msgs[i].mm_status = return_status;
+
+            if (return_status >= 0)
+                sent ++;
+        }
+
+        /* Release the semaphore */
+        SCK_Release_Socket();
+
+        if ( (sent != 0) || (msgs[0].mm_status >= 0) )
+            return_status = sent;
+        else
+            return_status = msgs[0].mm_status;
+    }
+
+    /* return to caller */
+    return (return_status);
+
+} /* NU_Send_To_Multiple */
@@ -78,14 +78,14 @@ STATUS NU_Ioctl_SIOCSETVLANPRIO(SCK_IOCTL_OPTION *option)
 	NU_SUPERVISOR_MODE();
 
 	/* Obtain the TCP semaphore. */
-	status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+	status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
 	if (status == NU_SUCCESS)
 	{
 		/* Set the VLAN priority. */
 		status = Ioctl_SIOCSETVLANPRIO(option);
 
-		if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+		if (NET_Release_Stack_Lock() != NU_SUCCESS)
 		{
 			NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
 						   __FILE__, __LINE__);
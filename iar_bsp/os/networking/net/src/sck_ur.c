@@ -72,7 +72,7 @@ STATUS NU_Update_Route(const UINT8 *ip_address, const UINT8 *gateway,
 
     NU_SUPERVISOR_MODE();
 
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -93,7 +93,7 @@ STATUS NU_Update_Route(const UINT8 *ip_address, const UINT8 *gateway,
 #endif
         status = NU_INVAL;
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
 
@@ -35,6 +35,7 @@
 *       TCP_Check_OOO_List
 *       TCP_Cleanup
 *       TCP_Do
+*       TCP_Deliver_Packet
 *       TCP_Process_Invalid_TSYN
 *       TCP_Enter_STWAIT
 *       TCP_Estab1986
@@ -44,6 +45,7 @@
 *       TCP_Interpret
 *       TCP_Make_Port
 *       TCP_OOO_Packet
+*       TCP_OOO_Remove_Ranges
 *       TCP_Reset_FIN
 *       TCP_Retransmit
 *       TCP_Send_Retransmission
@@ -102,17 +104,19 @@ STATIC  INT16 TCP_Find_Empty_Port(const struct TASK_TABLE_STRUCT *);
 STATIC  STATUS  TCP_Parse_SYN_Options(TCP_PORT *, TCPLAYER *, UINT16);
 STATIC  VOID    TCP_Xmit_Timer(TCP_PORT *, UINT32);
 STATIC  INT16   TCP_Do_Recv (TCP_PORT *, TCPLAYER *, NET_BUFFER *, UINT16 , UINT16);
+STATIC  INT16   TCP_Deliver_Packet(VOID *, NET_BUFFER *, UINT16, VOID *, INT16);
 STATIC  VOID    TCP_Process_Invalid_TSYN(TCP_PORT *, TCPLAYER *);
 STATIC  VOID    TCP_Enter_STWAIT(TCP_PORT *);
 STATIC  STATUS  TCP_Send (TCP_PORT *pport, NET_BUFFER*);
 STATIC  UINT16  TCP_Enqueue (struct sock_struct *);
-STATIC  UINT16  TCP_Rmqueue (TCP_WINDOW *wind, UINT32);
+STATIC  UINT32  TCP_Rmqueue (TCP_WINDOW *wind, UINT32);
 STATIC  STATUS  TCP_Send_Retransmission(NET_BUFFER *, TCP_PORT *);
 STATIC VOID     TCP_Schedule_ACK(TCP_PORT *, TCPLAYER *, UINT16, INT);
 
 #if (INCLUDE_TCP_OOO == NU_TRUE)
 STATIC  VOID    TCP_Check_OOO_List(TCP_PORT *);
 STATIC  INT16   TCP_OOO_Packet(TCP_PORT *, UINT32);
+STATIC  VOID    TCP_OOO_Remove_Ranges(TCP_PORT *, UINT16, UINT16);
 #endif
 
 #if ( (NET_INCLUDE_DSACK == NU_TRUE) && (INCLUDE_TCP_OOO == NU_TRUE) )
@@ -306,7 +310,12 @@ INT16 TCP_Interpret(NET_BUFFER *buf_ptr, VOID *tcp_chk, INT16 family,
 *
 *   DESCRIPTION
 *
-*       Deliver the incoming packet.
+*       Deliver the incoming packet, then report any change in the state
+*       of the connection's socket to the event set the socket is in.
+*       The socket is reported readable only if data was queued or its
+*       state or error changed, and writable only if the send space grew
+*       or the connection state changed, so a pure ACK that changes
+*       neither does not wake the set.
 *
 *   INPUTS
 *
@@ -323,6 +332,93 @@ INT16 TCP_Interpret(NET_BUFFER *buf_ptr, VOID *tcp_chk, INT16 family,
 *************************************************************************/
 INT16 TCP_Do(VOID *input, NET_BUFFER *buf_ptr, UINT16 hlen, VOID *tcp_chk,
              INT16 state)
+{
+    INT16               ret;
+    INT                 socketd = -1;
+    UINT16              events = 0;
+    UINT32              recvbytes = 0;
+    UINT16              sck_state = 0;
+    INT32               sck_error = 0;
+    INT32               space = 0;
+    UINT8               prt_state = 0;
+    TCP_PORT            *prt = (TCP_PORT*)input;
+    struct sock_struct  *sockptr = NU_NULL;
+
+    /* The port may be freed while the packet is processed, so save the
+     * socket and the state the event set depends on now.  A listening
+     * socket becomes readable when the new connection completes, which
+     * is reported by TCP_Deliver_Packet.
+     */
+    if (state != SLISTEN)
+    {
+        socketd = prt->p_socketd;
+
+        if (socketd >= 0)
+            sockptr = SCK_Sockets[socketd];
+
+        if ( (sockptr != NU_NULL) && (sockptr->s_evs_entry != NU_NULL) )
+        {
+            recvbytes = sockptr->s_recvbytes;
+            sck_state = sockptr->s_state;
+            sck_error = sockptr->s_error;
+            space = (INT32)prt->out.size - prt->out.contain;
+            prt_state = prt->state;
+        }
+
+        else
+            sockptr = NU_NULL;
+    }
+
+    ret = TCP_Deliver_Packet(input, buf_ptr, hlen, tcp_chk, state);
+
+    /* The connection may have been closed and the port released, in which
+     * case TCP_Cleanup has already reported the socket.
+     */
+    if ( (sockptr != NU_NULL) && (SCK_Sockets[socketd] == sockptr) &&
+         (prt->p_socketd == socketd) )
+    {
+        if ( (sockptr->s_recvbytes > recvbytes) ||
+             (sockptr->s_state != sck_state) ||
+             (sockptr->s_error != sck_error) )
+            events |= NU_EVS_READABLE;
+
+        if ( ((INT32)prt->out.size - prt->out.contain > space) ||
+             (prt->state != prt_state) )
+            events |= NU_EVS_WRITABLE;
+
+        if (events)
+            SCK_Notify_Events(socketd, events);
+    }
+
+    return (ret);
+
+} /* TCP_Do */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_Deliver_Packet
+*
+*   DESCRIPTION
+*
+*       Deliver the incoming packet.
+*
+*   INPUTS
+*
+*       *input                  Pointer to the input
+*       *buf_ptr                Pointer to the net buffer list
+*       hlen                    The header length
+*       *tcp_chk                The pointer to the tcp information
+*       state                   The stats of the socket
+*
+*   OUTPUTS
+*
+*       INT16                   0 or 1
+*
+*************************************************************************/
+STATIC INT16 TCP_Deliver_Packet(VOID *input, NET_BUFFER *buf_ptr,
+                                UINT16 hlen, VOID *tcp_chk, INT16 state)
 {
     struct TASK_TABLE_STRUCT    *task_entry;
     struct SCK_TASK_ENT         *ssp_task;
@@ -547,6 +643,14 @@ INT16 TCP_Do(VOID *input, NET_BUFFER *buf_ptr, UINT16 hlen, VOID *tcp_chk,
                     /* Get a pointer to the new port structure. */
                     prt = TCP_Ports[portlist_num];
 
+#if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
+
+                    /* Use the congestion control module of the parent. */
+                    prt->p_cc_ops =
+                        TCP_Ports[listen_socket->s_port_index]->p_cc_ops;
+
+#endif
+
 #if (NET_INCLUDE_SACK == NU_TRUE)
 
                     /* If SACK is disabled on the parent, disable it on the
@@ -845,6 +949,11 @@ INT16 TCP_Do(VOID *input, NET_BUFFER *buf_ptr, UINT16 hlen, VOID *tcp_chk,
                     /*  Indicate the connection is complete.  This one can be accepted.*/
                     task_entry->stat_entry[tasklist_num] = SEST;
 
+                    /* The listening socket is now readable. */
+                    if (SCK_Sockets[task_entry->socketd] != NU_NULL)
+                        SCK_Notify_Events(task_entry->socketd,
+                                          NU_EVS_READABLE);
+
                     /* Remove the suspended task from the accept list
                        and move it to the sockets TX list so it can be
                        awakened below. */
@@ -1870,7 +1979,7 @@ INT16 TCP_Do(VOID *input, NET_BUFFER *buf_ptr, UINT16 hlen, VOID *tcp_chk,
 
     return (0);
 
-} /* TCP_Do */
+} /* TCP_Deliver_Packet */
 
 /*************************************************************************
 *
@@ -2252,12 +2361,10 @@ STATIC INT16 TCP_Do_Recv (TCP_PORT *prt, TCPLAYER *p, NET_BUFFER *buf_ptr,
                             if (tcp_buf)
                             {
                                 /* RFC 2581 - section 3.2 - When the third
-                                 * duplicate ACK is received, set ssthresh to
-                                 * no more than max(FlightSize / 2, 2*SMSS).
+                                 * duplicate ACK is received, the congestion
+                                 * control module reduces ssthresh.
                                  */
-                                prt->p_ssthresh =
-                                    ((UINT16)(prt->out.contain >> 1) > (prt->p_smss << 1)) ?
-                                    (prt->out.contain >> 1) : (prt->p_smss << 1);
+                                prt->p_cc_ops->tcc_on_loss(prt);
 
 #if (INCLUDE_NEWRENO == NU_TRUE)
                                 if (!(prt->portFlags & TCP_SACK))
@@ -2781,21 +2888,11 @@ STATIC STATUS TCP_Parse_SYN_Options(TCP_PORT *prt, TCPLAYER *p, UINT16 hlen)
 
 #if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
 
-    /* If congestion control is not disabled. */
+    /* If congestion control is not disabled, let the congestion control
+     * module set the initial cwnd and ssthresh.
+     */
     if (!(prt->portFlags & TCP_DIS_CONGESTION))
-    {
-        /* RFC 2581 - section 3.1 - The initial value of cwnd, MUST be less
-         * than or equal to 2*SMSS bytes and MUST NOT be more than 2 segments.
-         */
-        prt->p_cwnd = prt->p_smss;
-
-        /* RFC 2581 - section 3.1 - The initial value of ssthresh MAY be
-         * arbitrarily high (for example, some implementations use the size
-         * of the advertised window), but it may be reduced in response to
-         * congestion.
-         */
-        prt->p_ssthresh = TCP_SLOW_START_THRESHOLD;
-    }
+        prt->p_cc_ops->tcc_init(prt);
 #endif
 
     return (status);
@@ -3666,18 +3763,17 @@ STATIC INT16 TCP_ACK_Check(TCP_PORT *prt, TCPLAYER *tcp_pkt)
     UINT32      ak;
     INT16       status;
 
-#if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
-    INT32       new_cwnd;
-#endif
-
 #if ( (NET_INCLUDE_TIMESTAMP == NU_TRUE) || (NET_INCLUDE_SACK == NU_TRUE) )
     UINT8       opt_len;
     UINT8       *opt_ptr;
     UINT8       *pkt_ptr;
 #endif
 
+#if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
+    UINT32      bytes_acked;
+#endif
+
 #if (INCLUDE_NEWRENO == NU_TRUE)
-    INT32       bytes_acked;
     TCP_BUFFER  *tcp_buf;
     INT         i;
 #endif
@@ -3849,7 +3945,7 @@ STATIC INT16 TCP_ACK_Check(TCP_PORT *prt, TCPLAYER *tcp_pkt)
      * update prt->out.nxt to the new next sequence number for outgoing.
      * Update send window.
      */
-#if (INCLUDE_NEWRENO == NU_TRUE)
+#if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
     bytes_acked =
 #endif
     TCP_Rmqueue(&prt->out, ak);
@@ -3950,43 +4046,11 @@ STATIC INT16 TCP_ACK_Check(TCP_PORT *prt, TCPLAYER *tcp_pkt)
 #endif
             }
 
-            /* Slow Start & Congestion Avoidance */
+            /* Slow Start & Congestion Avoidance are performed by the
+             * congestion control module.
+             */
             else
-            {
-                /* RFC 2581 - section 3.1 - The congestion avoidance algorithm
-                 * is used when cwnd > ssthresh.  Slow start ends when cwnd
-                 * exceeds ssthresh or when congestion is observed.
-                 */
-                if (prt->p_cwnd > prt->p_ssthresh)
-                {
-                    /* RFC 2581 - section 3.1 - During Congestion Avoidance,
-                     * cwnd is incremented by 1 full sized segment per
-                     * round-trip time (RTT).
-                     */
-                    new_cwnd = (prt->p_smss * prt->p_smss) / prt->p_cwnd;
-
-                    /* RFC 2581 - section 3.1 - If the above formula yields zero,
-                     * the result should be rounded up to 1 byte.
-                     */
-                    if (new_cwnd == 0)
-                        new_cwnd = 1;
-
-                    /* If incrementing the congestion window will not wrap the
-                     * value, increment.
-                     */
-                    if ((prt->p_cwnd + (UINT32)new_cwnd) > prt->p_cwnd)
-                        prt->p_cwnd += (UINT32)new_cwnd;
-                }
-
-                /* RFC 2581 - section 3.1 - The slow start algorithm is used
-                 * when cwnd <= ssthresh.  When cwnd and ssthresh are equal
-                 * the sender may use either slow start or congestion avoidance.
-                 * During slow start, a TCP increments cwnd by at most SMSS
-                 * bytes for each ACK received that acknowledges new data.
-                 */
-                else
-                    prt->p_cwnd += prt->p_smss;
-            }
+                prt->p_cc_ops->tcc_on_ack(prt, bytes_acked);
 
             /* Reset duplicate ACKs since a non-duplicate ACK has been
              * received
@@ -4103,63 +4167,47 @@ STATIC INT16 TCP_ACK_Check(TCP_PORT *prt, TCPLAYER *tcp_pkt)
 *************************************************************************/
 STATIC VOID TCP_Find_Duplicate_Data(TCP_PORT *prt, UINT32 seq, UINT16 dlen)
 {
-    NET_BUFFER  *curr_buf, *saved_buf = NU_NULL;
+    TCP_OOO_RANGE   *range;
+    UINT16          i;
 
     /* Set the left edge to the sequence number received. */
     prt->left_edge = seq;
 
-    /* Get a pointer to the first packet on the Out of Order List. */
-    curr_buf = prt->in.ooo_list.head;
-
-    /* Since the Out of Order list is ordered, if the sequence number of
-     * the first buffer is greater than the incoming sequence number,
-     * then this data is not contained in the list already.
+    /* Since the ranges of the Out of Order List are ordered and
+     * disjoint, only the first range that ends after the incoming
+     * sequence number can contain the start of the incoming data.
      */
-    if (curr_buf->mem_seqnum <= seq)
+    for (i = 0; i < prt->p_ooo_range_count; i++)
     {
-        /* While there are packets on the Out of Order List. */
-        while (curr_buf)
-        {
-            /* If the sequence number of this segment is greater than
-             * the right edge of the incoming packet exit the loop.
-             */
-            if (curr_buf->mem_seqnum > (seq + dlen))
-            {
-                break;
-            }
-
-            /* Save the current buffer. */
-            saved_buf = curr_buf;
+        range = &prt->p_ooo_ranges[i];
 
-            /* Move on to the next buffer. */
-            curr_buf = curr_buf->next;
-        }
-
-        /* If a buffer was found. */
-        if ( (saved_buf) &&
-             ((saved_buf->mem_seqnum + saved_buf->mem_tcp_data_len) > seq) )
+        if (INT32_CMP(range->otr_right, seq) > 0)
         {
-            /* If this buffer covers more data than was sent in the
-             * incoming packet, truncate the right edge at the length
-             * of the incoming packet.
-             */
-            if ((saved_buf->mem_seqnum + saved_buf->mem_tcp_data_len) >
-                (seq + dlen))
+            /* If this range covers the start of the incoming data. */
+            if (INT32_CMP(range->otr_left, seq) <= 0)
             {
-                prt->right_edge = seq + dlen;
-            }
+                /* If this range covers more data than was sent in the
+                 * incoming packet, truncate the right edge at the length
+                 * of the incoming packet.
+                 */
+                if (INT32_CMP(range->otr_right, (seq + dlen)) > 0)
+                {
+                    prt->right_edge = seq + dlen;
+                }
 
-            /* Otherwise, the right edge is the sequence number plus length
-             * of this packet on the Out of Order list.
-             */
-            else
-            {
-                prt->right_edge =
-                    saved_buf->mem_seqnum + saved_buf->mem_tcp_data_len;
+                /* Otherwise, the right edge is the right edge of the
+                 * range.
+                 */
+                else
+                {
+                    prt->right_edge = range->otr_right;
+                }
+
+                /* Indicate that a DSACK should be built. */
+                prt->portFlags |= TCP_REPORT_DSACK;
             }
 
-            /* Indicate that a DSACK should be built. */
-            prt->portFlags |= TCP_REPORT_DSACK;
+            break;
         }
     }
 
@@ -4200,7 +4248,6 @@ STATIC INT16 TCP_Estab1986(TCP_PORT *prt, NET_BUFFER *buf_ptr, UINT16 tlen,
     TCPLAYER    *pkt;
     UINT32      to_drop = 0;
     UINT16      MEM_Available;
-    struct SCK_TASK_ENT *task_entry;    /* task entry for list operations */
 
     /*  Calculate the length of the data received.  */
     buf_ptr->mem_tcp_data_len = dlen = (UINT16)(tlen - hlen);
@@ -4422,22 +4469,8 @@ STATIC INT16 TCP_Estab1986(TCP_PORT *prt, NET_BUFFER *buf_ptr, UINT16 tlen,
         /* Check the FIN bit to see if this connection is closing. */
         TCP_Check_FIN(prt, pkt);
 
-        /* Send a message to to let the user know there is data.  */
-        if (SCK_Sockets[prt->p_socketd]->s_RXTask_List.flink != NU_NULL)
-        {
-            task_entry = DLL_Dequeue(&SCK_Sockets[prt->p_socketd]->s_RXTask_List);
-
-            status = NU_Resume_Task(task_entry->task);
-
-            if (status != NU_SUCCESS)
-            {
-                NLOG_Error_Log("Failed to resume task", NERR_SEVERE,
-                               __FILE__, __LINE__);
-
-                NET_DBG_Notify(status, __FILE__, __LINE__,
-                               NU_Current_Task_Pointer(), NU_NULL);
-            }
-        }
+        /* Let the user know there is data. */
+        SCK_Resume_Receiver(prt->p_socketd);
 
     } /* end if */
 
@@ -4830,24 +4863,11 @@ VOID TCP_Retransmit(TCP_PORT *prt)
                     if (!(prt->portFlags & TCP_DIS_CONGESTION))
                     {
                         /* RFC 2581 - section 3.1 - When a TCP sender detects segment
-                         * loss using the retransmission timer, the value of ssthresh
-                         * MUST be set to no more than MAX(FlightSize / 2, 2 * SMSS)
-                         * where FlightSize is the amount of outstanding data in the
-                         * network.
-                         */
-                        prt->p_ssthresh =
-                            ((UINT16)(prt->out.contain >> 1) > (prt->p_smss << 1)) ?
-                            (prt->out.contain >> 1) : (prt->p_smss << 1);
-
-                        /* RFC 2581 - section 3.1 - Furthermore, upon a timeout cwnd
-                         * MUST be set to no more than the loss window, LW, which
-                         * equals 1 full-sized segment (regardless of the value of IW).
-                         * Therefore, after retransmitting the dropped segment the TCP
-                         * sender uses the slow start algorithm to increase the window
-                         * from 1 full-sized segment to the new value of ssthresh, at
-                         * which point congestion avoidance again takes over.
+                         * loss using the retransmission timer, ssthresh is reduced
+                         * and cwnd is set to the loss window by the congestion
+                         * control module.
                          */
-                        prt->p_cwnd = prt->p_smss;
+                        prt->p_cc_ops->tcc_on_rto(prt);
 
 #if (INCLUDE_NEWRENO == NU_TRUE)
 
@@ -5431,6 +5451,13 @@ VOID TCP_ACK_It(TCP_PORT *prt, INT force)
 *       those retrieved from this list) will then be acknowledged at one
 *       time.
 *
+*       The list is indexed by the ranges of contiguous data it holds.
+*       A packet that overlaps or abuts a range is inserted within that
+*       range, which is then coalesced with any ranges the packet now
+*       reaches, so only the buffers of one range are ever searched.
+*       A packet that adds no data to the list, or that would need a
+*       new range when TCP_MAX_OOO_RANGES are in use, is rejected.
+*
 *   INPUTS
 *
 *       *prt                    Pointer to a port.
@@ -5446,67 +5473,140 @@ VOID TCP_ACK_It(TCP_PORT *prt, INT force)
 *************************************************************************/
 STATIC INT16 TCP_OOO_Packet(TCP_PORT *prt, UINT32 seq)
 {
-    TCP_WINDOW  *wind;
-    NET_BUFFER  *buf_ptr;
-    NET_BUFFER  *curr_buf, *prev_buf = NU_NULL;
+    TCP_WINDOW      *wind;
+    TCP_OOO_RANGE   *range;
+    NET_BUFFER      *buf_ptr;
+    NET_BUFFER      *curr_buf, *prev_buf;
+    UINT32          end;
+    UINT16          i, j;
 
     wind = &prt->in;
 
-    /* First check to see if there are currently any packets in the out of order
-       list.  If not then add this one and return.  Else search for the position
-       at which this buffer should be inserted. */
-    if (wind->ooo_list.head == NU_NULL)
+    /* The packet is at the head of the buffer list. */
+    if (MEM_Buffer_List.head == NU_NULL)
+        return (-1);
+
+    end = seq + MEM_Buffer_List.head->mem_tcp_data_len;
+
+    /* Find the first range that does not end before this packet starts.
+       All the ranges before it hold data that precedes this packet. */
+    i = 0;
+
+    while ( (i < prt->p_ooo_range_count) &&
+            (INT32_CMP(prt->p_ooo_ranges[i].otr_right, seq) < 0) )
     {
-        /* Move the buffer from the buffer_list to the out of order list. */
-        buf_ptr = MEM_Update_Buffer_Lists(&MEM_Buffer_List, &wind->ooo_list);
+        i++;
     }
-    else
-    {
-        curr_buf = wind->ooo_list.head;
 
-        /* Search for the first packet that has a sequence number that is not
-           less than the sequence number of the packet that is being inserted.
-         */
-        while ( (curr_buf != NU_NULL) &&
-                (INT32_CMP(seq, curr_buf->mem_seqnum) > 0) )
+    range = &prt->p_ooo_ranges[i];
+
+    /* The last buffer of the preceding range is the buffer before the
+       first buffer of this range on the list. */
+    prev_buf = (i == 0) ? NU_NULL : prt->p_ooo_ranges[i - 1].otr_last;
+
+    /* If this packet overlaps or abuts the range, it belongs to it. */
+    if ( (i < prt->p_ooo_range_count) &&
+         (INT32_CMP(range->otr_left, end) <= 0) )
+    {
+        /* If the range already holds all the data in this packet, then
+           return a failure status. */
+        if ( (INT32_CMP(range->otr_left, seq) <= 0) &&
+             (INT32_CMP(end, range->otr_right) <= 0) )
         {
-            prev_buf = curr_buf;
-            curr_buf = (NET_BUFFER *)curr_buf->next;
+            return (-1);
         }
 
-        /* If a packet with a larger sequence number could not be found then add
-           the new packet to the end of the list. */
-        if (curr_buf == NU_NULL)
+        /* Packets most often extend the range at its right edge, so
+           check that before searching the range for the first packet
+           that has a sequence number that is not less than the sequence
+           number of the packet that is being inserted. */
+        if (INT32_CMP(seq, range->otr_last->mem_seqnum) > 0)
+        {
+            prev_buf = range->otr_last;
+            curr_buf = (NET_BUFFER *)range->otr_last->next;
+        }
+        else
         {
-            /* Move the buffer from the buffer_list to the out of order list. */
-            buf_ptr = MEM_Update_Buffer_Lists(&MEM_Buffer_List, &wind->ooo_list);
+            curr_buf = range->otr_first;
+
+            while (INT32_CMP(seq, curr_buf->mem_seqnum) > 0)
+            {
+                prev_buf = curr_buf;
+                curr_buf = (NET_BUFFER *)curr_buf->next;
+            }
         }
+    }
 
-        /* If a packet with this sequence number is already in the list, then
-           return a failure status. */
-        else if (INT32_CMP(seq, curr_buf->mem_seqnum) == 0)
+    /* Otherwise, the packet starts a new range before this one. */
+    else
+    {
+        if (prt->p_ooo_range_count >= TCP_MAX_OOO_RANGES)
         {
             return (-1);
         }
-        else
+
+        curr_buf = (i < prt->p_ooo_range_count) ? range->otr_first : NU_NULL;
+    }
+
+    /* Insert this buffer into the list. */
+    buf_ptr = (NET_BUFFER *)MEM_Buffer_Dequeue(&MEM_Buffer_List);
+
+    if (MEM_Buffer_Insert(&wind->ooo_list, buf_ptr, curr_buf,
+                          prev_buf) == NU_NULL)
+    {
+        NLOG_Error_Log("Failed to insert buffer into OOO list",
+                       NERR_SEVERE, __FILE__, __LINE__);
+
+        return (-1);
+    }
+
+    /* Initialize the sequence field in the buffer. */
+    buf_ptr->mem_seqnum = seq;
+
+    if (i < prt->p_ooo_range_count)
+    {
+        /* If the packet was placed at either end of its range, it is the
+           new end of the range. */
+        if (prev_buf == range->otr_last)
+            range->otr_last = buf_ptr;
+
+        else if (curr_buf == range->otr_first)
+            range->otr_first = buf_ptr;
+
+        if (INT32_CMP(seq, range->otr_left) < 0)
+            range->otr_left = seq;
+
+        if (INT32_CMP(end, range->otr_right) > 0)
         {
-            /* Insert this buffer into the list. */
-            buf_ptr = (NET_BUFFER *)MEM_Buffer_Dequeue(&MEM_Buffer_List);
+            range->otr_right = end;
 
-            /* Ensure the buffer was put onto the list. */
-            if (buf_ptr)
+            /* Coalesce the following ranges that this packet reaches. */
+            while ( (i + 1 < prt->p_ooo_range_count) &&
+                    (INT32_CMP(range[1].otr_left, range->otr_right) <= 0) )
             {
-                if (MEM_Buffer_Insert(&wind->ooo_list, buf_ptr, curr_buf,
-                                      prev_buf) == NU_NULL)
-                    NLOG_Error_Log("Failed to insert buffer into OOO list",
-                                   NERR_SEVERE, __FILE__, __LINE__);
+                if (INT32_CMP(range[1].otr_right, range->otr_right) > 0)
+                    range->otr_right = range[1].otr_right;
+
+                range->otr_last = range[1].otr_last;
+
+                TCP_OOO_Remove_Ranges(prt, (UINT16)(i + 1), 1);
             }
         }
     }
 
-    /* Initialize the sequence field in the buffer. */
-    if (buf_ptr != NU_NULL)
-        buf_ptr->mem_seqnum = seq;
+    else
+    {
+        /* Make room for the new range. */
+        for (j = prt->p_ooo_range_count; j > i; j--)
+            prt->p_ooo_ranges[j] = prt->p_ooo_ranges[j - 1];
+
+        prt->p_ooo_range_count++;
+
+        range->otr_first = buf_ptr;
+        range->otr_last = buf_ptr;
+        range->otr_left = seq;
+        range->otr_right = end;
+    }
 
 #if (INCLUDE_IPV6 == NU_TRUE)
 
@@ -5523,6 +5623,39 @@ STATIC INT16 TCP_OOO_Packet(TCP_PORT *prt, UINT32 seq)
 
 } /* TCP_OOO_Packet */
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_OOO_Remove_Ranges
+*
+*   DESCRIPTION
+*
+*       Removes ranges from the out of order range index of a port.  The
+*       buffers of the ranges are not affected.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to a port.
+*       index                   The index of the first range to remove.
+*       count                   The number of ranges to remove.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_OOO_Remove_Ranges(TCP_PORT *prt, UINT16 index, UINT16 count)
+{
+    UINT16  i;
+
+    for (i = index; (i + count) < prt->p_ooo_range_count; i++)
+        prt->p_ooo_ranges[i] = prt->p_ooo_ranges[i + count];
+
+    prt->p_ooo_range_count = (UINT16)(prt->p_ooo_range_count - count);
+
+} /* TCP_OOO_Remove_Ranges */
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -5548,6 +5681,7 @@ STATIC VOID TCP_Check_OOO_List(TCP_PORT *prt)
 {
     INT32       trim_amount;
     UINT32      nxt;
+    UINT16      i;
     NET_BUFFER  *curr_buf;
     NET_BUFFER  *buf_ptr;
 
@@ -5556,71 +5690,98 @@ STATIC VOID TCP_Check_OOO_List(TCP_PORT *prt)
     nxt = prt->in.nxt;
     curr_buf = prt->in.ooo_list.head;
 
-    /* First check to see if there are any packets on the ooo (out of order)
-       list that are older than the one we expect to receive next.  If there are
-       any such packets then deallocate them. */
+    /* As long as the packet at the head of the ooo (out of order) list
+       does not start after the packet expected next, remove it from the
+       list.  Since the list is ordered, these are the only packets that
+       can hold data that is expected next. */
     while ( (curr_buf != NU_NULL) &&
-            (INT32_CMP(nxt, (curr_buf->mem_seqnum + curr_buf->mem_tcp_data_len)) >= 0) )
+            (INT32_CMP(nxt, curr_buf->mem_seqnum) >= 0) )
     {
-        /* Free all buffers in the chain. */
-        MEM_Buffer_Chain_Free(&prt->in.ooo_list, &MEM_Buffer_Freelist);
-        curr_buf = prt->in.ooo_list.head;
-    }
+        /* If all the data in this packet has already been received, then
+           deallocate it. */
+        if (INT32_CMP(nxt, (curr_buf->mem_seqnum + curr_buf->mem_tcp_data_len)) >= 0)
+        {
+            /* Free all buffers in the chain. */
+            MEM_Buffer_Chain_Free(&prt->in.ooo_list, &MEM_Buffer_Freelist);
+        }
 
-    /* Make sure we are still pointing at the head. */
-    curr_buf = prt->in.ooo_list.head;
+        else
+        {
+            /* Check to see if data on the packet needs to be shifted */
+            if (INT32_CMP(nxt, curr_buf->mem_seqnum) > 0)
+            {
+                trim_amount = (INT32)(nxt - curr_buf->mem_seqnum);
 
-    /* Now check to see if data on ooo_list needs to be shifted */
-    if ( (curr_buf != NU_NULL) &&
-         (INT32_CMP(nxt, curr_buf->mem_seqnum) > 0) )
-    {
-        trim_amount = (INT32)(nxt - curr_buf->mem_seqnum);
+                MEM_Trim(curr_buf, trim_amount);
 
-        MEM_Trim(curr_buf, trim_amount);
+                /* MEM_Trim does not modify mem_tcp_data_len or mem_seqnum.
+                   We need to do it here. */
+                curr_buf->mem_tcp_data_len = (UINT16)(curr_buf->mem_tcp_data_len - trim_amount);
+                curr_buf->mem_seqnum += (UINT32)trim_amount;
+            }
 
-        /* MEM_Trim does not modify mem_tcp_data_len or mem_seqnum.
-           We need to do it here. */
-        curr_buf->mem_tcp_data_len = (UINT16)(curr_buf->mem_tcp_data_len - trim_amount);
-        curr_buf->mem_seqnum += (UINT32)trim_amount;
-    }
+            /* Place the packet onto the packet list. */
+            buf_ptr = MEM_Update_Buffer_Lists(&prt->in.ooo_list, &sock_ptr->s_recvlist);
 
-    /* As long as the packet that is expected next is on the ooo list get it and
-       place it on the packet list. */
-    while ( (curr_buf != NU_NULL) &&
-            (INT32_CMP(nxt, curr_buf->mem_seqnum) == 0) )
-    {
-        /* Place the packet onto the packet list. */
-        buf_ptr = MEM_Update_Buffer_Lists(&prt->in.ooo_list, &sock_ptr->s_recvlist);
+            /* Ensure the buffer was moved from the out of order list to
+             * the receive list.  If not, exit the loop because something has
+             * gone wrong.
+             */
+            if (!buf_ptr)
+                break;
 
-        /* Ensure the buffer was moved from the out of order list to
-         * the receive list.  If not, exit the loop because something has
-         * gone wrong.
-         */
-        if (!buf_ptr)
-            break;
+            NET_LAT_STAMP(buf_ptr, NET_LAT_DEMUX, NET_LAT_SOCKET);
 
-        /* Update the expected sequence number. */
-        prt->in.nxt += buf_ptr->mem_tcp_data_len;
+            /* Update the expected sequence number. */
+            prt->in.nxt += buf_ptr->mem_tcp_data_len;
 
-        /* Decrease the amount of space in the receive window. */
-        prt->in.size -= buf_ptr->mem_tcp_data_len;
+            /* Decrease the amount of space in the receive window. */
+            prt->in.size -= buf_ptr->mem_tcp_data_len;
 
-        /* Increase the number of bytes that are buffered in the window. */
-        sock_ptr->s_recvbytes += buf_ptr->mem_tcp_data_len;
-        sock_ptr->s_recvpackets++;
+            /* Increase the number of bytes that are buffered in the window. */
+            sock_ptr->s_recvbytes += buf_ptr->mem_tcp_data_len;
+            sock_ptr->s_recvpackets++;
 
-        nxt = prt->in.nxt;
+            nxt = prt->in.nxt;
+        }
 
         /* Set the current pointer equal to the new head of the OOO list.  The
-           old head was removed by MEM_Update_Buffer_Lists() above.  Doing the
-           following will not work: "curr_buf = curr_buf->next;".  This is because
-           the call to MEM_Update_Buffer_Lists() above places the current buffer
+           old head was removed above.  Doing the following will not work:
+           "curr_buf = curr_buf->next;".  This is because the call to
+           MEM_Update_Buffer_Lists() above places the current buffer
            at the tail of the in window's packet list and in the process sets the
            next pointer to NULL.  So curr_buf would then be set to NULL
         */
         curr_buf = prt->in.ooo_list.head;
     }
 
+    /* Remove the ranges whose data has all been taken off the list. */
+    i = 0;
+
+    while ( (i < prt->p_ooo_range_count) &&
+            (INT32_CMP(nxt, prt->p_ooo_ranges[i].otr_right) >= 0) )
+    {
+        i++;
+    }
+
+    if (curr_buf == NU_NULL)
+        prt->p_ooo_range_count = 0;
+
+    else
+    {
+        if (i != 0)
+            TCP_OOO_Remove_Ranges(prt, 0, i);
+
+        /* The first remaining range now starts at the head of the list. */
+        if (prt->p_ooo_range_count != 0)
+        {
+            prt->p_ooo_ranges[0].otr_first = curr_buf;
+
+            if (INT32_CMP(nxt, prt->p_ooo_ranges[0].otr_left) > 0)
+                prt->p_ooo_ranges[0].otr_left = nxt;
+        }
+    }
+
 } /* TCP_Check_OOO_List */
 
 #endif
@@ -5713,6 +5874,10 @@ STATUS TCP_Cleanup(TCP_PORT *prt)
     /* Clear all lists of packet buffers. */
     MEM_Buffer_Cleanup(&prt->in.ooo_list);
 
+#if (INCLUDE_TCP_OOO == NU_TRUE)
+    prt->p_ooo_range_count = 0;
+#endif
+
     /* Clean up any buffers remaining on the retransmission list */
     tcp_buf = DLL_Dequeue(&prt->out.packet_list);
 
@@ -5803,6 +5968,11 @@ STATUS TCP_Cleanup(TCP_PORT *prt)
 
         if (sockptr)
         {
+            /* Report the closed connection to an event set the socket is
+               in. */
+            SCK_Notify_Events(prt->p_socketd,
+                              NU_EVS_READABLE | NU_EVS_WRITABLE);
+
             /* Restart any tasks pending on the receive */
             SCK_Resume_All(&sockptr->s_RXTask_List, 0);
 
@@ -5850,6 +6020,9 @@ STATUS TCP_Cleanup(TCP_PORT *prt)
                                    NERR_SEVERE, __FILE__, __LINE__);
 #endif
 
+                /* Drop the wake-ups deferred for the socket. */
+                SCK_Cancel_Wake(prt->p_socketd);
+
                 /* clear this socket pointer for future use */
                 SCK_Sockets[prt->p_socketd] = NU_NULL;
             }
@@ -5956,6 +6129,15 @@ STATIC void TCP_Xmit_Timer(TCP_PORT *prt, UINT32 rtt)
      */
     prt->p_rtt = 0;
 
+#if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
+
+    /* Pass the sample to the congestion control module. */
+    if ( (!(prt->portFlags & TCP_DIS_CONGESTION)) &&
+         (prt->p_cc_ops->tcc_on_rtt_sample) )
+        prt->p_cc_ops->tcc_on_rtt_sample(prt, rtt);
+
+#endif
+
     /* Calculate the new RTO value.
      * RTO  = SRTT + max(G, K * RTTVAR) per RFC2988, where K = 4 and
      * G = 1 tick.
@@ -6158,6 +6340,13 @@ INT TCP_Make_Port(INT16 family, UINT16 port_num)
     /* Initialize the MSL. */
     prt->p_msl = WAITTIME;
 
+#if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
+
+    /* Use the default congestion control module. */
+    prt->p_cc_ops = TCP_CC_Get_Ops(TCP_CC_DEFAULT);
+
+#endif
+
     /* Initialize the ACK delay value. */
     prt->p_delay_ack = TCP_ACK_TIMEOUT;
 
@@ -6469,6 +6658,8 @@ STATIC UINT16 TCP_Enqueue(struct sock_struct *sock_ptr)
     /* Save the size of the packet enqueued */
     retval = (UINT16)src->mem_total_data_len;
 
+    NET_LAT_STAMP(src, NET_LAT_DEMUX, NET_LAT_SOCKET);
+
     /* This first check is an optimization that attempts to merge the data
        received in small packets. It is not intended to concatenate all
        received data, but only relatively small packets that are received
@@ -6636,9 +6827,9 @@ INT32 TCP_Dequeue(struct sock_struct *sock_ptr, char *buffer, UINT32 nbytes)
 *       bytes_removed
 *
 ************************************************************************/
-STATIC UINT16 TCP_Rmqueue(TCP_WINDOW *wind, UINT32 acked)
+STATIC UINT32 TCP_Rmqueue(TCP_WINDOW *wind, UINT32 acked)
 {
-    UINT16      bytes_removed = 0;
+    UINT32      bytes_removed = 0;
     NET_BUFFER  *buf_ptr;
     TCP_BUFFER  *tcp_buf, *temp_buf;
 
@@ -6678,7 +6869,7 @@ STATIC UINT16 TCP_Rmqueue(TCP_WINDOW *wind, UINT32 acked)
              (buf_ptr != wind->nextPacket) )
         {
             /* Update the number of bytes removed so far. */
-            bytes_removed = (UINT16)(bytes_removed + buf_ptr->mem_tcp_data_len);
+            bytes_removed += buf_ptr->mem_tcp_data_len;
 
             /* Update the number of bytes contained in this window. */
             wind->contain -= buf_ptr->mem_tcp_data_len;
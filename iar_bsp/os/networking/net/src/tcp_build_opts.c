@@ -192,9 +192,12 @@ UINT8 TCP_Build_SACK_Perm_Option(UINT8 *buffer, UINT8 *bytes_avail)
 *************************************************************************/
 UINT8 TCP_Build_SACK_Option(UINT8 *buffer, TCP_PORT *prt, UINT8 *bytes_avail)
 {
-    UINT8       offset = 0;
-    NET_BUFFER  *buf_ptr, *next_buffer;
-    UINT32      left_edge, right_edge, saved_left = 0, saved_right;
+    UINT8           offset = 0;
+    UINT32          left_edge, right_edge;
+#if (INCLUDE_TCP_OOO == NU_TRUE)
+    TCP_OOO_RANGE   *range;
+    UINT16          i;
+#endif
 
     /* Initialize the left edge to the sequence number of the invoking
      * packet.
@@ -215,71 +218,32 @@ UINT8 TCP_Build_SACK_Option(UINT8 *buffer, TCP_PORT *prt, UINT8 *bytes_avail)
         /* Initialize the offset to the start of the first block. */
         offset = TCP_SACK_BLOCK_OFFSET;
 
-        /* Get a pointer to the head of the out of order list. */
-        buf_ptr = prt->in.ooo_list.head;
+#if (INCLUDE_TCP_OOO == NU_TRUE)
 
-        /* Search the list for contiguous data covering the first block
-         * in the list.
+        /* Extend the first block over the ranges of the out of order
+         * list that overlap or are contiguous with the data just
+         * received.  The ranges are ordered, so stop at the first range
+         * that starts beyond the block.
          */
-        while (buf_ptr)
+        for (i = 0; i < prt->p_ooo_range_count; i++)
         {
-            /* Determine if this buffer is the start of a contiguous block in
-             * the out of order list and get a pointer to the next buffer that
-             * does not belong to the contiguous block.
-             */
-            next_buffer = TCP_Find_Continuous_SACK_Block(buf_ptr, &saved_right);
-
-            /* If a contiguous block was found, save off the left_edge and
-             * compute the length of the block.
-             */
-            if (saved_right)
-            {
-                saved_left = buf_ptr->mem_seqnum;
-            }
-
-            /* A contiguous block was not found. */
-            else
-            {
-                /* If the sequence number of this buffer covers the first
-                 * block.
-                 */
-                if (buf_ptr->mem_seqnum + buf_ptr->mem_tcp_data_len == left_edge)
-                {
-                    /* Save this sequence number. */
-                    saved_left = buf_ptr->mem_seqnum;
-
-                    /* Compute the right edge of this block. */
-                    saved_right = saved_left + buf_ptr->mem_tcp_data_len;
-                }
-            }
+            range = &prt->p_ooo_ranges[i];
 
-            /* If the contiguous block is contiguous with the data just
-             * received.
-             */
-            if (saved_right == left_edge)
-            {
-                /* Move the left edge back to reflect the existing contiguous
-                 * blocks.  The right edge remains the same.
-                 */
-                left_edge = saved_left;
-
-                /* Exit the loop since this is the end of the contiguous
-                 * block.
-                 */
+            if (INT32_CMP(range->otr_left, right_edge) > 0)
                 break;
-            }
 
-            /* Reset the two variables. */
-            else
+            if (INT32_CMP(range->otr_right, left_edge) >= 0)
             {
-                saved_left = 0;
-                saved_right = 0;
-            }
+                if (INT32_CMP(range->otr_left, left_edge) < 0)
+                    left_edge = range->otr_left;
 
-            /* Start on the next buffer. */
-            buf_ptr = next_buffer;
+                if (INT32_CMP(range->otr_right, right_edge) > 0)
+                    right_edge = range->otr_right;
+            }
         }
 
+#endif
+
         /* Add the first left edge to the packet. */
         PUT32(buffer, offset + TCP_SACK_BLOCK_LEFT_EDGE, left_edge);
 
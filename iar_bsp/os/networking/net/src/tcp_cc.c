@@ -0,0 +1,1011 @@
+/*************************************************************************
+*
+*              Copyright 1993 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+
+/*************************************************************************
+*
+*   FILE NAME
+*
+*       tcp_cc.c
+*
+*   COMPONENT
+*
+*       TCP - Congestion Control
+*
+*   DESCRIPTION
+*
+*       This file contains the TCP congestion control modules.  Each TCP
+*       port points to the operations of one module, which is selected
+*       with the TCP_CONGESTION_CTRL socket option.  The following
+*       modules are provided:
+*
+*       NewReno     Slow Start and Congestion Avoidance per RFC 2581;
+*                   the behavior of previous releases.
+*       CUBIC       The window grows as a cubic function of the time
+*                   since the last reduction, per RFC 8312.  All
+*                   arithmetic is integer.
+*       BBR-lite    The window is sized to twice the product of the max
+*                   delivery rate and the min RTT measured on the
+*                   connection, so loss alone does not shrink it.  There
+*                   is no pacing; the window is the only control.
+*
+*   DATA STRUCTURES
+*
+*       TCP_CC_NewReno_Ops
+*       TCP_CC_Cubic_Ops
+*       TCP_CC_BBR_Ops
+*
+*   FUNCTIONS
+*
+*       TCP_CC_Get_Ops
+*       TCP_CC_Half_Flight
+*       TCP_CC_Scale
+*       TCP_CC_Slow_Start
+*       TCP_CC_NewReno_Init
+*       TCP_CC_NewReno_Ack
+*       TCP_CC_NewReno_Loss
+*       TCP_CC_NewReno_RTO
+*       TCP_CC_Cbrt
+*       TCP_CC_Cubic_Init
+*       TCP_CC_Cubic_Reduce
+*       TCP_CC_Cubic_Ack
+*       TCP_CC_Cubic_Loss
+*       TCP_CC_Cubic_RTO
+*       TCP_CC_BBR_Target
+*       TCP_CC_BBR_Init
+*       TCP_CC_BBR_Ack
+*       TCP_CC_BBR_Loss
+*       TCP_CC_BBR_RTO
+*       TCP_CC_BBR_RTT_Sample
+*
+*   DEPENDENCIES
+*
+*       nu_net.h
+*
+*************************************************************************/
+
+#include "networking/nu_net.h"
+
+#if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
+
+STATIC UINT32   TCP_CC_Half_Flight(TCP_PORT *);
+STATIC UINT32   TCP_CC_Scale(UINT32, UINT32);
+STATIC VOID     TCP_CC_Slow_Start(TCP_PORT *);
+STATIC VOID     TCP_CC_NewReno_Init(TCP_PORT *);
+STATIC VOID     TCP_CC_NewReno_Ack(TCP_PORT *, UINT32);
+STATIC VOID     TCP_CC_NewReno_Loss(TCP_PORT *);
+STATIC VOID     TCP_CC_NewReno_RTO(TCP_PORT *);
+STATIC UINT32   TCP_CC_Cbrt(UINT32);
+STATIC VOID     TCP_CC_Cubic_Init(TCP_PORT *);
+STATIC VOID     TCP_CC_Cubic_Reduce(TCP_PORT *);
+STATIC VOID     TCP_CC_Cubic_Ack(TCP_PORT *, UINT32);
+STATIC VOID     TCP_CC_Cubic_Loss(TCP_PORT *);
+STATIC VOID     TCP_CC_Cubic_RTO(TCP_PORT *);
+STATIC UINT32   TCP_CC_BBR_Target(TCP_PORT *);
+STATIC VOID     TCP_CC_BBR_Init(TCP_PORT *);
+STATIC VOID     TCP_CC_BBR_Ack(TCP_PORT *, UINT32);
+STATIC VOID     TCP_CC_BBR_Loss(TCP_PORT *);
+STATIC VOID     TCP_CC_BBR_RTO(TCP_PORT *);
+STATIC VOID     TCP_CC_BBR_RTT_Sample(TCP_PORT *, UINT32);
+
+STATIC const TCP_CC_OPS TCP_CC_NewReno_Ops =
+{
+    TCP_CC_NewReno_Init,
+    TCP_CC_NewReno_Ack,
+    TCP_CC_NewReno_Loss,
+    TCP_CC_NewReno_RTO,
+    NU_NULL,
+    TCP_CC_NEWRENO,
+    {0}
+};
+
+STATIC const TCP_CC_OPS TCP_CC_Cubic_Ops =
+{
+    TCP_CC_Cubic_Init,
+    TCP_CC_Cubic_Ack,
+    TCP_CC_Cubic_Loss,
+    TCP_CC_Cubic_RTO,
+    NU_NULL,
+    TCP_CC_CUBIC,
+    {0}
+};
+
+STATIC const TCP_CC_OPS TCP_CC_BBR_Ops =
+{
+    TCP_CC_BBR_Init,
+    TCP_CC_BBR_Ack,
+    TCP_CC_BBR_Loss,
+    TCP_CC_BBR_RTO,
+    TCP_CC_BBR_RTT_Sample,
+    TCP_CC_BBR_LITE,
+    {0}
+};
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_Get_Ops
+*
+*   DESCRIPTION
+*
+*       This function returns the operations of a congestion control
+*       module.
+*
+*   INPUTS
+*
+*       id                      TCP_CC_NEWRENO, TCP_CC_CUBIC or
+*                               TCP_CC_BBR_LITE.
+*
+*   OUTPUTS
+*
+*       A pointer to the operations of the module, or NU_NULL if id
+*       does not identify a module.
+*
+*************************************************************************/
+const TCP_CC_OPS *TCP_CC_Get_Ops(UINT8 id)
+{
+    const TCP_CC_OPS    *ops;
+
+    switch (id)
+    {
+    case TCP_CC_NEWRENO:
+
+        ops = &TCP_CC_NewReno_Ops;
+        break;
+
+    case TCP_CC_CUBIC:
+
+        ops = &TCP_CC_Cubic_Ops;
+        break;
+
+    case TCP_CC_BBR_LITE:
+
+        ops = &TCP_CC_BBR_Ops;
+        break;
+
+    default:
+
+        ops = NU_NULL;
+        break;
+    }
+
+    return (ops);
+
+} /* TCP_CC_Get_Ops */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_Half_Flight
+*
+*   DESCRIPTION
+*
+*       This function returns max(FlightSize / 2, 2 * SMSS), the value
+*       RFC 2581 section 3.1 gives as the upper bound of ssthresh after
+*       a loss.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       The new value of ssthresh.
+*
+*************************************************************************/
+STATIC UINT32 TCP_CC_Half_Flight(TCP_PORT *prt)
+{
+    UINT32  half = (UINT32)prt->out.contain >> 1;
+
+    return ((half > ((UINT32)prt->p_smss << 1)) ?
+            half : ((UINT32)prt->p_smss << 1));
+
+} /* TCP_CC_Half_Flight */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_Scale
+*
+*   DESCRIPTION
+*
+*       This function multiplies a value by a factor in units of 1/1024
+*       without overflowing 32 bits.
+*
+*   INPUTS
+*
+*       value                   The value to scale.
+*       factor                  The factor, at most 1024.
+*
+*   OUTPUTS
+*
+*       value * factor / 1024.
+*
+*************************************************************************/
+STATIC UINT32 TCP_CC_Scale(UINT32 value, UINT32 factor)
+{
+    return (((value >> 10) * factor) + (((value & 1023) * factor) >> 10));
+
+} /* TCP_CC_Scale */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_Slow_Start
+*
+*   DESCRIPTION
+*
+*       This function grows the congestion window for one ACK during
+*       slow start.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_Slow_Start(TCP_PORT *prt)
+{
+    /* RFC 2581 - section 3.1 - During slow start, a TCP increments cwnd
+     * by at most SMSS bytes for each ACK received that acknowledges new
+     * data.
+     */
+    if ((prt->p_cwnd + prt->p_smss) > prt->p_cwnd)
+        prt->p_cwnd += prt->p_smss;
+
+} /* TCP_CC_Slow_Start */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_NewReno_Init
+*
+*   DESCRIPTION
+*
+*       This function sets the initial congestion window and slow start
+*       threshold of a connection.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_NewReno_Init(TCP_PORT *prt)
+{
+    /* RFC 2581 - section 3.1 - The initial value of cwnd, MUST be less
+     * than or equal to 2*SMSS bytes and MUST NOT be more than 2 segments.
+     */
+    prt->p_cwnd = prt->p_smss;
+
+    /* RFC 2581 - section 3.1 - The initial value of ssthresh MAY be
+     * arbitrarily high (for example, some implementations use the size
+     * of the advertised window), but it may be reduced in response to
+     * congestion.
+     */
+    prt->p_ssthresh = TCP_SLOW_START_THRESHOLD;
+
+} /* TCP_CC_NewReno_Init */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_NewReno_Ack
+*
+*   DESCRIPTION
+*
+*       This function performs Slow Start and Congestion Avoidance for
+*       an ACK of new data.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*       bytes_acked             The number of bytes ACKed.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_NewReno_Ack(TCP_PORT *prt, UINT32 bytes_acked)
+{
+    UINT32  new_cwnd;
+
+    UNUSED_PARAMETER(bytes_acked);
+
+    /* RFC 2581 - section 3.1 - The congestion avoidance algorithm
+     * is used when cwnd > ssthresh.  Slow start ends when cwnd
+     * exceeds ssthresh or when congestion is observed.
+     */
+    if (prt->p_cwnd > prt->p_ssthresh)
+    {
+        /* RFC 2581 - section 3.1 - During Congestion Avoidance,
+         * cwnd is incremented by 1 full sized segment per
+         * round-trip time (RTT).
+         */
+        new_cwnd = ((UINT32)prt->p_smss * prt->p_smss) / prt->p_cwnd;
+
+        /* RFC 2581 - section 3.1 - If the above formula yields zero,
+         * the result should be rounded up to 1 byte.
+         */
+        if (new_cwnd == 0)
+            new_cwnd = 1;
+
+        /* If incrementing the congestion window will not wrap the
+         * value, increment.
+         */
+        if ((prt->p_cwnd + new_cwnd) > prt->p_cwnd)
+            prt->p_cwnd += new_cwnd;
+    }
+
+    /* RFC 2581 - section 3.1 - The slow start algorithm is used
+     * when cwnd <= ssthresh.  When cwnd and ssthresh are equal
+     * the sender may use either slow start or congestion avoidance.
+     */
+    else
+        TCP_CC_Slow_Start(prt);
+
+} /* TCP_CC_NewReno_Ack */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_NewReno_Loss
+*
+*   DESCRIPTION
+*
+*       This function sets the slow start threshold when Fast Retransmit
+*       is entered.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_NewReno_Loss(TCP_PORT *prt)
+{
+    /* RFC 2581 - section 3.2 - When the third duplicate ACK is received,
+     * set ssthresh to no more than max(FlightSize / 2, 2*SMSS).
+     */
+    prt->p_ssthresh = TCP_CC_Half_Flight(prt);
+
+} /* TCP_CC_NewReno_Loss */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_NewReno_RTO
+*
+*   DESCRIPTION
+*
+*       This function sets the slow start threshold and congestion window
+*       when the retransmission timer expires.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_NewReno_RTO(TCP_PORT *prt)
+{
+    /* RFC 2581 - section 3.1 - When a TCP sender detects segment
+     * loss using the retransmission timer, the value of ssthresh
+     * MUST be set to no more than MAX(FlightSize / 2, 2 * SMSS)
+     * where FlightSize is the amount of outstanding data in the
+     * network.
+     */
+    prt->p_ssthresh = TCP_CC_Half_Flight(prt);
+
+    /* RFC 2581 - section 3.1 - Furthermore, upon a timeout cwnd
+     * MUST be set to no more than the loss window, LW, which
+     * equals 1 full-sized segment (regardless of the value of IW).
+     * Therefore, after retransmitting the dropped segment the TCP
+     * sender uses the slow start algorithm to increase the window
+     * from 1 full-sized segment to the new value of ssthresh, at
+     * which point congestion avoidance again takes over.
+     */
+    prt->p_cwnd = prt->p_smss;
+
+} /* TCP_CC_NewReno_RTO */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_Cbrt
+*
+*   DESCRIPTION
+*
+*       This function computes the integer cube root of a value, one
+*       bit of the result at a time.
+*
+*   INPUTS
+*
+*       x                       The value.
+*
+*   OUTPUTS
+*
+*       floor(cbrt(x)).
+*
+*************************************************************************/
+STATIC UINT32 TCP_CC_Cbrt(UINT32 x)
+{
+    UINT32  y = 0;
+    UINT32  b;
+    INT     s;
+
+    for (s = 30; s >= 0; s -= 3)
+    {
+        y <<= 1;
+
+        b = ((3 * y * (y + 1)) + 1) << s;
+
+        if (x >= b)
+        {
+            x -= b;
+            y ++;
+        }
+    }
+
+    return (y);
+
+} /* TCP_CC_Cbrt */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_Cubic_Init
+*
+*   DESCRIPTION
+*
+*       This function sets the initial congestion window and slow start
+*       threshold of a CUBIC connection.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_Cubic_Init(TCP_PORT *prt)
+{
+    UTL_Zero(&prt->p_cc.p_cc_cubic, sizeof(TCP_CC_CUBIC_STATE));
+
+    TCP_CC_NewReno_Init(prt);
+
+} /* TCP_CC_Cubic_Init */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_Cubic_Reduce
+*
+*   DESCRIPTION
+*
+*       This function records the window at which a loss occurred, ends
+*       the current growth epoch and sets ssthresh to beta * cwnd.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_Cubic_Reduce(TCP_PORT *prt)
+{
+    TCP_CC_CUBIC_STATE  *cubic = &prt->p_cc.p_cc_cubic;
+
+    /* RFC 8312 - section 4.6 - Fast Convergence.  If the window did not
+     * reach the previous plateau, release bandwidth to new flows by
+     * lowering the plateau further.
+     */
+    if (prt->p_cwnd < cubic->tcu_w_max)
+        cubic->tcu_w_max = TCP_CC_Scale(prt->p_cwnd, TCP_CC_CUBIC_FAST_CONV);
+    else
+        cubic->tcu_w_max = prt->p_cwnd;
+
+    cubic->tcu_epoch_start = 0;
+
+    prt->p_ssthresh = TCP_CC_Scale(prt->p_cwnd, TCP_CC_CUBIC_BETA);
+
+    if (prt->p_ssthresh < ((UINT32)prt->p_smss << 1))
+        prt->p_ssthresh = (UINT32)prt->p_smss << 1;
+
+} /* TCP_CC_Cubic_Reduce */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_Cubic_Ack
+*
+*   DESCRIPTION
+*
+*       This function grows the congestion window of a CUBIC connection
+*       for an ACK of new data.  Outside of slow start, the window
+*       follows W(t) = C * (t - K)^3 + W_max with C = 0.4, or the window
+*       standard TCP would have reached if that is larger.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*       bytes_acked             The number of bytes ACKed.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_Cubic_Ack(TCP_PORT *prt, UINT32 bytes_acked)
+{
+    TCP_CC_CUBIC_STATE  *cubic = &prt->p_cc.p_cc_cubic;
+    UINT32          now, elapsed, segs, target, incr, acks;
+    INT32           dc, delta;
+
+    UNUSED_PARAMETER(bytes_acked);
+
+    if (prt->p_cwnd <= prt->p_ssthresh)
+    {
+        TCP_CC_Slow_Start(prt);
+        return;
+    }
+
+    now = NU_Retrieve_Clock();
+
+    /* Start a new epoch on the first ACK after a reduction. */
+    if (cubic->tcu_epoch_start == 0)
+    {
+        cubic->tcu_epoch_start = (now != 0) ? now : 1;
+        cubic->tcu_w_est = prt->p_cwnd;
+
+        if (prt->p_cwnd < cubic->tcu_w_max)
+        {
+            /* K = cbrt((W_max - cwnd) / C) seconds, in segments.  The
+             * cube root is taken of 2.5e6 * segments so the result is
+             * in units of 10 milliseconds.
+             */
+            segs = (cubic->tcu_w_max - prt->p_cwnd) / prt->p_smss;
+
+            if (segs > 1700)
+                segs = 1700;
+
+            cubic->tcu_k = TCP_CC_Cbrt(segs * 2500000UL) * 10;
+            cubic->tcu_origin = cubic->tcu_w_max;
+        }
+
+        else
+        {
+            cubic->tcu_k = 0;
+            cubic->tcu_origin = prt->p_cwnd;
+        }
+    }
+
+    /* Milliseconds since the start of the epoch, bounded so the cube
+     * below fits in 32 bits.
+     */
+    elapsed = now - cubic->tcu_epoch_start;
+
+    if (elapsed > (60 * SCK_Ticks_Per_Second))
+        elapsed = 60 * SCK_Ticks_Per_Second;
+
+    elapsed = (elapsed * 1000) / SCK_Ticks_Per_Second;
+
+    /* (t - K) in centiseconds, bounded to +/- 10 seconds. */
+    dc = ((INT32)elapsed - (INT32)cubic->tcu_k) / 10;
+
+    if (dc > 1000)
+        dc = 1000;
+    else if (dc < -1000)
+        dc = -1000;
+
+    /* C * (t - K)^3 in thousandths of a segment. */
+    delta = (dc * dc * dc) / 2500;
+
+    if (delta >= 0)
+        target = cubic->tcu_origin +
+            ((UINT32)(delta / 1000) * prt->p_smss) +
+            (((UINT32)(delta % 1000) * prt->p_smss) / 1000);
+
+    else
+    {
+        incr = ((UINT32)(-delta / 1000) * prt->p_smss) +
+            (((UINT32)(-delta % 1000) * prt->p_smss) / 1000);
+
+        target = (incr < cubic->tcu_origin) ?
+            (cubic->tcu_origin - incr) : prt->p_smss;
+    }
+
+    /* RFC 8312 - section 4.2 - TCP-friendly region.  Standard TCP with
+     * the same beta grows 3 * (1 - beta) / (1 + beta), about 17/32, of a
+     * segment per RTT.
+     */
+    incr = ((((UINT32)prt->p_smss * prt->p_smss) / cubic->tcu_w_est) * 17) >> 5;
+
+    cubic->tcu_w_est += (incr != 0) ? incr : 1;
+
+    if (cubic->tcu_w_est > target)
+        target = cubic->tcu_w_est;
+
+    /* Close (target - cwnd) over one RTT, no faster than slow start.  The
+     * window may be less than one segment after an RTO, so at least one
+     * ACK per RTT is assumed.
+     */
+    if (target > prt->p_cwnd)
+    {
+        if ((target - prt->p_cwnd) >= prt->p_cwnd)
+            incr = prt->p_smss;
+
+        else
+        {
+            acks = prt->p_cwnd / prt->p_smss;
+
+            incr = (target - prt->p_cwnd) / ((acks != 0) ? acks : 1);
+        }
+    }
+
+    /* At the plateau, probe very slowly. */
+    else
+        incr = (((UINT32)prt->p_smss * prt->p_smss) / prt->p_cwnd) / 100;
+
+    if (incr == 0)
+        incr = 1;
+
+    if ((prt->p_cwnd + incr) > prt->p_cwnd)
+        prt->p_cwnd += incr;
+
+} /* TCP_CC_Cubic_Ack */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_Cubic_Loss
+*
+*   DESCRIPTION
+*
+*       This function sets the slow start threshold of a CUBIC connection
+*       when Fast Retransmit is entered.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_Cubic_Loss(TCP_PORT *prt)
+{
+    TCP_CC_Cubic_Reduce(prt);
+
+} /* TCP_CC_Cubic_Loss */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_Cubic_RTO
+*
+*   DESCRIPTION
+*
+*       This function sets the slow start threshold and congestion window
+*       of a CUBIC connection when the retransmission timer expires.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_Cubic_RTO(TCP_PORT *prt)
+{
+    TCP_CC_Cubic_Reduce(prt);
+
+    prt->p_cwnd = prt->p_smss;
+
+} /* TCP_CC_Cubic_RTO */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_BBR_Target
+*
+*   DESCRIPTION
+*
+*       This function returns the congestion window BBR-lite aims for:
+*       twice the estimated bandwidth-delay product, but at least four
+*       segments.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       The target window, or 0 if there is no estimate yet.
+*
+*************************************************************************/
+STATIC UINT32 TCP_CC_BBR_Target(TCP_PORT *prt)
+{
+    TCP_CC_BBR_STATE    *bbr = &prt->p_cc.p_cc_bbr;
+    UINT32      bdp;
+
+    if ( (bbr->tbb_max_bw == 0) || (bbr->tbb_min_rtt == 0) )
+        return (0);
+
+    bdp = ((bbr->tbb_max_bw >> TCP_CC_BBR_BW_SHIFT) * bbr->tbb_min_rtt) +
+          (((bbr->tbb_max_bw & ((1UL << TCP_CC_BBR_BW_SHIFT) - 1)) *
+            bbr->tbb_min_rtt) >> TCP_CC_BBR_BW_SHIFT);
+
+    if (bdp < ((UINT32)prt->p_smss << 1))
+        bdp = (UINT32)prt->p_smss << 1;
+
+    return (bdp << 1);
+
+} /* TCP_CC_BBR_Target */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_BBR_Init
+*
+*   DESCRIPTION
+*
+*       This function sets the initial congestion window and slow start
+*       threshold of a BBR-lite connection and puts it in Startup.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_BBR_Init(TCP_PORT *prt)
+{
+    UTL_Zero(&prt->p_cc.p_cc_bbr, sizeof(TCP_CC_BBR_STATE));
+
+    prt->p_cc.p_cc_bbr.tbb_startup = NU_TRUE;
+
+    TCP_CC_NewReno_Init(prt);
+
+} /* TCP_CC_BBR_Init */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_BBR_Ack
+*
+*   DESCRIPTION
+*
+*       This function counts the data delivered by an ACK and moves the
+*       congestion window of a BBR-lite connection toward its target.
+*       During Startup the window grows as in slow start.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*       bytes_acked             The number of bytes ACKed.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_BBR_Ack(TCP_PORT *prt, UINT32 bytes_acked)
+{
+    TCP_CC_BBR_STATE    *bbr = &prt->p_cc.p_cc_bbr;
+    UINT32      target;
+
+    if ((bbr->tbb_delivered + bytes_acked) > bbr->tbb_delivered)
+        bbr->tbb_delivered += bytes_acked;
+
+    target = TCP_CC_BBR_Target(prt);
+
+    if ( (bbr->tbb_startup == NU_TRUE) || (target == 0) )
+        TCP_CC_Slow_Start(prt);
+
+    else if (prt->p_cwnd < target)
+    {
+        prt->p_cwnd += bytes_acked;
+
+        if (prt->p_cwnd > target)
+            prt->p_cwnd = target;
+    }
+
+    else
+        prt->p_cwnd = target;
+
+} /* TCP_CC_BBR_Ack */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_BBR_Loss
+*
+*   DESCRIPTION
+*
+*       This function sets the slow start threshold of a BBR-lite
+*       connection when Fast Retransmit is entered.  The window after
+*       recovery is the target window rather than a fraction of cwnd.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_BBR_Loss(TCP_PORT *prt)
+{
+    UINT32  target = TCP_CC_BBR_Target(prt);
+
+    prt->p_ssthresh = (target != 0) ? target : TCP_CC_Half_Flight(prt);
+
+} /* TCP_CC_BBR_Loss */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_BBR_RTO
+*
+*   DESCRIPTION
+*
+*       This function sets the slow start threshold and congestion window
+*       of a BBR-lite connection when the retransmission timer expires.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_BBR_RTO(TCP_PORT *prt)
+{
+    TCP_CC_BBR_Loss(prt);
+
+    prt->p_cwnd = prt->p_smss;
+
+} /* TCP_CC_BBR_RTO */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       TCP_CC_BBR_RTT_Sample
+*
+*   DESCRIPTION
+*
+*       This function updates the min RTT and max delivery rate filters
+*       of a BBR-lite connection.  The delivery rate of the sample is the
+*       data ACKed since the previous sample divided by the RTT.
+*
+*   INPUTS
+*
+*       *prt                    Pointer to the TCP port.
+*       rtt                     The RTT sample, in clock ticks.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID TCP_CC_BBR_RTT_Sample(TCP_PORT *prt, UINT32 rtt)
+{
+    TCP_CC_BBR_STATE    *bbr = &prt->p_cc.p_cc_bbr;
+    UINT32      now = NU_Retrieve_Clock();
+    UINT32      bw;
+
+    if (rtt == 0)
+        rtt = 1;
+
+    /* Take the sample if it is lower than the current min RTT or the
+     * current min RTT has expired.
+     */
+    if ( (bbr->tbb_min_rtt == 0) || (rtt <= bbr->tbb_min_rtt) ||
+         ((now - bbr->tbb_min_rtt_stamp) > TCP_CC_BBR_MIN_RTT_WIN) )
+    {
+        bbr->tbb_min_rtt = rtt;
+        bbr->tbb_min_rtt_stamp = now;
+    }
+
+    /* Bound the delivered count so the scaled rate fits in 32 bits. */
+    if (bbr->tbb_delivered > (0xFFFFFFFFUL >> TCP_CC_BBR_BW_SHIFT))
+        bbr->tbb_delivered = 0xFFFFFFFFUL >> TCP_CC_BBR_BW_SHIFT;
+
+    bw = (bbr->tbb_delivered << TCP_CC_BBR_BW_SHIFT) / rtt;
+
+    bbr->tbb_delivered = 0;
+
+    /* Take the sample if it is higher than the current max rate or the
+     * current max rate has expired.
+     */
+    if ( (bw >= bbr->tbb_max_bw) ||
+         (bbr->tbb_bw_age >= TCP_CC_BBR_BW_SAMPLES) )
+    {
+        bbr->tbb_max_bw = bw;
+        bbr->tbb_bw_age = 0;
+    }
+
+    else
+        bbr->tbb_bw_age ++;
+
+    /* Startup ends when the max rate has not grown by 25% for several
+     * samples; the pipe is full.  Drain the queue Startup built by
+     * cutting the window to the target.
+     */
+    if (bbr->tbb_startup == NU_TRUE)
+    {
+        if (bbr->tbb_max_bw >= (bbr->tbb_full_bw + (bbr->tbb_full_bw >> 2)))
+        {
+            bbr->tbb_full_bw = bbr->tbb_max_bw;
+            bbr->tbb_full_bw_cnt = 0;
+        }
+
+        else if (++bbr->tbb_full_bw_cnt >= TCP_CC_BBR_FULL_BW_CNT)
+        {
+            bbr->tbb_startup = NU_FALSE;
+
+            bw = TCP_CC_BBR_Target(prt);
+
+            if ( (bw != 0) && (prt->p_cwnd > bw) )
+                prt->p_cwnd = bw;
+        }
+    }
+
+} /* TCP_CC_BBR_RTT_Sample */
+
+#endif
@@ -45,13 +45,14 @@
 *   DESCRIPTION
 *
 *       This function determines whether Congestion Control is set on
-*       a socket.
+*       a socket, and which congestion control module is used.
 *
 *   INPUTS
 *
 *       socketd                 Specifies a socket descriptor
-*       *optval                 The value of the Congestion Control
-*                               algorithm.
+*       *optval                 0 if Congestion Control is disabled;
+*                               otherwise, TCP_CC_NEWRENO, TCP_CC_CUBIC
+*                               or TCP_CC_BBR_LITE.
 *
 *   OUTPUTS
 *
@@ -70,9 +71,13 @@ STATUS TCP_Getsockopt_TCP_CONGESTION_CTRL(INT socketd, UINT8 *optval)
     /* If the TCP port is valid, return the value of the option. */
     if ( (pindex != NU_IGNORE_VALUE) && (TCP_Ports[pindex] != NU_NULL) )
     {
-        /* Get the TCP Congestion Control flag */
+        /* Get the TCP Congestion Control module */
         if (!(TCP_Ports[pindex]->portFlags & TCP_DIS_CONGESTION))
+#if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
+            *optval = TCP_Ports[pindex]->p_cc_ops->tcc_id;
+#else
             *optval = 1;
+#endif
 
         /* Congestion control is disabled. */
         else
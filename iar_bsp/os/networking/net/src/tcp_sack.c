@@ -27,16 +27,17 @@
 *   FUNCTIONS
 *
 *       TCP_Build_SACK_Block
-*       TCP_Find_Continuous_SACK_Block
 *       TCP_SACK_Flag_Packets
 *
 *   DEPENDENCIES
 *
 *       nu_net.h
+*       net_extr.h
 *
 ************************************************************************/
 
 #include "networking/nu_net.h"
+#include "networking/net_extr.h"
 
 #if (NET_INCLUDE_SACK == NU_TRUE)
 
@@ -49,7 +50,9 @@
 *   DESCRIPTION
 *
 *       This function builds the SACK Blocks that follow the initial
-*       block in a SACK option.
+*       block in a SACK option.  A block is added for each range of
+*       contiguous data on the out of order list that is not covered by
+*       the initial block.
 *
 *   INPUTS
 *
@@ -76,132 +79,49 @@
 VOID TCP_Build_SACK_Block(UINT8 *buffer, TCP_PORT *prt, UINT8 *offset_ptr,
                           UINT8 bytes_avail, UINT32 left_edge, UINT32 right_edge)
 {
-    UINT32      saved_right = 0;
-    NET_BUFFER  *buf_ptr, *next_buffer;
-    UINT8       offset = *offset_ptr;
+    UINT8           offset = *offset_ptr;
+#if (INCLUDE_TCP_OOO == NU_TRUE)
+    TCP_OOO_RANGE   *range;
+    UINT16          i;
 
-    /* Get a pointer to the head of the out of order list. */
-    buf_ptr = prt->in.ooo_list.head;
-
-    /* While there are packets on the out of order list and room in the
+    /* While there are ranges on the out of order list and room in the
      * buffer.
      */
-    while ( (buf_ptr) && ((offset + TCP_SACK_BLOCK_LENGTH) <= bytes_avail) )
+    for (i = 0; (i < prt->p_ooo_range_count) &&
+                ((offset + TCP_SACK_BLOCK_LENGTH) <= bytes_avail); i++)
     {
-        /* If this sequence number is not covered by the first block that
-         * was added to the packet.
+        range = &prt->p_ooo_ranges[i];
+
+        /* If this range holds data and is not covered by the first
+         * block that was added to the packet.
          */
-        if ( (buf_ptr->mem_seqnum < left_edge) ||
-             (buf_ptr->mem_seqnum > right_edge) )
+        if ( (range->otr_left != range->otr_right) &&
+             ((INT32_CMP(range->otr_left, left_edge) < 0) ||
+              (INT32_CMP(range->otr_right, right_edge) > 0)) )
         {
             /* Add this left edge to the packet. */
-            PUT32(buffer, offset + TCP_SACK_BLOCK_LEFT_EDGE,
-                  buf_ptr->mem_seqnum);
-
-            /* Find the right edge to add to the packet. */
-            next_buffer = TCP_Find_Continuous_SACK_Block(buf_ptr, &saved_right);
-
-            /* If a contiguous block was not found. */
-            if (!saved_right)
-            {
-                /* Compute the right edge for this block. */
-                saved_right = buf_ptr->mem_seqnum + buf_ptr->mem_tcp_data_len;
-            }
+            PUT32(buffer, offset + TCP_SACK_BLOCK_LEFT_EDGE, range->otr_left);
 
             /* Add this right edge to the packet. */
-            PUT32(buffer, offset + TCP_SACK_BLOCK_RIGHT_EDGE, saved_right);
+            PUT32(buffer, offset + TCP_SACK_BLOCK_RIGHT_EDGE, range->otr_right);
 
             /* Increment the offset by one block. */
             offset += TCP_SACK_BLOCK_LENGTH;
-
-            /* Start on the next buffer. */
-            buf_ptr = next_buffer;
-        }
-
-        else
-        {
-            buf_ptr = buf_ptr->next;
         }
     }
+#else
+    UNUSED_PARAMETER(buffer);
+    UNUSED_PARAMETER(prt);
+    UNUSED_PARAMETER(bytes_avail);
+    UNUSED_PARAMETER(left_edge);
+    UNUSED_PARAMETER(right_edge);
+#endif
 
     /* Update the offset value to be returned. */
     *offset_ptr = offset;
 
 } /* TCP_Build_SACK_Block */
 
-/*************************************************************************
-*
-*   FUNCTION
-*
-*       TCP_Find_Continuous_SACK_Block
-*
-*   DESCRIPTION
-*
-*       This function traverses the out of order list to find a contiguous
-*       block of data, starting with the buffer passed into the routine.
-*
-*   INPUTS
-*
-*       *ptr                    The buffer containing the left edge to
-*                               use.
-*       *right_edge             The right edge to fill in.
-*
-*   OUTPUTS
-*
-*       A pointer to the next buffer to pass into the routine.  This will
-*       be the next buffer in the list that is not part of the
-*       contiguous block found.
-*
-*************************************************************************/
-NET_BUFFER *TCP_Find_Continuous_SACK_Block(NET_BUFFER *ptr, UINT32 *right_edge)
-{
-    NET_BUFFER  *buf_ptr = ptr;
-    NET_BUFFER  *next_buffer = NU_NULL;
-
-    /* Initialize the right edge to the sequence number plus the length of
-     * the first segment.
-     */
-    *right_edge = buf_ptr->mem_seqnum + buf_ptr->mem_tcp_data_len;
-
-    /* While there are two buffers left to compare. */
-    while ( (buf_ptr) && (buf_ptr->next) )
-    {
-        /* If the next two blocks are contiguous. */
-        if (buf_ptr->mem_seqnum + buf_ptr->mem_tcp_data_len ==
-            buf_ptr->next->mem_seqnum)
-        {
-            /* Update the right edge to reflect the data in this
-             * contiguous block.
-             */
-            *right_edge += buf_ptr->next->mem_tcp_data_len;
-
-            /* Return a pointer to the next buffer's next.  Since
-             * the current buffer and the next buffer are contiguous,
-             * the next buffer's next might not be contiguous.
-             */
-            next_buffer = buf_ptr->next->next;
-        }
-
-        else
-        {
-            next_buffer = buf_ptr->next;
-            break;
-        }
-
-        /* Get a pointer to the next buffer. */
-        buf_ptr = buf_ptr->next;
-    }
-
-    /* Reset right_edge if no contiguous data was found. */
-    if (*right_edge == (ptr->mem_seqnum + ptr->mem_tcp_data_len))
-    {
-        *right_edge = 0;
-    }
-
-    return (next_buffer);
-
-} /* TCP_Find_Continuous_SACK_Block */
-
 /*************************************************************************
 *
 *   FUNCTION
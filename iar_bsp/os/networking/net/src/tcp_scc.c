@@ -18,7 +18,8 @@
 *   DESCRIPTION
 *
 *       This file contains the routine to enable or disable TCP
-*       Congestion Control for a socket.
+*       Congestion Control for a socket and select its congestion
+*       control module.
 *
 *   DATA STRUCTURES
 *
@@ -45,19 +46,22 @@
 *   DESCRIPTION
 *
 *       This function enables or disables TCP Congestion Control for a
-*       socket.
+*       socket, and selects the congestion control module to use.
 *
 *   INPUTS
 *
 *       socketd                 Specifies a socket descriptor
 *       opt_val                 A value of zero disables Congestion Control.
-*                               A non-zero value enables Congestion Control.
+*                               TCP_CC_NEWRENO, TCP_CC_CUBIC or
+*                               TCP_CC_BBR_LITE enables Congestion Control
+*                               with that module.
 *
 *   OUTPUTS
 *
 *       NU_SUCCESS              Successful operation.
 *       NU_INVALID_SOCKET       No valid port structure
-*       NU_INVAL                A connection has already been established.
+*       NU_INVAL                A connection has already been established,
+*                               or opt_val is not a valid module.
 *       NU_UNAVAILABLE          Congestion Control has not been enabled for
 *                               the system.
 *
@@ -68,7 +72,8 @@ STATUS TCP_Setsockopt_TCP_CONGESTION_CTRL(INT socketd, UINT8 opt_val)
 
 #if (INCLUDE_CONGESTION_CONTROL == NU_TRUE)
 
-    INT     pindex;
+    INT                 pindex;
+    const TCP_CC_OPS    *ops = NU_NULL;
 
     /* Retrieve the port index. */
     pindex = SCK_Sockets[socketd]->s_port_index;
@@ -76,8 +81,15 @@ STATUS TCP_Setsockopt_TCP_CONGESTION_CTRL(INT socketd, UINT8 opt_val)
     /* If the TCP port is valid. */
     if ( (pindex != NU_IGNORE_VALUE) && (TCP_Ports[pindex] != NU_NULL) )
     {
-        /* If a connection has not been established on the socket. */
-        if (TCP_Ports[pindex]->state == SREADY)
+        /* Look up the congestion control module. */
+        if (opt_val)
+            ops = TCP_CC_Get_Ops(opt_val);
+
+        /* If a connection has not been established on the socket and
+         * the module is valid.
+         */
+        if ( (TCP_Ports[pindex]->state == SREADY) &&
+             ((!opt_val) || (ops != NU_NULL)) )
         {
             /* Disable Congestion Control */
             if (!opt_val)
@@ -85,7 +97,10 @@ STATUS TCP_Setsockopt_TCP_CONGESTION_CTRL(INT socketd, UINT8 opt_val)
 
             /* Enable Congestion Control */
             else
+            {
                 TCP_Ports[pindex]->portFlags &= ~TCP_DIS_CONGESTION;
+                TCP_Ports[pindex]->p_cc_ops = ops;
+            }
 
             status = NU_SUCCESS;
         }
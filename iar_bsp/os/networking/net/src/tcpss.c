@@ -63,7 +63,7 @@
 #endif
 
 /* Local Prototypes. */
-STATIC STATUS  TCPSS_Net_Send(TCP_PORT *, NET_BUFFER *);
+STATIC STATUS  TCPSS_Net_Send(TCP_PORT *, NET_BUFFER *, UINT16);
 STATIC STATUS  TCPSS_Do_Connect(INT, UINT16);
 STATIC STATUS  TCPSS_Window_Probe(TCP_PORT *);
 STATIC INT     TCPSS_Is_Unique_Connection(const UINT8 *, UINT16,
@@ -71,7 +71,7 @@ STATIC INT     TCPSS_Is_Unique_Connection(const UINT8 *, UINT16,
 STATIC STATUS  TCPSS_Net_Close_EST(TCP_PORT *);
 STATIC INT32   TCPSS_Net_Read(struct sock_struct *, CHAR *, UINT16);
 STATIC INT32   TCPSS_Net_Write(const struct sock_struct *, UINT8 HUGE *,
-                               UINT16, INT *);
+                               UINT16, INT *, UINT16);
 
 extern TCP_BUFFER_LIST  TCP_Buffer_List;
 
@@ -361,8 +361,8 @@ STATIC INT32 TCPSS_Net_Read(struct sock_struct *sock_ptr, char *buffer,
 *
 *   DESCRIPTION
 *
-*       Transmit the data for TCP.  This function is used by NU_Send
-*       and NU_Sendmsg to transmit data over a TCP socket.
+*       Transmit the data for TCP.  This function is used by NU_Send,
+*       NU_Sendmsg and NU_Send_File to transmit data over a TCP socket.
 *
 *   INPUTS
 *
@@ -370,6 +370,10 @@ STATIC INT32 TCPSS_Net_Read(struct sock_struct *sock_ptr, char *buffer,
 *                               the data.
 *       *buffer                 Pointer to the data to be sent.
 *       nbytes                  The number of bytes of data to send.
+*       flags                   Flags to apply to this transmission in
+*                               addition to the flags of the socket;
+*                               SF_ZC_MODE indicates buffer is a Zero
+*                               Copy buffer chain.
 *
 *   OUTPUTS
 *
@@ -406,7 +410,7 @@ STATIC INT32 TCPSS_Net_Read(struct sock_struct *sock_ptr, char *buffer,
 *       NU_SOURCE_QUENCH
 *
 *************************************************************************/
-INT32 TCPSS_Send_Data(INT socketd, CHAR *buff, UINT16 nbytes)
+INT32 TCPSS_Send_Data(INT socketd, CHAR *buff, UINT16 nbytes, UINT16 flags)
 {
     NET_BUFFER_SUSPENSION_ELEMENT   waiting_for_buffer;
     UINT16                          count;              /* number of bytes written */
@@ -434,7 +438,7 @@ INT32 TCPSS_Send_Data(INT socketd, CHAR *buff, UINT16 nbytes)
          ((TCP_Ports[sockptr->s_port_index]->state == SCWAIT) ||
           (TCP_Ports[sockptr->s_port_index]->state == SEST)) )
     {       
-        local_s_flags = sockptr->s_flags;
+        local_s_flags = (UINT16)(sockptr->s_flags | flags);
 
         /* Initialize the byte counters */
         count = 0;
@@ -519,13 +523,15 @@ INT32 TCPSS_Send_Data(INT socketd, CHAR *buff, UINT16 nbytes)
 
                 /* Send the chain */
                 curr_count = (UINT16)TCPSS_Net_Write(sockptr, (UINT8*)buff,
-                                                     tx_bytes, &status);
+                                                     tx_bytes, &status,
+                                                     local_s_flags);
             }
 
             /* call tcp/ip library netwrite routine */
             else
                 curr_count = (UINT16)TCPSS_Net_Write(sockptr, (UINT8*)(buff + count),
-                                                     bytes_to_go, &status);
+                                                     bytes_to_go, &status,
+                                                     local_s_flags);
 
             /* If 0 was returned, then for some reason we failed to send the
                data.  Check to see if we failed because we have already
@@ -610,7 +616,7 @@ INT32 TCPSS_Send_Data(INT socketd, CHAR *buff, UINT16 nbytes)
                        until TCP resumes the TX task.
                      */
                     else if ( (bytes_to_go != 0) &&
-                              ((!(SCK_Sockets[socketd]->s_flags & SF_ZC_MODE)) ||
+                              ((!(local_s_flags & SF_ZC_MODE)) ||
                                (curr_count == 0)) )
                     {
                         NLOG_Error_Log("Suspending for the window to open in TCPSS_Send_Data",
@@ -771,6 +777,8 @@ INT32 TCPSS_Send_Data(INT socketd, CHAR *buff, UINT16 nbytes)
 *       *buffer                 Pointer to the data to be sent.
 *       nbytes                  The number of bytes of data to send.
 *       *status                 Indicates why all data could not be sent.
+*       flags                   The flags of the transmission; see
+*                               TCPSS_Send_Data.
 *
 *   OUTPUTS
 *
@@ -778,7 +786,8 @@ INT32 TCPSS_Send_Data(INT socketd, CHAR *buff, UINT16 nbytes)
 *
 *************************************************************************/
 STATIC INT32 TCPSS_Net_Write(const struct sock_struct *sockptr,
-                             UINT8 HUGE *buffer, UINT16 nbytes, INT *status)
+                             UINT8 HUGE *buffer, UINT16 nbytes, INT *status,
+                             UINT16 flags)
 {
     INT         s;
     INT32       nsent = 0;
@@ -916,7 +925,7 @@ STATIC INT32 TCPSS_Net_Write(const struct sock_struct *sockptr,
              * happen since the congestion window should never fall below
              * the value of the other side's MSS.
              */
-            if (sockptr->s_flags & SF_ZC_MODE)
+            if (flags & SF_ZC_MODE)
             {
                 *status = NU_WINDOW_FULL;
                 return (0);
@@ -979,7 +988,7 @@ STATIC INT32 TCPSS_Net_Write(const struct sock_struct *sockptr,
     /* If this will be the start of a new buffer chain, determine
      * the number of bytes that can be copied into it.
      */
-    if ( (wind->nextPacket == NU_NULL) || (sockptr->s_flags & SF_ZC_MODE) )
+    if ( (wind->nextPacket == NU_NULL) || (flags & SF_ZC_MODE) )
     {
         /* If there is not enough data left to fill a complete buffer,
          * update bytes_left with the number of bytes left.
@@ -990,7 +999,7 @@ STATIC INT32 TCPSS_Net_Write(const struct sock_struct *sockptr,
         /* If this is not a Zero Copy socket, or the number of bytes to transmit
          * is equal to the number of bytes in the Zero Copy buffer.
          */
-        else if ( (!(sockptr->s_flags & SF_ZC_MODE)) ||
+        else if ( (!(flags & SF_ZC_MODE)) ||
                   (numbytes == (INT32)nbytes) )
             bytes_left = numbytes;
 
@@ -1106,7 +1115,7 @@ STATIC INT32 TCPSS_Net_Write(const struct sock_struct *sockptr,
         if (!buf_ptr)
         {
             /* If this is not a Zero Copy transmission */
-            if (!(sockptr->s_flags & SF_ZC_MODE))
+            if (!(flags & SF_ZC_MODE))
             {
                 /* Make sure there are enough buffers left before we take
                  * another one. We must leave some for RX.
@@ -1192,7 +1201,7 @@ STATIC INT32 TCPSS_Net_Write(const struct sock_struct *sockptr,
         /* If this is not a Zero Copy buffer and the hardware has not been
          * configured to compute the checksum.
          */
-        if ( (!(sockptr->s_flags & SF_ZC_MODE))
+        if ( (!(flags & SF_ZC_MODE))
 #if (HARDWARE_OFFLOAD == NU_TRUE)
             && ((prt->tp_route.rt_route)&&(!(prt->tp_route.rt_route->rt_entry_parms.rt_parm_device->
               dev_hw_options_enabled & HW_TX_TCP_CHKSUM)))
@@ -1207,12 +1216,12 @@ STATIC INT32 TCPSS_Net_Write(const struct sock_struct *sockptr,
 
         /* Copy the data into the NET buffer */
         bytes_left = MEM_Copy_Data(buf_ptr, (CHAR*)buffer, bytes_left,
-                                   sockptr->s_flags);
+                                   flags);
 
         /* If this is not a Zero Copy buffer, move forward in the buffer by
          * the amount of data just copied.
          */
-        if (!(sockptr->s_flags & SF_ZC_MODE))
+        if (!(flags & SF_ZC_MODE))
             buffer += bytes_left;
 
         buf_ptr->mem_tcp_data_len = (UINT16)(buf_ptr->mem_tcp_data_len + bytes_left);
@@ -1222,7 +1231,7 @@ STATIC INT32 TCPSS_Net_Write(const struct sock_struct *sockptr,
          * clear the event.  The data that the event was intended for has just
          * been sent.
          */
-        s = TCPSS_Net_Send(prt, buf_ptr);
+        s = TCPSS_Net_Send(prt, buf_ptr, flags);
 
         /* Unset the Limited Transmit flag. */
         prt->portFlags &= ~TCP_TX_LMTD_DATA;
@@ -2641,13 +2650,15 @@ VOID TCPSS_Send_Window_Probe(UINT16 pindex)
 *
 *       *prt                    Pointer to a port.
 *       *buf_ptr                NET buffer.
+*       flags                   The flags of the transmission; see
+*                               TCPSS_Send_Data.
 *
 *   OUTPUTS
 *
 *       The number of bytes that were sent.
 *
 *************************************************************************/
-STATIC STATUS TCPSS_Net_Send(TCP_PORT *prt, NET_BUFFER *buf_ptr)
+STATIC STATUS TCPSS_Net_Send(TCP_PORT *prt, NET_BUFFER *buf_ptr, UINT16 flags)
 {
     STATUS          nsent, status;
     TCP_WINDOW      *wind;
@@ -2661,7 +2672,7 @@ STATIC STATUS TCPSS_Net_Send(TCP_PORT *prt, NET_BUFFER *buf_ptr)
      * has been disabled).  If so send every packet immediately with the
      * push flag set.  Zero Copy buffers are sent immediately.
      */
-    if ( (wind->push) || (SCK_Sockets[prt->p_socketd]->s_flags & SF_ZC_MODE) )
+    if ( (wind->push) || (flags & SF_ZC_MODE) )
     {
         prt->out.tcp_flags |= TPUSH;
 
@@ -35,6 +35,7 @@
 *       UDP_Port_Cleanup
 *       UDP_Handle_Datagram_Error
 *       UDP_Get_Pnum
+*       UDP_IP_Header_Length
 *
 *   DEPENDENCIES
 *
@@ -65,6 +66,7 @@ struct uport *UDP_Ports[UDP_MAX_PORTS];
 
 /* Local Prototypes */
 STATIC  STATUS  UDP_Append(INT , NET_BUFFER *);
+STATIC  UINT16  UDP_IP_Header_Length(const NET_BUFFER *);
 STATIC  INT32   UDP_Read(struct sock_struct *, CHAR *, struct addr_struct *,
                          UINT16);
 STATIC  INT32   UDP_Send(UDP_PORT *, CHAR *, INT32);
@@ -280,6 +282,12 @@ INT16 UDP_Interpret(NET_BUFFER *buf_ptr, UDP_PORT *uptr, INT port_index,
             /* Set the total length for this new packet. */
             new_buf_ptr->mem_total_data_len = buf_ptr->mem_total_data_len;
 
+#if (INCLUDE_NET_LATENCY_TRACE == NU_TRUE)
+            /* Time the copy from when the original packet was received. */
+            new_buf_ptr->mem_lat_stamp = buf_ptr->mem_lat_stamp;
+            new_buf_ptr->mem_lat_stage = buf_ptr->mem_lat_stage;
+#endif
+
             current_buf_ptr = new_buf_ptr;
 
             while (current_buf_ptr)
@@ -362,7 +370,6 @@ STATIC STATUS UDP_Append(INT port_index, NET_BUFFER *buf_ptr)
     UDP_PORT            *uptr = UDP_Ports[port_index];
     struct sock_struct  *sockptr;
     STATUS              status = NU_SUCCESS;
-    struct SCK_TASK_ENT *task_entry_ptr;
 
     sockptr = SCK_Sockets[uptr->up_socketd];
 
@@ -372,6 +379,22 @@ STATIC STATUS UDP_Append(INT port_index, NET_BUFFER *buf_ptr)
         buf_ptr->data_len           -= UDP_HEADER_LEN;
         buf_ptr->mem_total_data_len -= UDP_HEADER_LEN;
 
+        NET_LAT_STAMP(buf_ptr, NET_LAT_DEMUX, NET_LAT_SOCKET);
+
+        /* If the owning task takes the datagrams of this socket from a
+         * receive ring, point the buffer at the UDP data and hand it
+         * straight to the task.
+         */
+        if (sockptr->s_rx_ring != NU_NULL)
+        {
+            buf_ptr->data_ptr += (UDP_IP_Header_Length(buf_ptr) +
+                                  UDP_HEADER_LEN);
+
+            SCK_Rx_Ring_Put(sockptr->s_rx_ring, buf_ptr);
+
+            return (NU_SUCCESS);
+        }
+
         /* Place the datagram onto this ports datagram list. */
         MEM_Buffer_Enqueue(&sockptr->s_recvlist, buf_ptr);
 
@@ -383,23 +406,9 @@ STATIC STATUS UDP_Append(INT port_index, NET_BUFFER *buf_ptr)
         /* Trace log */
         T_SOCK_ENQ(sockptr->s_recvpackets, sockptr->s_recvbytes, uptr->up_socketd);
 
-        /* If there is a task pending data on the port, then set an event to
-           resume that task. */
-        if (sockptr->s_RXTask_List.flink)
-        {
-            /* Get the task to resume off the list */
-            task_entry_ptr = DLL_Dequeue (&sockptr->s_RXTask_List);
-
-            /* Resume the task pending on a receive */
-            if (NU_Resume_Task(task_entry_ptr->task) != NU_SUCCESS)
-            {
-                NLOG_Error_Log("Failed to resume task", NERR_SEVERE,
-                               __FILE__, __LINE__);
-
-                NET_DBG_Notify(status, __FILE__, __LINE__,
-                               NU_Current_Task_Pointer(), NU_NULL);
-           }
-        }
+        /* If there is a task pending data on the port, resume that
+           task. */
+        SCK_Resume_Receiver(uptr->up_socketd);
     }
     else
     {
@@ -619,32 +628,8 @@ STATIC INT32 UDP_Read(struct sock_struct *sockptr, char *buffer,
      */
     pkt = sockptr->s_recvlist.head->data_ptr;
 
-    /* Increment past the IP header to the UDP header */
-#if ( (INCLUDE_IPV6 == NU_TRUE) && (INCLUDE_IPV4 == NU_TRUE) )
-
-    /* The total data length has already been decremented to exclude the
-     * IPv6 header, IPv6 extension headers and UDP header.  The payload stored
-     * in the IPv6 header includes the IPv6 extension headers.  Subtract the
-     * total data length stored in the buffer from the payload length stored
-     * in the header to determine the length of the IPv6 extension headers.
-     */
-    if (sockptr->s_recvlist.head->mem_flags & NET_IP6)
-#endif
-#if (INCLUDE_IPV6 == NU_TRUE)
-        hlen = (UINT16)(IP6_HEADER_LEN +
-               (GET16(sockptr->s_recvlist.head->data_ptr, IP6_PAYLEN_OFFSET) -
-               sockptr->s_recvlist.head->mem_total_data_len) - UDP_HEADER_LEN);
-
-#if (INCLUDE_IPV4 == NU_TRUE)
-    /* Increment past the IPv4 header to the UDP header */
-    else
-#endif
-#endif
-
-#if (INCLUDE_IPV4 == NU_TRUE)
-        hlen = (UINT16)((GET8(sockptr->s_recvlist.head->data_ptr,
-                              IP_VERSIONANDHDRLEN_OFFSET) & 0x0f) << 2);
-#endif
+    /* Get the length of the IP header that precedes the UDP header */
+    hlen = UDP_IP_Header_Length(sockptr->s_recvlist.head);
 
     /* If this socket is not connected, fill in the socket structure with
      * information from the UDP header.
@@ -1973,3 +1958,58 @@ INT16 UDP_Get_Pnum(const struct sock_struct *socket_desc)
     return (pnum);
 
 } /* UDP_Get_Pnum */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       UDP_IP_Header_Length
+*
+*   DESCRIPTION
+*
+*       This function returns the length of the IP header, including any
+*       IPv6 extension headers, of a received datagram whose UDP header
+*       has already been stripped from its length.
+*
+*   INPUTS
+*
+*       *buf_ptr                Pointer to the datagram.  The data pointer
+*                               must point to the IP header.
+*
+*   OUTPUTS
+*
+*       UINT16                  The length of the IP header.
+*
+*************************************************************************/
+STATIC UINT16 UDP_IP_Header_Length(const NET_BUFFER *buf_ptr)
+{
+    UINT16          hlen;
+
+#if ( (INCLUDE_IPV6 == NU_TRUE) && (INCLUDE_IPV4 == NU_TRUE) )
+
+    /* The total data length has already been decremented to exclude the
+     * IPv6 header, IPv6 extension headers and UDP header.  The payload stored
+     * in the IPv6 header includes the IPv6 extension headers.  Subtract the
+     * total data length stored in the buffer from the payload length stored
+     * in the header to determine the length of the IPv6 extension headers.
+     */
+    if (buf_ptr->mem_flags & NET_IP6)
+#endif
+#if (INCLUDE_IPV6 == NU_TRUE)
+        hlen = (UINT16)(IP6_HEADER_LEN +
+               (GET16(buf_ptr->data_ptr, IP6_PAYLEN_OFFSET) -
+               buf_ptr->mem_total_data_len) - UDP_HEADER_LEN);
+
+#if (INCLUDE_IPV4 == NU_TRUE)
+    else
+#endif
+#endif
+
+#if (INCLUDE_IPV4 == NU_TRUE)
+        hlen = (UINT16)((GET8(buf_ptr->data_ptr,
+                              IP_VERSIONANDHDRLEN_OFFSET) & 0x0f) << 2);
+#endif
+
+    return (hlen);
+
+} /* UDP_IP_Header_Length */
@@ -123,6 +123,9 @@ STATUS VLAN_Initialize (DV_DEVICE_ENTRY *device)
 
         device->dev_flags |= DV_UP;   /* Set the device is UP flag */
 
+        /* Cached route lookups depend on the device and route state */
+        RTAB_Invalidate_Route_Cache();
+
     }
 
     return(status);
@@ -250,6 +253,8 @@ STATUS VLAN_Ether_Send(NET_BUFFER *buf_ptr, DV_DEVICE_ENTRY *device,
 
         old_int = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
 
+        NET_LAT_START(buf_ptr, NET_LAT_TX_QUEUE);
+
         /* Place the buffer on the REAL device's transmit queue. */
         MEM_Buffer_Enqueue(&real_device->dev_transq, buf_ptr);
 
@@ -46,6 +46,12 @@
 *       This auction will handle receiving data across a network during a
 *       connection oriented transfer. Used only in ZEROCOPY operations.
 *
+*       If a receive ring is registered on the socket (see
+*       NU_Recv_Ring_Register), the datagram is taken from the ring
+*       without obtaining the stack semaphore once the datagrams that
+*       were queued on the socket before the ring was registered have
+*       been received.
+*
 *   INPUTS
 *
 *       socketd                 Specifies a socket descriptor
@@ -90,6 +96,8 @@
 *       NU_DEST_UNREACH_SRCFAIL
 *       NU_PARM_PROB
 *       NU_SOURCE_QUENCH
+*       NU_SOCKET_CLOSED        The receive ring was removed while
+*                               suspending.
 *
 *************************************************************************/
 INT32 NU_ZC_Recv(INT socketd, NET_BUFFER **buff, UINT16 nbytes, INT16 flags)
@@ -97,6 +105,7 @@ INT32 NU_ZC_Recv(INT socketd, NET_BUFFER **buff, UINT16 nbytes, INT16 flags)
     INT32       bytes_recv;   /* number of bytes read */
     UINT32      addr;         /* hold a 32 bit address */
     OPTION   old_preempt;    /* indicates preemption state */
+    SCK_RX_RING *ring_ptr;   /* receive ring of the socket */
     NU_SUPERV_USER_VARIABLES
 
     /* Switch to supervisor mode. */
@@ -139,6 +148,27 @@ INT32 NU_ZC_Recv(INT socketd, NET_BUFFER **buff, UINT16 nbytes, INT16 flags)
         return (NU_INVALID_PARM);
     }
 
+    /* Take the datagram from the receive ring of the socket.  The ring
+     * is referenced before preemption is restored, so closing the socket
+     * cannot free it while this task is using it.
+     */
+    ring_ptr = SCK_Sockets[socketd]->s_rx_ring;
+
+    if ( (ring_ptr != NU_NULL) &&
+         (SCK_Sockets[socketd]->s_recvpackets == 0) )
+    {
+        ring_ptr->srr_users++;
+
+        /* Restore preemption */
+        NU_Change_Preemption(old_preempt);
+
+        bytes_recv = SCK_Rx_Ring_Recv(socketd, ring_ptr, buff);
+
+        /* Return to user mode */
+        NU_USER_MODE();
+
+        return (bytes_recv);
+    }
 
     /* Restore preemption */
     NU_Change_Preemption(old_preempt);
@@ -91,6 +91,9 @@ STATUS SIXTOFOUR_Initialize(DV_DEVICE_ENTRY *virtual_device)
     virtual_device->dev_flags |= (DV_UP | DV6_VIRTUAL_DEV | DV_MULTICAST);
     virtual_device->dev_flags2 |= DV6_UP;
 
+    /* Cached route lookups depend on the device state */
+    RTAB_Invalidate_Route_Cache();
+
     /* Set the length of the link-layer header to 0, because when using a
      * virtual device, an IPv6 packet is encapsulated in an IPv4 packet, and
      * the IPv4 send routine will take care of building the header for the
@@ -94,7 +94,7 @@ STATUS CFG6_Configure_Tunnel(const UINT8 *dev_name, const UINT8 *source_addr,
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore to protect the device table */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -141,6 +141,9 @@ STATUS CFG6_Configure_Tunnel(const UINT8 *dev_name, const UINT8 *source_addr,
             virtual_device->dev_flags |= DV_UP;
             virtual_device->dev_flags2 |= DV6_UP;
 
+            /* Cached route lookups depend on the device state */
+            RTAB_Invalidate_Route_Cache();
+
             status = NU_SUCCESS;
         }
     }
@@ -152,7 +155,7 @@ STATUS CFG6_Configure_Tunnel(const UINT8 *dev_name, const UINT8 *source_addr,
                        NERR_INFORMATIONAL, __FILE__, __LINE__);
     }
 
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE, 
                        __FILE__, __LINE__);
 
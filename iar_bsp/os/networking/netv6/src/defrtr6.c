@@ -270,6 +270,11 @@ VOID DEFRTR6_Delete_Entry(IP6_DEFAULT_ROUTER_ENTRY *rtr_entry)
         /* Delete all the routes that use this node as the gateway */
         RTAB6_Delete_Route_By_Gateway(rtr_entry->ip6_def_rtr_ip_addr);
 
+        /* Cached route lookups may have resolved to this router even if
+         * no route had it as the gateway.
+         */
+        RTAB_Invalidate_Route_Cache();
+
         /* Deallocate the memory being used by this entry */
         if (NU_Deallocate_Memory(rtr_entry) != NU_SUCCESS)
             NLOG_Error_Log("Failed to deallocate the memory for the Default Router entry", 
@@ -1071,6 +1071,9 @@ INT DEV6_Attach_IP_To_Device(const CHAR *name, const UINT8 *ip_addr,
             /* Indicate that the device is able to receive IPv6 packets. */
             device->dev_flags2 |= DV6_UP;
 
+            /* Cached route lookups depend on the device state */
+            RTAB_Invalidate_Route_Cache();
+
             status = DEV6_Add_IP_To_Device(device, ip_addr, 0, 0xffffffffUL,
                                            0xffffffffUL, flags);
         }
@@ -1201,6 +1204,9 @@ VOID DEV6_Verify_Valid_Addr(TQ_EVENT event, UNSIGNED addr_id,
             {
                 /* Indicate that the device is not able to receive IPv6 packets. */
                 addr_entry->dev6_device->dev_flags2 &= ~DV6_UP;
+
+                /* Cached route lookups depend on the device state */
+                RTAB_Invalidate_Route_Cache();
             }
         }
 
@@ -483,7 +483,7 @@ VOID DHCP6_Free_TX_Struct(DHCP6_TX_STRUCT *tx_ptr)
     tx_ptr->dhcp6_use = 0;
 
     /* Get the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Clear the timer that is running to retransmit the message. */
         TQ_Timerunset(DHCP6_Retrans_Event, TQ_CLEAR_EXACT, tx_ptr->dhcp6_id, 
@@ -498,7 +498,7 @@ VOID DHCP6_Free_TX_Struct(DHCP6_TX_STRUCT *tx_ptr)
                       0);
 
         /* Release the semaphore. */
-        NU_Release_Semaphore(&TCP_Resource);
+        NET_Release_Stack_Lock();
 
         /* Clear out the contents of the structure. */
         memset(tx_ptr, 0, sizeof(DHCP6_TX_STRUCT));
@@ -774,7 +774,7 @@ VOID DHCP6_Event_Handler_Task(UNSIGNED argc, VOID *argv)
                     /* Get the NET semaphore since we are about to set a NET
                      * timer.
                      */
-                    status = NU_Obtain_Semaphore(&TCP_Resource, NU_NO_SUSPEND);
+                    status = NET_Obtain_Stack_Lock(NU_NO_SUSPEND);
 
                     if (status == NU_SUCCESS)
                     {
@@ -788,7 +788,7 @@ VOID DHCP6_Event_Handler_Task(UNSIGNED argc, VOID *argv)
                         }
 
                         /* Release the NET semaphore. */
-                        NU_Release_Semaphore(&TCP_Resource);
+                        NET_Release_Stack_Lock();
                     }
 
                     else
@@ -844,7 +844,7 @@ VOID DHCP6_Event_Handler_Task(UNSIGNED argc, VOID *argv)
                     /* Get the NET semaphore since we are about to set a NET
                      * timer.
                      */
-                    status = NU_Obtain_Semaphore(&TCP_Resource, NU_NO_SUSPEND);
+                    status = NET_Obtain_Stack_Lock(NU_NO_SUSPEND);
 
                     if (status == NU_SUCCESS)
                     {
@@ -858,7 +858,7 @@ VOID DHCP6_Event_Handler_Task(UNSIGNED argc, VOID *argv)
                         }
 
                         /* Release the NET semaphore. */
-                        NU_Release_Semaphore(&TCP_Resource);
+                        NET_Release_Stack_Lock();
                     }
 
                     else
@@ -491,7 +491,7 @@ STATIC STATUS DHCP6_Output(UINT8 *dhcp_buffer, INT nbytes,
         if (DHCP6_Compute_Retransmission_Time(tx_ptr, ds_ptr) == NU_SUCCESS)
         {
             /* Get the NET semaphore since we are about to set a NET timer. */
-            if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+            if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
             {
                 /* Set a timer to retransmit the packet if a response is
                  * not received within ds_ptr->dhcp6_rt seconds.
@@ -505,7 +505,7 @@ STATIC STATUS DHCP6_Output(UINT8 *dhcp_buffer, INT nbytes,
                                    NERR_SEVERE, __FILE__, __LINE__);
                 }
 
-                NU_Release_Semaphore(&TCP_Resource);
+                NET_Release_Stack_Lock();
             }
 
             else
@@ -581,7 +581,7 @@ STATIC UINT16 DHCP6_Add_System_IA_NA_Option(UINT8 *dhcp_buffer,
     nbytes += DHCP6_IA_NA_OPT_LEN;
 
     /* Obtain the TCP semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -616,7 +616,7 @@ STATIC UINT16 DHCP6_Add_System_IA_NA_Option(UINT8 *dhcp_buffer,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -1273,7 +1273,7 @@ STATUS DHCP6_Rebind_Addresses(DHCP6_STRUCT *ds_ptr)
         tx_ptr->dhcp6_ds_id = ds_ptr->dhcp6_id;
 
         /* Obtain the TCP semaphore. */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (status == NU_SUCCESS)
         {
@@ -1309,7 +1309,7 @@ STATUS DHCP6_Rebind_Addresses(DHCP6_STRUCT *ds_ptr)
             }
 
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
             {
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
@@ -2005,7 +2005,7 @@ VOID DHCP6_Free_Address(DHCP6_STRUCT *ds_ptr)
     DEV6_IF_ADDRESS *addr_ptr = NU_NULL, *next_addr;
 
     /* Obtain the TCP semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -2051,7 +2051,7 @@ VOID DHCP6_Free_Address(DHCP6_STRUCT *ds_ptr)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
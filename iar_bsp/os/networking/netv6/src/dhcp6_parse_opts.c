@@ -1296,8 +1296,7 @@ STATUS DHCP6_Parse_IA_NA_Option(UINT8 *buffer, DHCP6_STRUCT *ds_ptr,
                                (ds_ptr->dhcp6_flags & DHCP6_ALLOW_RAPID_COMMIT))) )
                     {
                         /* Get the semaphore. */
-                        status = NU_Obtain_Semaphore(&TCP_Resource, 
-                                                     NU_NO_SUSPEND);
+                        status = NET_Obtain_Stack_Lock(NU_NO_SUSPEND);
 
                         if (status == NU_SUCCESS)
                         {
@@ -1308,7 +1307,7 @@ STATUS DHCP6_Parse_IA_NA_Option(UINT8 *buffer, DHCP6_STRUCT *ds_ptr,
                                         DHCP6_RENEW);
 
                             /* Release the semaphore. */
-                            NU_Release_Semaphore(&TCP_Resource);
+                            NET_Release_Stack_Lock();
                         }
 
                         else
@@ -1481,7 +1480,7 @@ STATUS DHCP6_Parse_IA_Addr_Option(UINT8 *buffer, DHCP6_STRUCT *ds_ptr,
             else
             {
                 /* Get the NET semaphore. */
-                status = NU_Obtain_Semaphore(&TCP_Resource, NU_NO_SUSPEND);
+                status = NET_Obtain_Stack_Lock(NU_NO_SUSPEND);
 
                 if (status == NU_SUCCESS)
                 {
@@ -1514,7 +1513,7 @@ STATUS DHCP6_Parse_IA_Addr_Option(UINT8 *buffer, DHCP6_STRUCT *ds_ptr,
 	                             (tx_ptr->dhcp6_type == DHCP6_DECLINE) )
 	                        {
 	                            /* Release the semaphore. */
-	                            NU_Release_Semaphore(&TCP_Resource);
+	                            NET_Release_Stack_Lock();
 	
 	                            DHCP6_Free_Address(ds_ptr);
 	                        }
@@ -1529,13 +1528,13 @@ STATUS DHCP6_Parse_IA_Addr_Option(UINT8 *buffer, DHCP6_STRUCT *ds_ptr,
 	                            DEV6_Delete_IP_From_Device(addr_ptr);
 	
 	                            /* Release the semaphore. */
-	                            NU_Release_Semaphore(&TCP_Resource);
+	                            NET_Release_Stack_Lock();
 	                        }
 	
 	                        else
 	                        {
 	                            /* Release the semaphore. */
-	                            NU_Release_Semaphore(&TCP_Resource);
+	                            NET_Release_Stack_Lock();
 	                        }
 	
 	                        /* If the user specified this address. */
@@ -1649,14 +1648,14 @@ STATUS DHCP6_Parse_IA_Addr_Option(UINT8 *buffer, DHCP6_STRUCT *ds_ptr,
 	                        }
 
 	                        /* Release the semaphore. */
-	                        NU_Release_Semaphore(&TCP_Resource);
+	                        NET_Release_Stack_Lock();
 						}
                     }
 					
 					else
 					{
                         /* Release the semaphore. */
-                        NU_Release_Semaphore(&TCP_Resource);						
+                        NET_Release_Stack_Lock();						
 					}
                 }
             }
@@ -143,7 +143,7 @@ STATUS NU_Dhcp6_Shutdown(UINT32 dev_index, UINT8 flags)
             NU_Deallocate_Memory(ds_ptr);
 
             /* Get the NET semaphore. */
-            status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+            status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
             if (status == NU_SUCCESS)
             {
@@ -191,7 +191,7 @@ STATUS NU_Dhcp6_Shutdown(UINT32 dev_index, UINT8 flags)
                 }
 
                 /* Release the NET semaphore. */
-                NU_Release_Semaphore(&TCP_Resource);
+                NET_Release_Stack_Lock();
             }
         }
 
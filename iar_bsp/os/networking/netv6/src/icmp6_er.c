@@ -91,7 +91,7 @@ STATUS ICMP6_Send_Echo_Request(UINT8 *dest_ip, UINT32 timeout)
     NU_SUPERVISOR_MODE();
 
     /* Grab the stack semaphore */
-    ret_status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    ret_status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (ret_status != NU_SUCCESS)
     {
@@ -161,7 +161,7 @@ STATUS ICMP6_Send_Echo_Request(UINT8 *dest_ip, UINT32 timeout)
                                    __FILE__, __LINE__);
         
                     /* Release the stack semaphore */
-                    if (NU_Release_Semaphore (&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                         NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE, 
                                        __FILE__, __LINE__);
                 
@@ -206,7 +206,7 @@ STATUS ICMP6_Send_Echo_Request(UINT8 *dest_ip, UINT32 timeout)
                     old_preempt = NU_Change_Preemption(NU_NO_PREEMPT);
     
                     /* Release the stack semaphore */
-                    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                    if (NET_Release_Stack_Lock() != NU_SUCCESS)
                         NLOG_Error_Log("Failed to release the semaphore", 
                                        NERR_SEVERE, __FILE__, __LINE__);
     
@@ -240,7 +240,7 @@ STATUS ICMP6_Send_Echo_Request(UINT8 *dest_ip, UINT32 timeout)
                                NERR_SEVERE, __FILE__, __LINE__);
         
                 /* Release the stack semaphore */
-                if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+                if (NET_Release_Stack_Lock() != NU_SUCCESS)
                     NLOG_Error_Log("Failed to release the semaphore", 
                                    NERR_SEVERE, __FILE__, __LINE__);
 
@@ -262,7 +262,7 @@ STATUS ICMP6_Send_Echo_Request(UINT8 *dest_ip, UINT32 timeout)
                            __FILE__, __LINE__);
     
             /* Release the stack semaphore */
-            if (NU_Release_Semaphore (&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release the semaphore", 
                                NERR_SEVERE, __FILE__, __LINE__);
    
@@ -275,7 +275,7 @@ STATUS ICMP6_Send_Echo_Request(UINT8 *dest_ip, UINT32 timeout)
                        NERR_SEVERE, __FILE__, __LINE__);
     
         /* Release the stack semaphore */
-        if (NU_Release_Semaphore (&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", 
                            NERR_SEVERE, __FILE__, __LINE__);
    
@@ -94,6 +94,9 @@ RTAB6_ROUTE     IP6_Forward_Rt;
 
 #if (INCLUDE_IP_REASSEMBLY == NU_TRUE)
 IP6_QUEUE     IP6_Frag_Queue;
+
+/* The reassembly queues hashed by the fields that identify a packet. */
+IP6_QUEUE_ELEMENT   *IP6_Frag_Hash[IP_REASM_HASH_SIZE];
 #endif
 
 struct id_struct    IP6_ADDR_ANY;
@@ -167,6 +170,8 @@ VOID IP6_Initialize(VOID)
     /* Initialize the IPV6 Fragmentation Queue */
     IP6_Frag_Queue.ipq_head = NU_NULL;
     IP6_Frag_Queue.ipq_tail = NU_NULL;
+
+    UTL_Zero(IP6_Frag_Hash, sizeof(IP6_Frag_Hash));
 #endif
 
     /* Register the event to expire an IPv6 address */
@@ -272,7 +272,7 @@ UINT16 IP6_MIB_ADDR_PRE_Get_Next(UINT32 *if_index, UINT8 *addr_prefix,
     UINT16                  status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Mark the status to error code. */
         status = IP6_MIB_NOSUCHOBJECT;
@@ -394,7 +394,7 @@ UINT16 IP6_MIB_ADDR_PRE_Get_Next(UINT32 *if_index, UINT8 *addr_prefix,
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -452,7 +452,7 @@ UINT16 IP6_MIB_ADDR_PRE_Get_OnLinkFlag(UINT32 if_index, UINT8 *addr_prefix,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Getting handle to the prefix address. */
         prefix_entry = IP6_MIB_ADDR_PRE_Get_Util(if_index, addr_prefix,
@@ -476,7 +476,7 @@ UINT16 IP6_MIB_ADDR_PRE_Get_OnLinkFlag(UINT32 if_index, UINT8 *addr_prefix,
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -534,7 +534,7 @@ UINT16 IP6_MIB_ADDR_PRE_Get_AutmosFlag(UINT32 if_index, UINT8 *addr_prefix,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Getting handle to the prefix address. */
         prefix_entry = IP6_MIB_ADDR_PRE_Get_Util(if_index, addr_prefix,
@@ -558,7 +558,7 @@ UINT16 IP6_MIB_ADDR_PRE_Get_AutmosFlag(UINT32 if_index, UINT8 *addr_prefix,
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -617,7 +617,7 @@ UINT16 IP6_MIB_ADDR_PRE_Get_PreferLife(UINT32 if_index, UINT8 *addr_prefix,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Getting handle to the prefix address. */
         prefix_entry = IP6_MIB_ADDR_PRE_Get_Util(if_index, addr_prefix,
@@ -638,7 +638,7 @@ UINT16 IP6_MIB_ADDR_PRE_Get_PreferLife(UINT32 if_index, UINT8 *addr_prefix,
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -696,7 +696,7 @@ UINT16 IP6_MIB_ADDR_PRE_Get_ValidLife(UINT32 if_index, UINT8 *addr_prefix,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Getting handle to the prefix address. */
         prefix_entry = IP6_MIB_ADDR_PRE_Get_Util(if_index, addr_prefix,
@@ -718,7 +718,7 @@ UINT16 IP6_MIB_ADDR_PRE_Get_ValidLife(UINT32 if_index, UINT8 *addr_prefix,
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -92,7 +92,7 @@ UINT16 IP6_MIB_ICMP_Get_Stat(UINT32 if_index, UINT32 option, UINT32 *value)
         status = IP6_MIB_NOSUCHNAME;
 
     /* Grab the semaphore. */
-    else if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    else if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         NLOG_Error_Log("Failed to grab the semaphore", NERR_SEVERE,
                        __FILE__, __LINE__);
@@ -124,7 +124,7 @@ UINT16 IP6_MIB_ICMP_Get_Stat(UINT32 if_index, UINT32 option, UINT32 *value)
         }
 
         /* Release semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -91,7 +91,7 @@ UINT16 IP6_IF_MIB_Get_Number(UINT32 *number)
     UINT16                  status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Set IPv6 enabled interfaces to zero '0' to start counting. */
         (*number) = 0;
@@ -123,7 +123,7 @@ UINT16 IP6_IF_MIB_Get_Number(UINT32 *number)
         status = IP6_MIB_SUCCESS;
 
         /* Releasing the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -180,7 +180,7 @@ UINT16 IP6_IF_MIB_Get_Next_Index(UINT32 *if_index)
     UINT16                  status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Initialize device handle to first interface device. */
         dev = DEV_Table.dv_head;
@@ -210,7 +210,7 @@ UINT16 IP6_IF_MIB_Get_Next_Index(UINT32 *if_index)
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Releasing semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -265,7 +265,7 @@ UINT16 IP6_IF_MIB_Get_Index(UINT32 if_index)
     UINT16          status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         if (if_index > 0)
         {
@@ -298,7 +298,7 @@ UINT16 IP6_IF_MIB_Get_Index(UINT32 if_index)
         }
 
         /* Releasing semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -351,7 +351,7 @@ UINT16 IP6_IF_MIB_Get_Descr(UINT32 if_index, CHAR *if_descr)
     UINT16                  status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         if (if_index > 0)
         {
@@ -384,7 +384,7 @@ UINT16 IP6_IF_MIB_Get_Descr(UINT32 if_index, CHAR *if_descr)
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Releasing semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -442,7 +442,7 @@ UINT16 IP6_IF_MIB_Set_Descr(UINT32 if_index, CHAR *if_descr)
     UINT16                  status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         if (if_index > 0)
         {
@@ -487,7 +487,7 @@ UINT16 IP6_IF_MIB_Set_Descr(UINT32 if_index, CHAR *if_descr)
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Releasing semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -557,7 +557,7 @@ UINT16 IP6_IF_MIB_Get_Lower_Layer(UINT32 if_index, UINT32 *object_oid,
     UINT16                  status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         if (if_index > 0)
         {
@@ -668,7 +668,7 @@ UINT16 IP6_IF_MIB_Get_Lower_Layer(UINT32 if_index, UINT32 *object_oid,
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Releasing semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -724,7 +724,7 @@ UINT16 IP6_IF_MIB_Get_Effective_MTU(UINT32 if_index, UINT32 *effective_mtu)
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* If we have valid interface index and we have IPv6 enabled
          * device with the interface index passed in.
@@ -756,7 +756,7 @@ UINT16 IP6_IF_MIB_Get_Effective_MTU(UINT32 if_index, UINT32 *effective_mtu)
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -810,7 +810,7 @@ UINT16 IP6_IF_MIB_Get_Reasm_Max_Size(UINT32 if_index,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* If we have valid interface index and we have IPV6 enabled
          * device with the interface index passed in.
@@ -842,7 +842,7 @@ UINT16 IP6_IF_MIB_Get_Reasm_Max_Size(UINT32 if_index,
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -896,7 +896,7 @@ UINT16 IP6_IF_MIB_Get_Identifier(UINT32 if_index, UINT8 *if_identifier)
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* If we have valid interface index and we have IPV6 enabled
          * device with the interface index passed in.
@@ -928,7 +928,7 @@ UINT16 IP6_IF_MIB_Get_Identifier(UINT32 if_index, UINT8 *if_identifier)
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Releasing the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -980,7 +980,7 @@ UINT16 IP6_IF_MIB_Set_Identifier(UINT32 if_index, UINT8 *if_identifier)
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* If we have valid interface index and we have IPV6 enabled
          * device with the interface index passed in.
@@ -1012,7 +1012,7 @@ UINT16 IP6_IF_MIB_Set_Identifier(UINT32 if_index, UINT8 *if_identifier)
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1067,7 +1067,7 @@ UINT16 IP6_IF_MIB_Get_Identifier_Len(UINT32 if_index, UINT32 *id_len)
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* If we have valid interface index and we have IPV6 enabled
          * device with the interface index passed in.
@@ -1100,7 +1100,7 @@ UINT16 IP6_IF_MIB_Get_Identifier_Len(UINT32 if_index, UINT32 *id_len)
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Releasing the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1154,7 +1154,7 @@ UINT16 IP6_IF_MIB_Set_Identifier_Len(UINT32 if_index, UINT32 id_len)
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* If we have valid interface identifier length. */
         if ( (id_len <= 64) && ((id_len & 0x7) == 0) )
@@ -1194,7 +1194,7 @@ UINT16 IP6_IF_MIB_Set_Identifier_Len(UINT32 if_index, UINT32 id_len)
             status = IP6_MIB_WRONGVALUE;
 
         /* Releasing the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1259,7 +1259,7 @@ UINT16 IP6_IF_MIB_Get_Status(UINT32 if_index, INT opt, UINT32 *counter)
     else if ( (opt > 0) && (opt <= 20) )
     {
         /* Grab the semaphore. */
-        if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+        if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
         {
             /* Get the handle to the interface device. */
             dev = DEV_Get_Dev_By_Index((if_index - 1));
@@ -1281,7 +1281,7 @@ UINT16 IP6_IF_MIB_Get_Status(UINT32 if_index, INT opt, UINT32 *counter)
                 status = IP6_MIB_NOSUCHOBJECT;
 
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
         }
@@ -152,7 +152,7 @@ UINT16 IP6_IF_ADDR_MIB_Get_Next(UINT32 *if_index, UINT8 *addr)
     UINT16              status = IP6_MIB_NOSUCHOBJECT;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Getting handle to first interface device. */
         dev = DEV_Table.dv_head;
@@ -268,7 +268,7 @@ UINT16 IP6_IF_ADDR_MIB_Get_Next(UINT32 *if_index, UINT8 *addr)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -325,7 +325,7 @@ UINT16 IP6_IF_ADDR_MIB_Get_Pfx_Length(UINT32 if_index, UINT8 *addr,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the interface address entry. */
         if_addr = IP6_IF_ADDR_MIB_Get(if_index, addr);
@@ -350,7 +350,7 @@ UINT16 IP6_IF_ADDR_MIB_Get_Pfx_Length(UINT32 if_index, UINT8 *addr,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -405,7 +405,7 @@ UINT16 IP6_IF_ADDR_MIB_Get_Type(UINT32 if_index, UINT8 *addr, UINT32 *type)
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Getting handle to the interface address list. */
         if_addr = IP6_IF_ADDR_MIB_Get(if_index, addr);
@@ -428,7 +428,7 @@ UINT16 IP6_IF_ADDR_MIB_Get_Type(UINT32 if_index, UINT8 *addr, UINT32 *type)
         }
 
         /* Releasing semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -483,7 +483,7 @@ UINT16 IP6_IF_ADDR_MIB_Get_AnycastFlag(UINT32 if_index, UINT8 *addr,
     UINT16              status;
 
     /* Gab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Getting handle to the interface address entry. */
         if_addr = IP6_IF_ADDR_MIB_Get(if_index, addr);
@@ -509,7 +509,7 @@ UINT16 IP6_IF_ADDR_MIB_Get_AnycastFlag(UINT32 if_index, UINT8 *addr,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -569,7 +569,7 @@ UINT16 IP6_IF_ADDR_MIB_Get_Status(UINT32 if_index, UINT8 *addr,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Getting the handle to the interface address entry. */
         if_addr = IP6_IF_ADDR_MIB_Get(if_index, addr);
@@ -614,7 +614,7 @@ UINT16 IP6_IF_ADDR_MIB_Get_Status(UINT32 if_index, UINT8 *addr,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
@@ -155,7 +155,7 @@ UINT16 IP6_MLD_MIB_Get_Next_Index(UINT32 *index)
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get handle to the first interface to start traversing the
          * device list.
@@ -200,7 +200,7 @@ UINT16 IP6_MLD_MIB_Get_Next_Index(UINT32 *index)
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -256,13 +256,13 @@ UINT16 IP6_MLD_MIB_Get_If_Status(UINT32 if_index, UINT32 *if_status)
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the interface device. */
         dev = IP6_MLD_MIB_Get_Device(if_index);
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource)!= NU_SUCCESS)
+        if (NET_Release_Stack_Lock()!= NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -338,7 +338,7 @@ UINT16 IP6_MLD_MIB_Get_If_Qrier_Addr(UINT32 if_index, UINT8 *addr)
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the MLD enabled interface device using the
          * interface index passed in.
@@ -351,7 +351,7 @@ UINT16 IP6_MLD_MIB_Get_If_Qrier_Addr(UINT32 if_index, UINT8 *addr)
             NU_BLOCK_COPY(dev_name, dev->dev_net_if_name, DEV_NAME_LENGTH);
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -506,7 +506,7 @@ UINT16 IP6_MLD_MIB_Get_Next_Cache(UINT8 *addr, UINT32 *if_index)
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Set candidate's interface index to represent invalid value that
          * also a greatest value that an UINT32 can have.
@@ -604,7 +604,7 @@ UINT16 IP6_MLD_MIB_Get_Next_Cache(UINT8 *addr, UINT32 *if_index)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -685,7 +685,7 @@ UINT16 IP6_MLD_MIB_Get_Cache_Self(UINT8 *addr, UINT32 if_index,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the MLD Cache entry. */
         mult = IP6_MLD_MIB_Get_Cache(addr, if_index, &dev);
@@ -709,7 +709,7 @@ UINT16 IP6_MLD_MIB_Get_Cache_Self(UINT8 *addr, UINT32 if_index,
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -768,7 +768,7 @@ UINT16 IP6_MLD_MIB_Get_Cache_Status(UINT8 *addr, UINT32 if_index,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the MLD Cache entry. */
         mult = IP6_MLD_MIB_Get_Cache(addr, if_index, &dev);
@@ -790,7 +790,7 @@ UINT16 IP6_MLD_MIB_Get_Cache_Status(UINT8 *addr, UINT32 if_index,
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
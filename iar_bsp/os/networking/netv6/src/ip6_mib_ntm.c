@@ -131,7 +131,7 @@ UINT16 IP6_MIB_NTM_Get_Next_Index(UINT32 *if_index, UINT8 *ipv6_addr)
     UINT16          status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Set candidate interface index to maximum values that can be
          * stored.
@@ -230,7 +230,7 @@ UINT16 IP6_MIB_NTM_Get_Next_Index(UINT32 *if_index, UINT8 *ipv6_addr)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
 
@@ -318,7 +318,7 @@ UINT16 IP6_MIB_NTM_Get(UINT32 if_index, UINT8 *ipv6_addr, VOID *value,
          (IP6_MIB_NTM_Getter_Functions[(opt - 1)] != NU_NULL) )
     {
         /* Grab the semaphore. */
-        if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+        if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
         {
             /* Get the index of relevant neighbor cache entry in the list
              * maintained in device structure.
@@ -341,7 +341,7 @@ UINT16 IP6_MIB_NTM_Get(UINT32 if_index, UINT8 *ipv6_addr, VOID *value,
                 status = IP6_MIB_NOSUCHOBJECT;
 
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                                __FILE__, __LINE__);
         }
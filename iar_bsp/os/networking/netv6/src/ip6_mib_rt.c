@@ -100,7 +100,7 @@ UINT16 IP6_MIB_RT_Get_Number(UINT32 *rt_entry_count)
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Clear the address. */
         UTL_Zero(addr, IP6_ADDR_LEN);
@@ -123,7 +123,7 @@ UINT16 IP6_MIB_RT_Get_Number(UINT32 *rt_entry_count)
         status = IP6_MIB_SUCCESS;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -225,7 +225,7 @@ UINT16 IP6_MIB_RT_Get_Next(UINT8 *addr, UINT32 *pfx_len,
     UINT16              status = IP6_MIB_NOSUCHOBJECT;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the route entry. */
         rt_entry = RTAB6_Find_Route(addr, (RT_HOST_MATCH | 
@@ -282,7 +282,7 @@ UINT16 IP6_MIB_RT_Get_Next(UINT8 *addr, UINT32 *pfx_len,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                             __FILE__, __LINE__);
     }
@@ -340,7 +340,7 @@ UINT16 IP6_MIB_RT_Get_If_Index(UINT8 *addr, UINT32 pfx_len,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the route entry. */
         rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -377,7 +377,7 @@ UINT16 IP6_MIB_RT_Get_If_Index(UINT8 *addr, UINT32 pfx_len,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -434,7 +434,7 @@ UINT16 IP6_MIB_RT_Get_Next_Hop(UINT8 *addr, UINT32 pfx_len,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the route entry. */
         rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -458,7 +458,7 @@ UINT16 IP6_MIB_RT_Get_Next_Hop(UINT8 *addr, UINT32 pfx_len,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to grab the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -515,7 +515,7 @@ UINT16 IP6_MIB_RT_Get_Type(UINT8 *addr, UINT32 pfx_len,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Grab the handle the route entry. */
         rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -546,7 +546,7 @@ UINT16 IP6_MIB_RT_Get_Type(UINT8 *addr, UINT32 pfx_len,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -602,7 +602,7 @@ UINT16 IP6_MIB_RT_Get_Protocol(UINT8 *addr, UINT32 pfx_len,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Grab the handle the route entry. */
         rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -635,7 +635,7 @@ UINT16 IP6_MIB_RT_Get_Protocol(UINT8 *addr, UINT32 pfx_len,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -691,7 +691,7 @@ UINT16 IP6_MIB_RT_Get_Policy(UINT8 *addr, UINT32 pfx_len,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to route entry. */
         rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -714,7 +714,7 @@ UINT16 IP6_MIB_RT_Get_Policy(UINT8 *addr, UINT32 pfx_len,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -771,7 +771,7 @@ UINT16 IP6_MIB_RT_Get_Age(UINT8 *addr, UINT32 pfx_len, UINT32 rt_index,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the route entry. */
         rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -797,7 +797,7 @@ UINT16 IP6_MIB_RT_Get_Age(UINT8 *addr, UINT32 pfx_len, UINT32 rt_index,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -854,7 +854,7 @@ UINT16 IP6_MIB_RT_Get_Next_Hop_RDI(UINT8 *addr, UINT32 pfx_len,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the route entry. */
         rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -878,7 +878,7 @@ UINT16 IP6_MIB_RT_Get_Next_Hop_RDI(UINT8 *addr, UINT32 pfx_len,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to grab the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -935,7 +935,7 @@ UINT16 IP6_MIB_RT_Get_Metric(UINT8 *addr, UINT32 pfx_len,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the route entry. */
         rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -958,7 +958,7 @@ UINT16 IP6_MIB_RT_Get_Metric(UINT8 *addr, UINT32 pfx_len,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1015,7 +1015,7 @@ UINT16 IP6_MIB_RT_Get_Weight(UINT8 *addr, UINT32 pfx_len,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Getting handle to the route entry. */
         rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -1037,7 +1037,7 @@ UINT16 IP6_MIB_RT_Get_Weight(UINT8 *addr, UINT32 pfx_len,
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
@@ -1096,7 +1096,7 @@ UINT16 IP6_MIB_RT_Get_Info(UINT8 *addr, UINT32 pfx_len,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the route entry. */
         rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -1121,7 +1121,7 @@ UINT16 IP6_MIB_RT_Get_Info(UINT8 *addr, UINT32 pfx_len,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", 
                            NERR_SEVERE, __FILE__, __LINE__);
     }
@@ -1180,7 +1180,7 @@ UINT16 IP6_MIB_RT_Get_Valid(UINT8 *addr, UINT32 pfx_len,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the route entry. */
         rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -1221,7 +1221,7 @@ UINT16 IP6_MIB_RT_Get_Valid(UINT8 *addr, UINT32 pfx_len,
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", 
                            NERR_SEVERE, __FILE__, __LINE__);
     }
@@ -1282,7 +1282,7 @@ UINT16 IP6_MIB_RT_Set_Valid(UINT8 *addr, UINT32 pfx_len, UINT32 rt_index,
     if ( (rt_valid == IP6_MIB_TRUE) || (rt_valid == IP6_MIB_FALSE) )
     {
         /* Grab the semaphore. */
-        if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+        if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
         {
             /* Get the handle to the route entry. */
             rt_entry = IP6_MIB_RT_Get(addr, pfx_len, rt_index);
@@ -1331,7 +1331,7 @@ UINT16 IP6_MIB_RT_Set_Valid(UINT8 *addr, UINT32 pfx_len, UINT32 rt_index,
             }
 
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release the semaphore", 
                                NERR_SEVERE, __FILE__, __LINE__);
         }
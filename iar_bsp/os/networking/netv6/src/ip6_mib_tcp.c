@@ -360,7 +360,7 @@ UINT16 IP6_MIB_TCP_Get_State(UINT8 getflag, UINT8 *local_addr,
     UINT16          status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* Get the handle to the socket structure. */
         sock_ptr = IP6_MIB_TCP_Socket_List_Info(getflag, local_addr,
@@ -428,7 +428,7 @@ UINT16 IP6_MIB_TCP_Get_State(UINT8 getflag, UINT8 *local_addr,
             status = IP6_MIB_NOSUCHOBJECT;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release the semaphore", 
                            NERR_SEVERE, __FILE__, __LINE__);
     }
@@ -494,7 +494,7 @@ UINT16 IP6_MIB_TCP_Set_State(UINT8 *local_addr, UINT16 local_port,
     if (sock_state == IP6_MIB_TCB_DELETE)
     {
         /* Grab the semaphore. */
-        if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+        if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
         {
             /* Get the handle to the socket structure. */
             sock_ptr = 
@@ -509,7 +509,7 @@ UINT16 IP6_MIB_TCP_Set_State(UINT8 *local_addr, UINT16 local_port,
                 socketd = TCP_Ports[sock_ptr->s_port_index]->p_socketd;
 
             /* Release the semaphore. */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release the semaphore", 
                                NERR_SEVERE, __FILE__, __LINE__);
 
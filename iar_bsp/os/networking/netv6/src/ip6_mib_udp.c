@@ -168,7 +168,7 @@ UINT16 IP6_MIB_UDP_Get_Socket_Info(UINT8 getflag, UINT8 *local_addr,
     UINT16              status;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* If this is the GET-Request. */
         if (getflag)
@@ -329,7 +329,7 @@ UINT16 IP6_MIB_UDP_Get_Socket_Info(UINT8 getflag, UINT8 *local_addr,
         else
             status = IP6_MIB_NOSUCHOBJECT;
 
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
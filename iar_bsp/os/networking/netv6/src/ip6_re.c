@@ -29,6 +29,7 @@
 *       IP6_Reassembly
 *       IP6_Reassemble_Event
 *       IP6_Free_Queue_Element
+*       IP6_Reasm_Unlink
 *
 *   DEPENDENCIES
 *
@@ -44,7 +45,11 @@
 #include SNMP_GLUE
 #endif
 
-extern IP6_QUEUE IP6_Frag_Queue;
+extern IP6_QUEUE          IP6_Frag_Queue;
+extern IP6_QUEUE_ELEMENT  *IP6_Frag_Hash[];
+extern UINT16             IP_Reasm_Buffers_Used;
+
+STATIC VOID IP6_Reasm_Unlink(IP6_QUEUE_ELEMENT *);
 
 /***********************************************************************
 *                                                                       
@@ -97,10 +102,11 @@ STATUS IP6_Reassemble_Packet(IP6LAYER **packet, NET_BUFFER **buf_ptr,
     /* Get the 32-bit fragment Identification value */
     ip_ident = GET32(pkt, (unfrag_len + IP6_FRAGMENT_ID_OFFSET));    
 
-    /* Search the list of fragmented packets to see if at least one 
-     * fragment from the same packet was previously received. 
+    /* Search the hash bucket of fragmented packets to see if at least
+     * one fragment from the same packet was previously received.
      */
-    for (fp = IP6_Frag_Queue.ipq_head; fp != NU_NULL; fp = fp->ipq_next)
+    for (fp = IP6_Frag_Hash[IP6_REASM_HASH(ip6_src, ip6_dest, ip_ident)];
+         fp != NU_NULL; fp = fp->ipq_hash_next)
     {
         /* Fragments are uniquely identified by IP id, source address
          * and the destination address -RFC 2460 Section 4.5
@@ -346,32 +352,104 @@ STATUS IP6_Reassemble_Packet(IP6LAYER **packet, NET_BUFFER **buf_ptr,
 *                               contains the complete datagram.                                          
 *                                                                       
 *************************************************************************/
-NET_BUFFER *IP6_Reassembly(IP6_REASM HUGE *ip6_frag, IP6LAYER *ip_pkt, 
-                           IP6_QUEUE_ELEMENT *fp, NET_BUFFER *buf_ptr, 
-                           UINT16 unfrag_len, UINT8 *next_header, 
+NET_BUFFER *IP6_Reassembly(IP6_REASM HUGE *ip6_frag, IP6LAYER *ip_pkt,
+                           IP6_QUEUE_ELEMENT *fp, NET_BUFFER *buf_ptr,
+                           UINT16 unfrag_len, UINT8 *next_header,
                            const UINT8 *ip6_src)
-{    
-    IP6_REASM  HUGE *q, HUGE *p = NU_NULL, HUGE *prev, HUGE *temp_q;
+{
+    IP6_REASM  HUGE *q, HUGE *p = NU_NULL, HUGE *temp_q;
+    IP6_QUEUE_ELEMENT   *victim;
     INT         i;
     INT32       total_length;
     INT         next;
     NET_BUFFER  *r_buf, *m;
     INT         old_int_level;
     UINT16      ip_pkt_ipf_offset, ip_pkt_tlen_offset;
+    UINT16      buffers, hash;
+    UINT32      frag_end, last_end;
     UINT8       target_hdr = IPPROTO_FRAGMENT;
     UINT16      work_len = IP6_HEADER_LEN;
 
-    /* Since reassembly involves only the data of each fragment, exclude 
-     * the IPv6 Fragment header from each fragment. 
+    /* Since reassembly involves only the data of each fragment, exclude
+     * the IPv6 Fragment header from each fragment.
      */
     buf_ptr->data_ptr += IP6_FRAGMENT_HDR_LENGTH;
     buf_ptr->data_len  -= (UINT32)(unfrag_len + IP6_FRAGMENT_HDR_LENGTH);
 
-    buf_ptr->mem_total_data_len -= 
+    buf_ptr->mem_total_data_len -=
         (UINT32)(unfrag_len + IP6_FRAGMENT_HDR_LENGTH);
 
-    /* If this is the first fragment to arrive, create a reassembly 
-     * queue. 
+    /* Save off these values to avoid a GET16 in the loops below. */
+    ip_pkt_ipf_offset = GET16(ip6_frag, IP6F_FRGOFFSET_OFFSET);
+    ip_pkt_tlen_offset = GET16(ip6_frag, IP6F_PAYLOAD_OFFSET);
+
+    frag_end = (UINT32)ip_pkt_ipf_offset + ip_pkt_tlen_offset;
+
+    if (fp != NU_NULL)
+    {
+        /* The end of the data received so far. */
+        last_end = (UINT32)GET16(fp->ipq_last_frag, IP6F_FRGOFFSET_OFFSET) +
+                   GET16(fp->ipq_last_frag, IP6F_PAYLOAD_OFFSET);
+
+        /* A fragment may not extend beyond the end of the packet, and
+         * the last fragment may neither change the length of the packet
+         * nor end before data that was already received.
+         */
+        if ( ((fp->ipq_total_len != 0) && (frag_end > fp->ipq_total_len)) ||
+             ((!(GET8(ip6_frag, IP6F_MFF_OFFSET) & 1)) &&
+              ((frag_end < last_end) ||
+               ((fp->ipq_total_len != 0) && (frag_end != fp->ipq_total_len)))) )
+        {
+            NLOG_Error_Log("Fragment inconsistent with packet length",
+                           NERR_INFORMATIONAL, __FILE__, __LINE__);
+
+            MEM_Buffer_Chain_Free(&MEM_Buffer_List, &MEM_Buffer_Freelist);
+
+            return (NU_NULL);
+        }
+    }
+
+    /* Count the buffers holding this fragment. */
+    for (m = buf_ptr, buffers = 0; m != NU_NULL; m = m->next_buffer)
+        buffers++;
+
+    /* Discard the oldest incomplete packets until this fragment fits
+     * within the buffers reserved for reassembly.
+     */
+    while ((UINT32)IP_Reasm_Buffers_Used + buffers > IP_REASM_MAX_BUFFERS)
+    {
+        victim = IP6_Frag_Queue.ipq_head;
+
+        if (victim == fp)
+            victim = victim->ipq_next;
+
+        if (victim == NU_NULL)
+            break;
+
+        NLOG_Error_Log("Reassembly buffers exhausted, discarding oldest packet",
+                       NERR_INFORMATIONAL, __FILE__, __LINE__);
+
+        /* Increment the number of IP fragmented packets that could not
+         * be reassembled.
+         */
+        MIB_ipv6IfStatsReasmFails_Inc(buf_ptr->mem_buf_device);
+
+        IP6_Free_Queue_Element(victim);
+    }
+
+    /* If the fragment still does not fit, drop it. */
+    if ((UINT32)IP_Reasm_Buffers_Used + buffers > IP_REASM_MAX_BUFFERS)
+    {
+        NLOG_Error_Log("Reassembly buffers exhausted, dropping fragment",
+                       NERR_INFORMATIONAL, __FILE__, __LINE__);
+
+        MEM_Buffer_Chain_Free(&MEM_Buffer_List, &MEM_Buffer_Freelist);
+
+        return (NU_NULL);
+    }
+
+    /* If this is the first fragment to arrive, create a reassembly
+     * queue.
      */
     if (fp == NU_NULL)
     {
@@ -380,7 +458,7 @@ NET_BUFFER *IP6_Reassembly(IP6_REASM HUGE *ip6_frag, IP6LAYER *ip_pkt,
                                (UNSIGNED)NU_NO_SUSPEND) != NU_SUCCESS)
         {
             /* Log an error and drop the packet. */
-            NLOG_Error_Log("Unable to alloc memory for IP queue", 
+            NLOG_Error_Log("Unable to alloc memory for IP queue",
                            NERR_SEVERE, __FILE__, __LINE__);
 
             MEM_Buffer_Chain_Free(&MEM_Buffer_List, &MEM_Buffer_Freelist);
@@ -390,174 +468,200 @@ NET_BUFFER *IP6_Reassembly(IP6_REASM HUGE *ip6_frag, IP6LAYER *ip_pkt,
 
         memset(fp, 0, sizeof(IP6_QUEUE_ELEMENT));
 
-        /* Insert this fragment reassembly header into the list. */
+        /* Insert this fragment reassembly header into the list.  The
+         * list is kept in order of arrival so the oldest packet is
+         * always at the head.
+         */
         DLL_Enqueue(&IP6_Frag_Queue, fp);
 
         /* Save off the fragment Identification field */
-        fp->ipq_id = 
-            GET32(ip_pkt, (unfrag_len + IP6_FRAGMENT_ID_OFFSET)); 
-        
-        /* The source and destination ip address fields are used to link 
-         * the fragments together. The next two lines copy the source 
-         * and destination address 
+        fp->ipq_id =
+            GET32(ip_pkt, (unfrag_len + IP6_FRAGMENT_ID_OFFSET));
+
+        /* The source and destination ip address fields are used to link
+         * the fragments together. The next two lines copy the source
+         * and destination address
          */
         NU_BLOCK_COPY(fp->ipq_dest, ip_pkt->ip6_dest, IP6_ADDR_LEN);
         NU_BLOCK_COPY(fp->ipq_source, ip6_src, IP6_ADDR_LEN);
-    
+
+        /* Insert this fragment reassembly header into its hash bucket. */
+        hash = IP6_REASM_HASH(fp->ipq_source, fp->ipq_dest, fp->ipq_id);
+
+        fp->ipq_hash_next = IP6_Frag_Hash[hash];
+        IP6_Frag_Hash[hash] = fp;
+
         /* Insert this fragment into the list. */
         fp->ipq_first_frag = ip6_frag;
+        fp->ipq_last_frag = ip6_frag;
 
         /* Store the address of the next fragment */
         PUT32(ip6_frag, IP6F_NEXT_OFFSET, NU_NULL);
 
-        /* Store the offset of the IPv6 header from the start 
+        /* Store the offset of the IPv6 header from the start
          * of the memory buffer.
          */
-        PUT8(ip6_frag, IP6F_BUF_OFFSET, 
+        PUT8(ip6_frag, IP6F_BUF_OFFSET,
              (UINT8)((CHAR HUGE *)ip_pkt - (CHAR HUGE *)buf_ptr));
 
         PUT32(ip6_frag, IP6F_HDR_OFFSET, (UINT32)(CHAR HUGE *)ip_pkt);
 
-        /* Set up a timer event to drop this fragment and any others 
-         * received that are part of the same datagram if the complete 
-         * datagram is not received. 
+        /* Set up a timer event to drop this fragment and any others
+         * received that are part of the same datagram if the complete
+         * datagram is not received.
          */
-        if (TQ_Timerset(EV_IP6_REASSEMBLY, (UNSIGNED)fp, 
+        if (TQ_Timerset(EV_IP6_REASSEMBLY, (UNSIGNED)fp,
                         (IP_FRAG_TTL), 0) != NU_SUCCESS)
-            NLOG_Error_Log("Failed to set timer to timeout reassembly of packet", 
+            NLOG_Error_Log("Failed to set timer to timeout reassembly of packet",
                            NERR_SEVERE, __FILE__, __LINE__);
     }
 
     else
     {
-        /* Store the offset of the IPv6 header from the start of the 
-         * memory buffer. 
+        /* Store the offset of the IPv6 header from the start of the
+         * memory buffer.
          */
-        PUT8(ip6_frag, IP6F_BUF_OFFSET, 
+        PUT8(ip6_frag, IP6F_BUF_OFFSET,
              (UINT8)((CHAR HUGE *)ip_pkt - (CHAR HUGE *)buf_ptr));
 
         /* Store the beginning of the IPv6 header */
         PUT32(ip6_frag, IP6F_HDR_OFFSET, (UINT32)(CHAR HUGE *)ip_pkt);
 
-        /* Save off this value to avoid a GET32 in the loop */
-        ip_pkt_ipf_offset = GET16(ip6_frag, IP6F_FRGOFFSET_OFFSET);
-        ip_pkt_tlen_offset = GET16(ip6_frag, IP6F_PAYLOAD_OFFSET);
+        /* Fragments usually arrive in order, so check whether this one
+         * belongs after the last fragment before searching the list.
+         */
+        if (GET16(fp->ipq_last_frag, IP6F_FRGOFFSET_OFFSET) <= ip_pkt_ipf_offset)
+        {
+            p = fp->ipq_last_frag;
+            q = NU_NULL;
+        }
 
-        /* Find a fragment which begins after this one.*/
-        for (q = fp->ipq_first_frag; q != NU_NULL; 
-             q = (IP6_REASM HUGE *)GET32(q, IP6F_NEXT_OFFSET))
-        {                 
-            if (GET16(q, IP6F_FRGOFFSET_OFFSET) > ip_pkt_ipf_offset)
-                break;
+        else
+        {
+            /* Find a fragment which begins after this one.*/
+            for (q = fp->ipq_first_frag; q != NU_NULL;
+                 q = (IP6_REASM HUGE *)GET32(q, IP6F_NEXT_OFFSET))
+            {
+                if (GET16(q, IP6F_FRGOFFSET_OFFSET) > ip_pkt_ipf_offset)
+                    break;
 
-            /* Keep a pointer to the fragment before q is set to next. */
-            p = q;
+                /* Keep a pointer to the fragment before q is set to next. */
+                p = q;
+            }
         }
 
-        /* If q is equal to NULL then the packet just RX does not belong 
-         * before any of the ones already in the queue. Since it will be 
-         * appended to the end of the queue, we need to check for 
-         * overlapping of the last fragment in the queue. If q is not null 
-         * that means that there is a preceding fragment, it may provide 
-         * some of our data already.  If so, drop the data from the 
-         * incoming fragment.  If it provides all of the data, drop the 
-         * current fragment. 
-         */
-                 
         if (p != NU_NULL)
         {
-            /* If there is a preceding fragment, it may provide some of 
-             * our data already.  If so, drop the data from the incoming 
-             * fragment.  If it provides all of the data, drop the current 
-             * fragment. 
+            /* If there is a preceding fragment, it may provide some of
+             * our data already.  If so, drop the data from the incoming
+             * fragment.  If it provides all of the data, drop the current
+             * fragment.
              */
-            prev = p;
-
-            i = GET16(prev, IP6F_FRGOFFSET_OFFSET) + 
-                GET16(prev, IP6F_PAYLOAD_OFFSET) - ip_pkt_ipf_offset;
+            i = GET16(p, IP6F_FRGOFFSET_OFFSET) +
+                GET16(p, IP6F_PAYLOAD_OFFSET) - ip_pkt_ipf_offset;
 
             if (i > 0)
             {
                 if ((UINT16)i >= ip_pkt_tlen_offset)
                 {
-                    /* All of the received data is contained in the 
-                     * previous fragment. Drop this one. 
+                    /* All of the received data is contained in the
+                     * previous fragment. Drop this one.
                      */
-                    MEM_Buffer_Chain_Free(&MEM_Buffer_List, 
+                    MEM_Buffer_Chain_Free(&MEM_Buffer_List,
                                           &MEM_Buffer_Freelist);
 
                     return (NU_NULL);
                 }
-            
+
                 /* Trim the duplicate data from this fragment. */
                 MEM_Trim(buf_ptr, (INT32)i);
 
-                PUT16(ip6_frag, IP6F_FRGOFFSET_OFFSET, 
+                PUT16(ip6_frag, IP6F_FRGOFFSET_OFFSET,
                       (UINT16)(ip_pkt_ipf_offset + i));
 
-                PUT16(ip6_frag, IP6F_PAYLOAD_OFFSET, 
+                PUT16(ip6_frag, IP6F_PAYLOAD_OFFSET,
                       (UINT16)(ip_pkt_tlen_offset - i));
 
                 /* Save the values off in locals */
                 ip_pkt_ipf_offset = GET16(ip6_frag, IP6F_FRGOFFSET_OFFSET);
                 ip_pkt_tlen_offset = GET16(ip6_frag, IP6F_PAYLOAD_OFFSET);
-            }        
-        
-	        /* While we overlap succeeding fragments trim them or, if they are
-	         * completely covered, dequeue them. 
-	         */
-	        while ( (q != NU_NULL) &&
-	                ((ip_pkt_ipf_offset + ip_pkt_tlen_offset) > 
-	                GET16(q, IP6F_FRGOFFSET_OFFSET)) )
-	        {
-	            i = (ip_pkt_ipf_offset + ip_pkt_tlen_offset) - 
-	                GET16(q, IP6F_FRGOFFSET_OFFSET);
-	
-	            if ((UINT16)i < GET16(q, IP6F_PAYLOAD_OFFSET))
-	            {
-	                /* Trim the duplicate data from the start of the previous
-	                 * fragment. In this case q. 
-	                 */             
-	                r_buf = 
-	                    (NET_BUFFER *)(GET32(q,IP6F_HDR_OFFSET) - 
-	                    GET8(q, IP6F_BUF_OFFSET));
-	
-	                MEM_Trim(r_buf, (INT32)i);
-	
-	                PUT16(q, IP6F_PAYLOAD_OFFSET, 
-	                      (UINT16)(GET16(q, IP6F_PAYLOAD_OFFSET) - i));
-	
-	                PUT16(q, IP6F_FRGOFFSET_OFFSET, 
-	                      (UINT16)(GET16(q, IP6F_FRGOFFSET_OFFSET) + i));
-	
-	                break;
-	            }
-	
-	            /* Move on to the next fragment so we can check to see if any/all of 
-	             * it is overlapping.  Store this in a temp pointer before the 
-	             * buffer is deallocated.
-	             */
-	            temp_q = (IP6_REASM HUGE *)GET32(q, IP6F_NEXT_OFFSET);
-	
-	            /* The buffer was completely covered. Deallocate it*/
-	            r_buf = 
-	                (NET_BUFFER *)(GET32(q,IP6F_HDR_OFFSET) - 
-	                GET8(q, IP6F_BUF_OFFSET));
-	
-	            IP6_Remove_Frag(q, p, fp);
-	
-	            MEM_One_Buffer_Chain_Free(r_buf, &MEM_Buffer_Freelist);
-	            
-	             /* Set q to the next buffer in the chain */
-	            q = temp_q;
-	        }
-		}
-
-        /* Insert the new fragment in its place. The new fragment should 
-         * be inserted into the list of fragments immediately in front 
-         * of q. 
+            }
+        }
+
+        /* While we overlap succeeding fragments trim them or, if they are
+         * completely covered, dequeue them.
          */
-        IP6_Insert_Frag(ip6_frag, fp);
+        while ( (q != NU_NULL) &&
+                ((ip_pkt_ipf_offset + ip_pkt_tlen_offset) >
+                GET16(q, IP6F_FRGOFFSET_OFFSET)) )
+        {
+            i = (ip_pkt_ipf_offset + ip_pkt_tlen_offset) -
+                GET16(q, IP6F_FRGOFFSET_OFFSET);
+
+            if ((UINT16)i < GET16(q, IP6F_PAYLOAD_OFFSET))
+            {
+                /* Trim the duplicate data from the start of the previous
+                 * fragment. In this case q.
+                 */
+                r_buf =
+                    (NET_BUFFER *)(GET32(q,IP6F_HDR_OFFSET) -
+                    GET8(q, IP6F_BUF_OFFSET));
+
+                MEM_Trim(r_buf, (INT32)i);
+
+                PUT16(q, IP6F_PAYLOAD_OFFSET,
+                      (UINT16)(GET16(q, IP6F_PAYLOAD_OFFSET) - i));
+
+                PUT16(q, IP6F_FRGOFFSET_OFFSET,
+                      (UINT16)(GET16(q, IP6F_FRGOFFSET_OFFSET) + i));
+
+                fp->ipq_recvd -= (UINT32)i;
+
+                break;
+            }
+
+            /* Move on to the next fragment so we can check to see if any/all of
+             * it is overlapping.  Store this in a temp pointer before the
+             * buffer is deallocated.
+             */
+            temp_q = (IP6_REASM HUGE *)GET32(q, IP6F_NEXT_OFFSET);
+
+            /* The buffer was completely covered. Deallocate it*/
+            r_buf =
+                (NET_BUFFER *)(GET32(q,IP6F_HDR_OFFSET) -
+                GET8(q, IP6F_BUF_OFFSET));
+
+            IP6_Remove_Frag(q, p, fp);
+
+            fp->ipq_recvd -= GET16(q, IP6F_PAYLOAD_OFFSET);
+
+            /* Return the buffers of the fragment to the reassembly
+             * budget.
+             */
+            for (m = r_buf; m != NU_NULL; m = m->next_buffer)
+            {
+                fp->ipq_buffers--;
+                IP_Reasm_Buffers_Used--;
+            }
+
+            MEM_One_Buffer_Chain_Free(r_buf, &MEM_Buffer_Freelist);
+
+             /* Set q to the next buffer in the chain */
+            q = temp_q;
+        }
+
+        /* Insert the new fragment in its place, immediately in front
+         * of q.
+         */
+        PUT32(ip6_frag, IP6F_NEXT_OFFSET, (UINT32)q);
+
+        if (p != NU_NULL)
+            PUT32(p, IP6F_NEXT_OFFSET, (UINT32)ip6_frag);
+        else
+            fp->ipq_first_frag = ip6_frag;
+
+        if (q == NU_NULL)
+            fp->ipq_last_frag = ip6_frag;
     }
 
     /* Remove this buffer from the buffer list. */
@@ -565,32 +669,28 @@ NET_BUFFER *IP6_Reassembly(IP6_REASM HUGE *ip6_frag, IP6LAYER *ip_pkt,
 
     buf_ptr->next = NU_NULL;
 
-    /* Check for complete reassembly. */
-    next = 0;
-
-    for (q = fp->ipq_first_frag; q != NU_NULL;
-         q = (IP6_REASM HUGE *)GET32(q, IP6F_NEXT_OFFSET))
-    {
-        /* Does the fragment contain the next offset. */
-        if (GET16(q, IP6F_FRGOFFSET_OFFSET) != (UINT16) next)
-            return (NU_NULL);
+    /* Account for the data and buffers of this fragment. */
+    fp->ipq_recvd += ip_pkt_tlen_offset;
+    fp->ipq_buffers = (UINT16)(fp->ipq_buffers + buffers);
+    IP_Reasm_Buffers_Used = (UINT16)(IP_Reasm_Buffers_Used + buffers);
 
-        /* Update next to the offset of the next fragment. */
-        next += GET16(q, IP6F_PAYLOAD_OFFSET);
+    /* The last fragment gives the length of the packet. */
+    if (!(GET8(ip6_frag, IP6F_MFF_OFFSET) & 1))
+        fp->ipq_total_len = frag_end;
 
-        /* Keep track of the last fragment checked. It is used below. */
-        p = q;
-    }
-
-    /* If the more fragments flag is set in the last fragment, then we
-       are expecting more. */
-    if ( (!p) || (GET8(p, IP6F_MFF_OFFSET) & 1) )
+    /* Since overlapping data is trimmed as fragments arrive, the packet
+     * is complete once the fragments hold as many bytes as the packet
+     * is long.
+     */
+    if ( (fp->ipq_total_len == 0) || (fp->ipq_recvd != fp->ipq_total_len) )
         return (NU_NULL);
 
+    next = (INT)fp->ipq_total_len;
+
     /* Clear the fragment timeout event for this datagram. */
     TQ_Timerunset(EV_IP6_REASSEMBLY, TQ_CLEAR_EXACT, (UNSIGNED)fp, 0);
 
-    PUT32(p, IP6F_NEXT_OFFSET, NU_NULL);
+    PUT32(fp->ipq_last_frag, IP6F_NEXT_OFFSET, NU_NULL);
 
     /* Reassembly is complete. Concatenate the fragments. */
 
@@ -660,7 +760,7 @@ NET_BUFFER *IP6_Reassembly(IP6_REASM HUGE *ip6_frag, IP6LAYER *ip_pkt,
              *next_header);
 
     /* Remove this fragment reassembly header from the list. */
-    DLL_Remove(&IP6_Frag_Queue, fp);
+    IP6_Reasm_Unlink(fp);
 
     /* Deallocate this fragment reassembly header. */
     if (NU_Deallocate_Memory(fp) != NU_SUCCESS)
@@ -835,8 +935,8 @@ VOID IP6_Free_Queue_Element(IP6_QUEUE_ELEMENT *fp)
     IP6_REASM  HUGE *q, *temp_q;
     NET_BUFFER      *buf_ptr;
 
-    /* Remove this fragment reassembly header from the list. */
-    DLL_Remove(&IP6_Frag_Queue, fp);
+    /* Remove this fragment reassembly header from the lists. */
+    IP6_Reasm_Unlink(fp);
 
     /* Stop the timer that is running to timeout reassembly of 
      * this packet.
@@ -870,3 +970,46 @@ VOID IP6_Free_Queue_Element(IP6_QUEUE_ELEMENT *fp)
                        NERR_SEVERE, __FILE__, __LINE__);
 
 } /* IP6_Free_Queue_Element */
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       IP6_Reasm_Unlink
+*
+*   DESCRIPTION
+*
+*       Remove a fragment reassembly header from the list of reassembly
+*       queues and from its hash bucket, and return the buffers held by
+*       its fragments to the reassembly budget.
+*
+*   INPUTS
+*
+*       *fp                     Pointer to the element to remove
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID IP6_Reasm_Unlink(IP6_QUEUE_ELEMENT *fp)
+{
+    IP6_QUEUE_ELEMENT   **link_ptr;
+
+    DLL_Remove(&IP6_Frag_Queue, fp);
+
+    /* Find the link to this element in its hash bucket. */
+    for (link_ptr = &IP6_Frag_Hash[IP6_REASM_HASH(fp->ipq_source,
+                                                  fp->ipq_dest, fp->ipq_id)];
+         *link_ptr != NU_NULL; link_ptr = &(*link_ptr)->ipq_hash_next)
+    {
+        if (*link_ptr == fp)
+        {
+            *link_ptr = fp->ipq_hash_next;
+            break;
+        }
+    }
+
+    IP_Reasm_Buffers_Used = (UINT16)(IP_Reasm_Buffers_Used - fp->ipq_buffers);
+
+} /* IP6_Reasm_Unlink */
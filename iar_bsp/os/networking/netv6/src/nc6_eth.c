@@ -37,6 +37,8 @@
 *       NC6ETH_Retrieve_NeighCache_Entry
 *       NC6ETH_Link_Addrs_Equal
 *       NC6ETH_Update_NeighCache_Link_Addr
+*       NC6ETH_Hash_Entry
+*       NC6ETH_Unhash_Entry
 *                                                                       
 *   DEPENDENCIES                                                          
 *                                                                       
@@ -54,6 +56,9 @@
 #include "networking/nc6.h"
 #include "networking/defrtr6.h"
 
+STATIC VOID NC6ETH_Hash_Entry(DV_DEVICE_ENTRY *, IP6_NEIGHBOR_CACHE_ENTRY *);
+STATIC VOID NC6ETH_Unhash_Entry(IP6_NEIGHBOR_CACHE_ENTRY *);
+
 /*************************************************************************
 *
 *   FUNCTION                                                              
@@ -132,6 +137,12 @@ IP6_NEIGHBOR_CACHE_ENTRY *NC6ETH_Add_NeighCache_Entry(DV_DEVICE_ENTRY *device,
             if (timer != 0)
                 NC6ETH_CleanUp_Entry(nc_entry);
 
+            /* Otherwise, make sure it is not left in the hash bucket of
+             * its previous address.
+             */
+            else
+                NC6ETH_Unhash_Entry(nc_entry);
+
             /* Copy the IP address into the entry */
             NU_BLOCK_COPY(nc_entry->ip6_neigh_cache_ip_addr, source_addr, IP6_ADDR_LEN);
 
@@ -171,6 +182,9 @@ IP6_NEIGHBOR_CACHE_ENTRY *NC6ETH_Add_NeighCache_Entry(DV_DEVICE_ENTRY *device,
             }
 
             nc_entry->ip6_neigh_cache_device = device;
+
+            /* Make the entry reachable through the hash of its address */
+            NC6ETH_Hash_Entry(device, nc_entry);
         }
         else
             NLOG_Error_Log("IPv6 Neighbor Cache full", NERR_SEVERE, 
@@ -341,6 +355,9 @@ VOID NC6ETH_CleanUp_Entry(IP6_NEIGHBOR_CACHE_ENTRY *nc_entry)
         }
     }
 
+    /* Remove the entry from its hash bucket before it is zeroed out. */
+    NC6ETH_Unhash_Entry(nc_entry);
+
     /* Zero out the link-layer address in the NC entry. */
     memset(((IP6_ETH_NEIGHBOR_CACHE_ENTRY*)
            (nc_entry->ip6_neigh_cache_link_spec))->ip6_neigh_cache_hw_addr, 
@@ -419,7 +436,8 @@ IP6_NEIGHBOR_CACHE_ENTRY *NC6ETH_Find_NeighCache_Entry(const DV_DEVICE_ENTRY *de
 *   DESCRIPTION                                                           
 *              
 *       This function returns the Neighbor Cache entry associated with
-*       the device and source address provided.                                                           
+*       the device and source address provided.  Only the entries in the
+*       hash bucket of the address are searched.
 *                                                                         
 *   INPUTS                                                                
 *                                              
@@ -436,28 +454,34 @@ IP6_NEIGHBOR_CACHE_ENTRY *NC6ETH_Find_NeighCache_Entry(const DV_DEVICE_ENTRY *de
 IP6_NEIGHBOR_CACHE_ENTRY *NC6ETH_Retrieve_NeighCache_Entry(const DV_DEVICE_ENTRY *device,
                                                            const UINT8 *source_addr)
 {
-    INT16                       i;
+    UINT16                      i;
     IP6_NEIGHBOR_CACHE_ENTRY    *nc_entry = NU_NULL;
+    IP6_NEIGHBOR_CACHE_ENTRY    *current_entry;
     UNSIGNED                    current_time;
 
+    if (device->dev6_neighbor_cache == NU_NULL)
+        return (NU_NULL);
+
     current_time = NU_Retrieve_Clock();
 
-    /* Search the Neighbor Cache for a matching entry. */
-    for (i = 0; i < device->dev6_nc_entries; i++)
+    /* Search the hash bucket of the address for a matching entry. */
+    for (i = device->dev6_nc_hash[NC6_HASH_INDEX(source_addr)]; i != 0;
+         i = current_entry->ip6_neigh_cache_hash_next)
     {
-        if (memcmp(source_addr, 
-                   device->dev6_neighbor_cache[i].ip6_neigh_cache_ip_addr, 
+        current_entry = &device->dev6_neighbor_cache[i - 1];
+
+        if (memcmp(source_addr, current_entry->ip6_neigh_cache_ip_addr,
                    IP6_ADDR_LEN) == 0)
         {
             /* If the entry has not timed out or is permanent and the entry
              * is up.
              */
-            if (((INT32_CMP((device->dev6_neighbor_cache[i].ip6_neigh_cache_timestamp + NC_TIMEOUT_ENTRY), 
+            if (((INT32_CMP((current_entry->ip6_neigh_cache_timestamp + NC_TIMEOUT_ENTRY), 
                              current_time) > 0)
-                || (device->dev6_neighbor_cache[i].ip6_neigh_cache_flags & NC_PERMANENT))
-                && (device->dev6_neighbor_cache[i].ip6_neigh_cache_flags & NC_UP) )
+                || (current_entry->ip6_neigh_cache_flags & NC_PERMANENT))
+                && (current_entry->ip6_neigh_cache_flags & NC_UP) )
             {
-                nc_entry = &device->dev6_neighbor_cache[i];
+                nc_entry = current_entry;
 
                 /* Update the timestamp of the entry */
                 nc_entry->ip6_neigh_cache_timestamp = current_time;
@@ -534,3 +558,90 @@ VOID NC6ETH_Update_NeighCache_Link_Addr(const IP6_NEIGHBOR_CACHE_ENTRY *nc_entry
            nc_entry->ip6_neigh_cache_device->dev_addrlen);
 
 } /* NC6ETH_Update_NeighCache_Link_Addr */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NC6ETH_Hash_Entry
+*
+*   DESCRIPTION
+*
+*       This function inserts a Neighbor Cache entry at the head of the
+*       hash bucket of its IP address.
+*
+*   INPUTS
+*
+*       *device                 A pointer to the device that owns the
+*                               Neighbor Cache.
+*       *nc_entry               A pointer to the Neighbor Cache entry.
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+STATIC VOID NC6ETH_Hash_Entry(DV_DEVICE_ENTRY *device,
+                              IP6_NEIGHBOR_CACHE_ENTRY *nc_entry)
+{
+    UINT16  *bucket;
+
+    bucket = &device->dev6_nc_hash[NC6_HASH_INDEX(nc_entry->ip6_neigh_cache_ip_addr)];
+
+    nc_entry->ip6_neigh_cache_hash_next = *bucket;
+
+    *bucket = (UINT16)((nc_entry - device->dev6_neighbor_cache) + 1);
+
+    nc_entry->ip6_neigh_cache_flags |= NC_HASHED;
+
+} /* NC6ETH_Hash_Entry */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NC6ETH_Unhash_Entry
+*
+*   DESCRIPTION
+*
+*       This function removes a Neighbor Cache entry from the hash bucket
+*       of its IP address, if the entry is in a bucket.
+*
+*   INPUTS
+*
+*       *nc_entry               A pointer to the Neighbor Cache entry.
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+STATIC VOID NC6ETH_Unhash_Entry(IP6_NEIGHBOR_CACHE_ENTRY *nc_entry)
+{
+    DV_DEVICE_ENTRY *device;
+    UINT16          *link_ptr;
+    UINT16          index;
+
+    if (!(nc_entry->ip6_neigh_cache_flags & NC_HASHED))
+        return;
+
+    device = nc_entry->ip6_neigh_cache_device;
+
+    index = (UINT16)((nc_entry - device->dev6_neighbor_cache) + 1);
+
+    /* Find the link to this entry in its hash bucket. */
+    for (link_ptr = &device->dev6_nc_hash[NC6_HASH_INDEX(nc_entry->ip6_neigh_cache_ip_addr)];
+         *link_ptr != 0;
+         link_ptr = &device->dev6_neighbor_cache[*link_ptr - 1].ip6_neigh_cache_hash_next)
+    {
+        if (*link_ptr == index)
+        {
+            *link_ptr = nc_entry->ip6_neigh_cache_hash_next;
+            break;
+        }
+    }
+
+    nc_entry->ip6_neigh_cache_hash_next = 0;
+    nc_entry->ip6_neigh_cache_flags &= ~NC_HASHED;
+
+} /* NC6ETH_Unhash_Entry */
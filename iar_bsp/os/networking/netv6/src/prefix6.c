@@ -499,6 +499,11 @@ VOID PREFIX6_Delete_Entry(IP6_PREFIX_ENTRY *prefix_entry)
         DLL_Remove(prefix_entry->ip6_prefx_lst_device->dev6_prefix_list, 
                    prefix_entry);
 
+        /* A destination covered by the prefix is no longer on-link, so
+         * cached route lookups must be repeated.
+         */
+        RTAB_Invalidate_Route_Cache();
+
         /* Deallocate the memory being used by the deleted entry */
         if (NU_Deallocate_Memory((VOID*)prefix_entry) != NU_SUCCESS)
             NLOG_Error_Log("Failed to deallocate memory for the Prefix entry", 
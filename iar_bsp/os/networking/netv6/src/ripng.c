@@ -232,7 +232,7 @@ STATUS NU_Ripng_Initialize(RIPNG_STRUCT *ripng, INT num)
     for (i = 0; i < num; i++)
     {
         /* Grab the semaphore so we can get a pointer to the device */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (status != NU_SUCCESS)
         {
@@ -258,7 +258,7 @@ STATUS NU_Ripng_Initialize(RIPNG_STRUCT *ripng, INT num)
             ripng[i].ripng_status = NU_INVALID_PARM;
 
             /* Release the TCP semaphore */
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE, 
                                __FILE__, __LINE__);
 
@@ -288,7 +288,7 @@ STATUS NU_Ripng_Initialize(RIPNG_STRUCT *ripng, INT num)
             node[i].ripng_device.ripng_dev_metric = (UINT8)dev_ptr->dev_metric;
 
         /* Release the TCP semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE, 
                            __FILE__, __LINE__);
 
@@ -66,6 +66,9 @@ STATUS RTAB6_Delete_Node(ROUTE_NODE *rt_node)
 {
     STATUS  status;
 
+    /* Do not return this route from the route cache */
+    RTAB_Invalidate_Route_Cache();
+
     /* If the node to delete is the Default Route */
     if (rt_node == RTAB6_Default_Route)
     {
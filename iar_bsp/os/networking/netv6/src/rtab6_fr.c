@@ -22,12 +22,15 @@
 *                                                                       
 *   DATA STRUCTURES                                                       
 *                                                                       
-*       None
+*       RTAB6_Route_Cache
 *                                                                       
 *   FUNCTIONS                                                             
 *                                                                       
 *       RTAB6_Find_Route
+*       RTAB6_Find_Route_Entry
 *       RTAB6_Determine_Matching_Prefix
+*       RTAB6_Find_Cached_Route
+*       RTAB6_Cache_Route
 *                                                                       
 *   DEPENDENCIES                                                          
 *                                                                       
@@ -41,6 +44,19 @@ extern ROUTE_NODE   *RTAB6_Default_Route;
 
 extern RTAB_ROUTE_PARMS RTAB6_Parms;
 
+#if (RTAB6_ROUTE_CACHE_SIZE > 0)
+
+/* Small direct-mapped cache of the most recent lookup results.  Each
+ * entry is only valid while its generation matches RTAB_Route_Generation,
+ * which is bumped on every change to the routing table.
+ */
+static RTAB6_ROUTE_CACHE_ENTRY  RTAB6_Route_Cache[RTAB6_ROUTE_CACHE_SIZE];
+
+STATIC RTAB6_ROUTE_ENTRY *RTAB6_Find_Cached_Route(const UINT8 *, INT32);
+STATIC VOID RTAB6_Cache_Route(const UINT8 *, INT32, RTAB6_ROUTE_ENTRY *);
+
+#endif
+
 /*************************************************************************
 *                                                                       
 *   FUNCTION                                                              
@@ -69,9 +85,7 @@ RTAB6_ROUTE_ENTRY *RTAB6_Find_Route(const UINT8 *ip_addr, INT32 flags)
 {
     RTAB6_ROUTE_ENTRY   *rt_entry;
 
-    rt_entry = (RTAB6_ROUTE_ENTRY*)RTAB_Find_Route_Entry(ip_addr, 
-                                                         &RTAB6_Parms,
-                                                         flags);
+    rt_entry = RTAB6_Find_Route_Entry(ip_addr, flags);
 
     /* If a route could not be found and there is a default route, return
      * the default route.
@@ -90,6 +104,62 @@ RTAB6_ROUTE_ENTRY *RTAB6_Find_Route(const UINT8 *ip_addr, INT32 flags)
 
 } /* RTAB6_Find_Route */
 
+/*************************************************************************
+*                                                                       
+*   FUNCTION                                                              
+*                                                                       
+*       RTAB6_Find_Route_Entry
+*                                                                       
+*   DESCRIPTION                                                           
+*                                                                       
+*       This function finds the route in the routing table associated
+*       with the target.  The Default Route is not considered.  The
+*       result of the previous lookup for the same target and flags is
+*       returned if the routing table has not changed since.
+*                                                                       
+*   INPUTS                                                                
+*                                                                       
+*       *ip_addr                A pointer to the IP address to which to
+*                               find a route.
+*       flags                   Flags associated with the type of route
+*                               to return.
+*                                                                       
+*   OUTPUTS                                                               
+*                                                                       
+*       *RTAB6_ROUTE_ENTRY      A pointer to the route
+*       NU_NULL                 No route exists
+*                                                                       
+*************************************************************************/
+RTAB6_ROUTE_ENTRY *RTAB6_Find_Route_Entry(const UINT8 *ip_addr, INT32 flags)
+{
+    RTAB6_ROUTE_ENTRY   *rt_entry;
+
+#if (RTAB6_ROUTE_CACHE_SIZE > 0)
+    /* Check if the same lookup has been done since the last change to
+     * the routing table.
+     */
+    rt_entry = RTAB6_Find_Cached_Route(ip_addr, flags);
+
+    if (rt_entry)
+    {
+        rt_entry->rt_entry_parms.rt_parm_refcnt ++;
+        return (rt_entry);
+    }
+#endif
+
+    rt_entry = (RTAB6_ROUTE_ENTRY*)RTAB_Find_Route_Entry(ip_addr, 
+                                                         &RTAB6_Parms,
+                                                         flags);
+
+#if (RTAB6_ROUTE_CACHE_SIZE > 0)
+    if (rt_entry)
+        RTAB6_Cache_Route(ip_addr, flags, rt_entry);
+#endif
+
+    return (rt_entry);
+
+} /* RTAB6_Find_Route_Entry */
+
 /*************************************************************************
 *                                                                       
 *   FUNCTION                                                              
@@ -119,45 +189,125 @@ UINT8 RTAB6_Determine_Matching_Prefix(const UINT8 *target_address,
                                       const UINT8 *network_address,
                                       const UINT8 *subnet_mask, UINT8 prefix_len)
 {
-    UINT8   current_length = 0;
-    UINT8   byte = 0;
-    UINT8   bit_index = 7;
+    UINT8   byte;
 
     UNUSED_PARAMETER(subnet_mask);
 
-    /* Do a bit by bit comparison of the two IP addresses until all
-     * prefix_len bits have been checked or a non-matching bit is
-     * found.
-     */
-    while (current_length < prefix_len)
+    if (prefix_len > 128)
+        prefix_len = 128;
+
+    /* Compare the whole bytes covered by the prefix. */
+    for (byte = 0; byte < (prefix_len >> 3); byte++)
     {
-        /* If the two bits do not match, break out of the loop */
-        if ( ((1 << bit_index) & (target_address[byte])) !=
-             ((1 << bit_index) & (network_address[byte])) )
-            break;
-
-        current_length ++;
-
-        /* If all of the bits in this byte have been checked, get the
-         * next byte and start over at bit 7.
-         */
-        if (bit_index == 0)
-        {
-            bit_index = 7;
-            byte++;
-        }
-
-        /* Look at the next bit in the byte */
-        else
-            bit_index --;
+        if (target_address[byte] != network_address[byte])
+            return (NU_FALSE);
     }
 
-    /* If the bits match */
-    if (current_length >= prefix_len)
-        return (NU_TRUE);
-
-    /* The bits do not match */
-    else 
+    /* Compare the remaining high-order bits of the last byte. */
+    if ( (prefix_len & 7) &&
+         ((target_address[byte] ^ network_address[byte]) &
+          (UINT8)(0xff << (8 - (prefix_len & 7)))) )
         return (NU_FALSE);
 
+    /* The bits match */
+    return (NU_TRUE);
+
 } /* RTAB6_Determine_Matching_Prefix */
+
+#if (RTAB6_ROUTE_CACHE_SIZE > 0)
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       RTAB6_Find_Cached_Route
+*
+*   DESCRIPTION
+*
+*       This function returns the route found by a previous lookup for
+*       the same destination and flags, provided the routing table has
+*       not changed since and the route is still usable.  The reference
+*       count of the route is not incremented.
+*
+*   INPUTS
+*
+*       *dest                   A pointer to the destination IP address.
+*       flags                   Flags passed to RTAB6_Find_Route_Entry.
+*
+*   OUTPUTS
+*
+*       *RTAB6_ROUTE_ENTRY      A pointer to the cached route
+*       NU_NULL                 No valid cached route exists
+*
+*************************************************************************/
+STATIC RTAB6_ROUTE_ENTRY *RTAB6_Find_Cached_Route(const UINT8 *dest,
+                                                  INT32 flags)
+{
+    RTAB6_ROUTE_CACHE_ENTRY *rc_entry;
+    RTAB6_ROUTE_ENTRY       *rt_entry;
+
+    rc_entry = &RTAB6_Route_Cache[RTAB6_ROUTE_CACHE_INDEX(dest)];
+
+    if ( (rc_entry->rc_route == NU_NULL) ||
+         (rc_entry->rc_generation != RTAB_Route_Generation) ||
+         (rc_entry->rc_flags != flags) ||
+         (memcmp(rc_entry->rc_dest, dest, IP6_ADDR_LEN) != 0) )
+        return (NU_NULL);
+
+    rt_entry = rc_entry->rc_route;
+
+    /* The state of the route or device may have changed without the
+     * table itself changing.  Apply the same checks as the full lookup.
+     */
+    if ( ((rt_entry->rt_entry_parms.rt_parm_metric != RT_INFINITY) ||
+          (flags & RT_OVERRIDE_METRIC)) &&
+         ((rt_entry->rt_entry_parms.rt_parm_flags & RT_UP) ||
+          (flags & RT_OVERRIDE_RT_STATE)) &&
+         ((rt_entry->rt_entry_parms.rt_parm_device->dev_flags & DV_UP) ||
+          (flags & RT_OVERRIDE_DV_STATE)) )
+        return (rt_entry);
+
+    /* Invalidate the entry so the next lookup repopulates it */
+    rc_entry->rc_route = NU_NULL;
+
+    return (NU_NULL);
+
+} /* RTAB6_Find_Cached_Route */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       RTAB6_Cache_Route
+*
+*   DESCRIPTION
+*
+*       This function saves the result of a route lookup in the route
+*       cache, replacing any entry previously stored in the same slot.
+*
+*   INPUTS
+*
+*       *dest                   A pointer to the destination IP address.
+*       flags                   Flags passed to RTAB6_Find_Route_Entry.
+*       *rt_entry               The route found for the destination.
+*
+*   OUTPUTS
+*
+*       None.
+*
+*************************************************************************/
+STATIC VOID RTAB6_Cache_Route(const UINT8 *dest, INT32 flags,
+                              RTAB6_ROUTE_ENTRY *rt_entry)
+{
+    RTAB6_ROUTE_CACHE_ENTRY *rc_entry;
+
+    rc_entry = &RTAB6_Route_Cache[RTAB6_ROUTE_CACHE_INDEX(dest)];
+
+    NU_BLOCK_COPY(rc_entry->rc_dest, dest, IP6_ADDR_LEN);
+    rc_entry->rc_flags = flags;
+    rc_entry->rc_generation = RTAB_Route_Generation;
+    rc_entry->rc_route = rt_entry;
+
+} /* RTAB6_Cache_Route */
+
+#endif
@@ -43,7 +43,6 @@
 #include "networking/nc6.h"
 
 extern ROUTE_NODE   *RTAB6_Default_Route;
-extern RTAB_ROUTE_PARMS RTAB6_Parms;
 
 /*************************************************************************
 *
@@ -85,8 +84,7 @@ RTAB6_ROUTE_ENTRY *RTAB6_Next_Hop_Determination(UINT8 *ip_addr)
     /* If a corresponding entry already exists in the route table,
      * return the entry.  Otherwise, create a new entry.
      */
-    rt_entry = (RTAB6_ROUTE_ENTRY*)
-               RTAB_Find_Route_Entry(ip_addr, &RTAB6_Parms, 0);
+    rt_entry = RTAB6_Find_Route_Entry(ip_addr, 0);
 
     if ( ((rt_entry == NU_NULL) ||
            ((rt_entry->rt_next_hop_entry == NU_NULL) &&
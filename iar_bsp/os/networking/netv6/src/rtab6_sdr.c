@@ -69,6 +69,9 @@ STATUS RTAB6_Set_Default_Route(DV_DEVICE_ENTRY *device, UINT8 *next_hop,
     IP6_NEIGHBOR_CACHE_ENTRY    *next_hop_entry;
     RTAB6_ROUTE_ENTRY           *rt_entry;
 
+    /* The default route is changing; discard cached lookup results */
+    RTAB_Invalidate_Route_Cache();
+
     /* If there is not currently a default route, allocate memory for
      * the default route.
      */
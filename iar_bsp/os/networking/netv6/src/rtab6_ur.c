@@ -337,6 +337,9 @@ STATUS RTAB6_Update_Route(const UINT8 *ip_address, const UINT8 *gateway,
         }
     }
 
+    /* The metric, gateway or state of the route may have changed */
+    RTAB_Invalidate_Route_Cache();
+
     return (status);
 
 } /* RTAB6_Update_Route */
@@ -104,7 +104,7 @@ STATUS NU_Add_Prefix_Entry(UINT32 dev_index, DEV6_PRFX_ENTRY *prefix_entry)
     NU_SUPERVISOR_MODE();
 
      /* Get the Nucleus NET semaphore. */
-    status =  NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status =  NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -124,7 +124,7 @@ STATUS NU_Add_Prefix_Entry(UINT32 dev_index, DEV6_PRFX_ENTRY *prefix_entry)
         status = NU_INVALID_PARM;
 
     /* Release the TCP semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE, 
                        __FILE__, __LINE__);
 
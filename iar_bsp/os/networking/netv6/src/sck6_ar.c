@@ -87,7 +87,7 @@ STATUS NU_Add_Route6(UINT8 *ip_addr, UINT8 *gateway, UINT8 prefixlen)
         ro.rt_ip_dest.rtab6_rt_ip_dest.sck_family = SK_FAM_IP6;
 
         /* Obtain the semaphore */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (status != NU_SUCCESS)
         {
@@ -164,7 +164,7 @@ STATUS NU_Add_Route6(UINT8 *ip_addr, UINT8 *gateway, UINT8 prefixlen)
             status = NU_INVALID_PARM;
 
         /* Release the semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE, 
                            __FILE__, __LINE__);
 
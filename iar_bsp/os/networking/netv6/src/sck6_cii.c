@@ -76,7 +76,7 @@ STATUS NU_Configure_IPv6_Interface(UINT32 dev_index, INT opt_name,
     NU_SUPERVISOR_MODE();
 
     /* Obtain the semaphore */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -130,7 +130,7 @@ STATUS NU_Configure_IPv6_Interface(UINT32 dev_index, INT opt_name,
     }
 
     /* Release the semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE, 
                        __FILE__, __LINE__);
 
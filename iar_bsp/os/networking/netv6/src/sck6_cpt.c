@@ -100,7 +100,7 @@ STATUS NU_Configure_Policy_Table(IP6_POLICY_ENTRY *plcy_ptr, UINT32 action)
         NU_SUPERVISOR_MODE();
 
         /* Obtain the semaphore. */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
         
         /* If the semaphore was successfully obtained. */
         if (status == NU_SUCCESS)
@@ -164,7 +164,7 @@ STATUS NU_Configure_Policy_Table(IP6_POLICY_ENTRY *plcy_ptr, UINT32 action)
                 }
             }
 
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE, 
                                __FILE__, __LINE__);
         }
@@ -76,7 +76,7 @@ STATUS NU_Delete_Prefix_Entry(UINT32 device_index, const UINT8 *prefix)
     NU_SUPERVISOR_MODE();
 
      /* Get the Nucleus NET semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status != NU_SUCCESS)
     {
@@ -100,7 +100,7 @@ STATUS NU_Delete_Prefix_Entry(UINT32 device_index, const UINT8 *prefix)
         status = NU_INVALID_PARM;
 
     /* Release the TCP semaphore */
-    if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+    if (NET_Release_Stack_Lock() != NU_SUCCESS)
         NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE, 
                        __FILE__, __LINE__);
 
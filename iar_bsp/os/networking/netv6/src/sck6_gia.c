@@ -71,7 +71,7 @@ STATUS NU_Ioctl_SIOCGIFADDR_IN6(SCK_IOCTL_OPTION *option, INT optlen)
         /* Switch to supervisor mode. */
         NU_SUPERVISOR_MODE();
 
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
         
         if (status == NU_SUCCESS)
         {
@@ -79,7 +79,7 @@ STATUS NU_Ioctl_SIOCGIFADDR_IN6(SCK_IOCTL_OPTION *option, INT optlen)
                                                 option->s_ret.s_ipaddr,
                                                 &(option->s_optval_octet));
 
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE, 
                                __FILE__, __LINE__);
         }
@@ -77,7 +77,7 @@ STATUS NU_Get_Link_Local_Addr(const UINT32 dev_index, UINT8 *addr_ptr)
     NU_SUPERVISOR_MODE();
 
     /* Obtain the semaphore */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     if (status == NU_SUCCESS)
     {
@@ -120,7 +120,7 @@ STATUS NU_Get_Link_Local_Addr(const UINT32 dev_index, UINT8 *addr_ptr)
         }
 
         /* Release the semaphore */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
         {
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE, 
                            __FILE__, __LINE__);
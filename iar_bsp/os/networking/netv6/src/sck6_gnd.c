@@ -72,7 +72,7 @@ STATUS NU_Ioctl_SIOCLIFGETND(SCK_IOCTL_OPTION *option)
         /* Switch to supervisor mode. */
         NU_SUPERVISOR_MODE();
 
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
         
         if (status == NU_SUCCESS)
         {
@@ -81,7 +81,7 @@ STATUS NU_Ioctl_SIOCLIFGETND(SCK_IOCTL_OPTION *option)
                                              option->s_ret.s_ipaddr,
                                              option->s_ret.mac_address);
 
-            if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+            if (NET_Release_Stack_Lock() != NU_SUCCESS)
                 NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE, 
                                __FILE__, __LINE__);
         }
@@ -67,7 +67,7 @@ STATUS NU_Set_Default_Hop_Limit(UINT8 new_hop_limit)
     NU_SUPERVISOR_MODE();
 
     /* Grab the semaphore. */
-    status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+    status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
     /* If we successfully grab the semaphore. */
     if (status == NU_SUCCESS)
@@ -76,7 +76,7 @@ STATUS NU_Set_Default_Hop_Limit(UINT8 new_hop_limit)
         IP6_Hop_Limit = new_hop_limit;
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore", NERR_SEVERE,
                            __FILE__, __LINE__);
     }
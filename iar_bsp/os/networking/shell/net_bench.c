@@ -0,0 +1,888 @@
+/*************************************************************************
+*
+*               Copyright 2013 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+/*************************************************************************
+*
+*   FILE NAME
+*
+*       net_bench.c
+*
+*   COMPONENT
+*
+*       Networking
+*
+*   DESCRIPTION
+*
+*       This file contains the 'netbench' command, which measures the
+*       performance of the stack over the loopback device so changes to
+*       the stack can be compared on the same target:
+*
+*           netbench udp [count] [size]     UDP datagrams per second
+*           netbench tcp [kbytes]           TCP bulk throughput
+*           netbench conn [count]           TCP connection setup rate
+*           netbench lookup <ip> [count]    Route and ARP lookup cost
+*
+*       The command is only included when the netbench option of the
+*       net shell component is enabled.
+*
+*   FUNCTIONS
+*
+*       command_netbench
+*       NetBench_Loopback_Addr
+*       NetBench_Close
+*       NetBench_Report
+*       NetBench_UDP
+*       NetBench_TCP_Connect
+*       NetBench_Listen
+*       NetBench_TCP_Receiver
+*       NetBench_TCP
+*       NetBench_Conn
+*       NetBench_Lookup
+*
+*   DEPENDENCIES
+*
+*       nucleus.h
+*       nu_kernel.h
+*       nu_services.h
+*       nu_networking.h
+*       <string.h>
+*       <stdio.h>
+*       <stdlib.h>
+*
+*************************************************************************/
+#include "nucleus.h"
+#include "kernel/nu_kernel.h"
+#include "services/nu_services.h"
+#include "networking/nu_networking.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if (CFG_NU_OS_NET_SHELL_NETBENCH == 1)
+
+/* The port the benchmarks receive on. */
+#define NETBENCH_PORT           5001
+
+/* The largest datagram or segment the benchmarks send. */
+#define NETBENCH_BUF_SIZE       1024
+
+/* The number of datagrams sent before they are received, so the UDP
+   benchmark does not overrun the receive queue of the socket. */
+#define NETBENCH_UDP_BATCH      8
+
+/* Default repetitions of each benchmark. */
+#define NETBENCH_UDP_COUNT      10000
+#define NETBENCH_TCP_KBYTES     4096
+#define NETBENCH_CONN_COUNT     200
+#define NETBENCH_LOOKUP_COUNT   10000
+
+/* The lookups are timed with the processor cycle counter where the
+   architecture provides one. */
+#ifdef ESAL_AR_CYCLE_COUNT_READ
+#define NETBENCH_CYCLES()       ESAL_AR_CYCLE_COUNT_READ()
+#else
+#define NETBENCH_CYCLES()       ((UINT32)NU_Get_Time_Stamp())
+#endif
+
+/* The stack size of the task that receives the data of the TCP
+   benchmark. */
+#define NETBENCH_RX_STACK_SIZE  2048
+
+/* The time the TCP benchmark waits for its receiver to finish after the
+   sender has failed. */
+#define NETBENCH_RX_TIMEOUT     (5 * NU_PLUS_TICKS_PER_SEC)
+
+/* The benchmarks run on the stack of the shell task, so the data buffers
+   are kept off it. */
+static CHAR NetBench_Tx_Buffer[NETBENCH_BUF_SIZE];
+static CHAR NetBench_Rx_Buffer[NETBENCH_BUF_SIZE];
+
+/* The receiver of the TCP benchmark, which drains the connection while
+   the shell task keeps sending. */
+static NU_TASK      NetBench_Rx_Task;
+static NU_SEMAPHORE NetBench_Rx_Done;
+static UINT8        NetBench_Rx_Stack[NETBENCH_RX_STACK_SIZE];
+static UINT32       NetBench_Rx_Bytes;
+static STATUS       NetBench_Rx_Status;
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Loopback_Addr
+*
+*   DESCRIPTION
+*
+*       Function to fill in the loopback address of a benchmark socket
+*
+*   INPUTS
+*
+*       addr - address structure to fill in
+*       port - port number
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+static VOID NetBench_Loopback_Addr(struct addr_struct *addr, UINT16 port)
+{
+    addr->family = NU_FAMILY_IP;
+    addr->port = port;
+    addr->id.is_ip_addrs[0] = 127;
+    addr->id.is_ip_addrs[1] = 0;
+    addr->id.is_ip_addrs[2] = 0;
+    addr->id.is_ip_addrs[3] = 1;
+    addr->name = "netbench";
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Close
+*
+*   DESCRIPTION
+*
+*       Function to close a benchmark socket.  TCP connections are reset
+*       so their ports are not held in TIME-WAIT between runs.
+*
+*   INPUTS
+*
+*       socketd - socket descriptor, or a negative value if the socket
+*                 was not created
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+static VOID NetBench_Close(INT socketd)
+{
+    if (socketd >= 0)
+    {
+        if (NU_Abort(socketd) != NU_SUCCESS)
+        {
+            (VOID)NU_Close_Socket(socketd);
+        }
+    }
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Report
+*
+*   DESCRIPTION
+*
+*       Function to output the result of a benchmark
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*       label - what was counted
+*       count - number of items completed
+*       ticks - system ticks the benchmark took
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+static VOID NetBench_Report(NU_SHELL *   p_shell,
+                            CHAR *       label,
+                            UINT32       count,
+                            UNSIGNED     ticks)
+{
+    CHAR    buf[100];
+
+
+    /* Count a run shorter than one tick as one tick */
+    if (ticks == 0)
+    {
+        ticks = 1;
+    }
+
+    sprintf(buf, "    %lu %s in %lu ms: %lu per second\r\n",
+            (unsigned long)count, label,
+            (unsigned long)(((UINT64)ticks * 1000) / NU_PLUS_TICKS_PER_SEC),
+            (unsigned long)(((UINT64)count * NU_PLUS_TICKS_PER_SEC) / ticks));
+    NU_Shell_Puts(p_shell, buf);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_UDP
+*
+*   DESCRIPTION
+*
+*       Function to measure the rate at which datagrams are sent and
+*       received over the loopback device
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*       count - number of datagrams to send
+*       size - size of each datagram
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS or the status of the socket call that failed
+*
+*************************************************************************/
+static STATUS NetBench_UDP(NU_SHELL *   p_shell,
+                           UINT32       count,
+                           UINT16       size)
+{
+    struct addr_struct      addr;
+    struct addr_struct      from;
+    INT16                   from_len;
+    INT                     rx_sock;
+    INT                     tx_sock;
+    UINT32                  sent = 0;
+    UINT32                  received = 0;
+    UINT32                  batch;
+    UNSIGNED                start;
+    INT32                   bytes;
+    STATUS                  status = NU_SUCCESS;
+
+
+    NetBench_Loopback_Addr(&addr, NETBENCH_PORT);
+
+    rx_sock = NU_Socket(NU_FAMILY_IP, NU_TYPE_DGRAM, 0);
+    tx_sock = NU_Socket(NU_FAMILY_IP, NU_TYPE_DGRAM, 0);
+
+    if ( (rx_sock < 0) || (tx_sock < 0) )
+    {
+        status = (rx_sock < 0) ? rx_sock : tx_sock;
+    }
+    else
+    {
+        status = NU_Bind(rx_sock, &addr, 0);
+
+        if (status >= 0)
+        {
+            status = NU_SUCCESS;
+        }
+    }
+
+    start = NU_Retrieve_Clock();
+
+    while ( (status == NU_SUCCESS) && (received < count) )
+    {
+        /* Send a batch of datagrams */
+        for (batch = 0;
+             (batch < NETBENCH_UDP_BATCH) && (sent < count);
+             batch++, sent++)
+        {
+            bytes = NU_Send_To(tx_sock, NetBench_Tx_Buffer, size, 0,
+                               &addr, 0);
+
+            if (bytes < 0)
+            {
+                status = (STATUS)bytes;
+                break;
+            }
+        }
+
+        /* Receive the batch */
+        while ( (status == NU_SUCCESS) && (received < sent) )
+        {
+            from_len = sizeof(from);
+
+            bytes = NU_Recv_From(rx_sock, NetBench_Rx_Buffer,
+                                 NETBENCH_BUF_SIZE, 0, &from, &from_len);
+
+            if (bytes < 0)
+            {
+                status = (STATUS)bytes;
+            }
+            else
+            {
+                received++;
+            }
+        }
+    }
+
+    if (status == NU_SUCCESS)
+    {
+        NetBench_Report(p_shell, "datagrams", received,
+                        NU_Retrieve_Clock() - start);
+    }
+
+    if (rx_sock >= 0)
+    {
+        (VOID)NU_Close_Socket(rx_sock);
+    }
+
+    if (tx_sock >= 0)
+    {
+        (VOID)NU_Close_Socket(tx_sock);
+    }
+
+    return (status);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_TCP_Connect
+*
+*   DESCRIPTION
+*
+*       Function to open a TCP connection over the loopback device to a
+*       listening benchmark socket
+*
+*   INPUTS
+*
+*       listen_sock - listening socket
+*       client_sock - set to the client side of the connection
+*       server_sock - set to the server side of the connection
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS or the status of the socket call that failed
+*
+*************************************************************************/
+static STATUS NetBench_TCP_Connect(INT      listen_sock,
+                                   INT *    client_sock,
+                                   INT *    server_sock)
+{
+    struct addr_struct      addr;
+    struct addr_struct      peer;
+    INT16                   peer_len;
+    STATUS                  status;
+
+
+    *server_sock = -1;
+
+    NetBench_Loopback_Addr(&addr, NETBENCH_PORT);
+
+    *client_sock = NU_Socket(NU_FAMILY_IP, NU_TYPE_STREAM, 0);
+
+    if (*client_sock < 0)
+    {
+        return ((STATUS)*client_sock);
+    }
+
+    /* The handshake is completed by the stack, so the connection is
+       waiting to be accepted once the connect returns. */
+    status = NU_Connect(*client_sock, &addr, 0);
+
+    if (status >= 0)
+    {
+        peer_len = sizeof(peer);
+
+        *server_sock = NU_Accept(listen_sock, &peer, &peer_len);
+
+        status = (*server_sock < 0) ? (STATUS)*server_sock : NU_SUCCESS;
+    }
+
+    return (status);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Listen
+*
+*   DESCRIPTION
+*
+*       Function to create the listening socket of the TCP benchmarks
+*
+*   INPUTS
+*
+*       listen_sock - set to the listening socket
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS or the status of the socket call that failed
+*
+*************************************************************************/
+static STATUS NetBench_Listen(INT *listen_sock)
+{
+    struct addr_struct      addr;
+    STATUS                  status;
+
+
+    NetBench_Loopback_Addr(&addr, NETBENCH_PORT);
+
+    *listen_sock = NU_Socket(NU_FAMILY_IP, NU_TYPE_STREAM, 0);
+
+    if (*listen_sock < 0)
+    {
+        return ((STATUS)*listen_sock);
+    }
+
+    status = NU_Bind(*listen_sock, &addr, 0);
+
+    if (status >= 0)
+    {
+        status = NU_Listen(*listen_sock, 1);
+    }
+
+    return (status);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_TCP_Receiver
+*
+*   DESCRIPTION
+*
+*       Entry function of the task that receives the data of the TCP
+*       benchmark.  It receives NetBench_Rx_Bytes bytes from the socket,
+*       or stops at the first error, and then releases NetBench_Rx_Done.
+*
+*   INPUTS
+*
+*       argc - socket descriptor to receive from
+*       argv - unused
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+static VOID NetBench_TCP_Receiver(UNSIGNED argc, VOID *argv)
+{
+    INT         socketd = (INT)argc;
+    UINT32      received = 0;
+    INT32       bytes;
+    STATUS      status = NU_SUCCESS;
+
+
+    UNUSED_PARAMETER(argv);
+
+    while ( (status == NU_SUCCESS) && (received < NetBench_Rx_Bytes) )
+    {
+        bytes = NU_Recv(socketd, NetBench_Rx_Buffer, NETBENCH_BUF_SIZE, 0);
+
+        if (bytes <= 0)
+        {
+            status = (bytes < 0) ? (STATUS)bytes : NU_NOT_CONNECTED;
+        }
+        else
+        {
+            received += (UINT32)bytes;
+        }
+    }
+
+    NetBench_Rx_Status = status;
+
+    (VOID)NU_Release_Semaphore(&NetBench_Rx_Done);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_TCP
+*
+*   DESCRIPTION
+*
+*       Function to measure the rate at which data is transferred over a
+*       TCP connection over the loopback device.  The data is received by
+*       a separate task at the priority of the shell task, so the sender
+*       only waits when the window is full and the connection streams
+*       data as a bulk transfer would.
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*       kbytes - number of kilobytes to transfer
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS or the status of the socket or task call that failed
+*
+*************************************************************************/
+static STATUS NetBench_TCP(NU_SHELL *   p_shell,
+                           UINT32       kbytes)
+{
+    INT                     listen_sock;
+    INT                     client_sock = -1;
+    INT                     server_sock = -1;
+    UINT32                  sent;
+    UINT32                  chunk;
+    UNSIGNED                start;
+    UNSIGNED                ticks;
+    INT32                   bytes;
+    STATUS                  status;
+    STATUS                  rx_status;
+    INT                     rx_started = NU_FALSE;
+    CHAR                    name[NU_MAX_NAME];
+    DATA_ELEMENT            task_status;
+    UNSIGNED                scheduled_count;
+    OPTION                  priority;
+    OPTION                  preempt;
+    UNSIGNED                time_slice;
+    VOID                    *stack_base;
+    UNSIGNED                stack_size;
+    UNSIGNED                minimum_stack;
+
+
+    status = NetBench_Listen(&listen_sock);
+
+    if (status == NU_SUCCESS)
+    {
+        status = NetBench_TCP_Connect(listen_sock, &client_sock,
+                                      &server_sock);
+    }
+
+    /* Start the receiver at the priority of this task */
+    if (status == NU_SUCCESS)
+    {
+        status = NU_Task_Information(NU_Current_Task_Pointer(), name,
+                                     &task_status, &scheduled_count,
+                                     &priority, &preempt, &time_slice,
+                                     &stack_base, &stack_size,
+                                     &minimum_stack);
+    }
+
+    if (status == NU_SUCCESS)
+    {
+        status = NU_Create_Semaphore(&NetBench_Rx_Done, "NBRXDONE", 0,
+                                     NU_FIFO);
+    }
+
+    if (status == NU_SUCCESS)
+    {
+        NetBench_Rx_Bytes = kbytes * NETBENCH_BUF_SIZE;
+
+        status = NU_Create_Task(&NetBench_Rx_Task, "NBRX",
+                                NetBench_TCP_Receiver,
+                                (UNSIGNED)server_sock, NU_NULL,
+                                NetBench_Rx_Stack, NETBENCH_RX_STACK_SIZE,
+                                priority, 0, NU_PREEMPT, NU_START);
+
+        if (status == NU_SUCCESS)
+        {
+            rx_started = NU_TRUE;
+        }
+        else
+        {
+            (VOID)NU_Delete_Semaphore(&NetBench_Rx_Done);
+        }
+    }
+
+    start = NU_Retrieve_Clock();
+
+    /* Keep the connection full; NU_Send only blocks on a closed window */
+    for (sent = 0; (status == NU_SUCCESS) && (sent < kbytes); sent++)
+    {
+        for (chunk = 0;
+             (status == NU_SUCCESS) && (chunk < NETBENCH_BUF_SIZE);
+             chunk += (UINT32)bytes)
+        {
+            bytes = NU_Send(client_sock, &NetBench_Tx_Buffer[chunk],
+                            (UINT16)(NETBENCH_BUF_SIZE - chunk), 0);
+
+            if (bytes <= 0)
+            {
+                status = (bytes < 0) ? (STATUS)bytes : NU_NOT_CONNECTED;
+            }
+        }
+    }
+
+    if (rx_started == NU_TRUE)
+    {
+        /* A failed sender resets the connection so the receiver stops */
+        if (status != NU_SUCCESS)
+        {
+            NetBench_Close(client_sock);
+            client_sock = -1;
+        }
+
+        rx_status = NU_Obtain_Semaphore(&NetBench_Rx_Done,
+                                        (status == NU_SUCCESS) ?
+                                        NU_SUSPEND : NETBENCH_RX_TIMEOUT);
+
+        ticks = NU_Retrieve_Clock() - start;
+
+        if (rx_status == NU_SUCCESS)
+        {
+            rx_status = NetBench_Rx_Status;
+        }
+
+        if (status == NU_SUCCESS)
+        {
+            status = rx_status;
+        }
+
+        (VOID)NU_Terminate_Task(&NetBench_Rx_Task);
+        (VOID)NU_Delete_Task(&NetBench_Rx_Task);
+        (VOID)NU_Delete_Semaphore(&NetBench_Rx_Done);
+
+        if (status == NU_SUCCESS)
+        {
+            NetBench_Report(p_shell, "KB", kbytes, ticks);
+        }
+    }
+
+    NetBench_Close(client_sock);
+    NetBench_Close(server_sock);
+
+    if (listen_sock >= 0)
+    {
+        (VOID)NU_Close_Socket(listen_sock);
+    }
+
+    return (status);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Conn
+*
+*   DESCRIPTION
+*
+*       Function to measure the rate at which TCP connections are opened
+*       and reset over the loopback device
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*       count - number of connections to open
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS or the status of the socket call that failed
+*
+*************************************************************************/
+static STATUS NetBench_Conn(NU_SHELL *  p_shell,
+                            UINT32      count)
+{
+    INT                     listen_sock;
+    INT                     client_sock;
+    INT                     server_sock;
+    UINT32                  opened;
+    UNSIGNED                start;
+    STATUS                  status;
+
+
+    status = NetBench_Listen(&listen_sock);
+
+    start = NU_Retrieve_Clock();
+
+    for (opened = 0; (status == NU_SUCCESS) && (opened < count); opened++)
+    {
+        status = NetBench_TCP_Connect(listen_sock, &client_sock,
+                                      &server_sock);
+
+        NetBench_Close(client_sock);
+        NetBench_Close(server_sock);
+    }
+
+    if (status == NU_SUCCESS)
+    {
+        NetBench_Report(p_shell, "connections", count,
+                        NU_Retrieve_Clock() - start);
+    }
+
+    if (listen_sock >= 0)
+    {
+        (VOID)NU_Close_Socket(listen_sock);
+    }
+
+    return (status);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NetBench_Lookup
+*
+*   DESCRIPTION
+*
+*       Function to measure the average cost of an IPv4 route lookup and
+*       an ARP cache lookup for an address
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*       ip_addr - address to look up
+*       count - number of lookups of each kind
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+*************************************************************************/
+static STATUS NetBench_Lookup(NU_SHELL *    p_shell,
+                              UINT8 *       ip_addr,
+                              UINT32        count)
+{
+    SCK_SOCKADDR_IP         dest;
+    RTAB4_ROUTE_ENTRY *     route;
+    UINT32                  route_cycles;
+    UINT32                  arp_cycles;
+    UINT32                  start;
+    UINT32                  i;
+    INT                     found = 0;
+    CHAR                    buf[100];
+
+
+    memset(&dest, 0, sizeof(dest));
+
+    dest.sck_family = NU_FAMILY_IP;
+    dest.sck_len = sizeof(dest);
+    dest.sck_addr = IP_ADDR(ip_addr);
+
+    /* Obtain the TCP semaphore to protect the stack global variables */
+    (VOID)NET_Obtain_Stack_Lock(NU_SUSPEND);
+
+    start = NETBENCH_CYCLES();
+
+    for (i = 0; i < count; i++)
+    {
+        route = RTAB4_Find_Route(&dest, RT_BEST_METRIC);
+
+        if (route != NU_NULL)
+        {
+            found = 1;
+
+            RTAB_Free((ROUTE_ENTRY *)route, NU_FAMILY_IP);
+        }
+    }
+
+    route_cycles = NETBENCH_CYCLES() - start;
+
+    start = NETBENCH_CYCLES();
+
+    for (i = 0; i < count; i++)
+    {
+        (VOID)ARP_Find_Entry(&dest);
+    }
+
+    arp_cycles = NETBENCH_CYCLES() - start;
+
+    /* Release the semaphore. */
+    (VOID)NET_Release_Stack_Lock();
+
+    sprintf(buf, "    Route lookup (%s): %lu cycles\r\n",
+            found ? "found" : "no route",
+            (unsigned long)(route_cycles / count));
+    NU_Shell_Puts(p_shell, buf);
+
+    sprintf(buf, "    ARP lookup:           %lu cycles\r\n",
+            (unsigned long)(arp_cycles / count));
+    NU_Shell_Puts(p_shell, buf);
+
+    return (NU_SUCCESS);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       command_netbench
+*
+*   DESCRIPTION
+*
+*       Function to perform a 'netbench' command (stack benchmarks)
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*       argc - number of arguments
+*       argv - pointer to array of arguments
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+*************************************************************************/
+STATUS command_netbench(NU_SHELL *  p_shell,
+                        INT         argc,
+                        CHAR **     argv)
+{
+    UINT8                   ip_addr[IP_ADDR_LEN];
+    UINT32                  count;
+    UINT32                  size;
+    STATUS                  status = NU_INVALID_PARM;
+    CHAR                    buf[100];
+
+
+    if ( (argc >= 1) && (argc <= 3) )
+    {
+        if (strcmp(argv[0], "udp") == 0)
+        {
+            count = (argc > 1) ? (UINT32)atoi(argv[1]) : NETBENCH_UDP_COUNT;
+            size = (argc > 2) ? (UINT32)atoi(argv[2]) : 64;
+
+            if ( (count != 0) && (size <= NETBENCH_BUF_SIZE) )
+            {
+                status = NetBench_UDP(p_shell, count, (UINT16)size);
+            }
+        }
+        else if ( (strcmp(argv[0], "tcp") == 0) && (argc <= 2) )
+        {
+            count = (argc > 1) ? (UINT32)atoi(argv[1]) : NETBENCH_TCP_KBYTES;
+
+            if (count != 0)
+            {
+                status = NetBench_TCP(p_shell, count);
+            }
+        }
+        else if ( (strcmp(argv[0], "conn") == 0) && (argc <= 2) )
+        {
+            count = (argc > 1) ? (UINT32)atoi(argv[1]) : NETBENCH_CONN_COUNT;
+
+            if (count != 0)
+            {
+                status = NetBench_Conn(p_shell, count);
+            }
+        }
+        else if ( (strcmp(argv[0], "lookup") == 0) && (argc >= 2) )
+        {
+            count = (argc > 2) ? (UINT32)atoi(argv[2]) : NETBENCH_LOOKUP_COUNT;
+
+            if ( (count != 0) &&
+                 (NU_Inet_PTON(NU_FAMILY_IP, argv[1], ip_addr) == NU_SUCCESS) )
+            {
+                status = NetBench_Lookup(p_shell, ip_addr, count);
+            }
+        }
+    }
+
+    if (status == NU_INVALID_PARM)
+    {
+        /* Output error and format requirements */
+        NU_Shell_Puts(p_shell, "\r\nERROR: Invalid Usage!\r\n");
+        NU_Shell_Puts(p_shell, "Format: netbench udp [count] [size]\r\n");
+        NU_Shell_Puts(p_shell, "        netbench tcp [kbytes]\r\n");
+        NU_Shell_Puts(p_shell, "        netbench conn [count]\r\n");
+        NU_Shell_Puts(p_shell, "        netbench lookup <ip> [count]\r\n");
+    }
+    else if (status != NU_SUCCESS)
+    {
+        sprintf(buf, "    Benchmark failed: %d\r\n", (INT)status);
+        NU_Shell_Puts(p_shell, buf);
+    }
+
+    /* Carriage return and line-feed before going back to command shell */
+    NU_Shell_Puts(p_shell, "\r\n");
+
+    /* Return success to caller */
+    return (NU_SUCCESS);
+}
+
+#endif /* CFG_NU_OS_NET_SHELL_NETBENCH == 1 */
@@ -26,6 +26,7 @@
 *   FUNCTIONS
 *
 *       command_ipconfig
+*       command_netlat
 *       nu_os_net_shell_init
 *
 *   DEPENDENCIES
@@ -45,6 +46,11 @@
 #include <string.h>
 #include <stdio.h>
 
+#if (CFG_NU_OS_NET_SHELL_NETBENCH == 1)
+/* 'netbench' command in net_bench.c */
+STATUS command_netbench(NU_SHELL *p_shell, INT argc, CHAR **argv);
+#endif
+
 
 /*************************************************************************
 *
@@ -106,13 +112,13 @@ static STATUS command_ipconfig(NU_SHELL *   p_shell,
             status = NU_Device_Up(if_index->if_name);
 
             /* Obtain the TCP semaphore to protect the stack global variables */
-            (VOID)NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+            (VOID)NET_Obtain_Stack_Lock(NU_SUSPEND);
 
             /* Get a pointer to the device */
             dev = DEV_Get_Dev_By_Name(if_index->if_name);
 
             /* Release the semaphore. */
-            (VOID)NU_Release_Semaphore(&TCP_Resource);
+            (VOID)NET_Release_Stack_Lock();
 
             /* Put the interface hardware address in buffer */
             sprintf(buf, "    Hardware Address: %02x:%02x:%02x:%02x:%02x:%02x\r\n",dev->dev_mac_addr[0],
@@ -251,6 +257,118 @@ static STATUS command_ipconfig(NU_SHELL *   p_shell,
     return (NU_SUCCESS);
 }
 
+#if (INCLUDE_NET_LATENCY_TRACE == NU_TRUE)
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       command_netlat
+*
+*   DESCRIPTION
+*
+*       Function to perform a 'netlat' command (packet path latency).
+*       Without arguments, the latency statistics and histogram of each
+*       stage of the packet path are shown.  'netlat reset' clears the
+*       statistics and 'netlat trace' logs the histograms to the trace
+*       service.
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*       argc - number of arguments
+*       argv - pointer to array of arguments
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+*************************************************************************/
+static STATUS command_netlat(NU_SHELL *   p_shell,
+                             INT          argc,
+                             CHAR **      argv)
+{
+    static const CHAR * const stage_names[NET_LAT_STAGES] =
+    {
+        "Driver RX to demux",
+        "Demux to socket",
+        "Socket to application",
+        "Transmit queue to driver TX"
+    };
+    NET_LAT_STAGE           stats;
+    INT                     stage;
+    INT                     bucket;
+    CHAR                    buf[100];
+
+
+    /* Determine if the parameters are valid */
+    if ( (argc > 1) ||
+         ((argc == 1) && (strcmp(argv[0], "reset") != 0) &&
+          (strcmp(argv[0], "trace") != 0)) )
+    {
+        /* Output error and format requirements */
+        NU_Shell_Puts(p_shell, "\r\nERROR: Invalid Usage!\r\n");
+        NU_Shell_Puts(p_shell, "Format: netlat [reset | trace]\r\n");
+    }
+    else if ( (argc == 1) && (strcmp(argv[0], "reset") == 0) )
+    {
+        /* Clear the statistics of all stages */
+        NET_Lat_Reset();
+    }
+    else if (argc == 1)
+    {
+        /* Log the histograms to the trace service */
+        NET_Lat_Trace();
+    }
+    else
+    {
+        /* Loop through the stages */
+        for (stage = 0; stage < NET_LAT_STAGES; stage++)
+        {
+            if (NET_Lat_Get_Stage(stage, &stats) != NU_SUCCESS)
+                continue;
+
+            /* Output the stage name */
+            NU_Shell_Puts(p_shell, "\r\n");
+            NU_Shell_Puts(p_shell, (CHAR *)stage_names[stage]);
+            NU_Shell_Puts(p_shell, "\r\n");
+
+            if (stats.nls_count == 0)
+            {
+                NU_Shell_Puts(p_shell, "    No packets\r\n");
+                continue;
+            }
+
+            /* Output the packet count and latencies in cycles */
+            sprintf(buf, "    Packets: %lu  Min: %lu  Avg: %lu  Max: %lu cycles\r\n",
+                    (unsigned long)stats.nls_count,
+                    (unsigned long)stats.nls_min,
+                    (unsigned long)(stats.nls_total / stats.nls_count),
+                    (unsigned long)stats.nls_max);
+            NU_Shell_Puts(p_shell, buf);
+
+            /* Output the buckets of the histogram that hold packets */
+            for (bucket = 0; bucket < NET_LAT_BUCKETS; bucket++)
+            {
+                if (stats.nls_buckets[bucket] != 0)
+                {
+                    sprintf(buf, "    < 2^%-2d cycles: %lu\r\n", bucket + 1,
+                            (unsigned long)stats.nls_buckets[bucket]);
+                    NU_Shell_Puts(p_shell, buf);
+                }
+            }
+        }
+    }
+
+    /* Carriage return and line-feed before going back to command shell */
+    NU_Shell_Puts(p_shell, "\r\n");
+
+    /* Return success to caller */
+    return (NU_SUCCESS);
+}
+
+#endif /* INCLUDE_NET_LATENCY_TRACE == NU_TRUE */
+
 
 /*************************************************************************
 *
@@ -298,7 +416,23 @@ STATUS nu_os_net_shell_init (CHAR *   path, INT cmd)
         {
             /* Register 'ipconfig' command with all active shell sessions */
             status = NU_Register_Command(NU_NULL, "ipconfig", command_ipconfig);
-            
+
+#if (INCLUDE_NET_LATENCY_TRACE == NU_TRUE)
+            /* Register 'netlat' command with all active shell sessions */
+            if (status == NU_SUCCESS)
+            {
+                status = NU_Register_Command(NU_NULL, "netlat", command_netlat);
+            }
+#endif
+
+#if (CFG_NU_OS_NET_SHELL_NETBENCH == 1)
+            /* Register 'netbench' command with all active shell sessions */
+            if (status == NU_SUCCESS)
+            {
+                status = NU_Register_Command(NU_NULL, "netbench", command_netbench);
+            }
+#endif
+
             break;
         }
 
@@ -138,7 +138,7 @@ UINT16 Get_pppLinkStatusEntry(snmp_object_t *obj, UINT8 getflag)
     UINT16              status = SNMP_NOERROR;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS)
     {
         /* Log the error if we failed to grab the semaphore. */
         NLOG_Error_Log("Failed to grab semaphore",
@@ -400,7 +400,7 @@ UINT16 Get_pppLinkStatusEntry(snmp_object_t *obj, UINT8 getflag)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore",
                             NERR_SEVERE, __FILE__, __LINE__);
     }
@@ -516,7 +516,7 @@ UINT16 Get_pppLinkConfigEntry(snmp_object_t *obj, UINT8 getflag)
     UINT16                  status = SNMP_NOERROR;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* If the oid parameter is 0 and we are handling GET request,
          * then the agent is looking for the first device, so don't
@@ -630,7 +630,7 @@ UINT16 Get_pppLinkConfigEntry(snmp_object_t *obj, UINT8 getflag)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore",
                             NERR_SEVERE, __FILE__, __LINE__);
     }
@@ -686,7 +686,7 @@ UINT16 Set_pppLinkConfigEntry(snmp_object_t *obj)
     UINT16                  status = SNMP_NOERROR;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* If the oid parameter is 0 and we are handling GET request,
          * then the agent is looking for the first device, so don't
@@ -825,7 +825,7 @@ UINT16 Set_pppLinkConfigEntry(snmp_object_t *obj)
         }
 
         /* Release semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore",
                             NERR_SEVERE, __FILE__, __LINE__);
     }
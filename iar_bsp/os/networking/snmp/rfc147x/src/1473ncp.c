@@ -78,7 +78,7 @@ UINT16 Get_pppIpEntry(snmp_object_t *obj, UINT8 getflag)
     UINT16                  status = SNMP_NOERROR;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* If we are handling GETNEXT request. */
         if (!getflag)
@@ -186,7 +186,7 @@ UINT16 Get_pppIpEntry(snmp_object_t *obj, UINT8 getflag)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore",
                             NERR_SEVERE, __FILE__, __LINE__);
     }
@@ -317,7 +317,7 @@ UINT16 Get_pppIpConfigEntry(snmp_object_t *obj, UINT8 getflag)
     UINT16                  status = SNMP_NOERROR;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {
         /* If we are handling GETNEXT request. */
         if (!getflag)
@@ -382,7 +382,7 @@ UINT16 Get_pppIpConfigEntry(snmp_object_t *obj, UINT8 getflag)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore",
                             NERR_SEVERE, __FILE__, __LINE__);
     }
@@ -438,7 +438,7 @@ UINT16 Set_pppIpConfigEntry(snmp_object_t *obj)
     UINT16                  status = SNMP_NOERROR;
 
     /* Grab the semaphore. */
-    if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) == NU_SUCCESS)
+    if (NET_Obtain_Stack_Lock(NU_SUSPEND) == NU_SUCCESS)
     {       
         /* If the oid parameter is 0, then it is invalid as we are
          * handling SET request, so don't get the device at this time.
@@ -511,7 +511,7 @@ UINT16 Set_pppIpConfigEntry(snmp_object_t *obj)
         }
 
         /* Release the semaphore. */
-        if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+        if (NET_Release_Stack_Lock() != NU_SUCCESS)
             NLOG_Error_Log("Failed to release semaphore",
                             NERR_SEVERE, __FILE__, __LINE__);
     }
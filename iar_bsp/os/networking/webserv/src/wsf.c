@@ -455,7 +455,9 @@ STATIC VOID WSF_Name_File(CHAR * name, CHAR * buf )
 *                                                                      
 * DESCRIPTION                                                          
 *                                                                      
-*     Function to write the file to the socket.                     
+*     Function to write the file to the socket.  Unless the
+*     connection uses SSL, the file is sent with NU_Send_File, which
+*     reads it directly into the TCP buffers.
 *                                                                      
 * INPUTS                                                               
 *                                                                      
@@ -476,6 +478,7 @@ INT WSF_Send_File(WS_REQUEST * req)
     INT         fd;
     UINT16      mode;
     UINT32      j;
+    INT32       sent;
 	STATUS      status;
 
 
@@ -502,6 +505,22 @@ INT WSF_Send_File(WS_REQUEST * req)
     /* Open the file for reading */
     if((fd = NU_Open((CHAR *)buf, PO_RDONLY, (UINT16)mode)) >= 0)
     {
+#if INCLUDE_SSL
+        if(!req->ws_ssl)
+#endif
+        {
+            /* Stream the file straight into the TCP buffers.  If not all
+             * of it could be sent, send the rest through fbuf.
+             */
+            sent = NU_Send_File(req->ws_sd, fd, 0, 0xFFFFFFFFUL);
+
+            if(sent < 0)
+                sent = 0;
+
+            if(NU_Seek(fd, sent, PSEEK_SET) != sent)
+                NERRS_Log_Error(NERR_INFORMATIONAL, __FILE__, __LINE__);
+        }
+
         while((j = NU_Read(fd, (CHAR *)fbuf, WS_FBUF_SZ)) > 0)
         {
             if(WSN_Write_To_Net(req, fbuf, j, WS_FILETRNSFR) != NU_SUCCESS)
@@ -157,7 +157,7 @@ STATUS WSOX_Resume_Server(VOID)
         /* Get the TCP semaphore since we are about to manipulate the
          * internal socket structure.
          */
-        status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+        status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
         if (status == NU_SUCCESS)
         {
@@ -170,7 +170,7 @@ STATUS WSOX_Resume_Server(VOID)
             /* Indicate that there is an error on the control socket. */
             WSOX_Socket_Error = NU_TRUE;
 
-            NU_Release_Semaphore(&TCP_Resource);
+            NET_Release_Stack_Lock();
         }
     }
 
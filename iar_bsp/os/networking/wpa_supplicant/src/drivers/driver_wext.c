@@ -1924,7 +1924,7 @@ static const u8 * wpa_driver_wext_get_mac_addr(void *priv)
 	 * be obtained. This operation is not possible using just the
 	 * user APIs.
 	 */
-	status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+	status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
 	if (status == NU_SUCCESS) {
 		/* Get a pointer to the device structure. */
@@ -1935,7 +1935,7 @@ static const u8 * wpa_driver_wext_get_mac_addr(void *priv)
 		else
 			wpa_printf(MSG_DEBUG, "Unable to find specified device");
 
-		if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+		if (NET_Release_Stack_Lock() != NU_SUCCESS)
 			wpa_printf(MSG_ERROR, "WEXT: Unable to release TCP semaphore");
 	}
 	else
@@ -1961,7 +1961,7 @@ static int wpa_driver_wext_send_eapol(void *priv, const u8 *dest,
 	 * stack global variables. This function uses NET internals
 	 * so this semaphore must be obtained.
 	 */
-	status = NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND);
+	status = NET_Obtain_Stack_Lock(NU_SUSPEND);
 
 	if (status == NU_SUCCESS) {
 		/* Get a pointer to the device structure. */
@@ -2040,7 +2040,7 @@ static int wpa_driver_wext_send_eapol(void *priv, const u8 *dest,
 				drv->ifname);
 		}
 
-		if (NU_Release_Semaphore(&TCP_Resource) != NU_SUCCESS)
+		if (NET_Release_Stack_Lock() != NU_SUCCESS)
 			wpa_printf(MSG_ERROR, "WEXT: Failed to release TCP semaphore");
 	} else {
 		wpa_printf(MSG_ERROR, "WEXT: Unable to obtain TCP semaphore");
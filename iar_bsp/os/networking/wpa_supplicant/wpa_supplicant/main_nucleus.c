@@ -498,13 +498,13 @@ VOID WPA_Supplicant_EAPOL_Rx(CHAR *src_addr, CHAR *dst_addr,
 		 * caller (NET Demux task). Releasing the semaphore isn't
 		 * recommended, but it should be done due to design restrictions.
 		 */
-		NU_Release_Semaphore(&TCP_Resource);
+		NET_Release_Stack_Lock();
 
 		wpa_supplicant_rx_eapol(wpa_s, (const u8 *)src_addr,
 								WPA_Supplicant_Input_Buffer, data_len);
 
 		/* Re-obtain the semaphore which was released above. */
-		if (NU_Obtain_Semaphore(&TCP_Resource, NU_SUSPEND) != NU_SUCCESS) {
+		if (NET_Obtain_Stack_Lock(NU_SUSPEND) != NU_SUCCESS) {
 			wpa_printf(MSG_ERROR, "NU_WPA: Unable to obtain semaphore.");
 		}
 	}
@@ -44,6 +44,7 @@
 #include    "os/services/init/inc/runlevel.h"
 #include    "services/runlevel_init.h"
 #include    "services/reg_api.h"
+#include    "services/nu_trace.h"
 #include    <string.h>
 #include    <stdio.h>
 
@@ -96,6 +97,10 @@ STATUS  NU_RunLevel_Init(NU_MEMORY_POOL * mem_pool)
 {
     STATUS  status;
 
+    /* Index the registry keys looked up by the components.  Keys are
+       still found without the index if it cannot be built. */
+    (VOID)REG_Index_Initialize(mem_pool);
+
 #ifdef CFG_NU_OS_SVCS_DBG_ENABLE
 
     VOID *  stack_mem;
@@ -180,6 +185,8 @@ STATUS  NU_RunLevel_Init(NU_MEMORY_POOL * mem_pool)
 static  VOID    RunLevel_Init_Task_Entry(UNSIGNED argc, VOID * argv)
 {
     INT     run_level;
+    UINT32  reg_lookups;
+    UINT32  reg_compares;
 
     /* Suppress warnings */
     NU_UNUSED_PARAM(argc);
@@ -215,6 +222,11 @@ static  VOID    RunLevel_Init_Task_Entry(UNSIGNED argc, VOID * argv)
     /* Check if need to keep looping */
     } while (run_level <= RUNLEVEL_INIT_MAX_RUNLEVEL);
 
+    /* Trace the registry cost of system initialization. */
+    REG_Get_Lookup_Counts(&reg_lookups, &reg_compares);
+    NU_Trace_Mark_U32("REG_INIT_LOOKUPS", reg_lookups);
+    NU_Trace_Mark_U32("REG_INIT_KEY_COMPARES", reg_compares);
+
     return;
 }
 
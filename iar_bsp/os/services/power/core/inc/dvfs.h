@@ -33,6 +33,14 @@ extern "C" {
 #define PM_SET_OP_TASK_PRIORITY  0
 #define PM_SET_OP_TASK_TIMESLICE 0
 
+/* DVFS governor settings */
+#define PM_GOVERNOR_STACK_SIZE   CFG_NU_OS_SVCS_PWR_CORE_GOVERNOR_STACK_SIZE
+#define PM_GOVERNOR_TASK_PRIORITY 2
+#define PM_GOVERNOR_TASK_TIMESLICE 0
+#define PM_GOVERNOR_PERIOD       ((CFG_NU_OS_SVCS_PWR_CORE_GOVERNOR_PERIOD * NU_PLUS_TICKS_PER_SEC) / 1000)
+#define PM_GOVERNOR_DOWN_SAMPLES CFG_NU_OS_SVCS_PWR_CORE_GOVERNOR_DOWN_SAMPLES
+#define PM_GOVERNOR_MAX_HOLD_OPS 32         /* OPs that drivers can hold, one bit each */
+#define PM_GOVERNOR_HOLD_EVENT   0x00000001UL
 
 typedef struct PM_OP_CB
 {
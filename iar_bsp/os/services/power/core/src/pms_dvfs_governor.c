@@ -0,0 +1,679 @@
+/*************************************************************************
+*
+*            Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+*************************************************************************/
+
+/*************************************************************************
+*
+*   FILE NAME
+*
+*       pms_dvfs_governor.c
+*
+*   COMPONENT
+*
+*       DVFS
+*
+*   DESCRIPTION
+*
+*       Contains the load driven DVFS governor.  A task samples the CPU
+*       usage counters every governor period.  The OP is raised to the
+*       highest OP as soon as the load reaches the up threshold and is
+*       lowered one OP at a time once the load has stayed at or below
+*       the down threshold for a number of periods.
+*
+*       Drivers hold an OP while they are busy, for example while
+*       frames are queued for transmission.  The governor never selects
+*       an OP below the highest held OP.  Holds only update counters so
+*       they may be placed and released from a HISR.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   FUNCTIONS
+*
+*       NU_PM_Governor_Hold_OP
+*       NU_PM_Governor_Release_OP
+*       NU_PM_Governor_Set_Thresholds
+*       NU_PM_Governor_Control
+*       NU_PM_Governor_Get_Info
+*       PMS_DVFS_Governor_Initialize
+*       PMS_DVFS_Governor_Task_Entry
+*       PMS_DVFS_Governor_Held_OP
+*       PMS_DVFS_Governor_Transition
+*
+*   DEPENDENCIES
+*
+*       power_core.h
+*       dvfs.h
+*
+*************************************************************************/
+#include "nucleus.h"
+#include "kernel/nu_kernel.h"
+#include "services/power_core.h"
+#include "os/services/power/core/inc/dvfs.h"
+#include <string.h>
+
+#if (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_GOVERNOR == NU_TRUE)
+
+#if (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_DVFS != NU_TRUE)
+#error "PMS DVFS governor: Enable the enable_dvfs option of the power core."
+#endif
+
+#if (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_CPU_USAGE != NU_TRUE)
+#error "PMS DVFS governor: Enable the enable_cpu_usage option of the power core."
+#endif
+
+extern UINT8           PM_DVFS_OP_Count;
+extern UINT8           PM_DVFS_Current_OP;
+extern UINT8           PM_DVFS_Minimum_OP;
+
+static NU_TASK         PMS_Governor_Task;
+static NU_EVENT_GROUP  PMS_Governor_Events;
+static BOOLEAN         PMS_Governor_Enabled = NU_TRUE;
+static UINT8           PMS_Governor_Up_Threshold = CFG_NU_OS_SVCS_PWR_CORE_GOVERNOR_UP_THRESHOLD;
+static UINT8           PMS_Governor_Down_Threshold = CFG_NU_OS_SVCS_PWR_CORE_GOVERNOR_DOWN_THRESHOLD;
+
+/* Hold counts for each OP, the bit of an OP is set while its count
+   is not zero.  Updated with interrupts locked out. */
+static UINT16          PMS_Governor_Hold_Count[PM_GOVERNOR_MAX_HOLD_OPS];
+static UINT32          PMS_Governor_Held_Mask;
+
+/* Load and transition cost statistics */
+static PM_GOVERNOR_INFO PMS_Governor_Info;
+
+static UINT8  PMS_DVFS_Governor_Held_OP(VOID);
+static VOID   PMS_DVFS_Governor_Transition(UINT8 op_id);
+static VOID   PMS_DVFS_Governor_Task_Entry(UNSIGNED argc, VOID *argv);
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_PM_Governor_Hold_OP
+*
+*   DESCRIPTION
+*
+*       This function keeps the governor from selecting an OP below the
+*       specified OP until the hold is released.  Holds are counted so
+*       every call must be matched by NU_PM_Governor_Release_OP.  The
+*       governor is woken if the held OP is above the current OP.
+*       This function may be called from a task or a HISR.
+*
+*   INPUT
+*
+*       op_id               OP to hold, PM_GOVERNOR_HIGHEST_OP holds the
+*                           highest available OP
+*
+*   OUTPUT
+*
+*       NU_SUCCESS          Hold is placed
+*       PM_INVALID_OP_ID    Provided OP is invalid
+*       PM_UNEXPECTED_ERROR Too many holds on the OP
+*
+*************************************************************************/
+STATUS NU_PM_Governor_Hold_OP(UINT8 op_id)
+{
+    STATUS    pm_status = NU_SUCCESS;
+    INT       old_level;
+
+    /* The highest OP uses the last hold slot */
+    if (op_id == PM_GOVERNOR_HIGHEST_OP)
+    {
+        op_id = PM_GOVERNOR_MAX_HOLD_OPS - 1;
+    }
+
+    if (op_id >= PM_GOVERNOR_MAX_HOLD_OPS)
+    {
+        pm_status = PM_INVALID_OP_ID;
+    }
+    else
+    {
+        old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+        if (PMS_Governor_Hold_Count[op_id] == 0xFFFF)
+        {
+            pm_status = PM_UNEXPECTED_ERROR;
+        }
+        else
+        {
+            PMS_Governor_Hold_Count[op_id]++;
+            PMS_Governor_Held_Mask |= (1UL << op_id);
+        }
+
+        (VOID)NU_Local_Control_Interrupts(old_level);
+
+        /* Wake the governor so the OP is raised without waiting for
+           the end of the period */
+        if ((pm_status == NU_SUCCESS) && (op_id > PM_DVFS_Current_OP))
+        {
+            (VOID)NU_Set_Events(&PMS_Governor_Events, PM_GOVERNOR_HOLD_EVENT, NU_OR);
+        }
+    }
+
+    return (pm_status);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_PM_Governor_Release_OP
+*
+*   DESCRIPTION
+*
+*       This function releases a hold placed by NU_PM_Governor_Hold_OP.
+*       The governor lowers the OP on a later period.  This function
+*       may be called from a task or a HISR.
+*
+*   INPUT
+*
+*       op_id               OP that was held
+*
+*   OUTPUT
+*
+*       NU_SUCCESS          Hold is released
+*       PM_INVALID_OP_ID    Provided OP is invalid
+*       PM_INVALID_PARAMETER The OP is not held
+*
+*************************************************************************/
+STATUS NU_PM_Governor_Release_OP(UINT8 op_id)
+{
+    STATUS    pm_status = NU_SUCCESS;
+    INT       old_level;
+
+    /* The highest OP uses the last hold slot */
+    if (op_id == PM_GOVERNOR_HIGHEST_OP)
+    {
+        op_id = PM_GOVERNOR_MAX_HOLD_OPS - 1;
+    }
+
+    if (op_id >= PM_GOVERNOR_MAX_HOLD_OPS)
+    {
+        pm_status = PM_INVALID_OP_ID;
+    }
+    else
+    {
+        old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+        if (PMS_Governor_Hold_Count[op_id] == 0)
+        {
+            pm_status = PM_INVALID_PARAMETER;
+        }
+        else if (--PMS_Governor_Hold_Count[op_id] == 0)
+        {
+            PMS_Governor_Held_Mask &= ~(1UL << op_id);
+        }
+
+        (VOID)NU_Local_Control_Interrupts(old_level);
+    }
+
+    return (pm_status);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_PM_Governor_Set_Thresholds
+*
+*   DESCRIPTION
+*
+*       This function changes the CPU load thresholds of the governor.
+*       The gap between the thresholds keeps the governor from toggling
+*       between OPs on a steady load.
+*
+*   INPUT
+*
+*       up_threshold        Load in percent at which the OP is raised
+*       down_threshold      Load in percent at which the OP is lowered,
+*                           must be below up_threshold
+*
+*   OUTPUT
+*
+*       NU_SUCCESS          Thresholds are updated
+*       PM_INVALID_PARAMETER Thresholds are invalid
+*
+*************************************************************************/
+STATUS NU_PM_Governor_Set_Thresholds(UINT8 up_threshold, UINT8 down_threshold)
+{
+    STATUS    pm_status = NU_SUCCESS;
+    INT       old_level;
+
+    if ((up_threshold > 100) || (down_threshold >= up_threshold))
+    {
+        pm_status = PM_INVALID_PARAMETER;
+    }
+    else
+    {
+        /* Update both thresholds together */
+        old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+        PMS_Governor_Up_Threshold = up_threshold;
+        PMS_Governor_Down_Threshold = down_threshold;
+
+        (VOID)NU_Local_Control_Interrupts(old_level);
+    }
+
+    return (pm_status);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_PM_Governor_Control
+*
+*   DESCRIPTION
+*
+*       This function enables or disables load driven OP selection.
+*       While disabled the governor only raises the OP for holds and
+*       the OP is otherwise left to NU_PM_Set_Current_OP.
+*
+*   INPUT
+*
+*       new_value           NU_TRUE enables the governor, NU_FALSE
+*                           disables it
+*       previous_value      Pointer to where the previous value is
+*                           returned
+*
+*   OUTPUT
+*
+*       NU_SUCCESS          Successful update
+*       PM_INVALID_POINTER  Provided pointer is invalid
+*       PM_INVALID_PARAMETER Provided value is invalid
+*
+*************************************************************************/
+STATUS NU_PM_Governor_Control(BOOLEAN new_value, BOOLEAN *previous_value)
+{
+    STATUS pm_status = NU_SUCCESS;
+
+    NU_SUPERV_USER_VARIABLES
+
+    /* Verify parameters */
+    if (previous_value == NU_NULL)
+    {
+        pm_status = PM_INVALID_POINTER;
+    }
+    else if ((new_value != NU_TRUE) && (new_value != NU_FALSE))
+    {
+        pm_status = PM_INVALID_PARAMETER;
+    }
+    else
+    {
+        /* Save the old value */
+        *previous_value = PMS_Governor_Enabled;
+
+        /* Switch to supervisor mode */
+        NU_SUPERVISOR_MODE();
+
+        PMS_Governor_Enabled = new_value;
+
+        /* Return to user mode */
+        NU_USER_MODE();
+    }
+
+    return (pm_status);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NU_PM_Governor_Get_Info
+*
+*   DESCRIPTION
+*
+*       This function retrieves the last sampled load, the held OP and
+*       the cost of the OP transitions made by the governor.
+*
+*   INPUT
+*
+*       info_ptr            Pointer to where the information is
+*                           retrieved to
+*
+*   OUTPUT
+*
+*       NU_SUCCESS          Successful retrieval
+*       PM_INVALID_POINTER  Provided pointer is invalid
+*
+*************************************************************************/
+STATUS NU_PM_Governor_Get_Info(PM_GOVERNOR_INFO *info_ptr)
+{
+    STATUS    pm_status = NU_SUCCESS;
+    INT       old_level;
+
+    if (info_ptr == NU_NULL)
+    {
+        pm_status = PM_INVALID_POINTER;
+    }
+    else
+    {
+        /* Take a consistent copy of the statistics */
+        old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+        memcpy(info_ptr, &PMS_Governor_Info, sizeof(PM_GOVERNOR_INFO));
+        info_ptr -> pm_held_op = PMS_DVFS_Governor_Held_OP();
+        info_ptr -> pm_up_threshold = PMS_Governor_Up_Threshold;
+        info_ptr -> pm_down_threshold = PMS_Governor_Down_Threshold;
+
+        (VOID)NU_Local_Control_Interrupts(old_level);
+    }
+
+    return (pm_status);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       PMS_DVFS_Governor_Initialize
+*
+*   DESCRIPTION
+*
+*       This function creates the event group and the task of the
+*       governor.  The task waits for DVFS initialization to complete
+*       before it changes the OP.
+*
+*   INPUT
+*
+*       mem_pool_ptr        Pointer to use for allocating the stack
+*
+*   OUTPUT
+*
+*       NU_SUCCESS           Governor is created
+*       PM_UNEXPECTED_ERROR  One of the governor objects was not created
+*
+*************************************************************************/
+STATUS PMS_DVFS_Governor_Initialize(NU_MEMORY_POOL *mem_pool_ptr)
+{
+    STATUS  pm_status = NU_SUCCESS;
+    STATUS  status;
+    VOID   *stack = NU_NULL;
+
+    /* Create the event group used to wake the governor for holds */
+    status = NU_Create_Event_Group(&PMS_Governor_Events, "GOVERN");
+
+    if (status == NU_SUCCESS)
+    {
+        /* Allocate memory for the task stack */
+        status = NU_Allocate_Memory(mem_pool_ptr, &stack, PM_GOVERNOR_STACK_SIZE, NU_NO_SUSPEND);
+    }
+
+    if (status == NU_SUCCESS)
+    {
+        status = NU_Create_Task(&PMS_Governor_Task, "GOVERN", PMS_DVFS_Governor_Task_Entry,
+                                0, NU_NULL, stack, PM_GOVERNOR_STACK_SIZE, PM_GOVERNOR_TASK_PRIORITY,
+                                PM_GOVERNOR_TASK_TIMESLICE, NU_PREEMPT, NU_START);
+        if (status == NU_SUCCESS)
+        {
+            /* Bind this task to the kernel module */
+            (VOID)NU_BIND_TASK_TO_KERNEL(&PMS_Governor_Task);
+        }
+        else
+        {
+            (VOID)NU_Deallocate_Memory(stack);
+        }
+    }
+
+    /* If there were any error return error to
+       indicate initialization failed */
+    if (status != NU_SUCCESS)
+    {
+        pm_status = PM_UNEXPECTED_ERROR;
+    }
+
+    return (pm_status);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       PMS_DVFS_Governor_Task_Entry
+*
+*   DESCRIPTION
+*
+*       This is the governor task.  Each period it computes the CPU load
+*       from the change in the CPU usage counters and selects the next
+*       OP.  When it is woken early by a hold only the holds are
+*       applied.
+*
+*   INPUT
+*
+*       argc                Not used
+*       argv                Not used
+*
+*   OUTPUT
+*
+*       None
+*
+*************************************************************************/
+static VOID PMS_DVFS_Governor_Task_Entry(UNSIGNED argc, VOID *argv)
+{
+    STATUS    status;
+    UNSIGNED  events;
+    UINT32    total_time;
+    UINT32    idle_time;
+    UINT32    last_total_time = 0;
+    UINT32    last_idle_time = 0;
+    UINT32    total_delta;
+    UINT32    idle_delta;
+    UINT8     down_samples = 0;
+    UINT8     highest_op;
+    UINT8     current_op;
+    UINT8     new_op;
+    UINT8     held_op;
+    INT       old_level;
+
+    NU_UNUSED_PARAM(argc);
+    NU_UNUSED_PARAM(argv);
+
+    for (;;)
+    {
+        /* Wait for a hold or the end of the period */
+        status = NU_Retrieve_Events(&PMS_Governor_Events, PM_GOVERNOR_HOLD_EVENT,
+                                    NU_OR_CONSUME, &events, PM_GOVERNOR_PERIOD);
+
+        /* Nothing can be done until DVFS is initialized */
+        if (PMS_DVFS_Status_Check() != NU_SUCCESS)
+        {
+            continue;
+        }
+
+        highest_op = PM_DVFS_OP_Count - 1;
+        current_op = PM_DVFS_Current_OP;
+        new_op = current_op;
+
+        if ((status == NU_TIMEOUT) &&
+            (NU_PM_Get_CPU_Counters(&total_time, &idle_time) == NU_SUCCESS))
+        {
+            total_delta = total_time - last_total_time;
+            idle_delta = idle_time - last_idle_time;
+            last_total_time = total_time;
+            last_idle_time = idle_time;
+
+            if ((total_delta != 0) && (idle_delta <= total_delta))
+            {
+                /* Scale the counts so the percentage cannot overflow */
+                while (total_delta > (0xFFFFFFFFUL / 100))
+                {
+                    total_delta >>= 8;
+                    idle_delta >>= 8;
+                }
+
+                if (total_delta != 0)
+                {
+                    PMS_Governor_Info.pm_load = (UINT8)(100 - ((idle_delta * 100) / total_delta));
+                }
+            }
+
+            if (PMS_Governor_Enabled == NU_TRUE)
+            {
+                /* The startup OP is above all of the OPs */
+                if (new_op > highest_op)
+                {
+                    new_op = highest_op;
+                }
+
+                if (PMS_Governor_Info.pm_load >= PMS_Governor_Up_Threshold)
+                {
+                    /* Go straight to the highest OP, a busy system
+                       should not climb one OP at a time */
+                    new_op = highest_op;
+                    down_samples = 0;
+                }
+                else if (PMS_Governor_Info.pm_load <= PMS_Governor_Down_Threshold)
+                {
+                    /* Step down once the load has stayed low */
+                    if (++down_samples >= PM_GOVERNOR_DOWN_SAMPLES)
+                    {
+                        if (new_op > 0)
+                        {
+                            new_op--;
+                        }
+
+                        down_samples = 0;
+                    }
+                }
+                else
+                {
+                    down_samples = 0;
+                }
+            }
+        }
+
+        /* Never go below an OP held by a driver */
+        old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+        held_op = PMS_DVFS_Governor_Held_OP();
+        (VOID)NU_Local_Control_Interrupts(old_level);
+
+        if (held_op > highest_op)
+        {
+            held_op = highest_op;
+        }
+
+        if (new_op < held_op)
+        {
+            new_op = held_op;
+        }
+
+        /* Never go below the minimum OP requested by applications.
+           While disabled the OP is left alone apart from holds. */
+        if ((PMS_Governor_Enabled == NU_TRUE) && (new_op < PM_DVFS_Minimum_OP))
+        {
+            new_op = PM_DVFS_Minimum_OP;
+        }
+
+        if (new_op != current_op)
+        {
+            PMS_DVFS_Governor_Transition(new_op);
+        }
+    }
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       PMS_DVFS_Governor_Held_OP
+*
+*   DESCRIPTION
+*
+*       This function returns the highest held OP.  Interrupts must be
+*       locked out by the caller.
+*
+*   INPUT
+*
+*       None
+*
+*   OUTPUT
+*
+*       Highest held OP, 0 if no OP is held
+*
+*************************************************************************/
+static UINT8 PMS_DVFS_Governor_Held_OP(VOID)
+{
+    UINT8     op_id = PM_GOVERNOR_MAX_HOLD_OPS - 1;
+    UINT32    held_mask = PMS_Governor_Held_Mask;
+
+    if (held_mask == 0)
+    {
+        op_id = 0;
+    }
+    else
+    {
+        /* Find the highest set bit */
+        while ((held_mask & (1UL << op_id)) == 0)
+        {
+            op_id--;
+        }
+    }
+
+    return (op_id);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       PMS_DVFS_Governor_Transition
+*
+*   DESCRIPTION
+*
+*       This function changes the OP and accounts for the time taken by
+*       the change.  The time includes parking and resuming the drivers.
+*
+*   INPUT
+*
+*       op_id               New OP
+*
+*   OUTPUT
+*
+*       None
+*
+*************************************************************************/
+static VOID PMS_DVFS_Governor_Transition(UINT8 op_id)
+{
+    STATUS    status;
+    UINT64    start;
+    UINT32    elapsed;
+    INT       old_level;
+
+    start = NU_Get_Time_Stamp();
+
+    status = NU_PM_Set_Current_OP(op_id);
+
+    /* Convert the hardware timer ticks to microseconds */
+    elapsed = (UINT32)(((NU_Get_Time_Stamp() - start) * 1000000UL) / NU_HW_TIMER_TICKS_PER_SEC);
+
+    old_level = NU_Local_Control_Interrupts(NU_DISABLE_INTERRUPTS);
+
+    if (status == NU_SUCCESS)
+    {
+        PMS_Governor_Info.pm_transitions++;
+    }
+    else
+    {
+        /* A busy device or a transition lockout refused the change */
+        PMS_Governor_Info.pm_failed_transitions++;
+    }
+
+    PMS_Governor_Info.pm_last_transition_time = elapsed;
+    PMS_Governor_Info.pm_total_transition_time += elapsed;
+
+    if (elapsed > PMS_Governor_Info.pm_max_transition_time)
+    {
+        PMS_Governor_Info.pm_max_transition_time = elapsed;
+    }
+
+    (VOID)NU_Local_Control_Interrupts(old_level);
+}
+
+#endif  /* (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_GOVERNOR == NU_TRUE) */
@@ -88,6 +88,11 @@ STATUS PMS_DVFS_Pre_Initialize(NU_MEMORY_POOL* mem_pool_ptr);
 VOID PMS_DVFS_Post_Initialize(NU_MEMORY_POOL* mem_pool_ptr);
 #endif
 
+#if (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_GOVERNOR == NU_TRUE)
+/* Initialization function prototype for the DVFS governor */
+STATUS PMS_DVFS_Governor_Initialize(NU_MEMORY_POOL* mem_pool_ptr);
+#endif
+
 #if ((CFG_NU_OS_SVCS_PWR_CORE_ENABLE_PERIPHERAL == NU_TRUE) || (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_SYSTEM == NU_TRUE))
 /* Initialization function prototypes for peripherals */
 VOID PMS_Peripheral_Initialize(NU_MEMORY_POOL* mem_pool);
@@ -188,6 +193,14 @@ VOID NU_PM_Initialize(NU_MEMORY_POOL* mem_pool)
         }
     #endif
 
+    #if (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_GOVERNOR == NU_TRUE)
+        /* Call the initialization for the DVFS governor */
+        if (pm_status == NU_SUCCESS)
+        {
+            pm_status = PMS_Component_Initialize(mem_pool, PMS_DVFS_Governor_Initialize, NU_NULL, "GOVERN");
+        }
+    #endif
+
     #if ((CFG_NU_OS_SVCS_PWR_CORE_ENABLE_PERIPHERAL == NU_TRUE) || (CFG_NU_OS_SVCS_PWR_CORE_ENABLE_SYSTEM == NU_TRUE))
         /* Call the initialization for Peripherals */
         if (pm_status == NU_SUCCESS)
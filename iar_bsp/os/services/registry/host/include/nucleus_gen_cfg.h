@@ -0,0 +1,97 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       nucleus_gen_cfg.h
+*
+*   DESCRIPTION
+*
+*       This file contains the configuration of the host (Linux) build
+*       of the registry benchmark.  It takes the place of the file
+*       generated by the build system for a target.  The kernel options
+*       are those of the eth_spi_bridge configuration.  The hash index
+*       option is selected by the makefile.
+*
+*   DATA STRUCTURES
+*
+*       None
+*
+*   DEPENDENCIES
+*
+*       None
+*
+***********************************************************************/
+
+#ifndef NUCLEUS_GEN_CFG_H
+#define NUCLEUS_GEN_CFG_H
+
+/* Kernel */
+#define CFG_NU_OS_KERN_DEVMGR_ENABLE
+#define CFG_NU_OS_KERN_EQM_ENABLE
+#define CFG_NU_OS_KERN_PLUS_CORE_ENABLE
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_ENABLE
+#define CFG_NU_OS_KERN_RTL_ENABLE
+#define CFG_NU_OS_KERN_DEVMGR_DISCOVERY_TASK_ENABLE 1
+#define CFG_NU_OS_KERN_DEVMGR_DISCOVERY_TASK_MAX_ID_CNT 30
+#define CFG_NU_OS_KERN_DEVMGR_DISCOVERY_TASK_STACK_SIZE 10240
+#define CFG_NU_OS_KERN_DEVMGR_ERR_CHECK_ENABLE 1
+#define CFG_NU_OS_KERN_DEVMGR_EXPORT_SYMBOLS 1
+#define CFG_NU_OS_KERN_DEVMGR_HIBERNATE_DEV 1
+#define CFG_NU_OS_KERN_DEVMGR_MAX_DEV_ID_CNT 30
+#define CFG_NU_OS_KERN_DEVMGR_MAX_DEV_LABEL_CNT 5
+#define CFG_NU_OS_KERN_DEVMGR_MAX_DEV_SESSION_CNT 3
+#define CFG_NU_OS_KERN_DEVMGR_MAX_DEVICE_LISTENERS 15
+#define CFG_NU_OS_KERN_PLUS_CORE_ASSERT 0
+#define CFG_NU_OS_KERN_PLUS_CORE_AUTO_CLEAR_CB 1
+#define CFG_NU_OS_KERN_PLUS_CORE_DEBUG_SCHED_LOCK 0
+#define CFG_NU_OS_KERN_PLUS_CORE_ERROR_CHECKING 1
+#define CFG_NU_OS_KERN_PLUS_CORE_ERROR_STRING 0
+#define CFG_NU_OS_KERN_PLUS_CORE_EXPORT_SYMBOLS 1
+#define CFG_NU_OS_KERN_PLUS_CORE_GLOBAL_INT_LOCKING 0
+#define CFG_NU_OS_KERN_PLUS_CORE_INLINING 0
+#define CFG_NU_OS_KERN_PLUS_CORE_LV_TIMEOUT 0
+#define CFG_NU_OS_KERN_PLUS_CORE_MIN_RAM 0
+#define CFG_NU_OS_KERN_PLUS_CORE_MIN_STACK_SIZE 250
+#define CFG_NU_OS_KERN_PLUS_CORE_NUM_TASK_PRIORITIES 256
+#define CFG_NU_OS_KERN_PLUS_CORE_ROM_SUPPORT 0
+#define CFG_NU_OS_KERN_PLUS_CORE_ROM_TO_RAM_COPY 0
+#define CFG_NU_OS_KERN_PLUS_CORE_STACK_CHECKING 0
+#define CFG_NU_OS_KERN_PLUS_CORE_STACK_FILL 0
+#define CFG_NU_OS_KERN_PLUS_CORE_TICK_SUPPRESSION 0
+#define CFG_NU_OS_KERN_PLUS_CORE_TICKS_PER_SEC 100
+#define CFG_NU_OS_KERN_PLUS_CORE_TIMER_HISR_STACK_SIZE 2048
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_EVT_NOTIFY 1
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_EXPORT_SYMBOLS 1
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_PLUS_OBJECT_LISTS 0
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_STATIC_TEST 0
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_TIME_TEST1MAX 0
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_TIME_TEST1MIN 0
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_TIME_TEST2 0
+#define CFG_NU_OS_KERN_PLUS_SUPPLEMENT_TIME_TEST3 0
+#define CFG_NU_OS_KERN_RTL_EXPORT_SYMBOLS 1
+#define CFG_NU_OS_KERN_RTL_FP_OVERRIDE 0
+#define CFG_NU_OS_KERN_RTL_HEAP_SIZE 512
+#define CFG_NU_OS_KERN_RTL_MALLOC_POOL 0
+#define CFG_NU_OS_KERN_PLUS_CORE_TLSF_POOLS 1
+#define CFG_NU_OS_KERN_PLUS_CORE_CPU_ACCOUNTING 1
+#define CFG_NU_OS_KERN_PLUS_CORE_POINTER_QUEUES 1
+#define CFG_NU_OS_KERN_PLUS_CORE_SPSC_RINGS 1
+
+/* Registry */
+#define CFG_NU_OS_SVCS_REGISTRY_ENABLE
+#define CFG_NU_OS_SVCS_REGISTRY_EXPORT_SYMBOLS 0
+#define CFG_NU_OS_SVCS_REGISTRY_MAX_KEY_LEN 64
+#define CFG_NU_OS_SVCS_REGISTRY_HASH_INDEX REGBENCH_HASH_INDEX
+
+#endif  /* NUCLEUS_GEN_CFG_H */
@@ -0,0 +1,61 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       regbench.h
+*
+*   DESCRIPTION
+*
+*       This file contains the definitions shared by the registry
+*       benchmark and the registry generated for it by regtree.rb.
+*
+*   DATA STRUCTURES
+*
+*       REGBENCH_OPTION                     Registered option
+*       REGBENCH_COMPONENT                  Component started during
+*                                           system initialization
+*
+*   DEPENDENCIES
+*
+*       nucleus.h
+*
+***********************************************************************/
+
+#ifndef REGBENCH_H
+#define REGBENCH_H
+
+#include "nucleus.h"
+
+/* A registered option of a component, and whether its value is a string
+   rather than a number */
+typedef struct REGBENCH_OPTION_STRUCT
+{
+    const CHAR *                key;
+    BOOLEAN                     is_string;
+
+} REGBENCH_OPTION;
+
+/* A component started during system initialization and the keys of the
+   registered options it reads when it is started */
+typedef struct REGBENCH_COMPONENT_STRUCT
+{
+    const CHAR *                path;
+    const REGBENCH_OPTION *     options;
+
+} REGBENCH_COMPONENT;
+
+/* Components of the generated registry, ended by an entry with no path */
+extern const REGBENCH_COMPONENT Regbench_Components[];
+
+#endif  /* REGBENCH_H */
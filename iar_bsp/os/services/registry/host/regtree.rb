@@ -0,0 +1,224 @@
+##----------------------------------------------------------------------------##
+# Copyright 2010 Mentor Graphics Corporation                                   #
+#    All Rights Reserved.                                                      #
+##----------------------------------------------------------------------------##
+
+# Generates the memory registry of a configuration for the host build of
+# the registry benchmark:
+#
+#     ruby regtree.rb <config> <platform file> <metadata root>... > file.c
+#
+# The components and devices enabled in the configuration, their run-levels
+# and their registered options are entered in the registry the way the
+# RegistryInitTransform of the build tools enters them, and written in the
+# same REG_Memory_Node tables.  Entry points are not linked, so each one is
+# a non-zero placeholder.  The key paths of the registered options of each
+# component are also written, so the benchmark can read them as the
+# component would when it is started.
+
+require 'find'
+
+# An object declared by a .metadata or .platform file: a platform,
+# component, device, option group or option.
+class MetaNode
+   attr_reader :kind, :name, :attrs, :children
+
+   def initialize(kind, name)
+      @kind = kind
+      @name = name
+      @attrs = {}
+      @children = []
+   end
+
+   def method_missing(sym, *args, &blk)
+      case sym
+      when :platform, :component, :device, :group, :option
+         if blk and args.length == 1
+            child = MetaNode.new(sym, args[0].to_s)
+            child.instance_eval(&blk)
+            @children << child
+         elsif sym == :option and args[0].is_a? Hash
+            # Platform option overrides
+            args[0].each { |key, value| (@attrs[:overrides] ||= {})[key] = value }
+         end
+      when :hardware
+         instance_eval(&blk) if blk
+      when :library, :sources, :includepath, :defines, :requires
+         # Build information only
+      else
+         @attrs[sym] = (args.length == 0) ? true : ((args.length == 1) ? args[0] : args)
+      end
+      nil
+   end
+
+   def respond_to_missing?(sym, priv = false)
+      true
+   end
+
+   # Options whose values are registered, with their names relative to
+   # this object.
+   def registered_options(prefix = "", inherited = false)
+      list = []
+      @children.each { |child|
+         if child.kind == :option
+            if inherited or child.attrs[:enregister] == true
+               list << [prefix + child.name, child.attrs[:default]]
+            end
+         elsif child.kind == :group
+            list += child.registered_options(prefix + child.name + ".",
+                                             inherited || (child.attrs[:enregister] == true))
+         end
+      }
+      list
+   end
+end
+
+# Evaluates a .metadata or .platform file, returning its top-level objects.
+def load_meta(path)
+   top = MetaNode.new(:file, path)
+   begin
+      top.instance_eval(File.read(path, :encoding => "ISO-8859-1").encode("UTF-8"), path)
+   rescue Exception => e
+      $stderr.puts "regtree: #{path} skipped (#{e.message.lines.first.strip})"
+   end
+   top.children
+end
+
+config_file, platform_file, *meta_roots = ARGV
+if meta_roots.empty?
+   abort "usage: ruby regtree.rb <config> <platform file> <metadata root>..."
+end
+
+# The configuration: enabled objects and option values
+config = {}
+File.readlines(config_file).each { |line|
+   next if line =~ /^\s*#/
+   if line =~ /^\s*([\w.]+)\s*=\s*(.*?)\s*$/
+      value = $2
+      value = true if value == "true"
+      value = false if value == "false"
+      value = Integer(value) rescue value if value.is_a? String
+      config[$1] = value
+   end
+}
+
+def enabled?(config, name)
+   config[name + ".enable"] == true
+end
+
+# Components declared under the metadata roots, by full name
+components = {}
+meta_roots.each { |meta_root|
+   Find.find(meta_root) { |path|
+      next unless File.basename(path) == ".metadata"
+      load_meta(path).each { |c|
+         next unless c.kind == :component
+         full = c.attrs[:parent] ? "#{c.attrs[:parent]}.#{c.name}" : c.name
+         components[full] = c
+      }
+   }
+}
+
+# Devices of the platform, by full name
+platform = load_meta(platform_file).find { |p| p.kind == :platform }
+devices = {}
+if platform
+   platform.children.each { |d|
+      devices["#{platform.name}.#{d.name}"] = d if d.kind == :device
+   }
+end
+
+registry = { "init" => {} }
+runlevels = Hash.new(0)
+started = []
+
+def update_registry(registry, key, value)
+   h = registry
+   subkeys = key.split(".")
+   subkeys[0..-2].each { |name| h = (h[name] ||= {}) }
+   h[subkeys[-1]] = value
+end
+
+# Components and devices in name order, as the build tools visit them
+(components.keys.sort.map { |n| [n, components[n]] } +
+ devices.keys.sort.map { |n| [n, devices[n]] }).each { |full, obj|
+   next unless enabled?(config, full)
+
+   if obj.attrs[:runlevel] and obj.attrs[:active_artifact] != "process"
+      runlevel = obj.attrs[:runlevel].to_i
+      runlevels[runlevel] += 1
+      update_registry(registry, "init.#{runlevel}.#{runlevels[runlevel]}",
+                      "/" + full.gsub(".", "/"))
+      update_registry(registry, full + ".entrypoint", :entry)
+   end
+
+   options = []
+   obj.registered_options.each { |name, default|
+      key = "#{full}.#{name}"
+      value = config.has_key?(key) ? config[key] : default
+      update_registry(registry, key, value)
+      options << ["/" + key.gsub(".", "/"), value.is_a?(String)]
+   }
+
+   if obj.attrs[:runlevel]
+      started << ["/" + full.gsub(".", "/"), options]
+   end
+}
+
+# Order the run-level tables as the build tools do, by run-level
+registry["init"] = Hash[registry["init"].sort_by { |k, v| k.to_i }]
+
+def c_string(str)
+   "\"" + str.to_s.gsub("\\", "\\\\\\\\").gsub("\"", "\\\"").gsub("\n", " ") + "\""
+end
+
+def c_value(value)
+   case value
+   when :entry then "(UNSIGNED_CHAR *) 1"
+   when true then "(UNSIGNED_CHAR *) 1"
+   when false, nil then "(UNSIGNED_CHAR *) 0"
+   when Integer then "(UNSIGNED_CHAR *) #{value}"
+   else "(UNSIGNED_CHAR *) #{c_string(value)}"
+   end
+end
+
+def gen_nodes(out, name, h)
+   entries = []
+   h.each_with_index { |(key, value), index|
+      last = (index == h.length - 1)
+      if value.is_a? Hash
+         gen_nodes(out, name + "_" + key, value)
+         entries << "{ #{c_string(key)}, { #{last ? '(UNSIGNED_CHAR *)0xDEADBEEF' : '0'} }, &reg_#{name}_#{key}[0] }"
+      else
+         entries << "{ #{c_string(key)}, { #{c_value(value)} }, #{last ? '(REG_Memory_Node *)0xDEADBEEF' : 'NU_NULL'} }"
+      end
+   }
+   entries << "{ NU_NULL, { (UNSIGNED_CHAR *)0xDEADBEEF }, (REG_Memory_Node *)0xDEADBEEF }" if entries.empty?
+   out.puts "static REG_Memory_Node reg_#{name}[] = {"
+   out.puts entries.map { |e| "\t" + e }.join(",\n")
+   out.puts "};"
+end
+
+out = $stdout
+out.puts "/* Generated by regtree.rb from #{File.basename(config_file)}. */"
+out.puts "#include \"nucleus.h\""
+out.puts "#include \"services/reg_impl_mem_node.h\""
+out.puts "#include \"regbench.h\""
+out.puts
+gen_nodes(out, "root", registry)
+out.puts
+out.puts "REG_Memory_Node *root = (REG_Memory_Node *)&reg_root;"
+out.puts
+started.each_with_index { |(path, options), index|
+   out.puts "static const REGBENCH_OPTION regbench_options_#{index}[] = {"
+   options.each { |key, is_string| out.puts "\t{ #{c_string(key)}, #{is_string ? 'NU_TRUE' : 'NU_FALSE'} }," }
+   out.puts "\t{ NU_NULL, NU_FALSE }"
+   out.puts "};"
+}
+out.puts
+out.puts "const REGBENCH_COMPONENT Regbench_Components[] = {"
+started.each_with_index { |(path, options), index|
+   out.puts "\t{ #{c_string(path)}, regbench_options_#{index} },"
+}
+out.puts "\t{ NU_NULL, NU_NULL }"
+out.puts "};"
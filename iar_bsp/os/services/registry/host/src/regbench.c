@@ -0,0 +1,389 @@
+/***********************************************************************
+*
+*             Copyright 2010 Mentor Graphics Corporation
+*                         All Rights Reserved.
+*
+* THIS WORK CONTAINS TRADE SECRET AND PROPRIETARY INFORMATION WHICH IS
+* THE PROPERTY OF MENTOR GRAPHICS CORPORATION OR ITS LICENSORS AND IS
+* SUBJECT TO LICENSE TERMS.
+*
+************************************************************************
+
+************************************************************************
+*
+*   FILE NAME
+*
+*       regbench.c
+*
+*   COMPONENT
+*
+*       REGBENCH - Host Registry Benchmark
+*
+*   DESCRIPTION
+*
+*       This file contains the registry benchmark of the host build.  It
+*       replays the registry lookups of system initialization against
+*       the registry generated by regtree.rb: NU_RunLevel_Init builds the
+*       hash index, then RunLevel_Start reads each run-level entry and
+*       the entry point of its component, and each component reads its
+*       registered options when it is started.  The keys of the first
+*       boot are recorded, and the boots that are timed make only the
+*       recorded lookups.
+*
+*           regbench [boots]
+*
+*       The lookups and key comparisons of one boot, the registry time
+*       of one boot and the time taken to build the index are output,
+*       with a checksum of the values read.  The makefile builds the
+*       benchmark with the hash index and without it, and both must
+*       output the same checksum.
+*
+*   DATA STRUCTURES
+*
+*       RegBench_Pool
+*       RegBench_Keys
+*       RegBench_Key_Count
+*
+*   FUNCTIONS
+*
+*       main
+*       NU_Allocate_Aligned_Memory
+*       RegBench_Time
+*       RegBench_Checksum
+*       RegBench_Record
+*       RegBench_Replay
+*
+*   DEPENDENCIES
+*
+*       stdio.h
+*       stdlib.h
+*       string.h
+*       time.h
+*       nucleus.h
+*       kernel/nu_kernel.h
+*       services/reg_api.h
+*       regbench.h
+*
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nucleus.h"
+#include "kernel/nu_kernel.h"
+#include "services/reg_api.h"
+#include "regbench.h"
+
+/* Number of boots timed by default */
+#define REGBENCH_BOOTS          10000
+
+/* Run-levels of system initialization, as in runlevel.h */
+#define REGBENCH_FIRST_RUNLEVEL 1
+#define REGBENCH_LAST_RUNLEVEL  31
+
+/* Most lookups recorded from one boot */
+#define REGBENCH_MAX_KEYS       2048
+
+/* A key looked up during the boot, and whether its value is read as a
+   string */
+typedef struct _REGBENCH_KEY
+{
+    CHAR        key[REG_MAX_KEY_LENGTH];
+    BOOLEAN     is_string;
+} REGBENCH_KEY;
+
+/* The pool the index is allocated from.  Only its address is used. */
+STATIC NU_MEMORY_POOL   RegBench_Pool;
+
+/* The keys looked up during the boot, in order */
+STATIC REGBENCH_KEY     RegBench_Keys[REGBENCH_MAX_KEYS];
+STATIC UINT32           RegBench_Key_Count;
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       NU_Allocate_Aligned_Memory
+*
+*   DESCRIPTION
+*
+*       This function allocates memory from the C library for the
+*       registry index.
+*
+*   INPUTS
+*
+*       pool_ptr                Pointer to the memory pool.
+*       return_pointer          Where the memory is returned.
+*       size                    Size of the memory in bytes.
+*       alignment               Alignment of the memory.
+*       suspend                 Not used.
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS              The memory was allocated.
+*       NU_NO_MEMORY            The memory was not available.
+*
+***********************************************************************/
+STATUS NU_Allocate_Aligned_Memory(NU_MEMORY_POOL *pool_ptr,
+                                  VOID **return_pointer, UNSIGNED size,
+                                  UNSIGNED alignment, UNSIGNED suspend)
+{
+    NU_UNUSED_PARAM(pool_ptr);
+    NU_UNUSED_PARAM(alignment);
+    NU_UNUSED_PARAM(suspend);
+
+    *return_pointer = malloc(size);
+
+    return ((*return_pointer != NU_NULL) ? NU_SUCCESS : NU_NO_MEMORY);
+
+} /* NU_Allocate_Aligned_Memory */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       RegBench_Time
+*
+*   DESCRIPTION
+*
+*       This function returns a free running time stamp.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       The monotonic time in nanoseconds.
+*
+***********************************************************************/
+STATIC UINT64 RegBench_Time(VOID)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((UINT64)now.tv_sec * 1000000000ULL + (UINT64)now.tv_nsec);
+
+} /* RegBench_Time */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       RegBench_Checksum
+*
+*   DESCRIPTION
+*
+*       This function adds a string to a checksum.
+*
+*   INPUTS
+*
+*       checksum                The checksum.
+*       str                     The string.
+*
+*   OUTPUTS
+*
+*       The new checksum.
+*
+***********************************************************************/
+STATIC UINT32 RegBench_Checksum(UINT32 checksum, const CHAR *str)
+{
+    while (*str != '\0')
+        checksum = (checksum * 31) + (UINT8)*str++;
+
+    return (checksum);
+
+} /* RegBench_Checksum */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       RegBench_Record
+*
+*   DESCRIPTION
+*
+*       This function makes the registry lookups of one system
+*       initialization and records their keys.  Each run-level entry is
+*       read until one is not found, as RunLevel_Start does.  The entry
+*       point of the component of each entry is read, as
+*       NU_RunLevel_Component_Control does, and then each registered
+*       option of the component.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       A checksum of the values read.
+*
+***********************************************************************/
+STATIC UINT32 RegBench_Record(VOID)
+{
+    CHAR                        comppath[REG_MAX_KEY_LENGTH];
+    CHAR                        str[REG_MAX_KEY_LENGTH];
+    const REGBENCH_COMPONENT    *component;
+    const REGBENCH_OPTION       *option;
+    REGBENCH_KEY                *key;
+    UINT32                      value;
+    UINT32                      checksum = 0;
+    INT                         runlevel;
+    INT                         entrynum;
+
+    for (runlevel = REGBENCH_FIRST_RUNLEVEL;
+         runlevel <= REGBENCH_LAST_RUNLEVEL;
+         runlevel ++)
+    {
+        for (entrynum = 1; (RegBench_Key_Count + 2) <= REGBENCH_MAX_KEYS; entrynum ++)
+        {
+            key = &RegBench_Keys[RegBench_Key_Count++];
+            sprintf(key->key, "/init/%d/%d", runlevel, entrynum);
+            key->is_string = NU_TRUE;
+
+            if (REG_Get_String(key->key, comppath, REG_MAX_KEY_LENGTH) != NU_SUCCESS)
+                break;
+
+            checksum = RegBench_Checksum(checksum, comppath);
+
+            key = &RegBench_Keys[RegBench_Key_Count++];
+            strcpy(key->key, comppath);
+            strcat(key->key, "/entrypoint");
+            key->is_string = NU_FALSE;
+
+            if (REG_Get_UINT32(key->key, &value) == NU_SUCCESS)
+                checksum = (checksum * 31) + value;
+
+            /* The component reads its options when it is started */
+            for (component = Regbench_Components;
+                 (component->path != NU_NULL) &&
+                 (strcmp(component->path, comppath) != 0);
+                 component ++)
+                ;
+
+            if (component->path == NU_NULL)
+                continue;
+
+            for (option = component->options;
+                 (option->key != NU_NULL) &&
+                 (RegBench_Key_Count < REGBENCH_MAX_KEYS);
+                 option ++)
+            {
+                key = &RegBench_Keys[RegBench_Key_Count++];
+                strcpy(key->key, option->key);
+                key->is_string = option->is_string;
+
+                if (option->is_string)
+                {
+                    if (REG_Get_String(key->key, str, REG_MAX_KEY_LENGTH) == NU_SUCCESS)
+                        checksum = RegBench_Checksum(checksum, str);
+                }
+                else if (REG_Get_UINT32(key->key, &value) == NU_SUCCESS)
+                    checksum = (checksum * 31) + value;
+            }
+        }
+    }
+
+    return (checksum);
+
+} /* RegBench_Record */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       RegBench_Replay
+*
+*   DESCRIPTION
+*
+*       This function makes the recorded registry lookups again.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+STATIC VOID RegBench_Replay(VOID)
+{
+    CHAR        str[REG_MAX_KEY_LENGTH];
+    UINT32      value;
+    UINT32      index;
+
+    for (index = 0; index < RegBench_Key_Count; index ++)
+    {
+        if (RegBench_Keys[index].is_string)
+            (VOID)REG_Get_String(RegBench_Keys[index].key, str, REG_MAX_KEY_LENGTH);
+        else
+            (VOID)REG_Get_UINT32(RegBench_Keys[index].key, &value);
+    }
+
+} /* RegBench_Replay */
+
+/***********************************************************************
+*
+*   FUNCTION
+*
+*       main
+*
+*   DESCRIPTION
+*
+*       This function builds the index and times the boots.
+*
+*   INPUTS
+*
+*       argc                    Number of arguments.
+*       argv                    The arguments.
+*
+*   OUTPUTS
+*
+*       0
+*
+***********************************************************************/
+int main(int argc, char *argv[])
+{
+    UINT32  boots = REGBENCH_BOOTS;
+    UINT32  boot;
+    UINT32  checksum;
+    UINT32  lookups;
+    UINT32  compares;
+    UINT64  start;
+    UINT64  index_ns;
+    UINT64  boot_ns;
+
+    if (argc > 1)
+        boots = (UINT32)strtoul(argv[1], NU_NULL, 10);
+
+    if (boots == 0)
+        boots = 1;
+
+    /* The index is built once, before the first component starts */
+    start = RegBench_Time();
+    (VOID)REG_Index_Initialize(&RegBench_Pool);
+    index_ns = RegBench_Time() - start;
+
+    checksum = RegBench_Record();
+    REG_Get_Lookup_Counts(&lookups, &compares);
+
+    start = RegBench_Time();
+
+    for (boot = 0; boot < boots; boot ++)
+        RegBench_Replay();
+
+    boot_ns = (RegBench_Time() - start) / boots;
+
+    printf("%-6s  lookups %5lu  key compares %6lu  boot %7lu ns  index build %7lu ns  checksum %08lx\n",
+           (CFG_NU_OS_SVCS_REGISTRY_HASH_INDEX == NU_TRUE) ? "index" : "walk",
+           (unsigned long)lookups, (unsigned long)compares,
+           (unsigned long)boot_ns, (unsigned long)index_ns,
+           (unsigned long)checksum);
+
+    return (0);
+
+} /* main */
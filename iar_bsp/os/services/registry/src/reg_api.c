@@ -48,6 +48,19 @@
 *       REG_Get_Bytes_Value
 *       REG_Set_Bytes_Value
 *       REG_Set_Writable_Value
+*       REG_Open_Key_Value
+*       REG_Get_Boolean_Handle
+*       REG_Set_Boolean_Handle
+*       REG_Get_UINT8_Handle
+*       REG_Set_UINT8_Handle
+*       REG_Get_UINT16_Handle
+*       REG_Set_UINT16_Handle
+*       REG_Get_UINT32_Handle
+*       REG_Set_UINT32_Handle
+*       REG_Get_String_Handle
+*       REG_Set_String_Handle
+*       REG_Get_Bytes_Handle
+*       REG_Set_Bytes_Handle
 *
 *   DEPENDENCIES
 *
@@ -115,6 +128,40 @@ STATUS func_name (const CHAR *key, const CHAR *sub_key, value_type value, UINT l
     return (status);                                                                        \
 }
 
+/* Handle functions.  Scalar values are held in a UINT32 by the
+   implementation. */
+#define DEF_HANDLE_GET_FUNC(func_name, value_type)                                          \
+STATUS func_name (REG_HANDLE handle, value_type *value)                                     \
+{                                                                                           \
+    STATUS  status;                                                                         \
+    UINT32  temp;                                                                           \
+                                                                                            \
+                                                                                            \
+    status = impl->REG_Get_Handle_Value(handle, (UNSIGNED_CHAR*)&temp, sizeof(UINT32));     \
+                                                                                            \
+    if (status == NU_SUCCESS)                                                               \
+    {                                                                                       \
+        *value = (value_type)temp;                                                          \
+    }                                                                                       \
+                                                                                            \
+    return (status);                                                                        \
+}
+
+#define DEF_HANDLE_SET_FUNC(func_name, value_type)                                          \
+STATUS func_name (REG_HANDLE handle, value_type value)                                      \
+{                                                                                           \
+    UINT32  temp = (UINT32)value;                                                           \
+                                                                                            \
+                                                                                            \
+    return impl->REG_Set_Handle_Value(handle, (const UNSIGNED_CHAR*)&temp, sizeof(UINT32)); \
+}
+
+#define DEF_HANDLE_FUNC3(func_name, impl_name, value_type, impl_type)                       \
+STATUS func_name (REG_HANDLE handle, value_type value, UINT length)                         \
+{                                                                                           \
+    return impl-> impl_name (handle, (impl_type)value, length);                             \
+}
+
 
 /*************************************************************************
 *
@@ -519,3 +566,326 @@ DEF_IMPL_FUNC3(REG_Set_Bytes_Value, const UNSIGNED_CHAR*)
 *************************************************************************/
 DEF_IMPL_FUNC2(REG_Set_Writable_Value, BOOLEAN)
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Open_Key_Value
+*
+*   DESCRIPTION
+*
+*       This function looks up a key once and returns a handle through
+*       which its value may be read and written without looking up the
+*       key string again.
+*
+*   INPUT
+*
+*       key - the key being opened.
+*       sub_key - optional key appended to key, or NU_NULL.
+*       handle - destination for the handle of the key.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the key was opened successfully.
+*       REG_BAD_PATH - a bad key path was given.
+*
+*************************************************************************/
+DEF_IMPL_FUNC2(REG_Open_Key_Value, REG_HANDLE*)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Get_Boolean_Handle
+*
+*   DESCRIPTION
+*
+*       This function gets the boolean value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value associated with the key.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was read successfully.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_GET_FUNC(REG_Get_Boolean_Handle, BOOLEAN)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Set_Boolean_Handle
+*
+*   DESCRIPTION
+*
+*       This function sets the boolean value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value to associate with the key.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was written successfully.
+*       REG_NOT_WRITABLE - the key is not writable.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_SET_FUNC(REG_Set_Boolean_Handle, BOOLEAN)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Get_UINT8_Handle
+*
+*   DESCRIPTION
+*
+*       This function gets the UINT8 value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value associated with the key.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was read successfully.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_GET_FUNC(REG_Get_UINT8_Handle, UINT8)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Set_UINT8_Handle
+*
+*   DESCRIPTION
+*
+*       This function sets the UINT8 value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value to associate with the key.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was written successfully.
+*       REG_NOT_WRITABLE - the key is not writable.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_SET_FUNC(REG_Set_UINT8_Handle, UINT8)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Get_UINT16_Handle
+*
+*   DESCRIPTION
+*
+*       This function gets the UINT16 value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value associated with the key.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was read successfully.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_GET_FUNC(REG_Get_UINT16_Handle, UINT16)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Set_UINT16_Handle
+*
+*   DESCRIPTION
+*
+*       This function sets the UINT16 value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value to associate with the key.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was written successfully.
+*       REG_NOT_WRITABLE - the key is not writable.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_SET_FUNC(REG_Set_UINT16_Handle, UINT16)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Get_UINT32_Handle
+*
+*   DESCRIPTION
+*
+*       This function gets the UINT32 value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value associated with the key.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was read successfully.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_GET_FUNC(REG_Get_UINT32_Handle, UINT32)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Set_UINT32_Handle
+*
+*   DESCRIPTION
+*
+*       This function sets the UINT32 value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value to associate with the key.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was written successfully.
+*       REG_NOT_WRITABLE - the key is not writable.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_SET_FUNC(REG_Set_UINT32_Handle, UINT32)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Get_String_Handle
+*
+*   DESCRIPTION
+*
+*       This function gets the string value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value associated with the key.
+*       length - the length of the 'value' buffer.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was read successfully.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_FUNC3(REG_Get_String_Handle, REG_Get_Handle_Bytes, CHAR*, UNSIGNED_CHAR*)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Set_String_Handle
+*
+*   DESCRIPTION
+*
+*       This function sets the string value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value to associate with the key.
+*       length - the length of the 'value' buffer.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was written successfully.
+*       REG_NOT_WRITABLE - the key is not writable.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_FUNC3(REG_Set_String_Handle, REG_Set_Handle_Bytes, const CHAR*, const UNSIGNED_CHAR*)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Get_Bytes_Handle
+*
+*   DESCRIPTION
+*
+*       This function gets the byte array value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value associated with the key.
+*       length - the length of the 'value' buffer.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was read successfully.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_FUNC3(REG_Get_Bytes_Handle, REG_Get_Handle_Bytes, UNSIGNED_CHAR*, UNSIGNED_CHAR*)
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Set_Bytes_Handle
+*
+*   DESCRIPTION
+*
+*       This function sets the byte array value of an opened key.
+*
+*   INPUT
+*
+*       handle - the handle returned by REG_Open_Key.
+*       value - the value to associate with the key.
+*       length - the length of the 'value' buffer.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the value was written successfully.
+*       REG_NOT_WRITABLE - the key is not writable.
+*       REG_BAD_PATH - a bad handle was given.
+*
+*************************************************************************/
+DEF_HANDLE_FUNC3(REG_Set_Bytes_Handle, REG_Set_Handle_Bytes, const UNSIGNED_CHAR*, const UNSIGNED_CHAR*)
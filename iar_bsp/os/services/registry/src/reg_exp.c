@@ -45,5 +45,9 @@ NU_SYMBOL_COMPONENT(NU_OS_SVCS_REGISTRY);
 NU_EXPORT_SYMBOL (REG_Get_UINT32_Value);
 NU_EXPORT_SYMBOL (REG_Get_UINT16_Value);
 NU_EXPORT_SYMBOL (REG_Get_UINT8_Value);
+NU_EXPORT_SYMBOL (REG_Open_Key_Value);
+NU_EXPORT_SYMBOL (REG_Get_UINT32_Handle);
+NU_EXPORT_SYMBOL (REG_Get_UINT16_Handle);
+NU_EXPORT_SYMBOL (REG_Get_UINT8_Handle);
 
 #endif /* CFG_NU_OS_SVCS_REGISTRY_EXPORT_SYMBOLS == NU_TRUE */
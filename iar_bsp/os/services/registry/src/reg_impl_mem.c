@@ -24,12 +24,22 @@
 *       This file contains the implementation functions for getting and setting 
 *       values in a memory based registry. 
 *
+*       A hash index of the full key paths may be built once the system
+*       memory is available, so a key is found without walking the tree.
+*
 *   DATA STRUCTURES
 *
-*       None.
+*       REG_MEMORY_INDEX_ENTRY
 *
 *   FUNCTIONS
 *
+*       REG_Memory_Hash
+*       REG_Memory_Index_Count
+*       REG_Memory_Index_Add
+*       REG_Memory_Index_Find
+*       REG_Memory_Get_Node
+*       REG_Index_Initialize
+*       REG_Get_Lookup_Counts
 *       REG_Memory_Has_Key
 *       REG_Memory_Key_Is_Writable
 *       REG_Memory_Num_Child_Keys
@@ -46,6 +56,11 @@
 *       REG_Memory_Get_Bytes
 *       REG_Memory_Set_Bytes
 *       REG_Memory_Set_Writable
+*       REG_Memory_Open_Key
+*       REG_Memory_Get_Handle_Value
+*       REG_Memory_Set_Handle_Value
+*       REG_Memory_Get_Handle_Bytes
+*       REG_Memory_Set_Handle_Bytes
 *
 *   DEPENDENCIES
 *
@@ -63,6 +78,256 @@
 #include "services/reg_impl.h"
 #include "services/reg_impl_mem_node.h"
 
+/* Check for the last node in a table of the registry tree. */
+#define REG_MEMORY_LAST_NODE(node)                                                         \
+    ((((node)->value.u32 == 0xDEADBEEF) && ((node)->children != (REG_Memory_Node *)NU_NULL)) || \
+     ((node)->children == (REG_Memory_Node *)0xDEADBEEF))
+
+/* Check for a node with a table of child nodes. */
+#define REG_MEMORY_HAS_CHILDREN(node)                                                      \
+    (((node)->children != (REG_Memory_Node *)NU_NULL) &&                                   \
+     ((node)->children != (REG_Memory_Node *)0xDEADBEEF))
+
+/* Number of key lookups and of key comparisons made by the lookups. */
+static UINT32                   REG_Memory_Lookups;
+static UINT32                   REG_Memory_Compares;
+
+#if (CFG_NU_OS_SVCS_REGISTRY_HASH_INDEX == NU_TRUE)
+
+/* FNV-1a hash of the full key path. */
+#define REG_MEMORY_HASH_INIT    2166136261UL
+#define REG_MEMORY_HASH_PRIME   16777619UL
+
+/* Parent of the entries for the top-level nodes. */
+#define REG_MEMORY_NO_PARENT    0xFFFFFFFFUL
+
+/* Entry of the open addressed hash index.  An entry refers to the entry
+   of the parent node, so the full path of a node may be compared against
+   a key without storing it. */
+typedef struct REG_MEMORY_INDEX_ENTRY_STRUCT
+{
+    REG_Memory_Node    *node;               /* Node, NU_NULL if free      */
+    UINT32              hash;               /* Hash of the full key path  */
+    UINT32              parent;             /* Index of the parent entry  */
+} REG_MEMORY_INDEX_ENTRY;
+
+/* The hash index, NU_NULL until REG_Index_Initialize has built it. */
+static REG_MEMORY_INDEX_ENTRY   *REG_Memory_Index = NU_NULL;
+static UINT32                   REG_Memory_Index_Mask;
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Memory_Hash
+*
+*   DESCRIPTION
+*
+*       This function continues the hash of a key path with the given
+*       string.
+*
+*   INPUT
+*
+*       hash - the hash of the key path preceding the string.
+*       str - the string to add to the hash.
+*
+*   OUTPUT
+*
+*       The hash of the key path including the string.
+*
+*************************************************************************/
+static UINT32 REG_Memory_Hash(UINT32 hash, const CHAR *str)
+{
+    while (*str != '\0')
+    {
+        hash = (hash ^ (UINT8)*str++) * REG_MEMORY_HASH_PRIME;
+    }
+
+    return hash;
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Memory_Index_Count
+*
+*   DESCRIPTION
+*
+*       This function returns the number of nodes in a table of the
+*       registry tree and in all tables below it.
+*
+*   INPUT
+*
+*       table - the first node of the table.
+*
+*   OUTPUT
+*
+*       The number of nodes.
+*
+*************************************************************************/
+static UINT32 REG_Memory_Index_Count(REG_Memory_Node *table)
+{
+    REG_Memory_Node *   node = table;
+    UINT32              count = 0;
+
+    while (1)
+    {
+        count++;
+
+        if (REG_MEMORY_HAS_CHILDREN(node))
+        {
+            count += REG_Memory_Index_Count(node->children);
+        }
+
+        if (REG_MEMORY_LAST_NODE(node))
+        {
+            break;
+        }
+
+        node++;
+    }
+
+    return count;
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Memory_Index_Add
+*
+*   DESCRIPTION
+*
+*       This function adds the nodes in a table of the registry tree and
+*       in all tables below it to the hash index.  A node with the same
+*       key as an earlier node of the table is never reached by walking
+*       the tree, so it is left out together with its children.
+*
+*   INPUT
+*
+*       index - the hash index being built.
+*       table - the first node of the table.
+*       parent_hash - the hash of the key path of the parent node.
+*       parent - the index entry of the parent node.
+*
+*   OUTPUT
+*
+*       None.
+*
+*************************************************************************/
+static VOID REG_Memory_Index_Add(REG_MEMORY_INDEX_ENTRY *index,
+                                 REG_Memory_Node *table,
+                                 UINT32 parent_hash, UINT32 parent)
+{
+    REG_Memory_Node *   node = table;
+    UINT32              hash;
+    UINT32              entry;
+
+    while (1)
+    {
+        /* Hash the full key path of the node. */
+        hash = REG_Memory_Hash(REG_Memory_Hash(parent_hash, "/"), node->key);
+
+        /* Find a free entry, unless an earlier node of the table has the
+           same key. */
+        entry = hash & REG_Memory_Index_Mask;
+        while ((index[entry].node != NU_NULL) &&
+               ((index[entry].hash != hash) || (index[entry].parent != parent) ||
+                (strcmp(index[entry].node->key, node->key) != 0)))
+        {
+            entry = (entry + 1) & REG_Memory_Index_Mask;
+        }
+
+        if (index[entry].node == NU_NULL)
+        {
+            index[entry].node = node;
+            index[entry].hash = hash;
+            index[entry].parent = parent;
+
+            if (REG_MEMORY_HAS_CHILDREN(node))
+            {
+                REG_Memory_Index_Add(index, node->children, hash, entry);
+            }
+        }
+
+        if (REG_MEMORY_LAST_NODE(node))
+        {
+            break;
+        }
+
+        node++;
+    }
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Memory_Index_Find
+*
+*   DESCRIPTION
+*
+*       This function looks up a key in the hash index.  The key must
+*       start with '/' and must not end with '/'.
+*
+*   INPUT
+*
+*       key - the key whose node will be looked up.
+*
+*   OUTPUT
+*
+*       !NULL - the address of the tree node associated with the given
+*               key.
+*       NULL  - no node with the given key was found.
+*
+*************************************************************************/
+static REG_Memory_Node* REG_Memory_Index_Find(const CHAR *key)
+{
+    UINT32              hash = REG_Memory_Hash(REG_MEMORY_HASH_INIT, key);
+    UINT32              entry = hash & REG_Memory_Index_Mask;
+    UINT32              parent;
+    size_t              end;
+    size_t              len;
+
+    while (REG_Memory_Index[entry].node != NU_NULL)
+    {
+        if (REG_Memory_Index[entry].hash == hash)
+        {
+            REG_Memory_Compares++;
+
+            /* Compare the key with the path of the node, from the last
+               component back to the first. */
+            end = strlen(key);
+            parent = entry;
+            while (parent != REG_MEMORY_NO_PARENT)
+            {
+                len = strlen(REG_Memory_Index[parent].node->key);
+                if ((end < len + 1) ||
+                    (key[end - len - 1] != '/') ||
+                    (strncmp(&key[end - len], REG_Memory_Index[parent].node->key, len) != 0))
+                {
+                    break;
+                }
+
+                end -= len + 1;
+                parent = REG_Memory_Index[parent].parent;
+            }
+
+            if ((parent == REG_MEMORY_NO_PARENT) && (end == 0))
+            {
+                return REG_Memory_Index[entry].node;
+            }
+        }
+
+        entry = (entry + 1) & REG_Memory_Index_Mask;
+    }
+
+    return 0;
+}
+
+#endif /* CFG_NU_OS_SVCS_REGISTRY_HASH_INDEX == NU_TRUE */
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -94,6 +359,20 @@ static REG_Memory_Node* REG_Memory_Get_Node(const CHAR *key)
     const CHAR *        key_begin = key;
     INT                 match;
 
+    REG_Memory_Lookups++;
+
+#if (CFG_NU_OS_SVCS_REGISTRY_HASH_INDEX == NU_TRUE)
+
+    /* Use the hash index for a key starting with '/' and without a
+       trailing '/'. */
+    if ((REG_Memory_Index != NU_NULL) && (key[0] == '/') &&
+        (key[1] != '\0') && (key[strlen(key) - 1] != '/'))
+    {
+        return REG_Memory_Index_Find(key);
+    }
+
+#endif /* CFG_NU_OS_SVCS_REGISTRY_HASH_INDEX == NU_TRUE */
+
     /* Loop until at the end of the key string */
     while (*key != '\0')
     {
@@ -111,6 +390,8 @@ static REG_Memory_Node* REG_Memory_Get_Node(const CHAR *key)
         while (1)
         {
             UINT child_key_len = strlen(child->key);
+
+            REG_Memory_Compares++;
             if (strncmp(child->key, key, (size_t)child_key_len) == 0
                 && END_OF_KEY(*(key + child_key_len)))
             {
@@ -120,8 +401,7 @@ static REG_Memory_Node* REG_Memory_Get_Node(const CHAR *key)
             }
 
             /* Check for last node in table */
-            if (((child->value.u32 == 0xDEADBEEF) && (child->children != (REG_Memory_Node *)NU_NULL)) ||
-                (child->children == (REG_Memory_Node *)0xDEADBEEF))
+            if (REG_MEMORY_LAST_NODE(child))
             {
                 break;
             }
@@ -150,6 +430,100 @@ static REG_Memory_Node* REG_Memory_Get_Node(const CHAR *key)
     #undef END_OF_KEY
 }
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Index_Initialize
+*
+*   DESCRIPTION
+*
+*       This function builds the hash index of the registry keys.  Keys
+*       looked up before the index is built, or if it cannot be built,
+*       are found by walking the registry tree.
+*
+*   INPUT
+*
+*       mem_pool - the memory pool the index is allocated from.
+*
+*   OUTPUT
+*
+*       NU_SUCCESS - the index was built, or is not configured.
+*       Other - the status of the failed memory allocation.
+*
+*************************************************************************/
+STATUS REG_Index_Initialize(NU_MEMORY_POOL *mem_pool)
+{
+    STATUS                      status = NU_SUCCESS;
+
+#if (CFG_NU_OS_SVCS_REGISTRY_HASH_INDEX == NU_TRUE)
+
+    REG_MEMORY_INDEX_ENTRY *    index;
+    UINT32                      size = 2;
+    UINT32                      count;
+
+    if ((REG_Memory_Index == NU_NULL) && (root != NU_NULL))
+    {
+        /* Keep the index at most half full. */
+        count = REG_Memory_Index_Count(root);
+        while (size < (count * 2))
+        {
+            size <<= 1;
+        }
+
+        status = NU_Allocate_Memory(mem_pool, (VOID **)&index,
+                                    size * sizeof(REG_MEMORY_INDEX_ENTRY),
+                                    NU_NO_SUSPEND);
+
+        if (status == NU_SUCCESS)
+        {
+            (VOID)memset(index, 0, size * sizeof(REG_MEMORY_INDEX_ENTRY));
+
+            REG_Memory_Index_Mask = size - 1;
+            REG_Memory_Index_Add(index, root, REG_MEMORY_HASH_INIT, REG_MEMORY_NO_PARENT);
+
+            /* Use the index once it is complete. */
+            REG_Memory_Index = index;
+        }
+    }
+
+#else
+
+    /* Suppress warnings */
+    NU_UNUSED_PARAM(mem_pool);
+
+#endif /* CFG_NU_OS_SVCS_REGISTRY_HASH_INDEX == NU_TRUE */
+
+    return status;
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       REG_Get_Lookup_Counts
+*
+*   DESCRIPTION
+*
+*       This function returns the number of key lookups made in the
+*       registry and the number of key comparisons they needed.
+*
+*   INPUT
+*
+*       lookups - destination for the number of lookups.
+*       compares - destination for the number of key comparisons.
+*
+*   OUTPUT
+*
+*       None.
+*
+*************************************************************************/
+VOID REG_Get_Lookup_Counts(UINT32 *lookups, UINT32 *compares)
+{
+    *lookups = REG_Memory_Lookups;
+    *compares = REG_Memory_Compares;
+}
+
 
 /* The following functions are the low-level implementations of what is
  * defined in 'reg_api.c' and 'reg_api.h'.  The interface documentation
@@ -189,8 +563,7 @@ static STATUS REG_Memory_Num_Child_Keys(const CHAR *key, UINT *num)
                 count += 1;
 
                 /* Check for last node in table */
-                if (((begin->value.u32 == 0xDEADBEEF) && (begin->children != (REG_Memory_Node *)NU_NULL)) ||
-                        (begin->children == (REG_Memory_Node *)0xDEADBEEF))
+                if (REG_MEMORY_LAST_NODE(begin))
                 {
                     break;
                 }
@@ -369,6 +742,76 @@ static STATUS REG_Memory_Set_Writable(const CHAR *key, BOOLEAN is_writable)
     return REG_NOT_WRITABLE;
 }
 
+static STATUS REG_Memory_Open_Key(const CHAR *key, REG_HANDLE *handle)
+{
+    STATUS status = REG_BAD_PATH;
+    REG_Memory_Node *node = REG_Memory_Get_Node(key);
+
+    if (node != 0)
+    {
+        *handle = (REG_HANDLE)node;
+        status = NU_SUCCESS;
+    }
+
+    return status;
+}
+
+static STATUS REG_Memory_Get_Handle_Value(REG_HANDLE handle,
+                                          UNSIGNED_CHAR *value,
+                                          UINT length)
+{
+    STATUS status = REG_BAD_PATH;
+    REG_Memory_Node *node = (REG_Memory_Node *)handle;
+
+    if (node != 0)
+    {
+        memcpy(value, &node->value, (size_t)length);
+        status = NU_SUCCESS;
+    }
+
+    return status;
+}
+
+static STATUS REG_Memory_Set_Handle_Value(REG_HANDLE handle,
+                                          const UNSIGNED_CHAR *value,
+                                          UINT length)
+{
+    /* Suppress warnings */
+    NU_UNUSED_PARAM(handle);
+    NU_UNUSED_PARAM(value);
+    NU_UNUSED_PARAM(length);
+
+    return REG_NOT_WRITABLE;
+}
+
+static STATUS REG_Memory_Get_Handle_Bytes(REG_HANDLE handle,
+                                          UNSIGNED_CHAR *value,
+                                          UINT length)
+{
+    STATUS status = REG_BAD_PATH;
+    REG_Memory_Node *node = (REG_Memory_Node *)handle;
+
+    if (node != 0)
+    {
+        memcpy(value, node->value.bytes, (size_t)length);
+        status = NU_SUCCESS;
+    }
+
+    return status;
+}
+
+static STATUS REG_Memory_Set_Handle_Bytes(REG_HANDLE handle,
+                                          const UNSIGNED_CHAR *value,
+                                          UINT length)
+{
+    /* Suppress warnings */
+    NU_UNUSED_PARAM(handle);
+    NU_UNUSED_PARAM(value);
+    NU_UNUSED_PARAM(length);
+
+    return REG_NOT_WRITABLE;
+}
+
 static REG_IMPL memory_impl = {
      &REG_Memory_Has_Key,
      &REG_Memory_Key_Is_Writable,
@@ -385,7 +828,12 @@ static REG_IMPL memory_impl = {
      &REG_Memory_Get_String,
      &REG_Memory_Set_Bytes,
      &REG_Memory_Get_Bytes,
-     &REG_Memory_Set_Writable
+     &REG_Memory_Set_Writable,
+     &REG_Memory_Open_Key,
+     &REG_Memory_Get_Handle_Value,
+     &REG_Memory_Set_Handle_Value,
+     &REG_Memory_Get_Handle_Bytes,
+     &REG_Memory_Set_Handle_Bytes
 };
 REG_IMPL *impl = &memory_impl;
 
@@ -36,6 +36,21 @@
 *       shell_command_help
 *       shell_command_quit
 *       shell_command_sleep
+*       shell_command_top
+*       shell_mxbench_entry
+*       shell_mxbench_run
+*       shell_command_mxbench
+*       shell_mmbench_random
+*       shell_mmbench_size
+*       shell_mmbench_run
+*       shell_mmbench_ns
+*       shell_command_mmbench
+*       shell_qbench_entry
+*       shell_qbench_run
+*       shell_command_qbench
+*       shell_eqbench_poster
+*       shell_eqbench_waiter
+*       shell_command_eqbench
 *       Shell_Banner
 *       Shell_Remove_Shell
 *       Shell_Thread_Entry
@@ -54,6 +69,7 @@
 *       shell_defs.h
 *       ctype.h
 *       string.h
+*       stdio.h
 *
 *************************************************************************/
 
@@ -65,6 +81,7 @@
 #include "shell_defs.h"
 #include <ctype.h>
 #include <string.h>
+#include <stdio.h>
 
 /* Global variables */
 NU_SEMAPHORE        Shell_Mutex;
@@ -76,6 +93,22 @@ NU_SHELL *          Shell_Global_Cmds;
 NU_SHELL *          Shell_Serial_Session;
 #endif
 
+#if (NU_TLSF_POOLS == NU_TRUE)
+/* Results of replaying the trace of the mmbench command against one pool */
+typedef struct SHELL_MMBENCH_RESULT_STRUCT
+{
+    UINT64      alloc_total;
+    UINT64      alloc_max;
+    UINT64      free_total;
+    UINT64      free_max;
+    UINT32      allocs;
+    UINT32      frees;
+    UINT32      failures;
+    UNSIGNED    available;
+    UNSIGNED    largest;
+} SHELL_MMBENCH_RESULT;
+#endif
+
 /* Local Function Prototypes */
 static SHELL_CMD *  shell_find_command (NU_SHELL *, CHAR *);
 static STATUS       shell_string_to_argv (CHAR *, VOID *, UINT, INT *, CHAR *** );
@@ -84,6 +117,29 @@ static VOID         shell_input_line (NU_SHELL *);
 static STATUS       shell_command_help (NU_SHELL *, INT, CHAR **);
 static STATUS       shell_command_quit (NU_SHELL *, INT, CHAR **);
 static STATUS       shell_command_sleep (NU_SHELL *, INT, CHAR **);
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+static STATUS       shell_command_top (NU_SHELL *, INT, CHAR **);
+#endif
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+static VOID         shell_mxbench_entry (UNSIGNED, VOID *);
+static UINT32       shell_mxbench_run (NU_TASK *, UINT32);
+static STATUS       shell_command_mxbench (NU_SHELL *, INT, CHAR **);
+#endif
+#if (NU_TLSF_POOLS == NU_TRUE)
+static UINT32       shell_mmbench_random (UINT32 *);
+static UNSIGNED     shell_mmbench_size (UINT32 *);
+static VOID         shell_mmbench_run (NU_MEMORY_POOL *, UINT32, SHELL_MMBENCH_RESULT *);
+static UINT32       shell_mmbench_ns (UINT64, UINT32);
+static STATUS       shell_command_mmbench (NU_SHELL *, INT, CHAR **);
+#endif
+#if (NU_POINTER_QUEUES == NU_TRUE)
+static VOID         shell_qbench_entry (UNSIGNED, VOID *);
+static UINT32       shell_qbench_run (BOOLEAN, NU_TASK *, UINT32);
+static STATUS       shell_command_qbench (NU_SHELL *, INT, CHAR **);
+#endif
+static VOID         shell_eqbench_poster (UNSIGNED, VOID *);
+static VOID         shell_eqbench_waiter (UNSIGNED, VOID *);
+static STATUS       shell_command_eqbench (NU_SHELL *, INT, CHAR **);
 
 /* Local functions Definitions */
 
@@ -897,309 +953,1784 @@ static STATUS shell_command_sleep(NU_SHELL *   p_shell,
     return (NU_SUCCESS);
 }
 
-/* Global functions */
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+
+/* Maximum number of tasks and HISRs shown by the top command */
+#define SHELL_TOP_MAX_THREADS       32
 
 /*************************************************************************
 *
 *   FUNCTION
 *
-*       Shell_Banner
+*       shell_command_top
 *
 *   DESCRIPTION
 *
-*       Displays the initial Shell banner information.
+*       This is the built-in command: top
+*
+*       The CPU usage of every task and HISR, the LISRs and the idle
+*       time is measured over the given number of seconds (default 1)
+*       and output with the number of times each thread was scheduled
+*       per second and its longest single run in cycles.
 *
 *   INPUTS
 *
 *       p_shell - Shell session handle
 *
-*   OUTPUTS
-*
-*       None
-*
-*************************************************************************/
-ESAL_TS_WEAK_DEF(VOID Shell_Banner(NU_SHELL * p_shell))
-{
-    NU_Shell_Puts(p_shell, "\r\n\n*** Nucleus Shell ***\r\n\r\n");
-}
-
-
-/*************************************************************************
-*
-*   FUNCTION
-*
-*       Shell_Remove_Shell
-*
-*   DESCRIPTION
-*
-*       Removes the specified shell (deletes semaphore,
-*       deallocates memory, etc)
-*
-*   INPUTS
+*       argc - Argument count
 *
-*       p_shell - Shell session handle
+*       argv - Argument vector
 *
 *   OUTPUTS
 *
-*       NU_SUCCESS if successful at removing shell
+*       NU_SUCCESS
 *
 *************************************************************************/
-STATUS      Shell_Remove_Shell(NU_SHELL * p_shell)
+static STATUS shell_command_top(NU_SHELL *   p_shell,
+                                INT          argc,
+                                CHAR **      argv)
 {
-    STATUS          status;
-    SHELL_CMD *     p_cmd;
+    NU_TASK *   tasks[SHELL_TOP_MAX_THREADS];
+    NU_HISR *   hisrs[SHELL_TOP_MAX_THREADS];
+    UINT64      cycles[2 * SHELL_TOP_MAX_THREADS];
+    UNSIGNED    switches[2 * SHELL_TOP_MAX_THREADS];
+    UINT32      max_slice[2 * SHELL_TOP_MAX_THREADS];
+    UNSIGNED    task_count;
+    UNSIGNED    hisr_count;
+    UNSIGNED    index;
+    UINT32      seconds = 1;
+    UINT64      idle_cycles;
+    UINT64      lisr_cycles;
+    UINT64      total_cycles;
+    CHAR        line[80];
+
+
+    /* Ensure no more than 1 arg */
+    if (argc > 1)
+    {
+        seconds = 0;
+    }
+    else if (argc == 1)
+    {
+        /* Convert parameter to a number */
+        seconds = strtol(argv[0], NU_NULL, 10);
+    }
 
+    if (seconds == 0)
+    {
+        /* Output error and format requirements */
+        NU_Shell_Puts(p_shell, "\r\nInvalid Usage!\r\n");
+        NU_Shell_Puts(p_shell, "Format: top [seconds]");
+    }
+    else
+    {
+        /* Output status */
+        NU_Shell_Puts(p_shell, "\r\nMeasuring...");
 
-    /* Deinit the I/O */
-    status = p_shell->session_io.io_deinit(p_shell);
+        /* Count the CPU usage from now on and let the system run */
+        NU_CPU_Usage_Reset();
+        NU_Sleep(seconds * NU_PLUS_TICKS_PER_SEC);
 
-    if (status == NU_SUCCESS)
-    {
-        /* Delete all commands registered for this session */
-        while (p_shell->cmd_count)
+        /* Take a snapshot of the usage of all threads */
+        task_count = NU_Task_Pointers(tasks, SHELL_TOP_MAX_THREADS);
+        hisr_count = NU_HISR_Pointers(hisrs, SHELL_TOP_MAX_THREADS);
+
+        for (index = 0; index < task_count; index++)
         {
-            /* Get first command in the list. */
-            p_cmd = (SHELL_CMD *)p_shell -> cmd_list -> cs_next;
+            if (NU_Thread_CPU_Usage(tasks[index], &cycles[index], &switches[index],
+                                    &max_slice[index]) != NU_SUCCESS)
+            {
+                /* Task was deleted since its pointer was taken */
+                cycles[index] = 0;
+                switches[index] = 0;
+                max_slice[index] = 0;
+            }
+        }
 
-            /* Delete this command */
-            status = Shell_Remove_Cmd (p_shell, p_cmd->str);
+        for (index = 0; index < hisr_count; index++)
+        {
+            if (NU_Thread_CPU_Usage(hisrs[index], &cycles[task_count + index],
+                                    &switches[task_count + index],
+                                    &max_slice[task_count + index]) != NU_SUCCESS)
+            {
+                /* HISR was deleted since its pointer was taken */
+                cycles[task_count + index] = 0;
+                switches[task_count + index] = 0;
+                max_slice[task_count + index] = 0;
+            }
         }
-    }
 
-    if (status == NU_SUCCESS)
-    {
-        /* Delete the mutex */
-        status = NU_Delete_Semaphore(&(p_shell -> cmd_sem));
-    }
+        NU_CPU_Usage_System(&idle_cycles, &lisr_cycles);
 
-    if (status == NU_SUCCESS)
-    {
-        /* Obtain mutex while traversing or manipulating created shell list */
-        status = NU_Obtain_Semaphore(&Shell_Mutex, NU_SUSPEND);
+        /* The total is everything that was counted in the interval */
+        total_cycles = idle_cycles + lisr_cycles;
+        for (index = 0; index < (task_count + hisr_count); index++)
+        {
+            total_cycles += cycles[index];
+        }
 
-        /* Ensure mutex obtained */
-        if (status == NU_SUCCESS)
+        if (total_cycles == 0)
         {
-            /* Remove shell session from list */
-            NU_Remove_From_List(&Shell_Created_Shell_List, &(p_shell -> created_list));
+            /* Avoid dividing by zero if the counter did not run */
+            total_cycles = 1;
+        }
 
-            /* Release mutex */
-            (VOID)NU_Release_Semaphore(&Shell_Mutex);
+        NU_Shell_Puts(p_shell, " Done!\r\n\r\n");
+        NU_Shell_Puts(p_shell, "NAME      TYPE   CPU%   SWITCH/S   MAX SLICE\r\n");
+
+        for (index = 0; index < (task_count + hisr_count); index++)
+        {
+            sprintf(line, "%-8.8s  %-5s %3lu.%lu %10lu %11lu\r\n",
+                    (index < task_count) ? tasks[index] -> tc_name :
+                                           hisrs[index - task_count] -> tc_name,
+                    (index < task_count) ? "TASK" : "HISR",
+                    (unsigned long)((cycles[index] * 1000) / total_cycles) / 10,
+                    (unsigned long)((cycles[index] * 1000) / total_cycles) % 10,
+                    (unsigned long)(switches[index] / seconds),
+                    (unsigned long)max_slice[index]);
+            NU_Shell_Puts(p_shell, line);
         }
-    }
 
-    if (status == NU_SUCCESS)
-    {
-        /* Deallocate the memory for this shell session */
-        status = NU_Deallocate_Memory(p_shell);
+        sprintf(line, "%-8.8s  %-5s %3lu.%lu\r\n", "-", "LISR",
+                (unsigned long)((lisr_cycles * 1000) / total_cycles) / 10,
+                (unsigned long)((lisr_cycles * 1000) / total_cycles) % 10);
+        NU_Shell_Puts(p_shell, line);
+
+        sprintf(line, "%-8.8s  %-5s %3lu.%lu", "-", "IDLE",
+                (unsigned long)((idle_cycles * 1000) / total_cycles) / 10,
+                (unsigned long)((idle_cycles * 1000) / total_cycles) % 10);
+        NU_Shell_Puts(p_shell, line);
     }
 
-    /* Return status to caller */
-    return (status);
+    /* Carriage return and 2 x line-feed before going back to command shell */
+    NU_Shell_Puts(p_shell, "\r\n\n");
+
+    /* Return success to caller */
+    return (NU_SUCCESS);
 }
 
+#endif  /* NU_CPU_ACCOUNTING == NU_TRUE */
+
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+
+/* Default number of obtain/release pairs timed by the mxbench command */
+#define SHELL_MXBENCH_COUNT         10000
+
+/* Stack size of the task contending for the lock in the mxbench command */
+#define SHELL_MXBENCH_STACK_SIZE    (NU_MIN_STACK_SIZE * 2)
+
+/* Locks compared by the mxbench command and the task contending for them */
+static NU_SEMAPHORE Shell_MxBench_Semaphore;
+static NU_MUTEX     Shell_MxBench_Mutex;
+static NU_TASK      Shell_MxBench_Task;
+static BOOLEAN      Shell_MxBench_Use_Mutex;
 
 /*************************************************************************
 *
 *   FUNCTION
 *
-*       Shell_Thread_Entry
+*       shell_mxbench_entry
 *
 *   DESCRIPTION
 *
-*       This is the main function of the Nucleus SHELL task.  It is
-*       mainly responsible for dispatching commands to the various
-*       responsible functions.
+*       Entry of the task contending for the lock in the mxbench
+*       command.  Each time it is resumed, it obtains and releases the
+*       lock once and suspends itself again.
 *
 *   INPUTS
 *
-*       argc - Argument count.  NOT USED.
+*       argc - Not used
 *
-*       argv - Argument vector.  Will contain a pointer to the Shell
-*              session handle.
+*       argv - Not used
 *
 *   OUTPUTS
 *
 *       None
 *
 *************************************************************************/
-VOID        Shell_Thread_Entry(UNSIGNED argc, VOID * argv)
+static VOID shell_mxbench_entry(UNSIGNED argc, VOID * argv)
 {
-    NU_SHELL *      p_shell = (NU_SHELL *)argv;
-    STATUS          status;
-    NU_SUPERV_USER_VARIABLES
+    NU_UNUSED_PARAM(argc);
+    NU_UNUSED_PARAM(argv);
 
-
-    NU_SUPERVISOR_MODE();
-
-    /* Call I/O init function */
-    status = p_shell->session_io.io_init(p_shell);
-
-    /* Ensure I/O initialized successfully */
-    if (status == NU_SUCCESS)
+    for (;;)
     {
-        /* Print the initial banner before entering the processing loop. */
-        Shell_Banner(p_shell);
-
-        /* Loop processing commands until a kill shell status returned */
-        while (status != NU_KILL_SHELL)
+        if (Shell_MxBench_Use_Mutex == NU_TRUE)
         {
-            /* Prompt the user for a selection. */
-            p_shell->session_io.io_puts(p_shell, SHELL_PROMPT_STR);
-
-            /* Obtain an input line from the user. */
-            shell_input_line(p_shell);
-
-            /* Process current input line. */
-            status = shell_process(p_shell);
+            (VOID)NU_Obtain_Mutex(&Shell_MxBench_Mutex, NU_SUSPEND);
+            (VOID)NU_Release_Mutex(&Shell_MxBench_Mutex);
+        }
+        else
+        {
+            (VOID)NU_Obtain_Semaphore(&Shell_MxBench_Semaphore, NU_SUSPEND);
+            (VOID)NU_Release_Semaphore(&Shell_MxBench_Semaphore);
         }
-    }
 
-    NU_USER_MODE();
+        (VOID)NU_Suspend_Task(&Shell_MxBench_Task);
+    }
 }
 
-
 /*************************************************************************
 *
 *   FUNCTION
 *
-*       Shell_Register_Cmd
+*       shell_mxbench_run
 *
 *   DESCRIPTION
 *
-*       Registers a command to the specified shell session
+*       Times the given number of obtain/release pairs of the selected
+*       lock.  If the contending task is passed, it is resumed while the
+*       lock is held, so it wants the lock before it is released.
 *
 *   INPUTS
 *
-*       p_shell - Shell session handle
-*
-*       cmd - Command name string
+*       contender - Task contending for the lock, or NU_NULL
 *
-*       cmd_fcn - Command function pointer
+*       count - Number of obtain/release pairs
 *
 *   OUTPUTS
 *
-*       NU_SUCCESS if successful at removing shell
+*       Nanoseconds per obtain/release pair
 *
 *************************************************************************/
-STATUS   Shell_Register_Cmd(NU_SHELL *  p_shell,
-                            CHAR *      cmd,
-                            STATUS      (*cmd_fcn) (NU_SHELL *, INT, CHAR **))
+static UINT32 shell_mxbench_run(NU_TASK * contender, UINT32 count)
 {
-    STATUS                  status;
-    NU_MEMORY_POOL *        p_memory_pool;
-    SHELL_CMD *             p_cmd;
-    UNSIGNED                cmd_mem_size;
+    UINT64      start;
+    UINT32      index;
 
 
-    /* Obtain command list access. */
-    status = NU_Obtain_Semaphore(&(p_shell -> cmd_sem), NU_SUSPEND);
+    start = NU_Get_Time_Stamp();
 
-    /* Ensure mutex owned  */
-    if (status == NU_SUCCESS)
+    for (index = 0; index < count; index++)
     {
-        /* Check if a duplicate command exists */
-        p_cmd = shell_find_command(p_shell,
-                                 cmd);
-        if (p_cmd != NU_NULL)
+        if (Shell_MxBench_Use_Mutex == NU_TRUE)
         {
-            /* ERROR: Found duplicate command already registered. */
-            status = NU_DUPLICATE_CMD;
+            (VOID)NU_Obtain_Mutex(&Shell_MxBench_Mutex, NU_SUSPEND);
         }
-
-        if (status == NU_SUCCESS)
+        else
         {
-            /* Get Nucleus OS (cached) memory resources. */
-            status = NU_System_Memory_Get(&p_memory_pool, NU_NULL);
+            (VOID)NU_Obtain_Semaphore(&Shell_MxBench_Semaphore, NU_SUSPEND);
         }
 
-        if (status == NU_SUCCESS)
+        if (contender != NU_NULL)
         {
-            /* Allocate enough memory for the command structure and the
-               command string plus a null terminator for the string */
-            cmd_mem_size = (sizeof(SHELL_CMD)
-                            + (sizeof(CHAR) * (strlen(cmd) + 1)));
-
-            status = NU_Allocate_Memory(p_memory_pool,
-                                        (VOID **)&p_cmd,
-                                        cmd_mem_size,
-                                        NU_NO_SUSPEND);
+            (VOID)NU_Resume_Task(contender);
         }
 
-        if (status == NU_SUCCESS)
+        if (Shell_MxBench_Use_Mutex == NU_TRUE)
         {
-            /* Zero initialize the command memory. */
-            memset(p_cmd, 0x00, cmd_mem_size);
-
-            /* Place the string pointer past the structure. */
-            p_cmd -> str = (CHAR *)p_cmd + sizeof(SHELL_CMD);
-
-            /* Copy the input string, cmd, and make it lower case. */
-            SHELL_STRING_TO_LOWER_CASE(cmd, p_cmd -> str);
-
-            /* Null terminate the string. */
-            p_cmd -> str[strlen(cmd)] = 0;
-
-            /* Set command function. */
-            p_cmd -> fcn  = cmd_fcn;
-
-            /* Add the command to the list. */
-            NU_Place_On_List(&p_shell -> cmd_list, (CS_NODE*) p_cmd);
-
-            /* Update command count. */
-            p_shell -> cmd_count++;
+            (VOID)NU_Release_Mutex(&Shell_MxBench_Mutex);
+        }
+        else
+        {
+            (VOID)NU_Release_Semaphore(&Shell_MxBench_Semaphore);
         }
-
-        /* Release the command list access (always if access obtained). */
-        (VOID)NU_Release_Semaphore(&(p_shell -> cmd_sem));
     }
 
-    /* Return status to caller */
-    return (status);
+    return ((UINT32)(((NU_Get_Time_Stamp() - start) * 1000000000ULL) /
+                     ((UINT64)NU_HW_TIMER_TICKS_PER_SEC * count)));
 }
 
-
 /*************************************************************************
 *
 *   FUNCTION
 *
-*       Shell_Remove_Cmd
+*       shell_command_mxbench
 *
 *   DESCRIPTION
 *
-*       Removes the specified command from the shell session's command
-*       list
+*       This is the built-in command: mxbench
+*
+*       The given number of obtain/release pairs (default 10000) of a
+*       priority inheritance semaphore and of a priority ceiling mutex
+*       are timed, first uncontended and then with a higher priority
+*       task wanting the lock while it is held.
 *
 *   INPUTS
 *
 *       p_shell - Shell session handle
 *
-*       cmd - command string to remove
+*       argc - Argument count
+*
+*       argv - Argument vector
 *
 *   OUTPUTS
 *
-*       NU_SUCCESS if successful at removing command
+*       NU_SUCCESS
 *
 *************************************************************************/
-STATUS Shell_Remove_Cmd(NU_SHELL * p_shell, CHAR * cmd)
+static STATUS shell_command_mxbench(NU_SHELL *   p_shell,
+                                    INT          argc,
+                                    CHAR **      argv)
 {
-    STATUS          status;
-    SHELL_CMD *     p_cmd;
+    NU_MEMORY_POOL *    p_memory_pool;
+    VOID *              p_stack = NU_NULL;
+    TC_TCB *            p_self;
+    UINT32              count = SHELL_MXBENCH_COUNT;
+    UINT32              results[4];
+    OPTION              priority;
+    STATUS              status;
+    CHAR                line[80];
 
 
-    /* Obtain command list access. */
-    status = NU_Obtain_Semaphore(&(p_shell -> cmd_sem), NU_SUSPEND);
+    /* Ensure no more than 1 arg */
+    if (argc > 1)
+    {
+        count = 0;
+    }
+    else if (argc == 1)
+    {
+        /* Convert parameter to a number */
+        count = strtol(argv[0], NU_NULL, 10);
+    }
 
-    /* Ensure mutex owned */
-    if (status == NU_SUCCESS)
+    /* The contending task runs one priority above the shell */
+    p_self = (TC_TCB *)NU_Current_Task_Pointer();
+
+    if (count == 0)
     {
-        /* Find the matching command structure. */
-        p_cmd = shell_find_command(p_shell, cmd);
+        /* Output error and format requirements */
+        NU_Shell_Puts(p_shell, "\r\nInvalid Usage!\r\n");
+        NU_Shell_Puts(p_shell, "Format: mxbench [iterations]");
+    }
+    else if ((p_self == NU_NULL) || (p_self -> tc_base_priority == 0))
+    {
+        NU_Shell_Puts(p_shell, "\r\nShell task priority must be above 0");
+    }
+    else
+    {
+        priority = (OPTION)(p_self -> tc_base_priority - 1);
 
-        /* Determine if command found */
-        if (p_cmd == NU_NULL)
+        /* Get Nucleus OS (cached) memory resources. */
+        status = NU_System_Memory_Get(&p_memory_pool, NU_NULL);
+
+        if (status == NU_SUCCESS)
         {
-            status = NU_UNAVAILABLE;
+            status = NU_Allocate_Memory(p_memory_pool, &p_stack,
+                                        SHELL_MXBENCH_STACK_SIZE,
+                                        NU_NO_SUSPEND);
+        }
+
+        if (status == NU_SUCCESS)
+        {
+            status = NU_Create_Semaphore(&Shell_MxBench_Semaphore, "MXBENCH",
+                                         1, NU_PRIORITY_INHERIT);
+
+            if (status == NU_SUCCESS)
+            {
+                /* The ceiling is the priority of the contending task */
+                status = NU_Create_Mutex(&Shell_MxBench_Mutex, "MXBENCH",
+                                         priority);
+
+                if (status == NU_SUCCESS)
+                {
+                    status = NU_Create_Task(&Shell_MxBench_Task, "MXBENCH",
+                                            shell_mxbench_entry, 0, NU_NULL,
+                                            p_stack, SHELL_MXBENCH_STACK_SIZE,
+                                            priority, 0, NU_PREEMPT,
+                                            NU_NO_START);
+
+                    if (status == NU_SUCCESS)
+                    {
+                        NU_Shell_Puts(p_shell, "\r\nMeasuring...");
+
+                        Shell_MxBench_Use_Mutex = NU_FALSE;
+                        results[0] = shell_mxbench_run(NU_NULL, count);
+                        results[1] = shell_mxbench_run(&Shell_MxBench_Task, count);
+
+                        Shell_MxBench_Use_Mutex = NU_TRUE;
+                        results[2] = shell_mxbench_run(NU_NULL, count);
+                        results[3] = shell_mxbench_run(&Shell_MxBench_Task, count);
+
+                        NU_Shell_Puts(p_shell, " Done!\r\n\r\n");
+                        NU_Shell_Puts(p_shell, "LOCK       UNCONTENDED ns   CONTENDED ns\r\n");
+
+                        sprintf(line, "%-9s  %14lu  %13lu\r\n", "INHERIT",
+                                (unsigned long)results[0], (unsigned long)results[1]);
+                        NU_Shell_Puts(p_shell, line);
+
+                        sprintf(line, "%-9s  %14lu  %13lu", "CEILING",
+                                (unsigned long)results[2], (unsigned long)results[3]);
+                        NU_Shell_Puts(p_shell, line);
+
+                        /* The contending task is suspended again by now */
+                        (VOID)NU_Terminate_Task(&Shell_MxBench_Task);
+                        (VOID)NU_Delete_Task(&Shell_MxBench_Task);
+                    }
+
+                    (VOID)NU_Delete_Mutex(&Shell_MxBench_Mutex);
+                }
+
+                (VOID)NU_Delete_Semaphore(&Shell_MxBench_Semaphore);
+            }
+
+            (VOID)NU_Deallocate_Memory(p_stack);
+        }
+
+        if (status != NU_SUCCESS)
+        {
+            NU_Shell_Puts(p_shell, "\r\nUnable to create the benchmark locks");
+        }
+    }
+
+    /* Carriage return and 2 x line-feed before going back to command shell */
+    NU_Shell_Puts(p_shell, "\r\n\n");
+
+    /* Return success to caller */
+    return (NU_SUCCESS);
+}
+
+#endif  /* NU_CEILING_MUTEXES == NU_TRUE */
+
+#if (NU_TLSF_POOLS == NU_TRUE)
+
+/* Default number of allocate/deallocate operations replayed by the
+   mmbench command */
+#define SHELL_MMBENCH_COUNT         20000
+
+/* Size of the pools the mmbench command replays its trace against */
+#define SHELL_MMBENCH_POOL_SIZE     (64 * 1024)
+
+/* Minimum allocation of the mmbench pools */
+#define SHELL_MMBENCH_MIN_ALLOC     16
+
+/* Number of blocks the trace of the mmbench command can hold at once */
+#define SHELL_MMBENCH_SLOTS         128
+
+/* Seed of the trace, so both pools replay the same operations */
+#define SHELL_MMBENCH_SEED          0x2545F491UL
+
+/* Blocks held by the trace of the mmbench command, and whether the trace
+   holds a block in each slot whether or not its allocation succeeded */
+static VOID *       Shell_MmBench_Blocks[SHELL_MMBENCH_SLOTS];
+static BOOLEAN      Shell_MmBench_Live[SHELL_MMBENCH_SLOTS];
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       shell_mmbench_random
+*
+*   DESCRIPTION
+*
+*       Returns the next number of the pseudo-random sequence of the
+*       mmbench trace.
+*
+*   INPUTS
+*
+*       p_seed - State of the sequence
+*
+*   OUTPUTS
+*
+*       Pseudo-random number
+*
+*************************************************************************/
+static UINT32 shell_mmbench_random(UINT32 * p_seed)
+{
+    *p_seed = (*p_seed * 1664525UL) + 1013904223UL;
+
+    return (*p_seed >> 8);
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       shell_mmbench_size
+*
+*   DESCRIPTION
+*
+*       Returns the size of the next allocation of the mmbench trace.
+*       Six in ten allocations are 16 to 128 bytes, like socket and
+*       timer control blocks, three are 128 bytes to 1 KB and one is
+*       1 to 4 KB, like session and request buffers.
+*
+*   INPUTS
+*
+*       p_seed - State of the sequence
+*
+*   OUTPUTS
+*
+*       Size in bytes
+*
+*************************************************************************/
+static UNSIGNED shell_mmbench_size(UINT32 * p_seed)
+{
+    UINT32      random = shell_mmbench_random(p_seed);
+    UINT32      range = random % 10;
+
+
+    random /= 10;
+
+    if (range < 6)
+    {
+        return (16 + (random % 113));
+    }
+    else if (range < 9)
+    {
+        return (128 + (random % 897));
+    }
+
+    return (1024 + (random % 3073));
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       shell_mmbench_run
+*
+*   DESCRIPTION
+*
+*       Replays the mmbench trace against a pool.  Each operation picks
+*       a slot and allocates a block for it if the trace holds none, or
+*       deallocates its block.  A failed allocation is counted and the
+*       slot is treated as held, so the trace stays the same for every
+*       pool.  Once the trace is replayed, the largest block that can
+*       still be allocated is found before the blocks are deallocated.
+*
+*   INPUTS
+*
+*       p_pool - Pool to replay the trace against
+*
+*       count - Number of operations
+*
+*       p_result - Results of the replay
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+static VOID shell_mmbench_run(NU_MEMORY_POOL *          p_pool,
+                              UINT32                    count,
+                              SHELL_MMBENCH_RESULT *    p_result)
+{
+    UINT32      seed = SHELL_MMBENCH_SEED;
+    UINT32      index;
+    UINT32      slot;
+    UNSIGNED    size;
+    UNSIGNED    low;
+    UNSIGNED    high;
+    UINT64      start;
+    UINT64      elapsed;
+    VOID *      p_block;
+    STATUS      status;
+    CHAR        name[NU_MAX_NAME];
+    VOID *      start_address;
+    UNSIGNED    pool_size;
+    UNSIGNED    min_allocation;
+    OPTION      suspend_type;
+    UNSIGNED    tasks_waiting;
+    NU_TASK *   first_task;
+
+
+    memset(p_result, 0, sizeof(SHELL_MMBENCH_RESULT));
+    memset(Shell_MmBench_Blocks, 0, sizeof(Shell_MmBench_Blocks));
+    memset(Shell_MmBench_Live, 0, sizeof(Shell_MmBench_Live));
+
+    for (index = 0; index < count; index++)
+    {
+        slot = shell_mmbench_random(&seed) % SHELL_MMBENCH_SLOTS;
+
+        if (Shell_MmBench_Live[slot] == NU_FALSE)
+        {
+            size = shell_mmbench_size(&seed);
+
+            start = NU_Get_Time_Stamp();
+            status = NU_Allocate_Memory(p_pool, &Shell_MmBench_Blocks[slot],
+                                        size, NU_NO_SUSPEND);
+            elapsed = NU_Get_Time_Stamp() - start;
+
+            if (status != NU_SUCCESS)
+            {
+                Shell_MmBench_Blocks[slot] = NU_NULL;
+                p_result -> failures++;
+            }
+
+            Shell_MmBench_Live[slot] = NU_TRUE;
+
+            p_result -> allocs++;
+            p_result -> alloc_total += elapsed;
+
+            if (elapsed > p_result -> alloc_max)
+            {
+                p_result -> alloc_max = elapsed;
+            }
+        }
+        else
+        {
+            Shell_MmBench_Live[slot] = NU_FALSE;
+
+            if (Shell_MmBench_Blocks[slot] != NU_NULL)
+            {
+                start = NU_Get_Time_Stamp();
+                (VOID)NU_Deallocate_Memory(Shell_MmBench_Blocks[slot]);
+                elapsed = NU_Get_Time_Stamp() - start;
+
+                Shell_MmBench_Blocks[slot] = NU_NULL;
+
+                p_result -> frees++;
+                p_result -> free_total += elapsed;
+
+                if (elapsed > p_result -> free_max)
+                {
+                    p_result -> free_max = elapsed;
+                }
+            }
+        }
+    }
+
+    (VOID)NU_Memory_Pool_Information(p_pool, name, &start_address, &pool_size,
+                                     &min_allocation, &p_result -> available,
+                                     &suspend_type, &tasks_waiting, &first_task);
+
+    /* Find the largest block that can be allocated */
+    low = 0;
+    high = p_result -> available;
+
+    while (low < high)
+    {
+        size = low + ((high - low + 1) / 2);
+
+        if (NU_Allocate_Memory(p_pool, &p_block, size,
+                               NU_NO_SUSPEND) == NU_SUCCESS)
+        {
+            (VOID)NU_Deallocate_Memory(p_block);
+            low = size;
+        }
+        else
+        {
+            high = size - 1;
+        }
+    }
+
+    p_result -> largest = low;
+
+    for (slot = 0; slot < SHELL_MMBENCH_SLOTS; slot++)
+    {
+        if (Shell_MmBench_Blocks[slot] != NU_NULL)
+        {
+            (VOID)NU_Deallocate_Memory(Shell_MmBench_Blocks[slot]);
+        }
+    }
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       shell_mmbench_ns
+*
+*   DESCRIPTION
+*
+*       Converts a number of time stamp ticks to nanoseconds.
+*
+*   INPUTS
+*
+*       ticks - Time stamp ticks
+*
+*       count - Number of operations the ticks are divided among
+*
+*   OUTPUTS
+*
+*       Nanoseconds per operation
+*
+*************************************************************************/
+static UINT32 shell_mmbench_ns(UINT64 ticks, UINT32 count)
+{
+    if (count == 0)
+    {
+        return (0);
+    }
+
+    return ((UINT32)((ticks * 1000000000ULL) /
+                     ((UINT64)NU_HW_TIMER_TICKS_PER_SEC * count)));
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       shell_command_mmbench
+*
+*   DESCRIPTION
+*
+*       This is the built-in command: mmbench
+*
+*       The same trace of allocations and deallocations (default 20000
+*       operations) is replayed against a first-fit pool and a TLSF pool
+*       of the same size, with preemption disabled.  The average and
+*       worst-case time of an allocation and a deallocation, the
+*       allocations that failed and the fragmentation left by the trace
+*       are output for each pool.  The fragmentation is the share of the
+*       available memory that cannot be allocated as one block.
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*
+*       argc - Argument count
+*
+*       argv - Argument vector
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+*************************************************************************/
+static STATUS shell_command_mmbench(NU_SHELL *   p_shell,
+                                    INT          argc,
+                                    CHAR **      argv)
+{
+    NU_MEMORY_POOL *        p_memory_pool;
+    NU_MEMORY_POOL          pool;
+    VOID *                  p_region = NU_NULL;
+    UINT32                  count = SHELL_MMBENCH_COUNT;
+    SHELL_MMBENCH_RESULT    results[2];
+    OPTION                  pool_types[2] = {NU_FIFO, NU_FIFO | NU_TLSF_POOL};
+    OPTION                  old_preempt;
+    UINT32                  index;
+    UINT32                  fragmentation;
+    STATUS                  status;
+    CHAR                    line[80];
+
+
+    /* Ensure no more than 1 arg */
+    if (argc > 1)
+    {
+        count = 0;
+    }
+    else if (argc == 1)
+    {
+        /* Convert parameter to a number */
+        count = strtol(argv[0], NU_NULL, 10);
+    }
+
+    if (count == 0)
+    {
+        /* Output error and format requirements */
+        NU_Shell_Puts(p_shell, "\r\nInvalid Usage!\r\n");
+        NU_Shell_Puts(p_shell, "Format: mmbench [operations]");
+    }
+    else
+    {
+        /* Get Nucleus OS (cached) memory resources. */
+        status = NU_System_Memory_Get(&p_memory_pool, NU_NULL);
+
+        if (status == NU_SUCCESS)
+        {
+            status = NU_Allocate_Memory(p_memory_pool, &p_region,
+                                        SHELL_MMBENCH_POOL_SIZE,
+                                        NU_NO_SUSPEND);
+        }
+
+        /* Both pools are created in the same region in turn */
+        for (index = 0; (index < 2) && (status == NU_SUCCESS); index++)
+        {
+            status = NU_Create_Memory_Pool(&pool, "MMBENCH", p_region,
+                                           SHELL_MMBENCH_POOL_SIZE,
+                                           SHELL_MMBENCH_MIN_ALLOC,
+                                           pool_types[index]);
+
+            if (status == NU_SUCCESS)
+            {
+                if (index == 0)
+                {
+                    NU_Shell_Puts(p_shell, "\r\nMeasuring...");
+                }
+
+                old_preempt = NU_Change_Preemption(NU_NO_PREEMPT);
+
+                shell_mmbench_run(&pool, count, &results[index]);
+
+                (VOID)NU_Change_Preemption(old_preempt);
+
+                (VOID)NU_Delete_Memory_Pool(&pool);
+            }
+        }
+
+        if (status == NU_SUCCESS)
+        {
+            NU_Shell_Puts(p_shell, " Done!\r\n\r\n");
+            NU_Shell_Puts(p_shell, "POOL       ALLOC ns avg/max   FREE ns avg/max   FAILED  FRAG %\r\n");
+
+            for (index = 0; index < 2; index++)
+            {
+                fragmentation = 0;
+
+                if (results[index].available != 0)
+                {
+                    fragmentation = 100 - (UINT32)(((UINT64)results[index].largest * 100) /
+                                                   results[index].available);
+                }
+
+                sprintf(line, "%-9s  %7lu/%-9lu  %7lu/%-8lu  %6lu  %6lu%s",
+                        (index == 0) ? "FIRSTFIT" : "TLSF",
+                        (unsigned long)shell_mmbench_ns(results[index].alloc_total,
+                                                        results[index].allocs),
+                        (unsigned long)shell_mmbench_ns(results[index].alloc_max, 1),
+                        (unsigned long)shell_mmbench_ns(results[index].free_total,
+                                                        results[index].frees),
+                        (unsigned long)shell_mmbench_ns(results[index].free_max, 1),
+                        (unsigned long)results[index].failures,
+                        (unsigned long)fragmentation,
+                        (index == 0) ? "\r\n" : "");
+                NU_Shell_Puts(p_shell, line);
+            }
+        }
+        else
+        {
+            NU_Shell_Puts(p_shell, "\r\nUnable to create the benchmark pools");
+        }
+
+        if (p_region != NU_NULL)
+        {
+            (VOID)NU_Deallocate_Memory(p_region);
+        }
+    }
+
+    /* Carriage return and 2 x line-feed before going back to command shell */
+    NU_Shell_Puts(p_shell, "\r\n\n");
+
+    /* Return success to caller */
+    return (NU_SUCCESS);
+}
+
+#endif  /* NU_TLSF_POOLS == NU_TRUE */
+
+#if (NU_POINTER_QUEUES == NU_TRUE)
+
+/* Default number of messages timed by the qbench command */
+#define SHELL_QBENCH_COUNT          10000
+
+/* Number of messages the queues of the qbench command can hold */
+#define SHELL_QBENCH_DEPTH          16
+
+/* Stack size of the task receiving messages in the qbench command */
+#define SHELL_QBENCH_STACK_SIZE     (NU_MIN_STACK_SIZE * 2)
+
+/* Queues compared by the qbench command and the task receiving from them */
+static NU_QUEUE         Shell_QBench_Queue;
+static NU_POINTER_QUEUE Shell_QBench_Pointer_Queue;
+static NU_TASK          Shell_QBench_Task;
+static UNSIGNED         Shell_QBench_Queue_Area[SHELL_QBENCH_DEPTH];
+static VOID *           Shell_QBench_Pointer_Area[SHELL_QBENCH_DEPTH];
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       shell_qbench_entry
+*
+*   DESCRIPTION
+*
+*       Entry of the task receiving messages in the qbench command.  It
+*       receives from the selected queue until it is terminated.
+*
+*   INPUTS
+*
+*       argc - NU_TRUE to receive from the pointer queue
+*
+*       argv - Not used
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+static VOID shell_qbench_entry(UNSIGNED argc, VOID * argv)
+{
+    UNSIGNED    message;
+    UNSIGNED    actual_size;
+    VOID *      p_message;
+
+
+    NU_UNUSED_PARAM(argv);
+
+    for (;;)
+    {
+        if (argc == NU_TRUE)
+        {
+            (VOID)NU_Receive_From_Pointer_Queue(&Shell_QBench_Pointer_Queue,
+                                                &p_message, NU_SUSPEND);
+        }
+        else
+        {
+            (VOID)NU_Receive_From_Queue(&Shell_QBench_Queue, &message, 1,
+                                        &actual_size, NU_SUSPEND);
+        }
+    }
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       shell_qbench_run
+*
+*   DESCRIPTION
+*
+*       Times the given number of messages through the selected queue.
+*       If the receiving task is passed, it is restarted to wait on the
+*       queue, so each message is handed to it as it is sent.
+*       Otherwise, each message is sent to the queue and received back
+*       from it.
+*
+*   INPUTS
+*
+*       use_pointer - NU_TRUE to use the pointer queue
+*
+*       receiver - Task receiving the messages, or NU_NULL
+*
+*       count - Number of messages
+*
+*   OUTPUTS
+*
+*       Messages per second
+*
+*************************************************************************/
+static UINT32 shell_qbench_run(BOOLEAN use_pointer, NU_TASK * receiver,
+                               UINT32 count)
+{
+    UINT64      start;
+    UINT64      elapsed;
+    UINT32      index;
+    UNSIGNED    message = 0;
+    UNSIGNED    actual_size;
+    VOID *      p_message;
+
+
+    if (receiver != NU_NULL)
+    {
+        /* The receiver runs above the shell, so it is waiting on the
+           queue by the time it is resumed */
+        (VOID)NU_Terminate_Task(receiver);
+        (VOID)NU_Reset_Task(receiver, (UNSIGNED)use_pointer, NU_NULL);
+        (VOID)NU_Resume_Task(receiver);
+    }
+
+    start = NU_Get_Time_Stamp();
+
+    for (index = 0; index < count; index++)
+    {
+        if (use_pointer == NU_TRUE)
+        {
+            (VOID)NU_Send_To_Pointer_Queue(&Shell_QBench_Pointer_Queue,
+                                           &message, NU_SUSPEND);
+
+            if (receiver == NU_NULL)
+            {
+                (VOID)NU_Receive_From_Pointer_Queue(&Shell_QBench_Pointer_Queue,
+                                                    &p_message, NU_SUSPEND);
+            }
+        }
+        else
+        {
+            (VOID)NU_Send_To_Queue(&Shell_QBench_Queue, &message, 1,
+                                   NU_SUSPEND);
+
+            if (receiver == NU_NULL)
+            {
+                (VOID)NU_Receive_From_Queue(&Shell_QBench_Queue, &message, 1,
+                                            &actual_size, NU_SUSPEND);
+            }
+        }
+    }
+
+    elapsed = NU_Get_Time_Stamp() - start;
+
+    if (receiver != NU_NULL)
+    {
+        (VOID)NU_Terminate_Task(receiver);
+    }
+
+    if (elapsed == 0)
+    {
+        elapsed = 1;
+    }
+
+    return ((UINT32)(((UINT64)NU_HW_TIMER_TICKS_PER_SEC * count) / elapsed));
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       shell_command_qbench
+*
+*   DESCRIPTION
+*
+*       This is the built-in command: qbench
+*
+*       The given number of messages (default 10000) are passed through
+*       a pointer queue and through a queue of 1-word fixed-size
+*       messages, first sent and received back by the shell and then
+*       handed to a higher priority task waiting on the queue.  The
+*       rate in messages per second is output for each.
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*
+*       argc - Argument count
+*
+*       argv - Argument vector
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+*************************************************************************/
+static STATUS shell_command_qbench(NU_SHELL *   p_shell,
+                                   INT          argc,
+                                   CHAR **      argv)
+{
+    NU_MEMORY_POOL *    p_memory_pool;
+    VOID *              p_stack = NU_NULL;
+    TC_TCB *            p_self;
+    UINT32              count = SHELL_QBENCH_COUNT;
+    UINT32              results[4];
+    OPTION              priority;
+    STATUS              status;
+    CHAR                line[80];
+
+
+    /* Ensure no more than 1 arg */
+    if (argc > 1)
+    {
+        count = 0;
+    }
+    else if (argc == 1)
+    {
+        /* Convert parameter to a number */
+        count = strtol(argv[0], NU_NULL, 10);
+    }
+
+    /* The receiving task runs one priority above the shell */
+    p_self = (TC_TCB *)NU_Current_Task_Pointer();
+
+    if (count == 0)
+    {
+        /* Output error and format requirements */
+        NU_Shell_Puts(p_shell, "\r\nInvalid Usage!\r\n");
+        NU_Shell_Puts(p_shell, "Format: qbench [messages]");
+    }
+    else if ((p_self == NU_NULL) || (p_self -> tc_base_priority == 0))
+    {
+        NU_Shell_Puts(p_shell, "\r\nShell task priority must be above 0");
+    }
+    else
+    {
+        priority = (OPTION)(p_self -> tc_base_priority - 1);
+
+        /* Get Nucleus OS (cached) memory resources. */
+        status = NU_System_Memory_Get(&p_memory_pool, NU_NULL);
+
+        if (status == NU_SUCCESS)
+        {
+            status = NU_Allocate_Memory(p_memory_pool, &p_stack,
+                                        SHELL_QBENCH_STACK_SIZE,
+                                        NU_NO_SUSPEND);
+        }
+
+        if (status == NU_SUCCESS)
+        {
+            status = NU_Create_Queue(&Shell_QBench_Queue, "QBENCH",
+                                     Shell_QBench_Queue_Area,
+                                     SHELL_QBENCH_DEPTH, NU_FIXED_SIZE, 1,
+                                     NU_FIFO);
+
+            if (status == NU_SUCCESS)
+            {
+                status = NU_Create_Pointer_Queue(&Shell_QBench_Pointer_Queue,
+                                                 "QBENCH",
+                                                 Shell_QBench_Pointer_Area,
+                                                 SHELL_QBENCH_DEPTH, NU_FIFO);
+
+                if (status == NU_SUCCESS)
+                {
+                    status = NU_Create_Task(&Shell_QBench_Task, "QBENCH",
+                                            shell_qbench_entry, 0, NU_NULL,
+                                            p_stack, SHELL_QBENCH_STACK_SIZE,
+                                            priority, 0, NU_PREEMPT,
+                                            NU_NO_START);
+
+                    if (status == NU_SUCCESS)
+                    {
+                        NU_Shell_Puts(p_shell, "\r\nMeasuring...");
+
+                        results[0] = shell_qbench_run(NU_FALSE, NU_NULL, count);
+                        results[1] = shell_qbench_run(NU_FALSE, &Shell_QBench_Task, count);
+                        results[2] = shell_qbench_run(NU_TRUE, NU_NULL, count);
+                        results[3] = shell_qbench_run(NU_TRUE, &Shell_QBench_Task, count);
+
+                        NU_Shell_Puts(p_shell, " Done!\r\n\r\n");
+                        NU_Shell_Puts(p_shell, "QUEUE      QUEUED msgs/s   HANDOFF msgs/s\r\n");
+
+                        sprintf(line, "%-9s  %13lu  %15lu\r\n", "1-WORD",
+                                (unsigned long)results[0], (unsigned long)results[1]);
+                        NU_Shell_Puts(p_shell, line);
+
+                        sprintf(line, "%-9s  %13lu  %15lu", "POINTER",
+                                (unsigned long)results[2], (unsigned long)results[3]);
+                        NU_Shell_Puts(p_shell, line);
+
+                        /* The receiving task is terminated by now */
+                        (VOID)NU_Delete_Task(&Shell_QBench_Task);
+                    }
+
+                    (VOID)NU_Delete_Pointer_Queue(&Shell_QBench_Pointer_Queue);
+                }
+
+                (VOID)NU_Delete_Queue(&Shell_QBench_Queue);
+            }
+
+            (VOID)NU_Deallocate_Memory(p_stack);
+        }
+
+        if (status != NU_SUCCESS)
+        {
+            NU_Shell_Puts(p_shell, "\r\nUnable to create the benchmark queues");
+        }
+    }
+
+    /* Carriage return and 2 x line-feed before going back to command shell */
+    NU_Shell_Puts(p_shell, "\r\n\n");
+
+    /* Return success to caller */
+    return (NU_SUCCESS);
+}
+
+#endif  /* NU_POINTER_QUEUES == NU_TRUE */
+
+/* Default number of events posted by each task of the eqbench command */
+#define SHELL_EQBENCH_COUNT         2500
+
+/* Number of tasks posting and waiting for events in the eqbench command */
+#define SHELL_EQBENCH_POSTERS       4
+#define SHELL_EQBENCH_WAITERS       4
+
+/* Number of event types posted in the eqbench command.  Each waiter waits
+   for one type, so the other types are posted without a waiter. */
+#define SHELL_EQBENCH_TYPES         (SHELL_EQBENCH_WAITERS * 2)
+
+/* Number of events held by the event queue of the eqbench command */
+#define SHELL_EQBENCH_QUEUE_SIZE    64
+
+/* Stack size of the tasks of the eqbench command */
+#define SHELL_EQBENCH_STACK_SIZE    (NU_MIN_STACK_SIZE * 2)
+
+/* Event queue of the eqbench command, the tasks posting to and waiting on
+   it, the events posted for the waited types and the events received */
+static EQM_EVENT_QUEUE  Shell_EqBench_Queue;
+static NU_TASK          Shell_EqBench_Posters[SHELL_EQBENCH_POSTERS];
+static NU_TASK          Shell_EqBench_Waiters[SHELL_EQBENCH_WAITERS];
+static UINT32           Shell_EqBench_Count;
+static UINT32           Shell_EqBench_Watched;
+static UINT32           Shell_EqBench_Received;
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       shell_eqbench_poster
+*
+*   DESCRIPTION
+*
+*       Entry of a task posting events in the eqbench command.  It posts
+*       its events with the types in turn, starting from its own index,
+*       and relinquishes after each one so the posters interleave.
+*
+*   INPUTS
+*
+*       argc - Index of the poster
+*
+*       argv - Not used
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+static VOID shell_eqbench_poster(UNSIGNED argc, VOID * argv)
+{
+    EQM_EVENT   event;
+    UINT32      index;
+    UINT32      type;
+
+
+    NU_UNUSED_PARAM(argv);
+
+    for (index = 0; index < Shell_EqBench_Count; index++)
+    {
+        type = (argc + index) % SHELL_EQBENCH_TYPES;
+        event.eqm_event_type = 1UL << type;
+
+        if (type < SHELL_EQBENCH_WAITERS)
+        {
+            Shell_EqBench_Watched++;
+        }
+
+        (VOID)NU_EQM_Post_Event(&Shell_EqBench_Queue, &event,
+                                sizeof(EQM_EVENT), NU_NULL);
+
+        NU_Relinquish();
+    }
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       shell_eqbench_waiter
+*
+*   DESCRIPTION
+*
+*       Entry of a task waiting for events in the eqbench command.  It
+*       waits for the type of its own index, resuming each search after
+*       the last event it received, until it is terminated.
+*
+*   INPUTS
+*
+*       argc - Index of the waiter
+*
+*       argv - Not used
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+static VOID shell_eqbench_waiter(UNSIGNED argc, VOID * argv)
+{
+    UINT32              event_type;
+    EQM_EVENT_ID        event_id = 0;
+    EQM_EVENT_HANDLE    event_handle;
+
+
+    NU_UNUSED_PARAM(argv);
+
+    for (;;)
+    {
+        if (NU_EQM_Wait_Event(&Shell_EqBench_Queue, 1UL << argc,
+                              &event_type, &event_id,
+                              &event_handle) == NU_SUCCESS)
+        {
+            Shell_EqBench_Received++;
+        }
+    }
+}
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       shell_command_eqbench
+*
+*   DESCRIPTION
+*
+*       This is the built-in command: eqbench
+*
+*       Four tasks each post the given number of events (default 2500)
+*       of eight types to one event queue, while four higher priority
+*       tasks each wait for one of the types.  The time per posted event,
+*       including waking the waiters, and the events received against
+*       those posted for the waited types are output.
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*
+*       argc - Argument count
+*
+*       argv - Argument vector
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS
+*
+*************************************************************************/
+static STATUS shell_command_eqbench(NU_SHELL *   p_shell,
+                                    INT          argc,
+                                    CHAR **      argv)
+{
+    NU_MEMORY_POOL *    p_memory_pool;
+    UINT8 *             p_stacks = NU_NULL;
+    UINT8 *             p_stack;
+    TC_TCB *            p_self;
+    UINT32              count = SHELL_EQBENCH_COUNT;
+    UINT32              posters = 0;
+    UINT32              waiters = 0;
+    UINT32              index;
+    UINT32              events;
+    UINT64              start;
+    UINT64              elapsed;
+    STATUS              status;
+    CHAR                line[80];
+
+
+    /* Ensure no more than 1 arg */
+    if (argc > 1)
+    {
+        count = 0;
+    }
+    else if (argc == 1)
+    {
+        /* Convert parameter to a number */
+        count = strtol(argv[0], NU_NULL, 10);
+    }
+
+    /* The posters run one priority and the waiters two priorities above
+       the shell */
+    p_self = (TC_TCB *)NU_Current_Task_Pointer();
+
+    if (count == 0)
+    {
+        /* Output error and format requirements */
+        NU_Shell_Puts(p_shell, "\r\nInvalid Usage!\r\n");
+        NU_Shell_Puts(p_shell, "Format: eqbench [events per poster]");
+    }
+    else if ((p_self == NU_NULL) || (p_self -> tc_base_priority < 2))
+    {
+        NU_Shell_Puts(p_shell, "\r\nShell task priority must be above 1");
+    }
+    else
+    {
+        Shell_EqBench_Count = count;
+        Shell_EqBench_Watched = 0;
+        Shell_EqBench_Received = 0;
+
+        /* Get Nucleus OS (cached) memory resources. */
+        status = NU_System_Memory_Get(&p_memory_pool, NU_NULL);
+
+        if (status == NU_SUCCESS)
+        {
+            status = NU_Allocate_Memory(p_memory_pool, (VOID **)&p_stacks,
+                                        SHELL_EQBENCH_STACK_SIZE *
+                                        (SHELL_EQBENCH_POSTERS + SHELL_EQBENCH_WAITERS),
+                                        NU_NO_SUSPEND);
+        }
+
+        if (status == NU_SUCCESS)
+        {
+            p_stack = p_stacks;
+
+            status = NU_EQM_Create(&Shell_EqBench_Queue,
+                                   SHELL_EQBENCH_QUEUE_SIZE,
+                                   sizeof(EQM_EVENT), p_memory_pool);
+
+            if (status == NU_SUCCESS)
+            {
+                while ((status == NU_SUCCESS) &&
+                       (waiters < SHELL_EQBENCH_WAITERS))
+                {
+                    status = NU_Create_Task(&Shell_EqBench_Waiters[waiters],
+                                            "EQWAIT", shell_eqbench_waiter,
+                                            waiters, NU_NULL, p_stack,
+                                            SHELL_EQBENCH_STACK_SIZE,
+                                            (OPTION)(p_self -> tc_base_priority - 2),
+                                            0, NU_PREEMPT, NU_NO_START);
+
+                    if (status == NU_SUCCESS)
+                    {
+                        p_stack += SHELL_EQBENCH_STACK_SIZE;
+                        waiters++;
+                    }
+                }
+
+                while ((status == NU_SUCCESS) &&
+                       (posters < SHELL_EQBENCH_POSTERS))
+                {
+                    status = NU_Create_Task(&Shell_EqBench_Posters[posters],
+                                            "EQPOST", shell_eqbench_poster,
+                                            posters, NU_NULL, p_stack,
+                                            SHELL_EQBENCH_STACK_SIZE,
+                                            (OPTION)(p_self -> tc_base_priority - 1),
+                                            0, NU_PREEMPT, NU_NO_START);
+
+                    if (status == NU_SUCCESS)
+                    {
+                        p_stack += SHELL_EQBENCH_STACK_SIZE;
+                        posters++;
+                    }
+                }
+
+                if (status == NU_SUCCESS)
+                {
+                    NU_Shell_Puts(p_shell, "\r\nMeasuring...");
+
+                    /* The waiters are waiting for their types by the time
+                       they are resumed */
+                    for (index = 0; index < waiters; index++)
+                    {
+                        (VOID)NU_Resume_Task(&Shell_EqBench_Waiters[index]);
+                    }
+
+                    start = NU_Get_Time_Stamp();
+
+                    /* The shell runs again once all the posters finish */
+                    for (index = 0; index < posters; index++)
+                    {
+                        (VOID)NU_Resume_Task(&Shell_EqBench_Posters[index]);
+                    }
+
+                    elapsed = NU_Get_Time_Stamp() - start;
+
+                    events = count * SHELL_EQBENCH_POSTERS;
+
+                    NU_Shell_Puts(p_shell, " Done!\r\n\r\n");
+                    NU_Shell_Puts(p_shell, "POSTERS  WAITERS   EVENTS  ns/EVENT   RECEIVED/WATCHED\r\n");
+
+                    sprintf(line, "%7lu  %7lu  %7lu  %8lu  %9lu/%-7lu",
+                            (unsigned long)SHELL_EQBENCH_POSTERS,
+                            (unsigned long)SHELL_EQBENCH_WAITERS,
+                            (unsigned long)events,
+                            (unsigned long)((elapsed * 1000000000ULL) /
+                                            ((UINT64)NU_HW_TIMER_TICKS_PER_SEC * events)),
+                            (unsigned long)Shell_EqBench_Received,
+                            (unsigned long)Shell_EqBench_Watched);
+                    NU_Shell_Puts(p_shell, line);
+                }
+
+                /* The posters are finished and the waiters are waiting
+                   for events by now */
+                while (posters > 0)
+                {
+                    posters--;
+                    (VOID)NU_Terminate_Task(&Shell_EqBench_Posters[posters]);
+                    (VOID)NU_Delete_Task(&Shell_EqBench_Posters[posters]);
+                }
+
+                while (waiters > 0)
+                {
+                    waiters--;
+                    (VOID)NU_Terminate_Task(&Shell_EqBench_Waiters[waiters]);
+                    (VOID)NU_Delete_Task(&Shell_EqBench_Waiters[waiters]);
+                }
+
+                (VOID)NU_EQM_Delete(&Shell_EqBench_Queue);
+            }
+
+            (VOID)NU_Deallocate_Memory(p_stacks);
+        }
+
+        if (status != NU_SUCCESS)
+        {
+            NU_Shell_Puts(p_shell, "\r\nUnable to create the benchmark tasks");
+        }
+    }
+
+    /* Carriage return and 2 x line-feed before going back to command shell */
+    NU_Shell_Puts(p_shell, "\r\n\n");
+
+    /* Return success to caller */
+    return (NU_SUCCESS);
+}
+
+/* Global functions */
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Shell_Banner
+*
+*   DESCRIPTION
+*
+*       Displays the initial Shell banner information.
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+ESAL_TS_WEAK_DEF(VOID Shell_Banner(NU_SHELL * p_shell))
+{
+    NU_Shell_Puts(p_shell, "\r\n\n*** Nucleus Shell ***\r\n\r\n");
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Shell_Remove_Shell
+*
+*   DESCRIPTION
+*
+*       Removes the specified shell (deletes semaphore,
+*       deallocates memory, etc)
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS if successful at removing shell
+*
+*************************************************************************/
+STATUS      Shell_Remove_Shell(NU_SHELL * p_shell)
+{
+    STATUS          status;
+    SHELL_CMD *     p_cmd;
+
+
+    /* Deinit the I/O */
+    status = p_shell->session_io.io_deinit(p_shell);
+
+    if (status == NU_SUCCESS)
+    {
+        /* Delete all commands registered for this session */
+        while (p_shell->cmd_count)
+        {
+            /* Get first command in the list. */
+            p_cmd = (SHELL_CMD *)p_shell -> cmd_list -> cs_next;
+
+            /* Delete this command */
+            status = Shell_Remove_Cmd (p_shell, p_cmd->str);
+        }
+    }
+
+    if (status == NU_SUCCESS)
+    {
+        /* Delete the mutex */
+        status = NU_Delete_Semaphore(&(p_shell -> cmd_sem));
+    }
+
+    if (status == NU_SUCCESS)
+    {
+        /* Obtain mutex while traversing or manipulating created shell list */
+        status = NU_Obtain_Semaphore(&Shell_Mutex, NU_SUSPEND);
+
+        /* Ensure mutex obtained */
+        if (status == NU_SUCCESS)
+        {
+            /* Remove shell session from list */
+            NU_Remove_From_List(&Shell_Created_Shell_List, &(p_shell -> created_list));
+
+            /* Release mutex */
+            (VOID)NU_Release_Semaphore(&Shell_Mutex);
+        }
+    }
+
+    if (status == NU_SUCCESS)
+    {
+        /* Deallocate the memory for this shell session */
+        status = NU_Deallocate_Memory(p_shell);
+    }
+
+    /* Return status to caller */
+    return (status);
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Shell_Thread_Entry
+*
+*   DESCRIPTION
+*
+*       This is the main function of the Nucleus SHELL task.  It is
+*       mainly responsible for dispatching commands to the various
+*       responsible functions.
+*
+*   INPUTS
+*
+*       argc - Argument count.  NOT USED.
+*
+*       argv - Argument vector.  Will contain a pointer to the Shell
+*              session handle.
+*
+*   OUTPUTS
+*
+*       None
+*
+*************************************************************************/
+VOID        Shell_Thread_Entry(UNSIGNED argc, VOID * argv)
+{
+    NU_SHELL *      p_shell = (NU_SHELL *)argv;
+    STATUS          status;
+    NU_SUPERV_USER_VARIABLES
+
+
+    NU_SUPERVISOR_MODE();
+
+    /* Call I/O init function */
+    status = p_shell->session_io.io_init(p_shell);
+
+    /* Ensure I/O initialized successfully */
+    if (status == NU_SUCCESS)
+    {
+        /* Print the initial banner before entering the processing loop. */
+        Shell_Banner(p_shell);
+
+        /* Loop processing commands until a kill shell status returned */
+        while (status != NU_KILL_SHELL)
+        {
+            /* Prompt the user for a selection. */
+            p_shell->session_io.io_puts(p_shell, SHELL_PROMPT_STR);
+
+            /* Obtain an input line from the user. */
+            shell_input_line(p_shell);
+
+            /* Process current input line. */
+            status = shell_process(p_shell);
+        }
+    }
+
+    NU_USER_MODE();
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Shell_Register_Cmd
+*
+*   DESCRIPTION
+*
+*       Registers a command to the specified shell session
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*
+*       cmd - Command name string
+*
+*       cmd_fcn - Command function pointer
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS if successful at removing shell
+*
+*************************************************************************/
+STATUS   Shell_Register_Cmd(NU_SHELL *  p_shell,
+                            CHAR *      cmd,
+                            STATUS      (*cmd_fcn) (NU_SHELL *, INT, CHAR **))
+{
+    STATUS                  status;
+    NU_MEMORY_POOL *        p_memory_pool;
+    SHELL_CMD *             p_cmd;
+    UNSIGNED                cmd_mem_size;
+
+
+    /* Obtain command list access. */
+    status = NU_Obtain_Semaphore(&(p_shell -> cmd_sem), NU_SUSPEND);
+
+    /* Ensure mutex owned  */
+    if (status == NU_SUCCESS)
+    {
+        /* Check if a duplicate command exists */
+        p_cmd = shell_find_command(p_shell,
+                                 cmd);
+        if (p_cmd != NU_NULL)
+        {
+            /* ERROR: Found duplicate command already registered. */
+            status = NU_DUPLICATE_CMD;
+        }
+
+        if (status == NU_SUCCESS)
+        {
+            /* Get Nucleus OS (cached) memory resources. */
+            status = NU_System_Memory_Get(&p_memory_pool, NU_NULL);
+        }
+
+        if (status == NU_SUCCESS)
+        {
+            /* Allocate enough memory for the command structure and the
+               command string plus a null terminator for the string */
+            cmd_mem_size = (sizeof(SHELL_CMD)
+                            + (sizeof(CHAR) * (strlen(cmd) + 1)));
+
+            status = NU_Allocate_Memory(p_memory_pool,
+                                        (VOID **)&p_cmd,
+                                        cmd_mem_size,
+                                        NU_NO_SUSPEND);
+        }
+
+        if (status == NU_SUCCESS)
+        {
+            /* Zero initialize the command memory. */
+            memset(p_cmd, 0x00, cmd_mem_size);
+
+            /* Place the string pointer past the structure. */
+            p_cmd -> str = (CHAR *)p_cmd + sizeof(SHELL_CMD);
+
+            /* Copy the input string, cmd, and make it lower case. */
+            SHELL_STRING_TO_LOWER_CASE(cmd, p_cmd -> str);
+
+            /* Null terminate the string. */
+            p_cmd -> str[strlen(cmd)] = 0;
+
+            /* Set command function. */
+            p_cmd -> fcn  = cmd_fcn;
+
+            /* Add the command to the list. */
+            NU_Place_On_List(&p_shell -> cmd_list, (CS_NODE*) p_cmd);
+
+            /* Update command count. */
+            p_shell -> cmd_count++;
+        }
+
+        /* Release the command list access (always if access obtained). */
+        (VOID)NU_Release_Semaphore(&(p_shell -> cmd_sem));
+    }
+
+    /* Return status to caller */
+    return (status);
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Shell_Remove_Cmd
+*
+*   DESCRIPTION
+*
+*       Removes the specified command from the shell session's command
+*       list
+*
+*   INPUTS
+*
+*       p_shell - Shell session handle
+*
+*       cmd - command string to remove
+*
+*   OUTPUTS
+*
+*       NU_SUCCESS if successful at removing command
+*
+*************************************************************************/
+STATUS Shell_Remove_Cmd(NU_SHELL * p_shell, CHAR * cmd)
+{
+    STATUS          status;
+    SHELL_CMD *     p_cmd;
+
+
+    /* Obtain command list access. */
+    status = NU_Obtain_Semaphore(&(p_shell -> cmd_sem), NU_SUSPEND);
+
+    /* Ensure mutex owned */
+    if (status == NU_SUCCESS)
+    {
+        /* Find the matching command structure. */
+        p_cmd = shell_find_command(p_shell, cmd);
+
+        /* Determine if command found */
+        if (p_cmd == NU_NULL)
+        {
+            status = NU_UNAVAILABLE;
         }
         else
         {
@@ -1446,6 +2977,44 @@ STATUS nu_os_svcs_shell_init (CHAR *   path, INT cmd)
                 status = Shell_Register_Cmd(Shell_Global_Cmds, "sleep",shell_command_sleep);
             }
 
+#if (NU_CPU_ACCOUNTING == NU_TRUE)
+            if (status == NU_SUCCESS)
+            {
+                /* Register the built-in "top" command. */
+                status = Shell_Register_Cmd(Shell_Global_Cmds, "top", shell_command_top);
+            }
+#endif
+
+#if (NU_CEILING_MUTEXES == NU_TRUE)
+            if (status == NU_SUCCESS)
+            {
+                /* Register the built-in "mxbench" command. */
+                status = Shell_Register_Cmd(Shell_Global_Cmds, "mxbench", shell_command_mxbench);
+            }
+#endif
+
+#if (NU_TLSF_POOLS == NU_TRUE)
+            if (status == NU_SUCCESS)
+            {
+                /* Register the built-in "mmbench" command. */
+                status = Shell_Register_Cmd(Shell_Global_Cmds, "mmbench", shell_command_mmbench);
+            }
+#endif
+
+#if (NU_POINTER_QUEUES == NU_TRUE)
+            if (status == NU_SUCCESS)
+            {
+                /* Register the built-in "qbench" command. */
+                status = Shell_Register_Cmd(Shell_Global_Cmds, "qbench", shell_command_qbench);
+            }
+#endif
+
+            if (status == NU_SUCCESS)
+            {
+                /* Register the built-in "eqbench" command. */
+                status = Shell_Register_Cmd(Shell_Global_Cmds, "eqbench", shell_command_eqbench);
+            }
+
             /* Ensure previous operation successful */
             if (status == NU_SUCCESS)
             {